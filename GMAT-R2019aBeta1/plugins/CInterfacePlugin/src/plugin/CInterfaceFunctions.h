@@ -50,6 +50,9 @@ double CINTERFACE_API *GetState();
 double CINTERFACE_API *GetDerivativesForState(double epoch, double state[], 
       int stateDim, double dt, int order, int *pdim);
 double CINTERFACE_API *GetDerivatives(double dt, int order, int *pdim);
+int CINTERFACE_API GetDerivativesForStates(int modelID, int count,
+      double epochs[], double states[], int stateDim, double dt, int order,
+      double derivs[], int derivDim, double aMatrices[], int aDim);
 //double CINTERFACE_API *GetDerivatives(double dt, int order);
 
 int CINTERFACE_API CountObjects();
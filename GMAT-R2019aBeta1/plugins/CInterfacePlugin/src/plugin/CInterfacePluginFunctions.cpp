@@ -30,6 +30,8 @@
 
 #include "CCommandFactory.hpp"
 
+#include <mutex>
+
 //#define DEBUG_INTERFACE_FROM_MATLAB
 
 
@@ -45,6 +47,10 @@ std::map<Integer,ODEModel*> odeTable;
 std::map<Integer,PropSetup*> setupTable;
 std::map<std::string,Integer> odeNameTable;
 
+// Serializes the work GetDerivativesForStates does on objects shared between
+// calls: the model tables, the models and the Sandbox objects they use
+std::mutex  evaluationMutex;
+
 #ifdef DEBUG_INTERFACE_FROM_MATLAB
    FILE *fp;
 #endif
@@ -722,6 +728,218 @@ extern "C"
       return retval;
    }
 
+   //---------------------------------------------------------------------------
+   // int GetDerivativesForStates(int modelID, int count, double epochs[],
+   //       double states[], int stateDim, double dt, int order,
+   //       double derivs[], int derivDim, double aMatrices[], int aDim)
+   //---------------------------------------------------------------------------
+   /**
+    * Calculates the derivatives for a batch of states
+    *
+    * This is the batch form of GetDerivativesForState().  The model is looked
+    * up once for the batch, and each result is written into the caller's
+    * buffers rather than into storage shared between calls, so results from
+    * earlier calls are never overwritten.  The propagation state vector is
+    * not changed, and the model epoch is restored after each state, so the
+    * batch does not disturb data set through SetState().  The last message is
+    * only changed when the call fails.
+    *
+    * Elements of the propagation state vector past stateDim are taken from
+    * the propagation state vector, as they are for GetDerivativesForState().
+    *
+    * When aMatrices is not NULL, the A-matrix (the partial derivatives of the
+    * first order derivatives with respect to the state) is returned for each
+    * state transition matrix in the propagation state.  The model must be
+    * propagating the STM.  The A-matrix is calculated with the STM set to
+    * identity, and the STM derivative is then built from it and the input
+    * STM, so the derivative data matches the unbatched call.
+    *
+    * The call is reentrant: each call works on its own copy of the state
+    * data, so batches may be requested from several threads at once, for the
+    * same model or for different ones.  The ODE models share the solar
+    * system and coordinate systems of the GMAT Sandbox, which update cached
+    * data when they are used, so the model evaluations themselves take turns
+    * on an internal lock; the STM products and the copies into the output
+    * buffers run concurrently.  Other interface functions, such as
+    * SetState(), must not be called while a batch is running.
+    *
+    * @param modelID The ID of the model, from FindOdeModel(); 0 or a negative
+    *                value uses the current model
+    * @param count The number of states in the batch
+    * @param epochs The A.1 modified Julian epochs of the states, count elements
+    * @param states The MJ2000 Earth equatorial input states, count rows of
+    *               stateDim elements; see GetDerivativesForState()
+    * @param stateDim The size of each input state
+    * @param dt Time offset (in sec) off of the input epochs
+    * @param order Order of the derivative data returned -- 1 or 2 for first or
+    *              second derivative data
+    * @param derivs Output buffer for the derivative data, count rows of
+    *               derivDim elements
+    * @param derivDim The row size of derivs; at least GetStateSize()
+    * @param aMatrices Output buffer for the A-matrices, count rows of aDim
+    *                  elements, or NULL if the A-matrices are not wanted.
+    *                  Each row holds the row-major A-matrix of each STM in
+    *                  the state vector, in state vector order.
+    * @param aDim The row size of aMatrices; at least the number of STM
+    *             elements in the propagation state vector
+    *
+    * @return The number of states evaluated on success, or a negative value
+    *         on error; the reason for an error is available from
+    *         getLastMessage()
+    *
+    * @note The A-matrix data is subject to the same limitations as the STM
+    *       data noted for GetDerivativesForState().
+    */
+   //---------------------------------------------------------------------------
+   int GetDerivativesForStates(int modelID, int count, double epochs[],
+         double states[], int stateDim, double dt, int order,
+         double derivs[], int derivDim, double aMatrices[], int aDim)
+   {
+      ODEModel  *model = NULL;
+      PropSetup *setup = NULL;
+      GmatState *theState = NULL;
+      Integer dim = 0, stmSize = 0;
+      IntegerArray stmStarts, stmRows;
+      std::vector<Real> base;
+
+      // The lookup, the checks, and the copy of the data set through
+      // SetState() read the shared model tables and propagation state
+      {
+         std::lock_guard<std::mutex> lock(evaluationMutex);
+
+         model = ode;
+         setup = pSetup;
+
+         if (modelID > 0)
+         {
+            if (odeTable.find(modelID) == odeTable.end())
+            {
+               lastMsg = "ERROR in GetDerivativesForStates: The requested "
+                         "ODE model is not in the table of models";
+               return -1;
+            }
+            model = odeTable[modelID];
+            setup = setupTable[modelID];
+         }
+
+         if ((model == NULL) || (setup == NULL))
+         {
+            lastMsg = "ERROR in GetDerivativesForStates: The ODE model is "
+                      "not yet set.";
+            return -1;
+         }
+
+         theState = setup->GetPropStateManager()->GetState();
+         dim = theState->GetSize();
+
+         if ((count < 0) || (stateDim < 0) || (stateDim > dim) ||
+             (derivDim < dim))
+         {
+            char msg[160];
+            sprintf(msg, "ERROR in GetDerivativesForStates: Invalid batch "
+                  "dimensions (count %d, stateDim %d, derivDim %d) for a "
+                  "propagation state vector of size %d", count, stateDim,
+                  derivDim, dim);
+            lastMsg = msg;
+            return -2;
+         }
+
+         if (aMatrices != NULL)
+         {
+            stmSize = FindStmBlocks(setup, stmStarts, stmRows);
+            if (stmSize == 0)
+            {
+               lastMsg = "ERROR in GetDerivativesForStates: A-matrices "
+                         "were requested, but the ODE model is not "
+                         "propagating the STM";
+               return -2;
+            }
+            if (aDim < stmSize)
+            {
+               char msg[128];
+               sprintf(msg, "ERROR in GetDerivativesForStates: The A-matrix "
+                     "row size (%d) is smaller than the STM size (%d)", aDim,
+                     stmSize);
+               lastMsg = msg;
+               return -2;
+            }
+         }
+
+         // Elements past stateDim, and the input STMs, come from here
+         base.assign(theState->GetState(), theState->GetState() + dim);
+      }
+
+      // Per-call scratch data, so concurrent calls share no buffers
+      std::vector<Real> input(dim), phi(stmSize), ddt(dim);
+
+      int retval = count;
+      for (Integer i = 0; i < count; ++i)
+      {
+         input = base;
+         if (stateDim > 0)
+            memcpy(&input[0], states + i * stateDim,
+                  stateDim * sizeof(double));
+
+         // Evaluate with identity STMs so the STM derivative is A
+         for (UnsignedInt b = 0, k = 0; b < stmStarts.size(); ++b)
+         {
+            Integer n = stmRows[b];
+            Real *stm = &input[0] + stmStarts[b];
+            for (Integer j = 0; j < n*n; ++j, ++k)
+            {
+               phi[k] = stm[j];
+               stm[j] = (j % (n+1) == 0 ? 1.0 : 0.0);
+            }
+         }
+
+         std::string failure;
+         if (!EvaluateState(model, theState, epochs[i], &input[0], dt, order,
+               &ddt[0], dim, failure))
+         {
+            std::lock_guard<std::mutex> lock(evaluationMutex);
+            if (failure == "")
+            {
+               char msg[128];
+               sprintf(msg, "ERROR in GetDerivativesForStates: The ODE model "
+                     "failed to evaluate state %d", i);
+               lastMsg = msg;
+            }
+            else
+               lastMsg = "ERROR in GetDerivativesForStates: " + failure;
+            retval = -3;
+            break;
+         }
+
+         Real *out = derivs + i * derivDim;
+         memcpy(out, &ddt[0], dim * sizeof(double));
+
+         // Phi dot = A Phi, as ODEModel::CompleteDerivativeCalculations
+         // builds it
+         for (UnsignedInt b = 0, k = 0; b < stmStarts.size(); ++b)
+         {
+            Integer n = stmRows[b];
+            const Real *a = &ddt[0] + stmStarts[b];
+            const Real *p = &phi[k];
+            Real *aOut = aMatrices + i * aDim + k;
+            Real *phiDot = out + stmStarts[b];
+            for (Integer j = 0; j < n; ++j)
+            {
+               for (Integer m = 0; m < n; ++m)
+               {
+                  Integer element = j * n + m;
+                  aOut[element] = a[element];
+                  phiDot[element] = 0.0;
+                  for (Integer l = 0; l < n; ++l)
+                     phiDot[element] += a[j*n+l] * p[l*n+m];
+               }
+            }
+            k += n*n;
+         }
+      }
+
+      return retval;
+   }
+
    //---------------------------------------------------------------------------
    // int CountObjects()
    //---------------------------------------------------------------------------
@@ -974,6 +1192,115 @@ int GetODEModel(GmatCommand **cmd, const char *modelName)
    return retval;
 }
 
+//------------------------------------------------------------------------------
+// Integer FindStmBlocks(PropSetup *setup, IntegerArray &starts,
+//       IntegerArray &rows)
+//------------------------------------------------------------------------------
+/**
+   * Locates the state transition matrices in a propagation state vector
+   *
+   * @param setup The PropSetup that owns the propagation state vector
+   * @param starts The index of the first element of each STM
+   * @param rows The row count of each STM
+   *
+   * @return The total number of STM elements
+   */
+//------------------------------------------------------------------------------
+Integer FindStmBlocks(PropSetup *setup, IntegerArray &starts,
+      IntegerArray &rows)
+{
+   Integer total = 0;
+   starts.clear();
+   rows.clear();
+
+   const std::vector<ListItem*> *smap =
+         setup->GetPropStateManager()->GetStateMap();
+   if (smap == NULL)
+      return total;
+
+   Integer size = (Integer)smap->size();
+   for (Integer i = 0; i < size; )
+   {
+      if ((*smap)[i]->elementID != Gmat::ORBIT_STATE_TRANSITION_MATRIX)
+      {
+         ++i;
+         continue;
+      }
+
+      // The STM elements for one object are contiguous
+      Integer start = i;
+      GmatBase *owner = (*smap)[i]->object;
+      while ((i < size) &&
+             ((*smap)[i]->elementID == Gmat::ORBIT_STATE_TRANSITION_MATRIX) &&
+             ((*smap)[i]->object == owner))
+         ++i;
+
+      Integer n = (Integer)(sqrt((Real)(i - start)) + 0.5);
+      starts.push_back(start);
+      rows.push_back(n);
+      total += n * n;
+   }
+
+   return total;
+}
+
+//------------------------------------------------------------------------------
+// bool EvaluateState(ODEModel *model, GmatState *theState, GmatEpoch epoch,
+//       Real *input, Real dt, Integer order, Real *ddt, Integer dim,
+//       std::string &failure)
+//------------------------------------------------------------------------------
+/**
+   * Evaluates one state of a GetDerivativesForStates() batch
+   *
+   * The ODE models, and the Sandbox objects they use, are shared between
+   * callers, so the evaluation holds evaluationMutex.  The model and the
+   * propagation state vector are set to the input epoch for the evaluation,
+   * and their epochs are restored before the lock is released.  The state
+   * data is read from the caller's buffer, so the propagation state vector
+   * itself is not changed.
+   *
+   * @param model The ODE model
+   * @param theState The propagation state vector used by the model
+   * @param epoch The A.1 modified Julian epoch of the input state
+   * @param input The full propagation state to evaluate
+   * @param dt Time offset (in sec) off of the input epoch
+   * @param order Order of the derivative data
+   * @param ddt Output buffer for the derivative data, dim elements
+   * @param dim The size of the propagation state vector
+   * @param failure Set to the exception message if the model throws
+   *
+   * @return true if the derivatives were evaluated
+   */
+//------------------------------------------------------------------------------
+bool EvaluateState(ODEModel *model, GmatState *theState, GmatEpoch epoch,
+      Real *input, Real dt, Integer order, Real *ddt, Integer dim,
+      std::string &failure)
+{
+   std::lock_guard<std::mutex> lock(evaluationMutex);
+
+   GmatEpoch savedEpoch = theState->GetEpoch();
+   bool evaluated = false;
+   try
+   {
+      theState->SetEpoch(epoch);
+      model->SetEpoch(epoch);
+      evaluated = model->GetDerivatives(input, dt, order);
+      if (evaluated)
+         memcpy(ddt, model->GetDerivativeArray(), dim * sizeof(double));
+   }
+   catch (BaseException &ex)
+   {
+      failure = ex.GetFullMessage();
+      evaluated = false;
+   }
+
+   theState->SetEpoch(savedEpoch);
+   if (savedEpoch > 0.0)
+      model->SetEpoch(savedEpoch);
+
+   return evaluated;
+}
+
 //------------------------------------------------------------------------------
 // PropSetup *GetFirstPropagator(GmatCommand *cmd)
 //------------------------------------------------------------------------------
@@ -32,6 +32,7 @@ class ODEModel;
 class PropSetup;
 class MessageReceiver;
 class GmatCommand;
+class GmatState;
 
 extern "C"
 {
@@ -52,6 +53,11 @@ extern "C"
    int GetODEModel(GmatCommand **cmd, const char *modelName = "");
    PropSetup *GetFirstPropagator(GmatCommand *cmd);
    PropSetup *GetPropagator(GmatCommand **current);
+   Integer FindStmBlocks(PropSetup *setup, IntegerArray &starts,
+         IntegerArray &rows);
+   bool EvaluateState(ODEModel *model, GmatState *theState, GmatEpoch epoch,
+         Real *input, Real dt, Integer order, Real *ddt, Integer dim,
+         std::string &failure);
 };
 
 #endif /*CInterfacePluginFunctions_hpp*/
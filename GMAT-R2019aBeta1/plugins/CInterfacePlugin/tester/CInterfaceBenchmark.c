@@ -0,0 +1,204 @@
+/*
+ * CInterfaceBenchmark.c
+ *
+ * Times derivative evaluation through the C interface, one state per call
+ * with GetDerivativesForState and as a batch with GetDerivativesForStates,
+ * and checks that both return the same data.  If the ODE model propagates
+ * the STM, the batch is also timed with A-matrix output.
+ *
+ * Usage: CInterfaceBenchmark [scriptName [stateCount]]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <dlfcn.h>
+
+typedef char*   (*LastMessageFn)();
+typedef int     (*StartGmatFn)();
+typedef int     (*LoadScriptFn)(const char*);
+typedef int     (*RunScriptFn)();
+typedef int     (*FindOdeModelFn)(const char*);
+typedef int     (*GetStateSizeFn)();
+typedef double* (*GetDerivativesForStateFn)(double, double*, int, double, int,
+      int*);
+typedef int     (*GetDerivativesForStatesFn)(int, int, double*, double*, int,
+      double, int, double*, int, double*, int);
+
+void *libHandle = NULL;
+
+void *GetFunction(char* funName)
+{
+   void *func = dlsym(libHandle, funName);
+   if (func == NULL)
+      printf(" !!! Cannot locate the function \"%s\" !!!\n", funName);
+   return func;
+}
+
+double Seconds(clock_t start)
+{
+   return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+void Report(char *label, int count, double elapsed)
+{
+   printf("%-28s %8d states  %10.4f s", label, count, elapsed);
+   if (elapsed > 0.0)
+      printf("  %12.0f states/s", count / elapsed);
+   printf("\n");
+}
+
+int main(int argc, char *argv[])
+{
+   char *scriptName = "../samples/Ex_ForceModels.script";
+   int count = 100000;
+   int i, j;
+
+   if (argc > 1)
+      scriptName = argv[1];
+   if (argc > 2)
+      count = atoi(argv[2]);
+   if (count < 1)
+      count = 1;
+
+   printf("************************************************************\n"
+          "*** C Interface Derivative Benchmark\n"
+          "************************************************************\n\n");
+
+   #ifdef __linux
+      libHandle = dlopen("libCInterface.so", RTLD_LAZY);
+   #else
+      libHandle = dlopen("libCInterface.dylib", RTLD_LAZY);
+   #endif
+   if (libHandle == NULL)
+   {
+      printf("\n%s\n", dlerror());
+      return -1;
+   }
+
+   LastMessageFn LastMessage =
+         (LastMessageFn)GetFunction("getLastMessage");
+   StartGmatFn StartGmat = (StartGmatFn)GetFunction("StartGmat");
+   LoadScriptFn LoadScript = (LoadScriptFn)GetFunction("LoadScript");
+   RunScriptFn RunScript = (RunScriptFn)GetFunction("RunScript");
+   FindOdeModelFn FindOdeModel =
+         (FindOdeModelFn)GetFunction("FindOdeModel");
+   GetStateSizeFn GetStateSize =
+         (GetStateSizeFn)GetFunction("GetStateSize");
+   GetDerivativesForStateFn GetDerivativesForState =
+         (GetDerivativesForStateFn)GetFunction("GetDerivativesForState");
+   GetDerivativesForStatesFn GetDerivativesForStates =
+         (GetDerivativesForStatesFn)GetFunction("GetDerivativesForStates");
+
+   if (!LastMessage || !StartGmat || !LoadScript || !RunScript ||
+       !FindOdeModel || !GetStateSize || !GetDerivativesForState ||
+       !GetDerivativesForStates)
+      return -1;
+
+   if ((StartGmat() < 0) || (LoadScript(scriptName) < 0) ||
+       (RunScript() < 0) || (FindOdeModel("") < 0))
+   {
+      printf("%s\nGMAT could not prepare an ODE model from %s; exiting...\n",
+            LastMessage(), scriptName);
+      return -1;
+   }
+   printf("%s\n\n", LastMessage());
+
+   int dim = GetStateSize();
+   int stateDim = 6;
+   printf("Propagation state size: %d\n\n", dim);
+
+   /* States on an inclined circular orbit, one minute apart */
+   double *epochs = (double*)malloc(count * sizeof(double));
+   double *states = (double*)malloc(count * stateDim * sizeof(double));
+   double *single = (double*)malloc(count * dim * sizeof(double));
+   double *batch  = (double*)malloc(count * dim * sizeof(double));
+   for (i = 0; i < count; ++i)
+   {
+      double t = 60.0 * i, r = 7000.0, n = 1.078e-3, inc = 0.5;
+      double c = cos(n * t), s = sin(n * t), v = r * n;
+      double *state = states + i * stateDim;
+      epochs[i] = 21545.0 + t / 86400.0;
+      state[0] = r * c;
+      state[1] = r * s * cos(inc);
+      state[2] = r * s * sin(inc);
+      state[3] = -v * s;
+      state[4] = v * c * cos(inc);
+      state[5] = v * c * sin(inc);
+   }
+
+   clock_t start = clock();
+   for (i = 0; i < count; ++i)
+   {
+      int pdim = 0;
+      double *dv = GetDerivativesForState(epochs[i], states + i * stateDim,
+            stateDim, 0.0, 1, &pdim);
+      if (dv == NULL)
+      {
+         printf("%s\nGetDerivativesForState failed; exiting...\n",
+               LastMessage());
+         return -1;
+      }
+      memcpy(single + i * dim, dv, dim * sizeof(double));
+   }
+   Report("GetDerivativesForState", count, Seconds(start));
+
+   start = clock();
+   if (GetDerivativesForStates(0, count, epochs, states, stateDim, 0.0, 1,
+         batch, dim, NULL, 0) != count)
+   {
+      printf("%s\nGetDerivativesForStates failed; exiting...\n",
+            LastMessage());
+      return -1;
+   }
+   Report("GetDerivativesForStates", count, Seconds(start));
+
+   double maxDiff = 0.0;
+   for (i = 0; i < count * dim; ++i)
+      if (fabs(single[i] - batch[i]) > maxDiff)
+         maxDiff = fabs(single[i] - batch[i]);
+   printf("Largest difference:          %le\n", maxDiff);
+
+   if (dim >= 42)
+   {
+      /* The model propagates an STM; A-matrix rows are sized generously */
+      int aDim = dim - 6;
+      double *aMatrices = (double*)malloc(count * aDim * sizeof(double));
+      start = clock();
+      int evaluated = GetDerivativesForStates(0, count, epochs, states,
+            stateDim, 0.0, 1, batch, dim, aMatrices, aDim);
+      if (evaluated == count)
+      {
+         Report("With A-matrices", count, Seconds(start));
+         maxDiff = 0.0;
+         for (i = 0; i < count * dim; ++i)
+            if (fabs(single[i] - batch[i]) > maxDiff)
+               maxDiff = fabs(single[i] - batch[i]);
+         printf("Largest difference:          %le\n", maxDiff);
+         printf("A-matrix for the first state:\n");
+         for (i = 0; i < 6; ++i)
+         {
+            for (j = 0; j < 6; ++j)
+               printf(" %14.6le", aMatrices[i * 6 + j]);
+            printf("\n");
+         }
+      }
+      else
+         printf("%s\n", LastMessage());
+      free(aMatrices);
+   }
+   else
+      printf("The ODE model does not propagate the STM; skipping the "
+            "A-matrix pass\n");
+
+   free(epochs);
+   free(states);
+   free(single);
+   free(batch);
+
+   dlclose(libHandle);
+   printf("\nBenchmark complete!\n\n");
+   return 0;
+}
@@ -0,0 +1,256 @@
+/*
+ * CInterfaceThreadTest.c
+ *
+ * Checks that GetDerivativesForStates can be called from several threads at
+ * once.  Two ODE models, configured alike, are prepared from a generated
+ * script.  Each model evaluates a batch of states on its own first; then
+ * both batches are evaluated again at the same time, on two threads, several
+ * times over.  Every threaded result must match the serial result exactly.
+ *
+ * Usage: CInterfaceThreadTest [stateCount]
+ *
+ * Returns 0 when the test passes and 1 when it fails.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <dlfcn.h>
+#include <pthread.h>
+
+typedef char*   (*LastMessageFn)();
+typedef int     (*StartGmatFn)();
+typedef int     (*LoadScriptFn)(const char*);
+typedef int     (*RunScriptFn)();
+typedef int     (*FindOdeModelFn)(const char*);
+typedef int     (*GetStateSizeFn)();
+typedef int     (*GetDerivativesForStatesFn)(int, int, double*, double*, int,
+      double, int, double*, int, double*, int);
+
+#define MODEL_COUNT 2
+#define REPEATS     4
+
+void *libHandle = NULL;
+GetDerivativesForStatesFn GetDerivativesForStates = NULL;
+
+/* The work for one thread */
+typedef struct
+{
+   int    modelID;
+   int    count;
+   int    dim;
+   double *epochs;
+   double *states;
+   double *derivs;
+   int    evaluated;
+} Batch;
+
+void *GetFunction(char* funName)
+{
+   void *func = dlsym(libHandle, funName);
+   if (func == NULL)
+      printf(" !!! Cannot locate the function \"%s\" !!!\n", funName);
+   return func;
+}
+
+void *RunBatch(void *data)
+{
+   Batch *batch = (Batch*)data;
+   batch->evaluated = GetDerivativesForStates(batch->modelID, batch->count,
+         batch->epochs, batch->states, 6, 0.0, 1, batch->derivs, batch->dim,
+         NULL, 0);
+   return NULL;
+}
+
+int WriteScript(const char *scriptName)
+{
+   int i;
+   FILE *script = fopen(scriptName, "w");
+   if (script == NULL)
+      return -1;
+
+   fprintf(script, "%% Generated by CInterfaceThreadTest\n\n");
+   for (i = 1; i <= MODEL_COUNT; ++i)
+   {
+      fprintf(script,
+            "Create Spacecraft Sat%d;\n\n"
+            "Create ForceModel FM%d;\n"
+            "FM%d.CentralBody = Earth;\n"
+            "FM%d.PrimaryBodies = {Earth};\n"
+            "FM%d.GravityField.Earth.Degree = 8;\n"
+            "FM%d.GravityField.Earth.Order = 8;\n"
+            "FM%d.PointMasses = {Luna, Sun};\n"
+            "FM%d.SRP = On;\n\n"
+            "Create Propagator Prop%d;\n"
+            "Prop%d.FM = FM%d;\n\n", i, i, i, i, i, i, i, i, i, i, i);
+   }
+   fprintf(script, "PrepareMissionSequence;\n");
+   for (i = 1; i <= MODEL_COUNT; ++i)
+      fprintf(script, "Propagate Prop%d(Sat%d);\n", i, i);
+
+   fclose(script);
+   return 0;
+}
+
+int main(int argc, char *argv[])
+{
+   char *scriptName = "CInterfaceThreadTest.script";
+   int count = 2000;
+   int i, j, r;
+   int failed = 0;
+
+   if (argc > 1)
+      count = atoi(argv[1]);
+   if (count < 1)
+      count = 1;
+
+   printf("************************************************************\n"
+          "*** C Interface Threaded Derivative Test\n"
+          "************************************************************\n\n");
+
+   #ifdef __linux
+      libHandle = dlopen("libCInterface.so", RTLD_LAZY);
+   #else
+      libHandle = dlopen("libCInterface.dylib", RTLD_LAZY);
+   #endif
+   if (libHandle == NULL)
+   {
+      printf("\n%s\n", dlerror());
+      return 1;
+   }
+
+   LastMessageFn LastMessage =
+         (LastMessageFn)GetFunction("getLastMessage");
+   StartGmatFn StartGmat = (StartGmatFn)GetFunction("StartGmat");
+   LoadScriptFn LoadScript = (LoadScriptFn)GetFunction("LoadScript");
+   RunScriptFn RunScript = (RunScriptFn)GetFunction("RunScript");
+   FindOdeModelFn FindOdeModel =
+         (FindOdeModelFn)GetFunction("FindOdeModel");
+   GetStateSizeFn GetStateSize =
+         (GetStateSizeFn)GetFunction("GetStateSize");
+   GetDerivativesForStates =
+         (GetDerivativesForStatesFn)GetFunction("GetDerivativesForStates");
+
+   if (!LastMessage || !StartGmat || !LoadScript || !RunScript ||
+       !FindOdeModel || !GetStateSize || !GetDerivativesForStates)
+      return 1;
+
+   if ((WriteScript(scriptName) < 0) || (StartGmat() < 0) ||
+       (LoadScript(scriptName) < 0) || (RunScript() < 0))
+   {
+      printf("%s\nGMAT could not run %s; exiting...\n", LastMessage(),
+            scriptName);
+      return 1;
+   }
+
+   Batch serial[MODEL_COUNT], threaded[MODEL_COUNT];
+   for (i = 0; i < MODEL_COUNT; ++i)
+   {
+      char modelName[16];
+      sprintf(modelName, "FM%d", i + 1);
+      int modelID = FindOdeModel(modelName);
+      if (modelID <= 0)
+      {
+         printf("%s\nThe ODE model %s was not found; exiting...\n",
+               LastMessage(), modelName);
+         return 1;
+      }
+      int dim = GetStateSize();
+
+      /* States on inclined circular orbits, one minute apart */
+      double *epochs = (double*)malloc(count * sizeof(double));
+      double *states = (double*)malloc(count * 6 * sizeof(double));
+      for (j = 0; j < count; ++j)
+      {
+         double t = 60.0 * j, rad = 7000.0 + 500.0 * i, n = 1.078e-3;
+         double inc = 0.5 + 0.3 * i;
+         double c = cos(n * t), s = sin(n * t), v = rad * n;
+         double *state = states + j * 6;
+         epochs[j] = 21545.0 + t / 86400.0;
+         state[0] = rad * c;
+         state[1] = rad * s * cos(inc);
+         state[2] = rad * s * sin(inc);
+         state[3] = -v * s;
+         state[4] = v * c * cos(inc);
+         state[5] = v * c * sin(inc);
+      }
+
+      serial[i].modelID = threaded[i].modelID = modelID;
+      serial[i].count = threaded[i].count = count;
+      serial[i].dim = threaded[i].dim = dim;
+      serial[i].epochs = threaded[i].epochs = epochs;
+      serial[i].states = threaded[i].states = states;
+      serial[i].derivs = (double*)malloc(count * dim * sizeof(double));
+      threaded[i].derivs = (double*)malloc(count * dim * sizeof(double));
+      printf("Model %s: ID %d, propagation state size %d\n", modelName,
+            modelID, dim);
+   }
+
+   /* Serial reference data */
+   for (i = 0; i < MODEL_COUNT; ++i)
+   {
+      RunBatch(&serial[i]);
+      if (serial[i].evaluated != count)
+      {
+         printf("%s\nThe serial batch failed; exiting...\n", LastMessage());
+         return 1;
+      }
+   }
+
+   /* Both models at once */
+   for (r = 0; r < REPEATS; ++r)
+   {
+      pthread_t threads[MODEL_COUNT];
+      for (i = 0; i < MODEL_COUNT; ++i)
+      {
+         memset(threaded[i].derivs, 0,
+               count * threaded[i].dim * sizeof(double));
+         pthread_create(&threads[i], NULL, RunBatch, &threaded[i]);
+      }
+      for (i = 0; i < MODEL_COUNT; ++i)
+         pthread_join(threads[i], NULL);
+
+      for (i = 0; i < MODEL_COUNT; ++i)
+      {
+         int mismatches = 0;
+         double maxDiff = 0.0;
+         if (threaded[i].evaluated != count)
+         {
+            printf("Pass %d, model %d: %s\n", r, i + 1, LastMessage());
+            failed = 1;
+            continue;
+         }
+         for (j = 0; j < count * threaded[i].dim; ++j)
+         {
+            double diff = fabs(threaded[i].derivs[j] - serial[i].derivs[j]);
+            if (diff != 0.0)
+               ++mismatches;
+            if (diff > maxDiff)
+               maxDiff = diff;
+         }
+         printf("Pass %d, model %d: %d states, %d mismatched elements, "
+               "largest difference %le\n", r, i + 1, count, mismatches,
+               maxDiff);
+         if (mismatches > 0)
+            failed = 1;
+      }
+   }
+
+   for (i = 0; i < MODEL_COUNT; ++i)
+   {
+      free(serial[i].epochs);
+      free(serial[i].states);
+      free(serial[i].derivs);
+      free(threaded[i].derivs);
+   }
+
+   dlclose(libHandle);
+   if (failed)
+   {
+      printf("\nThreaded results differ from the serial results!\n\n");
+      return 1;
+   }
+   printf("\nThreaded test passed!\n\n");
+   return 0;
+}
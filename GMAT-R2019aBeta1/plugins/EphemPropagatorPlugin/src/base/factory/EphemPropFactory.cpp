@@ -24,6 +24,7 @@
 #include "Code500Propagator.hpp"
 #include "SPKPropagator.hpp"
 #include "StkEPropagator.hpp"
+#include "ChebyshevPropagator.hpp"
 
 #include "MessageInterface.hpp"
 
@@ -70,6 +71,9 @@ Propagator* EphemPropFactory::CreatePropagator(const std::string &ofType,
    if (ofType == "STK")
       return new StkEPropagator(withName);
 
+   if (ofType == "Chebyshev")
+      return new ChebyshevPropagator(withName);
+
    return NULL;
 }
 
@@ -90,6 +94,7 @@ EphemPropFactory::EphemPropFactory() :
       creatables.push_back("SPK");
       creatables.push_back("Code500");
       creatables.push_back("STK");
+      creatables.push_back("Chebyshev");
    }
 }
 
@@ -126,6 +131,7 @@ EphemPropFactory::EphemPropFactory(const EphemPropFactory& fact) :
       creatables.push_back("SPK");
       creatables.push_back("Code500");
       creatables.push_back("STK");
+      creatables.push_back("Chebyshev");
    }
 }
 
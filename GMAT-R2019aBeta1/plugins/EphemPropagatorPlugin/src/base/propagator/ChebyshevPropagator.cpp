@@ -0,0 +1,564 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ChebyshevPropagator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation for the ChebyshevPropagator class
+ */
+//------------------------------------------------------------------------------
+
+
+#include "ChebyshevPropagator.hpp"
+#include "MessageInterface.hpp"
+#include "FileManager.hpp"
+#include "PropagatorException.hpp"
+
+#include <sstream>                     // for stringstream
+#include <cstring>                     // for memcpy
+
+//#define DEBUG_INITIALIZATION
+//#define DEBUG_PROPAGATION
+
+#define PAUSE_AT_BOUNDS
+
+
+//---------------------------------
+// static data
+//---------------------------------
+
+/// ChebyshevPropagator parameter labels
+const std::string ChebyshevPropagator::PARAMETER_TEXT[
+                 ChebyshevPropagatorParamCount - EphemerisPropagatorParamCount] =
+{
+      "EphemFile"                  //EPHEMERISFILENAME
+};
+
+/// ChebyshevPropagator parameter types
+const Gmat::ParameterType ChebyshevPropagator::PARAMETER_TYPE[
+                 ChebyshevPropagatorParamCount - EphemerisPropagatorParamCount] =
+{
+      Gmat::FILENAME_TYPE          //EPHEMERISFILENAME
+};
+
+
+//---------------------------------
+// public
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// ChebyshevPropagator(const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ *
+ * @param name The name of the object that gets constructed
+ */
+//------------------------------------------------------------------------------
+ChebyshevPropagator::ChebyshevPropagator(const std::string &name) :
+   EphemerisPropagator        ("Chebyshev", name),
+   ephemName                  (""),
+   fileDataLoaded             (false),
+   timeFromEphemStart         (-1.0),
+   lastEpoch                  (-1.0)
+{
+   // GmatBase data
+   objectTypeNames.push_back("ChebyshevPropagator");
+   parameterCount        = ChebyshevPropagatorParamCount;
+   theEphem              = &ephem;
+}
+
+
+//------------------------------------------------------------------------------
+// ~ChebyshevPropagator()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+ChebyshevPropagator::~ChebyshevPropagator()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ChebyshevPropagator(const ChebyshevPropagator & prop)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param prop The object that is copied into this new one
+ */
+//------------------------------------------------------------------------------
+ChebyshevPropagator::ChebyshevPropagator(const ChebyshevPropagator & prop) :
+   EphemerisPropagator        (prop),
+   ephemName                  (prop.ephemName),
+   fileDataLoaded             (false),
+   timeFromEphemStart         (-1.0),
+   lastEpoch                  (-1.0)
+{
+   theEphem              = &ephem;
+}
+
+
+//------------------------------------------------------------------------------
+// ChebyshevPropagator & operator=(const ChebyshevPropagator & prop)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param prop The object that is provides data for into this one
+ *
+ * @return This propagator, configured to match prop.
+ */
+//------------------------------------------------------------------------------
+ChebyshevPropagator & ChebyshevPropagator::operator=(
+      const ChebyshevPropagator & prop)
+{
+   if (this != &prop)
+   {
+      EphemerisPropagator::operator=(prop);
+
+      ephemName = prop.ephemName;
+      fileDataLoaded = false;
+
+      lastEpoch = currentEpoch = prop.currentEpoch;
+      if (lastEpoch != -1.0)
+         timeFromEphemStart = (lastEpoch - ephemStart) *
+               GmatTimeConstants::SECS_PER_DAY;
+      else
+         timeFromEphemStart = -1.0;
+   }
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// GmatBase* Clone() const
+//------------------------------------------------------------------------------
+/**
+ * Generates a new object that matches this one
+ *
+ * @return The new object
+ */
+//------------------------------------------------------------------------------
+GmatBase* ChebyshevPropagator::Clone() const
+{
+   return new ChebyshevPropagator(*this);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterText(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the script string for a parameter
+ *
+ * @param id The index of the parameter in the parameter tables
+ *
+ * @return The string
+ */
+//------------------------------------------------------------------------------
+std::string ChebyshevPropagator::GetParameterText(const Integer id) const
+{
+   if (id >= EphemerisPropagatorParamCount && id < ChebyshevPropagatorParamCount)
+      return PARAMETER_TEXT[id - EphemerisPropagatorParamCount];
+   return EphemerisPropagator::GetParameterText(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetParameterID(const std::string &str) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the ID of a parameter
+ *
+ * @param The script string for the parameter
+ *
+ * @return The parameter's ID
+ */
+//------------------------------------------------------------------------------
+Integer ChebyshevPropagator::GetParameterID(const std::string &str) const
+{
+   for (Integer i = EphemerisPropagatorParamCount;
+         i < ChebyshevPropagatorParamCount; ++i)
+   {
+       if (str == PARAMETER_TEXT[i - EphemerisPropagatorParamCount])
+           return i;
+   }
+
+   return EphemerisPropagator::GetParameterID(str);
+}
+
+
+//------------------------------------------------------------------------------
+// Gmat::ParameterType GetParameterType(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the type for a parameter
+ *
+ * @param id The ID of the parameter
+ *
+ * @return The parameter's type
+ */
+//------------------------------------------------------------------------------
+Gmat::ParameterType ChebyshevPropagator::GetParameterType(const Integer id) const
+{
+   if (id >= EphemerisPropagatorParamCount && id < ChebyshevPropagatorParamCount)
+      return PARAMETER_TYPE[id - EphemerisPropagatorParamCount];
+   return EphemerisPropagator::GetParameterType(id);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetParameterTypeString(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a string description of a parameter's type
+ *
+ * @param id The ID of the parameter
+ *
+ * @return The type of the parameter
+ */
+//------------------------------------------------------------------------------
+std::string ChebyshevPropagator::GetParameterTypeString(const Integer id) const
+{
+   if (id >= EphemerisPropagatorParamCount && id < ChebyshevPropagatorParamCount)
+      return EphemerisPropagator::PARAM_TYPE_STRING[GetParameterType(id)];
+   return EphemerisPropagator::GetParameterTypeString(id);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsParameterReadOnly(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Reports if a parameter should be hidden from the users
+ *
+ * @param id The ID of the parameter
+ *
+ * @return true if the parameter should be hidden, false if not
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::IsParameterReadOnly(const Integer id) const
+{
+   if (id == EPHEMERISFILENAME)
+      return true;
+   return EphemerisPropagator::IsParameterReadOnly(id);
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsParameterReadOnly(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Reports if a parameter should be hidden from the users
+ *
+ * @param label The scripted string of the parameter
+ *
+ * @return true if the paameter should be hidden, false if not
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::IsParameterReadOnly(const std::string &label) const
+{
+   return IsParameterReadOnly(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const Integer id, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a string parameter
+ *
+ * @param id The ID of the parameter
+ * @param value The new value
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::SetStringParameter(const Integer id,
+      const std::string &value)
+{
+   // The file comes from the spacecraft's EphemerisName
+   if (id == EPHEMERISFILENAME)
+      return true;
+
+   return EphemerisPropagator::SetStringParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// bool SetStringParameter(const std::string &label, const std::string &value)
+//------------------------------------------------------------------------------
+/**
+ * Sets a string parameter
+ *
+ * @param label The script string of the parameter
+ * @param value The new value
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::SetStringParameter(const std::string &label,
+      const std::string &value)
+{
+   return SetStringParameter(GetParameterID(label), value);
+}
+
+
+//------------------------------------------------------------------------------
+// bool Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Prepares the ChebyshevPropagator for use in a run
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::Initialize()
+{
+   #ifdef DEBUG_INITIALIZATION
+      MessageInterface::ShowMessage("ChebyshevPropagator::Initialize() "
+            "entered\n");
+   #endif
+   bool retval = false;
+
+   if (EphemerisPropagator::Initialize())
+   {
+      stepTaken = 0.0;
+
+      FileManager *fm = FileManager::Instance();
+      std::string fullPath;
+
+      if (propObjects.size() != 1)
+         throw PropagatorException("Chebyshev propagators require exactly one "
+               "SpaceObject.");
+
+      // The PSM isn't set until PrepareToPropagate fires.  The following is
+      // also last minute setup, so only do it if the PSM has been set
+      if ((psm != NULL) && !fileDataLoaded)
+      {
+         if (propObjects[0]->IsOfType(Gmat::SPACECRAFT))
+         {
+            ephemName = propObjects[0]->GetStringParameter("EphemerisName");
+            currentEpoch = ((Spacecraft*)propObjects[0])->GetEpoch();
+            currentEpochGT = ((Spacecraft*)propObjects[0])->GetEpochGT();
+         }
+         else
+            throw PropagatorException("Chebyshev ephemeris propagators only "
+                  "work for Spacecraft.");
+
+         if (ephemName == "")
+            throw PropagatorException("The Chebyshev propagator requires a "
+                  "valid ephemeris file name");
+
+         fullPath = fm->FindPath(ephemName, "VEHICLE_EPHEM_PATH", true, false,
+               true);
+         if (fullPath == "")
+            throw PropagatorException("The Chebyshev ephemeris file " +
+                  ephemName + " does not exist");
+
+         if (!ephem.OpenForRead(fullPath))
+            throw PropagatorException("The Chebyshev ephemeris file " +
+                  ephemName + " failed to open");
+
+         ephem.GetStartAndEndEpochs(ephemStart, ephemEnd);
+         fileDataLoaded = true;
+
+         centralBody = ephem.GetCentralBody();
+         if (centralBody == "")
+            centralBody = "Earth";
+         propOrigin = solarSystem->GetBody(centralBody);
+         if (propOrigin == NULL)
+            throw PropagatorException("The central body " + centralBody +
+                  " of the Chebyshev ephemeris file " + ephemName +
+                  " is not in the solar system");
+
+         #ifdef DEBUG_INITIALIZATION
+            MessageInterface::ShowMessage("   Loaded %d records spanning "
+                  "%.12lf to %.12lf about %s\n", ephem.GetRecordCount(),
+                  ephemStart, ephemEnd, centralBody.c_str());
+         #endif
+
+         Rvector6 interpVal = ephem.InterpolatePoint(currentEpoch);
+         std::memcpy(state, interpVal.GetDataVector(), dimension*sizeof(Real));
+         lastEpoch = currentEpoch;
+
+         timeFromEphemStart = (lastEpoch - ephemStart) *
+               GmatTimeConstants::SECS_PER_DAY;
+
+         UpdateSpaceObject(currentEpoch);
+      }
+      retval = true;
+   }
+
+   if (startEpochSource == FROM_SCRIPT)
+      for (UnsignedInt i = 0; i < propObjects.size(); ++i)
+      {
+         propObjects[i]->SetRealParameter("A1Epoch", currentEpoch);
+         propObjects[i]->SetGmatTimeParameter("A1Epoch",
+               hasPrecisionTime ? currentEpochGT : GmatTime(currentEpoch));
+      }
+
+   return retval;
+}
+
+
+//------------------------------------------------------------------------------
+// bool Step()
+//------------------------------------------------------------------------------
+/**
+ * Advances the state vector by the ephem step
+ *
+ * @return true on success, false on failure
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::Step()
+{
+   #ifdef DEBUG_PROPAGATION
+      MessageInterface::ShowMessage("ChebyshevPropagator::Step() entered for "
+            "%p: stepsize = %.12lf; timeFromEpoch = %.12lf\n", this, ephemStep,
+            timeFromEpoch);
+   #endif
+
+   if (lastEpoch != currentEpoch)
+   {
+      lastEpoch = currentEpoch;
+      timeFromEphemStart = (lastEpoch - ephemStart) *
+            GmatTimeConstants::SECS_PER_DAY;
+   }
+
+   timeFromEphemStart += ephemStep;
+   timeFromEpoch += ephemStep;
+   stepTaken = ephemStep;
+
+   currentEpoch = ephemStart + timeFromEphemStart /
+         GmatTimeConstants::SECS_PER_DAY;
+
+   #ifdef PAUSE_AT_BOUNDS
+      // Step to the ephem bound before stepping out of bounds
+      if ((lastEpoch < ephemEnd) && (currentEpoch > ephemEnd))
+         currentEpoch = ephemEnd;
+      if ((lastEpoch > ephemStart) && (currentEpoch < ephemStart))
+         currentEpoch = ephemStart;
+   #endif
+
+   // Allow for slop in the last few bits
+   bool flagOutOfDomain = false;
+   if (currentEpoch < ephemStart)
+   {
+      if (ephemStart - currentEpoch < 1.0e-10)
+         currentEpoch = ephemStart;
+      else
+         flagOutOfDomain = true;
+   }
+   else if (currentEpoch > ephemEnd)
+   {
+      if (currentEpoch - ephemEnd < 1.0e-10)
+         currentEpoch = ephemEnd;
+      else
+         flagOutOfDomain = true;
+   }
+
+   if (flagOutOfDomain)
+   {
+      std::stringstream errmsg;
+      errmsg.precision(16);
+      errmsg << "The Chebyshev Propagator "
+             << instanceName
+             << " is attempting to step outside of the span of the "
+                "ephemeris data; halting.  ";
+      errmsg << "The current Chebyshev ephemeris covers the A.1 modified "
+                "Julian span ";
+      errmsg << ephemStart << " to " << ephemEnd << " and the "
+            "requested epoch is " << currentEpoch << ".";
+      throw PropagatorException(errmsg.str());
+   }
+
+   Rvector6 interpVal = ephem.InterpolatePoint(currentEpoch);
+   lastEpoch = currentEpoch;
+   std::memcpy(state, interpVal.GetDataVector(), dimension*sizeof(Real));
+
+   UpdateSpaceObject(currentEpoch);
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool RawStep()
+//------------------------------------------------------------------------------
+/**
+ * Performs a propagation step without error control
+ *
+ * @note: RawStep is not used with the ChebyshevPropagator
+ *
+ * @return false always
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevPropagator::RawStep()
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetStepTaken()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the size of the most recent ChebyshevPropagator step
+ *
+ * @return The most recent step (0.0 if no step was taken with this instance).
+ */
+//------------------------------------------------------------------------------
+Real ChebyshevPropagator::GetStepTaken()
+{
+   return stepTaken;
+}
+
+
+//------------------------------------------------------------------------------
+// void UpdateState()
+//------------------------------------------------------------------------------
+/**
+ * Updates the propagation state vector with data from the
+ * PropagationStateManager
+ */
+//------------------------------------------------------------------------------
+void ChebyshevPropagator::UpdateState()
+{
+   Rvector6 theState = ephem.InterpolatePoint(currentEpoch);
+   std::memcpy(state, theState.GetDataVector(), dimension*sizeof(Real));
+}
+
+
+//------------------------------------------------------------------------------
+// void SetEphemSpan(Integer whichOne)
+//------------------------------------------------------------------------------
+/**
+ * Determines the start and end epoch of the ephemeris
+ *
+ * @param whichOne Not currrently used.
+ */
+//------------------------------------------------------------------------------
+void ChebyshevPropagator::SetEphemSpan(Integer whichOne)
+{
+   ephem.GetStartAndEndEpochs(ephemStart, ephemEnd);
+}
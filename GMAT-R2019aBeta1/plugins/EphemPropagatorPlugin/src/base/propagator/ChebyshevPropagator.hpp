@@ -0,0 +1,102 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ChebyshevPropagator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition for the ChebyshevPropagator class
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef ChebyshevPropagator_hpp
+#define ChebyshevPropagator_hpp
+
+#include "ephempropagator_defs.hpp"
+#include "EphemerisPropagator.hpp"
+#include "ChebyshevEphemerisFile.hpp"
+
+
+/**
+ * Propagator that evaluates the records of a Chebyshev ephemeris file.
+ *
+ * Only the index of the file is loaded at initialization; the coefficients of
+ * a record are read when the propagation first reaches it.
+ */
+class EPHEM_PROPAGATOR_API ChebyshevPropagator : public EphemerisPropagator
+{
+public:
+   ChebyshevPropagator(const std::string &name = "");
+   virtual ~ChebyshevPropagator();
+   ChebyshevPropagator(const ChebyshevPropagator& prop);
+   ChebyshevPropagator& operator=(const ChebyshevPropagator& prop);
+
+   virtual GmatBase*    Clone() const;
+
+   // Access methods for the scriptable parameters
+   virtual std::string  GetParameterText(const Integer id) const;
+   virtual Integer      GetParameterID(const std::string &str) const;
+   virtual Gmat::ParameterType
+                        GetParameterType(const Integer id) const;
+   virtual std::string  GetParameterTypeString(const Integer id) const;
+
+   virtual bool         IsParameterReadOnly(const Integer id) const;
+   virtual bool         IsParameterReadOnly(const std::string &label) const;
+
+   virtual bool         SetStringParameter(const Integer id,
+                                           const std::string &value);
+   virtual bool         SetStringParameter(const std::string &label,
+                                           const std::string &value);
+
+   virtual bool         Initialize();
+
+   virtual bool         Step();
+   virtual bool         RawStep();
+   virtual Real         GetStepTaken();
+
+protected:
+   /// The ephem file that is propagated
+   std::string             ephemName;
+   /// The ephem reader
+   ChebyshevEphemerisFile  ephem;
+   /// Flag indicating the file index has been loaded
+   bool                    fileDataLoaded;
+   /// Time from the start of the ephem, in seconds
+   Real                    timeFromEphemStart;
+   /// Most recent epoch used from this propagator
+   GmatEpoch               lastEpoch;
+
+   virtual void            UpdateState();
+   virtual void            SetEphemSpan(Integer whichOne = 0);
+
+   /// Parameter IDs
+   enum
+   {
+      EPHEMERISFILENAME = EphemerisPropagatorParamCount,
+      ChebyshevPropagatorParamCount,
+   };
+
+   /// ChebyshevPropagator parameter types
+   static const Gmat::ParameterType PARAMETER_TYPE[ChebyshevPropagatorParamCount -
+                                                   EphemerisPropagatorParamCount];
+   /// ChebyshevPropagator parameter labels
+   static const std::string PARAMETER_TEXT[ChebyshevPropagatorParamCount -
+                                           EphemerisPropagatorParamCount];
+};
+
+#endif /* ChebyshevPropagator_hpp */
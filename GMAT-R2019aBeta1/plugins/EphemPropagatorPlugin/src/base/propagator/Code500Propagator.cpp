@@ -94,6 +94,9 @@ Code500Propagator::Code500Propagator(const std::string &name) :
    timeFromEphemStart         (-1.0),
    lastEpoch                  (-1.0),
    lastEpochGT                (-1.0),
+   windowBlock                (-1),
+   windowLine                 (-1),
+   windowIsGT                 (false),
    ephemCoord                 (NULL),
    j2k                        (NULL)
 {
@@ -142,6 +145,9 @@ Code500Propagator::Code500Propagator(const Code500Propagator & prop) :
    timeFromEphemStart         (-1.0),
    lastEpoch                  (-1.0),
    lastEpochGT                (-1.0),
+   windowBlock                (-1),
+   windowLine                 (-1),
+   windowIsGT                 (false),
    ephemCoord                 (NULL),
    j2k                        (NULL)
 {
@@ -176,6 +182,7 @@ Code500Propagator & Code500Propagator::operator=(const Code500Propagator & prop)
       ephemRecords = NULL;
       record = -1;
       stateIndex = -1;
+      windowBlock = windowLine = -1;
       lastEpoch = currentEpoch = prop.currentEpoch;
       lastEpochGT = currentEpochGT = prop.currentEpochGT;
 
@@ -702,6 +709,7 @@ bool Code500Propagator::Initialize()
             startEpochs.clear();
             timeSteps.clear();
             timeSpans.clear();
+            blockOffsets.clear();
             for (UnsignedInt i = 0; i < ephemRecords->size(); ++i)
             {
                // Save the data used by the Code500 propagator in GMAT compatible formats
@@ -738,6 +746,9 @@ bool Code500Propagator::Initialize()
                if (timeSystem == 2.0) // If using UTC, adjust for leap seconds if necessary
                   span += theTimeConverter->NumberOfLeapSecondsFrom(epoch + span/GmatTimeConstants::SECS_PER_DAY) -
                           theTimeConverter->NumberOfLeapSecondsFrom(epoch);
+               // Running sum of the spans, accumulated in block order
+               blockOffsets.push_back(i == 0 ? 0.0 :
+                     blockOffsets.back() + timeSpans.back());
                timeSpans.push_back(span);
 
                #ifdef DEBUG_INITIALIZATION
@@ -808,10 +819,13 @@ bool Code500Propagator::Initialize()
             ephemCoord = CoordinateSystem::CreateLocalCoordinateSystem("csOnCode500Ephem", axisSystemOnFile,
                propOrigin, NULL, NULL, earth, solarSystem);
             
+            blockIndex.SetNodes(startEpochs);
+
             // Build the interpolator.  For now, use not-a-knot splines
             if (interp != NULL)
                delete interp;
             interp = new NotAKnotInterpolator("Code500NotAKnot", 6);
+            windowBlock = windowLine = -1;
             ephem.CloseForRead();
 
             Rvector6 outState;
@@ -1159,19 +1173,10 @@ void Code500Propagator::FindRecord(GmatEpoch forEpoch)
 
    if ((forEpoch >= ephemStart) && (forEpoch <= ephemEnd))
    {
-      record = -2;
-      for (UnsignedInt i = 0; i < ephemRecords->size(); ++i)
-         if (forEpoch < startEpochs[i])
-         {
-            record = i - 1;
-            break;
-         }
-
-      // Handle epoch in the final block
-      if (record == -2)
-      {
-         record = ephemRecords->size() - 1;
-      }
+      // The block is the last one starting at or before the epoch
+      record = blockIndex.FindNode(forEpoch);
+      if (record < 0)
+         record = 0;
 
       // Now figure out the record number in the block
       Real secsPastStart = (forEpoch - startEpochs[record]) *
@@ -1193,19 +1198,15 @@ void Code500Propagator::FindRecord(GmatTime forEpoch)
 
    if ((forEpoch >= ephemStart) && (forEpoch <= ephemEnd))
    {
-      record = -2;
-      for (UnsignedInt i = 0; i < ephemRecords->size(); ++i)
-         if (forEpoch < startEpochs[i])
-         {
-            record = i - 1;
-            break;
-         }
-
-      // Handle epoch in the final block
-      if (record == -2)
-      {
-         record = ephemRecords->size() - 1;
-      }
+      // Locate the block from the Real epoch, then settle it at full precision
+      Integer lastBlock = startEpochs.size() - 1;
+      record = blockIndex.FindNode(forEpoch.GetMjd());
+      if (record < 0)
+         record = 0;
+      while ((record > 0) && (forEpoch < startEpochs[record]))
+         --record;
+      while ((record < lastBlock) && !(forEpoch < startEpochs[record + 1]))
+         ++record;
 
       // Now figure out the record number in the block
       Real secsPastStart = (forEpoch - GmatTime(startEpochs[record])).GetTimeInSec();
@@ -1379,11 +1380,18 @@ void Code500Propagator::UpdateInterpolator(const GmatEpoch &forEpoch)
    if (stateIndex > 45)
       startIndex = stateIndex - 45;
 
+   // The interpolator already holds these points
+   if (!windowIsGT && (windowBlock == usedRecords[0][0]) &&
+       (windowLine == usedRecords[0][1]))
+      return;
+
    Real epoch;
    Real state[6];
 
-   // Brute force for now: refill the interpolator
    interp->Clear();
+   windowBlock = usedRecords[0][0];
+   windowLine  = usedRecords[0][1];
+   windowIsGT  = false;
 
    #ifdef DEBUG_INTERPOLATION
       MessageInterface::ShowMessage("Pairs used for epoch %.12lf:\n", forEpoch);
@@ -1391,9 +1399,7 @@ void Code500Propagator::UpdateInterpolator(const GmatEpoch &forEpoch)
 
    for (UnsignedInt i = 0; i < 5; ++i)
    {
-      Real epochOffset = 0;
-      for (UnsignedInt j = 0; j < usedRecords[i][0]; ++j)
-         epochOffset += timeSpans.at(j);
+      Real epochOffset = blockOffsets.at(usedRecords[i][0]);
       epochOffset += timeSteps[usedRecords[i][0]] * (usedRecords[i][1]);
 
       if (ephem.GetTimeSystem() == 2.0)  // Check Leap seconds for UTC
@@ -1530,11 +1536,18 @@ void Code500Propagator::UpdateInterpolator(const GmatTime &forEpoch)
    if (/*(record == 0) &&*/ (stateIndex > 45))
       startIndex = stateIndex - 45;
 
+   // The interpolator already holds these points
+   if (windowIsGT && (windowBlock == usedRecords[0][0]) &&
+       (windowLine == usedRecords[0][1]))
+      return;
+
    GmatTime epoch;
    Real state[6];
 
-   // Brute force for now: refill the interpolator
    interp->Clear();
+   windowBlock = usedRecords[0][0];
+   windowLine  = usedRecords[0][1];
+   windowIsGT  = true;
 
 #ifdef DEBUG_INTERPOLATION
    MessageInterface::ShowMessage("Pairs used for epoch %s:\n", GmatTime(forEpoch).ToString().c_str());
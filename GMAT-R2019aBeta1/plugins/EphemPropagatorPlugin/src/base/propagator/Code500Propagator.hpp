@@ -40,6 +40,7 @@
 #include "EphemerisPropagator.hpp"
 #include "Code500EphemerisFile.hpp"
 #include "Interpolator.hpp"
+#include "EphemerisIndex.hpp"
 
 
 class EPHEM_PROPAGATOR_API Code500Propagator : public EphemerisPropagator
@@ -128,6 +129,15 @@ protected:
    GmatTime                lastEpochGT;
    /// Time spanned by each data block
    RealArray               timeSpans;
+   /// Seconds from the ephem start to the start of each data block
+   RealArray               blockOffsets;
+   /// Lookup table for the data block containing an epoch
+   EphemerisIndex          blockIndex;
+   /// First [block, line] pair loaded in the interpolator, or -1 if none
+   Integer                 windowBlock;
+   Integer                 windowLine;
+   /// Flag indicating the interpolator was loaded for precision time
+   bool                    windowIsGT;
 
    /// CoordinateConverter instance
    CoordinateConverter     cc;
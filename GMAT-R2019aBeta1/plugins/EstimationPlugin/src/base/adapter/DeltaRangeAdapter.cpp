@@ -899,11 +899,6 @@ const std::vector<RealArray>& DeltaRangeAdapter::CalculateMeasurementDerivatives
       MessageInterface::ShowMessage("Solve-for parameter: %s\n", paramName.c_str());
    #endif
 
-   // Clear derivative variable:
-   for (UnsignedInt i = 0; i < theDataDerivatives.size(); ++i)
-      theDataDerivatives[i].clear();
-   theDataDerivatives.clear();
-
    if (paramName == "Bias")
    {
       // TODO: what is this? do we need it in DeltaRangeAdapter?
@@ -911,130 +906,17 @@ const std::vector<RealArray>& DeltaRangeAdapter::CalculateMeasurementDerivatives
       if (((ErrorModel*)obj)->GetStringParameter("Type") == "SN_Doppler")
          theDataDerivatives = calcData->CalculateMeasurementDerivatives(obj, id);
       else
-      {
-         Integer size = obj->GetEstimationParameterSize(id);
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         theDataDerivatives.push_back(oneRow);
-      }
+         PrepareDerivativeBuffer(theDataDerivatives, 1,
+               obj->GetEstimationParameterSize(id));
    }
    else
    {
-
-      // Perform the calculations
-      // Derivative for reference leg
-      const std::vector<RealArray> *derivativeDataRef =
-         &(referenceLeg->CalculateMeasurementDerivatives(obj, id));
-
-      // Derivative for other leg
-
-      // First we need to set up the STM for the other leg:
-      // it must coincide with the STM for the reference leg
-      otherLeg->GetMeasurementModel()->GetSignalData()[0]->tSTM =
-	referenceLeg->GetMeasurementModel()->GetSignalData()[0]->tSTM;
-      otherLeg->GetMeasurementModel()->GetSignalData()[0]->tSTMtm =
-	referenceLeg->GetMeasurementModel()->GetSignalData()[0]->tSTMtm;
-
-      // now we can compte the derivative as usual
-      const std::vector<RealArray> *derivativeDataOther =
-         &(otherLeg->CalculateMeasurementDerivatives(obj, id));
-
-      // copy reference and other paths' derivatives
-      UnsignedInt size = derivativeDataRef->at(0).size();
-      std::vector<RealArray> derivativesRef;
-      for (UnsignedInt i = 0; i < derivativeDataRef->size(); ++i)
-      {
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         derivativesRef.push_back(oneRow);
-
-         if (derivativeDataRef->at(i).size() != size)
-            throw MeasurementException("Derivative data size is a different size "
-               "than expected");
-
-         for (UnsignedInt j = 0; j < size; ++j)
-         {
-            derivativesRef[i][j] = (derivativeDataRef->at(i))[j];
-         }
-      }
-   
-      size = derivativeDataOther->at(0).size();
-      std::vector<RealArray> derivativesOther;
-      for (UnsignedInt i = 0; i < derivativeDataOther->size(); ++i)
-      {
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         derivativesOther.push_back(oneRow);
-
-         if (derivativeDataOther->at(i).size() != size)
-            throw MeasurementException("Derivative data size is a different size "
-               "than expected");
-
-         for (UnsignedInt j = 0; j < size; ++j)
-         {
-            derivativesOther[i][j] = (derivativeDataOther->at(i))[j];
-         }
-      }
-
-      #ifdef DEBUG_ADAPTER_DERIVATIVES
-      MessageInterface::ShowMessage("   Derivatives Reference path: [");
-      for (UnsignedInt i = 0; i < derivativeDataRef->size(); ++i)
-      {
-         if (i > 0)
-            MessageInterface::ShowMessage("]\n                [");
-         for (UnsignedInt j = 0; j < derivativeDataRef->at(i).size(); ++j)
-         {
-            if (j > 0)
-               MessageInterface::ShowMessage(", ");
-            MessageInterface::ShowMessage("%.12le", (derivativeDataRef->at(i))[j]);
-         }
-      }
-      MessageInterface::ShowMessage("]\n");
-      MessageInterface::ShowMessage("   Derivatives Other path: [");
-      for (UnsignedInt i = 0; i < derivativeDataOther->size(); ++i)
-      {
-         if (i > 0)
-            MessageInterface::ShowMessage("]\n                [");
-         for (UnsignedInt j = 0; j < derivativeDataOther->at(i).size(); ++j)
-         {
-            if (j > 0)
-               MessageInterface::ShowMessage(", ");
-            MessageInterface::ShowMessage("%.12le", (derivativeDataOther->at(i))[j]);
-         }
-      }
-      MessageInterface::ShowMessage("]\n");
-      #endif
-
-      // Now assemble the derivative data into the requested derivative
-      size = derivativesRef[0].size();               // This is the size of derivative vector for signal path 0
-      
-      for (UnsignedInt i = 0; i < derivativesRef.size(); ++i)
-      {
-         // For each signal path, do the following steps:
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         theDataDerivatives.push_back(oneRow);
-
-         if (derivativesRef[i].size() != size)
-            throw MeasurementException("Derivative data size for Reference path is a different size "
-               "than expected");
-         if (derivativesOther[i].size() != size)
-            throw MeasurementException("Derivative data size for Other path is a different size "
-               "than expected");
-
-         for (UnsignedInt j = 0; j < size; ++j)
-         {
-            if ((paramName == "Position")||(paramName == "Velocity")||(paramName == "CartesianX"))
-            {
-               theDataDerivatives[i][j] = derivativesRef[i][j] - derivativesOther[i][j];
-            }
-            else
-            {
-	       // TODO: check if this is correct
-               theDataDerivatives[i][j] =  derivativesRef[i][j] - derivativesOther[i][j];
-            }
-         }
-      }
+      // The derivative buffer is reused from call to call; only its contents
+      // are reset here
+      PrepareDerivativeBuffer(theDataDerivatives,
+            referenceLeg->GetMeasurementModel()->GetSignalPaths().size(),
+            obj->GetEstimationParameterSize(id));
+      AccumulateLegDerivatives(obj, id, paramName, 1.0, theDataDerivatives);
    }
 
    #ifdef DEBUG_DERIVATIVE_CALCULATION
@@ -1058,3 +940,258 @@ const std::vector<RealArray>& DeltaRangeAdapter::CalculateMeasurementDerivatives
 
    return theDataDerivatives;
 }
+
+
+//------------------------------------------------------------------------------
+// void AccumulateLegDerivatives(GmatBase* obj, Integer id,
+//       const std::string &paramName, Real factor,
+//       std::vector<RealArray> &deriv)
+//------------------------------------------------------------------------------
+/**
+ * Adds factor * (reference leg derivative - other leg derivative) into deriv
+ *
+ * Both legs start at the same transmitter at the same transmission time, so
+ * when the w.r.t. object is that transmitter the derivatives are built in one
+ * pass by AccumulateTransmitterDerivatives().  Any other parameter falls back
+ * to AccumulatePathDerivatives(), which differences the derivatives reported
+ * by the two legs.
+ *
+ * @param obj       The object that has the w.r.t. parameter
+ * @param id        The ID of the w.r.t. parameter
+ * @param paramName The name of the w.r.t. parameter
+ * @param factor    Scale factor applied to the difference
+ * @param deriv     The buffer receiving the derivatives; it must already be
+ *                  sized for the measurement
+ */
+//------------------------------------------------------------------------------
+void DeltaRangeAdapter::AccumulateLegDerivatives(GmatBase* obj, Integer id,
+      const std::string &paramName, Real factor,
+      std::vector<RealArray> &deriv)
+{
+   if (!AccumulateTransmitterDerivatives(obj, paramName, factor, deriv))
+      AccumulatePathDerivatives(obj, id, factor, deriv);
+}
+
+
+//------------------------------------------------------------------------------
+// bool AccumulateTransmitterDerivatives(GmatBase* obj,
+//       const std::string &paramName, Real factor,
+//       std::vector<RealArray> &deriv)
+//------------------------------------------------------------------------------
+/**
+ * Adds the leg difference derivatives w.r.t. the shared transmitter into deriv
+ *
+ * When the w.r.t. object is the transmitter of both legs, the legs share the
+ * state transition matrix and only differ in their unit range vectors and
+ * multipliers.  The scaled unit vectors are differenced first and the STM
+ * product is formed once for both legs.
+ *
+ * @param obj       The object that has the w.r.t. parameter
+ * @param paramName The name of the w.r.t. parameter
+ * @param factor    Scale factor applied to the difference
+ * @param deriv     The buffer receiving the derivatives; it must already be
+ *                  sized for the measurement
+ *
+ * @return true if the derivatives were added, false if obj is not the shared
+ *         transmitter or the parameter is not a position or velocity
+ */
+//------------------------------------------------------------------------------
+bool DeltaRangeAdapter::AccumulateTransmitterDerivatives(GmatBase* obj,
+      const std::string &paramName, Real factor,
+      std::vector<RealArray> &deriv)
+{
+   bool wrtR = ((paramName == "Position") || (paramName == "CartesianX"));
+   bool wrtV = ((paramName == "Velocity") || (paramName == "CartesianX"));
+
+   const std::vector<SignalData*> &refData =
+         referenceLeg->GetMeasurementModel()->GetSignalData();
+   const std::vector<SignalData*> &otherData =
+         otherLeg->GetMeasurementModel()->GetSignalData();
+
+   if (!(wrtR || wrtV) || (deriv.size() != 1) ||
+       (refData.size() != 1) || (otherData.size() != 1) ||
+       (refData[0]->next != NULL) || (otherData[0]->next != NULL) ||
+       (refData[0]->tNode != obj) || (otherData[0]->tNode != obj) ||
+       (refData[0]->rNode == obj) || (otherData[0]->rNode == obj))
+      return false;
+
+   const SignalData *ref   = refData[0];
+   const SignalData *other = otherData[0];
+
+   // Transmitter-side terms shared by both legs
+   Rmatrix phi = ref->tSTM * ref->tSTMtm.Inverse();
+
+   // d(m_ref rho_ref - m_other rho_other)/dX =
+   //       -(m_ref u_ref^T R_ref - m_other u_other^T R_other) Phi
+   Real mRef   = GetLegMultiplier(referenceLeg, obj);
+   Real mOther = GetLegMultiplier(otherLeg, obj);
+   Rvector3 uRef   = ref->rangeVecInertial /
+                     ref->rangeVecInertial.GetMagnitude();
+   Rvector3 uOther = other->rangeVecInertial /
+                     other->rangeVecInertial.GetMagnitude();
+   Rvector3 w = mRef * (uRef * ref->tJ2kRotation) -
+                mOther * (uOther * other->tJ2kRotation);
+
+   RealArray &row = deriv[0];
+   Integer offset = 0;
+   if (wrtR)
+   {
+      for (Integer j = 0; j < 3; ++j)
+         row[j] -= factor * (w[0] * phi(0, j) + w[1] * phi(1, j) +
+                             w[2] * phi(2, j));
+      offset = 3;
+   }
+   if (wrtV)
+   {
+      for (Integer j = 0; j < 3; ++j)
+         row[j + offset] -= factor * (w[0] * phi(0, j + 3) +
+               w[1] * phi(1, j + 3) + w[2] * phi(2, j + 3));
+   }
+
+   #ifdef DEBUG_ADAPTER_DERIVATIVES
+      MessageInterface::ShowMessage("   Shared transmitter derivatives "
+            "for %s.%s computed in one pass\n", obj->GetName().c_str(),
+            paramName.c_str());
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void AccumulatePathDerivatives(GmatBase* obj, Integer id, Real factor,
+//       std::vector<RealArray> &deriv)
+//------------------------------------------------------------------------------
+/**
+ * Adds the difference of the derivatives reported by the two legs into deriv
+ *
+ * @param obj       The object that has the w.r.t. parameter
+ * @param id        The ID of the w.r.t. parameter
+ * @param factor    Scale factor applied to the difference
+ * @param deriv     The buffer receiving the derivatives; it must already be
+ *                  sized for the measurement
+ */
+//------------------------------------------------------------------------------
+void DeltaRangeAdapter::AccumulatePathDerivatives(GmatBase* obj, Integer id,
+      Real factor, std::vector<RealArray> &deriv)
+{
+   const std::vector<SignalData*> &refData =
+         referenceLeg->GetMeasurementModel()->GetSignalData();
+   const std::vector<SignalData*> &otherData =
+         otherLeg->GetMeasurementModel()->GetSignalData();
+
+   // Derivative for reference leg
+   const std::vector<RealArray> &derivativeDataRef =
+      referenceLeg->CalculateMeasurementDerivatives(obj, id);
+
+   // Derivative for other leg
+
+   // First we need to set up the STM for the other leg:
+   // it must coincide with the STM for the reference leg
+   otherData[0]->tSTM   = refData[0]->tSTM;
+   otherData[0]->tSTMtm = refData[0]->tSTMtm;
+
+   // now we can compte the derivative as usual
+   const std::vector<RealArray> &derivativeDataOther =
+      otherLeg->CalculateMeasurementDerivatives(obj, id);
+
+   #ifdef DEBUG_ADAPTER_DERIVATIVES
+   MessageInterface::ShowMessage("   Derivatives Reference path: [");
+   for (UnsignedInt i = 0; i < derivativeDataRef.size(); ++i)
+   {
+      if (i > 0)
+         MessageInterface::ShowMessage("]\n                [");
+      for (UnsignedInt j = 0; j < derivativeDataRef[i].size(); ++j)
+      {
+         if (j > 0)
+            MessageInterface::ShowMessage(", ");
+         MessageInterface::ShowMessage("%.12le", derivativeDataRef[i][j]);
+      }
+   }
+   MessageInterface::ShowMessage("]\n");
+   MessageInterface::ShowMessage("   Derivatives Other path: [");
+   for (UnsignedInt i = 0; i < derivativeDataOther.size(); ++i)
+   {
+      if (i > 0)
+         MessageInterface::ShowMessage("]\n                [");
+      for (UnsignedInt j = 0; j < derivativeDataOther[i].size(); ++j)
+      {
+         if (j > 0)
+            MessageInterface::ShowMessage(", ");
+         MessageInterface::ShowMessage("%.12le", derivativeDataOther[i][j]);
+      }
+   }
+   MessageInterface::ShowMessage("]\n");
+   #endif
+
+   // Now assemble the derivative data into the requested derivative
+   if ((derivativeDataRef.size() != deriv.size()) ||
+       (derivativeDataOther.size() != deriv.size()))
+      throw MeasurementException("Derivative data size is a different size "
+         "than expected");
+
+   for (UnsignedInt i = 0; i < deriv.size(); ++i)
+   {
+      UnsignedInt size = deriv[i].size();
+      if (derivativeDataRef[i].size() != size)
+         throw MeasurementException("Derivative data size for Reference path is a different size "
+            "than expected");
+      if (derivativeDataOther[i].size() != size)
+         throw MeasurementException("Derivative data size for Other path is a different size "
+            "than expected");
+
+      for (UnsignedInt j = 0; j < size; ++j)
+         deriv[i][j] += factor * (derivativeDataRef[i][j] -
+                                  derivativeDataOther[i][j]);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void PrepareDerivativeBuffer(std::vector<RealArray> &deriv,
+//       UnsignedInt rows, UnsignedInt size)
+//------------------------------------------------------------------------------
+/**
+ * Sizes a derivative buffer and fills it with zeros
+ *
+ * The rows keep their storage between calls, so once the buffer has been used
+ * for a measurement no further allocation takes place.
+ *
+ * @param deriv The buffer
+ * @param rows  Number of rows (one per signal path)
+ * @param size  Number of elements in each row
+ */
+//------------------------------------------------------------------------------
+void DeltaRangeAdapter::PrepareDerivativeBuffer(std::vector<RealArray> &deriv,
+      UnsignedInt rows, UnsignedInt size)
+{
+   if (deriv.size() != rows)
+      deriv.resize(rows);
+   for (UnsignedInt i = 0; i < rows; ++i)
+      deriv[i].assign(size, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetLegMultiplier(RangeAdapterKm *leg, GmatBase *obj)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the factor a leg applies to its derivatives w.r.t. an object
+ *
+ * RangeAdapterKm::CalculateMeasurementDerivatives() scales the derivatives of
+ * a Range leg w.r.t. a spacecraft by the leg's multiplier, and leaves all
+ * other derivatives unscaled.
+ *
+ * @param leg The leg
+ * @param obj The object that has the w.r.t. parameter
+ *
+ * @return The factor applied by the leg
+ */
+//------------------------------------------------------------------------------
+Real DeltaRangeAdapter::GetLegMultiplier(RangeAdapterKm *leg, GmatBase *obj)
+{
+   if ((leg->GetStringParameter("MeasurementType") == "Range") &&
+       obj->IsOfType(Gmat::SPACECRAFT))
+      return leg->GetMultiplierFactor();
+   return 1.0;
+}
@@ -64,12 +64,25 @@ public:
    
    virtual void SetCorrection(const std::string& correctionName, const std::string& correctionType);
 
+   void AccumulateLegDerivatives(GmatBase *obj, Integer id,
+                                 const std::string &paramName, Real factor,
+                                 std::vector<RealArray> &deriv);
+   bool AccumulateTransmitterDerivatives(GmatBase *obj,
+                                 const std::string &paramName, Real factor,
+                                 std::vector<RealArray> &deriv);
+   void AccumulatePathDerivatives(GmatBase *obj, Integer id, Real factor,
+                                  std::vector<RealArray> &deriv);
+
    RangeAdapterKm* referenceLeg; // Leg that is used to timetag the measurement at time of reception
    RangeAdapterKm* otherLeg; // Leg that is subtracted from referenceLeg to produce the measurement
 
 protected:
    void                 ComputeMeasurementBias(const std::string biasName, const std::string measType, Integer numTrip);
    void                 ComputeMeasurementNoiseSigma(const std::string noiseSigmaName, const std::string measType, Integer numTrip);
+   static void          PrepareDerivativeBuffer(std::vector<RealArray> &deriv,
+                                                UnsignedInt rows,
+                                                UnsignedInt size);
+   static Real          GetLegMultiplier(RangeAdapterKm *leg, GmatBase *obj);
 
    /// Parameter IDs for the RangeAdapterKm
    enum
@@ -964,159 +964,41 @@ const std::vector<RealArray>& DeltaRangeRateAdapter::CalculateMeasurementDerivat
       MessageInterface::ShowMessage("Solve-for parameter: %s\n", paramName.c_str());
    #endif
 
-   // Clear derivative variable
-   for (UnsignedInt i = 0; i < theDataDerivatives.size(); ++i)
-      theDataDerivatives[i].clear();
-   theDataDerivatives.clear();
-
    if (paramName == "Bias")
    {
       //if (((ErrorModel*)obj)->GetStringParameter("Type") == "Doppler_RangeRate")
       if (((ErrorModel*)obj)->GetStringParameter("Type") == "RangeRate")
          theDataDerivatives = calcData->CalculateMeasurementDerivatives(obj, id);
       else
-      {
-         Integer size = obj->GetEstimationParameterSize(id);
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         theDataDerivatives.push_back(oneRow);
-      }
+         PrepareDerivativeBuffer(theDataDerivatives, 1,
+               obj->GetEstimationParameterSize(id));
    }
    else
    {
-      // Perform the calculations
-      const std::vector<RealArray> *derivativeDataE =
-         &(DeltaRangeAdapter::CalculateMeasurementDerivatives(obj, id));
+      // Both paths are accumulated straight into the reused derivative buffer
+      PrepareDerivativeBuffer(theDataDerivatives,
+            referenceLeg->GetMeasurementModel()->GetSignalPaths().size(),
+            obj->GetEstimationParameterSize(id));
 
-      const std::vector<RealArray> *derivativeDataS =
-         &(adapterS->CalculateMeasurementDerivatives(obj, id));
-
-      #ifdef DEBUG_ADAPTER_DERIVATIVES
-      MessageInterface::ShowMessage("   Derivatives E-path: [");
-      for (UnsignedInt i = 0; i < derivativeDataE->size(); ++i)
+      if ((paramName == "Position")||(paramName == "Velocity")||(paramName == "CartesianX"))
       {
-         if (i > 0)
-            MessageInterface::ShowMessage("]\n                [");
-         for (UnsignedInt j = 0; j < derivativeDataE->at(i).size(); ++j)
-         {
-            if (j > 0)
-               MessageInterface::ShowMessage(", ");
-            MessageInterface::ShowMessage("%.12le", (derivativeDataE->at(i))[j]);
-         }
-      }
-      MessageInterface::ShowMessage("]\n");
-      MessageInterface::ShowMessage("   Haft of Derivatives S-path: [");
-      for (UnsignedInt i = 0; i < derivativeDataS->size(); ++i)
-      {
-         if (i > 0)
-            MessageInterface::ShowMessage("]\n                [");
-         for (UnsignedInt j = 0; j < derivativeDataS->at(i).size(); ++j)
-         {
-            if (j > 0)
-               MessageInterface::ShowMessage(", ");
-            MessageInterface::ShowMessage("%.12le", (derivativeDataS->at(i))[j]);
-         }
+         // Convert measurement derivatives from km/s to Hz for velocity and position 
+         AccumulateLegDerivatives(obj, id, paramName, multiplierE,
+               theDataDerivatives);
+         adapterS->AccumulateLegDerivatives(obj, id, paramName, -multiplierS,
+               theDataDerivatives);
       }
-      MessageInterface::ShowMessage("]\n");
-      #endif
-
-      // copy S and E paths' derivatives
-      UnsignedInt size = derivativeDataE->at(0).size();
-      std::vector<RealArray> derivativesE;
-      for (UnsignedInt i = 0; i < derivativeDataE->size(); ++i)
+      else
       {
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         derivativesE.push_back(oneRow);
-
-         if (derivativeDataE->at(i).size() != size)
-            throw MeasurementException("Derivative data size is a different size "
-               "than expected");
-
-         for (UnsignedInt j = 0; j < size; ++j)
-         {
-            derivativesE[i][j] = (derivativeDataE->at(i))[j];
-         }
-      }
-   
-      size = derivativeDataS->at(0).size();
-      std::vector<RealArray> derivativesS;
-      for (UnsignedInt i = 0; i < derivativeDataS->size(); ++i)
-      {
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         derivativesS.push_back(oneRow);
-
-         if (derivativeDataS->at(i).size() != size)
-            throw MeasurementException("Derivative data size is a different size "
-               "than expected");
-
-         for (UnsignedInt j = 0; j < size; ++j)
-         {
-	    derivativesS[i][j] = (derivativeDataS->at(i))[j];
-         }
+         // set the same E path 's derivatives for Bias an other solve-for variables
+         AccumulateLegDerivatives(obj, id, paramName, 1.0,
+               theDataDerivatives);
       }
 
       #ifdef DEBUG_ADAPTER_DERIVATIVES
-      MessageInterface::ShowMessage("   Derivatives E-path: [");
-      for (UnsignedInt i = 0; i < derivativesE.size(); ++i)
-      {
-         if (i > 0)
-            MessageInterface::ShowMessage("]\n                [");
-         for (UnsignedInt j = 0; j < derivativesE[i].size(); ++j)
-         {
-            if (j > 0)
-               MessageInterface::ShowMessage(", ");
-            MessageInterface::ShowMessage("%.12le", derivativesE[i][j]);
-         }
-      }
-      MessageInterface::ShowMessage("] * multiplierE = %.12le\n", multiplierE);
-      MessageInterface::ShowMessage("   Derivatives S-path: [");
-      for (UnsignedInt i = 0; i < derivativesS.size(); ++i)
-      {
-         if (i > 0)
-            MessageInterface::ShowMessage("]\n                [");
-         for (UnsignedInt j = 0; j < derivativesS[i].size(); ++j)
-         {
-            if (j > 0)
-               MessageInterface::ShowMessage(", ");
-            MessageInterface::ShowMessage("%.12le", derivativesS[i][j]);
-         }
-      }
-      MessageInterface::ShowMessage("] * multiplierS = %.12le\n", multiplierS);
+      MessageInterface::ShowMessage("   Derivatives: multiplierE = %.12le, "
+            "multiplierS = %.12le\n", multiplierE, multiplierS);
       #endif
-
-      // Now assemble the derivative data into the requested derivative
-      size = derivativesE[0].size();
-
-      //theDataDerivatives.clear();
-      for (UnsignedInt i = 0; i < derivativesE.size(); ++i)
-      {
-         RealArray oneRow;
-         oneRow.assign(size, 0.0);
-         theDataDerivatives.push_back(oneRow);
-
-         if (derivativesE[i].size() != size)
-            throw MeasurementException("Derivative data size for E path is a different size "
-               "than expected");
-         if (derivativesS[i].size() != size)
-            throw MeasurementException("Derivative data size for S path is a different size "
-               "than expected");
-
-         for (UnsignedInt j = 0; j < size; ++j)
-         {
-            if ((paramName == "Position")||(paramName == "Velocity")||(paramName == "CartesianX"))
-            {
-               // Convert measurement derivatives from km/s to Hz for velocity and position 
-               theDataDerivatives[i][j] = derivativesE[i][j] * multiplierE - derivativesS[i][j] * multiplierS;
-            }
-            else
-            {
-               // set the same E path 's derivatives for Bias an other solve-for variables
-               theDataDerivatives[i][j] = derivativesE[i][j];
-            }
-         }
-      }
    }
 
    #ifdef DEBUG_DERIVATIVE_CALCULATION
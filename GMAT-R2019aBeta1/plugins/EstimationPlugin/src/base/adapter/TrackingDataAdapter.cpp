@@ -26,12 +26,17 @@
 #include "SignalBase.hpp"
 #include "ErrorModel.hpp" 
 #include "GroundstationInterface.hpp"
+#include "RunProfiler.hpp"
 #include <sstream>
 
 //#define DEBUG_CONSTRUCTION
 //#define DEBUG_SET_PARAMETER
 //#define DEBUG_INITIALIZATION
 
+/// Profiler counter for this file
+static const Integer MEASUREMENT_CACHE_HITS =
+      RunProfiler::RegisterCounter("Measurement Cache Hits");
+
 //------------------------------------------------------------------------------
 // Static data
 //------------------------------------------------------------------------------
@@ -97,7 +102,12 @@ TrackingDataAdapter::TrackingDataAdapter(const std::string &typeStr,
    beginIndex           (0),
    endIndex             (0),
    withMediaCorrection  (true),
-   errMsg               ("")
+   errMsg               (""),
+   cacheValid           (false),
+   cacheStateVersion    (0),
+   cacheObservation     (NULL),
+   cacheRampTable       (NULL),
+   cacheSettings        (0)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("TrackingDataAdapter default constructor <%p>\n", this);
@@ -185,7 +195,12 @@ TrackingDataAdapter::TrackingDataAdapter(const TrackingDataAdapter& ma) :
    rampTableNames       (ma.rampTableNames),
    forObjects           (ma.forObjects),
    withMediaCorrection  (ma.withMediaCorrection),
-   errMsg               (ma.errMsg)
+   errMsg               (ma.errMsg),
+   cacheValid           (false),
+   cacheStateVersion    (0),
+   cacheObservation     (NULL),
+   cacheRampTable       (NULL),
+   cacheSettings        (0)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("TrackingDataAdapter copy constructor  from <%p> to <%p>\n", &ma, this);
@@ -243,6 +258,8 @@ TrackingDataAdapter& TrackingDataAdapter::operator=(
       withMediaCorrection = ma.withMediaCorrection;
       errMsg             = ma.errMsg;
 
+      ClearResultCache();
+
       if (calcData)
       {
          delete calcData;
@@ -1136,6 +1153,151 @@ const MeasurementData& TrackingDataAdapter::GetMeasurement()
 }
 
 
+//------------------------------------------------------------------------------
+// const MeasurementData& CalculateCachedMeasurement(UnsignedInt stateVersion,
+//       bool withEvents, ObservationData* forObservation,
+//       std::vector<RampTableData>* rampTB, bool forSimulation)
+//------------------------------------------------------------------------------
+/**
+ * Calculates the measurement, reusing the previous result when nothing it
+ * depends on has changed
+ *
+ * The adapter keeps the results for the observation it calculated last.  They
+ * are reused when the same observation is requested again with the same
+ * settings and the estimation state has not changed since they were made; the
+ * caller passes the state version, which the EstimationStateManager advances
+ * whenever it writes new values into the estimated objects.  Simulation
+ * requests and requests without an observation always recalculate, because
+ * there is no observation record to key the results on.
+ *
+ * @param stateVersion   Version of the estimation state in the objects
+ * @param withEvents     Flag used to perform calculation with event data
+ * @param forObservation The observation being modeled
+ * @param rampTB         Frequency ramp table used in the calculation
+ * @param forSimulation  true when simulating
+ *
+ * @return The measurement data
+ */
+//------------------------------------------------------------------------------
+const MeasurementData& TrackingDataAdapter::CalculateCachedMeasurement(
+      UnsignedInt stateVersion, bool withEvents,
+      ObservationData* forObservation, std::vector<RampTableData>* rampTB,
+      bool forSimulation)
+{
+   UnsignedInt settings = GetCacheSettings(withEvents, forSimulation);
+
+   if (cacheValid && !forSimulation && (forObservation != NULL) &&
+       (cacheStateVersion == stateVersion) &&
+       (cacheObservation == forObservation) &&
+       (cacheEpochGT == forObservation->epochGT) &&
+       (cacheRampTable == rampTB) && (cacheSettings == settings))
+   {
+      RunProfiler::Count(MEASUREMENT_CACHE_HITS);
+      return cachedMeasurement;
+   }
+
+   // Any new calculation replaces the model data behind the cached results
+   ClearResultCache();
+   const MeasurementData &result = CalculateMeasurement(withEvents,
+         forObservation, rampTB, forSimulation);
+
+   if (forSimulation || (forObservation == NULL))
+      return result;
+
+   cachedMeasurement = result;
+   cacheStateVersion = stateVersion;
+   cacheObservation  = forObservation;
+   cacheEpochGT      = forObservation->epochGT;
+   cacheRampTable    = rampTB;
+   cacheSettings     = settings;
+   cacheValid        = true;
+
+   return cachedMeasurement;
+}
+
+
+//------------------------------------------------------------------------------
+// const std::vector<RealArray>& CalculateCachedDerivatives(
+//       UnsignedInt stateVersion, GmatBase *obj, Integer id)
+//------------------------------------------------------------------------------
+/**
+ * Calculates measurement derivatives, reusing earlier results for the cached
+ * measurement
+ *
+ * Derivatives are only cached alongside a valid cached measurement for the
+ * same state version, since they are built from the model data of that
+ * calculation.
+ *
+ * @param stateVersion Version of the estimation state in the objects
+ * @param obj          The object supplying the "with respect to" parameter
+ * @param id           The ID of the parameter
+ *
+ * @return The derivative data
+ */
+//------------------------------------------------------------------------------
+const std::vector<RealArray>& TrackingDataAdapter::CalculateCachedDerivatives(
+      UnsignedInt stateVersion, GmatBase *obj, Integer id)
+{
+   if (!cacheValid || (cacheStateVersion != stateVersion))
+      return CalculateMeasurementDerivatives(obj, id);
+
+   std::pair<GmatBase*, Integer> key(obj, id);
+   std::map<std::pair<GmatBase*, Integer>, std::vector<RealArray> >::iterator
+         entry = cachedDerivatives.find(key);
+   if (entry != cachedDerivatives.end())
+   {
+      RunProfiler::Count(MEASUREMENT_CACHE_HITS);
+      return entry->second;
+   }
+
+   std::vector<RealArray> &stored = cachedDerivatives[key];
+   stored = CalculateMeasurementDerivatives(obj, id);
+   return stored;
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearResultCache()
+//------------------------------------------------------------------------------
+/**
+ * Discards the cached measurement and derivative results
+ */
+//------------------------------------------------------------------------------
+void TrackingDataAdapter::ClearResultCache()
+{
+   cacheValid       = false;
+   cacheObservation = NULL;
+   cacheRampTable   = NULL;
+   cachedDerivatives.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetCacheSettings(bool withEvents, bool forSimulation) const
+//------------------------------------------------------------------------------
+/**
+ * Packs the flags that change a calculation into a single value for the result
+ * cache key
+ *
+ * @param withEvents    Flag used to perform calculation with event data
+ * @param forSimulation true when simulating
+ *
+ * @return The packed settings
+ */
+//------------------------------------------------------------------------------
+UnsignedInt TrackingDataAdapter::GetCacheSettings(bool withEvents,
+      bool forSimulation) const
+{
+   return (withEvents          ? 0x01 : 0) |
+          (forSimulation       ? 0x02 : 0) |
+          (withMediaCorrection ? 0x04 : 0) |
+          (addBias             ? 0x08 : 0) |
+          (addNoise            ? 0x10 : 0) |
+          (rangeOnly           ? 0x20 : 0) |
+          (withLighttime       ? 0x40 : 0);
+}
+
+
 //------------------------------------------------------------------------------
 // bool WriteMeasurements()
 //------------------------------------------------------------------------------
@@ -1294,6 +1456,7 @@ bool TrackingDataAdapter::Initialize()
    #endif
 
    bool retval = false;
+   ClearResultCache();
 
    if (MeasurementModelBase::Initialize())
    {
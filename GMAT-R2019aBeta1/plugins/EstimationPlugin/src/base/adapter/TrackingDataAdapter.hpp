@@ -27,6 +27,7 @@
 #include "ProgressReporter.hpp"
 #include "RampTableData.hpp"
 #include "ObservationData.hpp"
+#include <map>
 
 // Forward reference
 class SolarSystem;
@@ -150,6 +151,18 @@ public:
                         CalculateMeasurementDerivatives(GmatBase *obj,
                               Integer id) = 0;
 
+   // Result cache for repeated requests at the same observation
+   const MeasurementData&
+                        CalculateCachedMeasurement(UnsignedInt stateVersion,
+                              bool withEvents = false,
+                              ObservationData* forObservation = NULL,
+                              std::vector<RampTableData>* rampTB = NULL,
+                              bool forSimulation = false);
+   const std::vector<RealArray>&
+                        CalculateCachedDerivatives(UnsignedInt stateVersion,
+                              GmatBase *obj, Integer id);
+   void                 ClearResultCache();
+
    virtual bool         SetMeasurement(MeasureModel *meas);
    void                 SetModelID(Integer newID);
    Integer              GetModelID();
@@ -275,6 +288,25 @@ protected:
    /// Store the error message whenever an error occurs during measurement calculation
    std::string               errMsg;
 
+   // Result cache for the most recently calculated observation
+   /// Flag indicating that the cached measurement is usable
+   bool                      cacheValid;
+   /// Estimation state version the cached results were calculated for
+   UnsignedInt               cacheStateVersion;
+   /// Observation the cached results were calculated for
+   ObservationData           *cacheObservation;
+   /// Epoch of the cached observation
+   GmatTime                  cacheEpochGT;
+   /// Ramp table used for the cached results
+   std::vector<RampTableData>*cacheRampTable;
+   /// Calculation settings in effect for the cached results
+   UnsignedInt               cacheSettings;
+   /// The cached measurement, including its media corrections
+   MeasurementData           cachedMeasurement;
+   /// Cached derivatives, keyed by object and parameter ID
+   std::map<std::pair<GmatBase*, Integer>, std::vector<RealArray> >
+                             cachedDerivatives;
+
    /// Parameter IDs for the TrackingDataAdapter
    enum
    {
@@ -302,6 +334,9 @@ protected:
    void                 ComputeMeasurementNoiseSigma(const std::string noiseSigmaName, const std::string measType, Integer numTrip);
    void                 ComputeMeasurementErrorCovarianceMatrix();
 
+   UnsignedInt          GetCacheSettings(bool withEvents,
+                                        bool forSimulation) const;
+
    void                 BeginEndIndexesOfRampTable(Integer & err);
    virtual Real         IntegralRampedFrequency(GmatTime t1, Real delta_t, Integer& err);
 };
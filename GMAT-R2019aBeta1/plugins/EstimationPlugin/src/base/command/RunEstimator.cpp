@@ -34,6 +34,7 @@
 #include "EstimatorException.hpp"
 #include "MessageInterface.hpp"
 #include "ODEModel.hpp"
+#include "RunProfiler.hpp"
 
 //#define DEBUG_INITIALIZATION
 //#define DEBUG_EXECUTION
@@ -1318,6 +1319,8 @@ void RunEstimator::Propagate()
       MessageInterface::ShowMessage("Entered RunEstimator::Propagate()\n");
    #endif
 
+   ProfileScope timer(RunProfiler::PROPAGATION);
+
    // If state reset at current epoch - e.g. during sequential estimation -
    // reload the prop vector
    if (theEstimator->ResetState())
@@ -38,6 +38,7 @@
 #include "SchurFactorization.hpp"
 #include "CholeskyFactorization.hpp"
 #include "UtilityException.hpp"
+#include "RunProfiler.hpp"
 
 //#define DEBUG_ACCUMULATION
 //#define DEBUG_ACCUMULATION_RESULTS
@@ -878,6 +879,8 @@ void BatchEstimator::Accumulate()
 #ifdef DEBUG_ACCUMULATION
    MessageInterface::ShowMessage("Entered BatchEstimator::Accumulate()\n");
 #endif
+   ProfileScope timer(RunProfiler::ACCUMULATION);
+
    // Measurements are possible!
    const MeasurementData *calculatedMeas = NULL;
    std::vector<RealArray> stateDeriv;
@@ -1990,6 +1993,8 @@ void BatchEstimator::InnerLoop()
 //------------------------------------------------------------------------------
 void BatchEstimator::SolveNormalEquations(const Rmatrix &infMatrix, Rmatrix &covMatrix)
 {
+   ProfileScope timer(RunProfiler::INVERSION);
+
    #ifdef DEBUG_VERBOSE
       MessageInterface::ShowMessage("   Information matrix:\n");
       for (UnsignedInt i = 0; i < infMatrix.GetNumRows(); ++i)
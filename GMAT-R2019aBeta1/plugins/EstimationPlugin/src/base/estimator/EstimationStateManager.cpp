@@ -406,6 +406,9 @@ void EstimationStateManager::RestoreObjects(ObjectArray *fromBuffer)
             objects.size(), estimationObjectClones.size());
    #endif
 
+   if (measMan != NULL)
+      measMan->AdvanceStateVersion();
+
    ObjectArray *restoreBuffer = fromBuffer;
    if (fromBuffer == NULL)
    {
@@ -882,6 +885,9 @@ void EstimationStateManager::ResetDragCoefficient()
    MessageInterface::ShowMessage("Reset drag force coefficients to objects\n");
 #endif
 
+   if (measMan != NULL)
+      measMan->AdvanceStateVersion();
+
    for (Integer index = 0; index < stateSize; ++index)
    {
       #ifdef DEBUG_OBJECT_UPDATES
@@ -1118,6 +1124,10 @@ bool EstimationStateManager::MapVectorToObjects()
             "   Epoch = %s\n", state.GetEpochGT().ToString().c_str());
    #endif
 
+   // New object values retire the measurement results cached for the old ones
+   if (measMan != NULL)
+      measMan->AdvanceStateVersion();
+
    for (Integer index = 0; index < stateSize; ++index)
    {
       #ifdef DEBUG_OBJECT_UPDATES
@@ -1328,6 +1338,9 @@ bool EstimationStateManager::MapSTMToObjects()
 {
    bool retval = true;
 
+   if (measMan != NULL)
+      measMan->AdvanceStateVersion();
+
    #ifdef DEBUG_STM_MAPPING
       MessageInterface::ShowMessage("Setting object STM's to\n");
       for (Integer i = 0; i < stateSize; ++i)
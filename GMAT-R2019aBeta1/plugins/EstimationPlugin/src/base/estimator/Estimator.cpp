@@ -58,6 +58,7 @@
 #include "DragForce.hpp"
 #include "FileManager.hpp"
 #include "DataWriterInterface.hpp"
+#include "RunProfiler.hpp"
 
 //#include <sstream>
 #include <ctime>
@@ -117,6 +118,8 @@ Estimator::PARAMETER_TEXT[] =
    "AddResidualsPlot",
    "DataFilters",
    "MatlabFile",
+   "ProfileReport",
+   "ProfileFile",
 };
 
 const Gmat::ParameterType
@@ -131,6 +134,8 @@ Estimator::PARAMETER_TYPE[] =
    Gmat::STRINGARRAY_TYPE,
    Gmat::STRINGARRAY_TYPE,
    Gmat::FILENAME_TYPE,        // MATLAB_OUTPUT_FILENAME
+   Gmat::ON_OFF_TYPE,          // PROFILE_REPORT
+   Gmat::FILENAME_TYPE,        // PROFILE_FILENAME
 };
 
 const Integer Estimator::NORMAL_FLAG  = 0;      // Normal
@@ -182,7 +187,9 @@ Estimator::Estimator(const std::string &type, const std::string &name) :
    locatingEvent        (false),
    matWriter            (NULL),
    writeMatFile         (false),
-   matFileName          ("")
+   matFileName          (""),
+   profileReport        (false),
+   profileFileName      ("")
 {
 
    objectTypeNames.push_back("Estimator");
@@ -262,7 +269,9 @@ Estimator::Estimator(const Estimator& est) :
    dataFilterStrings    (est.dataFilterStrings),
    matWriter            (NULL),
    writeMatFile         (est.writeMatFile),
-   matFileName          (est.matFileName)
+   matFileName          (est.matFileName),
+   profileReport        (est.profileReport),
+   profileFileName      (est.profileFileName)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("Estimator::Estimator() enter: <%p,%s> copy constructor from <%p,%s>\n", this, GetName().c_str(), &est, est.GetName().c_str());  
@@ -344,6 +353,9 @@ Estimator& Estimator::operator=(const Estimator& est)
 
       writeMatFile = est.writeMatFile;
       matFileName  = est.matFileName;
+
+      profileReport   = est.profileReport;
+      profileFileName = est.profileFileName;
    }
 
    return *this;
@@ -576,6 +588,12 @@ void Estimator::CompleteInitialization()
    // Get list of signal paths and specify the length of participants' column
    pcolumnLen = 24;
 
+   // Start the stage timers for this run; this also turns them off if a
+   // previous run left them on
+   RunProfiler *profiler = RunProfiler::Instance();
+   profiler->SetEnabled(profileReport);
+   profiler->Reset();
+
 #ifdef DEBUG_INITIALIZE
    MessageInterface::ShowMessage("Exit Estimator::CompleteInitialization()\n");
 #endif
@@ -606,6 +624,10 @@ bool Estimator::Finalize()
    // clear all estimation flags
    editedRecords.clear();
 
+   // Stop collecting timing data in case the run ended before RunComplete()
+   if (profileReport)
+      RunProfiler::Instance()->SetEnabled(false);
+
    return retval;
 }
 
@@ -731,6 +753,9 @@ std::string Estimator::GetStringParameter(const Integer id) const
    if (id == MATLAB_OUTPUT_FILENAME)
       return matFileName;
 
+   if (id == PROFILE_FILENAME)
+      return profileFileName;
+
    return Solver::GetStringParameter(id);
 }
 
@@ -927,6 +952,15 @@ bool Estimator::SetStringParameter(const Integer id,
       return true;
    }
 
+   if (id == PROFILE_FILENAME)
+   {
+      profileFileName = value;
+      if ((profileFileName != "") &&
+          (profileFileName.find(".json") == std::string::npos))
+         profileFileName += ".json";
+      return true;
+   }
+
    return Solver::SetStringParameter(id, value);
 }
 
@@ -1105,6 +1139,9 @@ std::string Estimator::GetOnOffParameter(const Integer id) const
    if (id == SHOW_RESIDUALS)
       return (showAllResiduals ? "On" : "Off");
 
+   if (id == PROFILE_REPORT)
+      return (profileReport ? "On" : "Off");
+
    return Solver::GetOnOffParameter(id);
 }
 
@@ -1139,6 +1176,22 @@ bool Estimator::SetOnOffParameter(const Integer id, const std::string &value)
       return false;
    }
 
+   if (id == PROFILE_REPORT)
+   {
+      if (value == "On")
+      {
+         profileReport = true;
+         return true;
+      }
+      else if (value == "Off")
+      {
+         profileReport = false;
+         return true;
+      }
+
+      return false;
+   }
+
    return Solver::SetOnOffParameter(id, value);
 }
 
@@ -3537,6 +3590,7 @@ void Estimator::WriteToTextFile(Solver::SolverState sState)
          WriteReportFileSummary(theState);
          textFile << textFile0.str() << textFile1.str() << textFile1_1.str() << textFile2.str() << textFile3.str() << textFile4.str();
          textFile0.str(""); textFile1.str(""); textFile1_1.str(""); textFile2.str(""); textFile3.str(""); textFile4.str("");
+         WriteProfileReport(false);
          WriteIterationHeader();
          break;
 
@@ -3544,6 +3598,7 @@ void Estimator::WriteToTextFile(Solver::SolverState sState)
          WriteReportFileSummary(theState);
          textFile << textFile0.str() << textFile1.str() << textFile1_1.str() << textFile2.str() << textFile3.str() << textFile4.str();
          textFile0.str(""); textFile1.str(""); textFile1_1.str(""); textFile2.str(""); textFile3.str(""); textFile4.str("");
+         WriteProfileReport(true);
          break;
 
       default:
@@ -7214,6 +7269,54 @@ void Estimator::WriteReportFileSummary(Solver::SolverState sState)
 }
 
 
+//------------------------------------------------------------------------------------------
+// void WriteProfileReport(bool runComplete)
+//------------------------------------------------------------------------------------------
+/**
+* Write the stage timing and counter tables for the iteration that just ended
+*
+* When the run is complete the run totals follow the iteration table, and the
+* JSON file is written if one was requested.
+*
+* @param runComplete true at the end of the run, false at the end of an
+*                    intermediate iteration
+*/
+//------------------------------------------------------------------------------------------
+void Estimator::WriteProfileReport(bool runComplete)
+{
+   if (!profileReport)
+      return;
+
+   RunProfiler *profiler = RunProfiler::Instance();
+
+   textFile << profiler->GetReportTable("ITERATION " +
+         GmatStringUtil::ToString(iterationsTaken, 3) + ": PROFILE", true);
+   profiler->MarkInterval("Iteration " +
+         GmatStringUtil::Trim(GmatStringUtil::ToString(iterationsTaken, 3)));
+
+   if (runComplete)
+   {
+      textFile << profiler->GetReportTable("RUN PROFILE", false);
+      profiler->SetEnabled(false);
+
+      if (profileFileName != "")
+      {
+         std::string fullName = profileFileName;
+         if ((fullName.find("/") == std::string::npos) &&
+             (fullName.find("\\") == std::string::npos))
+            fullName = FileManager::Instance()->GetPathname(
+                  FileManager::OUTPUT_PATH) + fullName;
+
+         if (!profiler->WriteJson(fullName))
+            MessageInterface::ShowMessage("*** Warning *** The profile file "
+                  "%s could not be written\n", fullName.c_str());
+      }
+   }
+
+   textFile.flush();
+}
+
+
 //------------------------------------------------------------------------------------------
 // std::map<GmatBase*, Rvector6> CalculateCartesianStateMap(
 //                                  const std::vector<ListItem*> *map, GmatState state)
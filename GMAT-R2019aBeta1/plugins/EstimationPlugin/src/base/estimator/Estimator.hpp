@@ -303,6 +303,10 @@ protected:
    bool                    writeMatFile;
    /// .mat data file name
    std::string             matFileName;
+   /// Flag indicating if stage timing is collected and written to the report
+   bool                    profileReport;
+   /// Name of the JSON file receiving the profile data; empty for none
+   std::string             profileFileName;
    /// Data container used during accumulation
    DataBucket              matData;
    /// Data container used for observations
@@ -376,6 +380,8 @@ protected:
       ADD_RESIDUAL_PLOT,
       DATA_FILTERS,
       MATLAB_OUTPUT_FILENAME,
+      PROFILE_REPORT,
+      PROFILE_FILENAME,
       EstimatorParamCount
    };
 
@@ -483,6 +489,7 @@ protected:
    virtual void           WriteReportFileSummaryPart3(Solver::SolverState sState);
    virtual void           WriteReportFileSummaryPart4(Solver::SolverState sState);
    virtual void           WriteReportFileSummary(Solver::SolverState sState);
+   virtual void           WriteProfileReport(bool runComplete);
 
    std::string            GetElementFullName(ListItem* infor, bool isInternalCS,
                                              std::string stateType = "", std::string anomalyType = "TA") const;
@@ -0,0 +1,332 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                         SimulationPipeline
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the pipelined back end used by the Simulator
+ */
+//------------------------------------------------------------------------------
+
+#include "SimulationPipeline.hpp"
+#include "EstimatorException.hpp"
+#include "MessageInterface.hpp"
+
+//#define DEBUG_PIPELINE
+
+
+//------------------------------------------------------------------------------
+// SimulationPipeline()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+SimulationPipeline::SimulationPipeline() :
+   inFlightLimit     (0),
+   inFlight          (0),
+   epochsSubmitted   (0),
+   recordsWritten    (0),
+   stopping          (false),
+   running           (false)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// ~SimulationPipeline()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ *
+ * Stops the pipeline threads if they are still running.
+ */
+//------------------------------------------------------------------------------
+SimulationPipeline::~SimulationPipeline()
+{
+   Stop();
+}
+
+
+//------------------------------------------------------------------------------
+// void Start(Integer writerCount, UnsignedInt maxInFlight)
+//------------------------------------------------------------------------------
+/**
+ * Launches the writer threads
+ *
+ * @param writerCount Number of writer threads; at least one is used
+ * @param maxInFlight Number of records that may be queued before Submit()
+ *                    blocks; 0 selects 256 records per writer
+ */
+//------------------------------------------------------------------------------
+void SimulationPipeline::Start(Integer writerCount, UnsignedInt maxInFlight)
+{
+   Stop();
+
+   if (writerCount < 1)
+      writerCount = 1;
+
+   inFlightLimit   = (maxInFlight > 0 ? maxInFlight : 256 * writerCount);
+   inFlight        = 0;
+   epochsSubmitted = 0;
+   recordsWritten  = 0;
+   stopping        = false;
+   failureMessage  = "";
+   streamLane.clear();
+   lanes.clear();
+   lanes.resize(writerCount);
+
+   for (Integer i = 0; i < writerCount; ++i)
+      writers.push_back(std::thread(&SimulationPipeline::WriterLoop, this, i));
+   running = true;
+
+   #ifdef DEBUG_PIPELINE
+      MessageInterface::ShowMessage("SimulationPipeline started with %d "
+            "writers, %d records in flight\n", writerCount, inFlightLimit);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void Submit(std::vector<Record> &records)
+//------------------------------------------------------------------------------
+/**
+ * Queues the records calculated for one simulation epoch
+ *
+ * Streams are assigned to the writers in the order they are first seen, and
+ * keep that writer for the rest of the run.  The call blocks while the maximum
+ * number of records is already in flight, so the calculation stage cannot run
+ * arbitrarily far ahead of the writers.
+ *
+ * @param records The records for the epoch; the contents are moved into the
+ *                pipeline and the vector is left empty
+ */
+//------------------------------------------------------------------------------
+void SimulationPipeline::Submit(std::vector<Record> &records)
+{
+   if (!running)
+      throw EstimatorException("The simulation pipeline received data before "
+            "it was started");
+
+   std::unique_lock<std::mutex> lock(queueMutex);
+   recordWritten.wait(lock, [this]
+         { return (inFlight < inFlightLimit) || (failureMessage != ""); });
+   CheckForFailure();
+
+   for (UnsignedInt i = 0; i < records.size(); ++i)
+   {
+      std::map<DataFile*, UnsignedInt>::iterator lane =
+            streamLane.find(records[i].stream);
+      if (lane == streamLane.end())
+         lane = streamLane.insert(std::make_pair(records[i].stream,
+               (UnsignedInt)(streamLane.size() % lanes.size()))).first;
+      lanes[lane->second].push_back(std::move(records[i]));
+   }
+   inFlight += records.size();
+   ++epochsSubmitted;
+   records.clear();
+
+   lock.unlock();
+   workReady.notify_all();
+}
+
+
+//------------------------------------------------------------------------------
+// void Drain()
+//------------------------------------------------------------------------------
+/**
+ * Blocks until every submitted record has been written
+ *
+ * Call this before the data streams are closed.
+ */
+//------------------------------------------------------------------------------
+void SimulationPipeline::Drain()
+{
+   if (!running)
+      return;
+
+   std::unique_lock<std::mutex> lock(queueMutex);
+   recordWritten.wait(lock, [this] { return inFlight == 0; });
+   CheckForFailure();
+}
+
+
+//------------------------------------------------------------------------------
+// void Stop()
+//------------------------------------------------------------------------------
+/**
+ * Finishes any queued work and joins the pipeline threads
+ */
+//------------------------------------------------------------------------------
+void SimulationPipeline::Stop()
+{
+   if (!running)
+      return;
+
+   {
+      std::lock_guard<std::mutex> lock(queueMutex);
+      stopping = true;
+   }
+   workReady.notify_all();
+
+   for (UnsignedInt i = 0; i < writers.size(); ++i)
+      writers[i].join();
+   writers.clear();
+
+   running = false;
+
+   #ifdef DEBUG_PIPELINE
+      MessageInterface::ShowMessage("SimulationPipeline stopped after writing "
+            "%d records\n", recordsWritten);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsRunning() const
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the pipeline threads are running
+ *
+ * @return true if Start() has been called without a matching Stop()
+ */
+//------------------------------------------------------------------------------
+bool SimulationPipeline::IsRunning() const
+{
+   return running;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetWriterCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of writer threads
+ *
+ * @return The size of the writer pool
+ */
+//------------------------------------------------------------------------------
+Integer SimulationPipeline::GetWriterCount() const
+{
+   return (Integer)writers.size();
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetRecordsWritten() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of records sent to the data streams
+ *
+ * @return The record count
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SimulationPipeline::GetRecordsWritten() const
+{
+   std::lock_guard<std::mutex> lock(queueMutex);
+   return recordsWritten;
+}
+
+
+//------------------------------------------------------------------------------
+// UnsignedInt GetEpochsSubmitted() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of epochs that have been handed to the pipeline
+ *
+ * @return The epoch count
+ */
+//------------------------------------------------------------------------------
+UnsignedInt SimulationPipeline::GetEpochsSubmitted() const
+{
+   std::lock_guard<std::mutex> lock(queueMutex);
+   return epochsSubmitted;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriterLoop(UnsignedInt lane)
+//------------------------------------------------------------------------------
+/**
+ * Thread body for a writer
+ *
+ * After a write failure the remaining records are discarded rather than
+ * written, so that Drain() still returns and reports the failure.
+ *
+ * @param lane The queue served by this writer
+ */
+//------------------------------------------------------------------------------
+void SimulationPipeline::WriterLoop(UnsignedInt lane)
+{
+   while (true)
+   {
+      Record rec;
+      bool failed;
+      {
+         std::unique_lock<std::mutex> lock(queueMutex);
+         workReady.wait(lock, [this, lane]
+               { return stopping || !lanes[lane].empty(); });
+         if (lanes[lane].empty())
+            return;
+         rec = std::move(lanes[lane].front());
+         lanes[lane].pop_front();
+         failed = (failureMessage != "");
+      }
+
+      bool written = false;
+      if (!failed)
+      {
+         try
+         {
+            rec.stream->WriteMeasurement(&(rec.data));
+            written = true;
+         }
+         catch (BaseException &ex)
+         {
+            std::lock_guard<std::mutex> lock(queueMutex);
+            if (failureMessage == "")
+               failureMessage = ex.GetFullMessage();
+         }
+      }
+
+      {
+         std::lock_guard<std::mutex> lock(queueMutex);
+         --inFlight;
+         if (written)
+            ++recordsWritten;
+      }
+      recordWritten.notify_all();
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckForFailure()
+//------------------------------------------------------------------------------
+/**
+ * Rethrows a failure from a writer on the calling thread
+ *
+ * The caller must hold queueMutex.
+ */
+//------------------------------------------------------------------------------
+void SimulationPipeline::CheckForFailure()
+{
+   if (failureMessage != "")
+      throw EstimatorException("Measurement writing failed in the simulation "
+            "pipeline: " + failureMessage);
+}
@@ -0,0 +1,111 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                         SimulationPipeline
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the pipelined output stage used by the Simulator
+ *
+ * The Simulator evaluates the measurement models for an epoch, noise and bias
+ * included, on the thread that owns the propagators and participants, then
+ * hands the feasible records to this pipeline.  A pool of writer threads sends
+ * the records to their DataFile streams while the Simulator moves on to the
+ * next epoch.  Each stream is served by a single writer, so the records in
+ * every data file are in the same order as in a sequential run.
+ */
+//------------------------------------------------------------------------------
+
+
+#ifndef SimulationPipeline_hpp
+#define SimulationPipeline_hpp
+
+#include "estimation_defs.hpp"
+#include "MeasurementData.hpp"
+#include "DataFile.hpp"
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
+
+
+class ESTIMATION_API SimulationPipeline
+{
+public:
+   /// A single simulated record waiting to be written
+   struct Record
+   {
+      /// The calculated measurement
+      MeasurementData   data;
+      /// The stream that receives the record
+      DataFile          *stream;
+   };
+
+   SimulationPipeline();
+   ~SimulationPipeline();
+
+   void              Start(Integer writerCount, UnsignedInt maxInFlight = 0);
+   void              Submit(std::vector<Record> &records);
+   void              Drain();
+   void              Stop();
+
+   bool              IsRunning() const;
+   Integer           GetWriterCount() const;
+   UnsignedInt       GetRecordsWritten() const;
+   UnsignedInt       GetEpochsSubmitted() const;
+
+private:
+   /// Writer threads, one per lane
+   std::vector<std::thread>               writers;
+   /// Records waiting to be written, one queue per writer
+   std::vector< std::deque<Record> >      lanes;
+   /// The lane that serves each stream
+   std::map<DataFile*, UnsignedInt>       streamLane;
+
+   /// Guards all of the queue and counter data below
+   mutable std::mutex            queueMutex;
+   /// Signalled when records are queued for the writers
+   std::condition_variable       workReady;
+   /// Signalled when a writer has finished a record
+   std::condition_variable       recordWritten;
+
+   /// Maximum number of records submitted but not yet written
+   UnsignedInt                   inFlightLimit;
+   /// Number of records submitted but not yet written
+   UnsignedInt                   inFlight;
+   /// Number of epochs submitted
+   UnsignedInt                   epochsSubmitted;
+   /// Number of records written
+   UnsignedInt                   recordsWritten;
+   /// Flag telling the threads to exit
+   bool                          stopping;
+   /// Flag indicating that the threads are running
+   bool                          running;
+   /// Message from the first failure in a pipeline thread
+   std::string                   failureMessage;
+
+   void              WriterLoop(UnsignedInt lane);
+   void              CheckForFailure();
+
+   // Threads and locks cannot be copied
+   SimulationPipeline(const SimulationPipeline&);
+   SimulationPipeline& operator=(const SimulationPipeline&);
+};
+
+#endif /* SimulationPipeline_hpp */
@@ -40,6 +40,7 @@
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
 #include "ODEModel.hpp"
+#include "MeasurementException.hpp"
 #include <sstream>
 
 //#define DEBUG_STATE_MACHINE
@@ -65,6 +66,7 @@ Simulator::PARAMETER_TEXT[SimulatorParamCount -SolverParamCount] =
    "FinalEpoch",
    "MeasurementTimeStep",
    "AddNoise",
+   "OutputThreads",
 };
 
 const Gmat::ParameterType
@@ -77,6 +79,7 @@ Simulator::PARAMETER_TYPE[SimulatorParamCount - SolverParamCount] =
    Gmat::STRING_TYPE,
    Gmat::REAL_TYPE,
    Gmat::ON_OFF_TYPE,
+   Gmat::INTEGER_TYPE,
 };
 
 //------------------------------------------------------------------------------
@@ -108,6 +111,8 @@ Simulator::Simulator(const std::string& name) :
    locatingEvent       (false),
    timeStep            (60.0),
    addNoise            (false),
+   outputThreads       (0),
+   pipeline            (NULL),
    isEpochFormatSet    (false)
 {
    objectTypeNames.push_back("Simulator");
@@ -153,6 +158,8 @@ Simulator::Simulator(const Simulator& sim) :
    measManager         (sim.measManager),
    measList            (sim.measList),
    addNoise            (sim.addNoise),
+   outputThreads       (sim.outputThreads),
+   pipeline            (NULL),
    isEpochFormatSet    (sim.isEpochFormatSet)
 {
    theTimeConverter = TimeSystemConverter::Instance();
@@ -215,6 +222,7 @@ Simulator& Simulator::operator =(const Simulator& sim)
       measManager         = sim.measManager;
       measList            = sim.measList;
       addNoise            = sim.addNoise;
+      outputThreads       = sim.outputThreads;
       isEpochFormatSet    = sim.isEpochFormatSet;
    }
 
@@ -237,6 +245,9 @@ Simulator::~Simulator()
    if (simState)
       delete simState;
 
+   if (pipeline)
+      delete pipeline;
+
    activeEvents.clear();
    measList.clear();
    measModelList.clear();
@@ -535,6 +546,95 @@ std::string Simulator::GetParameterTypeString(const Integer id) const
 }
 
 
+//------------------------------------------------------------------------------
+//  Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the Integer parameter value, given the input parameter ID.
+ *
+ * @param id ID for the requested parameter value.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::GetIntegerParameter(const Integer id) const
+{
+   if (id == OUTPUT_THREADS)
+      return outputThreads;
+
+   return Solver::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the Integer parameter value, given the input parameter ID.
+ *
+ * @param id         ID for the parameter whose value to change.
+ * @param value      Value for the parameter.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::SetIntegerParameter(const Integer id, const Integer value)
+{
+   if (id == OUTPUT_THREADS)
+   {
+      if (value < 0)
+      {
+         std::stringstream ss;
+         ss << "Error: a negative number (" << value << ") was set to "
+            << GetName() << "." << GetParameterText(id)
+            << " parameter. It should be a nonnegative integer.\n";
+         throw SolverException(ss.str());
+      }
+
+      outputThreads = value;
+      return value;
+   }
+
+   return Solver::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns the Integer parameter value, given the parameter name.
+ *
+ * @param label Name of the requested parameter.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+//  Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * This method sets the Integer parameter value, given the parameter name.
+ *
+ * @param label      Name of the parameter whose value to change.
+ * @param value      Value for the parameter.
+ *
+ * @return  Integer value of the requested parameter.
+ */
+//------------------------------------------------------------------------------
+Integer Simulator::SetIntegerParameter(const std::string &label,
+                                       const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 //  Real GetRealParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1496,6 +1596,11 @@ Solver::SolverState Simulator::AdvanceState()
          /* throw SolverException("Solver state not supported for the simulator")*/;
    }
 
+   // Everything queued in the pipeline must reach the data files before the
+   // RunSimulator command closes them
+   if ((currentState == FINISHED) && pipeline)
+      pipeline->Drain();
+
    #ifdef DEBUG_STATE_MACHINE
       MessageInterface::ShowMessage("Exit Simulator::AdvanceState()\n");
    #endif
@@ -1625,6 +1730,14 @@ void Simulator::CompleteInitialization()
    // Load ramp table
    measManager.LoadRampTables();
 
+   // Launch the writer threads for pipelined simulation
+   if (outputThreads > 0)
+   {
+      if (pipeline == NULL)
+         pipeline = new SimulationPipeline();
+      pipeline->Start(outputThreads);
+   }
+
    nextSimulationEpochGT = simulationStartGT;
    simEpochCounter     = 0;
    //timeStep            = (nextSimulationEpoch - currentEpoch) *
@@ -1818,7 +1931,9 @@ void Simulator::SimulateData()
       }
 
       // Write measurements to data file
-      if (measManager.WriteMeasurements() == false)
+      if (pipeline && pipeline->IsRunning())
+         SubmitToPipeline();
+      else if (measManager.WriteMeasurements() == false)
       {
          throw SolverException("Measurement writing failed.\n");
       }
@@ -1850,6 +1965,16 @@ void Simulator::SimulateData()
 void Simulator::RunComplete()
 {
    WriteToTextFile();
+
+   if (pipeline && pipeline->IsRunning())
+   {
+      pipeline->Stop();
+      MessageInterface::ShowMessage("Simulator '%s' wrote %d records for %d "
+            "epochs using %d output thread(s)\n", GetName().c_str(),
+            pipeline->GetRecordsWritten(), pipeline->GetEpochsSubmitted(),
+            outputThreads);
+   }
+
    // tell the MeasurementManager to close files and finalize
    measManager.Finalize();
 
@@ -1898,6 +2023,48 @@ void Simulator::FindNextSimulationEpoch()
 }
 
 
+//------------------------------------------------------------------------------
+//  void SubmitToPipeline()
+//------------------------------------------------------------------------------
+/**
+ * Hands the feasible measurements at the current epoch to the pipeline.
+ *
+ * The records are copied without the pointers into the adapters' signal path
+ * data, since those buffers are reused at the next epoch while the pipeline
+ * threads are still working on this one.
+ */
+//------------------------------------------------------------------------------
+void Simulator::SubmitToPipeline()
+{
+   std::vector<SimulationPipeline::Record> records;
+   const MeasurementData* measData = NULL;
+   for (Integer i = 0; (measData = measManager.GetMeasurement(i)) != NULL; ++i)
+   {
+      if (!measData->isFeasible)
+         continue;
+
+      DataFile *stream = measManager.GetMeasurementStream(i);
+      if (stream == NULL)
+         throw MeasurementException("Error: No data file is defined in "
+               "TrackingFileSet or MeasurementModel\n");
+
+      SimulationPipeline::Record rec;
+      rec.data = *measData;
+      rec.data.rangeVecs.clear();
+      rec.data.tBodies.clear();
+      rec.data.rBodies.clear();
+      rec.data.tLocs.clear();
+      rec.data.rLocs.clear();
+      rec.data.covariance = NULL;
+      rec.stream = stream;
+      records.push_back(rec);
+   }
+
+   if (!records.empty())
+      pipeline->Submit(records);
+}
+
+
 //------------------------------------------------------------------------------
 //  std::string GetProgressString()
 //------------------------------------------------------------------------------
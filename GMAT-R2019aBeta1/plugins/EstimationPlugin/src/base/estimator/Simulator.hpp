@@ -39,6 +39,7 @@
 #include "MeasurementManager.hpp"
 #include "PropSetup.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
+#include "SimulationPipeline.hpp"
 
 
 // todo: Make this a propagator parameter
@@ -79,6 +80,13 @@ public:
 
    virtual bool         IsParameterReadOnly(const Integer id) const;
 
+   virtual Integer      GetIntegerParameter(const Integer id) const;
+   virtual Integer      SetIntegerParameter(const Integer id,
+                                            const Integer value);
+   virtual Integer      GetIntegerParameter(const std::string &label) const;
+   virtual Integer      SetIntegerParameter(const std::string &label,
+                                            const Integer value);
+
    virtual Real         GetRealParameter(const Integer id) const;
    virtual Real         SetRealParameter(const Integer id,
                                          const Real value);
@@ -149,6 +157,7 @@ protected:
       FINAL_EPOCH,
       MEASUREMENT_TIME_STEP,
       ADD_NOISE,
+      OUTPUT_THREADS,
       SimulatorParamCount
    };
    /// Script strings associated with the parameters
@@ -225,6 +234,11 @@ protected:
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
 
+   /// Number of threads writing the data files; 0 writes them in line
+   Integer             outputThreads;
+   /// The output pipeline used when outputThreads > 0
+   SimulationPipeline  *pipeline;
+
    // State machine methods
    void                   CompleteInitialization();
    void                   FindTimeStep();
@@ -237,6 +251,7 @@ protected:
    GmatTime               ConvertToGmatTimeEpoch(const std::string &theEpoch,
                                                  const std::string &theFormat);
    void                   FindNextSimulationEpoch();
+   void                   SubmitToPipeline();
    // progress string for reporting
    virtual std::string    GetProgressString();
 
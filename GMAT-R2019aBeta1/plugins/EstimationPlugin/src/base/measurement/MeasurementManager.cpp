@@ -34,6 +34,7 @@
 #include "GmatConstants.hpp"
 #include "MessageInterface.hpp"
 #include "StringUtil.hpp"
+#include "RunProfiler.hpp"
 #include <sstream>            // To build DataStream for a TrackingFileSet
 
 #include "DataFileAdapter.hpp"
@@ -85,7 +86,8 @@ MeasurementManager::MeasurementManager() :
    largestId         (10000),
    eventCount        (0),
    inSimulationMode  (false),
-   transientForces   (NULL)
+   transientForces   (NULL),
+   stateVersion      (0)
 {
 }
 
@@ -118,7 +120,8 @@ MeasurementManager::MeasurementManager(const MeasurementManager &mm) :
    largestId         (mm.largestId),
    eventCount        (mm.eventCount),
    inSimulationMode  (mm.inSimulationMode),
-   transientForces   (NULL)
+   transientForces   (NULL),
+   stateVersion      (0)
 {
    modelNames = mm.modelNames;
 
@@ -194,6 +197,7 @@ MeasurementManager& MeasurementManager::operator=(const MeasurementManager &mm)
       modelNames       = mm.modelNames;
       eventCount       = mm.eventCount;
       inSimulationMode = mm.inSimulationMode;
+      ++stateVersion;
       transientForces  = NULL;
 
       // Clone the measurements, tracking systems, adapters, and tracking file sets
@@ -658,7 +662,9 @@ bool MeasurementManager::PrepareForProcessing(bool simulating)
    ///        piece is not yet part of the GMAT implementation, but when ready,
    ///        needs to be addressed here.
    // Pass the propagator to the tracking data adapters
+   ++stateVersion;
    for (UnsignedInt i = 0; i < adapters.size(); ++i) {
+      adapters[i]->ClearResultCache();
       adapters[i]->SetPropagator(thePropagator);
       if (adapters[i]->GetMeasurementModel() != NULL)
          adapters[i]->SetTransientForces(transientForces);
@@ -831,7 +837,8 @@ Integer MeasurementManager::Calculate(const Integer measurementToCalc,
          if (!observations.empty())
             od = &(*currentObs);
 
-         measurements[j] = adapters[j]->CalculateMeasurement(withEvents, od, rt);
+         measurements[j] = adapters[j]->CalculateCachedMeasurement(
+               stateVersion, withEvents, od, rt);
 
          if (measurements[j].isFeasible)
          {
@@ -870,7 +877,8 @@ Integer MeasurementManager::Calculate(const Integer measurementToCalc,
          #endif
          
          measurements[measurementToCalc] =
-            adapters[measurementToCalc]->CalculateMeasurement(withEvents, od, rt);
+            adapters[measurementToCalc]->CalculateCachedMeasurement(
+                  stateVersion, withEvents, od, rt);
          
          #ifdef DEBUG_CALCULATE
             MessageInterface::ShowMessage("****** measurements[%d] = <%p>,   "
@@ -2352,7 +2360,8 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
             else
                MessageInterface::ShowMessage(" Simulation: measurement adapter %s without events\n", adapters[i]->GetName().c_str());
          #endif
-         measurements[i] = adapters[i]->CalculateMeasurement(withEvents, od, rt, forSimulation);
+         measurements[i] = adapters[i]->CalculateCachedMeasurement(
+               stateVersion, withEvents, od, rt, forSimulation);
          if (measurements[i].unfeasibleReason == "R")
             throw MeasurementException(adapters[i]->GetErrorMessage());
 
@@ -2448,7 +2457,8 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
             std::vector<RampTableData>* rt = NULL;
             if (sr.size() > 0)
                rt = &(rampTables[sr[0]]);
-            measurements[j] = adapters[j]->CalculateMeasurement(withEvents, od, rt, forSimulation);
+            measurements[j] = adapters[j]->CalculateCachedMeasurement(
+                  stateVersion, withEvents, od, rt, forSimulation);
             
             if (measurements[j].isFeasible)
             {
@@ -2475,6 +2485,39 @@ bool MeasurementManager::CalculateMeasurements(bool forSimulation, bool withEven
 }
 
 
+//-----------------------------------------------------------------------------
+// void AdvanceStateVersion()
+//-----------------------------------------------------------------------------
+/**
+ * Marks the estimation state as changed
+ *
+ * The EstimationStateManager calls this method whenever it writes new values
+ * into the estimated objects.  Results cached in the tracking data adapters
+ * carry the version they were calculated with, so advancing the version
+ * retires all of them at once.
+ */
+//-----------------------------------------------------------------------------
+void MeasurementManager::AdvanceStateVersion()
+{
+   ++stateVersion;
+}
+
+
+//-----------------------------------------------------------------------------
+// UnsignedInt GetStateVersion() const
+//-----------------------------------------------------------------------------
+/**
+ * Retrieves the current estimation state version
+ *
+ * @return The version counter
+ */
+//-----------------------------------------------------------------------------
+UnsignedInt MeasurementManager::GetStateVersion() const
+{
+   return stateVersion;
+}
+
+
 //-----------------------------------------------------------------------------
 // bool MeasurementHasEvents()
 //-----------------------------------------------------------------------------
@@ -2569,7 +2612,9 @@ const std::vector<RealArray>& MeasurementManager::CalculateDerivatives(
             obj, wrt, forMeasurement);
    #endif
 
-   return adapters[forMeasurement]->CalculateMeasurementDerivatives(obj,wrt);
+   ProfileScope timer(RunProfiler::DERIVATIVES);
+   return adapters[forMeasurement]->CalculateCachedDerivatives(stateVersion,
+         obj, wrt);
 }
 
 
@@ -2625,6 +2670,32 @@ bool MeasurementManager::WriteMeasurements()
 }
 
 
+//------------------------------------------------------------------------------
+// DataFile* GetMeasurementStream(const Integer measurementIndex)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the data stream that receives a calculated measurement
+ *
+ * @param measurementIndex Index of the calculated measurement
+ *
+ * @return The stream, or NULL if the measurement has no stream assigned
+ */
+//------------------------------------------------------------------------------
+DataFile* MeasurementManager::GetMeasurementStream(const Integer measurementIndex)
+{
+   if ((measurementIndex < 0) ||
+       (measurementIndex >= (Integer)measurements.size()))
+      return NULL;
+
+   std::map<Integer,DataFile*>::iterator stream =
+         idToStreamMap.find(measurements[measurementIndex].uniqueID);
+   if (stream == idToStreamMap.end())
+      return NULL;
+
+   return stream->second;
+}
+
+
 //-----------------------------------------------------------------------------
 // const StringArray& GetStreamList()
 //-----------------------------------------------------------------------------
@@ -76,6 +76,8 @@ public:
    const std::vector<RealArray>&
                            CalculateDerivatives(GmatBase *obj, Integer wrt,
                                                 Integer forMeasurement);
+   void                    AdvanceStateVersion();
+   UnsignedInt             GetStateVersion() const;
    bool                    MeasurementHasEvents();
    ObjectArray&            GetActiveEvents();
    bool                    ProcessEvent(Event *locatedEvent);
@@ -100,6 +102,7 @@ public:
    const StringArray&      GetStreamList();
    void                    SetStreamObject(DataFile *newStream);
    bool                    WriteMeasurement(const Integer measurementToWrite);
+   DataFile*               GetMeasurementStream(const Integer measurementIndex);
 
 ///// TBD: Do we want something more generic here?
    const StringArray&      GetRampTableDataStreamList();
@@ -219,6 +222,8 @@ protected:
    Integer                          eventCount;
    /// Flag to indicate simulation mode
    bool                             inSimulationMode;
+   /// Version of the estimation state, used to key the adapter result caches
+   UnsignedInt                      stateVersion;
 
    Integer                          FindModelForObservation();
 
@@ -30,6 +30,7 @@
 #include "Receiver.hpp"
 #include "ODEModel.hpp"                              // made changes by TUAN NGUYEN
 #include "StringUtil.hpp"
+#include "RunProfiler.hpp"
 
 #include <sstream>                  // For stringstream
 
@@ -47,6 +48,13 @@
 //#define DEBUG_RELATIVITY_CORRECTION
 //#define DEBUG_RANGE_CALCULATION
 
+/// Profiler counters for this file
+static const Integer LIGHT_TIME_ITERATIONS =
+      RunProfiler::RegisterCounter("Light Time Iterations");
+static const Integer LIGHT_TIME_ITERATIONS_SAVED =
+      RunProfiler::RegisterCounter("Light Time Iterations Saved");
+
+
 
 
 //------------------------------------------------------------------------------
@@ -66,7 +74,9 @@ PhysicalSignal::PhysicalSignal(const std::string &typeStr,
    troposphere                (NULL),
    ionosphere                 (NULL),
    useRelativity              (false),
-   useETTAI                   (false)
+   useETTAI                   (false),
+   useLightTimeSeed           (false),
+   seedAtReceive              (true)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("PhysicalSignal:: default construction\n");
@@ -114,7 +124,9 @@ PhysicalSignal::PhysicalSignal(const PhysicalSignal& ps) :
    relCorrection              (ps.relCorrection),
    useETTAI                   (ps.useETTAI),
    troposphere                (NULL),
-   ionosphere                 (NULL)
+   ionosphere                 (NULL),
+   useLightTimeSeed           (ps.useLightTimeSeed),
+   seedAtReceive              (true)
 {
 #ifdef DEBUG_CONSTRUCTION
    MessageInterface::ShowMessage("PhysicalSignal:: copy construction\n");
@@ -147,6 +159,9 @@ PhysicalSignal& PhysicalSignal::operator=(const PhysicalSignal& ps)
 
       relCorrection             = ps.relCorrection;
       useETTAI                  = ps.useETTAI;
+
+      useLightTimeSeed          = ps.useLightTimeSeed;
+      ResetLightTimeSeed();
    }
 
    return *this;
@@ -1151,6 +1166,8 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
             "Transmitter fixed"));
    #endif
 
+   ProfileScope timer(RunProfiler::LIGHT_TIME);
+
    // It is equivalant to range tolerance = time tolerance * speed of light = (1.0e-12 s)x(299792458.0 m/s) = 0.0002998 m = 0.3 mm 
    Real timeTolerance = 1.0e-12;
 
@@ -1174,6 +1191,14 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
                "distance %.3lf km = %le\n", deltaR, deltaT);
       #endif
 
+      // Start from the light time extrapolated from the previous solutions
+      // on this leg when they are available; the geometric value is kept to
+      // count the iterations that the seed saved
+      Real geometricDeltaT = deltaT;
+      bool seeded = false;
+      if (useLightTimeSeed)
+         seeded = PredictLightTime(atEpoch, epochAtReceive, deltaT);
+
       // Here we go; iterating for a light time solution
       Integer loopCount = 0;
 
@@ -1230,6 +1255,31 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
          #endif
          ++loopCount;
       }
+
+      RunProfiler::Count(LIGHT_TIME_ITERATIONS, loopCount);
+
+      if (useLightTimeSeed)
+      {
+         if (seeded)
+         {
+            // The fixed point iteration contracts by the relative speed of
+            // the participants over the speed of light
+            Rvector3 relVel = (theData.rVel + theData.rOStateSSB.GetV()) -
+                  (theData.tVel + theData.tOStateSSB.GetV());
+            Real contraction = relVel.GetMagnitude() /
+                  (GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / 1000.0);
+            Integer saved = EstimateLightTimeIterations(
+                  GmatMathUtil::Abs(geometricDeltaT - deltaT), contraction,
+                  timeTolerance) - loopCount;
+            RunProfiler::Count(LIGHT_TIME_ITERATIONS_SAVED, saved);
+
+            #ifdef DEBUG_LIGHTTIME
+               MessageInterface::ShowMessage("   Seeded light time solve "
+                     "took %d iterations; %d saved\n", loopCount, saved);
+            #endif
+         }
+         RecordLightTime(atEpoch, epochAtReceive, deltaT);
+      }
    }
 
    // Temporary check on data flow
@@ -1242,6 +1292,157 @@ bool PhysicalSignal::GenerateLightTimeData(const GmatTime atEpoch,
 }
 
 
+//------------------------------------------------------------------------------
+// bool PredictLightTime(const GmatTime &atEpoch, bool epochAtReceive,
+//                       Real &lightTime) const
+//------------------------------------------------------------------------------
+/**
+ * Extrapolates the light time at an epoch from the previous solutions
+ *
+ * The light time changes slowly along a pass, so a quadratic through the last
+ * three converged solutions (linear with two) predicts it far more closely
+ * than the instantaneous range does.  The prediction is only made forward in
+ * time, across a gap of at most 600 seconds, and only if it agrees with the
+ * geometric light time to within 0.1%; otherwise the caller keeps the
+ * geometric starting value.
+ *
+ * @param atEpoch        The epoch of the fixed end of the signal
+ * @param epochAtReceive true if the receive end is fixed
+ * @param lightTime      On entry, the geometric light time (s); on a true
+ *                       return, the predicted light time
+ *
+ * @return true if a prediction was made
+ */
+//------------------------------------------------------------------------------
+bool PhysicalSignal::PredictLightTime(const GmatTime &atEpoch,
+      bool epochAtReceive, Real &lightTime) const
+{
+   if (seedEpochs.empty() || (seedAtReceive != epochAtReceive))
+      return false;
+
+   // Offsets of the stored solutions from the new epoch, in seconds
+   UnsignedInt count = seedEpochs.size();
+   Real dt[3];
+   for (UnsignedInt i = 0; i < count; ++i)
+      dt[i] = (seedEpochs[i] - atEpoch).GetTimeInSec();
+
+   if ((dt[count-1] >= 0.0) || (dt[count-1] < -600.0))
+      return false;
+
+   Real prediction = 0.0;
+   for (UnsignedInt i = 0; i < count; ++i)
+   {
+      // Lagrange basis polynomial evaluated at the new epoch (offset 0)
+      Real weight = 1.0;
+      for (UnsignedInt j = 0; j < count; ++j)
+         if (j != i)
+            weight *= dt[j] / (dt[j] - dt[i]);
+      prediction += weight * seedLightTimes[i];
+   }
+
+   if (GmatMathUtil::Abs(prediction - lightTime) >
+         1.0e-3 * GmatMathUtil::Abs(lightTime))
+      return false;
+
+   lightTime = prediction;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RecordLightTime(const GmatTime &atEpoch, bool epochAtReceive,
+//                      Real lightTime)
+//------------------------------------------------------------------------------
+/**
+ * Saves a converged light time for use in later predictions
+ *
+ * Up to three solutions are kept.  A repeated solve at the latest epoch
+ * replaces its value.  The history restarts when the fixed end of the signal
+ * changes or time moves backwards, as it does at the start of each estimator
+ * iteration.
+ *
+ * @param atEpoch        The epoch of the fixed end of the signal
+ * @param epochAtReceive true if the receive end is fixed
+ * @param lightTime      The converged light time (s)
+ */
+//------------------------------------------------------------------------------
+void PhysicalSignal::RecordLightTime(const GmatTime &atEpoch,
+      bool epochAtReceive, Real lightTime)
+{
+   if (!seedEpochs.empty())
+   {
+      Real dt = (atEpoch - seedEpochs.back()).GetTimeInSec();
+      if ((seedAtReceive == epochAtReceive) && (dt == 0.0))
+      {
+         // Same epoch solved again; keep the latest value
+         seedLightTimes.back() = lightTime;
+         return;
+      }
+
+      if ((seedAtReceive != epochAtReceive) || (dt < 0.0))
+      {
+         seedEpochs.clear();
+         seedLightTimes.clear();
+      }
+   }
+
+   if (seedEpochs.size() == 3)
+   {
+      seedEpochs.erase(seedEpochs.begin());
+      seedLightTimes.erase(seedLightTimes.begin());
+   }
+
+   seedAtReceive = epochAtReceive;
+   seedEpochs.push_back(atEpoch);
+   seedLightTimes.push_back(lightTime);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer EstimateLightTimeIterations(Real initialError, Real contraction,
+//                                     Real tolerance) const
+//------------------------------------------------------------------------------
+/**
+ * Estimates the iteration count of the light time loop for a starting error
+ *
+ * Each pass through the loop reduces the error by the contraction factor,
+ * and the loop ends on the pass after the error drops below the tolerance.
+ *
+ * @param initialError Error in the starting light time (s)
+ * @param contraction  Error reduction factor per iteration
+ * @param tolerance    Convergence tolerance (s)
+ *
+ * @return The estimated iteration count, capped at the loop limit of 10
+ */
+//------------------------------------------------------------------------------
+Integer PhysicalSignal::EstimateLightTimeIterations(Real initialError,
+      Real contraction, Real tolerance) const
+{
+   Integer count = 1;
+   Real error = initialError;
+   while ((error > tolerance) && (count < 10))
+   {
+      error *= contraction;
+      ++count;
+   }
+   return count;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetLightTimeSeed()
+//------------------------------------------------------------------------------
+/**
+ * Discards the stored light time solutions
+ */
+//------------------------------------------------------------------------------
+void PhysicalSignal::ResetLightTimeSeed()
+{
+   seedEpochs.clear();
+   seedLightTimes.clear();
+}
+
+
 bool PhysicalSignal::HardwareDelayCalculation()
 {
    bool retval = false;
@@ -1820,7 +2021,7 @@ bool PhysicalSignal::MediaCorrectionCalculation(std::vector<RampTableData>* ramp
  *                          measurement
  * @param correctionType    The name of correction type such as: 
  *                          //TroposphereModel, IonosphereModel, 
- *                          ET-TAI, or Relativity
+ *                          ET-TAI, Relativity, or LightTimeSeed
  */
 //----------------------------------------------------------------------
 void PhysicalSignal::AddCorrection(const std::string& modelName, 
@@ -1873,6 +2074,13 @@ void PhysicalSignal::AddCorrection(const std::string& modelName,
       }
       useETTAI = true;
    }
+   else if (correctionType == "LightTimeSeed")
+   {
+      // Turn on or off the seeding of light time solves from the previous
+      // solutions on this leg
+      useLightTimeSeed = (modelName == "On");
+      ResetLightTimeSeed();
+   }
 
    // Add correction model to the next SignalBase in this signal path
    if (next)
@@ -2078,6 +2286,8 @@ RealArray PhysicalSignal::MediaCorrection(Real freq, Rvector3 r1B, Rvector3 r2B,
    #ifdef DEBUG_MEASUREMENT_CORRECTION
       MessageInterface::ShowMessage("start PhysicalMeasurement::MediaCorrection()\n");
    #endif
+   ProfileScope timer(RunProfiler::MEDIA_CORRECTION);
+
    Real epsilon = 1.0e-8;
 
    RealArray tropoCorrection;                // units: (m, rad, s)
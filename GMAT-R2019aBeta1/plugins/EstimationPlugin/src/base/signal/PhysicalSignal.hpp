@@ -87,7 +87,24 @@ protected:
    /// Flag indicating to use Et-TAI correction
    bool useETTAI;
 
+   /// Flag indicating that light time solves start from the neighbor solutions
+   bool useLightTimeSeed;
+   /// Epochs of the most recent converged light time solutions, oldest first
+   std::vector<GmatTime> seedEpochs;
+   /// Converged light times (s) at the seedEpochs
+   RealArray      seedLightTimes;
+   /// Fixed end of the signal used for the seed solutions
+   bool           seedAtReceive;
+
    bool GenerateLightTimeData(const GmatTime atEpoch, bool epochAtReceive);
+   bool           PredictLightTime(const GmatTime &atEpoch, bool epochAtReceive,
+                                   Real &lightTime) const;
+   void           RecordLightTime(const GmatTime &atEpoch, bool epochAtReceive,
+                                  Real lightTime);
+   void           ResetLightTimeSeed();
+   Integer        EstimateLightTimeIterations(Real initialError,
+                                              Real contraction,
+                                              Real tolerance) const;
 
    /// This function is used to compute relativity correction
    Real           RelativityCorrection(Rvector3 r1B, Rvector3 r2B, Real t1, Real t2);
@@ -75,6 +75,7 @@ const std::string TrackingFileSet::PARAMETER_TEXT[
    "SimTDRSSmarId",                 // TDSR_SMAR_ID
    "SimTDRSDataFlag",               // TDRS_DATA_FLAG
    "DataFilters",                   // DATA_FILTERS
+   "UseLightTimeSeed",              // USE_LIGHTTIME_SEED
 };
 
 /// Types of the BatchEstimator parameters
@@ -96,6 +97,7 @@ const Gmat::ParameterType TrackingFileSet::PARAMETER_TYPE[
    Gmat::INTEGER_TYPE,              // TDRS_SMAR_ID
    Gmat::INTEGER_TYPE,              // TDRS_DATA_FLAG
    Gmat::OBJECTARRAY_TYPE,          // DATA_FILLTERS
+   Gmat::BOOLEAN_TYPE,              // USE_LIGHTTIME_SEED
 };
 
 
@@ -111,6 +113,7 @@ const Gmat::ParameterType TrackingFileSet::PARAMETER_TYPE[
 TrackingFileSet::TrackingFileSet(const std::string &name) :
    MeasurementModelBase      (name, "TrackingFileSet"),
    useLighttime              (true),
+   useLightTimeSeed          (false),
    solarsystem               (NULL),
    thePropagator             (NULL),
    useRelativityCorrection   (false),
@@ -184,6 +187,7 @@ TrackingFileSet::TrackingFileSet(const TrackingFileSet& tfs) :
    filenames                 (tfs.filenames),
    rampedTablenames          (tfs.rampedTablenames),
    useLighttime              (tfs.useLighttime),
+   useLightTimeSeed          (tfs.useLightTimeSeed),
    solarsystem               (tfs.solarsystem),
    thePropagator             (tfs.thePropagator),
    references                (tfs.references),
@@ -256,6 +260,7 @@ TrackingFileSet& TrackingFileSet::operator=(const TrackingFileSet& tfs)
       filenames               = tfs.filenames;
       rampedTablenames        = tfs.rampedTablenames;
       useLighttime            = tfs.useLighttime;
+      useLightTimeSeed        = tfs.useLightTimeSeed;
       solarsystem             = tfs.solarsystem;
       thePropagator           = tfs.thePropagator;
       references              = tfs.references;
@@ -1564,6 +1569,9 @@ bool TrackingFileSet::GetBooleanParameter(const Integer id) const
    if (id == USELIGHTTIME)
       return useLighttime;
 
+   if (id == USE_LIGHTTIME_SEED)
+      return useLightTimeSeed;
+
    return MeasurementModelBase::GetBooleanParameter(id);
 }
 
@@ -1600,6 +1608,12 @@ bool TrackingFileSet::SetBooleanParameter(const Integer id, const bool value)
       return useLighttime;
    }
 
+   if (id == USE_LIGHTTIME_SEED)
+   {
+      useLightTimeSeed = value;
+      return useLightTimeSeed;
+   }
+
    return MeasurementModelBase::SetBooleanParameter(id, value);
 }
 
@@ -2308,6 +2322,8 @@ bool TrackingFileSet::Initialize()
             measurements[i]->SetCorrection("Moyer","Relativity");
          if (useETminusTAICorrection)
             measurements[i]->SetCorrection("Moyer","ET-TAI");
+         measurements[i]->SetCorrection(useLightTimeSeed ? "On" : "Off",
+               "LightTimeSeed");
          measurements[i]->SetCorrection("Aberration", "Aberration-" + aberrationCorrection);
 
          // Set ramped frequency tables to TrackingDataAdapter
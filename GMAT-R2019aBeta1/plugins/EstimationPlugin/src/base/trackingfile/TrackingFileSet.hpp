@@ -185,6 +185,8 @@ protected:
    StringArray rampedTablenames;
    /// Flag for the inclusion of light time solution
    bool        useLighttime;
+   /// Flag for starting light time solutions from the previous solutions
+   bool        useLightTimeSeed;
 
    /// Flag for the inclusion of relativity correction
    bool        useRelativityCorrection;
@@ -241,6 +243,7 @@ protected:
       TDRS_SMAR_ID,
       TDRS_DATA_FLAG,
       DATA_FILTERS,
+      USE_LIGHTTIME_SEED,
       TrackingFileSetParamCount,
    };
 
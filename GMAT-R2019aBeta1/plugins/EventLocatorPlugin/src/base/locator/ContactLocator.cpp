@@ -43,6 +43,7 @@
 #include "EphemManager.hpp"
 #include "StringUtil.hpp"
 #include "ContactEvent.hpp"
+#include "RunProfiler.hpp"
 
 //#define DEBUG_SET
 //#define DEBUG_SETREF
@@ -50,6 +51,7 @@
 //#define DEBUG_CONTACT_EVENTS
 //#define DEBUG_INIT_FINALIZE
 //#define DEBUG_CONTACTLOCATOR_INIT
+//#define DEBUG_CONTACT_SEARCH_TIME
 
 //------------------------------------------------------------------------------
 // Static data
@@ -59,6 +61,7 @@ const std::string ContactLocator::PARAMETER_TEXT[
 {
    "Observers",               // STATIONS
    "LightTimeDirection",
+   "SearchThreads",
 };
 
 const Gmat::ParameterType ContactLocator::PARAMETER_TYPE[
@@ -66,6 +69,7 @@ const Gmat::ParameterType ContactLocator::PARAMETER_TYPE[
 {
    Gmat::OBJECTARRAY_TYPE,    // STATIONS
    Gmat::ENUMERATION_TYPE,
+   Gmat::INTEGER_TYPE,        // SEARCH_THREADS
 };
 
 const std::string ContactLocator::LT_DIRECTIONS[2] =
@@ -88,7 +92,8 @@ const std::string ContactLocator::LT_DIRECTIONS[2] =
 //------------------------------------------------------------------------------
 ContactLocator::ContactLocator(const std::string &name) :
    EventLocator         ("ContactLocator", name),
-   lightTimeDirection   ("Transmit")
+   lightTimeDirection   ("Transmit"),
+   searchThreads        (0)
 {
    objectTypeNames.push_back("ContactLocator");
    parameterCount = ContactLocatorParamCount;
@@ -137,7 +142,8 @@ ContactLocator::~ContactLocator()
 ContactLocator::ContactLocator(const ContactLocator &cl) :
    EventLocator         (cl),
    stationNames         (cl.stationNames),
-   lightTimeDirection   (cl.lightTimeDirection)
+   lightTimeDirection   (cl.lightTimeDirection),
+   searchThreads        (cl.searchThreads)
 {
    // Observers
    stationNames.clear();
@@ -183,6 +189,7 @@ ContactLocator& ContactLocator::operator=(const ContactLocator &c)
 
 //      stationNames       = c.stationNames;
       lightTimeDirection = c.lightTimeDirection;
+      searchThreads      = c.searchThreads;
 
       // Observers
       stationNames.clear();
@@ -330,6 +337,95 @@ std::string ContactLocator::GetParameterTypeString(const Integer id) const
 }
 
 
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const Integer id) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves an integer parameter
+ *
+ * @param id The parameter's id
+ *
+ * @return The parameter value
+ */
+//------------------------------------------------------------------------------
+Integer ContactLocator::GetIntegerParameter(const Integer id) const
+{
+   if (id == SEARCH_THREADS)
+      return searchThreads;
+
+   return EventLocator::GetIntegerParameter(id);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const Integer id, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Sets an integer parameter
+ *
+ * @param id    The parameter's id
+ * @param value The new value
+ *
+ * @return The parameter value
+ */
+//------------------------------------------------------------------------------
+Integer ContactLocator::SetIntegerParameter(const Integer id,
+                                            const Integer value)
+{
+   if (id == SEARCH_THREADS)
+   {
+      if (value < 0)
+      {
+         EventException ee("");
+         ee.SetDetails(errorMessageFormat.c_str(),
+               GmatStringUtil::ToString(value, 1).c_str(),
+               "SearchThreads", "Integer number >= 0");
+         throw ee;
+      }
+      searchThreads = value;
+      return searchThreads;
+   }
+
+   return EventLocator::SetIntegerParameter(id, value);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetIntegerParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves an integer parameter
+ *
+ * @param label The parameter's script label
+ *
+ * @return The parameter value
+ */
+//------------------------------------------------------------------------------
+Integer ContactLocator::GetIntegerParameter(const std::string &label) const
+{
+   return GetIntegerParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer SetIntegerParameter(const std::string &label, const Integer value)
+//------------------------------------------------------------------------------
+/**
+ * Sets an integer parameter
+ *
+ * @param label The parameter's script label
+ * @param value The new value
+ *
+ * @return The parameter value
+ */
+//------------------------------------------------------------------------------
+Integer ContactLocator::SetIntegerParameter(const std::string &label,
+                                            const Integer value)
+{
+   return SetIntegerParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 // std::string GetStringParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1142,28 +1238,22 @@ void ContactLocator::FindEvents()
    #endif
 
    Integer        numContacts = 0;
-   RealArray      starts;
-   RealArray      ends;
 
    // Need to set findStart and findStop somewhere in here!!!!
 
    // Clear old events
    TakeAction("Clear", "Events");
-   // @YRL
+   #ifdef DEBUG_CONTACT_SEARCH_TIME
+      Real locateStart = RunProfiler::GetWallTime();
+   #endif
+
+   // Collect the search settings for each station
+   RealArray                minElevations;
+   std::vector<StringArray> stationBodies;
    for (Integer j = 0; j < stations.size(); j++ )
    {
-      // We want a ContactResult for each station whether or not there are events
-      ContactResult *evList = new ContactResult();
-      evList->SetObserverName(stations.at(j)->GetName());
-
-      starts.clear();
-      ends.clear();
-      Integer obsNaifId = stations.at(j)->GetIntegerParameter(
-                          stations.at(j)->GetParameterID("NAIFId"));
-      theObsrvr = GmatStringUtil::ToString(obsNaifId);
-      std::string obsFrame = stations.at(j)->GetStringParameter("SpiceFrameId");
-
-      Real  minElAngle  = stations.at(j)->GetRealParameter("MinimumElevationAngle");
+      minElevations.push_back(
+            stations.at(j)->GetRealParameter("MinimumElevationAngle"));
 
       // The ground station's central body should not be an occulting body
       StringArray bodiesToUse;
@@ -1190,47 +1280,83 @@ void ContactLocator::FindEvents()
             bodiesToUse.push_back(currentBody);
          }
       }
+      stationBodies.push_back(bodiesToUse);
+   }
 
+   // Search all of the stations together on the in-memory trajectory if we
+   // can; the searches run in parallel over the shared trajectory
+   std::vector<RealArray> allStarts, allEnds;
+   bool searched = em->GetContactIntervals(stations, minElevations,
+         stationBodies, theAbCorr, initialEp, finalEp, useEntireInterval,
+         stepSize, searchThreads, allStarts, allEnds);
 
+   // Otherwise search one station at a time
+   if (!searched)
+   {
+      allStarts.assign(stations.size(), RealArray());
+      allEnds.assign(stations.size(), RealArray());
+      // @YRL
+      for (UnsignedInt j = 0; j < stations.size(); j++ )
+      {
+         Integer obsNaifId = stations.at(j)->GetIntegerParameter(
+                             stations.at(j)->GetParameterID("NAIFId"));
+         theObsrvr = GmatStringUtil::ToString(obsNaifId);
+         std::string obsFrame = stations.at(j)->GetStringParameter("SpiceFrameId");
+
+         #ifdef DEBUG_CONTACT_EVENTS
+            MessageInterface::ShowMessage("Calling GetContactIntervals with: \n");
+            MessageInterface::ShowMessage("   theObsrvr         = %s(%s)\n",
+                  (stations.at(j))->GetName().c_str(), theObsrvr.c_str());
+            MessageInterface::ShowMessage("   occultingBodies   = \n");
+             for (Integer ii = 0; ii < occultingBodyNames.size(); ii++)
+                MessageInterface::ShowMessage("      %d     %s\n", ii, occultingBodyNames.at(ii).c_str());
+             MessageInterface::ShowMessage("   bodiesToUse   = \n");
+              for (Integer ii = 0; ii < stationBodies[j].size(); ii++)
+                 MessageInterface::ShowMessage("      %d     %s\n", ii, stationBodies[j].at(ii).c_str());
+            MessageInterface::ShowMessage("   theAbCorr         = %s\n", theAbCorr.c_str());
+            MessageInterface::ShowMessage("   initialEp         = %12.10f\n", initialEp);
+            MessageInterface::ShowMessage("   finalEp           = %12.10f\n", finalEp);
+            MessageInterface::ShowMessage("   useEntireInterval = %s\n", (useEntireInterval? "true" : "false"));
+            MessageInterface::ShowMessage("   stepSize          = %12.10f\n", stepSize);
+         #endif
+         bool transmit = (GmatStringUtil::ToUpper(lightTimeDirection) == "TRANSMIT");
+         em -> GetContactIntervals(theObsrvr, minElevations[j], obsFrame,
+               stationBodies[j], theAbCorr, initialEp, finalEp,
+               useEntireInterval, useLightTimeDelay, transmit, stepSize,
+               numContacts, allStarts[j], allEnds[j], stations.at(j));
+      }
+   }
+
+   // One result for each station whether or not there are events, in the
+   // order of the observer list
+   for (UnsignedInt j = 0; j < stations.size(); j++ )
+   {
+      ContactResult *evList = new ContactResult();
+      evList->SetObserverName(stations.at(j)->GetName());
+
+      numContacts = (Integer) allStarts[j].size();
       #ifdef DEBUG_CONTACT_EVENTS
-         MessageInterface::ShowMessage("Calling GetContactIntervals with: \n");
-         MessageInterface::ShowMessage("   theObsrvr         = %s(%s)\n",
-               (stations.at(j))->GetName().c_str(), theObsrvr.c_str());
-         MessageInterface::ShowMessage("   occultingBodies   = \n");
-          for (Integer ii = 0; ii < occultingBodyNames.size(); ii++)
-             MessageInterface::ShowMessage("      %d     %s\n", ii, occultingBodyNames.at(ii).c_str());
-          MessageInterface::ShowMessage("   bodiesToUse   = \n");
-           for (Integer ii = 0; ii < bodiesToUse.size(); ii++)
-              MessageInterface::ShowMessage("      %d     %s\n", ii, bodiesToUse.at(ii).c_str());
-         MessageInterface::ShowMessage("   theAbCorr         = %s\n", theAbCorr.c_str());
-         MessageInterface::ShowMessage("   initialEp         = %12.10f\n", initialEp);
-         MessageInterface::ShowMessage("   finalEp           = %12.10f\n", finalEp);
-         MessageInterface::ShowMessage("   useEntireInterval = %s\n", (useEntireInterval? "true" : "false"));
-         MessageInterface::ShowMessage("   stepSize          = %12.10f\n", stepSize);
-      #endif
-      bool transmit = (GmatStringUtil::ToUpper(lightTimeDirection) == "TRANSMIT");
-      em -> GetContactIntervals(theObsrvr, minElAngle, obsFrame, bodiesToUse, theAbCorr,
-            initialEp, finalEp, useEntireInterval, useLightTimeDelay, transmit, stepSize, numContacts,
-            starts, ends);
-      #ifdef DEBUG_CONTACT_EVENTS
-         MessageInterface::ShowMessage("After GetContactIntervals: \n");
+         MessageInterface::ShowMessage("After GetContactIntervals for %s: \n",
+               stations.at(j)->GetName().c_str());
          MessageInterface::ShowMessage("   numContacts       = %d\n", numContacts);
       #endif
-      if (numContacts > 0)
+      // Insert the events into the array
+      for (Integer kk = 0; kk < numContacts; kk++ )
       {
-         // Insert the events into the array
-         for (Integer kk = 0; kk < numContacts; kk++ )
-         {
-            Real s1 = starts.at(kk);
-            Real e1 = ends.at(kk);
-            ContactEvent *newEvent = new ContactEvent(s1, e1);
-            evList->AddEvent(newEvent);
-         }
+         Real s1 = allStarts[j].at(kk);
+         Real e1 = allEnds[j].at(kk);
+         ContactEvent *newEvent = new ContactEvent(s1, e1);
+         evList->AddEvent(newEvent);
       }
-      // One result array for each station whether or not there are events
       contactResults.push_back(evList);
    }
 
+   #ifdef DEBUG_CONTACT_SEARCH_TIME
+      MessageInterface::ShowMessage("%s located contacts for %d observer(s) "
+            "in %.3f s\n", instanceName.c_str(), (Integer) stations.size(),
+            RunProfiler::GetWallTime() - locateStart);
+   #endif
+
    #ifdef DEBUG_CONTACT_EVENTS
       MessageInterface::ShowMessage("ContactLocator::FindEvents leaving ... \n");
    #endif
@@ -70,6 +70,13 @@ public:
                         GetParameterType(const Integer id) const;
    virtual std::string  GetParameterTypeString(const Integer id) const;
 
+   virtual Integer      GetIntegerParameter(const Integer id) const;
+   virtual Integer      SetIntegerParameter(const Integer id,
+                                            const Integer value);
+   virtual Integer      GetIntegerParameter(const std::string &label) const;
+   virtual Integer      SetIntegerParameter(const std::string &label,
+                                            const Integer value);
+
    virtual std::string  GetStringParameter(const Integer id) const;
    virtual bool         SetStringParameter(const Integer id,
                                            const std::string &value);
@@ -141,6 +148,8 @@ protected:
    ObjectArray stations;
    /// Light time Direction
    std::string lightTimeDirection;
+   /// Number of threads for the station searches; 0 uses one per processor
+   Integer     searchThreads;
 
    // The stored results
    std::vector<ContactResult*> contactResults;
@@ -151,6 +160,7 @@ protected:
     {
        STATIONS = EventLocatorParamCount,
        LIGHT_TIME_DIRECTION,
+       SEARCH_THREADS,
        ContactLocatorParamCount
     };
 
@@ -19,6 +19,9 @@
 //------------------------------------------------------------------------------
 
 #include "ThfDataSegment.hpp"
+#include "NotAKnotInterpolator.hpp"
+#include "MessageInterface.hpp"
+#include <algorithm>
 
 
 
@@ -48,7 +51,9 @@ ThfDataSegment::ThfDataSegment() :
    isDataLoaded                  (false),
    thrustScaleFactor             (1.0),
    massFlowScaleFactor           (1.0),
-   includeThrustFactorInMassFlow (false)
+   includeThrustFactorInMassFlow (false),
+   interpolationReady            (false),
+   cursor                        (0)
 {
 }
 
@@ -92,7 +97,10 @@ ThfDataSegment::ThfDataSegment(const ThfDataSegment& ds) :
    thrustScaleFactor             (ds.thrustScaleFactor),
    massFlowScaleFactor           (ds.massFlowScaleFactor),
    includeThrustFactorInMassFlow (ds.includeThrustFactorInMassFlow),
-   tanks                         (ds.tanks)
+   tanks                         (ds.tanks),
+   coefficients                  (ds.coefficients),
+   interpolationReady            (ds.interpolationReady),
+   cursor                        (ds.cursor)
 {
    for (UnsignedInt i = 0; i < ds.profile.size(); ++i)
    {
@@ -137,6 +145,9 @@ ThfDataSegment& ThfDataSegment::operator =(const ThfDataSegment& ds)
       includeThrustFactorInMassFlow
                                   =  ds.includeThrustFactorInMassFlow;
       tanks                       =  ds.tanks;
+      coefficients                =  ds.coefficients;
+      interpolationReady          =  ds.interpolationReady;
+      cursor                      =  ds.cursor;
 
       profile.clear();
       for (UnsignedInt i = 0; i < ds.profile.size(); ++i)
@@ -185,6 +196,243 @@ bool ThfDataSegment::HasPrecisionTime()
    return hasPrecisionTime;
 }
 
+//------------------------------------------------------------------------------
+// bool PrepareInterpolation()
+//------------------------------------------------------------------------------
+/**
+ * Builds the interpolating polynomials for every interval of the profile
+ *
+ * Each interval between consecutive profile nodes receives a cubic in the
+ * time from the interval's first node for each of the 3 vector components and
+ * for the mass flow, so that a lookup costs one polynomial evaluation per
+ * channel.  Stair stepped data uses only the constant term and linear data
+ * the constant and linear terms.  Spline data uses the piece of the not a knot
+ * spline through the 5 nodes that the interval has always been interpolated
+ * from: the interval is the second of the 5 where the profile allows it.
+ *
+ * Splines need at least 5 nodes; shorter segments, and intervals whose 5 nodes
+ * contain repeated times, use linear interpolation.
+ *
+ * @return true if the coefficients were built, false if the profile has too
+ *         few nodes to interpolate
+ */
+//------------------------------------------------------------------------------
+bool ThfDataSegment::PrepareInterpolation()
+{
+   coefficients.clear();
+   interpolationReady = false;
+   cursor = 0;
+
+   Integer intervals = (Integer)profile.size() - 1;
+   if (intervals < 1)
+      return false;
+
+   coefficients.assign(16 * intervals, 0.0);
+
+   bool useSpline = ((accelIntType == SPLINE) || (massIntType == SPLINE));
+   if (useSpline && (profile.size() < 5))
+   {
+      MessageInterface::ShowMessage("Cannot perform spline interpolation: "
+            "the thrust history data segment %s contains %d points, but "
+            "spline interpolation requires at least 5.  Linear interpolation "
+            "will be applied instead.\n", segmentName.c_str(),
+            (Integer)profile.size());
+      useSpline = false;
+   }
+
+   InterpolationType accelType = accelIntType, massType = massIntType;
+   if (!useSpline)
+   {
+      if (accelType == SPLINE)
+         accelType = LINEAR;
+      if (massType == SPLINE)
+         massType = LINEAR;
+   }
+
+   for (Integer i = 0; i < intervals; ++i)
+   {
+      for (Integer j = 0; j < 3; ++j)
+         SetPolynomial(i, j, (accelType == SPLINE ? LINEAR : accelType));
+      SetPolynomial(i, 3, (massType == SPLINE ? LINEAR : massType));
+   }
+
+   if (useSpline)
+   {
+      NotAKnotInterpolator spliner("SplineInterpolator", 4);
+      Real data[4], splineCoeffs[16];
+      Integer windowStart = -1, start;
+      bool built = false;
+
+      for (Integer i = 0; i < intervals; ++i)
+      {
+         // The 5 point window starts one node before the interval, clamped to
+         // the ends of the profile
+         start = std::max(1, std::min(i, intervals - 3)) - 1;
+         if (start != windowStart)
+         {
+            windowStart = start;
+            spliner.Clear();
+            for (Integer k = start; k < start + 5; ++k)
+            {
+               data[0] = profile[k].vector[0];
+               data[1] = profile[k].vector[1];
+               data[2] = profile[k].vector[2];
+               data[3] = profile[k].mdot;
+               spliner.AddPoint(profile[k].time, data);
+            }
+         }
+
+         // Zero length intervals are never looked up, and windows with
+         // repeated times cannot be splined; both keep the linear terms
+         if (profile[i+1].time <= profile[i].time)
+            continue;
+         built = spliner.GetCoefficients(i - start, splineCoeffs);
+         if (!built)
+            continue;
+
+         Real *coeffs = &coefficients[16 * i];
+         for (Integer j = 0; j < 4; ++j)
+         {
+            if (((j < 3) && (accelType == SPLINE)) ||
+                ((j == 3) && (massType == SPLINE)))
+            {
+               for (Integer k = 0; k < 4; ++k)
+                  coeffs[4*j + k] = splineCoeffs[4*j + k];
+            }
+         }
+      }
+   }
+
+   interpolationReady = true;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool Interpolate(const Real offset, const bool atEnd, Real values[4])
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the thrust (or acceleration) vector and mass flow in the profile
+ *
+ * @param offset Time from the segment start epoch, in days
+ * @param atEnd  Flag indicating that the requested epoch is the segment's end
+ *               epoch, where the data of the last node is used
+ * @param values The container receiving the vector components and mass flow
+ *
+ * @return true if the offset lies in the profile, false if not, in which case
+ *         the values are all zero
+ */
+//------------------------------------------------------------------------------
+bool ThfDataSegment::Interpolate(const Real offset, const bool atEnd,
+      Real values[4])
+{
+   values[0] = values[1] = values[2] = values[3] = 0.0;
+
+   if (profile.empty())
+      return false;
+
+   if (atEnd)
+   {
+      const ThrustPoint &last = profile.back();
+      values[0] = last.vector[0];
+      values[1] = last.vector[1];
+      values[2] = last.vector[2];
+      values[3] = last.mdot;
+      return true;
+   }
+
+   if (!interpolationReady)
+      if (!PrepareInterpolation())
+         return false;
+
+   Integer i = FindInterval(offset);
+   if (i < 0)
+      return false;
+
+   Real dx = offset - profile[i].time;
+   const Real *coeffs = &coefficients[16 * i];
+   for (Integer j = 0; j < 4; ++j, coeffs += 4)
+      values[j] = ((coeffs[0] * dx + coeffs[1]) * dx + coeffs[2]) * dx +
+                  coeffs[3];
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Integer FindInterval(const Real offset)
+//------------------------------------------------------------------------------
+/**
+ * Locates the profile interval, [time[i], time[i+1]), containing an offset
+ *
+ * Propagation requests data at slowly advancing epochs, so the interval found
+ * on the previous call and the one following it are checked before falling
+ * back to a binary search.
+ *
+ * @param offset Time from the segment start epoch, in days
+ *
+ * @return The index of the interval's first node, or -1 if no interval
+ *         contains the offset
+ */
+//------------------------------------------------------------------------------
+Integer ThfDataSegment::FindInterval(const Real offset)
+{
+   Integer last = (Integer)profile.size() - 1;
+
+   if ((cursor >= 0) && (cursor < last))
+   {
+      if ((profile[cursor].time <= offset) && (offset < profile[cursor+1].time))
+         return cursor;
+      if ((cursor + 1 < last) && (profile[cursor+1].time <= offset) &&
+          (offset < profile[cursor+2].time))
+         return ++cursor;
+   }
+
+   if ((last < 1) || (offset < profile[0].time) ||
+       (offset >= profile[last].time))
+      return -1;
+
+   // First node later than the offset; the interval starts one node before it
+   Integer low = 0, high = last, mid;
+   while (high - low > 1)
+   {
+      mid = (low + high) / 2;
+      if (profile[mid].time <= offset)
+         low = mid;
+      else
+         high = mid;
+   }
+
+   cursor = low;
+   return cursor;
+}
+
+//------------------------------------------------------------------------------
+// void SetPolynomial(const Integer interval, const Integer channel,
+//       const InterpolationType type)
+//------------------------------------------------------------------------------
+/**
+ * Sets stair step or linear coefficients for one channel of an interval
+ *
+ * @param interval Index of the interval's first node
+ * @param channel  0 - 2 for the vector components, 3 for the mass flow
+ * @param type     The interpolation type; NONE or LINEAR
+ */
+//------------------------------------------------------------------------------
+void ThfDataSegment::SetPolynomial(const Integer interval,
+      const Integer channel, const InterpolationType type)
+{
+   const ThrustPoint &p0 = profile[interval];
+   const ThrustPoint &p1 = profile[interval+1];
+
+   Real y0 = (channel < 3 ? p0.vector[channel] : p0.mdot);
+   Real y1 = (channel < 3 ? p1.vector[channel] : p1.mdot);
+   Real h  = p1.time - p0.time;
+
+   Real *coeffs = &coefficients[16 * interval + 4 * channel];
+   coeffs[0] = coeffs[1] = 0.0;
+   coeffs[2] = ((type == LINEAR) && (h != 0.0) ? (y1 - y0) / h : 0.0);
+   coeffs[3] = y0;
+}
+
 // Convenience methods for the thrust profile data structure
 
 //------------------------------------------------------------------------------
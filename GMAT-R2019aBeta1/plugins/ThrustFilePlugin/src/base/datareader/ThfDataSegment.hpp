@@ -44,6 +44,9 @@ public:
    bool SetPrecisionTimeFlag(bool onOff = true);
    bool HasPrecisionTime();
 
+   bool PrepareInterpolation();
+   bool Interpolate(const Real offset, const bool atEnd, Real values[4]);
+
    /// Structure for the thrust profile data points
    struct ThrustPoint
    {
@@ -121,6 +124,22 @@ public:
    bool includeThrustFactorInMassFlow;
    /// List of tanks that are used for mass flow
    StringArray tanks;
+
+   //-------------------------------------------------
+   // Interpolation data, built from the profile
+   //-------------------------------------------------
+   /// Polynomial coefficients for each profile interval: 4 per channel, for
+   /// the 3 vector components and the mass flow, cubic term first
+   std::vector<Real> coefficients;
+   /// Flag indicating that the coefficients match the profile
+   bool interpolationReady;
+   /// Index of the profile interval used on the most recent lookup
+   Integer cursor;
+
+protected:
+   Integer FindInterval(const Real offset);
+   void SetPolynomial(const Integer interval, const Integer channel,
+                      const InterpolationType type);
 };
 
 #endif /* ThfDataSegment_hpp */
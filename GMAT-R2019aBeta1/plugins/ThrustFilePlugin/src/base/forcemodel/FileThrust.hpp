@@ -23,8 +23,6 @@
 #include "ThrustFileDefs.hpp"
 #include "PhysicalModel.hpp"
 #include "ThrustSegment.hpp"
-#include "LinearInterpolator.hpp"
-#include "NotAKnotInterpolator.hpp"
 
 /**
  * Physical model used to apply derivative data from a thrust history file
@@ -142,19 +140,6 @@ protected:
 
    /// 5 raw data elements: 3 thrust/accel components, mdot, interpolation method
    Real                          dataBlock[7];
-   /// dataSet is (up to) 5 dataBlock sets, with the last element set to time
-   Real                          dataSet[5][5];
-
-   /// Linear interpolator object (currently not used
-   LinearInterpolator            *liner;
-   /// Not a knot interpolator, used for spline interpolation
-   NotAKnotInterpolator          *spliner;
-   /// Flag used to mark when the "too few points" warning has been written
-   bool                          warnTooFewPoints;
-   /// Indices into the profile data that is loaded into the interpolator
-   Integer                       interpolatorData[5];
-   /// Last used index pair
-   Integer                       indexPair[2];
   
    // Thrust Scale Factor Solve For data
    /// Spacecraft thrust scale factor
@@ -179,12 +164,6 @@ protected:
 
    void ComputeAccelerationMassFlow(const GmatEpoch atEpoch, Real burnData[4]);
    void ComputeAccelerationMassFlow(const GmatTime &atEpoch, Real burnData[4]);
-   void GetSegmentData(Integer atIndex, GmatEpoch atEpoch);
-   void GetSegmentData(Integer atIndex, const GmatTime &atEpoch);
-   void LinearInterpolate(Integer atIndex, GmatEpoch atEpoch);
-   void LinearInterpolate(Integer atIndex, const GmatTime &atEpoch);
-   void SplineInterpolate(Integer atIndex, GmatEpoch atEpoch);
-   void SplineInterpolate(Integer atIndex, const GmatTime &atEpoch);
 
    void ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epoch);
    void ConvertDirectionToInertial(Real *dir, Real *dirInertial, const GmatTime &epochGT);
@@ -0,0 +1,217 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ScenarioRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements ScenarioRunner, which runs generated scripts through the
+ * Moderator for the unit test drivers.
+ */
+//------------------------------------------------------------------------------
+
+#include <sstream>
+#include <fstream>
+#include <chrono>
+#include <cmath>
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "Moderator.hpp"
+#include "RunProfiler.hpp"
+
+const std::string ScenarioRunner::REPORT_PATH = "../../../test/TestUtil/";
+
+
+//------------------------------------------------------------------------------
+// ScenarioRunner(TestOutput &output, const std::string &reportPrefix)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param output       The test output that receives the run results
+ * @param reportPrefix Prefix for the names of the report files
+ */
+//------------------------------------------------------------------------------
+ScenarioRunner::ScenarioRunner(TestOutput &output,
+      const std::string &reportPrefix) :
+   out      (output),
+   prefix   (reportPrefix)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// void Initialize()
+//------------------------------------------------------------------------------
+/**
+ * Initializes the Moderator, reading the startup file and loading plugins
+ */
+//------------------------------------------------------------------------------
+void ScenarioRunner::Initialize()
+{
+   if (!Moderator::Instance()->Initialize())
+      throw GmatBaseException("Moderator failed to initialize");
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetReportFile(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Builds the path of the report file for a scenario
+ *
+ * @param name The scenario name
+ *
+ * @return The path to use in the scenario's ReportFile
+ */
+//------------------------------------------------------------------------------
+std::string ScenarioRunner::GetReportFile(const std::string &name) const
+{
+   return REPORT_PATH + prefix + "_" + name + ".txt";
+}
+
+
+//------------------------------------------------------------------------------
+// Real Run(const std::string &name, const std::string &script,
+//          bool showProfile)
+//------------------------------------------------------------------------------
+/**
+ * Interprets and runs a script, writing its wall clock time and optionally the
+ * profiler counters
+ *
+ * @param name        The scenario name, used in messages
+ * @param script      The script text
+ * @param showProfile true to write the profiler table for the run
+ *
+ * @return The wall clock time of the run, in seconds
+ */
+//------------------------------------------------------------------------------
+Real ScenarioRunner::Run(const std::string &name, const std::string &script,
+      bool showProfile)
+{
+   Moderator *mod = Moderator::Instance();
+   RunProfiler *profiler = RunProfiler::Instance();
+
+   std::istringstream *ss = new std::istringstream(script);
+   bool interpreted = mod->InterpretScript(ss, true);
+   delete ss;
+   if (!interpreted)
+      throw GmatBaseException("The " + name + " script did not build");
+
+   profiler->Reset();
+   profiler->SetEnabled(showProfile);
+   std::chrono::steady_clock::time_point start =
+         std::chrono::steady_clock::now();
+   Integer status = mod->RunScript();
+   Real elapsed = std::chrono::duration<Real>(
+         std::chrono::steady_clock::now() - start).count();
+   profiler->SetEnabled(false);
+
+   if (status != 1)
+      throw GmatBaseException("The " + name + " mission did not run");
+
+   out.Put("      Time (s):          ", elapsed);
+   if (showProfile)
+      out.Put(profiler->GetReportTable(name, false));
+
+   return elapsed;
+}
+
+
+//------------------------------------------------------------------------------
+// bool ReadRows(const std::string &name, std::vector<RealArray> &rows) const
+//------------------------------------------------------------------------------
+/**
+ * Reads the numeric rows of a scenario's report file
+ *
+ * Blank lines and lines that do not start with a number are skipped.
+ *
+ * @param name The scenario name
+ * @param rows The values on each row
+ *
+ * @return true if at least one row was read
+ */
+//------------------------------------------------------------------------------
+bool ScenarioRunner::ReadRows(const std::string &name,
+      std::vector<RealArray> &rows) const
+{
+   rows.clear();
+
+   std::ifstream report(GetReportFile(name).c_str());
+   std::string line;
+   while (std::getline(report, line))
+   {
+      std::istringstream values(line);
+      RealArray row;
+      Real value;
+      while (values >> value)
+         row.push_back(value);
+      if (!row.empty())
+         rows.push_back(row);
+   }
+
+   return !rows.empty();
+}
+
+
+//------------------------------------------------------------------------------
+// bool ReadLastRow(const std::string &name, Real *values,
+//                  Integer count) const
+//------------------------------------------------------------------------------
+/**
+ * Reads the final row of a scenario's report file
+ *
+ * @param name   The scenario name
+ * @param values The values read
+ * @param count  The number of values expected on the row
+ *
+ * @return true if the row holds at least count values
+ */
+//------------------------------------------------------------------------------
+bool ScenarioRunner::ReadLastRow(const std::string &name, Real *values,
+      Integer count) const
+{
+   std::vector<RealArray> rows;
+   if (!ReadRows(name, rows) || ((Integer)rows.back().size() < count))
+      return false;
+
+   for (Integer i = 0; i < count; ++i)
+      values[i] = rows.back()[i];
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Distance(const Real *a, const Real *b, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Computes the Euclidean distance between two vectors
+ *
+ * @param a     The first vector
+ * @param b     The second vector
+ * @param count The vector size
+ *
+ * @return The length of a - b
+ */
+//------------------------------------------------------------------------------
+Real ScenarioRunner::Distance(const Real *a, const Real *b, Integer count)
+{
+   Real sum = 0.0;
+   for (Integer i = 0; i < count; ++i)
+      sum += (a[i] - b[i]) * (a[i] - b[i]);
+   return sqrt(sum);
+}
@@ -0,0 +1,62 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ScenarioRunner
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares ScenarioRunner, which runs generated scripts through the Moderator
+ * for the unit test drivers.
+ *
+ * A driver builds the text of a mission that reports its results to a file
+ * named by GetReportFile(), runs it with Run(), and reads the reported values
+ * back with ReadRows() or ReadLastRow().
+ */
+//------------------------------------------------------------------------------
+#ifndef ScenarioRunner_hpp
+#define ScenarioRunner_hpp
+
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+
+class ScenarioRunner
+{
+public:
+   /// Location of the report files written by the generated scripts
+   static const std::string REPORT_PATH;
+
+   ScenarioRunner(TestOutput &output, const std::string &reportPrefix);
+
+   void        Initialize();
+   std::string GetReportFile(const std::string &name) const;
+   Real        Run(const std::string &name, const std::string &script,
+                   bool showProfile = true);
+   bool        ReadRows(const std::string &name,
+                        std::vector<RealArray> &rows) const;
+   bool        ReadLastRow(const std::string &name, Real *values,
+                           Integer count) const;
+
+   static Real Distance(const Real *a, const Real *b, Integer count = 3);
+
+private:
+   /// Output for the timing and profiler results
+   TestOutput  &out;
+   /// Prefix of the report file names, usually the name of the driver
+   std::string prefix;
+};
+
+#endif
@@ -0,0 +1,733 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestAemEpochSearch
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Regression test for the CCSDS AEM epoch searches and the CCSDSAttitude
+ * epoch cache.
+ *
+ * Writes an AEM file with four segments: two quaternion segments that meet at
+ * a shared boundary, the second with irregular spacing; an Euler angle segment
+ * that overlaps the second one; and, after a gap, a quaternion segment with
+ * usable times.  Epochs at, near and between every
+ * data point and segment limit are then looked up forward, backward, in a
+ * shuffled order and with each epoch repeated.  Every segment number,
+ * FindFirstAfter() result and exact match must be the one the linear searches
+ * that these replaced would have found, and every state from the searched
+ * reader must match, bit for bit, a reader that bisects from a reset search.
+ * Finally the attitude read through CCSDSAttitude, with repeated epochs, must
+ * match the reader, and a repeated epoch must be served from the cache.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "RealUtilities.hpp"
+#include "Rmatrix33.hpp"
+#include "LeapSecsFileReader.hpp"
+#include "TimeSystemConverter.hpp"
+#include "CCSDSAEMReader.hpp"
+#include "CCSDSAEMQuaternionSegment.hpp"
+#include "CCSDSAEMEulerAngleSegment.hpp"
+#include "CCSDSAttitude.hpp"
+
+using namespace std;
+
+static const std::string AEM_FILE =
+      "../../../test/TestUtil/TestAemEpochSearch.aem";
+static const std::string LEAP_SECOND_FILE =
+      "../../../test/TestUtil/TestAemEpochSearchLeapSeconds.dat";
+
+/// Offsets, in seconds, added to each data epoch to make the query epochs;
+/// the smallest ones fall inside the exact match tolerance of 1 ms
+static const Real EPOCH_OFFSETS[] =
+      {0.0, 4.0e-4, -4.0e-4, 3.0e-3, -3.0e-3, 0.5, -0.5};
+static const Integer OFFSET_COUNT =
+      sizeof(EPOCH_OFFSETS) / sizeof(EPOCH_OFFSETS[0]);
+
+/// Seed of the shuffle
+static unsigned int seed = 12345;
+
+//------------------------------------------------------------------------------
+// SearchProbe
+//------------------------------------------------------------------------------
+/**
+ * Access to the searches of a probe segment, whatever its attitude type
+ */
+//------------------------------------------------------------------------------
+class SearchProbe
+{
+public:
+   virtual ~SearchProbe() {}
+
+   virtual Integer   Search(Real atEpoch, bool usableOnly) = 0;
+   virtual Integer   LinearSearch(Real atEpoch, bool usableOnly) = 0;
+   virtual bool      LinearMatch(Real atEpoch, Integer &matchPos) = 0;
+   virtual Rvector   State(Real atEpoch) = 0;
+   virtual Rvector   Data(Integer index) = 0;
+   virtual void      ResetSearch() = 0;
+};
+
+
+//------------------------------------------------------------------------------
+// SegmentProbe
+//------------------------------------------------------------------------------
+/**
+ * AEM segment that exposes its epoch searches, next to the linear searches
+ * they replaced
+ */
+//------------------------------------------------------------------------------
+template <class Segment>
+class SegmentProbe : public Segment, public SearchProbe
+{
+public:
+   SegmentProbe(Integer segNum) : Segment(segNum) {}
+
+   //---------------------------------------------------------------------------
+   // Integer Search(Real atEpoch, bool usableOnly)
+   //---------------------------------------------------------------------------
+   /**
+    * Runs FindFirstAfter() over the usable points or over all of them
+    */
+   //---------------------------------------------------------------------------
+   Integer Search(Real atEpoch, bool usableOnly)
+   {
+      if (usableOnly)
+         return this->FindFirstAfter(atEpoch, this->firstUsable,
+               this->lastUsable);
+      return this->FindFirstAfter(atEpoch, 0,
+            (Integer)this->dataStore.size() - 1);
+   }
+
+   //---------------------------------------------------------------------------
+   // Integer LinearSearch(Real atEpoch, bool usableOnly)
+   //---------------------------------------------------------------------------
+   /**
+    * The scan the interpolators used to find the first later point.  It
+    * returns one past the range when no point is later, where the
+    * interpolators used 0; FindFirstAfter() makes the same choice.
+    */
+   //---------------------------------------------------------------------------
+   Integer LinearSearch(Real atEpoch, bool usableOnly)
+   {
+      Integer first = (usableOnly ? this->firstUsable : 0);
+      Integer last  = (usableOnly ? this->lastUsable :
+            (Integer)this->dataStore.size() - 1);
+      for (Integer ii = first; ii <= last; ii++)
+         if (this->dataStore.at(ii)->epoch > atEpoch)
+            return ii;
+      return last + 1;
+   }
+
+   //---------------------------------------------------------------------------
+   // bool LinearMatch(Real atEpoch, Integer &matchPos)
+   //---------------------------------------------------------------------------
+   /**
+    * The scan DetermineState() used for an exact match
+    *
+    * @param matchPos Set to the matching point, or to the last earlier one
+    *
+    * @return true for an exact match
+    */
+   //---------------------------------------------------------------------------
+   bool LinearMatch(Real atEpoch, Integer &matchPos)
+   {
+      matchPos = -1;
+      for (unsigned int ii = 0; ii < this->dataStore.size(); ii++)
+      {
+         Real theTime = (this->dataStore.at(ii))->epoch;
+         if (GmatMathUtil::IsEqual(theTime, atEpoch,
+               CCSDSEMSegment::EPOCH_MATCH_TOLERANCE))
+         {
+            matchPos = ii;
+            return true;
+         }
+         if (theTime < atEpoch)  matchPos = ii;
+         else if (theTime > atEpoch) break;
+      }
+      return false;
+   }
+
+   Rvector State(Real atEpoch)
+   {
+      return this->DetermineState(atEpoch);
+   }
+
+   Rvector Data(Integer index)
+   {
+      return this->dataStore.at(index)->data;
+   }
+
+   void ResetSearch()
+   {
+      this->searchIndex = 0;
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// ReaderProbe
+//------------------------------------------------------------------------------
+/**
+ * AEM reader that builds probe segments and exposes its segment lookup, next
+ * to the linear lookup it replaced
+ */
+//------------------------------------------------------------------------------
+class ReaderProbe : public CCSDSAEMReader
+{
+public:
+   Integer FindSegment(Real epoch)
+   {
+      return GetSegmentNumber(epoch);
+   }
+
+   Integer LinearFindSegment(Real epoch)
+   {
+      for (Integer ii = 0; ii < numSegments; ii++)
+         if ((segments.at(ii))->CoversEpoch(epoch))
+            return ii;
+      return -1;
+   }
+
+   SearchProbe* GetProbe(Integer num)
+   {
+      return dynamic_cast<SearchProbe*>(GetSegment(num));
+   }
+
+   CCSDSEMSegment* GetSegmentAt(Integer num)
+   {
+      return GetSegment(num);
+   }
+
+   Integer GetSegmentCount()
+   {
+      return numSegments;
+   }
+
+protected:
+   CCSDSEMSegment* CreateNewSegment(Integer segNum, const std::string &ofType)
+   {
+      if (ofType == "QUATERNION")
+         return new SegmentProbe<CCSDSAEMQuaternionSegment>(segNum);
+      if (ofType == "EULER_ANGLE")
+         return new SegmentProbe<CCSDSAEMEulerAngleSegment>(segNum);
+      return CCSDSAEMReader::CreateNewSegment(segNum, ofType);
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// AttitudeProbe
+//------------------------------------------------------------------------------
+/**
+ * CCSDSAttitude reading the test file directly, without the file manager and
+ * the spacecraft it needs when it is initialized in a mission
+ */
+//------------------------------------------------------------------------------
+class AttitudeProbe : public CCSDSAttitude
+{
+public:
+   AttitudeProbe() : CCSDSAttitude("AemProbe")
+   {
+      LoadFile();
+   }
+
+   /// A copied reader has no segments until it is initialized again
+   AttitudeProbe(const AttitudeProbe &probe) : CCSDSAttitude(probe)
+   {
+      LoadFile();
+   }
+
+   void LoadFile()
+   {
+      delete reader;
+      reader = new CCSDSAEMReader();
+      reader->SetFile(AEM_FILE);
+      isInitialized = true;
+      needsReinit   = false;
+   }
+
+   Rmatrix33 Compute(Real atTime)
+   {
+      ComputeCosineMatrixAndAngularVelocity(atTime);
+      return dcm;
+   }
+
+   /// Marks the current matrix, so a cached copy can be recognized
+   void MarkMatrix()
+   {
+      dcm(0, 0) = 2.0;
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// std::string FormatEpoch(Integer seconds)
+//------------------------------------------------------------------------------
+/**
+ * Formats a time on 1 Jan 2019 as an AEM epoch
+ */
+//------------------------------------------------------------------------------
+std::string FormatEpoch(Integer seconds)
+{
+   std::stringstream epoch;
+   epoch << "2019-01-01T" << setfill('0') << setw(2) << seconds / 3600 << ":"
+         << setw(2) << (seconds / 60) % 60 << ":" << setw(2) << seconds % 60
+         << ".000";
+   return epoch.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteSegment(std::ofstream &aem, bool quaternion, Integer start,
+//       Integer stop, Integer usableStart, Integer usableStop,
+//       const Integer *steps, Integer stepCount)
+//------------------------------------------------------------------------------
+/**
+ * Writes a segment, from start to stop in steps taken in turn from a list
+ *
+ * @param usableStart Start of the usable span, or -1 to leave it out
+ */
+//------------------------------------------------------------------------------
+void WriteSegment(std::ofstream &aem, bool quaternion, Integer start,
+      Integer stop, Integer usableStart, Integer usableStop,
+      const Integer *steps, Integer stepCount)
+{
+   aem << "META_START\n"
+       << "OBJECT_NAME = AemProbe\n"
+       << "OBJECT_ID = 2019-001A\n"
+       << "CENTER_NAME = EARTH\n"
+       << "REF_FRAME_A = EME2000\n"
+       << "REF_FRAME_B = SC_BODY_1\n"
+       << "ATTITUDE_DIR = A2B\n"
+       << "TIME_SYSTEM = UTC\n"
+       << "START_TIME = " << FormatEpoch(start) << "\n";
+   if (usableStart >= 0)
+      aem << "USEABLE_START_TIME = " << FormatEpoch(usableStart) << "\n"
+          << "USEABLE_STOP_TIME = " << FormatEpoch(usableStop) << "\n";
+   aem << "STOP_TIME = " << FormatEpoch(stop) << "\n";
+   if (quaternion)
+      aem << "ATTITUDE_TYPE = QUATERNION\n"
+          << "QUATERNION_TYPE = LAST\n"
+          << "INTERPOLATION_METHOD = LINEAR\n"
+          << "INTERPOLATION_DEGREE = 1\n";
+   else
+      aem << "ATTITUDE_TYPE = EULER_ANGLE\n"
+          << "EULER_ROT_SEQ = 321\n"
+          << "INTERPOLATION_METHOD = LAGRANGE\n"
+          << "INTERPOLATION_DEGREE = 5\n";
+   aem << "META_STOP\n\n"
+       << "DATA_START\n";
+
+   aem.precision(16);
+   Integer t = start;
+   for (Integer k = 0; t <= stop; ++k)
+   {
+      aem << FormatEpoch(t);
+      if (quaternion)
+      {
+         // A rotation about a fixed axis, at a varying rate
+         Real angle = 0.002 * t + 0.3 * sin(t / 500.0);
+         Real s = sin(angle / 2.0);
+         aem << " " << s / 3.0 << " " << 2.0 * s / 3.0 << " "
+             << 2.0 * s / 3.0 << " " << cos(angle / 2.0) << "\n";
+      }
+      else
+         aem << " " << 10.0 + 0.01 * t << " " << 20.0 * sin(t / 900.0)
+             << " " << 5.0 + 0.002 * t << "\n";
+
+      if (t == stop)
+         break;
+      t = std::min(t + steps[k % stepCount], stop);
+   }
+   aem << "DATA_STOP\n\n";
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteFiles()
+//------------------------------------------------------------------------------
+/**
+ * Writes the AEM file and the leap second file needed to read its epochs
+ */
+//------------------------------------------------------------------------------
+void WriteFiles()
+{
+   std::ofstream leap(LEAP_SECOND_FILE.c_str());
+   if (!leap)
+      throw GmatBaseException("Cannot write " + LEAP_SECOND_FILE);
+   leap << " 2017 JAN  1 =JD 2457754.5  TAI-UTC=  37.0       S + "
+           "(MJD - 41317.) X 0.0      S\n";
+   leap.close();
+
+   std::ofstream aem(AEM_FILE.c_str());
+   if (!aem)
+      throw GmatBaseException("Cannot write " + AEM_FILE);
+   aem << "CCSDS_AEM_VERS = 1.0\n"
+       << "CREATION_DATE = 2019-01-01T00:00:00.000\n"
+       << "ORIGINATOR = GMAT\n\n";
+
+   const Integer uniform[] = {60};
+   const Integer irregular[] = {20, 35, 50, 65, 5};
+   const Integer euler[] = {50};
+   const Integer fine[] = {30};
+
+   // Segments 0 and 1 meet at 01:00; segment 2 overlaps segment 1; segment 3
+   // follows a gap and is usable from 03:30:30 to 03:59:30
+   WriteSegment(aem, true,     0,  3600,    -1,    -1, uniform, 1);
+   WriteSegment(aem, true,  3600,  7200,    -1,    -1, irregular, 5);
+   WriteSegment(aem, false, 5400, 10800,    -1,    -1, euler, 1);
+   WriteSegment(aem, true, 12600, 14400, 12630, 14370, fine, 1);
+   aem.close();
+}
+
+
+//------------------------------------------------------------------------------
+// RealArray BuildEpochs(ReaderProbe &reader)
+//------------------------------------------------------------------------------
+/**
+ * Builds the query epochs: each data epoch with the offsets, the midpoints
+ * between data epochs, and the segment limits with the offsets
+ */
+//------------------------------------------------------------------------------
+RealArray BuildEpochs(ReaderProbe &reader)
+{
+   RealArray epochs;
+   Real epoch, next;
+
+   for (Integer s = 0; s < reader.GetSegmentCount(); ++s)
+   {
+      CCSDSEMSegment *segment = reader.GetSegmentAt(s);
+      Integer count = segment->GetNumberOfDataPoints();
+      // Sized for this segment's attitude type on first use
+      Rvector data;
+      for (Integer i = 0; i < count; ++i)
+      {
+         segment->GetEpochAndData(i, epoch, data);
+         for (Integer k = 0; k < OFFSET_COUNT; ++k)
+            epochs.push_back(epoch + EPOCH_OFFSETS[k] /
+                  GmatTimeConstants::SECS_PER_DAY);
+         if (i + 1 < count)
+         {
+            segment->GetEpochAndData(i + 1, next, data);
+            epochs.push_back(0.5 * (epoch + next));
+         }
+      }
+      for (Integer k = 0; k < OFFSET_COUNT; ++k)
+      {
+         epochs.push_back(segment->GetStartTime() + EPOCH_OFFSETS[k] /
+               GmatTimeConstants::SECS_PER_DAY);
+         epochs.push_back(segment->GetStopTime() + EPOCH_OFFSETS[k] /
+               GmatTimeConstants::SECS_PER_DAY);
+      }
+   }
+
+   // The gap, and epochs before and after the file
+   epochs.push_back(reader.GetSegmentAt(0)->GetStartTime() - 1.0);
+   epochs.push_back(0.5 * (reader.GetSegmentAt(2)->GetStopTime() +
+         reader.GetSegmentAt(3)->GetStartTime()));
+   epochs.push_back(reader.GetSegmentAt(3)->GetStopTime() + 1.0);
+
+   std::sort(epochs.begin(), epochs.end());
+   return epochs;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SameData(const Rvector &a, const Rvector &b)
+//------------------------------------------------------------------------------
+/**
+ * Checks that two vectors are the same bit for bit
+ */
+//------------------------------------------------------------------------------
+bool SameData(const Rvector &a, const Rvector &b)
+{
+   if (a.GetSize() != b.GetSize())
+      return false;
+   for (Integer i = 0; i < a.GetSize(); ++i)
+      if (memcmp(&a[i], &b[i], sizeof(Real)) != 0)
+         return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SameMatrix(const Rmatrix33 &a, const Rmatrix33 &b)
+//------------------------------------------------------------------------------
+/**
+ * Checks that two matrices are the same bit for bit
+ */
+//------------------------------------------------------------------------------
+bool SameMatrix(const Rmatrix33 &a, const Rmatrix33 &b)
+{
+   for (Integer i = 0; i < 3; ++i)
+      for (Integer j = 0; j < 3; ++j)
+         if (memcmp(&a(i, j), &b(i, j), sizeof(Real)) != 0)
+            return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetState(SearchProbe *segment, Real epoch, Rvector &state)
+//------------------------------------------------------------------------------
+/**
+ * Reads a segment state
+ *
+ * @return false if the segment rejects the epoch
+ */
+//------------------------------------------------------------------------------
+bool GetState(SearchProbe *segment, Real epoch, Rvector &state)
+{
+   try
+   {
+      state = segment->State(epoch);
+   }
+   catch (BaseException &)
+   {
+      return false;
+   }
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunScan(TestOutput &out, ReaderProbe &reader, ReaderProbe &ref,
+//       const RealArray &epochs)
+//------------------------------------------------------------------------------
+/**
+ * Looks up every epoch through the searched reader and checks the results
+ * against the linear searches and against the reset reader
+ */
+//------------------------------------------------------------------------------
+void RunScan(TestOutput &out, ReaderProbe &reader, ReaderProbe &ref,
+      const RealArray &epochs)
+{
+   Integer segmentMismatches = 0, searchMismatches = 0;
+   Integer matchMismatches = 0, stateMismatches = 0;
+   Integer exactMatches = 0, states = 0;
+   Integer segmentCount = reader.GetSegmentCount();
+
+   for (UnsignedInt e = 0; e < epochs.size(); ++e)
+   {
+      Real epoch = epochs[e];
+
+      Integer segNum = reader.FindSegment(epoch);
+      if (segNum != reader.LinearFindSegment(epoch))
+         ++segmentMismatches;
+
+      for (Integer s = 0; s < segmentCount; ++s)
+      {
+         SearchProbe *segment = reader.GetProbe(s);
+         if (segment->Search(epoch, true) !=
+             segment->LinearSearch(epoch, true))
+            ++searchMismatches;
+         if (segment->Search(epoch, false) !=
+             segment->LinearSearch(epoch, false))
+            ++searchMismatches;
+      }
+
+      if (segNum < 0)
+         continue;
+
+      SearchProbe *segment = reader.GetProbe(segNum);
+      SearchProbe *refSegment = ref.GetProbe(segNum);
+      refSegment->ResetSearch();
+
+      Rvector state, refState;
+      bool found = GetState(segment, epoch, state);
+      bool refFound = GetState(refSegment, epoch, refState);
+      Integer matchPos;
+      bool exact = segment->LinearMatch(epoch, matchPos);
+
+      if ((found != refFound) || (found != (matchPos >= 0)))
+         ++matchMismatches;
+      else if (found)
+      {
+         ++states;
+         if (!SameData(state, refState))
+            ++stateMismatches;
+         if (exact)
+         {
+            ++exactMatches;
+            if (!SameData(state, segment->Data(matchPos)))
+               ++matchMismatches;
+         }
+      }
+   }
+
+   out.Put("      Epochs:", (Integer)epochs.size());
+   out.Put("      States read:", states);
+   out.Put("      Exact matches:", exactMatches);
+   out.Validate(exactMatches > 0, true);
+   out.Put("      Segments that differ from the linear lookup:",
+         segmentMismatches);
+   out.Validate(segmentMismatches, 0);
+   out.Put("      FindFirstAfter results that differ from the linear scan:",
+         searchMismatches);
+   out.Validate(searchMismatches, 0);
+   out.Put("      Matches that differ from the linear scan:",
+         matchMismatches);
+   out.Validate(matchMismatches, 0);
+   out.Put("      States that differ from the reset reader:",
+         stateMismatches);
+   out.Validate(stateMismatches, 0);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   WriteFiles();
+   LeapSecsFileReader *leapSeconds = new LeapSecsFileReader(LEAP_SECOND_FILE);
+   leapSeconds->Initialize();
+   TimeSystemConverter::Instance()->SetLeapSecsFileReader(leapSeconds);
+
+   ReaderProbe reader, ref;
+   reader.SetFile(AEM_FILE);
+   reader.Initialize();
+   ref.SetFile(AEM_FILE);
+   ref.Initialize();
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== File");
+   //---------------------------------------------------------------------------
+   out.Put("   Segments:", reader.GetSegmentCount());
+   out.Validate(reader.GetSegmentCount(), 4);
+   out.Put("   The shared boundary is in the first segment:");
+   out.Validate(reader.FindSegment(reader.GetSegmentAt(1)->GetStartTime()), 0);
+   out.Put("   The overlap is in the earlier segment:");
+   out.Validate(reader.FindSegment(reader.GetSegmentAt(1)->GetStopTime()), 1);
+
+   RealArray epochs = BuildEpochs(reader);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Lookups");
+   //---------------------------------------------------------------------------
+   out.Put("   Forward:");
+   RunScan(out, reader, ref, epochs);
+
+   out.Put("   Backward:");
+   RealArray backward(epochs.rbegin(), epochs.rend());
+   RunScan(out, reader, ref, backward);
+
+   out.Put("   Shuffled:");
+   RealArray shuffled(epochs);
+   for (Integer i = (Integer)shuffled.size() - 1; i > 0; --i)
+   {
+      seed = seed * 1103515245u + 12345u;
+      std::swap(shuffled[i], shuffled[(seed >> 8) % (i + 1)]);
+   }
+   RunScan(out, reader, ref, shuffled);
+
+   out.Put("   Repeated:");
+   RealArray repeated;
+   for (UnsignedInt i = 0; i < epochs.size(); ++i)
+      repeated.insert(repeated.end(), 3, epochs[i]);
+   RunScan(out, reader, ref, repeated);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== CCSDSAttitude cache");
+   //---------------------------------------------------------------------------
+   AttitudeProbe attitude;
+   Integer attitudeMismatches = 0, attitudes = 0;
+   for (UnsignedInt i = 0; i < repeated.size(); ++i)
+   {
+      if (reader.FindSegment(repeated[i]) < 0)
+         continue;
+      Rmatrix33 expected;
+      try
+      {
+         expected = ref.GetState(repeated[i]);
+      }
+      catch (BaseException &)
+      {
+         continue;
+      }
+      ++attitudes;
+      if (!SameMatrix(attitude.Compute(repeated[i]), expected))
+         ++attitudeMismatches;
+   }
+   out.Put("   Attitudes read:", attitudes);
+   out.Put("   Attitudes that differ from the reader:", attitudeMismatches);
+   out.Validate(attitudeMismatches, 0);
+
+   Real first = epochs[epochs.size() / 3];
+   Real second = epochs[epochs.size() / 3 + 1];
+   attitude.Compute(first);
+   attitude.MarkMatrix();
+   out.Put("   A repeated epoch is served from the cache:");
+   out.Validate(attitude.Compute(first)(0, 0), 2.0);
+   out.Put("   A new epoch is read from the file:");
+   out.Validate(SameMatrix(attitude.Compute(second), ref.GetState(second)),
+         true);
+   out.Validate(SameMatrix(attitude.Compute(first), ref.GetState(first)),
+         true);
+
+   attitude.MarkMatrix();
+   AttitudeProbe copy(attitude);
+   out.Put("   A copy does not inherit the cache:");
+   out.Validate(SameMatrix(copy.Compute(first), ref.GetState(first)), true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestAemEpochSearchOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran regression testing of the AEM epoch "
+            "searches!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,293 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestDeltaRangeDerivatives
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the DeltaRange derivatives w.r.t. the spacecraft state.
+ *
+ * Simulates a short span of DeltaRange data from two ground stations, then
+ * takes the DeltaRange adapter out of the sandbox and builds the CartesianX
+ * derivative row through the shared transmitter path and through the per-leg
+ * path.  The rows must agree with each other and with the row reported by
+ * CalculateMeasurementDerivatives(), first with the leg multipliers at their
+ * defaults and then with different multipliers on the two legs.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "RealUtilities.hpp"
+#include "Moderator.hpp"
+#include "TrackingFileSet.hpp"
+#include "DeltaRangeAdapter.hpp"
+
+using namespace std;
+
+/// Allowed difference between the two derivative paths, relative to the
+/// largest element of the row
+static const Real DERIVATIVE_TOLERANCE = 1.0e-12;
+
+//------------------------------------------------------------------------------
+// std::string BuildScript()
+//------------------------------------------------------------------------------
+/**
+ * Builds a script simulating DeltaRange data from GDS and MAD
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript()
+{
+   std::stringstream script;
+
+   script << "% Generated by TestDeltaRangeDerivatives\n\n"
+          << "Create Spacecraft SimSat;\n"
+          << "SimSat.DateFormat = UTCGregorian;\n"
+          << "SimSat.Epoch = '10 Jun 2010 00:00:00.000';\n"
+          << "SimSat.CoordinateSystem = EarthMJ2000Eq;\n"
+          << "SimSat.DisplayStateType = Cartesian;\n"
+          << "SimSat.X = 576.869556;\n"
+          << "SimSat.Y = -5701.142761;\n"
+          << "SimSat.Z = -4170.593691;\n"
+          << "SimSat.VX = -1.76450794;\n"
+          << "SimSat.VY = 4.18128798;\n"
+          << "SimSat.VZ = -5.96578986;\n"
+          << "SimSat.Id = 'LEOSat';\n"
+          << "SimSat.AddHardware = {Transponder1, SpacecraftAntenna};\n\n"
+          << "Create Antenna SpacecraftAntenna;\n"
+          << "Create Transponder Transponder1;\n"
+          << "Transponder1.PrimaryAntenna = SpacecraftAntenna;\n"
+          << "Transponder1.HardwareDelay = 0.00005;\n"
+          << "Transponder1.TurnAroundRatio = '240/221';\n\n"
+          << "Create Transmitter Transmitter1;\n"
+          << "Create Antenna Antenna1;\n"
+          << "Create Receiver Receiver1;\n"
+          << "Transmitter1.PrimaryAntenna = Antenna1;\n"
+          << "Transmitter1.Frequency = 2067.5;\n"
+          << "Receiver1.PrimaryAntenna = Antenna1;\n\n";
+
+   const char *stations[2] = {"GDS", "MAD"};
+   const Real locations[2][3] = {
+         {-2353.621251, -4641.341542,  3677.052370},
+         { 4849.519988,  -360.641653,  4114.504590} };
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      std::string gs = stations[i];
+      script << "Create GroundStation " << gs << ";\n"
+             << gs << ".CentralBody = Earth;\n"
+             << gs << ".StateType = Cartesian;\n"
+             << gs << ".HorizonReference = Ellipsoid;\n"
+             << gs << ".Location1 = " << locations[i][0] << ";\n"
+             << gs << ".Location2 = " << locations[i][1] << ";\n"
+             << gs << ".Location3 = " << locations[i][2] << ";\n"
+             << gs << ".Id = '" << gs << "';\n"
+             << gs << ".AddHardware = {Transmitter1, Receiver1, Antenna1};\n"
+             << gs << ".MinimumElevationAngle = 0;\n"
+             << gs << ".ErrorModels = {DeltaRangeModel};\n\n";
+   }
+
+   script << "Create ErrorModel DeltaRangeModel;\n"
+          << "DeltaRangeModel.Type = 'DeltaRange';\n"
+          << "DeltaRangeModel.NoiseSigma = 0.010;\n\n"
+          << "Create TrackingFileSet simData;\n"
+          << "simData.AddTrackingConfig = {{GDS, SimSat, MAD}, "
+             "'DeltaRange'};\n"
+          << "simData.FileName = {'" << ScenarioRunner::REPORT_PATH
+          << "DeltaRangeDerivatives.gmd'};\n"
+          << "simData.UseLightTime = False;\n\n"
+          << "Create ForceModel ODProp_ForceModel;\n"
+          << "ODProp_ForceModel.CentralBody = Earth;\n"
+          << "ODProp_ForceModel.PointMasses = {Earth};\n"
+          << "ODProp_ForceModel.Drag = None;\n"
+          << "ODProp_ForceModel.SRP = Off;\n"
+          << "ODProp_ForceModel.ErrorControl = None;\n\n"
+          << "Create Propagator ODProp;\n"
+          << "ODProp.FM = ODProp_ForceModel;\n"
+          << "ODProp.Type = 'RungeKutta56';\n"
+          << "ODProp.InitialStepSize = 60;\n"
+          << "ODProp.Accuracy = 1e-13;\n"
+          << "ODProp.MinStep = 0;\n"
+          << "ODProp.MaxStep = 60;\n\n"
+          << "Create Simulator sim;\n"
+          << "sim.AddData = {simData};\n"
+          << "sim.EpochFormat = 'UTCGregorian';\n"
+          << "sim.InitialEpoch = '10 Jun 2010 00:00:00.000';\n"
+          << "sim.FinalEpoch = '10 Jun 2010 00:10:00.000';\n"
+          << "sim.MeasurementTimeStep = 60;\n"
+          << "sim.Propagator = ODProp;\n"
+          << "sim.AddNoise = Off;\n\n"
+          << "BeginMissionSequence;\n"
+          << "RunSimulator sim;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// DeltaRangeAdapter* FindAdapter()
+//------------------------------------------------------------------------------
+/**
+ * Finds the DeltaRange adapter of the sandbox copy of simData
+ */
+//------------------------------------------------------------------------------
+DeltaRangeAdapter* FindAdapter()
+{
+   TrackingFileSet *tfs = dynamic_cast<TrackingFileSet*>(
+         Moderator::Instance()->GetInternalObject("simData"));
+   if (tfs == NULL)
+      throw GmatBaseException("The sandbox TrackingFileSet simData was not "
+            "found");
+
+   std::vector<TrackingDataAdapter*> *adapters = tfs->GetAdapters();
+   for (UnsignedInt i = 0; i < adapters->size(); ++i)
+   {
+      DeltaRangeAdapter *adapter =
+            dynamic_cast<DeltaRangeAdapter*>((*adapters)[i]);
+      if (adapter != NULL)
+         return adapter;
+   }
+
+   throw GmatBaseException("simData does not hold a DeltaRange adapter");
+}
+
+
+//------------------------------------------------------------------------------
+// RealArray CompareRows(TestOutput &out, DeltaRangeAdapter *adapter,
+//       GmatBase *sat)
+//------------------------------------------------------------------------------
+/**
+ * Builds the CartesianX row through both derivative paths and compares them
+ *
+ * @return The row built through the shared transmitter path
+ */
+//------------------------------------------------------------------------------
+RealArray CompareRows(TestOutput &out, DeltaRangeAdapter *adapter,
+      GmatBase *sat)
+{
+   Integer id = sat->GetEstimationParameterID("CartesianX");
+
+   adapter->CalculateMeasurement();
+
+   std::vector<RealArray> shared(1, RealArray(6, 0.0));
+   std::vector<RealArray> perLeg(1, RealArray(6, 0.0));
+
+   out.Put("   The shared transmitter path applies:");
+   out.Validate(adapter->AccumulateTransmitterDerivatives(sat, "CartesianX",
+         1.0, shared), true);
+   adapter->AccumulatePathDerivatives(sat, id, 1.0, perLeg);
+   const std::vector<RealArray> &reported =
+         adapter->CalculateMeasurementDerivatives(sat, id);
+
+   Real scale = 0.0;
+   for (UnsignedInt j = 0; j < 6; ++j)
+      scale = GmatMathUtil::Max(scale, fabs(perLeg[0][j]));
+   out.Put("   Largest element of the row:", scale);
+   out.Validate(scale > 0.0, true);
+
+   out.Put("   Shared transmitter row against the per-leg row:");
+   for (UnsignedInt j = 0; j < 6; ++j)
+      out.Validate(shared[0][j], perLeg[0][j], DERIVATIVE_TOLERANCE * scale);
+
+   out.Put("   Reported row against the per-leg row:");
+   out.Validate((Integer)reported.size(), 1);
+   out.Validate((Integer)reported[0].size(), 6);
+   for (UnsignedInt j = 0; j < 6; ++j)
+      out.Validate(reported[0][j], perLeg[0][j],
+            DERIVATIVE_TOLERANCE * scale);
+
+   return shared[0];
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "DeltaRangeDerivatives");
+   runner.Initialize();
+   runner.Run("Simulation", BuildScript());
+
+   DeltaRangeAdapter *adapter = FindAdapter();
+   GmatBase *sat = Moderator::Instance()->GetInternalObject("SimSat");
+   if (sat == NULL)
+      throw GmatBaseException("The sandbox spacecraft SimSat was not found");
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Default multipliers");
+   //---------------------------------------------------------------------------
+   Real refMultiplier = adapter->referenceLeg->GetMultiplierFactor();
+   Real otherMultiplier = adapter->otherLeg->GetMultiplierFactor();
+   RealArray unscaled = CompareRows(out, adapter, sat);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Different multipliers");
+   //---------------------------------------------------------------------------
+   adapter->referenceLeg->SetMultiplierFactor(0.5 * refMultiplier);
+   adapter->otherLeg->SetMultiplierFactor(2.0 * otherMultiplier);
+   RealArray scaled = CompareRows(out, adapter, sat);
+
+   out.Put("   The multipliers change the row:");
+   bool changed = false;
+   for (UnsignedInt j = 0; j < 6; ++j)
+      if (scaled[j] != unscaled[j])
+         changed = true;
+   out.Validate(changed, true);
+
+   adapter->referenceLeg->SetMultiplierFactor(refMultiplier);
+   adapter->otherLeg->SetMultiplierFactor(otherMultiplier);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestDeltaRangeDerivativesOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of DeltaRange derivatives!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,295 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestLightTimeSeed
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for seeded light time solutions.
+ *
+ * Simulates a day of noise free two-way range and range rate data from three
+ * ground stations twice, once with TrackingFileSet.UseLightTimeSeed on and
+ * once with it off.  The test fails unless both runs produce the same records
+ * and every measurement value agrees to within the light time tolerance.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+
+using namespace std;
+
+/// Allowed range difference, in km, between seeded and unseeded solutions
+static const Real RANGE_TOLERANCE = 1.0e-6;
+/// Allowed range rate difference, in km/s
+static const Real RANGE_RATE_TOLERANCE = 1.0e-7;
+
+/// One record of a GMAT measurement data file
+struct Record
+{
+   std::string key;
+   std::string type;
+   Real        value;
+};
+
+//------------------------------------------------------------------------------
+// std::string GetDataFile(bool seeded)
+//------------------------------------------------------------------------------
+std::string GetDataFile(bool seeded)
+{
+   return ScenarioRunner::REPORT_PATH + "LightTimeSeed_" +
+         (seeded ? "On" : "Off") + ".gmd";
+}
+
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(bool seeded)
+//------------------------------------------------------------------------------
+/**
+ * Builds a simulation script writing its data to the file for the setting
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(bool seeded)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestLightTimeSeed\n\n"
+          << "Create Spacecraft SimSat;\n"
+          << "SimSat.DateFormat = UTCGregorian;\n"
+          << "SimSat.Epoch = '10 Jun 2010 00:00:00.000';\n"
+          << "SimSat.CoordinateSystem = EarthMJ2000Eq;\n"
+          << "SimSat.DisplayStateType = Cartesian;\n"
+          << "SimSat.X = 576.869556;\n"
+          << "SimSat.Y = -5701.142761;\n"
+          << "SimSat.Z = -4170.593691;\n"
+          << "SimSat.VX = -1.76450794;\n"
+          << "SimSat.VY = 4.18128798;\n"
+          << "SimSat.VZ = -5.96578986;\n"
+          << "SimSat.Id = 'LEOSat';\n"
+          << "SimSat.AddHardware = {Transponder1, SpacecraftAntenna};\n\n"
+          << "Create Antenna SpacecraftAntenna;\n"
+          << "Create Transponder Transponder1;\n"
+          << "Transponder1.PrimaryAntenna = SpacecraftAntenna;\n"
+          << "Transponder1.HardwareDelay = 0.00005;\n"
+          << "Transponder1.TurnAroundRatio = '240/221';\n\n"
+          << "Create Transmitter Transmitter1;\n"
+          << "Create Antenna Antenna1;\n"
+          << "Create Receiver Receiver1;\n"
+          << "Transmitter1.PrimaryAntenna = Antenna1;\n"
+          << "Transmitter1.Frequency = 2067.5;\n"
+          << "Receiver1.PrimaryAntenna = Antenna1;\n\n";
+
+   const char *stations[3] = {"GDS", "CAN", "MAD"};
+   const Real locations[3][3] = {
+         {-2353.621251, -4641.341542,  3677.052370},
+         {-4461.083514,  2682.281745, -3674.570392},
+         { 4849.519988,  -360.641653,  4114.504590} };
+
+   for (Integer i = 0; i < 3; ++i)
+   {
+      script << "Create GroundStation " << stations[i] << ";\n"
+             << stations[i] << ".CentralBody = Earth;\n"
+             << stations[i] << ".StateType = Cartesian;\n"
+             << stations[i] << ".HorizonReference = Ellipsoid;\n"
+             << stations[i] << ".Location1 = " << locations[i][0] << ";\n"
+             << stations[i] << ".Location2 = " << locations[i][1] << ";\n"
+             << stations[i] << ".Location3 = " << locations[i][2] << ";\n"
+             << stations[i] << ".Id = '" << stations[i] << "';\n"
+             << stations[i] << ".AddHardware = {Transmitter1, Receiver1, "
+                "Antenna1};\n"
+             << stations[i] << ".MinimumElevationAngle = 10;\n"
+             << stations[i] << ".ErrorModels = {RangeModel, "
+                "RangeRateModel};\n\n";
+   }
+
+   script << "Create ErrorModel RangeModel;\n"
+          << "RangeModel.Type = 'Range';\n"
+          << "RangeModel.NoiseSigma = 0.010;\n"
+          << "Create ErrorModel RangeRateModel;\n"
+          << "RangeRateModel.Type = 'RangeRate';\n"
+          << "RangeRateModel.NoiseSigma = 0.00001;\n\n"
+          << "Create TrackingFileSet simData;\n"
+          << "simData.AddTrackingConfig = {{GDS, SimSat, GDS}, 'Range', "
+             "'RangeRate'};\n"
+          << "simData.AddTrackingConfig = {{CAN, SimSat, CAN}, 'Range', "
+             "'RangeRate'};\n"
+          << "simData.AddTrackingConfig = {{MAD, SimSat, MAD}, 'Range', "
+             "'RangeRate'};\n"
+          << "simData.FileName = {'" << GetDataFile(seeded) << "'};\n"
+          << "simData.UseLightTime = True;\n"
+          << "simData.UseLightTimeSeed = " << (seeded ? "True" : "False")
+          << ";\n"
+          << "simData.SimRangeModuloConstant = 67108864;\n"
+          << "simData.SimDopplerCountInterval = 10.;\n\n"
+          << "Create ForceModel ODProp_ForceModel;\n"
+          << "ODProp_ForceModel.CentralBody = Earth;\n"
+          << "ODProp_ForceModel.PointMasses = {Earth};\n"
+          << "ODProp_ForceModel.Drag = None;\n"
+          << "ODProp_ForceModel.SRP = Off;\n"
+          << "ODProp_ForceModel.ErrorControl = None;\n\n"
+          << "Create Propagator ODProp;\n"
+          << "ODProp.FM = ODProp_ForceModel;\n"
+          << "ODProp.Type = 'RungeKutta56';\n"
+          << "ODProp.InitialStepSize = 60;\n"
+          << "ODProp.Accuracy = 1e-13;\n"
+          << "ODProp.MinStep = 0;\n"
+          << "ODProp.MaxStep = 60;\n\n"
+          << "Create Simulator sim;\n"
+          << "sim.AddData = {simData};\n"
+          << "sim.EpochFormat = 'UTCGregorian';\n"
+          << "sim.InitialEpoch = '10 Jun 2010 00:00:00.000';\n"
+          << "sim.FinalEpoch = '11 Jun 2010 00:00:00.000';\n"
+          << "sim.MeasurementTimeStep = 60;\n"
+          << "sim.Propagator = ODProp;\n"
+          << "sim.AddNoise = Off;\n\n"
+          << "BeginMissionSequence;\n"
+          << "RunSimulator sim;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadRecords(const std::string &fileName, std::vector<Record> &records)
+//------------------------------------------------------------------------------
+/**
+ * Reads a measurement data file
+ *
+ * The key of each record is every field before the measured value, so two
+ * records match when they have the same epoch, type and participants.
+ */
+//------------------------------------------------------------------------------
+void ReadRecords(const std::string &fileName, std::vector<Record> &records)
+{
+   records.clear();
+
+   std::ifstream data(fileName.c_str());
+   if (!data)
+      throw GmatBaseException("The data file " + fileName + " was not "
+            "written");
+
+   std::string line;
+   while (std::getline(data, line))
+   {
+      std::istringstream fields(line);
+      StringArray tokens;
+      std::string token;
+      while (fields >> token)
+         tokens.push_back(token);
+      if ((tokens.size() < 3) || (tokens[0][0] == '%'))
+         continue;
+
+      Record rec;
+      rec.type = tokens[1];
+      rec.value = atof(tokens.back().c_str());
+      for (UnsignedInt i = 0; i + 1 < tokens.size(); ++i)
+         rec.key += tokens[i] + " ";
+      records.push_back(rec);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "LightTimeSeed");
+   runner.Initialize();
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Seeded light time");
+   //---------------------------------------------------------------------------
+   runner.Run("Seeded", BuildScript(true));
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Unseeded light time");
+   //---------------------------------------------------------------------------
+   runner.Run("Unseeded", BuildScript(false));
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Comparison");
+   //---------------------------------------------------------------------------
+   std::vector<Record> seeded, unseeded;
+   ReadRecords(GetDataFile(true), seeded);
+   ReadRecords(GetDataFile(false), unseeded);
+
+   out.Put("   Seeded and unseeded record counts match:");
+   out.Validate((Integer)seeded.size(), (Integer)unseeded.size());
+   out.Put("   Records were simulated:");
+   out.Validate(!seeded.empty(), true);
+
+   Real maxRangeDiff = 0.0, maxRateDiff = 0.0;
+   for (UnsignedInt i = 0; i < seeded.size(); ++i)
+   {
+      if (seeded[i].key != unseeded[i].key)
+         throw GmatBaseException("Record " + seeded[i].key + " does not "
+               "match " + unseeded[i].key);
+
+      Real diff = fabs(seeded[i].value - unseeded[i].value);
+      if (seeded[i].type == "RangeRate")
+         maxRateDiff = (diff > maxRateDiff ? diff : maxRateDiff);
+      else
+         maxRangeDiff = (diff > maxRangeDiff ? diff : maxRangeDiff);
+   }
+
+   out.Put("   Max range difference (km):");
+   out.Validate(maxRangeDiff, 0.0, RANGE_TOLERANCE);
+   out.Put("   Max range rate difference (km/s):");
+   out.Validate(maxRateDiff, 0.0, RANGE_RATE_TOLERANCE);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestLightTimeSeedOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of light time seeding!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
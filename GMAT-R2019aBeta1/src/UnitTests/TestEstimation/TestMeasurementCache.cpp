@@ -0,0 +1,415 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestMeasurementCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the tracking data adapter result cache.
+ *
+ * Simulates a short span of range data, then takes the Range adapter out of
+ * the sandbox and requests the measurement and its CartesianX derivatives for
+ * one observation through the cache.  A repeated request at the same state
+ * version must be served from the cache, which the "Measurement Cache Hits"
+ * profiler counter records.  Moving the spacecraft without advancing the
+ * version must still hit, since the version is the key; advancing it must
+ * recalculate and agree with a direct calculation.  Requests for another
+ * observation or epoch, with other settings, for simulation, without an
+ * observation, or after ClearResultCache() must recalculate.  Finally the
+ * EstimationStateManager must advance the version when it writes the state.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
+#include "Moderator.hpp"
+#include "SpaceObject.hpp"
+#include "TrackingFileSet.hpp"
+#include "TrackingDataAdapter.hpp"
+#include "ObservationData.hpp"
+#include "MeasurementManager.hpp"
+#include "EstimationStateManager.hpp"
+
+using namespace std;
+
+/// Distance the spacecraft is moved along each axis, in km
+static const Real STATE_OFFSET = 1.0;
+/// Allowed difference between a cached and a direct calculation, in km
+static const Real RANGE_TOLERANCE = 1.0e-9;
+
+//------------------------------------------------------------------------------
+// std::string BuildScript()
+//------------------------------------------------------------------------------
+/**
+ * Builds a script simulating range data from GDS
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript()
+{
+   std::stringstream script;
+
+   script << "% Generated by TestMeasurementCache\n\n"
+          << "Create Spacecraft SimSat;\n"
+          << "SimSat.DateFormat = UTCGregorian;\n"
+          << "SimSat.Epoch = '10 Jun 2010 00:00:00.000';\n"
+          << "SimSat.CoordinateSystem = EarthMJ2000Eq;\n"
+          << "SimSat.DisplayStateType = Cartesian;\n"
+          << "SimSat.X = 576.869556;\n"
+          << "SimSat.Y = -5701.142761;\n"
+          << "SimSat.Z = -4170.593691;\n"
+          << "SimSat.VX = -1.76450794;\n"
+          << "SimSat.VY = 4.18128798;\n"
+          << "SimSat.VZ = -5.96578986;\n"
+          << "SimSat.Id = 'LEOSat';\n"
+          << "SimSat.AddHardware = {Transponder1, SpacecraftAntenna};\n\n"
+          << "Create Antenna SpacecraftAntenna;\n"
+          << "Create Transponder Transponder1;\n"
+          << "Transponder1.PrimaryAntenna = SpacecraftAntenna;\n"
+          << "Transponder1.HardwareDelay = 0.00005;\n"
+          << "Transponder1.TurnAroundRatio = '240/221';\n\n"
+          << "Create Transmitter Transmitter1;\n"
+          << "Create Antenna Antenna1;\n"
+          << "Create Receiver Receiver1;\n"
+          << "Transmitter1.PrimaryAntenna = Antenna1;\n"
+          << "Transmitter1.Frequency = 2067.5;\n"
+          << "Receiver1.PrimaryAntenna = Antenna1;\n\n"
+          << "Create GroundStation GDS;\n"
+          << "GDS.CentralBody = Earth;\n"
+          << "GDS.StateType = Cartesian;\n"
+          << "GDS.HorizonReference = Ellipsoid;\n"
+          << "GDS.Location1 = -2353.621251;\n"
+          << "GDS.Location2 = -4641.341542;\n"
+          << "GDS.Location3 = 3677.052370;\n"
+          << "GDS.Id = 'GDS';\n"
+          << "GDS.AddHardware = {Transmitter1, Receiver1, Antenna1};\n"
+          << "GDS.MinimumElevationAngle = 0;\n"
+          << "GDS.ErrorModels = {RangeModel};\n\n"
+          << "Create ErrorModel RangeModel;\n"
+          << "RangeModel.Type = 'Range';\n"
+          << "RangeModel.NoiseSigma = 0.010;\n\n"
+          << "Create TrackingFileSet simData;\n"
+          << "simData.AddTrackingConfig = {{GDS, SimSat, GDS}, 'Range'};\n"
+          << "simData.FileName = {'" << ScenarioRunner::REPORT_PATH
+          << "MeasurementCache.gmd'};\n"
+          << "simData.UseLightTime = True;\n\n"
+          << "Create ForceModel ODProp_ForceModel;\n"
+          << "ODProp_ForceModel.CentralBody = Earth;\n"
+          << "ODProp_ForceModel.PointMasses = {Earth};\n"
+          << "ODProp_ForceModel.Drag = None;\n"
+          << "ODProp_ForceModel.SRP = Off;\n"
+          << "ODProp_ForceModel.ErrorControl = None;\n\n"
+          << "Create Propagator ODProp;\n"
+          << "ODProp.FM = ODProp_ForceModel;\n"
+          << "ODProp.Type = 'RungeKutta56';\n"
+          << "ODProp.InitialStepSize = 60;\n"
+          << "ODProp.Accuracy = 1e-13;\n"
+          << "ODProp.MinStep = 0;\n"
+          << "ODProp.MaxStep = 60;\n\n"
+          << "Create Simulator sim;\n"
+          << "sim.AddData = {simData};\n"
+          << "sim.EpochFormat = 'UTCGregorian';\n"
+          << "sim.InitialEpoch = '10 Jun 2010 00:00:00.000';\n"
+          << "sim.FinalEpoch = '10 Jun 2010 00:10:00.000';\n"
+          << "sim.MeasurementTimeStep = 60;\n"
+          << "sim.Propagator = ODProp;\n"
+          << "sim.AddNoise = Off;\n\n"
+          << "BeginMissionSequence;\n"
+          << "RunSimulator sim;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// TrackingDataAdapter* FindAdapter()
+//------------------------------------------------------------------------------
+/**
+ * Finds the Range adapter of the sandbox copy of simData
+ */
+//------------------------------------------------------------------------------
+TrackingDataAdapter* FindAdapter()
+{
+   TrackingFileSet *tfs = dynamic_cast<TrackingFileSet*>(
+         Moderator::Instance()->GetInternalObject("simData"));
+   if (tfs == NULL)
+      throw GmatBaseException("The sandbox TrackingFileSet simData was not "
+            "found");
+
+   std::vector<TrackingDataAdapter*> *adapters = tfs->GetAdapters();
+   if (adapters->empty() || ((*adapters)[0] == NULL))
+      throw GmatBaseException("simData does not hold a Range adapter");
+
+   return (*adapters)[0];
+}
+
+
+//------------------------------------------------------------------------------
+// long long GetHits()
+//------------------------------------------------------------------------------
+/**
+ * Reads the profiler counter incremented on every cache hit
+ */
+//------------------------------------------------------------------------------
+long long GetHits()
+{
+   return RunProfiler::Instance()->GetCount("Measurement Cache Hits");
+}
+
+
+//------------------------------------------------------------------------------
+// Real Request(TrackingDataAdapter *adapter, UnsignedInt version,
+//       ObservationData *obs, bool &hit, bool withEvents = false,
+//       bool forSimulation = false)
+//------------------------------------------------------------------------------
+/**
+ * Requests the measurement through the cache
+ *
+ * @param hit Set to true if the request was served from the cache
+ *
+ * @return The range value
+ */
+//------------------------------------------------------------------------------
+Real Request(TrackingDataAdapter *adapter, UnsignedInt version,
+      ObservationData *obs, bool &hit, bool withEvents = false,
+      bool forSimulation = false)
+{
+   long long before = GetHits();
+   const MeasurementData &result = adapter->CalculateCachedMeasurement(
+         version, withEvents, obs, NULL, forSimulation);
+   hit = (GetHits() > before);
+
+   if (result.value.empty())
+      throw GmatBaseException("The Range adapter returned no value");
+   return result.value[0];
+}
+
+
+//------------------------------------------------------------------------------
+// Real Direct(TrackingDataAdapter *adapter, ObservationData *obs)
+//------------------------------------------------------------------------------
+/**
+ * Calculates the measurement without the cache
+ */
+//------------------------------------------------------------------------------
+Real Direct(TrackingDataAdapter *adapter, ObservationData *obs)
+{
+   const MeasurementData &result = adapter->CalculateMeasurement(false, obs);
+   if (result.value.empty())
+      throw GmatBaseException("The Range adapter returned no value");
+   return result.value[0];
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "MeasurementCache");
+   runner.Initialize();
+   runner.Run("Simulation", BuildScript());
+
+   TrackingDataAdapter *adapter = FindAdapter();
+   SpaceObject *sat = dynamic_cast<SpaceObject*>(
+         Moderator::Instance()->GetInternalObject("SimSat"));
+   if (sat == NULL)
+      throw GmatBaseException("The sandbox spacecraft SimSat was not found");
+   Integer id = sat->GetEstimationParameterID("CartesianX");
+
+   // One observation at the spacecraft epoch
+   ObservationData obs;
+   obs.epochGT = sat->GetEpochGT();
+   obs.epoch = obs.epochGT.GetMjd();
+
+   RunProfiler *profiler = RunProfiler::Instance();
+   profiler->Reset();
+   profiler->SetEnabled(true);
+
+   UnsignedInt version = 1;
+   bool hit;
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Repeated requests");
+   //---------------------------------------------------------------------------
+   adapter->ClearResultCache();
+   Real first = Request(adapter, version, &obs, hit);
+   out.Put("   First request is calculated:");
+   out.Validate(hit, false);
+   Real repeat = Request(adapter, version, &obs, hit);
+   out.Put("   Repeated request is a cache hit:");
+   out.Validate(hit, true);
+   out.Put("   Repeated range (km):", repeat);
+   out.Validate(repeat, first, 0.0);
+
+   long long before = GetHits();
+   const std::vector<RealArray> &derivs =
+         adapter->CalculateCachedDerivatives(version, sat, id);
+   RealArray firstRow = derivs[0];
+   out.Put("   First derivative request is calculated:");
+   out.Validate(GetHits() == before, true);
+   const std::vector<RealArray> &again =
+         adapter->CalculateCachedDerivatives(version, sat, id);
+   out.Put("   Repeated derivative request is a cache hit:");
+   out.Validate(GetHits() == before + 1, true);
+   out.Put("   Repeated derivative row is the same:");
+   out.Validate(&again == &derivs, true);
+   for (UnsignedInt j = 0; j < firstRow.size(); ++j)
+      out.Validate(again[0][j], firstRow[j], 0.0);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== State changes");
+   //---------------------------------------------------------------------------
+   Real *state = sat->GetState().GetState();
+   for (Integer i = 0; i < 3; ++i)
+      state[i] += STATE_OFFSET;
+
+   Real stale = Request(adapter, version, &obs, hit);
+   out.Put("   Moved spacecraft at the same version is a cache hit:");
+   out.Validate(hit, true);
+   out.Validate(stale, first, 0.0);
+
+   ++version;
+   Real moved = Request(adapter, version, &obs, hit);
+   out.Put("   Moved spacecraft at the next version is calculated:");
+   out.Validate(hit, false);
+   out.Put("   Range change (km):", moved - first);
+   out.Validate(fabs(moved - first) > 1.0e-3, true);
+   Real repeatMoved = Request(adapter, version, &obs, hit);
+   out.Put("   Repeated request at the next version is a cache hit:");
+   out.Validate(hit, true);
+   out.Validate(repeatMoved, moved, 0.0);
+
+   before = GetHits();
+   adapter->CalculateCachedDerivatives(version, sat, id);
+   out.Put("   Derivatives at the next version are calculated:");
+   out.Validate(GetHits() == before, true);
+
+   Real direct = Direct(adapter, &obs);
+   out.Put("   Cached range against a direct calculation:");
+   out.Validate(moved, direct, RANGE_TOLERANCE);
+
+   // The direct calculation replaced the model data, so start over
+   adapter->ClearResultCache();
+   for (Integer i = 0; i < 3; ++i)
+      state[i] -= STATE_OFFSET;
+   ++version;
+   Real restored = Request(adapter, version, &obs, hit);
+   out.Put("   Restored spacecraft gives the first range back:");
+   out.Validate(hit, false);
+   out.Validate(restored, first, RANGE_TOLERANCE);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Other requests");
+   //---------------------------------------------------------------------------
+   ObservationData copy(obs);
+   Request(adapter, version, &copy, hit);
+   out.Put("   Another observation record is calculated:");
+   out.Validate(hit, false);
+
+   copy.epochGT = copy.epochGT + 30.0 / GmatTimeConstants::SECS_PER_DAY;
+   copy.epoch = copy.epochGT.GetMjd();
+   Request(adapter, version, &copy, hit);
+   Request(adapter, version, &copy, hit);
+   out.Put("   Repeated request for the new record is a cache hit:");
+   out.Validate(hit, true);
+   copy.epochGT = obs.epochGT;
+   copy.epoch = obs.epoch;
+   Request(adapter, version, &copy, hit);
+   out.Put("   The same record at a new epoch is calculated:");
+   out.Validate(hit, false);
+
+   Request(adapter, version, &obs, hit);
+   Request(adapter, version, &obs, hit, true);
+   out.Put("   A request with events is calculated:");
+   out.Validate(hit, false);
+
+   Request(adapter, version, &obs, hit, false, true);
+   Request(adapter, version, &obs, hit, false, true);
+   out.Put("   Repeated simulation requests are calculated:");
+   out.Validate(hit, false);
+
+   Request(adapter, version, NULL, hit);
+   Request(adapter, version, NULL, hit);
+   out.Put("   Repeated requests without an observation are calculated:");
+   out.Validate(hit, false);
+
+   Request(adapter, version, &obs, hit);
+   adapter->ClearResultCache();
+   Request(adapter, version, &obs, hit);
+   out.Put("   A request after ClearResultCache() is calculated:");
+   out.Validate(hit, false);
+
+   profiler->SetEnabled(false);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== State versions");
+   //---------------------------------------------------------------------------
+   MeasurementManager measMan;
+   EstimationStateManager esm;
+   esm.SetMeasurementManager(&measMan);
+
+   UnsignedInt start = measMan.GetStateVersion();
+   measMan.AdvanceStateVersion();
+   out.Put("   AdvanceStateVersion() moves the version on:");
+   out.Validate(measMan.GetStateVersion() == start + 1, true);
+   esm.MapVectorToObjects();
+   out.Put("   MapVectorToObjects() moves the version on:");
+   out.Validate(measMan.GetStateVersion() == start + 2, true);
+   esm.RestoreObjects();
+   out.Put("   RestoreObjects() moves the version on:");
+   out.Validate(measMan.GetStateVersion() == start + 3, true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestMeasurementCacheOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the measurement cache!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
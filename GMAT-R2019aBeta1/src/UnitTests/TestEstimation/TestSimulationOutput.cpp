@@ -0,0 +1,267 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestSimulationOutput
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the threaded output of the Simulator.
+ *
+ * Simulates range and range rate data from two ground stations into two data
+ * files, first with the files written in line (Simulator.OutputThreads = 0)
+ * and then with one and with two output threads.  The test fails unless every
+ * threaded run writes the same files, line for line, as the in line run.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+
+using namespace std;
+
+/// The stations tracking the spacecraft; each one has its own data file
+static const char *STATIONS[2] = {"GDS", "MAD"};
+
+//------------------------------------------------------------------------------
+// std::string GetDataFile(Integer threads, Integer station)
+//------------------------------------------------------------------------------
+std::string GetDataFile(Integer threads, Integer station)
+{
+   std::stringstream name;
+   name << ScenarioRunner::REPORT_PATH << "SimulationOutput_" << threads
+        << "_" << STATIONS[station] << ".gmd";
+   return name.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(Integer threads)
+//------------------------------------------------------------------------------
+/**
+ * Builds a simulation script writing its data with the given thread count
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(Integer threads)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestSimulationOutput\n\n"
+          << "Create Spacecraft SimSat;\n"
+          << "SimSat.DateFormat = UTCGregorian;\n"
+          << "SimSat.Epoch = '10 Jun 2010 00:00:00.000';\n"
+          << "SimSat.CoordinateSystem = EarthMJ2000Eq;\n"
+          << "SimSat.DisplayStateType = Cartesian;\n"
+          << "SimSat.X = 576.869556;\n"
+          << "SimSat.Y = -5701.142761;\n"
+          << "SimSat.Z = -4170.593691;\n"
+          << "SimSat.VX = -1.76450794;\n"
+          << "SimSat.VY = 4.18128798;\n"
+          << "SimSat.VZ = -5.96578986;\n"
+          << "SimSat.Id = 'LEOSat';\n"
+          << "SimSat.AddHardware = {Transponder1, SpacecraftAntenna};\n\n"
+          << "Create Antenna SpacecraftAntenna;\n"
+          << "Create Transponder Transponder1;\n"
+          << "Transponder1.PrimaryAntenna = SpacecraftAntenna;\n"
+          << "Transponder1.HardwareDelay = 0.00005;\n"
+          << "Transponder1.TurnAroundRatio = '240/221';\n\n"
+          << "Create Transmitter Transmitter1;\n"
+          << "Create Antenna Antenna1;\n"
+          << "Create Receiver Receiver1;\n"
+          << "Transmitter1.PrimaryAntenna = Antenna1;\n"
+          << "Transmitter1.Frequency = 2067.5;\n"
+          << "Receiver1.PrimaryAntenna = Antenna1;\n\n";
+
+   const Real locations[2][3] = {
+         {-2353.621251, -4641.341542,  3677.052370},
+         { 4849.519988,  -360.641653,  4114.504590} };
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      std::string gs = STATIONS[i];
+      script << "Create GroundStation " << gs << ";\n"
+             << gs << ".CentralBody = Earth;\n"
+             << gs << ".StateType = Cartesian;\n"
+             << gs << ".HorizonReference = Ellipsoid;\n"
+             << gs << ".Location1 = " << locations[i][0] << ";\n"
+             << gs << ".Location2 = " << locations[i][1] << ";\n"
+             << gs << ".Location3 = " << locations[i][2] << ";\n"
+             << gs << ".Id = '" << gs << "';\n"
+             << gs << ".AddHardware = {Transmitter1, Receiver1, Antenna1};\n"
+             << gs << ".MinimumElevationAngle = 10;\n"
+             << gs << ".ErrorModels = {RangeModel, RangeRateModel};\n\n"
+             << "Create TrackingFileSet " << gs << "Data;\n"
+             << gs << "Data.AddTrackingConfig = {{" << gs << ", SimSat, "
+             << gs << "}, 'Range', 'RangeRate'};\n"
+             << gs << "Data.FileName = {'" << GetDataFile(threads, i)
+             << "'};\n"
+             << gs << "Data.UseLightTime = True;\n"
+             << gs << "Data.SimRangeModuloConstant = 67108864;\n"
+             << gs << "Data.SimDopplerCountInterval = 10.;\n\n";
+   }
+
+   script << "Create ErrorModel RangeModel;\n"
+          << "RangeModel.Type = 'Range';\n"
+          << "RangeModel.NoiseSigma = 0.010;\n"
+          << "Create ErrorModel RangeRateModel;\n"
+          << "RangeRateModel.Type = 'RangeRate';\n"
+          << "RangeRateModel.NoiseSigma = 0.00001;\n\n"
+          << "Create ForceModel ODProp_ForceModel;\n"
+          << "ODProp_ForceModel.CentralBody = Earth;\n"
+          << "ODProp_ForceModel.PointMasses = {Earth};\n"
+          << "ODProp_ForceModel.Drag = None;\n"
+          << "ODProp_ForceModel.SRP = Off;\n"
+          << "ODProp_ForceModel.ErrorControl = None;\n\n"
+          << "Create Propagator ODProp;\n"
+          << "ODProp.FM = ODProp_ForceModel;\n"
+          << "ODProp.Type = 'RungeKutta56';\n"
+          << "ODProp.InitialStepSize = 60;\n"
+          << "ODProp.Accuracy = 1e-13;\n"
+          << "ODProp.MinStep = 0;\n"
+          << "ODProp.MaxStep = 60;\n\n"
+          << "Create Simulator sim;\n"
+          << "sim.AddData = {GDSData, MADData};\n"
+          << "sim.EpochFormat = 'UTCGregorian';\n"
+          << "sim.InitialEpoch = '10 Jun 2010 00:00:00.000';\n"
+          << "sim.FinalEpoch = '10 Jun 2010 12:00:00.000';\n"
+          << "sim.MeasurementTimeStep = 60;\n"
+          << "sim.Propagator = ODProp;\n"
+          << "sim.AddNoise = Off;\n"
+          << "sim.OutputThreads = " << threads << ";\n\n"
+          << "BeginMissionSequence;\n"
+          << "RunSimulator sim;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CompareFiles(const std::string &testFile,
+//       const std::string &refFile)
+//------------------------------------------------------------------------------
+/**
+ * Compares two data files line by line
+ *
+ * @return The number of lines in the files
+ */
+//------------------------------------------------------------------------------
+Integer CompareFiles(const std::string &testFile, const std::string &refFile)
+{
+   std::ifstream test(testFile.c_str()), ref(refFile.c_str());
+   if (!test || !ref)
+      throw GmatBaseException("The data files " + testFile + " and " +
+            refFile + " were not both written");
+
+   std::string testLine, refLine;
+   Integer lines = 0;
+   while (true)
+   {
+      bool testRead = (bool)std::getline(test, testLine);
+      bool refRead = (bool)std::getline(ref, refLine);
+      if (!testRead && !refRead)
+         break;
+
+      ++lines;
+      if ((testRead != refRead) || (testLine != refLine))
+      {
+         std::stringstream msg;
+         msg << testFile << " differs from " << refFile << " at line "
+             << lines;
+         throw GmatBaseException(msg.str());
+      }
+   }
+
+   return lines;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "SimulationOutput");
+   runner.Initialize();
+
+   const Integer threadCounts[3] = {0, 1, 2};
+   for (Integer i = 0; i < 3; ++i)
+   {
+      //------------------------------------------------------------------------
+      std::stringstream title;
+      title << "\n======================================== " << threadCounts[i]
+            << " output thread(s)";
+      out.Put(title.str());
+      //------------------------------------------------------------------------
+      std::stringstream name;
+      name << "Threads" << threadCounts[i];
+      runner.Run(name.str(), BuildScript(threadCounts[i]));
+   }
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Comparison");
+   //---------------------------------------------------------------------------
+   for (Integer i = 1; i < 3; ++i)
+   {
+      for (Integer j = 0; j < 2; ++j)
+      {
+         out.Put(std::string("   ") + STATIONS[j] + " data with threads:",
+               threadCounts[i]);
+         Integer lines = CompareFiles(GetDataFile(threadCounts[i], j),
+               GetDataFile(0, j));
+         out.Put("   Lines matching the in line output:", lines);
+         out.Validate(lines > 1, true);
+      }
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestSimulationOutputOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of threaded simulation "
+            "output!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,551 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestEventLocator
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the eclipse and contact locators.
+ *
+ * Runs the eclipse and station contact sample scripts with the SPICE geometry
+ * finder and with the in-memory search (UseNativeSearch), and fails unless
+ * the two reports list the same events at times that agree to within
+ * MAX_NATIVE_TIME_DIFF.  Stellar aberration is turned off in both runs,
+ * because the in-memory search hands that correction back to SPICE.
+ *
+ * Then runs the contact search for several stations on one thread and on
+ * SEARCH_THREAD_COUNT threads, and fails unless the reports are identical.
+ *
+ * Finally checks the speed bounds of the in-memory search.  With a step of
+ * SHORT_EVENT_STEP, longer than every pass in the contact sample, the search
+ * must find the same passes as SPICE with a step of FINE_STEP.  With a step
+ * of FINE_STEP, it must use fewer than MAX_SAMPLE_FRACTION of the event
+ * function evaluations a fixed step scan would need.
+ *
+ * Last, writes the contact sample trajectory to a Chebyshev ephemeris file,
+ * then reruns the search on that file (TrajectoryFile) from a mission that
+ * propagates a different orbit, and fails unless the passes agree to within
+ * MAX_NATIVE_TIME_DIFF.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <set>
+#include <cmath>
+#include <cstdlib>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
+
+using namespace std;
+
+/// Location of the sample scripts used by the tests
+static const std::string SAMPLE_PATH = "../../../application/samples/";
+/// Allowed difference (s) between SPICE and in-memory event times
+static const Real MAX_NATIVE_TIME_DIFF = 1.0;
+/// Number of threads used for the multithreaded contact search
+static const Integer SEARCH_THREAD_COUNT = 4;
+/// Search step (s) of the reference SPICE contact search
+static const Real FINE_STEP = 10.0;
+/// Search step (s) longer than the passes in the contact sample
+static const Real SHORT_EVENT_STEP = 1800.0;
+/// Propagation span (days) of the contact sample
+static const Real CONTACT_SPAN_DAYS = 5.0;
+/// Largest allowed ratio of event function evaluations to fixed step samples
+static const Real MAX_SAMPLE_FRACTION = 0.1;
+/// Chebyshev ephemeris file holding the contact sample trajectory
+static const std::string TRAJECTORY_FILE =
+      ScenarioRunner::REPORT_PATH + "EventLocator_Trajectory.ceph";
+
+//------------------------------------------------------------------------------
+// std::string ReadSample(const std::string &fileName,
+//       const std::string &overrides)
+//------------------------------------------------------------------------------
+/**
+ * Reads a sample script, drops its plots, and adds resource settings ahead of
+ * the mission sequence
+ *
+ * @param fileName  The sample script
+ * @param overrides Script lines setting the fields used by the test
+ *
+ * @return The script text
+ */
+//------------------------------------------------------------------------------
+std::string ReadSample(const std::string &fileName,
+      const std::string &overrides)
+{
+   std::ifstream sample((SAMPLE_PATH + fileName).c_str());
+   if (!sample)
+      throw GmatBaseException("Cannot open the sample script " + fileName);
+
+   std::set<std::string> plots;
+   std::stringstream script;
+   std::string line;
+   while (std::getline(sample, line))
+   {
+      std::istringstream words(line);
+      std::string word, type, name;
+      words >> word;
+
+      if (word == "Create")
+      {
+         words >> type >> name;
+         if ((type == "OrbitView") || (type == "GroundTrackPlot"))
+         {
+            plots.insert(name.substr(0, name.find(';')));
+            continue;
+         }
+      }
+      if (word == "GMAT")
+         words >> word;
+      if (plots.count(word.substr(0, word.find('.'))) > 0)
+         continue;
+
+      if (word.find("BeginMissionSequence") == 0)
+         script << overrides << "\n";
+      script << line << "\n";
+   }
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// bool ParseTime(const std::string &token, Real &seconds)
+//------------------------------------------------------------------------------
+/**
+ * Converts an hh:mm:ss.sss report token to seconds of the day
+ */
+//------------------------------------------------------------------------------
+bool ParseTime(const std::string &token, Real &seconds)
+{
+   Integer hours, minutes;
+   Real    secs;
+   char    sep1, sep2;
+   std::istringstream time(token);
+   if (!(time >> hours >> sep1 >> minutes >> sep2 >> secs) || (sep1 != ':') ||
+       (sep2 != ':'))
+      return false;
+
+   seconds = 3600.0 * hours + 60.0 * minutes + secs;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real CompareReports(const std::string &name, const std::string &fileA,
+//       const std::string &fileB)
+//------------------------------------------------------------------------------
+/**
+ * Compares two locator reports
+ *
+ * Text must match exactly; times of day and numbers may differ, and the
+ * largest difference is returned.
+ *
+ * @return The largest difference between the times and numbers in the reports
+ */
+//------------------------------------------------------------------------------
+Real CompareReports(const std::string &name, const std::string &fileA,
+      const std::string &fileB)
+{
+   std::ifstream reportA(fileA.c_str()), reportB(fileB.c_str());
+   if (!reportA || !reportB)
+      throw GmatBaseException("The " + name + " reports were not written");
+
+   Real maxDiff = 0.0;
+   std::string lineA, lineB;
+   Integer lineNumber = 0;
+   while (true)
+   {
+      bool moreA = (bool)std::getline(reportA, lineA);
+      bool moreB = (bool)std::getline(reportB, lineB);
+      ++lineNumber;
+      if (!moreA && !moreB)
+         break;
+
+      std::stringstream where;
+      where << "Line " << lineNumber << " of the " << name << " reports ";
+      if (moreA != moreB)
+         throw GmatBaseException(where.str() + "exists in only one report");
+
+      std::istringstream tokensA(lineA), tokensB(lineB);
+      std::string a, b;
+      while (true)
+      {
+         bool haveA = (bool)(tokensA >> a);
+         bool haveB = (bool)(tokensB >> b);
+         if (!haveA && !haveB)
+            break;
+         if (haveA != haveB)
+            throw GmatBaseException(where.str() + "differs:\n   " + lineA +
+                  "\n   " + lineB);
+
+         Real valueA, valueB;
+         char *endA, *endB;
+         bool isTime = ParseTime(a, valueA) && ParseTime(b, valueB);
+         if (!isTime)
+         {
+            valueA = strtod(a.c_str(), &endA);
+            valueB = strtod(b.c_str(), &endB);
+            if ((*endA != '\0') || (*endB != '\0') || (endA == a.c_str()))
+            {
+               if (a != b)
+                  throw GmatBaseException(where.str() + "differs:\n   " +
+                        lineA + "\n   " + lineB);
+               continue;
+            }
+         }
+
+         Real diff = fabs(valueA - valueB);
+         if (diff > maxDiff)
+            maxDiff = diff;
+      }
+   }
+
+   return maxDiff;
+}
+
+
+//------------------------------------------------------------------------------
+// void TestNativeSearch(TestOutput &out, ScenarioRunner &runner,
+//       const std::string &name, const std::string &sample,
+//       const std::string &locator)
+//------------------------------------------------------------------------------
+/**
+ * Runs a sample with the SPICE and in-memory searches and compares the reports
+ */
+//------------------------------------------------------------------------------
+void TestNativeSearch(TestOutput &out, ScenarioRunner &runner,
+      const std::string &name, const std::string &sample,
+      const std::string &locator)
+{
+   std::string spiceName = name + "SPICE", nativeName = name + "Native";
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      bool native = (i == 1);
+      std::string runName = (native ? nativeName : spiceName);
+      std::string overrides =
+            locator + ".Filename = '" + runner.GetReportFile(runName) + "';\n" +
+            locator + ".UseStellarAberration = false;\n" +
+            locator + ".UseNativeSearch = " + (native ? "true" : "false") +
+            ";\n";
+
+      out.Put(native ? "   In-memory search" : "   SPICE search");
+      runner.Run(runName, ReadSample(sample, overrides), false);
+   }
+
+   out.Put("   Largest time difference (s):");
+   out.Validate(CompareReports(name, runner.GetReportFile(spiceName),
+         runner.GetReportFile(nativeName)), 0.0, MAX_NATIVE_TIME_DIFF);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestSearchThreads(TestOutput &out, ScenarioRunner &runner)
+//------------------------------------------------------------------------------
+/**
+ * Runs the in-memory contact search for several stations on one thread and on
+ * SEARCH_THREAD_COUNT threads, and checks that the reports match exactly
+ */
+//------------------------------------------------------------------------------
+void TestSearchThreads(TestOutput &out, ScenarioRunner &runner)
+{
+   // Add stations so that there is a search for each thread
+   std::stringstream stations;
+   std::string observers = "myStation";
+   for (Integer i = 1; i < SEARCH_THREAD_COUNT; ++i)
+   {
+      std::stringstream name;
+      name << "Station" << i;
+      stations << "Create GroundStation " << name.str() << ";\n"
+               << name.str() << ".StateType = Spherical;\n"
+               << name.str() << ".Location1 = " << 40.0 - 25.0 * i << ";\n"
+               << name.str() << ".Location2 = " << 278.6 - 20.0 * i << ";\n"
+               << name.str() << ".Location3 = 0;\n";
+      observers += ", " + name.str();
+   }
+
+   std::string serialName = "ContactOneThread";
+   std::string threadedName = "ContactThreaded";
+   for (Integer i = 0; i < 2; ++i)
+   {
+      bool threaded = (i == 1);
+      std::string runName = (threaded ? threadedName : serialName);
+      std::stringstream overrides;
+      overrides << stations.str()
+                << "ContactLocator1.Observers = {" << observers << "};\n"
+                << "ContactLocator1.Filename = '"
+                << runner.GetReportFile(runName) << "';\n"
+                << "ContactLocator1.UseStellarAberration = false;\n"
+                << "ContactLocator1.UseNativeSearch = true;\n"
+                << "ContactLocator1.SearchThreads = "
+                << (threaded ? SEARCH_THREAD_COUNT : 1) << ";\n";
+
+      out.Put(threaded ? "   Threaded search" : "   Single thread search");
+      runner.Run(runName, ReadSample("Ex_R2015a_StationContactLocator.script",
+            overrides.str()), false);
+   }
+
+   out.Put("   Largest time difference (s):");
+   out.Validate(CompareReports("SearchThreads",
+         runner.GetReportFile(serialName),
+         runner.GetReportFile(threadedName)), 0.0, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer ReadContactDurations(const std::string &fileName,
+//       RealArray &durations)
+//------------------------------------------------------------------------------
+/**
+ * Reads the pass durations from a contact report
+ *
+ * @param fileName  The report file
+ * @param durations The duration of each pass, in seconds
+ *
+ * @return The number of passes
+ */
+//------------------------------------------------------------------------------
+Integer ReadContactDurations(const std::string &fileName, RealArray &durations)
+{
+   durations.clear();
+
+   std::ifstream report(fileName.c_str());
+   std::string line;
+   while (std::getline(report, line))
+   {
+      // Pass lines hold the start and stop times followed by the duration
+      std::istringstream tokens(line);
+      std::string token, last;
+      Integer times = 0;
+      Real seconds;
+      while (tokens >> token)
+      {
+         if (ParseTime(token, seconds))
+            ++times;
+         last = token;
+      }
+      if (times == 2)
+         durations.push_back(atof(last.c_str()));
+   }
+
+   return (Integer)durations.size();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string ContactOverrides(ScenarioRunner &runner,
+//       const std::string &name, bool native, Real stepSize)
+//------------------------------------------------------------------------------
+/**
+ * Builds the contact locator settings for a run of the contact sample
+ */
+//------------------------------------------------------------------------------
+std::string ContactOverrides(ScenarioRunner &runner, const std::string &name,
+      bool native, Real stepSize)
+{
+   std::stringstream overrides;
+   overrides << "ContactLocator1.Filename = '" << runner.GetReportFile(name)
+             << "';\n"
+             << "ContactLocator1.UseStellarAberration = false;\n"
+             << "ContactLocator1.UseNativeSearch = "
+             << (native ? "true" : "false") << ";\n"
+             << "ContactLocator1.StepSize = " << stepSize << ";\n";
+   return overrides.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void TestSpeedBounds(TestOutput &out, ScenarioRunner &runner)
+//------------------------------------------------------------------------------
+/**
+ * Checks that stepping over event-free spans neither misses passes shorter
+ * than the step nor scales with the span length
+ */
+//------------------------------------------------------------------------------
+void TestSpeedBounds(TestOutput &out, ScenarioRunner &runner)
+{
+   std::string sample = "Ex_R2015a_StationContactLocator.script";
+   std::string refName = "BoundsSPICE", shortName = "BoundsLongStep",
+               fineName = "BoundsFineStep";
+
+   out.Put("   SPICE search, reference step");
+   runner.Run(refName, ReadSample(sample,
+         ContactOverrides(runner, refName, false, FINE_STEP)), false);
+
+   RealArray durations;
+   Integer passes = ReadContactDurations(runner.GetReportFile(refName),
+         durations);
+   Real longest = 0.0;
+   for (UnsignedInt i = 0; i < durations.size(); ++i)
+      longest = (durations[i] > longest ? durations[i] : longest);
+   out.Put("   Reference passes found:");
+   out.Validate(passes > 0, true);
+   out.Put("   Every pass is shorter than the long step:");
+   out.Validate(longest < SHORT_EVENT_STEP, true);
+
+   //---------------------------------------------------------------------------
+   out.Put("   In-memory search, long step");
+   //---------------------------------------------------------------------------
+   runner.Run(shortName, ReadSample(sample,
+         ContactOverrides(runner, shortName, true, SHORT_EVENT_STEP)));
+   long long longStepCalls = RunProfiler::Instance()->GetCount(
+         "Event Function Evaluations");
+   out.Put("   Largest time difference (s):");
+   out.Validate(CompareReports("BoundsLongStep",
+         runner.GetReportFile(refName), runner.GetReportFile(shortName)), 0.0,
+         MAX_NATIVE_TIME_DIFF);
+
+   //---------------------------------------------------------------------------
+   out.Put("   In-memory search, reference step");
+   //---------------------------------------------------------------------------
+   runner.Run(fineName, ReadSample(sample,
+         ContactOverrides(runner, fineName, true, FINE_STEP)));
+   long long fineStepCalls = RunProfiler::Instance()->GetCount(
+         "Event Function Evaluations");
+   out.Put("   Largest time difference (s):");
+   out.Validate(CompareReports("BoundsFineStep",
+         runner.GetReportFile(refName), runner.GetReportFile(fineName)), 0.0,
+         MAX_NATIVE_TIME_DIFF);
+
+   Real fixedSamples = CONTACT_SPAN_DAYS * 86400.0 / FINE_STEP;
+   out.Put("   Event function evaluations, long step:     ",
+         (Real)longStepCalls);
+   out.Put("   Event function evaluations, reference step:",
+         (Real)fineStepCalls);
+   out.Put("   Evaluations per pass:                      ",
+         (Real)fineStepCalls / passes);
+   out.Put("   Fraction of the fixed step samples is below the limit:");
+   out.Put(fineStepCalls / fixedSamples);
+   out.Validate(fineStepCalls / fixedSamples < MAX_SAMPLE_FRACTION, true);
+}
+
+
+//------------------------------------------------------------------------------
+// void TestTrajectoryFile(TestOutput &out, ScenarioRunner &runner)
+//------------------------------------------------------------------------------
+/**
+ * Searches a trajectory saved to a Chebyshev ephemeris file, and checks that
+ * the passes match those found on the recorded trajectory
+ *
+ * The second mission propagates the spacecraft half an orbit away from the
+ * saved trajectory, so its passes only match if the file is searched.
+ */
+//------------------------------------------------------------------------------
+void TestTrajectoryFile(TestOutput &out, ScenarioRunner &runner)
+{
+   std::string sample = "Ex_R2015a_StationContactLocator.script";
+   std::string recordedName = "TrajectoryRecorded",
+               fileName = "TrajectoryFromFile";
+
+   std::string ephem =
+         "Create EphemerisFile TrajectoryEphem;\n"
+         "TrajectoryEphem.Spacecraft = GEOSat;\n"
+         "TrajectoryEphem.FileFormat = Chebyshev;\n"
+         "TrajectoryEphem.Filename = '" + TRAJECTORY_FILE + "';\n";
+
+   out.Put("   Recorded trajectory");
+   runner.Run(recordedName, ReadSample(sample, ephem +
+         ContactOverrides(runner, recordedName, true, FINE_STEP)), false);
+
+   out.Put("   Trajectory file");
+   runner.Run(fileName, ReadSample(sample,
+         ContactOverrides(runner, fileName, true, FINE_STEP) +
+         "GEOSat.TA = 279.88774933204861;\n"
+         "ContactLocator1.TrajectoryFile = '" + TRAJECTORY_FILE + "';\n"),
+         false);
+
+   out.Put("   Largest time difference (s):");
+   out.Validate(CompareReports("TrajectoryFile",
+         runner.GetReportFile(recordedName), runner.GetReportFile(fileName)),
+         0.0, MAX_NATIVE_TIME_DIFF);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "EventLocator");
+   runner.Initialize();
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Native eclipse search");
+   //---------------------------------------------------------------------------
+   TestNativeSearch(out, runner, "Eclipse", "Ex_R2015a_EclipseLocation.script",
+         "EclipseLocator1");
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Native contact search");
+   //---------------------------------------------------------------------------
+   TestNativeSearch(out, runner, "Contact",
+         "Ex_R2015a_StationContactLocator.script", "ContactLocator1");
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Contact search threads");
+   //---------------------------------------------------------------------------
+   TestSearchThreads(out, runner);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Search speed bounds");
+   //---------------------------------------------------------------------------
+   TestSpeedBounds(out, runner);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Trajectory file search");
+   //---------------------------------------------------------------------------
+   TestTrajectoryFile(out, runner);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestEventLocatorOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the event locators!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
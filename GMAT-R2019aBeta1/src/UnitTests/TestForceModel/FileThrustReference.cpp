@@ -0,0 +1,955 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           FileThrustReference
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2015 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Developed jointly by NASA/GSFC and Thinking Systems, Inc. under the FDSS II
+// contract, Task Order 08
+//
+// Author: Darrel J. Conway, Thinking Systems, Inc.
+// Created: Jan 13, 2016
+/**
+ * The thrust history lookup and interpolation of the FileThrust class as it
+ * was before the ThfDataSegment interpolating polynomials were added, renamed
+ * so that TestThrustHistoryInterpolation can compare the two.
+ */
+//------------------------------------------------------------------------------
+
+#include "FileThrustReference.hpp"
+
+#include "MessageInterface.hpp"
+#include "TimeTypes.hpp"
+#include "ODEModelException.hpp"
+#include <sstream>
+
+
+//#define DEBUG_INTERPOLATION
+//#define DEBUG_MASS_FLOW
+
+//------------------------------------------------------------------------------
+// FileThrustReference(std::vector<ThrustSegment> *segs)
+//------------------------------------------------------------------------------
+/**
+ * Constructor
+ *
+ * @param segs The segment data from the thrust history file
+ */
+//------------------------------------------------------------------------------
+FileThrustReference::FileThrustReference(std::vector<ThrustSegment> *segs) :
+   segments                (segs),
+   massFlowWarningNeeded   (true),
+   depleteMass             (false),
+   spliner                 (NULL),
+   warnTooFewPoints        (true)
+{
+   for (Integer i = 0; i < 7; ++i)
+      dataBlock[i] = 0.0;
+   for (Integer i = 0; i < 5; ++i)
+      interpolatorData[i] = 0;
+   indexPair[0] = indexPair[1] = -1;
+}
+
+//------------------------------------------------------------------------------
+// ~FileThrustReference()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+FileThrustReference::~FileThrustReference()
+{
+   if (spliner != NULL)
+      delete spliner;
+}
+
+//------------------------------------------------------------------------------
+// void ComputeAccelerationMassFlow(const GmatEpoch atEpoch, Real burnData[4])
+//------------------------------------------------------------------------------
+/**
+ * Retrieves dv data at a specified epoch from data in the thrust history file
+ *
+ * @param atEpoch The epoch of the data request
+ * @param burnData The container receiving the acceleration and mass flow
+ */
+//------------------------------------------------------------------------------
+void FileThrustReference::ComputeAccelerationMassFlow(const GmatEpoch atEpoch,
+      Real burnData[4])
+{
+   // Start from nothin'
+   burnData[0] = burnData[1] = burnData[2] = burnData[3] = 0.0;
+
+   Real scaleFactors[2];
+
+   // Find the segment with data covering the input epoch.  Note that if
+   // segments overlap, we use the data in the first segment covering the epoch
+   Integer index = -1;
+   for (UnsignedInt i = 0; i < segments->size(); ++i)
+   {
+      if (((*segments)[i].segData.startEpoch <= atEpoch) &&
+            ((*segments)[i].segData.endEpoch >= atEpoch))
+      {
+         index = i;
+         (*segments)[i].GetScaleFactors(scaleFactors);
+
+         // Thrust Scale Factor Solve For
+         scaleFactors[0] *= (1.0 + (*segments)[i].GetRealParameter("TSF_Epsilon"));
+
+         break;
+      }
+   }
+
+   if (index != -1)
+   {
+      dataBlock[5] = (*segments)[index].segData.accelIntType;
+      dataBlock[6] = (*segments)[index].segData.massIntType;
+
+      // Interpolate the thrust/acceleration
+      GetSegmentData(index, atEpoch);
+      switch ((Integer)dataBlock[5])
+      {
+      case ThfDataSegment::LINEAR:
+         LinearInterpolate(index, atEpoch);
+         #ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Thrust/Acceleration: Linear Interpolation "
+                     "-> VXdot = %.12le\n", dataBlock[0] * scaleFactors[0]);
+         #endif
+         burnData[0] = dataBlock[0] * scaleFactors[0];
+         burnData[1] = dataBlock[1] * scaleFactors[0];
+         burnData[2] = dataBlock[2] * scaleFactors[0];
+         break;
+
+      case ThfDataSegment::SPLINE:
+         SplineInterpolate(index, atEpoch);
+         #ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Thrust/Acceleration: Spline Interpolation "
+                     "-> VXdot = %.12le\n", dataBlock[0] * scaleFactors[0]);
+         #endif
+         burnData[0] = dataBlock[0] * scaleFactors[0];
+         burnData[1] = dataBlock[1] * scaleFactors[0];
+         burnData[2] = dataBlock[2] * scaleFactors[0];
+         break;
+
+      case ThfDataSegment::NONE:
+      default:
+         #ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Thrust/Acceleration: No Interpolation "
+                     "-> VXdot = %.12le\n", dataBlock[0] * scaleFactors[0]);
+         #endif
+         burnData[0] = dataBlock[0] * scaleFactors[0];
+         burnData[1] = dataBlock[1] * scaleFactors[0];
+         burnData[2] = dataBlock[2] * scaleFactors[0];
+         break;
+      }
+
+      if (dataBlock[5] == dataBlock[6])
+      {
+         burnData[3] = dataBlock[3] * scaleFactors[1];
+      }
+      else
+      {
+         // Interpolate the mass flow, using data already collected
+         switch ((Integer)dataBlock[6])
+         {
+         case ThfDataSegment::LINEAR:
+            LinearInterpolate(index, atEpoch);
+            #ifdef DEBUG_INTERPOLATION
+               MessageInterface::ShowMessage("Mass Flow: Linear Interpolation "
+                     "-> Mdot = %.12le\n", dataBlock[3] * scaleFactors[1]);
+            #endif
+            burnData[3] = dataBlock[3] * scaleFactors[1];
+            break;
+
+         case ThfDataSegment::SPLINE:
+            SplineInterpolate(index, atEpoch);
+            #ifdef DEBUG_INTERPOLATION
+               MessageInterface::ShowMessage("Mass Flow: Spline Interpolation "
+                     "-> Mdot = %.12le\n", dataBlock[3] * scaleFactors[1]);
+            #endif
+            burnData[3] = dataBlock[3] * scaleFactors[1];
+            break;
+
+         case ThfDataSegment::NONE:
+         default:
+            #ifdef DEBUG_INTERPOLATION
+               MessageInterface::ShowMessage("Mass Flow: No Interpolation "
+                     "-> Mdot = %.12le\n", dataBlock[3] * scaleFactors[1]);
+            #endif
+            burnData[3] = dataBlock[3] * scaleFactors[1];
+            break;
+         }
+      }
+
+      if (burnData[3] != 0.0)
+      {
+         #ifdef DEBUG_MASS_FLOW
+            MessageInterface::ShowMessage("Accessing segment %d at epoch "
+                  "%.12lf; [3] = %le\n", index, atEpoch, burnData[3]);
+            MessageInterface::ShowMessage("   %d mass sources\n",
+                  (*segments)[index].massSource.size());
+         #endif
+         if (segments->size() > index)
+         {
+            if ((*segments)[index].massSource.size() > 0)
+               activeTankName = (*segments)[index].massSource[0];
+            else
+            {
+               if (massFlowWarningNeeded)
+               {
+                  MessageInterface::ShowMessage("Warning: The Thrust History "
+                        "File force %s cannot deplete mass: no mass source "
+                        "is identified\n", "reference");
+                  massFlowWarningNeeded = false;
+               }
+               burnData[3] = 0.0;
+               depleteMass = false;
+               massFlowWarningNeeded = false;
+            }
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ComputeAccelerationMassFlow(const GmatEpoch atEpoch, Real burnData[4])
+//------------------------------------------------------------------------------
+/**
+* Retrieves dv data at a specified epoch from data in the thrust history file
+*
+* @param atEpoch The epoch of the data request
+* @param burnData The container receiving the acceleration and mass flow
+*/
+//------------------------------------------------------------------------------
+void FileThrustReference::ComputeAccelerationMassFlow(const GmatTime &atEpoch,
+   Real burnData[4])
+{
+   // Start from nothin'
+   burnData[0] = burnData[1] = burnData[2] = burnData[3] = 0.0;
+
+   Real scaleFactors[2];
+
+   // Find the segment with data covering the input epoch.  Note that if
+   // segments overlap, we use the data in the first segment covering the epoch
+   Integer index = -1;
+   for (UnsignedInt i = 0; i < segments->size(); ++i)
+   {
+      if (((*segments)[i].segData.startEpochGT <= atEpoch) &&
+         ((*segments)[i].segData.endEpochGT >= atEpoch))
+      {
+         index = i;
+         (*segments)[i].GetScaleFactors(scaleFactors);
+
+         // Thrust Scale Factor Solve For
+         scaleFactors[0] *= (1.0 + (*segments)[i].GetRealParameter("TSF_Epsilon"));
+
+         break;
+      }
+   }
+
+   if (index != -1)
+   {
+      dataBlock[5] = (*segments)[index].segData.accelIntType;
+      dataBlock[6] = (*segments)[index].segData.massIntType;
+
+      // Interpolate the thrust/acceleration
+      GetSegmentData(index, atEpoch);
+      switch ((Integer)dataBlock[5])
+      {
+      case ThfDataSegment::LINEAR:
+         LinearInterpolate(index, atEpoch);
+#ifdef DEBUG_INTERPOLATION
+         MessageInterface::ShowMessage("Thrust/Acceleration: Linear Interpolation "
+            "-> VXdot = %.12le\n", dataBlock[0] * scaleFactors[0]);
+#endif
+         burnData[0] = dataBlock[0] * scaleFactors[0];
+         burnData[1] = dataBlock[1] * scaleFactors[0];
+         burnData[2] = dataBlock[2] * scaleFactors[0];
+         break;
+
+      case ThfDataSegment::SPLINE:
+         SplineInterpolate(index, atEpoch);
+#ifdef DEBUG_INTERPOLATION
+         MessageInterface::ShowMessage("Thrust/Acceleration: Spline Interpolation "
+            "-> VXdot = %.12le\n", dataBlock[0] * scaleFactors[0]);
+#endif
+         burnData[0] = dataBlock[0] * scaleFactors[0];
+         burnData[1] = dataBlock[1] * scaleFactors[0];
+         burnData[2] = dataBlock[2] * scaleFactors[0];
+         break;
+
+      case ThfDataSegment::NONE:
+      default:
+#ifdef DEBUG_INTERPOLATION
+         MessageInterface::ShowMessage("Thrust/Acceleration: No Interpolation "
+            "-> VXdot = %.12le\n", dataBlock[0] * scaleFactors[0]);
+#endif
+         burnData[0] = dataBlock[0] * scaleFactors[0];
+         burnData[1] = dataBlock[1] * scaleFactors[0];
+         burnData[2] = dataBlock[2] * scaleFactors[0];
+         break;
+      }
+
+      if (dataBlock[5] == dataBlock[6])
+      {
+         burnData[3] = dataBlock[3] * scaleFactors[1];
+      }
+      else
+      {
+         // Interpolate the mass flow, using data already collected
+         switch ((Integer)dataBlock[6])
+         {
+         case ThfDataSegment::LINEAR:
+            LinearInterpolate(index, atEpoch);
+#ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Mass Flow: Linear Interpolation "
+               "-> Mdot = %.12le\n", dataBlock[3] * scaleFactors[1]);
+#endif
+            burnData[3] = dataBlock[3] * scaleFactors[1];
+            break;
+
+         case ThfDataSegment::SPLINE:
+            SplineInterpolate(index, atEpoch);
+#ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Mass Flow: Spline Interpolation "
+               "-> Mdot = %.12le\n", dataBlock[3] * scaleFactors[1]);
+#endif
+            burnData[3] = dataBlock[3] * scaleFactors[1];
+            break;
+
+         case ThfDataSegment::NONE:
+         default:
+#ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Mass Flow: No Interpolation "
+               "-> Mdot = %.12le\n", dataBlock[3] * scaleFactors[1]);
+#endif
+            burnData[3] = dataBlock[3] * scaleFactors[1];
+            break;
+         }
+      }
+
+      if (burnData[3] != 0.0)
+      {
+#ifdef DEBUG_MASS_FLOW
+         MessageInterface::ShowMessage("Accessing segment %d at epoch "
+            "%s; [3] = %le\n", index, atEpoch.ToString(), burnData[3]);
+         MessageInterface::ShowMessage("   %d mass sources\n",
+            (*segments)[index].massSource.size());
+#endif
+         if (segments->size() > index)
+         {
+            if ((*segments)[index].massSource.size() > 0)
+               activeTankName = (*segments)[index].massSource[0];
+            else
+            {
+               if (massFlowWarningNeeded)
+               {
+                  MessageInterface::ShowMessage("Warning: The Thrust History "
+                     "File force %s cannot deplete mass: no mass source "
+                     "is identified\n", "reference");
+                  massFlowWarningNeeded = false;
+               }
+               burnData[3] = 0.0;
+               depleteMass = false;
+               massFlowWarningNeeded = false;
+            }
+         }
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void GetSegmentData(Integer atIndex, GmatEpoch atEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the segment data for the segment containing the input epoch
+ *
+ * @param atIndex Index of the segment containing the data
+ * @param atEpoch The epoch of the requested data
+ */
+//------------------------------------------------------------------------------
+void FileThrustReference::GetSegmentData(Integer atIndex, GmatEpoch atEpoch)
+{
+   #ifdef DEBUG_INTERPOLATION
+      MessageInterface::ShowMessage("Entered GetSegmentData(%d, %.12lf)\n",
+            atIndex, atEpoch);
+   #endif
+
+   dataBlock[0] = dataBlock[1] = dataBlock[2] = dataBlock[3] = dataBlock[4] = 0.0;
+
+   // If at the end point; use its data
+   if ((*segments)[atIndex].segData.endEpoch == atEpoch)
+   {
+      Integer i = (*segments)[atIndex].segData.profile.size()-1;
+      dataBlock[0] = (*segments)[atIndex].segData.profile[i].vector[0];
+      dataBlock[1] = (*segments)[atIndex].segData.profile[i].vector[1];
+      dataBlock[2] = (*segments)[atIndex].segData.profile[i].vector[2];
+      dataBlock[3] = (*segments)[atIndex].segData.profile[i].mdot;
+      dataBlock[4] = (*segments)[atIndex].segData.profile[i].time;
+   }
+   else
+   {
+      Real offset = atEpoch - (*segments)[atIndex].segData.startEpoch;
+
+      switch ((Integer)dataBlock[5])
+      {
+      case ThfDataSegment::NONE:
+      case ThfDataSegment::LINEAR:
+         for (UnsignedInt i = 0; i < (*segments)[atIndex].segData.profile.size()-1; ++i)
+         {
+            if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+                ((*segments)[atIndex].segData.profile[i+1].time > offset))
+            {
+               dataBlock[0] = (*segments)[atIndex].segData.profile[i].vector[0];
+               dataBlock[1] = (*segments)[atIndex].segData.profile[i].vector[1];
+               dataBlock[2] = (*segments)[atIndex].segData.profile[i].vector[2];
+               if ((dataBlock[6] == ThfDataSegment::LINEAR) ||
+                   (dataBlock[6] == ThfDataSegment::NONE))
+                  dataBlock[3] = (*segments)[atIndex].segData.profile[i].mdot;
+               dataBlock[4] = (*segments)[atIndex].segData.profile[i].time;
+               break;
+            }
+         }
+         break;
+
+      case ThfDataSegment::SPLINE:
+         {
+            bool reload = false;
+            if (indexPair[0] != atIndex)
+               reload = true;
+            indexPair[0] = atIndex;
+            Integer proIndex = -1;
+
+            // Look up the profile index
+            for (UnsignedInt i = 0;
+                  i < (*segments)[atIndex].segData.profile.size()-1; ++i)
+            {
+               if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+                   ((*segments)[atIndex].segData.profile[i+1].time > offset))
+               {
+                  proIndex = i;
+                  break;
+               }
+            }
+
+            // Now set the indices for the buffer.  This code selects the region
+            // between the 2nd and 3rd points when possible.
+            if (proIndex == 0)
+               proIndex = 1;
+            else if (proIndex >
+                     (Integer)((*segments)[atIndex].segData.profile.size()) - 4)
+               proIndex = (*segments)[atIndex].segData.profile.size() - 4;
+
+            interpolatorData[0] = proIndex - 1;
+            interpolatorData[1] = proIndex;
+            interpolatorData[2] = proIndex + 1;
+            interpolatorData[3] = proIndex + 2;
+            interpolatorData[4] = proIndex + 3;
+         }
+         break;
+
+      default:
+         break;
+      }
+
+      // Setup for mass flow
+      switch ((Integer)dataBlock[6])
+      {
+      case ThfDataSegment::NONE:
+      case ThfDataSegment::LINEAR:
+         for (UnsignedInt i = 0;
+               i < (*segments)[atIndex].segData.profile.size()-1; ++i)
+         {
+            if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+                ((*segments)[atIndex].segData.profile[i+1].time > offset))
+            {
+               dataBlock[3] = (*segments)[atIndex].segData.profile[i].mdot;
+               break;
+            }
+         }
+         break;
+
+      case ThfDataSegment::SPLINE:
+         if ((*segments)[atIndex].segData.accelIntType != ThfDataSegment::SPLINE)
+         {
+            bool reload = false;
+            if (indexPair[0] != atIndex)
+               reload = true;
+            indexPair[0] = atIndex;
+            Integer proIndex = -1;
+
+            // Look up the profile index
+            for (UnsignedInt i = 0;
+                  i < (*segments)[atIndex].segData.profile.size()-1; ++i)
+            {
+               if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+                   ((*segments)[atIndex].segData.profile[i+1].time > offset))
+               {
+                  proIndex = i;
+                  break;
+               }
+            }
+
+            // Now set the indices for the buffer.  This code selects the region
+            // between the 2nd and 3rd points when possible.
+            if (proIndex == 0)
+               proIndex = 1;
+            else if (proIndex >
+                     (Integer)((*segments)[atIndex].segData.profile.size()) - 4)
+               proIndex = (*segments)[atIndex].segData.profile.size() - 4;
+
+            interpolatorData[0] = proIndex - 1;
+            interpolatorData[1] = proIndex;
+            interpolatorData[2] = proIndex + 1;
+            interpolatorData[3] = proIndex + 2;
+            interpolatorData[4] = proIndex + 3;
+         }
+         break;
+
+      default:
+         break;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void GetSegmentData(Integer atIndex, GmatTime atEpoch)
+//------------------------------------------------------------------------------
+/**
+* Retrieves the segment data for the segment containing the input epoch
+*
+* @param atIndex Index of the segment containing the data
+* @param atEpoch The epoch of the requested data
+*/
+//------------------------------------------------------------------------------
+void FileThrustReference::GetSegmentData(Integer atIndex, const GmatTime &atEpoch)
+{
+#ifdef DEBUG_INTERPOLATION
+   MessageInterface::ShowMessage("Entered GetSegmentData(%d, %s)\n",
+      atIndex, atEpoch.ToString());
+#endif
+
+   dataBlock[0] = dataBlock[1] = dataBlock[2] = dataBlock[3] = dataBlock[4] = 0.0;
+
+   // If at the end point; use its data
+   if ((*segments)[atIndex].segData.endEpochGT == atEpoch)
+   {
+      Integer i = (*segments)[atIndex].segData.profile.size() - 1;
+      dataBlock[0] = (*segments)[atIndex].segData.profile[i].vector[0];
+      dataBlock[1] = (*segments)[atIndex].segData.profile[i].vector[1];
+      dataBlock[2] = (*segments)[atIndex].segData.profile[i].vector[2];
+      dataBlock[3] = (*segments)[atIndex].segData.profile[i].mdot;
+      dataBlock[4] = (*segments)[atIndex].segData.profile[i].time;
+   }
+   else
+   {
+      GmatTime offsetGT = atEpoch - (*segments)[atIndex].segData.startEpochGT;
+      Real offset = offsetGT.GetTimeInSec() / GmatTimeConstants::SECS_PER_DAY;
+
+      switch ((Integer)dataBlock[5])
+      {
+      case ThfDataSegment::NONE:
+      case ThfDataSegment::LINEAR:
+         for (UnsignedInt i = 0; i < (*segments)[atIndex].segData.profile.size() - 1; ++i)
+         {
+            if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+               ((*segments)[atIndex].segData.profile[i + 1].time > offset))
+            {
+               dataBlock[0] = (*segments)[atIndex].segData.profile[i].vector[0];
+               dataBlock[1] = (*segments)[atIndex].segData.profile[i].vector[1];
+               dataBlock[2] = (*segments)[atIndex].segData.profile[i].vector[2];
+               if ((dataBlock[6] == ThfDataSegment::LINEAR) ||
+                  (dataBlock[6] == ThfDataSegment::NONE))
+                  dataBlock[3] = (*segments)[atIndex].segData.profile[i].mdot;
+               dataBlock[4] = (*segments)[atIndex].segData.profile[i].time;
+               break;
+            }
+         }
+         break;
+
+      case ThfDataSegment::SPLINE:
+      {
+         bool reload = false;
+         if (indexPair[0] != atIndex)
+            reload = true;
+         indexPair[0] = atIndex;
+         Integer proIndex = -1;
+
+         // Look up the profile index
+         for (UnsignedInt i = 0;
+            i < (*segments)[atIndex].segData.profile.size() - 1; ++i)
+         {
+            if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+               ((*segments)[atIndex].segData.profile[i + 1].time > offset))
+            {
+               proIndex = i;
+               break;
+            }
+         }
+
+         // Now set the indices for the buffer.  This code selects the region
+         // between the 2nd and 3rd points when possible.
+         if (proIndex == 0)
+            proIndex = 1;
+         else if (proIndex >
+            (Integer)((*segments)[atIndex].segData.profile.size()) - 4)
+            proIndex = (*segments)[atIndex].segData.profile.size() - 4;
+
+         interpolatorData[0] = proIndex - 1;
+         interpolatorData[1] = proIndex;
+         interpolatorData[2] = proIndex + 1;
+         interpolatorData[3] = proIndex + 2;
+         interpolatorData[4] = proIndex + 3;
+      }
+      break;
+
+      default:
+         break;
+      }
+
+      // Setup for mass flow
+      switch ((Integer)dataBlock[6])
+      {
+      case ThfDataSegment::NONE:
+      case ThfDataSegment::LINEAR:
+         for (UnsignedInt i = 0;
+            i < (*segments)[atIndex].segData.profile.size() - 1; ++i)
+         {
+            if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+               ((*segments)[atIndex].segData.profile[i + 1].time > offset))
+            {
+               dataBlock[3] = (*segments)[atIndex].segData.profile[i].mdot;
+               break;
+            }
+         }
+         break;
+
+      case ThfDataSegment::SPLINE:
+         if ((*segments)[atIndex].segData.accelIntType != ThfDataSegment::SPLINE)
+         {
+            bool reload = false;
+            if (indexPair[0] != atIndex)
+               reload = true;
+            indexPair[0] = atIndex;
+            Integer proIndex = -1;
+
+            // Look up the profile index
+            for (UnsignedInt i = 0;
+               i < (*segments)[atIndex].segData.profile.size() - 1; ++i)
+            {
+               if ((offset >= (*segments)[atIndex].segData.profile[i].time) &&
+                  (offset < (*segments)[atIndex].segData.profile[i + 1].time))
+               {
+                  proIndex = i;
+                  break;
+               }
+            }
+
+            // Now set the indices for the buffer.  This code selects the region
+            // between the 2nd and 3rd points when possible.
+            if (proIndex == 0)
+               proIndex = 1;
+            else if (proIndex >
+               (Integer)((*segments)[atIndex].segData.profile.size()) - 4)
+               proIndex = (*segments)[atIndex].segData.profile.size() - 4;
+
+            interpolatorData[0] = proIndex - 1;
+            interpolatorData[1] = proIndex;
+            interpolatorData[2] = proIndex + 1;
+            interpolatorData[3] = proIndex + 2;
+            interpolatorData[4] = proIndex + 3;
+         }
+         break;
+
+      default:
+         break;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void LinearInterpolate(Integer atIndex, GmatEpoch atEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves linearly interpolated segment data for the input epoch
+ *
+ * @param atIndex Index of the segment containing the data
+ * @param atEpoch The epoch of the requested data
+ */
+//------------------------------------------------------------------------------
+void FileThrustReference::LinearInterpolate(Integer atIndex, GmatEpoch atEpoch)
+{
+   GetSegmentData(atIndex, atEpoch);
+   bool includeMass = false;
+
+   if ((*segments)[atIndex].segData.endEpoch == atEpoch)
+   {
+      return;
+   }
+
+   Real offset = atEpoch - (*segments)[atIndex].segData.startEpoch;
+   for (UnsignedInt i = 0; i < (*segments)[atIndex].segData.profile.size()-1; ++i)
+   {
+      if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+          ((*segments)[atIndex].segData.profile[i+1].time > offset))
+      {
+         dataSet[0][0] = dataBlock[0];
+         dataSet[0][1] = dataBlock[1];
+         dataSet[0][2] = dataBlock[2];
+         dataSet[0][3] = dataBlock[3];
+         dataSet[0][4] = (*segments)[atIndex].segData.profile[i].time;
+
+         dataSet[1][0] = (*segments)[atIndex].segData.profile[i+1].vector[0];
+         dataSet[1][1] = (*segments)[atIndex].segData.profile[i+1].vector[1];
+         dataSet[1][2] = (*segments)[atIndex].segData.profile[i+1].vector[2];
+         dataSet[1][3] = (*segments)[atIndex].segData.profile[i+1].mdot;
+         dataSet[1][4] = (*segments)[atIndex].segData.profile[i+1].time;
+         break;
+      }
+   }
+
+   Real pct = 0.0;
+   if ((dataSet[1][4] != dataSet[0][4]))
+      pct = (offset - dataSet[0][4]) / (dataSet[1][4] - dataSet[0][4]);
+
+   if (dataBlock[5] == ThfDataSegment::LINEAR)
+   {
+      dataBlock[0] = dataSet[0][0] + pct * (dataSet[1][0] - dataSet[0][0]);
+      dataBlock[1] = dataSet[0][1] + pct * (dataSet[1][1] - dataSet[0][1]);
+      dataBlock[2] = dataSet[0][2] + pct * (dataSet[1][2] - dataSet[0][2]);
+   }
+   if (dataBlock[6] == ThfDataSegment::LINEAR)
+      dataBlock[3] = dataSet[0][3] + pct * (dataSet[1][3] - dataSet[0][3]);
+
+   #ifdef DEBUG_INTERPOLATION
+      MessageInterface::ShowMessage("Linear Interpolating to offset %.12lf "
+            "using t, vector, mdot:\n", offset);
+      MessageInterface::ShowMessage("   %.12lf [%.12le  %.12le  %.12le] "
+            "%.12le\n   %.12lf [%.12le  %.12le  %.12le] %.12le\n",
+            dataSet[0][4], dataSet[0][0], dataSet[0][1], dataSet[0][2],
+            dataSet[0][3], dataSet[1][4], dataSet[1][0], dataSet[1][1],
+            dataSet[1][2], dataSet[1][3]);
+
+      MessageInterface::ShowMessage("-> %.12lf [%.12le  %.12le  %.12le] "
+            "%.12le\n", offset, dataBlock[0], dataBlock[1], dataBlock[2], dataBlock[3]);
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void LinearInterpolate(Integer atIndex, GmatTime atEpoch)
+//------------------------------------------------------------------------------
+/**
+* Retrieves linearly interpolated segment data for the input epoch
+*
+* @param atIndex Index of the segment containing the data
+* @param atEpoch The epoch of the requested data
+*/
+//------------------------------------------------------------------------------
+void FileThrustReference::LinearInterpolate(Integer atIndex, const GmatTime &atEpoch)
+{
+   GetSegmentData(atIndex, atEpoch);
+   bool includeMass = false;
+
+   if ((*segments)[atIndex].segData.endEpochGT == atEpoch)
+   {
+      return;
+   }
+   GmatTime offsetGT1 = atEpoch - (*segments)[atIndex].segData.startEpochGT;
+   Real offset = offsetGT1.GetTimeInSec() / GmatTimeConstants::SECS_PER_DAY;
+   for (UnsignedInt i = 0; i < (*segments)[atIndex].segData.profile.size() - 1; ++i)
+   {
+      if (((*segments)[atIndex].segData.profile[i].time <= offset) &&
+         ((*segments)[atIndex].segData.profile[i + 1].time > offset))
+      {
+         dataSet[0][0] = dataBlock[0];
+         dataSet[0][1] = dataBlock[1];
+         dataSet[0][2] = dataBlock[2];
+         dataSet[0][3] = dataBlock[3];
+         dataSet[0][4] = (*segments)[atIndex].segData.profile[i].time;
+
+         dataSet[1][0] = (*segments)[atIndex].segData.profile[i + 1].vector[0];
+         dataSet[1][1] = (*segments)[atIndex].segData.profile[i + 1].vector[1];
+         dataSet[1][2] = (*segments)[atIndex].segData.profile[i + 1].vector[2];
+         dataSet[1][3] = (*segments)[atIndex].segData.profile[i + 1].mdot;
+         dataSet[1][4] = (*segments)[atIndex].segData.profile[i + 1].time;
+         break;
+      }
+   }
+
+   Real pct = 0.0;
+   if ((dataSet[1][4] != dataSet[0][4]))
+      pct = (offset - dataSet[0][4]) / (dataSet[1][4] - dataSet[0][4]);
+
+   if (dataBlock[5] == ThfDataSegment::LINEAR)
+   {
+      dataBlock[0] = dataSet[0][0] + pct * (dataSet[1][0] - dataSet[0][0]);
+      dataBlock[1] = dataSet[0][1] + pct * (dataSet[1][1] - dataSet[0][1]);
+      dataBlock[2] = dataSet[0][2] + pct * (dataSet[1][2] - dataSet[0][2]);
+   }
+   if (dataBlock[6] == ThfDataSegment::LINEAR)
+      dataBlock[3] = dataSet[0][3] + pct * (dataSet[1][3] - dataSet[0][3]);
+
+#ifdef DEBUG_INTERPOLATION
+   MessageInterface::ShowMessage("Linear Interpolating to offset %s "
+      "using t, vector, mdot:\n", offsetGT.ToString());
+   MessageInterface::ShowMessage("   %.12lf [%.12le  %.12le  %.12le] "
+      "%.12le\n   %.12lf [%.12le  %.12le  %.12le] %.12le\n",
+      dataSet[0][4], dataSet[0][0], dataSet[0][1], dataSet[0][2],
+      dataSet[0][3], dataSet[1][4], dataSet[1][0], dataSet[1][1],
+      dataSet[1][2], dataSet[1][3]);
+
+   MessageInterface::ShowMessage("-> %s [%.12le  %.12le  %.12le] "
+      "%.12le\n", offsetGT, dataBlock[0], dataBlock[1], dataBlock[2], dataBlock[3]);
+#endif
+}
+
+
+//------------------------------------------------------------------------------
+// void SplineInterpolate(Integer atIndex, GmatEpoch atEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves spline interpolated segment data for the input epoch
+ *
+ * @param atIndex Index of the segment containing the data
+ * @param atEpoch The epoch of the requested data
+ */
+//------------------------------------------------------------------------------
+void FileThrustReference::SplineInterpolate(Integer atIndex, GmatEpoch atEpoch)
+{
+   // Handle case of too few points by falling back to linear interpolation
+   if ((*segments)[atIndex].segData.profile.size() < 5)
+   {
+      if (warnTooFewPoints)
+      {
+         MessageInterface::ShowMessage("Cannot perform spline interpolation: "
+               "the thrust history data segment contains %d points, but spline "
+               "interpolation requires at least 5.  Linear interpolation will "
+               "be applied instead.\n",
+               (*segments)[atIndex].segData.profile.size());
+         warnTooFewPoints = false;
+      }
+      LinearInterpolate(atIndex, atEpoch);
+   }
+
+   if (spliner == NULL)
+      spliner = new NotAKnotInterpolator("SplineInterpolator", 4);
+
+   if (spliner == NULL)
+      throw ODEModelException("The cubic spline interpolator failed to build");
+
+   Real data[4];
+   if (interpolatorData[1] == -1)
+   {
+      // Ouside of the span; do nothing
+      data[0] =
+      data[1] =
+      data[2] =
+      data[3] = 0.0;
+   }
+   else
+   {
+      // Reload the interpolator.  For now, this is done at each call.
+      spliner->Clear();
+      for (UnsignedInt i = 0; i < 5; ++i)
+      {
+         data[0] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[0];
+         data[1] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[1];
+         data[2] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[2];
+         data[3] = (*segments)[atIndex].segData.profile[interpolatorData[i]].mdot;
+
+         spliner->AddPoint((*segments)[atIndex].segData.profile[interpolatorData[i]].time, data);
+      }
+
+      Real offset = atEpoch - (*segments)[atIndex].segData.startEpoch;
+      spliner->Interpolate(offset, data);
+   }
+
+   if (dataBlock[5] == ThfDataSegment::SPLINE)
+   {
+      dataBlock[0] = data[0];
+      dataBlock[1] = data[1];
+      dataBlock[2] = data[2];
+   }
+   if (dataBlock[6] == ThfDataSegment::SPLINE)
+      dataBlock[3] = data[3];
+}
+
+
+//------------------------------------------------------------------------------
+// void SplineInterpolate(Integer atIndex, GmatTime atEpoch)
+//------------------------------------------------------------------------------
+/**
+* Retrieves spline interpolated segment data for the input epoch
+*
+* @param atIndex Index of the segment containing the data
+* @param atEpoch The epoch of the requested data
+*/
+//------------------------------------------------------------------------------
+void FileThrustReference::SplineInterpolate(Integer atIndex, const GmatTime &atEpoch)
+{
+   // Handle case of too few points by falling back to linear interpolation
+   if ((*segments)[atIndex].segData.profile.size() < 5)
+   {
+      if (warnTooFewPoints)
+      {
+         MessageInterface::ShowMessage("Cannot perform spline interpolation: "
+            "the thrust history data segment contains %d points, but spline "
+            "interpolation requires at least 5.  Linear interpolation will "
+            "be applied instead.\n",
+            (*segments)[atIndex].segData.profile.size());
+         warnTooFewPoints = false;
+      }
+      LinearInterpolate(atIndex, atEpoch);
+   }
+
+   if (spliner == NULL)
+      spliner = new NotAKnotInterpolator("SplineInterpolator", 4);
+
+   if (spliner == NULL)
+      throw ODEModelException("The cubic spline interpolator failed to build");
+
+   Real data[4];
+   if (interpolatorData[1] == -1)
+   {
+      // Ouside of the span; do nothing
+      data[0] =
+         data[1] =
+         data[2] =
+         data[3] = 0.0;
+   }
+   else
+   {
+      // Reload the interpolator.  For now, this is done at each call.
+      spliner->Clear();
+      for (UnsignedInt i = 0; i < 5; ++i)
+      {
+         data[0] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[0];
+         data[1] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[1];
+         data[2] = (*segments)[atIndex].segData.profile[interpolatorData[i]].vector[2];
+         data[3] = (*segments)[atIndex].segData.profile[interpolatorData[i]].mdot;
+
+         spliner->AddPoint((*segments)[atIndex].segData.profile[interpolatorData[i]].time, data);
+      }
+
+      GmatTime offsetGT = atEpoch - (*segments)[atIndex].segData.startEpochGT;
+      Real offset = offsetGT.GetTimeInSec() / GmatTimeConstants::SECS_PER_DAY;
+      spliner->Interpolate(offset, data);
+   }
+
+   if (dataBlock[5] == ThfDataSegment::SPLINE)
+   {
+      dataBlock[0] = data[0];
+      dataBlock[1] = data[1];
+      dataBlock[2] = data[2];
+   }
+   if (dataBlock[6] == ThfDataSegment::SPLINE)
+      dataBlock[3] = data[3];
+}
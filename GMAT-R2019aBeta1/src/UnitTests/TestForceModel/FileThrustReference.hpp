@@ -0,0 +1,77 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           FileThrustReference
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002-2015 United States Government as represented by the
+// Administrator of The National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Developed jointly by NASA/GSFC and Thinking Systems, Inc. under the FDSS II
+// contract, Task Order 08
+//
+// Author: Darrel J. Conway, Thinking Systems, Inc.
+// Created: Jan 13, 2016
+/**
+ * The thrust history lookup and interpolation of the FileThrust class as it
+ * was before the ThfDataSegment interpolating polynomials were added, renamed
+ * so that TestThrustHistoryInterpolation can compare the two.
+ *
+ * Only the pieces that produce the acceleration and mass flow are kept; the
+ * coordinate system conversion and the thrust scale factor bookkeeping of the
+ * force are not part of the comparison.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef FileThrustReference_hpp
+#define FileThrustReference_hpp
+
+#include "ThrustFileDefs.hpp"
+#include "ThrustSegment.hpp"
+#include "NotAKnotInterpolator.hpp"
+#include "GmatTime.hpp"
+
+class FileThrustReference
+{
+public:
+   FileThrustReference(std::vector<ThrustSegment> *segs);
+   ~FileThrustReference();
+
+   void ComputeAccelerationMassFlow(const GmatEpoch atEpoch, Real burnData[4]);
+   void ComputeAccelerationMassFlow(const GmatTime &atEpoch, Real burnData[4]);
+
+protected:
+   /// The segment data from the thrust history file
+   std::vector<ThrustSegment>    *segments;
+
+   /// Flag used to warn once that  then go silent if mass flow is missing tank
+   bool                          massFlowWarningNeeded;
+   /// Flag indicating if any thrusters are set to deplete mass
+   bool                          depleteMass;
+   /// Name of the tank that is supplying fuel (just 1 for now)
+   std::string                   activeTankName;
+
+   /// 5 raw data elements: 3 thrust/accel components, mdot, interpolation method
+   Real                          dataBlock[7];
+   /// dataSet is (up to) 5 dataBlock sets, with the last element set to time
+   Real                          dataSet[5][5];
+
+   /// Not a knot interpolator, used for spline interpolation
+   NotAKnotInterpolator          *spliner;
+   /// Flag used to mark when the "too few points" warning has been written
+   bool                          warnTooFewPoints;
+   /// Indices into the profile data that is loaded into the interpolator
+   Integer                       interpolatorData[5];
+   /// Last used index pair
+   Integer                       indexPair[2];
+
+   void GetSegmentData(Integer atIndex, GmatEpoch atEpoch);
+   void GetSegmentData(Integer atIndex, const GmatTime &atEpoch);
+   void LinearInterpolate(Integer atIndex, GmatEpoch atEpoch);
+   void LinearInterpolate(Integer atIndex, const GmatTime &atEpoch);
+   void SplineInterpolate(Integer atIndex, GmatEpoch atEpoch);
+   void SplineInterpolate(Integer atIndex, const GmatTime &atEpoch);
+};
+
+#endif /* FileThrustReference_hpp */
@@ -0,0 +1,285 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestAtmosphereThroughput
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Benchmark for the drag density models.
+ *
+ * First times the MSISE-90 kernel on a grid of positions, once through the
+ * legacy GTD6 entry point, which rebuilds the epoch terms at every call, and
+ * once through the per-epoch batch interface; the test fails unless the two
+ * give identical densities.  Then propagates a low Earth orbit with MSISE-90
+ * and with Jacchia-Roberts drag, reporting the wall clock time, the profiler
+ * counters and the final state of each run, and fails unless drag lowers the
+ * orbit.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "msise90_sub.hpp"
+
+using namespace std;
+
+extern "C"
+{
+   #ifdef USE_64_BIT_LONGS
+      void gtd6_(long int*,float*,float*,float*,float*,float*,float*,float*,float*,long int*,float*,float*);
+      typedef long int LegacyInt;
+   #else
+      void gtd6_(int*,float*,float*,float*,float*,float*,float*,float*,float*,int*,float*,float*);
+      typedef int LegacyInt;
+   #endif
+}
+
+/// Initial semimajor axis of every scenario, in km
+static const Real INITIAL_SMA = 6778.0;
+
+/// Description of one propagation case
+struct Scenario
+{
+   std::string name;
+   std::string model;
+   Real        days;
+};
+
+//------------------------------------------------------------------------------
+// void RunKernel(TestOutput &out)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates MSISE-90 on the same positions through both interfaces, writes
+ * the timings, and checks that the densities match exactly
+ */
+//------------------------------------------------------------------------------
+void RunKernel(TestOutput &out)
+{
+   const int epochs = 50;
+   const int points = 4000;
+
+   std::vector<float> alt(points), lat(points), lon(points), lst(points);
+   std::vector<float> legacy(points), batch(points);
+   for (int i = 0; i < points; ++i)
+   {
+      alt[i] = 120.0f + 880.0f * (i % 97) / 96.0f;
+      lat[i] = -85.0f + 170.0f * (i % 89) / 88.0f;
+      lon[i] = 360.0f * (i % 83) / 83.0f;
+   }
+
+   float ap[7] = {15.0f, 12.0f, 18.0f, 9.0f, 22.0f, 14.0f, 11.0f};
+   float f107 = 150.0f, f107a = 140.0f;
+   LegacyInt mass = 48;
+   float d[8], t[2];
+
+   Real legacyTime = 0.0, batchTime = 0.0, maxDiff = 0.0;
+   msise90_context ctx;
+   msise90_init(&ctx);
+
+   for (int e = 0; e < epochs; ++e)
+   {
+      LegacyInt iyd = 19001 + 7 * e;
+      float sec = 1800.0f * e;
+      for (int i = 0; i < points; ++i)
+         lst[i] = sec / 3600.0f + lon[i] / 15.0f;
+
+      std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+      for (int i = 0; i < points; ++i)
+      {
+         gtd6_(&iyd, &sec, &alt[i], &lat[i], &lon[i], &lst[i], &f107a, &f107,
+               ap, &mass, d, t);
+         legacy[i] = d[5];
+      }
+      legacyTime += std::chrono::duration<Real>(
+            std::chrono::steady_clock::now() - start).count();
+
+      start = std::chrono::steady_clock::now();
+      msise90_set_epoch(&ctx, iyd, sec, f107a, f107, ap);
+      msise90_density_batch(&ctx, points, &alt[0], &lat[0], &lon[0], &lst[0],
+            &batch[0]);
+      batchTime += std::chrono::duration<Real>(
+            std::chrono::steady_clock::now() - start).count();
+
+      for (int i = 0; i < points; ++i)
+      {
+         Real diff = fabs(batch[i] - legacy[i]) / legacy[i];
+         if (diff > maxDiff)
+            maxDiff = diff;
+      }
+   }
+
+   Real evaluations = (Real)epochs * points;
+   out.Put("      Evaluations:            ", evaluations);
+   out.Put("      GTD6 time (s):          ", legacyTime);
+   out.Put("      Batch time (s):         ", batchTime);
+   out.Put("      GTD6 evaluations/s:     ", evaluations / legacyTime);
+   out.Put("      Batch evaluations/s:    ", evaluations / batchTime);
+   out.Put("      Max relative difference:");
+   out.Validate(maxDiff, 0.0, 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(const ScenarioRunner &runner, const Scenario &sc)
+//------------------------------------------------------------------------------
+/**
+ * Builds the script for a scenario, propagating with drag from the scenario's
+ * atmosphere model and reporting the final state and semimajor axis to a file
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(const ScenarioRunner &runner, const Scenario &sc)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestAtmosphereThroughput\n\n"
+          << "Create Spacecraft Sat;\n"
+          << "Sat.DateFormat = UTCGregorian;\n"
+          << "Sat.Epoch = '01 Jan 2015 00:00:00.000';\n"
+          << "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+          << "Sat.DisplayStateType = Keplerian;\n"
+          << "Sat.SMA = " << INITIAL_SMA << ";\n"
+          << "Sat.ECC = 0.001;\n"
+          << "Sat.INC = 51.6;\n"
+          << "Sat.DryMass = 500;\n"
+          << "Sat.Cd = 2.2;\n"
+          << "Sat.DragArea = 10;\n\n"
+          << "Create ForceModel FM;\n"
+          << "FM.CentralBody = Earth;\n"
+          << "FM.PrimaryBodies = {Earth};\n"
+          << "FM.GravityField.Earth.Degree = 4;\n"
+          << "FM.GravityField.Earth.Order = 4;\n"
+          << "FM.Drag.AtmosphereModel = " << sc.model << ";\n\n"
+          << "Create Propagator Prop;\n"
+          << "Prop.FM = FM;\n"
+          << "Prop.Type = RungeKutta89;\n"
+          << "Prop.InitialStepSize = 60;\n"
+          << "Prop.Accuracy = 1e-11;\n"
+          << "Prop.MinStep = 0.001;\n"
+          << "Prop.MaxStep = 600;\n\n"
+          << "Create ReportFile Final;\n"
+          << "Final.Filename = '" << runner.GetReportFile(sc.name) << "';\n"
+          << "Final.WriteHeaders = false;\n"
+          << "Final.Precision = 16;\n\n"
+          << "BeginMissionSequence;\n"
+          << "Propagate Prop(Sat) {Sat.ElapsedDays = " << sc.days << "};\n"
+          << "Report Final Sat.X Sat.Y Sat.Z Sat.VX Sat.VY Sat.VZ "
+             "Sat.Earth.SMA;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void RunScenario(TestOutput &out, ScenarioRunner &runner,
+//       const Scenario &sc)
+//------------------------------------------------------------------------------
+/**
+ * Runs one case, writes its timing and final state, and checks that the orbit
+ * decayed
+ */
+//------------------------------------------------------------------------------
+void RunScenario(TestOutput &out, ScenarioRunner &runner, const Scenario &sc)
+{
+   Real elapsed = runner.Run(sc.name, BuildScript(runner, sc));
+
+   Real state[7];
+   if (!runner.ReadLastRow(sc.name, state, 7))
+      throw GmatBaseException("The " + sc.name + " final state was not "
+            "reported");
+
+   out.Put("      Time per day (s):  ", elapsed / sc.days);
+   out.Put("      Final position (km):  ", state[0], state[1], state[2]);
+   out.Put("      Final velocity (km/s):", state[3], state[4], state[5]);
+   out.Put("      Final SMA (km) is below the initial SMA:");
+   out.Put(state[6]);
+   out.Validate(state[6] < INITIAL_SMA, true);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== MSISE-90 kernel");
+   //---------------------------------------------------------------------------
+   RunKernel(out);
+
+   ScenarioRunner runner(out, "Atmosphere");
+   runner.Initialize();
+
+   Scenario scenarios[2];
+
+   scenarios[0].name = "MSISE90";
+   scenarios[0].model = "MSISE90";
+   scenarios[0].days = 5.0;
+
+   scenarios[1].name = "JacchiaRoberts";
+   scenarios[1].model = "JacchiaRoberts";
+   scenarios[1].days = 5.0;
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      //------------------------------------------------------------------------
+      out.Put("\n======================================== " +
+            scenarios[i].name);
+      //------------------------------------------------------------------------
+      RunScenario(out, runner, scenarios[i]);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestAtmosphereThroughputOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran atmosphere throughput test!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
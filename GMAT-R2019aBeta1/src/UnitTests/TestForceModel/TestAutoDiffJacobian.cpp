@@ -0,0 +1,395 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestAutoDiffJacobian
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Benchmark for A-matrix generation with DualNumber.
+ *
+ * Builds the A-matrix along an eccentric Earth orbit three ways: with the
+ * hand-coded partials used by PointMassForce and SolarRadiationPressure, with
+ * forward mode automatic differentiation of the acceleration kernel, and with
+ * central finite differences.  The cases are a 6x6 point mass matrix, a 7x7
+ * point mass and SRP matrix augmented with Cr, and a 6x6 relativistic
+ * correction matrix, which has no hand-coded partials.  Each method reports
+ * its time as a multiple of the acceleration cost and its largest error.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ctime>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "DualNumber.hpp"
+
+using namespace std;
+
+/// Number of states on the test orbit
+static const Integer STATE_COUNT = 20000;
+/// Passes over the states for each timing
+static const Integer PASSES = 10;
+/// Earth gravitational parameter (km^3/s^2)
+static const Real MU = 398600.4415;
+/// Sun position (km), fixed for the benchmark
+static const Real SUN[3] = {1.4959787e8, 0.0, 0.0};
+/// SRP constant: flux pressure (N/m^2) * area (m^2) / mass (kg) * 1 AU^2,
+/// converted to km
+static const Real SRP_SCALE = 4.56e-6 * 20.0 / 1000.0 * 1.4959787e8 *
+      1.4959787e8 * 1.0e-3;
+/// Speed of light (km/s)
+static const Real LIGHT_SPEED = 299792.458;
+
+
+//------------------------------------------------------------------------------
+// Acceleration kernels, templated on the number type
+//------------------------------------------------------------------------------
+/// Point mass gravity of the Earth
+struct PointMass
+{
+   template <class T>
+   void operator()(const T *x, T *a) const
+   {
+      T r2 = x[0] * x[0] + x[1] * x[1] + x[2] * x[2];
+      T mu_r3 = MU / (r2 * sqrt(r2));
+      for (Integer i = 0; i < 3; ++i)
+         a[i] = -mu_r3 * x[i];
+   }
+};
+
+/// Point mass gravity plus spherical SRP, with Cr as the seventh variable
+struct PointMassSrp
+{
+   template <class T>
+   void operator()(const T *x, T *a) const
+   {
+      PointMass()(x, a);
+      T sunSat[3];
+      for (Integer i = 0; i < 3; ++i)
+         sunSat[i] = x[i] - SUN[i];
+      T s2 = sunSat[0] * sunSat[0] + sunSat[1] * sunSat[1] +
+             sunSat[2] * sunSat[2];
+      T mag = x[6] * SRP_SCALE / (s2 * sqrt(s2));
+      for (Integer i = 0; i < 3; ++i)
+         a[i] += mag * sunSat[i];
+   }
+};
+
+/// Schwarzschild and Lense-Thirring terms of the relativistic correction
+struct Relativistic
+{
+   template <class T>
+   void operator()(const T *x, T *a) const
+   {
+      // Earth angular momentum per unit mass along z (km^2/s)
+      const Real J[3] = {0.0, 0.0, 0.4 * 6378.1363 * 6378.1363 * 7.292115e-5};
+      const T *rv = x, *vv = x + 3;
+
+      T r2 = rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2];
+      T r  = sqrt(r2);
+      T v2 = vv[0] * vv[0] + vv[1] * vv[1] + vv[2] * vv[2];
+      T s1 = MU / (LIGHT_SPEED * LIGHT_SPEED * r2 * r);
+      T s2 = (4.0 * MU / r) - v2;
+      T s3 = 4.0 * (rv[0] * vv[0] + rv[1] * vv[1] + rv[2] * vv[2]);
+      T lt = (3.0 / r2) * (rv[0] * J[0] + rv[1] * J[1] + rv[2] * J[2]);
+
+      a[0] = s1 * (s2 * rv[0] + s3 * vv[0]) + 2.0 * s1 *
+             (lt * (rv[1]*vv[2] - rv[2]*vv[1]) + (vv[1]*J[2] - vv[2]*J[1]));
+      a[1] = s1 * (s2 * rv[1] + s3 * vv[1]) + 2.0 * s1 *
+             (lt * (rv[2]*vv[0] - rv[0]*vv[2]) + (vv[2]*J[0] - vv[0]*J[2]));
+      a[2] = s1 * (s2 * rv[2] + s3 * vv[2]) + 2.0 * s1 *
+             (lt * (rv[0]*vv[1] - rv[1]*vv[0]) + (vv[0]*J[1] - vv[1]*J[0]));
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// A-matrix builders
+//------------------------------------------------------------------------------
+/// Zeros an M x M A-matrix and sets the velocity block of its upper rows
+void StartAMatrix(Integer m, Real *A)
+{
+   for (Integer i = 0; i < m * m; ++i)
+      A[i] = 0.0;
+   for (Integer i = 0; i < 3; ++i)
+      A[i * m + i + 3] = 1.0;
+}
+
+/// Hand-coded point mass partials, as in PointMassForce
+void HandCodedPointMass(const Real *x, Integer m, Real *A)
+{
+   Real r2 = x[0] * x[0] + x[1] * x[1] + x[2] * x[2];
+   Real mu_r = MU / (r2 * sqrt(r2));
+   for (Integer j = 0; j < 3; ++j)
+   {
+      Integer ix = m * (j + 3);
+      for (Integer k = 0; k < 3; ++k)
+         A[ix + k] += 3.0 * mu_r / r2 * x[j] * x[k] - (j == k ? mu_r : 0.0);
+   }
+}
+
+/// Hand-coded spherical SRP partials and Cr column, as in
+/// SolarRadiationPressure
+void HandCodedSrp(const Real *x, Integer m, Real *A)
+{
+   Real sunSat[3];
+   for (Integer i = 0; i < 3; ++i)
+      sunSat[i] = x[i] - SUN[i];
+   Real s2 = sunSat[0] * sunSat[0] + sunSat[1] * sunSat[1] +
+             sunSat[2] * sunSat[2];
+   Real mag = x[6] * SRP_SCALE / (s2 * sqrt(s2));
+   for (Integer j = 0; j < 3; ++j)
+   {
+      Integer ix = m * (j + 3);
+      for (Integer k = 0; k < 3; ++k)
+         A[ix + k] += mag * ((j == k ? 1.0 : 0.0) -
+                             3.0 * sunSat[j] * sunSat[k] / s2);
+      A[ix + 6] += mag * sunSat[j] / x[6];
+   }
+}
+
+/// Hand-coded partials for the point mass and SRP case
+void HandCodedPointMassSrp(const Real *x, Integer m, Real *A)
+{
+   HandCodedPointMass(x, m, A);
+   HandCodedSrp(x, m, A);
+}
+
+/// A-matrix from DualNumber evaluation of a kernel
+template <Integer N, class Kernel>
+void AutoDiffAMatrix(const Kernel &kernel, const Real *x, Real *A)
+{
+   DualNumber<N> xd[N], ad[3];
+   for (Integer i = 0; i < N; ++i)
+      xd[i].SetVariable(x[i], i);
+   kernel(xd, ad);
+
+   StartAMatrix(N, A);
+   for (Integer j = 0; j < 3; ++j)
+      for (Integer k = 0; k < N; ++k)
+         A[N * (j + 3) + k] = ad[j].Derivative(k);
+}
+
+/// A-matrix from central differences of a kernel
+template <Integer N, class Kernel>
+void FiniteDifferenceAMatrix(const Kernel &kernel, const Real *x, Real *A)
+{
+   Real xp[N], ap[3], am[3];
+   for (Integer i = 0; i < N; ++i)
+      xp[i] = x[i];
+
+   StartAMatrix(N, A);
+   for (Integer k = 0; k < N; ++k)
+   {
+      Real h = (k < 3 ? 1.0e-3 : (k < 6 ? 1.0e-6 : 1.0e-4));
+      xp[k] = x[k] + h;
+      kernel(xp, ap);
+      xp[k] = x[k] - h;
+      kernel(xp, am);
+      xp[k] = x[k];
+      for (Integer j = 0; j < 3; ++j)
+         A[N * (j + 3) + k] = (ap[j] - am[j]) / (2.0 * h);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Benchmark support
+//------------------------------------------------------------------------------
+Real ElapsedSeconds(std::clock_t start)
+{
+   return (Real)(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+/// States on an orbit with 7000 km perigee and 0.7 eccentricity, with Cr 1.8
+void BuildStates(Integer m, std::vector<Real> &states)
+{
+   Real rp = 7000.0, ecc = 0.7, p = rp * (1.0 + ecc);
+   Real inc = 0.5, ci = cos(inc), si = sin(inc);
+   states.resize(STATE_COUNT * m);
+   for (Integer i = 0; i < STATE_COUNT; ++i)
+   {
+      Real nu = 2.0 * GmatMathConstants::PI * i / STATE_COUNT;
+      Real r = p / (1.0 + ecc * cos(nu));
+      Real vr = sqrt(MU / p) * ecc * sin(nu), vt = sqrt(MU / p) *
+            (1.0 + ecc * cos(nu));
+      Real *x = &states[i * m];
+      x[0] = r * cos(nu);
+      x[1] = r * sin(nu) * ci;
+      x[2] = r * sin(nu) * si;
+      x[3] = vr * cos(nu) - vt * sin(nu);
+      x[4] = (vr * sin(nu) + vt * cos(nu)) * ci;
+      x[5] = (vr * sin(nu) + vt * cos(nu)) * si;
+      if (m > 6)
+         x[6] = 1.8;
+   }
+}
+
+/// Largest difference in the acceleration rows, relative to the largest entry
+/// of the reference rows
+Real MaxRelativeError(Integer m, const std::vector<Real> &A,
+      const std::vector<Real> &ref)
+{
+   Real maxError = 0.0;
+   for (Integer i = 0; i < STATE_COUNT; ++i)
+   {
+      Real scale = 0.0, diff = 0.0;
+      for (Integer j = 3 * m; j < 6 * m; ++j)
+      {
+         Integer e = i * m * m + j;
+         if (fabs(ref[e]) > scale)
+            scale = fabs(ref[e]);
+         if (fabs(A[e] - ref[e]) > diff)
+            diff = fabs(A[e] - ref[e]);
+      }
+      if ((scale > 0.0) && (diff / scale > maxError))
+         maxError = diff / scale;
+   }
+   return maxError;
+}
+
+/// Times the acceleration alone, returning seconds per evaluation
+template <Integer N, class Kernel>
+Real TimeAcceleration(const Kernel &kernel, const std::vector<Real> &states)
+{
+   Real a[3], sum = 0.0;
+   std::clock_t start = std::clock();
+   for (Integer pass = 0; pass < PASSES; ++pass)
+      for (Integer i = 0; i < STATE_COUNT; ++i)
+      {
+         kernel(&states[i * N], a);
+         sum += a[0];
+      }
+   Real elapsed = ElapsedSeconds(start);
+   if (sum == 0.0)
+      MessageInterface::ShowMessage("Zero acceleration sum\n");
+   return elapsed / (PASSES * STATE_COUNT);
+}
+
+void Report(TestOutput &out, const std::string &label, Real elapsed,
+      Real accelTime)
+{
+   Real perMatrix = elapsed / (PASSES * STATE_COUNT);
+   out.Put(label);
+   out.Put("      Time per matrix (us):  ", perMatrix * 1.0e6);
+   if (accelTime > 0.0)
+      out.Put("      Acceleration multiple: ", perMatrix / accelTime);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunCase(TestOutput &out, const Kernel &kernel, handCoded)
+//------------------------------------------------------------------------------
+/**
+ * Times and compares the A-matrix methods for one kernel
+ *
+ * @param handCoded Builds the hand-coded partials, or NULL if there are none
+ */
+//------------------------------------------------------------------------------
+template <Integer N, class Kernel>
+void RunCase(TestOutput &out, const std::string &name, const Kernel &kernel,
+      void (*handCoded)(const Real*, Integer, Real*))
+{
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== " + name);
+   //---------------------------------------------------------------------------
+   std::vector<Real> states, exact(STATE_COUNT * N * N),
+         dual(STATE_COUNT * N * N), diffs(STATE_COUNT * N * N);
+   BuildStates(N, states);
+
+   Real accelTime = TimeAcceleration<N>(kernel, states);
+   out.Put("   Acceleration (us):        ", accelTime * 1.0e6);
+
+   std::clock_t start;
+   if (handCoded)
+   {
+      start = std::clock();
+      for (Integer pass = 0; pass < PASSES; ++pass)
+         for (Integer i = 0; i < STATE_COUNT; ++i)
+         {
+            Real *A = &exact[i * N * N];
+            StartAMatrix(N, A);
+            handCoded(&states[i * N], N, A);
+         }
+      Report(out, "   Hand-coded partials", ElapsedSeconds(start), accelTime);
+   }
+
+   start = std::clock();
+   for (Integer pass = 0; pass < PASSES; ++pass)
+      for (Integer i = 0; i < STATE_COUNT; ++i)
+         AutoDiffAMatrix<N>(kernel, &states[i * N], &dual[i * N * N]);
+   Report(out, "   DualNumber", ElapsedSeconds(start), accelTime);
+
+   start = std::clock();
+   for (Integer pass = 0; pass < PASSES; ++pass)
+      for (Integer i = 0; i < STATE_COUNT; ++i)
+         FiniteDifferenceAMatrix<N>(kernel, &states[i * N], &diffs[i * N * N]);
+   Report(out, "   Central differences", ElapsedSeconds(start), accelTime);
+
+   if (handCoded)
+   {
+      out.Put("   DualNumber error:         ", MaxRelativeError(N, dual, exact));
+      out.Put("   Difference error:         ",
+            MaxRelativeError(N, diffs, exact));
+   }
+   else
+      out.Put("   Difference vs DualNumber: ", MaxRelativeError(N, diffs, dual));
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   RunCase<6>(out, "6x6 point mass", PointMass(), HandCodedPointMass);
+   RunCase<7>(out, "7x7 point mass and SRP with Cr", PointMassSrp(),
+         HandCodedPointMassSrp);
+   RunCase<6>(out, "6x6 relativistic correction", Relativistic(), NULL);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestAutoDiffJacobianOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran A-matrix differentiation benchmark!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+}
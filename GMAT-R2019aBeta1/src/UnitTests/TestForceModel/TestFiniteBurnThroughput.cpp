@@ -0,0 +1,276 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestFiniteBurnThroughput
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Benchmark for long low-thrust propagations.
+ *
+ * Runs three finite burns that stay on for the whole propagation: a chemical
+ * thruster with pressure and temperature dependent thrust and Isp pointed in
+ * an inertial frame, the same thruster in the local VNB frame, and an electric
+ * thruster on a solar power system.  Each run reports its wall clock time,
+ * the time per propagated day, the profiler counters and the final state and
+ * mass.  The test fails unless every burn uses propellant without emptying its
+ * tank, and the along-track burns raise the orbit.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+
+using namespace std;
+
+/// Dry mass of the spacecraft in every scenario, in kg
+static const Real DRY_MASS = 500.0;
+/// Initial semimajor axis of every scenario, in km
+static const Real INITIAL_SMA = 7000.0;
+
+/// Description of one propagation case
+struct Scenario
+{
+   std::string name;
+   std::string hardware;
+   std::string thruster;
+   Real        days;
+   /// Dry mass plus the propellant loaded in the tank
+   Real        initialMass;
+   /// true if the burn is along the velocity, so the orbit must grow
+   bool        raisesOrbit;
+};
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(const ScenarioRunner &runner, const Scenario &sc)
+//------------------------------------------------------------------------------
+/**
+ * Builds the script for a scenario, burning for the whole propagation and
+ * reporting the final state, mass and semimajor axis to a file
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(const ScenarioRunner &runner, const Scenario &sc)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestFiniteBurnThroughput\n\n"
+          << "Create Spacecraft Sat;\n"
+          << "Sat.DateFormat = UTCGregorian;\n"
+          << "Sat.Epoch = '01 Jan 2019 00:00:00.000';\n"
+          << "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+          << "Sat.DisplayStateType = Keplerian;\n"
+          << "Sat.SMA = " << INITIAL_SMA << ";\n"
+          << "Sat.ECC = 0.001;\n"
+          << "Sat.INC = 28.5;\n"
+          << "Sat.DryMass = " << DRY_MASS << ";\n\n"
+          << sc.hardware
+          << "\nCreate FiniteBurn Burn;\n"
+          << "Burn.Thrusters = {" << sc.thruster << "};\n\n"
+          << "Create ForceModel FM;\n"
+          << "FM.CentralBody = Earth;\n"
+          << "FM.PrimaryBodies = {Earth};\n"
+          << "FM.GravityField.Earth.Degree = 4;\n"
+          << "FM.GravityField.Earth.Order = 4;\n\n"
+          << "Create Propagator Prop;\n"
+          << "Prop.FM = FM;\n"
+          << "Prop.Type = RungeKutta89;\n"
+          << "Prop.InitialStepSize = 60;\n"
+          << "Prop.Accuracy = 1e-11;\n"
+          << "Prop.MinStep = 0.001;\n"
+          << "Prop.MaxStep = 600;\n\n"
+          << "Create ReportFile Final;\n"
+          << "Final.Filename = '" << runner.GetReportFile(sc.name) << "';\n"
+          << "Final.WriteHeaders = false;\n"
+          << "Final.Precision = 16;\n\n"
+          << "BeginMissionSequence;\n"
+          << "BeginFiniteBurn Burn(Sat);\n"
+          << "Propagate Prop(Sat) {Sat.ElapsedDays = " << sc.days << "};\n"
+          << "EndFiniteBurn Burn(Sat);\n"
+          << "Report Final Sat.X Sat.Y Sat.Z Sat.VX Sat.VY Sat.VZ "
+             "Sat.TotalMass Sat.Earth.SMA;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void RunScenario(TestOutput &out, ScenarioRunner &runner,
+//       const Scenario &sc)
+//------------------------------------------------------------------------------
+/**
+ * Runs one case, writes its timing and final state, and checks the mass and
+ * orbit change
+ */
+//------------------------------------------------------------------------------
+void RunScenario(TestOutput &out, ScenarioRunner &runner, const Scenario &sc)
+{
+   Real elapsed = runner.Run(sc.name, BuildScript(runner, sc));
+
+   Real state[8];
+   if (!runner.ReadLastRow(sc.name, state, 8))
+      throw GmatBaseException("The " + sc.name + " final state was not "
+            "reported");
+
+   out.Put("      Time per day (s):  ", elapsed / sc.days);
+   out.Put("      Final position (km):  ", state[0], state[1], state[2]);
+   out.Put("      Final velocity (km/s):", state[3], state[4], state[5]);
+
+   out.Put("      Final mass (kg) is between the dry and initial mass:");
+   out.Put(state[6]);
+   out.Validate((state[6] > DRY_MASS) && (state[6] < sc.initialMass), true);
+
+   if (sc.raisesOrbit)
+   {
+      out.Put("      Final SMA (km) is above the initial SMA:");
+      out.Put(state[7]);
+      out.Validate(state[7] > INITIAL_SMA, true);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "FiniteBurn");
+   runner.Initialize();
+
+   // Low thrust blowdown thruster with every term of the thrust and Isp
+   // expressions that a pressure-fed engine typically uses
+   std::string chemical =
+         "Create ChemicalTank Fuel;\n"
+         "Fuel.FuelMass = 200;\n"
+         "Fuel.Pressure = 1500;\n"
+         "Fuel.Temperature = 25;\n"
+         "Fuel.RefTemperature = 20;\n"
+         "Fuel.PressureModel = BlowDown;\n\n"
+         "Create ChemicalThruster Engine;\n"
+         "Engine.DecrementMass = true;\n"
+         "Engine.Tank = {Fuel};\n"
+         "Engine.C1 = 0.05;\n"
+         "Engine.C2 = 1e-5;\n"
+         "Engine.C3 = 0.01;\n"
+         "Engine.C4 = 1e-6;\n"
+         "Engine.C6 = 1e-4;\n"
+         "Engine.C7 = 0.5;\n"
+         "Engine.C15 = 0.01;\n"
+         "Engine.K1 = 220;\n"
+         "Engine.K2 = 1e-3;\n"
+         "Engine.K3 = 5;\n"
+         "Engine.K6 = 0.1;\n"
+         "Engine.K7 = 0.5;\n\n"
+         "Sat.Tanks = {Fuel};\n"
+         "Sat.Thrusters = {Engine};\n";
+
+   Scenario scenarios[3];
+
+   scenarios[0].name = "ChemicalInertial";
+   scenarios[0].hardware = chemical +
+         "Engine.CoordinateSystem = EarthMJ2000Eq;\n"
+         "Engine.ThrustDirection1 = 0;\n"
+         "Engine.ThrustDirection2 = 1;\n"
+         "Engine.ThrustDirection3 = 0;\n";
+   scenarios[0].thruster = "Engine";
+   scenarios[0].days = 10.0;
+   scenarios[0].initialMass = DRY_MASS + 200.0;
+   scenarios[0].raisesOrbit = false;
+
+   scenarios[1].name = "ChemicalVNB";
+   scenarios[1].hardware = chemical +
+         "Engine.CoordinateSystem = Local;\n"
+         "Engine.Origin = Earth;\n"
+         "Engine.Axes = VNB;\n"
+         "Engine.ThrustDirection1 = 1;\n"
+         "Engine.ThrustDirection2 = 0;\n"
+         "Engine.ThrustDirection3 = 0;\n";
+   scenarios[1].thruster = "Engine";
+   scenarios[1].days = 10.0;
+   scenarios[1].initialMass = DRY_MASS + 200.0;
+   scenarios[1].raisesOrbit = true;
+
+   scenarios[2].name = "Electric";
+   scenarios[2].hardware =
+         "Create ElectricTank Xenon;\n"
+         "Xenon.FuelMass = 100;\n\n"
+         "Create ElectricThruster Ion;\n"
+         "Ion.CoordinateSystem = Local;\n"
+         "Ion.Origin = Earth;\n"
+         "Ion.Axes = VNB;\n"
+         "Ion.ThrustDirection1 = 1;\n"
+         "Ion.ThrustDirection2 = 0;\n"
+         "Ion.ThrustDirection3 = 0;\n"
+         "Ion.DecrementMass = true;\n"
+         "Ion.Tank = {Xenon};\n"
+         "Ion.ThrustModel = ThrustMassPolynomial;\n\n"
+         "Create SolarPowerSystem Power;\n"
+         "Power.InitialMaxPower = 5;\n"
+         "Power.ShadowModel = 'DualCone';\n"
+         "Power.ShadowBodies = {'Earth'};\n\n"
+         "Sat.Tanks = {Xenon};\n"
+         "Sat.Thrusters = {Ion};\n"
+         "Sat.PowerSystem = Power;\n";
+   scenarios[2].thruster = "Ion";
+   scenarios[2].days = 30.0;
+   scenarios[2].initialMass = DRY_MASS + 100.0;
+   scenarios[2].raisesOrbit = true;
+
+   for (Integer i = 0; i < 3; ++i)
+   {
+      //------------------------------------------------------------------------
+      out.Put("\n======================================== " +
+            scenarios[i].name);
+      //------------------------------------------------------------------------
+      RunScenario(out, runner, scenarios[i]);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestFiniteBurnThroughputOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran finite burn throughput test!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
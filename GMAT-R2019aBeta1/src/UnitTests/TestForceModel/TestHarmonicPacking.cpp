@@ -0,0 +1,401 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestHarmonicPacking
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Regression test for the packed harmonic coefficient layout.
+ *
+ * Random gravity fields of degree 8, 30, 120 and 200, a 70x30 field and a
+ * field with tide increments on its low degrees are loaded into the Harmonic
+ * class and into HarmonicReference, the class as it was with its coefficients
+ * held in separately allocated rows.  Accelerations and gradients at 200
+ * positions per field, from full and truncated evaluations, must match the
+ * reference.  Fields are also built and released on several threads at once,
+ * sharing the normalization tables, and must then still match.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <sstream>
+#include <vector>
+#include <thread>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include "Harmonic.hpp"
+#include "HarmonicReference.hpp"
+
+using namespace std;
+
+/// Earth gravitational parameter (km^3/s^2) and field radius (km)
+static const Real MU           = 398600.4415;
+static const Real FIELD_RADIUS = 6378.1363;
+/// Positions evaluated per field
+static const Integer POSITION_COUNT = 200;
+/// Allowed difference from the reference, relative to the largest element
+static const Real RELATIVE_TOLERANCE = 1.0e-13;
+/// Threads building fields at once, and fields built by each
+static const Integer THREAD_COUNT = 4;
+static const Integer THREAD_FIELDS = 25;
+
+//------------------------------------------------------------------------------
+// Real Random(unsigned int &seed)
+//------------------------------------------------------------------------------
+/**
+ * Uniform value in [0, 1) from a fixed linear congruential sequence, so the
+ * fields are the same on every platform
+ */
+//------------------------------------------------------------------------------
+Real Random(unsigned int &seed)
+{
+   seed = seed * 1103515245u + 12345u;
+   return ((seed >> 8) & 0xffff) / 65536.0;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Coefficient(unsigned int &seed, Integer n)
+//------------------------------------------------------------------------------
+/**
+ * Random normalized coefficient of roughly the size found in Earth fields
+ */
+//------------------------------------------------------------------------------
+Real Coefficient(unsigned int &seed, Integer n)
+{
+   return (Random(seed) - 0.5) * 2.0e-5 / (n * n);
+}
+
+
+//------------------------------------------------------------------------------
+// class PackedField
+//------------------------------------------------------------------------------
+/**
+ * Harmonic field with coefficients and tide increments set by the test
+ */
+//------------------------------------------------------------------------------
+class PackedField : public Harmonic
+{
+public:
+   PackedField(Integer degree, Integer order, unsigned int seed,
+         Integer tideDegree = -1)
+   {
+      NN = degree;
+      MM = order;
+      FieldRadius = FIELD_RADIUS;
+      Factor = -MU;
+      Allocate();
+
+      for (Integer n = 0; n <= NN; ++n)
+         for (Integer m = 0; m <= n; ++m)
+         {
+            bool used = (n >= 2) && (m <= MM);
+            C[Index(n,m)] = used ? Coefficient(seed, n) : 0.0;
+            S[Index(n,m)] = (used && (m > 0)) ? Coefficient(seed, n) : 0.0;
+         }
+
+      if (tideDegree >= 0)
+      {
+         Integer count = Index(tideDegree, tideDegree) + 1;
+         tideC.assign(count, 0.0);
+         tideS.assign(count, 0.0);
+         for (Integer n = 2; n <= tideDegree; ++n)
+            for (Integer m = 0; m <= n; ++m)
+            {
+               tideC[Index(n,m)] = 1.0e-3 * Coefficient(seed, n);
+               tideS[Index(n,m)] = m > 0 ? 1.0e-3 * Coefficient(seed, n) : 0.0;
+            }
+         DeltaMax = tideDegree;
+         DeltaC = &tideC[0];
+         DeltaS = &tideS[0];
+      }
+   }
+
+   virtual Real Cnm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return C[Index(n,m)] + (n <= DeltaMax ? tideC[Index(n,m)] : 0.0);
+   }
+
+   virtual Real Snm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return S[Index(n,m)] + (n <= DeltaMax ? tideS[Index(n,m)] : 0.0);
+   }
+
+private:
+   RealArray tideC;
+   RealArray tideS;
+};
+
+
+//------------------------------------------------------------------------------
+// class ReferenceField
+//------------------------------------------------------------------------------
+/**
+ * HarmonicReference field built from the coefficients of a PackedField
+ */
+//------------------------------------------------------------------------------
+class ReferenceField : public HarmonicReference
+{
+public:
+   ReferenceField(const PackedField &packed)
+   {
+      NN = packed.GetNN();
+      MM = packed.GetMM();
+      FieldRadius = packed.GetFieldRadius();
+      Factor = packed.GetFactor();
+      Allocate();
+
+      for (Integer n = 0; n <= NN; ++n)
+         for (Integer m = 0; m <= n; ++m)
+         {
+            C[n][m] = packed.Cnm(0.0, n, m);
+            S[n][m] = packed.Snm(0.0, n, m);
+         }
+   }
+
+   virtual Real Cnm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return C[n][m];
+   }
+
+   virtual Real Snm(const Real& jday, const Integer& n, const Integer& m) const
+   {
+      return S[n][m];
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void Position(unsigned int &seed, Real pos[3])
+//------------------------------------------------------------------------------
+/**
+ * Random position between 6500 and 42000 km from the center
+ */
+//------------------------------------------------------------------------------
+void Position(unsigned int &seed, Real pos[3])
+{
+   Real z = 2.0 * Random(seed) - 1.0;
+   Real lon = 2.0 * GmatMathConstants::PI * Random(seed);
+   Real r = 6500.0 + 35500.0 * Random(seed);
+   Real c = sqrt(1.0 - z * z);
+   pos[0] = r * c * cos(lon);
+   pos[1] = r * c * sin(lon);
+   pos[2] = r * z;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Difference(const Real *test, const Real *ref, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Largest difference between two vectors, relative to the largest element of
+ * the reference
+ */
+//------------------------------------------------------------------------------
+Real Difference(const Real *test, const Real *ref, Integer count)
+{
+   Real scale = 0.0, diff = 0.0;
+   for (Integer i = 0; i < count; ++i)
+   {
+      scale = fmax(scale, fabs(ref[i]));
+      diff = fmax(diff, fabs(test[i] - ref[i]));
+   }
+   return scale > 0.0 ? diff / scale : diff;
+}
+
+
+//------------------------------------------------------------------------------
+// Real CompareFields(const Harmonic &packed, const HarmonicReference &ref,
+//       Integer nn, Integer mm, unsigned int seed)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates both fields at the same positions
+ *
+ * @return The largest relative difference in the accelerations and gradients
+ */
+//------------------------------------------------------------------------------
+Real CompareFields(const Harmonic &packed, const HarmonicReference &ref,
+      Integer nn, Integer mm, unsigned int seed)
+{
+   Real worst = 0.0;
+   Integer gradientLimit = nn;
+   for (Integer i = 0; i < POSITION_COUNT; ++i)
+   {
+      Real pos[3], jday = 0.0;
+      Position(seed, pos);
+
+      // Acceleration alone, then with the gradient
+      for (Integer g = 0; g < 2; ++g)
+      {
+         bool fillGradient = (g == 1);
+         Real accPacked[3], accRef[3];
+         Rmatrix33 gradPacked, gradRef;
+         packed.CalculateField(jday, pos, nn, mm, fillGradient, gradientLimit,
+               accPacked, gradPacked);
+         ref.CalculateField(jday, pos, nn, mm, fillGradient, gradientLimit,
+               accRef, gradRef);
+
+         worst = fmax(worst, Difference(accPacked, accRef, 3));
+         if (fillGradient)
+            worst = fmax(worst, Difference(gradPacked.GetDataVector(),
+                  gradRef.GetDataVector(), 9));
+      }
+   }
+   return worst;
+}
+
+
+//------------------------------------------------------------------------------
+// void CheckField(TestOutput &out, Integer degree, Integer order,
+//       Integer nn, Integer mm, Integer tideDegree = -1)
+//------------------------------------------------------------------------------
+void CheckField(TestOutput &out, Integer degree, Integer order, Integer nn,
+      Integer mm, Integer tideDegree = -1)
+{
+   std::stringstream title;
+   title << "   " << degree << "x" << order << " field evaluated to " << nn
+         << "x" << mm;
+   if (tideDegree >= 0)
+      title << ", tides to degree " << tideDegree;
+   out.Put(title.str());
+
+   PackedField packed(degree, order, 1000u + degree, tideDegree);
+   ReferenceField ref(packed);
+   out.Validate(CompareFields(packed, ref, nn, mm, 77u), 0.0,
+         RELATIVE_TOLERANCE);
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildFields(Integer thread, Real *worst)
+//------------------------------------------------------------------------------
+/**
+ * Builds, checks and releases fields on one thread
+ *
+ * Each field shares its normalization tables with the fields of the same
+ * degree built by the other threads.
+ */
+//------------------------------------------------------------------------------
+void BuildFields(Integer thread, Real *worst)
+{
+   const Integer degrees[3] = {12, 30, 12};
+   for (Integer i = 0; i < THREAD_FIELDS; ++i)
+   {
+      Integer degree = degrees[(i + thread) % 3];
+      PackedField packed(degree, degree, 2000u + i);
+      ReferenceField ref(packed);
+      *worst = fmax(*worst, CompareFields(packed, ref, degree, degree,
+            300u + thread));
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Full fields");
+   //---------------------------------------------------------------------------
+   CheckField(out, 8, 8, 8, 8);
+   CheckField(out, 30, 30, 30, 30);
+   CheckField(out, 120, 120, 120, 120);
+   CheckField(out, 200, 200, 200, 200);
+   CheckField(out, 70, 30, 70, 30);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Truncated evaluations");
+   //---------------------------------------------------------------------------
+   CheckField(out, 200, 200, 50, 50);
+   CheckField(out, 120, 120, 120, 4);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Tide increments");
+   //---------------------------------------------------------------------------
+   CheckField(out, 30, 30, 30, 30, 4);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Shared tables");
+   //---------------------------------------------------------------------------
+   {
+      PackedField first(20, 20, 11u);
+      Real worst;
+      {
+         PackedField second(20, 20, 12u);
+         ReferenceField secondRef(second);
+         worst = CompareFields(second, secondRef, 20, 20, 5u);
+      }
+      ReferenceField firstRef(first);
+      out.Put("   Fields of one degree, before and after one is released:");
+      worst = fmax(worst, CompareFields(first, firstRef, 20, 20, 6u));
+      out.Validate(worst, 0.0, RELATIVE_TOLERANCE);
+   }
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Threaded builds");
+   //---------------------------------------------------------------------------
+   std::vector<std::thread> threads;
+   Real worst[THREAD_COUNT];
+   for (Integer i = 0; i < THREAD_COUNT; ++i)
+   {
+      worst[i] = 0.0;
+      threads.push_back(std::thread(BuildFields, i, &worst[i]));
+   }
+   for (Integer i = 0; i < THREAD_COUNT; ++i)
+   {
+      threads[i].join();
+      out.Put("   Fields built on thread ", i);
+      out.Validate(worst[i], 0.0, RELATIVE_TOLERANCE);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestHarmonicPackingOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran regression testing of the packed harmonic "
+            "field!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,263 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                            TestMsise90Regression
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Regression test for the reentrant MSISE-90 kernel.
+ *
+ * Evaluates 12 epochs of 300 pseudo-random positions, from 20 to 990 km, and
+ * a pressure surface search every 50 positions: 3672 evaluations in all.  The
+ * run is made once with a constant Ap and once with 3-hour Ap values.  Each
+ * evaluation goes through the original f2c translation in Msise90Reference.c
+ * and through the GmatBase kernel, both by the legacy GTD6 and GHP6 entry
+ * points and by msise90_density() at the epoch set by msise90_set_epoch().
+ * Every density, temperature and altitude must match the reference bit for
+ * bit.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include "msise90_sub.hpp"
+
+using namespace std;
+
+#ifdef USE_64_BIT_LONGS
+   typedef long int LegacyInt;
+#else
+   typedef int LegacyInt;
+#endif
+
+extern "C"
+{
+   // The GmatBase kernel
+   void gtd6_(LegacyInt*,float*,float*,float*,float*,float*,float*,float*,
+         float*,LegacyInt*,float*,float*);
+   void ghp6_(LegacyInt*,float*,float*,float*,float*,float*,float*,float*,
+         float*,float*,float*,float*);
+   void meter6_(LegacyInt*);
+
+   // The original translation, from Msise90Reference.c
+   void ref_gtd6_(LegacyInt*,float*,float*,float*,float*,float*,float*,
+         float*,float*,LegacyInt*,float*,float*);
+   void ref_ghp6_(LegacyInt*,float*,float*,float*,float*,float*,float*,
+         float*,float*,float*,float*,float*);
+   void ref_meter6_(LegacyInt*);
+}
+
+/// Epochs, positions per epoch, and positions between pressure searches
+static const int EPOCH_COUNT       = 12;
+static const int POINT_COUNT       = 300;
+static const int PRESSURE_INTERVAL = 50;
+/// Pressure level searched for, in mb
+static const float PRESSURE        = 1.0e-3f;
+
+/// Seed of the input generator
+static unsigned int seed = 12345;
+
+//------------------------------------------------------------------------------
+// float Random()
+//------------------------------------------------------------------------------
+/**
+ * Uniform value in [0, 1) from a fixed linear congruential sequence, so the
+ * inputs are the same on every platform
+ */
+//------------------------------------------------------------------------------
+float Random()
+{
+   seed = seed * 1103515245u + 12345u;
+   return ((seed >> 8) & 0xffff) / 65536.0f;
+}
+
+
+//------------------------------------------------------------------------------
+// int CountMismatches(const float *test, const float *ref, int count)
+//------------------------------------------------------------------------------
+/**
+ * Counts the values that are not bit for bit the same
+ */
+//------------------------------------------------------------------------------
+int CountMismatches(const float *test, const float *ref, int count)
+{
+   int mismatches = 0;
+   for (int i = 0; i < count; ++i)
+      if (memcmp(&test[i], &ref[i], sizeof(float)) != 0)
+         ++mismatches;
+   return mismatches;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunPass(TestOutput &out, bool threeHourAp)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates every input through the reference and the library kernel
+ *
+ * @param out         The test output
+ * @param threeHourAp true to draw the Ap array at each epoch after the
+ *                    first two, false to use a constant Ap
+ */
+//------------------------------------------------------------------------------
+void RunPass(TestOutput &out, bool threeHourAp)
+{
+   msise90_context ctx;
+   msise90_init(&ctx);
+   msise90_meter(&ctx, 1);
+
+   int evaluations = 0, legacyMismatches = 0, contextMismatches = 0;
+   int pressureMismatches = 0;
+
+   for (int e = 0; e < EPOCH_COUNT; ++e)
+   {
+      LegacyInt iyd = 2019001 + (int)(364 * Random());
+      // One epoch in the two digit year form
+      if (e == 3)
+         iyd = 19172;
+      float sec = 86400.0f * Random();
+      float f107a = 70.0f + 180.0f * Random();
+      float f107 = f107a + 40.0f * (Random() - 0.5f);
+      float ap[7];
+      for (int k = 0; k < 7; ++k)
+         ap[k] = (threeHourAp && e >= 2) ? 2.0f + 100.0f * Random() : 15.0f;
+
+      msise90_set_epoch(&ctx, iyd, sec, f107a, f107, ap);
+
+      float alt = 0.0f, glat = 0.0f, glong = 0.0f;
+      for (int p = 0; p < POINT_COUNT; ++p)
+      {
+         // Every 7th position is below the thermosphere, and every 11th one
+         // repeats the previous latitude and longitude
+         alt = (p % 7 == 0) ? 20.0f + 200.0f * Random() :
+                              90.0f + 900.0f * Random();
+         if ((p % 11 != 0) || (p == 0))
+         {
+            glat = 180.0f * Random() - 90.0f;
+            glong = 360.0f * Random() - 180.0f;
+         }
+         float stl = sec / 3600.0f + glong / 15.0f;
+         LegacyInt mass = (p % 13 == 0) ? 28 : 48;
+
+         // Densities and then the two temperatures
+         float ref[10], legacy[10], context[10];
+         memset(ref, 0, sizeof(ref));
+         memset(legacy, 0, sizeof(legacy));
+         memset(context, 0, sizeof(context));
+
+         float a = alt;
+         ref_gtd6_(&iyd, &sec, &a, &glat, &glong, &stl, &f107a, &f107, ap,
+               &mass, ref, &ref[8]);
+         a = alt;
+         gtd6_(&iyd, &sec, &a, &glat, &glong, &stl, &f107a, &f107, ap,
+               &mass, legacy, &legacy[8]);
+         msise90_density(&ctx, alt, glat, glong, stl, (int)mass, context,
+               &context[8]);
+         ++evaluations;
+
+         if (CountMismatches(legacy, ref, 10) > 0)
+            ++legacyMismatches;
+         if (CountMismatches(context, ref, 10) > 0)
+            ++contextMismatches;
+
+         if (p % PRESSURE_INTERVAL == 0)
+         {
+            // The altitude found, then the densities
+            float press = PRESSURE, t[2];
+            float refAlt[9], legacyAlt[9];
+            ref_ghp6_(&iyd, &sec, &refAlt[0], &glat, &glong, &stl, &f107a,
+                  &f107, ap, &refAlt[1], t, &press);
+            ghp6_(&iyd, &sec, &legacyAlt[0], &glat, &glong, &stl, &f107a,
+                  &f107, ap, &legacyAlt[1], t, &press);
+            ++evaluations;
+
+            if (CountMismatches(legacyAlt, refAlt, 9) > 0)
+               ++pressureMismatches;
+         }
+      }
+   }
+
+   out.Put("   Evaluations:", evaluations);
+   out.Validate(evaluations, EPOCH_COUNT *
+         (POINT_COUNT + POINT_COUNT / PRESSURE_INTERVAL));
+   out.Put("   GTD6 results that differ from the reference:",
+         legacyMismatches);
+   out.Validate(legacyMismatches, 0);
+   out.Put("   msise90_density results that differ from the reference:",
+         contextMismatches);
+   out.Validate(contextMismatches, 0);
+   out.Put("   GHP6 results that differ from the reference:",
+         pressureMismatches);
+   out.Validate(pressureMismatches, 0);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   LegacyInt meter = 1;
+   ref_meter6_(&meter);
+   meter6_(&meter);
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Constant Ap");
+   //---------------------------------------------------------------------------
+   RunPass(out, false);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== 3-hour Ap");
+   //---------------------------------------------------------------------------
+   RunPass(out, true);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestMsise90RegressionOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran regression testing of MSISE-90!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
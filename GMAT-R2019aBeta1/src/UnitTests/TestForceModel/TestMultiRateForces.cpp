@@ -0,0 +1,259 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestMultiRateForces
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Benchmark for multi-rate force evaluation.
+ *
+ * Propagates a low lunar orbit and a cislunar Earth orbit twice each, once
+ * with every force evaluated at every integrator stage and once with the
+ * third bodies, SRP and (for the Earth orbit) the relativistic correction on
+ * the multi-rate grid.  Each run reports its wall clock time and the profiler
+ * counters.  The test fails if the final position of the multi-rate run is
+ * farther from the reference run than MAX_RELATIVE_POSITION_DIFF times the
+ * orbit radius, or if the multi-rate forces are evaluated exactly for more
+ * than MAX_EVALUATED_FRACTION of the derivative calls that need them.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
+
+using namespace std;
+
+/// Allowed final position difference, as a fraction of the orbit radius
+static const Real MAX_RELATIVE_POSITION_DIFF = 1.0e-6;
+/// Largest share of the multi-rate force calls that may be evaluated exactly
+static const Real MAX_EVALUATED_FRACTION = 0.5;
+
+/// Description of one propagation case
+struct Scenario
+{
+   std::string name;
+   std::string resources;
+   std::string multiRateForces;
+   Real        multiRateInterval;
+   Real        days;
+};
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(const ScenarioRunner &runner, const Scenario &sc,
+//       bool multiRate)
+//------------------------------------------------------------------------------
+/**
+ * Builds the script for a scenario, reporting the final state to a file
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(const ScenarioRunner &runner, const Scenario &sc,
+      bool multiRate)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestMultiRateForces\n\n"
+          << sc.resources;
+   if (multiRate)
+      script << "FM.MultiRateForces = " << sc.multiRateForces << ";\n"
+             << "FM.MultiRateInterval = " << sc.multiRateInterval << ";\n";
+
+   script << "\nCreate Propagator Prop;\n"
+          << "Prop.FM = FM;\n"
+          << "Prop.Type = RungeKutta89;\n"
+          << "Prop.InitialStepSize = 60;\n"
+          << "Prop.Accuracy = 1e-11;\n"
+          << "Prop.MinStep = 0.001;\n"
+          << "Prop.MaxStep = 86400;\n\n"
+          << "Create ReportFile Final;\n"
+          << "Final.Filename = '" << runner.GetReportFile(sc.name) << "';\n"
+          << "Final.WriteHeaders = false;\n"
+          << "Final.Precision = 16;\n\n"
+          << "BeginMissionSequence;\n"
+          << "Propagate Prop(Sat) {Sat.ElapsedDays = " << sc.days << "};\n"
+          << "Report Final Sat.X Sat.Y Sat.Z Sat.VX Sat.VY Sat.VZ;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// Real RunScenario(TestOutput &out, ScenarioRunner &runner,
+//       const Scenario &sc, bool multiRate, Real *state, Integer &samples,
+//       Integer &saved)
+//------------------------------------------------------------------------------
+/**
+ * Runs one case, returning its wall clock time in seconds
+ *
+ * The multi-rate profiler counters for the run are returned in samples (the
+ * exact evaluations of the multi-rate forces) and saved (the calls that were
+ * interpolated instead).
+ */
+//------------------------------------------------------------------------------
+Real RunScenario(TestOutput &out, ScenarioRunner &runner, const Scenario &sc,
+      bool multiRate, Real *state, Integer &samples, Integer &saved)
+{
+   out.Put(multiRate ? "   Multi-rate forces" : "   All forces per stage");
+   Real elapsed = runner.Run(sc.name, BuildScript(runner, sc, multiRate),
+         true);
+
+   if (!runner.ReadLastRow(sc.name, state, 6))
+      throw GmatBaseException("The " + sc.name + " final state was not "
+            "reported");
+
+   RunProfiler *profiler = RunProfiler::Instance();
+   samples = (Integer)profiler->GetCount("Multi-Rate Force Samples");
+   saved = (Integer)profiler->GetCount("Multi-Rate Force Calls Saved");
+
+   return elapsed;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "MultiRate");
+   runner.Initialize();
+
+   Scenario scenarios[2];
+
+   scenarios[0].name = "Lunar";
+   scenarios[0].resources =
+         "Create CoordinateSystem LunaMJ2000Eq;\n"
+         "LunaMJ2000Eq.Origin = Luna;\n"
+         "LunaMJ2000Eq.Axes = MJ2000Eq;\n\n"
+         "Create Spacecraft Sat;\n"
+         "Sat.DateFormat = UTCGregorian;\n"
+         "Sat.Epoch = '01 Jan 2019 00:00:00.000';\n"
+         "Sat.CoordinateSystem = LunaMJ2000Eq;\n"
+         "Sat.DisplayStateType = Keplerian;\n"
+         "Sat.SMA = 1838;\n"
+         "Sat.ECC = 0.01;\n"
+         "Sat.INC = 85;\n"
+         "Sat.SRPArea = 2;\n\n"
+         "Create ForceModel FM;\n"
+         "FM.CentralBody = Luna;\n"
+         "FM.PrimaryBodies = {Luna};\n"
+         "FM.GravityField.Luna.Degree = 8;\n"
+         "FM.GravityField.Luna.Order = 8;\n"
+         "FM.PointMasses = {Earth, Sun};\n"
+         "FM.SRP = On;\n";
+   scenarios[0].multiRateForces = "{PointMasses, SRP}";
+   scenarios[0].multiRateInterval = 600.0;
+   scenarios[0].days = 5.0;
+
+   scenarios[1].name = "Cislunar";
+   scenarios[1].resources =
+         "Create Spacecraft Sat;\n"
+         "Sat.DateFormat = UTCGregorian;\n"
+         "Sat.Epoch = '01 Jan 2019 00:00:00.000';\n"
+         "Sat.CoordinateSystem = EarthMJ2000Eq;\n"
+         "Sat.DisplayStateType = Keplerian;\n"
+         "Sat.SMA = 200000;\n"
+         "Sat.ECC = 0.96;\n"
+         "Sat.INC = 28.5;\n"
+         "Sat.SRPArea = 2;\n\n"
+         "Create ForceModel FM;\n"
+         "FM.CentralBody = Earth;\n"
+         "FM.PrimaryBodies = {Earth};\n"
+         "FM.GravityField.Earth.Degree = 4;\n"
+         "FM.GravityField.Earth.Order = 4;\n"
+         "FM.PointMasses = {Luna, Sun};\n"
+         "FM.SRP = On;\n"
+         "FM.RelativisticCorrection = On;\n";
+   scenarios[1].multiRateForces =
+         "{PointMasses, SRP, RelativisticCorrection}";
+   scenarios[1].multiRateInterval = 3600.0;
+   scenarios[1].days = 20.0;
+
+   for (Integer i = 0; i < 2; ++i)
+   {
+      //------------------------------------------------------------------------
+      out.Put("\n======================================== " +
+            scenarios[i].name);
+      //------------------------------------------------------------------------
+      Real reference[6], multiRate[6];
+      Integer refSamples, refSaved, samples, saved;
+      Real allTime = RunScenario(out, runner, scenarios[i], false, reference,
+            refSamples, refSaved);
+      Real multiTime = RunScenario(out, runner, scenarios[i], true, multiRate,
+            samples, saved);
+
+      Real dr = ScenarioRunner::Distance(multiRate, reference);
+      Real dv = ScenarioRunner::Distance(&multiRate[3], &reference[3]);
+      out.Put("   Final velocity diff (km/s):", dv);
+      if (multiTime > 0.0)
+         out.Put("   Speedup:                   ", allTime / multiTime);
+
+      Real radius = sqrt(reference[0] * reference[0] +
+            reference[1] * reference[1] + reference[2] * reference[2]);
+      out.Put("   Final position diff (km):  ");
+      out.Validate(dr, 0.0, MAX_RELATIVE_POSITION_DIFF * radius);
+
+      // The reference run evaluates every force at every call
+      out.Put("   Reference run multi-rate samples and saved calls:");
+      out.Validate(refSamples, 0);
+      out.Validate(refSaved, 0);
+
+      out.Put("   Multi-rate force evaluations:", samples);
+      out.Put("   Multi-rate force calls saved:", saved);
+      out.Validate(saved > 0, true);
+      out.Put("   Fraction of the calls evaluated exactly:");
+      out.Validate(samples <= MAX_EVALUATED_FRACTION * (samples + saved),
+            true);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestMultiRateForcesOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of multi-rate forces!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
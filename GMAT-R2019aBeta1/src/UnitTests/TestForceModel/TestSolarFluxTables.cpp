@@ -0,0 +1,526 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestSolarFluxTables
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Regression test for the SolarFluxReader lookup tables and result cache.
+ *
+ * Writes a CSSI observed file and a Schatten predict file of pseudo-random
+ * values and loads them into the SolarFluxReader and into the reader as it
+ * was before the tables were added, kept in SolarFluxReaderReference.  The
+ * PrepareApData and PrepareKpData results of the two must match exactly at
+ * the start of the observed data, where the Ap history is padded, across the
+ * handover to the predicted data, through the predicted data, on repeated
+ * calls at an epoch, which the cache answers, and after every
+ * SetSchattenFlags setting, which must clear the cache.
+ *
+ * Two differences from the old reader are intended and checked on their own:
+ * an epoch equal to the last predict record epoch uses that record, and
+ * PrepareKpData no longer reads the record ahead of the first one.  In the
+ * first two days both readers interpolate F10.7 from a value ahead of the
+ * first record, so the observed F10.7 is not compared there.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstdio>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "SolarFluxReader.hpp"
+#include "SolarFluxReaderReference.hpp"
+
+using namespace std;
+
+typedef SolarFluxReader::FluxData             FluxData;
+typedef SolarFluxReaderReference::FluxData    ReferenceData;
+
+/// The generated data files
+static const std::string OBS_FILE =
+      "../../../test/TestUtil/TestSolarFluxTablesCSSI.txt";
+static const std::string PREDICT_FILE =
+      "../../../test/TestUtil/TestSolarFluxTablesSchatten.txt";
+
+/// Observed days, from 1 Jan 2019, and predict months, from Dec 2018
+static const Integer OBS_DAYS      = 45;
+static const Integer PREDICT_COUNT = 25;
+/// Epoch spacing of the scans, in days
+static const Real SCAN_STEP        = 1.0 / 16.0;
+
+/// Ap values of the 28 Kp levels, and the Kp levels times 10
+static const Integer AP_LEVELS[28] = {0, 2, 3, 4, 5, 6, 7, 9, 12, 15, 18, 22,
+      27, 32, 39, 48, 56, 67, 80, 94, 111, 132, 154, 179, 207, 236, 300, 400};
+static const Integer KP_LEVELS[28] = {0, 3, 7, 10, 13, 17, 20, 23, 27, 30, 33,
+      37, 40, 43, 47, 50, 53, 57, 60, 63, 67, 70, 73, 77, 80, 83, 87, 90};
+
+/// Seed of the data generator
+static unsigned int seed = 24680;
+
+//------------------------------------------------------------------------------
+// Real Random()
+//------------------------------------------------------------------------------
+/**
+ * Uniform value in [0, 1) from a fixed linear congruential sequence, so the
+ * data files are the same on every platform
+ */
+//------------------------------------------------------------------------------
+Real Random()
+{
+   seed = seed * 1103515245u + 12345u;
+   return ((seed >> 8) & 0xffff) / 65536.0;
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteObservedFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes the CSSI file, with the F10.7 columns starting at column 93 as the
+ * reader expects
+ */
+//------------------------------------------------------------------------------
+void WriteObservedFile()
+{
+   std::ofstream cssi(OBS_FILE.c_str());
+   if (!cssi)
+      throw GmatBaseException("Cannot write " + OBS_FILE);
+
+   cssi << "DATATYPE CssiSpaceWeather\nVERSION 1.2\n"
+        << "NUM_OBSERVED_POINTS " << OBS_DAYS << "\nBEGIN OBSERVED\n";
+
+   const Integer monthDays[2] = {31, 28};
+   Integer month = 1, day = 1;
+   char line[160];
+
+   for (Integer d = 0; d < OBS_DAYS; ++d)
+   {
+      Integer level[8], kpSum = 0, apSum = 0;
+      for (Integer m = 0; m < 8; ++m)
+      {
+         level[m] = (Integer)(28 * Random() * Random());
+         kpSum += KP_LEVELS[level[m]];
+         apSum += AP_LEVELS[level[m]];
+      }
+
+      Integer n = sprintf(line, "2019 %02d %02d %4d %2d", month, day,
+            2530 + d, 1 + d % 27);
+      for (Integer m = 0; m < 8; ++m)
+         n += sprintf(line + n, " %2d", KP_LEVELS[level[m]]);
+      n += sprintf(line + n, " %3d", kpSum);
+      for (Integer m = 0; m < 8; ++m)
+         n += sprintf(line + n, " %3d", AP_LEVELS[level[m]]);
+      n += sprintf(line + n, " %3d", (apSum + 4) / 8);
+      // Cp, C9 and the sunspot number, which are not read
+      n += sprintf(line + n, " 0.5 2  12");
+
+      Real adjusted = 65.0 + 60.0 * Random();
+      Real observed = adjusted * (0.97 + 0.06 * Random());
+      sprintf(line + n, " %5.1f 0 %5.1f %5.1f %5.1f %5.1f %5.1f", adjusted,
+            adjusted + 3.0 * Random(), adjusted + 3.0 * Random(), observed,
+            observed + 3.0 * Random(), observed + 3.0 * Random());
+      cssi << line << "\n";
+
+      if (++day > monthDays[month - 1])
+      {
+         day = 1;
+         ++month;
+      }
+   }
+
+   cssi << "END OBSERVED\n";
+}
+
+
+//------------------------------------------------------------------------------
+// void WritePredictFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes the Schatten file.  Each timing has its own F10.7 values for the
+ * three magnitudes and its own Ap, so every SetSchattenFlags setting selects
+ * different data.
+ */
+//------------------------------------------------------------------------------
+void WritePredictFile()
+{
+   std::ofstream schatten(PREDICT_FILE.c_str());
+   if (!schatten)
+      throw GmatBaseException("Cannot write " + PREDICT_FILE);
+
+   schatten << "Generated by TestSolarFluxTables\n\n"
+            << "           NOMINAL TIMING              EARLY TIMING"
+            << "              LATE TIMING\n"
+            << " MON YEAR  mean  +2sig  -2sig   Ap    mean  +2sig  -2sig   Ap"
+            << "    mean  +2sig  -2sig   Ap\n"
+            << "BEGIN_DATA\n";
+
+   Integer month = 12, year = 2018;
+   char line[160];
+   for (Integer r = 0; r < PREDICT_COUNT; ++r)
+   {
+      Integer n = sprintf(line, "%4d %4d", month, year);
+      for (Integer t = 0; t < 3; ++t)
+      {
+         Real mean = 70.0 + 80.0 * Random();
+         n += sprintf(line + n, " %6.1f %6.1f %6.1f %4.1f", mean,
+               mean + 20.0 + 20.0 * Random(), mean - 10.0 - 10.0 * Random(),
+               3.0 + 40.0 * Random());
+      }
+      schatten << line << "\n";
+
+      if (++month > 12)
+      {
+         month = 1;
+         ++year;
+      }
+   }
+
+   schatten << "END_DATA\n";
+}
+
+
+//------------------------------------------------------------------------------
+// template <class TestRecord, class RefRecord>
+// Integer CountDifferences(const TestRecord &test, const RefRecord &ref,
+//       bool withF107)
+//------------------------------------------------------------------------------
+/**
+ * Counts the fields of two records that are not exactly the same
+ *
+ * @param test     The record under test
+ * @param ref      The record it should match
+ * @param withF107 false to skip the observed F10.7
+ */
+//------------------------------------------------------------------------------
+template <class TestRecord, class RefRecord>
+Integer CountDifferences(const TestRecord &test, const RefRecord &ref,
+      bool withF107)
+{
+   Integer differences = 0;
+
+   for (Integer i = 0; i < 8; ++i)
+   {
+      if (test.kp[i] != ref.kp[i])
+         ++differences;
+      if (test.ap[i] != ref.ap[i])
+         ++differences;
+   }
+   for (Integer i = 0; i < 9; ++i)
+      if (test.F107a[i] != ref.F107a[i])
+         ++differences;
+   for (Integer i = 0; i < 3; ++i)
+      if (test.apSchatten[i] != ref.apSchatten[i])
+         ++differences;
+
+   if ((test.epoch != ref.epoch) || (test.apAvg != ref.apAvg))
+      ++differences;
+   if ((test.adjF107 != ref.adjF107) || (test.adjCtrF107a != ref.adjCtrF107a))
+      ++differences;
+   if (withF107 && (test.obsF107 != ref.obsF107))
+      ++differences;
+   if (test.obsCtrF107a != ref.obsCtrF107a)
+      ++differences;
+   if ((test.isObsData != ref.isObsData) || (test.index != ref.index) ||
+       (test.id != ref.id))
+      ++differences;
+
+   return differences;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CompareAp(SolarFluxReader &reader, SolarFluxReaderReference &ref,
+//       Real epoch, bool withF107 = true)
+//------------------------------------------------------------------------------
+/**
+ * Compares the PrepareApData results of the two readers at an epoch
+ */
+//------------------------------------------------------------------------------
+Integer CompareAp(SolarFluxReader &reader, SolarFluxReaderReference &ref,
+      Real epoch, bool withF107 = true)
+{
+   FluxData test = reader.GetInputs(epoch);
+   reader.PrepareApData(test, epoch);
+   ReferenceData expected = ref.GetInputs(epoch);
+   ref.PrepareApData(expected, epoch);
+   return CountDifferences(test, expected, withF107);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CompareKp(SolarFluxReader &reader, SolarFluxReaderReference &ref,
+//       Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Compares the PrepareKpData results of the two readers at an epoch
+ */
+//------------------------------------------------------------------------------
+Integer CompareKp(SolarFluxReader &reader, SolarFluxReaderReference &ref,
+      Real epoch)
+{
+   FluxData test = reader.GetInputs(epoch);
+   reader.PrepareKpData(test, epoch);
+   ReferenceData expected = ref.GetInputs(epoch);
+   ref.PrepareKpData(expected, epoch);
+   return CountDifferences(test, expected, true);
+}
+
+
+//------------------------------------------------------------------------------
+// void ReportScan(TestOutput &out, Integer epochs, Integer apDifferences,
+//       Integer kpDifferences)
+//------------------------------------------------------------------------------
+void ReportScan(TestOutput &out, Integer epochs, Integer apDifferences,
+      Integer kpDifferences)
+{
+   out.Put("   Epochs compared:", epochs);
+   out.Validate(epochs > 0, true);
+   out.Put("   PrepareApData fields that differ from the reference:",
+         apDifferences);
+   out.Validate(apDifferences, 0);
+   out.Put("   PrepareKpData fields that differ from the reference:",
+         kpDifferences);
+   out.Validate(kpDifferences, 0);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   WriteObservedFile();
+   WritePredictFile();
+
+   SolarFluxReader reader;
+   SolarFluxReaderReference ref;
+   reader.LoadFluxData(OBS_FILE, PREDICT_FILE);
+   ref.LoadFluxData(OBS_FILE, PREDICT_FILE);
+
+   GmatEpoch hStart, hEnd, pStart, pEnd;
+   reader.GetEpochs(hStart, hEnd, pStart, pEnd);
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Start of the observed "
+         "data");
+   //---------------------------------------------------------------------------
+   // Kp 6.7 hours back is in the record ahead of the first one before this
+   Real kpStart = hStart + 6.7 / 24.0;
+   Integer epochs = 0, apDiffs = 0, kpDiffs = 0, kpChanged = 0;
+   FluxData first = reader.GetInputs(hStart);
+
+   for (Real epoch = hStart - 0.25; epoch < hStart + 4.0; epoch += SCAN_STEP)
+   {
+      apDiffs += CompareAp(reader, ref, epoch, epoch >= hStart + 2.0);
+      if (epoch >= kpStart)
+         kpDiffs += CompareKp(reader, ref, epoch);
+      else
+      {
+         FluxData fD = reader.GetInputs(epoch);
+         reader.PrepareKpData(fD, epoch);
+         if (fD.kp[0] != first.kp[0])
+            ++kpChanged;
+      }
+      ++epochs;
+   }
+   ReportScan(out, epochs, apDiffs, kpDiffs);
+   out.Put("   Kp values changed ahead of the first 6.7 hours:", kpChanged);
+   out.Validate(kpChanged, 0);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Observed to predicted "
+         "handover");
+   //---------------------------------------------------------------------------
+   epochs = apDiffs = kpDiffs = 0;
+   for (Real epoch = hEnd - 2.0; epoch < hEnd + 2.0; epoch += SCAN_STEP)
+   {
+      apDiffs += CompareAp(reader, ref, epoch);
+      kpDiffs += CompareKp(reader, ref, epoch);
+      ++epochs;
+   }
+   ReportScan(out, epochs, apDiffs, kpDiffs);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Predicted data");
+   //---------------------------------------------------------------------------
+   // Every day from the end of the observed data, which the predict data
+   // overlaps, then the epochs around each record start
+   epochs = apDiffs = kpDiffs = 0;
+   std::vector<Real> recordEpochs;
+   for (Real epoch = hEnd; epoch < pEnd; epoch += 1.0)
+   {
+      apDiffs += CompareAp(reader, ref, epoch);
+      kpDiffs += CompareKp(reader, ref, epoch);
+      ++epochs;
+
+      FluxData record = reader.GetInputs(epoch);
+      if (!record.isObsData && (recordEpochs.empty() ||
+          (record.epoch != recordEpochs.back())))
+         recordEpochs.push_back(record.epoch);
+   }
+   for (UnsignedInt r = 0; r < recordEpochs.size(); ++r)
+   {
+      const Real offsets[3] = {-0.01, 0.0, 0.01};
+      for (Integer i = 0; i < 3; ++i)
+      {
+         Real epoch = recordEpochs[r] + offsets[i];
+         if ((epoch >= hEnd) && (epoch < pEnd))
+         {
+            apDiffs += CompareAp(reader, ref, epoch);
+            kpDiffs += CompareKp(reader, ref, epoch);
+            ++epochs;
+         }
+      }
+   }
+   apDiffs += CompareAp(reader, ref, pEnd + 10.0);
+   kpDiffs += CompareKp(reader, ref, pEnd + 10.0);
+   ++epochs;
+   ReportScan(out, epochs, apDiffs, kpDiffs);
+
+   out.Put("   Record used at the last predict record epoch:");
+   FluxData last = reader.GetInputs(pEnd);
+   out.Validate(last.epoch, pEnd, 0.0);
+   out.Validate(last.id, PREDICT_COUNT - 1);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Repeated epochs");
+   //---------------------------------------------------------------------------
+   // The second call at an epoch comes from the cache, so it returns the first
+   // result even for a record read at another epoch
+   const Real repeats[4] = {hStart + 0.3, hStart + 20.55, hEnd + 0.1,
+                            pStart + 200.4};
+   epochs = apDiffs = kpDiffs = 0;
+   Integer cacheMisses = 0;
+   for (Integer i = 0; i < 4; ++i)
+   {
+      for (Integer pass = 0; pass < 2; ++pass)
+      {
+         apDiffs += CompareAp(reader, ref, repeats[i]);
+         if (repeats[i] >= kpStart)
+            kpDiffs += CompareKp(reader, ref, repeats[i]);
+         ++epochs;
+      }
+
+      FluxData fresh = reader.GetInputs(repeats[i]);
+      reader.PrepareApData(fresh, repeats[i]);
+      FluxData stale = reader.GetInputs(repeats[i] + 5.0);
+      reader.PrepareApData(stale, repeats[i]);
+      if (CountDifferences(stale, fresh, true) != 0)
+         ++cacheMisses;
+
+      fresh = reader.GetInputs(repeats[i]);
+      reader.PrepareKpData(fresh, repeats[i]);
+      stale = reader.GetInputs(repeats[i] + 5.0);
+      reader.PrepareKpData(stale, repeats[i]);
+      if (CountDifferences(stale, fresh, true) != 0)
+         ++cacheMisses;
+   }
+   ReportScan(out, epochs, apDiffs, kpDiffs);
+   out.Put("   Repeated calls not answered from the cache:", cacheMisses);
+   out.Validate(cacheMisses, 0);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Schatten settings");
+   //---------------------------------------------------------------------------
+   // Each setting follows a call at the same epoch, so a stale cache would
+   // return the data for the previous setting
+   const Integer timing[9]    = {0, 0, 0, -1, -1, -1, 1, 1, 1};
+   const Integer magnitude[9] = {1, -1, 0, 0, 1, -1, -1, 0, 1};
+   const Real settingEpochs[3] = {hEnd + 0.3, pStart + 200.4, hStart + 20.55};
+   epochs = apDiffs = kpDiffs = 0;
+   Integer unchanged = 0;
+   for (Integer e = 0; e < 3; ++e)
+   {
+      Real epoch = settingEpochs[e];
+      for (Integer s = 0; s < 9; ++s)
+      {
+         FluxData before = reader.GetInputs(epoch);
+         reader.PrepareApData(before, epoch);
+         FluxData kpRecord = reader.GetInputs(epoch);
+         reader.PrepareKpData(kpRecord, epoch);
+
+         reader.SetSchattenFlags(timing[s], magnitude[s]);
+         ref.SetSchattenFlags(timing[s], magnitude[s]);
+
+         apDiffs += CompareAp(reader, ref, epoch);
+         kpDiffs += CompareKp(reader, ref, epoch);
+         ++epochs;
+
+         // Only the predicted F10.7 follows the setting
+         FluxData after = reader.GetInputs(epoch);
+         reader.PrepareApData(after, epoch);
+         if ((epoch >= hEnd) && (after.obsF107 == before.obsF107))
+            ++unchanged;
+      }
+   }
+   ReportScan(out, epochs, apDiffs, kpDiffs);
+   out.Put("   Predicted F10.7 values left unchanged by a new setting:",
+         unchanged);
+   out.Validate(unchanged, 0);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Copies");
+   //---------------------------------------------------------------------------
+   SolarFluxReader readerCopy(reader);
+   SolarFluxReaderReference refCopy(ref);
+   epochs = apDiffs = kpDiffs = 0;
+   for (Real epoch = hEnd - 1.0; epoch < hEnd + 90.0; epoch += 0.7)
+   {
+      apDiffs += CompareAp(readerCopy, refCopy, epoch);
+      kpDiffs += CompareKp(readerCopy, refCopy, epoch);
+      ++epochs;
+   }
+   ReportScan(out, epochs, apDiffs, kpDiffs);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestSolarFluxTablesOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran regression testing of the solar flux "
+            "tables!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
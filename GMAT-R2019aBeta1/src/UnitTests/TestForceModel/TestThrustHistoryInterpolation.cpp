@@ -0,0 +1,528 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                        TestThrustHistoryInterpolation
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Regression test for the thrust history interpolating polynomials and
+ * interval lookups in ThfDataSegment.
+ *
+ * Writes a thrust history file with segments that use each interpolation
+ * method for the thrust and the mass flow, with repeated node times, shared
+ * segment boundaries, an overlap, a gap and a spline segment too short to be
+ * splined.  FileThrust then evaluates the thrust and mass flow, through both
+ * the GmatEpoch and the GmatTime paths, at epochs on, near and between every
+ * node and segment limit, looked up forward, backward, in a shuffled order and
+ * with each epoch repeated.  Every result must match FileThrustReference, the
+ * interpolation code that the polynomials replaced.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "LeapSecsFileReader.hpp"
+#include "TimeSystemConverter.hpp"
+#include "GmatTime.hpp"
+#include "ThrustHistoryFile.hpp"
+#include "FileThrust.hpp"
+#include "FileThrustReference.hpp"
+
+using namespace std;
+
+static const std::string THF_FILE =
+      "../../../test/TestUtil/TestThrustHistoryInterpolation.thf";
+static const std::string LEAP_SECOND_FILE =
+      "../../../test/TestUtil/TestThrustHistoryInterpolationLeapSeconds.dat";
+
+/// Offsets, in seconds, added to each node time to make the query epochs
+static const Real EPOCH_OFFSETS[] = {0.0, 1.0e-3, -1.0e-3, 0.5, -0.5};
+static const Integer OFFSET_COUNT =
+      sizeof(EPOCH_OFFSETS) / sizeof(EPOCH_OFFSETS[0]);
+
+/// Largest allowed difference from the reference.  The data are of order 1;
+/// the polynomials round differently than the old spline evaluations did, but
+/// an interval off by one is wrong by 1e-5 or more.
+static const Real TOLERANCE = 1.0e-9;
+
+/// Time, in days, before a segment end at which the reference is primed
+static const Real END_LEAD = 1.0e-3 / GmatTimeConstants::SECS_PER_DAY;
+
+/// Seed of the shuffle
+static unsigned int seed = 12345;
+
+/// A query epoch, in both time representations
+struct Query
+{
+   GmatEpoch epoch;
+   GmatTime  epochGT;
+   /// Flags for epochs that end the segment FileThrust reads them from
+   bool      atEnd;
+   bool      atEndGT;
+};
+
+//------------------------------------------------------------------------------
+// ThrustFileProbe
+//------------------------------------------------------------------------------
+/**
+ * Thrust history file that exposes its segments
+ */
+//------------------------------------------------------------------------------
+class ThrustFileProbe : public ThrustHistoryFile
+{
+public:
+   ThrustFileProbe() : ThrustHistoryFile("ThrustFileProbe") {}
+
+   std::vector<ThrustSegment>& GetSegments()
+   {
+      return segments;
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// FileThrustProbe
+//------------------------------------------------------------------------------
+/**
+ * FileThrust that exposes its thrust and mass flow evaluation
+ */
+//------------------------------------------------------------------------------
+class FileThrustProbe : public FileThrust
+{
+public:
+   FileThrustProbe() : FileThrust("FileThrustProbe") {}
+
+   //---------------------------------------------------------------------------
+   // void Prepare()
+   //---------------------------------------------------------------------------
+   /**
+    * Builds the interpolating polynomials, as Initialize() does once the
+    * spacecraft are known
+    */
+   //---------------------------------------------------------------------------
+   void Prepare()
+   {
+      for (UnsignedInt i = 0; i < segments->size(); ++i)
+         (*segments)[i].segData.PrepareInterpolation();
+   }
+
+   void Evaluate(const GmatEpoch atEpoch, Real burnData[4])
+   {
+      ComputeAccelerationMassFlow(atEpoch, burnData);
+   }
+
+   void Evaluate(const GmatTime &atEpoch, Real burnData[4])
+   {
+      ComputeAccelerationMassFlow(atEpoch, burnData);
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void WriteSegment(std::ofstream &thf, const std::string &name,
+//       const std::string &start, const std::string &thrustMethod,
+//       const std::string &massMethod, const std::string &model,
+//       const Real *times, Integer count, Integer phase)
+//------------------------------------------------------------------------------
+/**
+ * Writes one segment of the thrust history file
+ *
+ * The vector components and mass flow are smooth functions of the node time,
+ * with a phase that differs between segments.  Nodes that repeat a time get
+ * different data, as a thrust step would.
+ */
+//------------------------------------------------------------------------------
+void WriteSegment(std::ofstream &thf, const std::string &name,
+      const std::string &start, const std::string &thrustMethod,
+      const std::string &massMethod, const std::string &model,
+      const Real *times, Integer count, Integer phase)
+{
+   bool includeMass = (model.find("MassRate") != std::string::npos);
+
+   thf << "BeginThrust{" << name << "}\n"
+       << "   Start_Epoch = " << start << "\n"
+       << "   Thrust_Vector_Coordinate_System = EarthMJ2000Eq\n"
+       << "   Thrust_Vector_Interpolation_Method = " << thrustMethod << "\n"
+       << "   Mass_Flow_Rate_Interpolation_Method = " << massMethod << "\n"
+       << "   " << model << "\n";
+
+   for (Integer i = 0; i < count; ++i)
+   {
+      Real x = 0.01 * times[i] + phase + (i > 0 && times[i] == times[i-1] ?
+            0.7 : 0.0);
+      thf << "   " << times[i]
+          << " " << 0.5 + 0.3 * sin(x)
+          << " " << -0.2 + 0.4 * cos(1.3 * x)
+          << " " << 0.1 * x - 0.05 * x * x;
+      if (includeMass)
+         thf << " " << -1.0e-3 * (1.5 + sin(0.7 * x));
+      thf << "\n";
+   }
+
+   thf << "EndThrust{" << name << "}\n\n";
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteFiles()
+//------------------------------------------------------------------------------
+/**
+ * Writes the thrust history file and the leap second file needed to read its
+ * epochs
+ */
+//------------------------------------------------------------------------------
+void WriteFiles()
+{
+   std::ofstream leap(LEAP_SECOND_FILE.c_str());
+   if (!leap)
+      throw GmatBaseException("Cannot write " + LEAP_SECOND_FILE);
+   leap << " 2017 JAN  1 =JD 2457754.5  TAI-UTC=  37.0       S + "
+           "(MJD - 41317.) X 0.0      S\n";
+   leap.close();
+
+   std::ofstream thf(THF_FILE.c_str());
+   if (!thf)
+      throw GmatBaseException("Cannot write " + THF_FILE);
+   thf << std::setprecision(17);
+
+   const Real stairs[] = {0, 60, 120, 180, 240, 300, 300, 360, 420, 480, 540,
+                          600};
+   const Real ramp[] = {0, 20, 55, 60, 60, 100, 170, 240, 300, 420, 600};
+   const Real spline[] = {0, 35, 90, 120, 200, 260, 330, 450, 520, 600, 700,
+                          850, 1000, 1200};
+   const Real splineThrust[] = {0, 30, 75, 120, 180, 250, 330, 400, 480};
+   const Real splineMass[] = {0, 40, 100, 200, 260, 390, 480};
+   const Real stairsSpline[] = {0, 90, 150, 300, 380, 540};
+   const Real shortSpline[] = {0, 100, 150, 300};
+   const Real accelSpline[] = {0, 60, 150, 210, 300};
+
+   // Stairs and Ramp meet at 00:10, Spline overlaps the end of Ramp, and
+   // SplineThrust follows a gap; the rest of the segments meet end to end.
+   // StairsSpline has no mass source, so its mass flow is dropped.
+   WriteSegment(thf, "Stairs", "01 Jan 2019 00:00:00.000", "None", "None",
+         "ModelThrustAndMassRate", stairs, 12, 0);
+   WriteSegment(thf, "Ramp", "01 Jan 2019 00:10:00.000", "Linear", "Linear",
+         "ModelThrustAndMassRate", ramp, 11, 1);
+   WriteSegment(thf, "Spline", "01 Jan 2019 00:15:00.000", "CubicSpline",
+         "CubicSpline", "ModelThrustAndMassRate", spline, 14, 2);
+   WriteSegment(thf, "SplineThrust", "01 Jan 2019 00:40:00.000",
+         "CubicSpline", "Linear", "ModelThrustAndMassRate", splineThrust, 9, 3);
+   WriteSegment(thf, "SplineMass", "01 Jan 2019 00:48:00.000", "Linear",
+         "CubicSpline", "ModelThrustAndMassRate", splineMass, 7, 4);
+   WriteSegment(thf, "StairsSpline", "01 Jan 2019 00:56:00.000", "None",
+         "CubicSpline", "ModelThrustAndMassRate", stairsSpline, 6, 5);
+   WriteSegment(thf, "Short", "01 Jan 2019 01:05:00.000", "CubicSpline",
+         "CubicSpline", "ModelThrustAndMassRate", shortSpline, 4, 6);
+   WriteSegment(thf, "AccelSpline", "01 Jan 2019 01:10:00.000", "CubicSpline",
+         "None", "ModelAccelOnly", accelSpline, 5, 7);
+   thf.close();
+}
+
+
+//------------------------------------------------------------------------------
+// void AddQuery(std::vector<Query> &queries, const ThfDataSegment &seg,
+//       Real offset)
+//------------------------------------------------------------------------------
+/**
+ * Adds the epoch an offset, in days, after a segment's start
+ */
+//------------------------------------------------------------------------------
+void AddQuery(std::vector<Query> &queries, const ThfDataSegment &seg,
+      Real offset)
+{
+   Query query;
+   query.epoch = seg.startEpoch + offset;
+   query.epochGT = seg.startEpochGT + offset;
+   query.atEnd = query.atEndGT = false;
+   queries.push_back(query);
+}
+
+
+//------------------------------------------------------------------------------
+// bool EarlierQuery(const Query &a, const Query &b)
+//------------------------------------------------------------------------------
+bool EarlierQuery(const Query &a, const Query &b)
+{
+   return a.epoch < b.epoch;
+}
+
+
+//------------------------------------------------------------------------------
+// std::vector<Query> BuildQueries(std::vector<ThrustSegment> &segments)
+//------------------------------------------------------------------------------
+/**
+ * Builds the query epochs: each node time with the offsets, the midpoints
+ * between nodes, and the segment limits with the offsets
+ */
+//------------------------------------------------------------------------------
+std::vector<Query> BuildQueries(std::vector<ThrustSegment> &segments)
+{
+   std::vector<Query> queries;
+   Real secToDay = 1.0 / GmatTimeConstants::SECS_PER_DAY;
+
+   for (UnsignedInt s = 0; s < segments.size(); ++s)
+   {
+      const ThfDataSegment &seg = segments[s].segData;
+      const std::vector<ThfDataSegment::ThrustPoint> &profile = seg.profile;
+      for (UnsignedInt i = 0; i < profile.size(); ++i)
+      {
+         for (Integer k = 0; k < OFFSET_COUNT; ++k)
+            AddQuery(queries, seg, profile[i].time +
+                  EPOCH_OFFSETS[k] * secToDay);
+         if (i + 1 < profile.size())
+            AddQuery(queries, seg,
+                  0.5 * (profile[i].time + profile[i+1].time));
+      }
+      // The exact segment limits
+      AddQuery(queries, seg, 0.0);
+      AddQuery(queries, seg, seg.endEpoch - seg.startEpoch);
+   }
+
+   // The gap, and epochs before and after the file
+   AddQuery(queries, segments.front().segData, -1.0);
+   AddQuery(queries, segments[3].segData, -150.0 * secToDay);
+   AddQuery(queries, segments.back().segData, 1.0);
+
+   // Flag the segment ends, in the first segment that covers each epoch
+   for (UnsignedInt i = 0; i < queries.size(); ++i)
+   {
+      for (UnsignedInt s = 0; s < segments.size(); ++s)
+      {
+         const ThfDataSegment &seg = segments[s].segData;
+         if ((seg.startEpoch <= queries[i].epoch) &&
+             (seg.endEpoch >= queries[i].epoch))
+         {
+            queries[i].atEnd = (seg.endEpoch == queries[i].epoch);
+            break;
+         }
+      }
+      for (UnsignedInt s = 0; s < segments.size(); ++s)
+      {
+         const ThfDataSegment &seg = segments[s].segData;
+         if ((seg.startEpochGT <= queries[i].epochGT) &&
+             (seg.endEpochGT >= queries[i].epochGT))
+         {
+            queries[i].atEndGT = (seg.endEpochGT == queries[i].epochGT);
+            break;
+         }
+      }
+   }
+
+   std::sort(queries.begin(), queries.end(), EarlierQuery);
+   return queries;
+}
+
+
+//------------------------------------------------------------------------------
+// bool SameData(const Real *a, const Real *b)
+//------------------------------------------------------------------------------
+/**
+ * Checks that the thrust and mass flow agree to within the tolerance
+ */
+//------------------------------------------------------------------------------
+bool SameData(const Real *a, const Real *b)
+{
+   for (Integer i = 0; i < 4; ++i)
+      if (!(fabs(a[i] - b[i]) <= TOLERANCE))
+         return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void RunScan(TestOutput &out, FileThrustProbe &force,
+//       FileThrustReference &ref, const std::vector<Query> &queries)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates every query through FileThrust and the reference
+ *
+ * At a segment's end epoch the old code replaced the last node's data with
+ * the spline loaded by the previous lookup, so its result there depended on
+ * the lookup order.  The reference is first evaluated just before the end, as
+ * a forward propagation would have done, so that it splines the last window.
+ */
+//------------------------------------------------------------------------------
+void RunScan(TestOutput &out, FileThrustProbe &force,
+      FileThrustReference &ref, const std::vector<Query> &queries)
+{
+   Integer mismatches = 0, mismatchesGT = 0, thrusting = 0, massFlows = 0,
+           ends = 0;
+   Real data[4], refData[4];
+
+   for (UnsignedInt i = 0; i < queries.size(); ++i)
+   {
+      force.Evaluate(queries[i].epoch, data);
+      if (queries[i].atEnd)
+      {
+         ++ends;
+         ref.ComputeAccelerationMassFlow(queries[i].epoch - END_LEAD, refData);
+      }
+      ref.ComputeAccelerationMassFlow(queries[i].epoch, refData);
+      if (!SameData(data, refData))
+         ++mismatches;
+      if (data[0] != 0.0)
+         ++thrusting;
+      if (data[3] != 0.0)
+         ++massFlows;
+
+      force.Evaluate(queries[i].epochGT, data);
+      if (queries[i].atEndGT)
+         ref.ComputeAccelerationMassFlow(queries[i].epochGT - END_LEAD,
+               refData);
+      ref.ComputeAccelerationMassFlow(queries[i].epochGT, refData);
+      if (!SameData(data, refData))
+         ++mismatchesGT;
+   }
+
+   out.Put("      Epochs:", (Integer)queries.size());
+   out.Put("      Epochs with thrust:", thrusting);
+   out.Put("      Epochs with mass flow:", massFlows);
+   out.Validate(massFlows > 0 && massFlows < thrusting, true);
+   out.Put("      Segment end epochs:", ends);
+   out.Validate(ends > 0, true);
+   out.Put("      GmatEpoch results that differ from the reference:",
+         mismatches);
+   out.Validate(mismatches, 0);
+   out.Put("      GmatTime results that differ from the reference:",
+         mismatchesGT);
+   out.Validate(mismatchesGT, 0);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   WriteFiles();
+   LeapSecsFileReader *leapSeconds = new LeapSecsFileReader(LEAP_SECOND_FILE);
+   leapSeconds->Initialize();
+   TimeSystemConverter::Instance()->SetLeapSecsFileReader(leapSeconds);
+
+   ThrustFileProbe thf;
+   thf.SetStringParameter("FileName", THF_FILE);
+   thf.ReadData();
+
+   std::vector<ThrustSegment> &segments = thf.GetSegments();
+   for (UnsignedInt i = 0; i < segments.size(); ++i)
+      if (segments[i].GetName() != "StairsSpline")
+         segments[i].SetStringParameter("MassSource", "Tank");
+   segments[4].SetRealParameter("ThrustScaleFactor", 2.5);
+   segments[4].SetRealParameter("MassFlowScaleFactor", 0.8);
+
+   FileThrustProbe force;
+   force.SetSegmentList(&segments);
+   force.Prepare();
+
+   // The old code read past the profile when splining a short segment; the
+   // reference gets the linear interpolation that now replaces it
+   std::vector<ThrustSegment> refSegments(segments);
+   refSegments[6].segData.accelIntType = ThfDataSegment::LINEAR;
+   refSegments[6].segData.massIntType = ThfDataSegment::LINEAR;
+   FileThrustReference ref(&refSegments);
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== File");
+   //---------------------------------------------------------------------------
+   out.Put("   Segments:", (Integer)segments.size());
+   out.Validate((Integer)segments.size(), 8);
+
+   ThfDataSegment &stairs = segments[0].segData;
+   Real values[4];
+   out.Put("   Offsets outside the profile are not interpolated:");
+   out.Validate(stairs.Interpolate(-1.0e-9, false, values), false);
+   out.Validate(stairs.Interpolate(stairs.profile.back().time, false, values),
+         false);
+   out.Validate(values[0], 0.0);
+   out.Put("   The end of the profile uses the last node:");
+   out.Validate(stairs.Interpolate(stairs.profile.back().time, true, values),
+         true);
+   out.Validate(values[0], stairs.profile.back().vector[0]);
+   out.Put("   A repeated node time uses the later node:");
+   stairs.Interpolate(stairs.profile[5].time, false, values);
+   out.Validate(values[0], stairs.profile[6].vector[0]);
+
+   std::vector<Query> queries = BuildQueries(segments);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Lookups");
+   //---------------------------------------------------------------------------
+   out.Put("   Forward:");
+   RunScan(out, force, ref, queries);
+
+   out.Put("   Backward:");
+   std::vector<Query> backward(queries.rbegin(), queries.rend());
+   RunScan(out, force, ref, backward);
+
+   out.Put("   Shuffled:");
+   std::vector<Query> shuffled(queries);
+   for (Integer i = (Integer)shuffled.size() - 1; i > 0; --i)
+   {
+      seed = seed * 1103515245u + 12345u;
+      std::swap(shuffled[i], shuffled[(seed >> 8) % (i + 1)]);
+   }
+   RunScan(out, force, ref, shuffled);
+
+   out.Put("   Repeated:");
+   std::vector<Query> repeated;
+   for (UnsignedInt i = 0; i < queries.size(); ++i)
+      repeated.insert(repeated.end(), 3, queries[i]);
+   RunScan(out, force, ref, repeated);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out(
+         "../../../test/TestUtil/TestThrustHistoryInterpolationOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran regression testing of the thrust history "
+            "interpolation!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
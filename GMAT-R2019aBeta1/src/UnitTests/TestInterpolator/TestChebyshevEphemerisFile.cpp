@@ -0,0 +1,457 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                          TestChebyshevEphemerisFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Round trip test of the Chebyshev ephemeris file.
+ *
+ * Writes two arcs of an eccentric Keplerian orbit, sampled once a minute and
+ * separated by a gap, then reads the file back with a new reader.  The header
+ * must return what was written, every sample must be reproduced to the fit
+ * tolerance, and the states between samples must follow the orbit.  The
+ * record found for epochs at and next to every bucket boundary and record
+ * boundary, in the gap and outside the file must be the one a search of the
+ * whole record directory finds.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include "UtilityException.hpp"
+#include "GmatConstants.hpp"
+#include "A1Mjd.hpp"
+#include "Rvector6.hpp"
+#include "ChebyshevEphemerisFile.hpp"
+
+using namespace std;
+
+/// The file written and read
+static const std::string FILE_NAME =
+      "../../../test/TestUtil/TestChebyshevEphemerisFile.cheb";
+
+/// Orbit: gravitational parameter (km^3/s^2), semimajor axis (km),
+/// eccentricity and orientation (rad)
+static const Real MU             = 398600.4418;
+static const Real SEMIMAJOR_AXIS = 9000.0;
+static const Real ECCENTRICITY   = 0.25;
+static const Real INCLINATION    = 0.6;
+static const Real RAAN           = 0.4;
+static const Real ARG_PERIAPSIS  = 1.0;
+/// A.1 epoch of the first sample, sample spacing (s), and the arcs, in days
+/// from the first sample
+static const Real START_EPOCH    = 21545.0;
+static const Real STEP_SIZE      = 60.0;
+static const Real ARCS[2][2]     = {{0.0, 1.0}, {1.25, 2.0}};
+/// Fit tolerance (km), and the errors allowed between the samples, in km and
+/// km/s.  The fit only holds the samples, so ten times the tolerances at the
+/// samples is allowed between them.
+static const Real FIT_TOLERANCE      = 1.0e-5;
+static const Real POSITION_TOLERANCE = 1.0e-4;
+static const Real VELOCITY_TOLERANCE = 10.0 * FIT_TOLERANCE / STEP_SIZE;
+/// Epoch step used next to the boundaries, in days
+static const Real NUDGE = 1.0e-9;
+
+//------------------------------------------------------------------------------
+// class IndexedFile
+//------------------------------------------------------------------------------
+/**
+ * Gives the test access to the record directory and bucket table
+ */
+//------------------------------------------------------------------------------
+class IndexedFile : public ChebyshevEphemerisFile
+{
+public:
+   Integer GetBucketCount()
+   {
+      return (Integer)buckets.size();
+   }
+
+   Real GetBucketWidth()
+   {
+      return bucketWidth;
+   }
+
+   //---------------------------------------------------------------------------
+   // Integer SearchRecords(GmatEpoch epoch)
+   //---------------------------------------------------------------------------
+   /**
+    * Finds the first record covering an epoch by checking them all
+    */
+   //---------------------------------------------------------------------------
+   Integer SearchRecords(GmatEpoch epoch)
+   {
+      for (UnsignedInt i = 0; i < records.size(); ++i)
+         if ((epoch >= records[i].recStart - 1.0e-10) &&
+             (epoch <= records[i].recStop + 1.0e-10))
+            return i;
+      return -1;
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// void OrbitState(Real t, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Keplerian state (km, km/s) at t seconds after periapsis
+ */
+//------------------------------------------------------------------------------
+void OrbitState(Real t, Real *state)
+{
+   Real n = sqrt(MU / (SEMIMAJOR_AXIS * SEMIMAJOR_AXIS * SEMIMAJOR_AXIS));
+   Real meanAnomaly = n * t, ecc = meanAnomaly;
+   for (Integer i = 0; i < 20; ++i)
+      ecc -= (ecc - ECCENTRICITY * sin(ecc) - meanAnomaly) /
+             (1.0 - ECCENTRICITY * cos(ecc));
+
+   Real root = sqrt(1.0 - ECCENTRICITY * ECCENTRICITY);
+   Real r = SEMIMAJOR_AXIS * (1.0 - ECCENTRICITY * cos(ecc));
+   Real p[2] = {SEMIMAJOR_AXIS * (cos(ecc) - ECCENTRICITY),
+                SEMIMAJOR_AXIS * root * sin(ecc)};
+   Real v[2] = {-sqrt(MU * SEMIMAJOR_AXIS) / r * sin(ecc),
+                 sqrt(MU * SEMIMAJOR_AXIS) / r * root * cos(ecc)};
+
+   // Perifocal to inertial
+   Real co = cos(RAAN), so = sin(RAAN), cw = cos(ARG_PERIAPSIS),
+        sw = sin(ARG_PERIAPSIS), ci = cos(INCLINATION), si = sin(INCLINATION);
+   Real pAxis[3] = {co * cw - so * sw * ci, so * cw + co * sw * ci, sw * si};
+   Real qAxis[3] = {-co * sw - so * cw * ci, -so * sw + co * cw * ci, cw * si};
+   for (Integer j = 0; j < 3; ++j)
+   {
+      state[j]   = p[0] * pAxis[j] + p[1] * qAxis[j];
+      state[j+3] = v[0] * pAxis[j] + v[1] * qAxis[j];
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real Seconds(GmatEpoch epoch)
+//------------------------------------------------------------------------------
+Real Seconds(GmatEpoch epoch)
+{
+   return (epoch - START_EPOCH) * GmatTimeConstants::SECS_PER_DAY;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer WriteFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes the two arcs
+ *
+ * @return The number of samples written
+ */
+//------------------------------------------------------------------------------
+Integer WriteFile()
+{
+   ChebyshevEphemerisFile writer;
+   writer.SetTolerance(FIT_TOLERANCE);
+   writer.SetCentralBody("Earth");
+   writer.SetCoordinateSystem("EarthMJ2000Eq");
+   if (!writer.OpenForWrite(FILE_NAME))
+      throw UtilityException("Cannot write " + FILE_NAME);
+
+   Integer samples = 0;
+   for (Integer arc = 0; arc < 2; ++arc)
+   {
+      std::vector<A1Mjd> epochs;
+      std::vector<Rvector6> states;
+      Real state[6];
+      for (Real t = ARCS[arc][0] * GmatTimeConstants::SECS_PER_DAY;
+           t <= ARCS[arc][1] * GmatTimeConstants::SECS_PER_DAY + 1.0;
+           t += STEP_SIZE)
+      {
+         OrbitState(t, state);
+         epochs.push_back(A1Mjd(START_EPOCH +
+               t / GmatTimeConstants::SECS_PER_DAY));
+         states.push_back(Rvector6(state));
+      }
+
+      EpochArray epochArray;
+      StateArray stateArray;
+      for (UnsignedInt i = 0; i < epochs.size(); ++i)
+      {
+         epochArray.push_back(&epochs[i]);
+         stateArray.push_back(&states[i]);
+      }
+      writer.WriteDataSegment(epochArray, stateArray);
+      samples += epochs.size();
+   }
+
+   writer.CloseForWrite();
+   return samples;
+}
+
+
+//------------------------------------------------------------------------------
+// void CompareState(const Rvector6 &state, Real t, Real posTol, Real velTol,
+//       Real &posErr, Real &velErr)
+//------------------------------------------------------------------------------
+/**
+ * Accumulates the largest differences between a state read from the file and
+ * the orbit, and counts the states outside of the tolerances
+ *
+ * @return 1 if the state is outside of a tolerance, 0 if not
+ */
+//------------------------------------------------------------------------------
+Integer CompareState(const Rvector6 &state, Real t, Real posTol, Real velTol,
+      Real &posErr, Real &velErr)
+{
+   Real expected[6];
+   OrbitState(t, expected);
+
+   Real dr = 0.0, dv = 0.0;
+   for (Integer j = 0; j < 3; ++j)
+   {
+      dr += (state[j] - expected[j]) * (state[j] - expected[j]);
+      dv += (state[j+3] - expected[j+3]) * (state[j+3] - expected[j+3]);
+   }
+   dr = sqrt(dr);
+   dv = sqrt(dv);
+
+   if (dr > posErr)
+      posErr = dr;
+   if (dv > velErr)
+      velErr = dv;
+   return ((dr > posTol) || (dv > velTol) ? 1 : 0);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CheckLookup(IndexedFile &reader, GmatEpoch epoch)
+//------------------------------------------------------------------------------
+/**
+ * Checks the record found for an epoch against the full search
+ *
+ * @return 1 if the records differ, 0 if they match
+ */
+//------------------------------------------------------------------------------
+Integer CheckLookup(IndexedFile &reader, GmatEpoch epoch)
+{
+   return (reader.FindSegment(epoch) == reader.SearchRecords(epoch) ? 0 : 1);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Integer samples = WriteFile();
+
+   IndexedFile reader;
+   reader.OpenForRead(FILE_NAME);
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Header");
+   //---------------------------------------------------------------------------
+   GmatEpoch start, end;
+   reader.GetStartAndEndEpochs(start, end);
+   out.Put("   Central body and coordinate system:");
+   out.Validate(reader.GetCentralBody(), "Earth");
+   out.Validate(reader.GetCoordinateSystem(), "EarthMJ2000Eq");
+   out.Put("   Tolerance:", reader.GetTolerance());
+   out.Validate(reader.GetTolerance(), FIT_TOLERANCE, 0.0);
+   out.Put("   Span:");
+   out.Validate(start, START_EPOCH + ARCS[0][0], 1.0e-12);
+   out.Validate(end, START_EPOCH + ARCS[1][1], 1.0e-12);
+
+   Integer recordCount = reader.GetRecordCount();
+   out.Put("   Samples written:", samples);
+   out.Put("   Records:", recordCount);
+   out.Validate((recordCount > 2) && (recordCount < samples / 20), true);
+
+   std::ifstream file(FILE_NAME.c_str(), std::ios::binary | std::ios::ate);
+   Integer bytes = (Integer)file.tellg();
+   out.Put("   File size, bytes:", bytes);
+   out.Put("   Size of the samples as 7 doubles each:", samples * 56);
+   out.Validate(bytes < samples * 56 / 4, true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Fit");
+   //---------------------------------------------------------------------------
+   // The velocity tolerance at the samples is the fit tolerance per sample
+   // spacing
+   Real posErr = 0.0, velErr = 0.0;
+   Integer outside = 0, checked = 0, missing = 0;
+   Rvector6 state;
+   for (Integer arc = 0; arc < 2; ++arc)
+   {
+      for (Real t = ARCS[arc][0] * GmatTimeConstants::SECS_PER_DAY;
+           t <= ARCS[arc][1] * GmatTimeConstants::SECS_PER_DAY + 1.0;
+           t += STEP_SIZE)
+      {
+         // Reproduce the epoch as it was written
+         GmatEpoch epoch = START_EPOCH + t / GmatTimeConstants::SECS_PER_DAY;
+         if (!reader.GetState(epoch, state))
+            ++missing;
+         outside += CompareState(state, t, FIT_TOLERANCE,
+               FIT_TOLERANCE / STEP_SIZE, posErr, velErr);
+         ++checked;
+      }
+   }
+   out.Put("   Samples checked:", checked);
+   out.Validate(checked, samples);
+   out.Put("   Samples not covered by a record:", missing);
+   out.Validate(missing, 0);
+   out.Put("   Largest position error at the samples, km:", posErr);
+   out.Put("   Largest velocity error at the samples, km/s:", velErr);
+   out.Put("   Samples outside of the fit tolerance:", outside);
+   out.Validate(outside, 0);
+
+   posErr = velErr = 0.0;
+   outside = checked = 0;
+   for (Integer arc = 0; arc < 2; ++arc)
+   {
+      for (Real t = ARCS[arc][0] * GmatTimeConstants::SECS_PER_DAY + 7.3;
+           t < ARCS[arc][1] * GmatTimeConstants::SECS_PER_DAY;
+           t += 0.71 * STEP_SIZE)
+      {
+         GmatEpoch epoch = START_EPOCH + t / GmatTimeConstants::SECS_PER_DAY;
+         outside += CompareState(reader.InterpolatePoint(epoch), t,
+               POSITION_TOLERANCE, VELOCITY_TOLERANCE, posErr, velErr);
+         ++checked;
+      }
+   }
+   out.Put("   Epochs checked between the samples:", checked);
+   out.Put("   Largest position error between the samples, km:", posErr);
+   out.Put("   Largest velocity error between the samples, km/s:", velErr);
+   out.Put("   States outside of the tolerances:", outside);
+   out.Validate(outside, 0);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Lookups");
+   //---------------------------------------------------------------------------
+   Integer bucketCount = reader.GetBucketCount();
+   Real bucketWidth = reader.GetBucketWidth();
+   Integer mismatches = 0;
+   checked = 0;
+   for (Integer i = 0; i <= bucketCount; ++i)
+   {
+      GmatEpoch boundary = start + i * bucketWidth;
+      for (Integer k = -1; k <= 1; ++k)
+      {
+         mismatches += CheckLookup(reader, boundary + k * NUDGE);
+         ++checked;
+      }
+   }
+   out.Put("   Bucket boundary epochs checked:", checked);
+   out.Put("   Records that differ from the full search:", mismatches);
+   out.Validate(mismatches, 0);
+
+   mismatches = checked = 0;
+   Integer sampleTotal = 0;
+   for (Integer i = 0; i < recordCount; ++i)
+   {
+      GmatEpoch recStart, recStop;
+      Integer count;
+      reader.GetRecordSpan(i, recStart, recStop, count);
+      sampleTotal += count;
+      for (Integer k = -1; k <= 1; ++k)
+      {
+         mismatches += CheckLookup(reader, recStart + k * NUDGE);
+         mismatches += CheckLookup(reader, recStop + k * NUDGE);
+         checked += 2;
+      }
+
+      // Both fits hold at a shared boundary
+      if (i > 0)
+      {
+         GmatEpoch lastStart, lastStop;
+         reader.GetRecordSpan(i - 1, lastStart, lastStop, count);
+         if (lastStop == recStart)
+         {
+            Rvector6 before, after;
+            reader.GetRecordState(i - 1, recStart, before);
+            reader.GetRecordState(i, recStart, after);
+            Real t = Seconds(recStart);
+            Real pe = 0.0, ve = 0.0;
+            mismatches += CompareState(before, t, FIT_TOLERANCE,
+                  FIT_TOLERANCE / STEP_SIZE, pe, ve);
+            mismatches += CompareState(after, t, FIT_TOLERANCE,
+                  FIT_TOLERANCE / STEP_SIZE, pe, ve);
+         }
+      }
+   }
+   out.Put("   Record boundary epochs checked:", checked);
+   out.Put("   Records that differ from the full search, or boundary states "
+         "outside of the fit tolerance:", mismatches);
+   out.Validate(mismatches, 0);
+   // Records share their boundary samples within an arc
+   out.Put("   Samples in the records:", sampleTotal);
+   out.Validate(sampleTotal, samples + recordCount - 2);
+
+   out.Put("   Records found in the gap and outside of the file:");
+   GmatEpoch gap = START_EPOCH + 0.5 * (ARCS[0][1] + ARCS[1][0]);
+   out.Validate(reader.FindSegment(gap), -1);
+   out.Validate(reader.FindSegment(start - 1.0e-6), -1);
+   out.Validate(reader.FindSegment(end + 1.0e-6), -1);
+   out.Validate(reader.GetState(gap, state), false);
+
+   bool thrown = false;
+   try
+   {
+      reader.InterpolatePoint(gap);
+   }
+   catch (BaseException &)
+   {
+      thrown = true;
+   }
+   out.Put("   InterpolatePoint throws in the gap:");
+   out.Validate(thrown, true);
+
+   reader.CloseForRead();
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestChebyshevEphemerisFileOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the Chebyshev ephemeris "
+            "file!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,218 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestEphemerisWindow
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for copies of the EphemerisWindow.
+ *
+ * Loads a window from a circular orbit and interpolates in it, so its weights
+ * are ready, then copies it with the copy constructor and by assignment over
+ * an empty window and over a smaller loaded one.  Every copy must interpolate
+ * exactly the states the original does, between the nodes and at a node, and
+ * the original must match the analytic orbit.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include "GmatConstants.hpp"
+#include "EphemerisWindow.hpp"
+
+using namespace std;
+
+/// Orbit radius (km), mean motion (rad/s) and inclination (rad)
+static const Real ORBIT_RADIUS   = 7000.0;
+static const Real MEAN_MOTION    = 1.078e-3;
+static const Real INCLINATION    = 0.5;
+/// Node spacing, in seconds, and node count
+static const Real STEP_SIZE      = 60.0;
+static const Integer NODE_COUNT  = 9;
+/// A.1 epoch of the first node
+static const Real START_EPOCH    = 21545.0;
+/// Allowed interpolation error against the orbit, in km and km/s
+static const Real POSITION_TOLERANCE = 1.0e-6;
+static const Real VELOCITY_TOLERANCE = 1.0e-8;
+
+//------------------------------------------------------------------------------
+// void OrbitState(Real t, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Analytic circular orbit state (km, km/s) at t seconds
+ */
+//------------------------------------------------------------------------------
+void OrbitState(Real t, Real *state)
+{
+   Real c = cos(MEAN_MOTION * t), s = sin(MEAN_MOTION * t);
+   Real ci = cos(INCLINATION), si = sin(INCLINATION);
+   Real v = ORBIT_RADIUS * MEAN_MOTION;
+   state[0] = ORBIT_RADIUS * c;
+   state[1] = ORBIT_RADIUS * s * ci;
+   state[2] = ORBIT_RADIUS * s * si;
+   state[3] = -v * s;
+   state[4] = v * c * ci;
+   state[5] = v * c * si;
+}
+
+
+//------------------------------------------------------------------------------
+// Real Epoch(Real t)
+//------------------------------------------------------------------------------
+Real Epoch(Real t)
+{
+   return START_EPOCH + t / GmatTimeConstants::SECS_PER_DAY;
+}
+
+
+//------------------------------------------------------------------------------
+// void Load(EphemerisWindow &window, Integer count)
+//------------------------------------------------------------------------------
+/**
+ * Loads a window with the first count nodes of the orbit
+ */
+//------------------------------------------------------------------------------
+void Load(EphemerisWindow &window, Integer count)
+{
+   Real state[6];
+   window.Start(0, 0, START_EPOCH);
+   for (Integer i = 0; i < count; ++i)
+   {
+      OrbitState(i * STEP_SIZE, state);
+      window.AddNode(Epoch(i * STEP_SIZE), state);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void CompareWindows(TestOutput &out, EphemerisWindow &copy,
+//       EphemerisWindow &original)
+//------------------------------------------------------------------------------
+/**
+ * Checks that a copy interpolates the same states as the original
+ *
+ * The copy is queried first, so it cannot rely on work the original does for
+ * the same epoch.
+ */
+//------------------------------------------------------------------------------
+void CompareWindows(TestOutput &out, EphemerisWindow &copy,
+      EphemerisWindow &original)
+{
+   // Between nodes, and at a node
+   const Real times[3] = {130.0, 247.5, 4.0 * STEP_SIZE};
+   Real fromCopy[6], fromOriginal[6];
+
+   for (Integer i = 0; i < 3; ++i)
+   {
+      out.Put("   Elements at t (s):", times[i]);
+      out.Validate(copy.Interpolate(Epoch(times[i]), fromCopy), true);
+      original.Interpolate(Epoch(times[i]), fromOriginal);
+      for (Integer j = 0; j < 6; ++j)
+         out.Validate(fromCopy[j], fromOriginal[j], 0.0);
+
+      out.Put("   Cartesian state at t (s):", times[i]);
+      out.Validate(copy.InterpolateCartesianState(Epoch(times[i]), fromCopy),
+            true);
+      original.InterpolateCartesianState(Epoch(times[i]), fromOriginal);
+      for (Integer j = 0; j < 6; ++j)
+         out.Validate(fromCopy[j], fromOriginal[j], 0.0);
+   }
+
+   out.Put("   The copy holds the original's nodes:");
+   out.Validate(copy.IsLoaded(0, 0, NODE_COUNT), true);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   EphemerisWindow original;
+   Load(original, NODE_COUNT);
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Original window");
+   //---------------------------------------------------------------------------
+   Real state[6], expected[6];
+   Real t = 247.5;
+   OrbitState(t, expected);
+   out.Validate(original.InterpolateCartesianState(Epoch(t), state), true);
+   for (Integer i = 0; i < 6; ++i)
+      out.Validate(state[i], expected[i],
+            (i < 3 ? POSITION_TOLERANCE : VELOCITY_TOLERANCE));
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Copy constructor");
+   //---------------------------------------------------------------------------
+   EphemerisWindow constructed(original);
+   CompareWindows(out, constructed, original);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Assigned to an empty "
+         "window");
+   //---------------------------------------------------------------------------
+   EphemerisWindow empty;
+   empty = original;
+   CompareWindows(out, empty, original);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Assigned over a "
+         "smaller window");
+   //---------------------------------------------------------------------------
+   EphemerisWindow smaller;
+   Load(smaller, 3);
+   smaller.Interpolate(Epoch(30.0), state);
+   smaller = original;
+   CompareWindows(out, smaller, original);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestEphemerisWindowOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of ephemeris window copies!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
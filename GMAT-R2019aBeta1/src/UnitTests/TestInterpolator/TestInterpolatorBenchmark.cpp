@@ -0,0 +1,271 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                           TestInterpolatorBenchmark
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Benchmark for the Lagrange and Hermite interpolators.
+ *
+ * Interpolates a circular orbit sampled every minute at orders 7 through 15.
+ * The Lagrange pass feeds points one at a time and interpolates between them,
+ * as the ephemeris writers do during propagation.  The Hermite pass loads a
+ * window of positions and velocities and interpolates repeatedly inside it,
+ * as ephemeris readers do.  Each pass reports its throughput and its largest
+ * error against the analytic orbit.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <ctime>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "LagrangeInterpolator.hpp"
+#include "HermiteInterpolator.hpp"
+
+using namespace std;
+
+/// Orbit radius (km), mean motion (rad/s) and inclination (rad)
+static const Real ORBIT_RADIUS   = 7000.0;
+static const Real MEAN_MOTION    = 1.078e-3;
+static const Real INCLINATION    = 0.5;
+/// Sample spacing, in seconds
+static const Real STEP_SIZE      = 60.0;
+/// Number of points fed to the Lagrange interpolator
+static const Integer POINT_COUNT = 20000;
+/// Interpolations per step in the Lagrange pass
+static const Integer LAGRANGE_QUERIES = 8;
+/// Windows loaded and interpolations per window in the Hermite pass
+static const Integer WINDOW_COUNT = 2000;
+static const Integer HERMITE_QUERIES = 50;
+
+//------------------------------------------------------------------------------
+// Real ElapsedSeconds(std::clock_t start)
+//------------------------------------------------------------------------------
+Real ElapsedSeconds(std::clock_t start)
+{
+   return (Real)(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+
+//------------------------------------------------------------------------------
+// void OrbitState(Real t, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Analytic circular orbit state (km, km/s) at t seconds
+ */
+//------------------------------------------------------------------------------
+void OrbitState(Real t, Real *state)
+{
+   Real c = cos(MEAN_MOTION * t), s = sin(MEAN_MOTION * t);
+   Real ci = cos(INCLINATION), si = sin(INCLINATION);
+   Real v = ORBIT_RADIUS * MEAN_MOTION;
+
+   state[0] = ORBIT_RADIUS * c;
+   state[1] = ORBIT_RADIUS * s * ci;
+   state[2] = ORBIT_RADIUS * s * si;
+   state[3] = -v * s;
+   state[4] =  v * c * ci;
+   state[5] =  v * c * si;
+}
+
+
+//------------------------------------------------------------------------------
+// Real PositionError(const Real *state, const Real *truth)
+//------------------------------------------------------------------------------
+Real PositionError(const Real *state, const Real *truth)
+{
+   return sqrt((state[0] - truth[0]) * (state[0] - truth[0]) +
+               (state[1] - truth[1]) * (state[1] - truth[1]) +
+               (state[2] - truth[2]) * (state[2] - truth[2]));
+}
+
+
+//------------------------------------------------------------------------------
+// Real VelocityError(const Real *state, const Real *truth)
+//------------------------------------------------------------------------------
+Real VelocityError(const Real *state, const Real *truth)
+{
+   return PositionError(state + 3, truth + 3);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunLagrange(TestOutput &out, Integer order)
+//------------------------------------------------------------------------------
+void RunLagrange(TestOutput &out, Integer order)
+{
+   LagrangeInterpolator interp("", 6, order);
+   Real state[6], truth[6];
+   Integer calls = 0;
+   Real maxPosError = 0.0, maxVelError = 0.0;
+
+   // Interpolate across the step that is centered in the buffer once the
+   // newest point has been added
+   Real lag = STEP_SIZE * ((order + 1) / 2);
+
+   std::clock_t start = std::clock();
+   for (Integer i = 0; i < POINT_COUNT; ++i)
+   {
+      Real t = i * STEP_SIZE;
+      OrbitState(t, state);
+      interp.AddPoint(t, state);
+
+      for (Integer q = 0; q < LAGRANGE_QUERIES; ++q)
+      {
+         Real ti = t - lag + STEP_SIZE * (q + 0.5) / LAGRANGE_QUERIES;
+         if (ti < 0.0)
+            continue;
+         if (interp.Interpolate(ti, state))
+         {
+            ++calls;
+            OrbitState(ti, truth);
+            Real dp = PositionError(state, truth);
+            Real dv = VelocityError(state, truth);
+            if (dp > maxPosError)
+               maxPosError = dp;
+            if (dv > maxVelError)
+               maxVelError = dv;
+         }
+      }
+   }
+   Real elapsed = ElapsedSeconds(start);
+
+   out.Put("Lagrange order:          ", order);
+   out.Put("   Interpolations:       ", calls);
+   out.Put("   Time (s):             ", elapsed);
+   if (elapsed > 0.0)
+      out.Put("   Calls per second:     ", calls / elapsed);
+   out.Put("   Max position err (km):", maxPosError);
+   out.Put("   Max velocity err (km/s):", maxVelError);
+}
+
+
+//------------------------------------------------------------------------------
+// void RunHermite(TestOutput &out, Integer order)
+//------------------------------------------------------------------------------
+void RunHermite(TestOutput &out, Integer order)
+{
+   // With a derivative at each point, order/2 + 1 points give the same
+   // polynomial degree as the Lagrange interpolator of that order
+   Integer points = order / 2 + 1;
+   HermiteInterpolator interp("", 6, points - 1);
+   Real state[6], truth[6], deriv[6];
+   Integer calls = 0;
+   Real maxPosError = 0.0, maxVelError = 0.0;
+
+   std::clock_t start = std::clock();
+   for (Integer w = 0; w < WINDOW_COUNT; ++w)
+   {
+      // Offsets are measured from the window start to keep them small
+      Real epoch = w * STEP_SIZE;
+      interp.Clear();
+      for (Integer i = 0; i < points; ++i)
+      {
+         OrbitState(epoch + i * STEP_SIZE, state);
+         interp.AddPoint(i * STEP_SIZE, state);
+      }
+      for (Integer i = 0; i < points; ++i)
+      {
+         OrbitState(epoch + i * STEP_SIZE, state);
+         for (Integer j = 0; j < 3; ++j)
+         {
+            deriv[j]   = state[j+3];
+            deriv[j+3] = -9.999999999e99;
+         }
+         interp.AddDerivative(i * STEP_SIZE, deriv);
+      }
+
+      // Query the middle step of the window
+      Real first = STEP_SIZE * ((points - 1) / 2);
+      for (Integer q = 0; q < HERMITE_QUERIES; ++q)
+      {
+         Real ti = first + STEP_SIZE * (q + 0.5) / HERMITE_QUERIES;
+         if (interp.InterpolateCartesianState(ti, state))
+         {
+            ++calls;
+            OrbitState(epoch + ti, truth);
+            Real dp = PositionError(state, truth);
+            Real dv = VelocityError(state, truth);
+            if (dp > maxPosError)
+               maxPosError = dp;
+            if (dv > maxVelError)
+               maxVelError = dv;
+         }
+      }
+   }
+   Real elapsed = ElapsedSeconds(start);
+
+   out.Put("Hermite order:           ", order);
+   out.Put("   Points per window:    ", points);
+   out.Put("   Interpolations:       ", calls);
+   out.Put("   Time (s):             ", elapsed);
+   if (elapsed > 0.0)
+      out.Put("   Calls per second:     ", calls / elapsed);
+   out.Put("   Max position err (km):", maxPosError);
+   out.Put("   Max velocity err (km/s):", maxVelError);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   //---------------------------------------------------------------------------
+   out.Put("======================================== LagrangeInterpolator");
+   //---------------------------------------------------------------------------
+   for (Integer order = 7; order <= 15; ++order)
+      RunLagrange(out, order);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== HermiteInterpolator");
+   //---------------------------------------------------------------------------
+   for (Integer order = 7; order <= 15; ++order)
+      RunHermite(out, order);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestInterpolatorBenchmarkOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran interpolator benchmark!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+   }
+
+   cout << endl;
+}
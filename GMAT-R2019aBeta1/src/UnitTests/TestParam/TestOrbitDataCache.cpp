@@ -0,0 +1,195 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestOrbitDataCache
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the state conversion cache shared by the orbit parameters.
+ *
+ * Reports a set of orbit parameters on two spacecraft, in several coordinate
+ * systems and about two origins, from one report file, so that the
+ * parameters share cache entries and interleave between them.  Each
+ * parameter is then reported alone in its own run, where it cannot use
+ * another parameter's conversions.  The test fails unless every value matches
+ * exactly.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+
+using namespace std;
+
+/// The parameters reported; entries on the same object and frame share
+/// conversions
+static const std::string PARAMETERS[] =
+{
+   "Sat1.EarthFixed.X",       "Sat1.EarthMJ2000Ec.VY",
+   "Sat1.MoonInertial.Z",     "Sat1.Earth.SMA",
+   "Sat1.EarthMJ2000Ec.INC",  "Sat1.EarthFixed.RAAN",
+   "Sat1.EarthMJ2000Ec.AOP",  "Sat1.Earth.ECC",
+   "Sat1.Earth.TA",           "Sat1.EarthFixed.RA",
+   "Sat2.EarthFixed.Y",       "Sat2.MoonInertial.VX",
+   "Sat2.Earth.RMAG",         "Sat2.EarthMJ2000Ec.DEC",
+   "Sat2.Luna.SMA",           "Sat2.EarthMJ2000Ec.RAAN"
+};
+static const Integer PARAMETER_COUNT =
+   sizeof(PARAMETERS) / sizeof(PARAMETERS[0]);
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(const ScenarioRunner &runner,
+//       const std::string &name, const StringArray &parameters)
+//------------------------------------------------------------------------------
+/**
+ * Builds a script that propagates both spacecraft and reports the epoch and
+ * the given parameters at every step
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(const ScenarioRunner &runner, const std::string &name,
+      const StringArray &parameters)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestOrbitDataCache\n\n"
+          << "Create Spacecraft Sat1 Sat2;\n"
+          << "Sat1.Epoch = '01 Jan 2015 00:00:00.000';\n"
+          << "Sat1.DisplayStateType = Keplerian;\n"
+          << "Sat1.SMA = 7000;\n"
+          << "Sat1.ECC = 0.01;\n"
+          << "Sat1.INC = 51.6;\n"
+          << "Sat1.RAAN = 30;\n"
+          << "Sat2.Epoch = '01 Jan 2015 00:00:00.000';\n"
+          << "Sat2.DisplayStateType = Keplerian;\n"
+          << "Sat2.SMA = 26000;\n"
+          << "Sat2.ECC = 0.7;\n"
+          << "Sat2.INC = 63.4;\n"
+          << "Sat2.AOP = 270;\n\n"
+          << "Create CoordinateSystem MoonInertial;\n"
+          << "MoonInertial.Origin = Luna;\n"
+          << "MoonInertial.Axes = MJ2000Eq;\n\n"
+          << "Create ForceModel FM;\n"
+          << "FM.CentralBody = Earth;\n"
+          << "FM.PrimaryBodies = {Earth};\n\n"
+          << "Create Propagator Prop;\n"
+          << "Prop.FM = FM;\n"
+          << "Prop.Type = RungeKutta89;\n\n"
+          << "Create ReportFile Values;\n"
+          << "Values.Filename = '" << runner.GetReportFile(name) << "';\n"
+          << "Values.WriteHeaders = false;\n"
+          << "Values.Precision = 16;\n"
+          << "Values.Add = {Sat1.A1ModJulian";
+   for (UnsignedInt i = 0; i < parameters.size(); ++i)
+      script << ", " << parameters[i];
+   script << "};\n\n"
+          << "BeginMissionSequence;\n"
+          << "Propagate Prop(Sat1, Sat2) {Sat1.ElapsedDays = 0.25};\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "OrbitDataCache");
+   runner.Initialize();
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Shared conversions");
+   //---------------------------------------------------------------------------
+   StringArray all(PARAMETERS, PARAMETERS + PARAMETER_COUNT);
+   runner.Run("All", BuildScript(runner, "All", all), false);
+
+   std::vector<RealArray> shared;
+   if (!runner.ReadRows("All", shared))
+      throw GmatBaseException("The shared parameter values were not reported");
+   for (UnsignedInt j = 0; j < shared.size(); ++j)
+      if ((Integer)shared[j].size() != PARAMETER_COUNT + 1)
+         throw GmatBaseException("A row of the shared parameter report is "
+               "incomplete");
+   out.Put("   Rows reported:", (Integer)shared.size());
+
+   for (Integer i = 0; i < PARAMETER_COUNT; ++i)
+   {
+      //------------------------------------------------------------------------
+      out.Put("\n======================================== " + PARAMETERS[i]);
+      //------------------------------------------------------------------------
+      std::stringstream name;
+      name << "Alone" << i;
+      runner.Run(name.str(), BuildScript(runner, name.str(),
+            StringArray(1, PARAMETERS[i])), false);
+
+      std::vector<RealArray> alone;
+      runner.ReadRows(name.str(), alone);
+      out.Put("   Same number of rows:");
+      out.Validate((Integer)alone.size(), (Integer)shared.size());
+
+      Real maxDiff = 0.0;
+      for (UnsignedInt j = 0; j < alone.size(); ++j)
+      {
+         if (alone[j].size() != 2)
+            throw GmatBaseException("A row of the " + PARAMETERS[i] +
+                  " report is incomplete");
+         maxDiff = fmax(maxDiff, fabs(alone[j][0] - shared[j][0]));
+         maxDiff = fmax(maxDiff, fabs(alone[j][1] - shared[j][i+1]));
+      }
+      out.Put("   Largest difference from the shared run:");
+      out.Validate(maxDiff, 0.0, 0.0);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestOrbitDataCacheOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the orbit data cache!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,272 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestParameterLookup
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver and benchmark for parameter label lookup.
+ *
+ * Looks up the label of every parameter ID of a Spacecraft, an Array and a
+ * Variable, and fails unless each label maps to an ID with that label.  The
+ * Spacecraft label aliases must map to the same IDs as the labels they stand
+ * for.
+ *
+ * Then times the label based access used while a script is parsed against
+ * the ID based access the element wrappers use when Assignment commands
+ * execute, and fails unless both leave the same values.  The assignment loop
+ * mimics a mission sequence made of many "Sat.Property = Arr(i,j)" style
+ * commands.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <ctime>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "Spacecraft.hpp"
+#include "Array.hpp"
+#include "Variable.hpp"
+#include "NumberWrapper.hpp"
+#include "ObjectPropertyWrapper.hpp"
+#include "ArrayElementWrapper.hpp"
+
+using namespace std;
+
+static const Integer REPEAT_COUNT = 200000;
+
+//------------------------------------------------------------------------------
+// Real ElapsedSeconds(std::clock_t start)
+//------------------------------------------------------------------------------
+Real ElapsedSeconds(std::clock_t start)
+{
+   return (Real)(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CheckLabels(TestOutput &out, GmatBase *obj)
+//------------------------------------------------------------------------------
+/**
+ * Looks up the label of each parameter ID of an object and checks that it
+ * maps back to an ID with the same label
+ *
+ * IDs without a label are skipped.  Labels used by more than one ID may map
+ * to any of them.
+ *
+ * @return The number of labels that did not map back
+ */
+//------------------------------------------------------------------------------
+Integer CheckLabels(TestOutput &out, GmatBase *obj)
+{
+   Integer checked = 0, mismatches = 0;
+   for (Integer id = 0; id < obj->GetParameterCount(); ++id)
+   {
+      std::string label;
+      try
+      {
+         label = obj->GetParameterText(id);
+      }
+      catch (BaseException &)
+      {
+         continue;
+      }
+      if (label == "")
+         continue;
+
+      ++checked;
+      std::string found;
+      try
+      {
+         found = obj->GetParameterText(obj->GetParameterID(label));
+      }
+      catch (BaseException &e)
+      {
+         found = e.GetFullMessage();
+      }
+      if (found != label)
+      {
+         out.Put("   *** " + label + " maps to " + found);
+         ++mismatches;
+      }
+   }
+
+   out.Put("   " + obj->GetTypeName() + " labels checked:", checked);
+   return mismatches;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Spacecraft *sat = new Spacecraft("Sat");
+   Array *arr = new Array("Arr");
+   arr->SetSize(3, 3);
+   Variable *var = new Variable("Var");
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Label round trip");
+   //---------------------------------------------------------------------------
+   Integer mismatches = CheckLabels(out, sat) + CheckLabels(out, arr) +
+                        CheckLabels(out, var);
+   out.Put("   Labels that do not map back:");
+   out.Validate(mismatches, 0);
+
+   // Aliases resolve to the IDs of the labels they stand for
+   out.Put("   Spacecraft aliases:");
+   Integer cartX = sat->GetParameterID("CartesianX");
+   out.Validate(sat->GetParameterID("CartesianState"), cartX);
+   out.Validate(sat->GetParameterID("KeplerianState"), cartX);
+   out.Validate(sat->GetParameterID("OrbitSTM"), sat->GetParameterID("STM"));
+   out.Validate(sat->GetParameterID("OrbitAMatrix"),
+         sat->GetParameterID("AMatrix"));
+
+   // Labels from the front, middle and end of the Spacecraft tables
+   const std::string labels[] = {"X", "SMA", "DryMass", "Cd", "Cr",
+                                 "DragArea", "SRPArea", "ModelScale"};
+   const Integer labelCount = 8;
+   Integer ids[labelCount];
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== GetParameterID()");
+   //---------------------------------------------------------------------------
+   for (Integer i = 0; i < labelCount; ++i)
+   {
+      ids[i] = sat->GetParameterID(labels[i]);
+      out.Put(labels[i] + " -> ", ids[i]);
+   }
+
+   std::clock_t start = std::clock();
+   Integer sum = 0;
+   for (Integer n = 0; n < REPEAT_COUNT; ++n)
+      for (Integer i = 0; i < labelCount; ++i)
+         sum += sat->GetParameterID(labels[i]);
+   Real lookupTime = ElapsedSeconds(start);
+   out.Put("Lookups performed:      ", REPEAT_COUNT * labelCount);
+   out.Put("Lookup time (s):        ", lookupTime);
+   out.Put("Checksum:               ", sum);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Assignment sequence");
+   //---------------------------------------------------------------------------
+   // Sat.DryMass = Arr(2,3); Arr(1,1) = Sat.Cd
+   ObjectPropertyWrapper *massWrapper = new ObjectPropertyWrapper();
+   massWrapper->SetDescription("Sat.DryMass");
+   massWrapper->SetRefObject(sat);
+
+   ObjectPropertyWrapper *cdWrapper = new ObjectPropertyWrapper();
+   cdWrapper->SetDescription("Sat.Cd");
+   cdWrapper->SetRefObject(sat);
+
+   ArrayElementWrapper *elementWrapper = new ArrayElementWrapper();
+   elementWrapper->SetDescription("Arr(2,3)");
+   NumberWrapper *row = new NumberWrapper();
+   row->SetDescription("2");
+   NumberWrapper *col = new NumberWrapper();
+   col->SetDescription("3");
+   elementWrapper->SetRow(row);
+   elementWrapper->SetColumn(col);
+   elementWrapper->SetRefObject(arr);
+
+   ArrayElementWrapper *cornerWrapper = new ArrayElementWrapper();
+   cornerWrapper->SetDescription("Arr(1,1)");
+   NumberWrapper *row1 = new NumberWrapper();
+   row1->SetDescription("1");
+   NumberWrapper *col1 = new NumberWrapper();
+   col1->SetDescription("1");
+   cornerWrapper->SetRow(row1);
+   cornerWrapper->SetColumn(col1);
+   cornerWrapper->SetRefObject(arr);
+
+   // Label based access, as done before the IDs were cached
+   start = std::clock();
+   for (Integer n = 0; n < REPEAT_COUNT; ++n)
+   {
+      arr->SetRealParameter("SingleValue", 800.0 + (n % 100), 1, 2);
+      sat->SetRealParameter("DryMass",
+            arr->GetRealParameter("SingleValue", 1, 2));
+      arr->SetRealParameter("SingleValue", sat->GetRealParameter("Cd"), 0, 0);
+   }
+   Real labelTime = ElapsedSeconds(start);
+   Real labelMass = sat->GetRealParameter("DryMass");
+   Real labelCorner = arr->GetRealParameter("SingleValue", 0, 0);
+
+   sat->SetRealParameter("DryMass", 0.0);
+   arr->SetRealParameter("SingleValue", 0.0, 0, 0);
+   arr->SetRealParameter("SingleValue", 0.0, 1, 2);
+
+   // ID based access through the wrappers
+   start = std::clock();
+   for (Integer n = 0; n < REPEAT_COUNT; ++n)
+   {
+      elementWrapper->SetReal(800.0 + (n % 100));
+      massWrapper->SetReal(elementWrapper->EvaluateReal());
+      cornerWrapper->SetReal(cdWrapper->EvaluateReal());
+   }
+   Real wrapperTime = ElapsedSeconds(start);
+
+   out.Put("Assignments performed:  ", REPEAT_COUNT * 3);
+   out.Put("Label access time (s):  ", labelTime);
+   out.Put("Wrapper access time (s):", wrapperTime);
+   out.Put("Final DryMass matches the label access:");
+   out.Validate(sat->GetRealParameter("DryMass"), labelMass, 0.0);
+   out.Put("Final Arr(1,1) matches the label access:");
+   out.Validate(arr->GetRealParameter("SingleValue", 0, 0), labelCorner, 0.0);
+
+   delete massWrapper;
+   delete cdWrapper;
+   delete elementWrapper;
+   delete cornerWrapper;
+   delete var;
+   delete arr;
+   delete sat;
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestParameterLookupOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of parameter lookup!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
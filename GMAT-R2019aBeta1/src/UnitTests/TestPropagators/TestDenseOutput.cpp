@@ -0,0 +1,252 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestDenseOutput
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the dense output of the Runge-Kutta integrators.
+ *
+ * Each integrator takes one step of a low Earth orbit in a two-body field.
+ * The state interpolated at the middle of that step with GetDenseState() is
+ * compared with the state propagated to the same time by a second copy of the
+ * integrator.  The test also checks that steps are only recorded once dense
+ * output is enabled, and the number of derivative evaluations reported for
+ * each step, which then includes an end point evaluation for each tableau
+ * that does not evaluate its last stage at the propagated state.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <string>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "PropagatorException.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include "PhysicalModel.hpp"
+#include "RungeKutta89.hpp"
+#include "RungeKuttaFehlberg56.hpp"
+#include "PrinceDormand45.hpp"
+#include "PrinceDormand78.hpp"
+#include "DormandElMikkawyPrince68.hpp"
+
+using namespace std;
+
+/// Earth gravitational parameter, km^3/s^2
+static const Real MU = 398600.4415;
+/// Largest step taken, in seconds
+static const Real MAX_STEP = 120.0;
+/// Tolerance on the interpolated position, in km
+static const Real POSITION_TOLERANCE = 2.0e-6;
+/// Tolerance on the interpolated velocity, in km/s
+static const Real VELOCITY_TOLERANCE = 1.0e-9;
+
+
+/**
+ * Point mass gravity for a single Cartesian state
+ */
+class TwoBodyModel : public PhysicalModel
+{
+public:
+   TwoBodyModel() :
+      PhysicalModel  (Gmat::PHYSICAL_MODEL, "TwoBodyModel", "")
+   {
+      dimension = 6;
+   }
+
+   TwoBodyModel(const TwoBodyModel &tbm) :
+      PhysicalModel  (tbm)
+   {
+   }
+
+   virtual GmatBase* Clone() const
+   {
+      return new TwoBodyModel(*this);
+   }
+
+   virtual bool HasLocalClones()
+   {
+      return false;
+   }
+
+   virtual bool RenameRefObject(const UnsignedInt type,
+         const std::string &oldName, const std::string &newName)
+   {
+      return true;
+   }
+
+   virtual bool GetDerivatives(Real *state, Real dt = 0.0, Integer order = 1,
+         const Integer id = -1)
+   {
+      Real r = sqrt(state[0]*state[0] + state[1]*state[1] +
+                    state[2]*state[2]);
+      Real mu_r3 = -MU / (r * r * r);
+
+      for (Integer i = 0; i < 3; ++i)
+      {
+         if (order == 1)
+         {
+            deriv[i]   = state[i+3];
+            deriv[i+3] = mu_r3 * state[i];
+         }
+         else
+         {
+            deriv[i]   = mu_r3 * state[i];
+            deriv[i+3] = 0.0;
+         }
+      }
+      return true;
+   }
+};
+
+
+//------------------------------------------------------------------------------
+// TwoBodyModel* Connect(Propagator *prop, const Real *start)
+//------------------------------------------------------------------------------
+/**
+ * Connects a new two-body model, set to the start state, to an integrator
+ */
+//------------------------------------------------------------------------------
+TwoBodyModel* Connect(Propagator *prop, const Real *start)
+{
+   TwoBodyModel *model = new TwoBodyModel;
+   prop->SetRealParameter("Accuracy", 1.0e-12);
+   prop->SetRealParameter("InitialStepSize", MAX_STEP);
+   prop->SetRealParameter("MaxStep", MAX_STEP);
+   prop->SetPhysicalModel(model);
+   if (!prop->Initialize())
+      throw PropagatorException(prop->GetTypeName() + " did not initialize");
+   model->SetState(start);
+   return model;
+}
+
+
+//------------------------------------------------------------------------------
+// void TestIntegrator(TestOutput &out, Propagator *prop, Integer stages,
+//       bool fsal)
+//------------------------------------------------------------------------------
+/**
+ * Compares the dense state at the middle of a step with a propagated state
+ *
+ * @param out    The test output
+ * @param prop   The integrator tested; it is deleted by this function
+ * @param stages The number of stages in the integrator's tableau
+ * @param fsal   true if the last stage is evaluated at the propagated state
+ */
+//------------------------------------------------------------------------------
+void TestIntegrator(TestOutput &out, Propagator *prop, Integer stages,
+      bool fsal)
+{
+   // 7000 km circular orbit, inclined 28.5 degrees
+   Real vc = sqrt(MU / 7000.0);
+   Real inc = 28.5 * GmatMathConstants::RAD_PER_DEG;
+   Real start[6] = {7000.0, 0.0, 0.0, 0.0, vc * cos(inc), vc * sin(inc)};
+
+   out.Put("\n======================================== " +
+         prop->GetTypeName());
+
+   Propagator *ref = (Propagator*)prop->Clone();
+   TwoBodyModel *model = Connect(prop, start);
+   TwoBodyModel *refModel = Connect(ref, start);
+
+   // Steps are not recorded, or paid for, until dense output is requested
+   out.Put("   Dense output before it is enabled:");
+   out.Validate(prop->HasDenseOutput(), false);
+   out.Put("   Derivative calls per step: ", prop->GetDerivativeCallsPerStep());
+   out.Validate(prop->GetDerivativeCallsPerStep(), stages);
+
+   prop->EnableDenseOutput(true);
+   out.Put("   Dense output once it is enabled:");
+   out.Validate(prop->HasDenseOutput(), true);
+   out.Put("   Derivative calls per step: ", prop->GetDerivativeCallsPerStep());
+   out.Validate(prop->GetDerivativeCallsPerStep(), stages + (fsal ? 0 : 1));
+
+   if (!prop->Step())
+      throw PropagatorException(prop->GetTypeName() + " failed to step");
+
+   Real h = prop->GetDenseStepSize();
+   out.Put("   Step size:    ", h);
+   out.Validate(h > 0.0, true);
+
+   Real dense[6];
+   out.Put("   Dense state at the middle of the step:");
+   out.Validate(prop->GetDenseState(0.5 * h, dense), true);
+
+   if (!ref->Step(0.5 * h))
+      throw PropagatorException(ref->GetTypeName() + " failed to step");
+   Real *mid = refModel->GetState();
+
+   for (Integer i = 0; i < 6; ++i)
+   {
+      Real tolerance = (i < 3 ? POSITION_TOLERANCE : VELOCITY_TOLERANCE);
+      out.Put("   Element ", i);
+      out.Validate(dense[i], mid[i], tolerance);
+   }
+
+   delete prop;
+   delete ref;
+   delete model;
+   delete refModel;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   // Only PrinceDormand45 evaluates its last stage at the propagated state
+   TestIntegrator(out, new RungeKutta89, 16, false);
+   TestIntegrator(out, new RungeKuttaFehlberg56, 8, false);
+   TestIntegrator(out, new PrinceDormand45, 7, true);
+   TestIntegrator(out, new PrinceDormand78, 13, false);
+   TestIntegrator(out, new DormandElMikkawyPrince68, 9, false);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestDenseOutputOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of integrator dense output!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
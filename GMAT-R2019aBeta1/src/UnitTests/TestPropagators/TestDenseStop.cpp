@@ -0,0 +1,211 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                TestDenseStop
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for stops located on the dense output of the integrators.
+ *
+ * Propagates an orbit through a series of stopping conditions twice: once
+ * with the stops located on the triggering step's dense output, and once with
+ * Prop.UseDenseOutput = false, so each stop is found by propagating the ring
+ * buffer and searching it with the Brent-Dekker method as before.  Every stop
+ * must be reached at the same epoch and in the same state in both runs.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <cmath>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "ScenarioRunner.hpp"
+#include "GmatBaseException.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
+
+using namespace std;
+
+/// The stopping conditions, in the order they are propagated to
+static const char *STOPS[] =
+{
+   "Sat.Periapsis",
+   "Sat.Earth.TA = 90",
+   "Sat.EarthMJ2000Eq.Z = 0",
+   "Sat.Apoapsis",
+   "Sat.Earth.RMAG = 7100",
+   "Sat.EarthMJ2000Eq.VZ = 0"
+};
+static const Integer STOP_COUNT = sizeof(STOPS) / sizeof(STOPS[0]);
+
+/// Allowed differences between the runs at each stop, in s, km and km/s
+static const Real EPOCH_TOLERANCE    = 1.0e-5;
+static const Real POSITION_TOLERANCE = 1.0e-4;
+static const Real VELOCITY_TOLERANCE = 1.0e-7;
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(const ScenarioRunner &runner,
+//       const std::string &name, bool dense)
+//------------------------------------------------------------------------------
+/**
+ * Builds a script that reports the epoch and state at each stop
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(const ScenarioRunner &runner, const std::string &name,
+      bool dense)
+{
+   std::stringstream script;
+
+   script << "% Generated by TestDenseStop\n\n"
+          << "Create Spacecraft Sat;\n"
+          << "Sat.Epoch = '01 Jan 2015 00:00:00.000';\n"
+          << "Sat.DisplayStateType = Keplerian;\n"
+          << "Sat.SMA = 7200;\n"
+          << "Sat.ECC = 0.02;\n"
+          << "Sat.INC = 51.6;\n"
+          << "Sat.RAAN = 30;\n"
+          << "Sat.AOP = 45;\n"
+          << "Sat.TA = 10;\n\n"
+          << "Create ForceModel FM;\n"
+          << "FM.CentralBody = Earth;\n"
+          << "FM.PrimaryBodies = {Earth};\n"
+          << "FM.GravityField.Earth.Degree = 8;\n"
+          << "FM.GravityField.Earth.Order = 8;\n"
+          << "FM.PointMasses = {Luna, Sun};\n\n"
+          << "Create Propagator Prop;\n"
+          << "Prop.FM = FM;\n"
+          << "Prop.Type = RungeKutta89;\n"
+          << "Prop.MaxStep = 600;\n"
+          << "Prop.UseDenseOutput = " << (dense ? "true" : "false")
+          << ";\n\n"
+          << "Create ReportFile Stops;\n"
+          << "Stops.Filename = '" << runner.GetReportFile(name) << "';\n"
+          << "Stops.WriteHeaders = false;\n"
+          << "Stops.Precision = 16;\n\n"
+          << "BeginMissionSequence;\n";
+   for (Integer i = 0; i < STOP_COUNT; ++i)
+      script << "Propagate Prop(Sat) {" << STOPS[i] << "};\n"
+             << "Report Stops Sat.A1ModJulian Sat.EarthMJ2000Eq.X "
+                "Sat.EarthMJ2000Eq.Y Sat.EarthMJ2000Eq.Z "
+                "Sat.EarthMJ2000Eq.VX Sat.EarthMJ2000Eq.VY "
+                "Sat.EarthMJ2000Eq.VZ;\n";
+
+   return script.str();
+}
+
+
+//------------------------------------------------------------------------------
+// void ReadStops(const ScenarioRunner &runner, const std::string &name,
+//       std::vector<RealArray> &rows)
+//------------------------------------------------------------------------------
+/**
+ * Reads the epoch and state reported at each stop
+ */
+//------------------------------------------------------------------------------
+void ReadStops(const ScenarioRunner &runner, const std::string &name,
+      std::vector<RealArray> &rows)
+{
+   if (!runner.ReadRows(name, rows) || ((Integer)rows.size() != STOP_COUNT))
+      throw GmatBaseException("The " + name + " run did not report every "
+            "stop");
+   for (UnsignedInt i = 0; i < rows.size(); ++i)
+      if (rows[i].size() != 7)
+         throw GmatBaseException("A row of the " + name + " report is "
+               "incomplete");
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   ScenarioRunner runner(out, "DenseStop");
+   runner.Initialize();
+   RunProfiler *profiler = RunProfiler::Instance();
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Ring buffer stops");
+   //---------------------------------------------------------------------------
+   runner.Run("RingBuffer", BuildScript(runner, "RingBuffer", false));
+   out.Put("   No stop is located on dense output:");
+   out.Validate((Integer)profiler->GetCount("Dense Output Stop Searches"), 0);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Dense output stops");
+   //---------------------------------------------------------------------------
+   runner.Run("Dense", BuildScript(runner, "Dense", true));
+   out.Put("   Stops located on dense output:");
+   out.Validate((Integer)profiler->GetCount("Dense Output Stop Searches") > 0,
+         true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Comparison");
+   //---------------------------------------------------------------------------
+   std::vector<RealArray> ref, dense;
+   ReadStops(runner, "RingBuffer", ref);
+   ReadStops(runner, "Dense", dense);
+
+   for (Integer i = 0; i < STOP_COUNT; ++i)
+   {
+      out.Put(std::string("   Stop at ") + STOPS[i]);
+      out.Put("      Epoch difference (s):");
+      out.Validate((dense[i][0] - ref[i][0]) *
+            GmatTimeConstants::SECS_PER_DAY, 0.0, EPOCH_TOLERANCE);
+      out.Put("      Position difference (km):");
+      out.Validate(ScenarioRunner::Distance(&dense[i][1], &ref[i][1]), 0.0,
+            POSITION_TOLERANCE);
+      out.Put("      Velocity difference (km/s):");
+      out.Validate(ScenarioRunner::Distance(&dense[i][4], &ref[i][4]), 0.0,
+            VELOCITY_TOLERANCE);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestDenseStopOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of dense output stops!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
@@ -0,0 +1,193 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TestRunProfiler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the RunProfiler.
+ *
+ * Checks counter registration, that counts and stage samples are only taken
+ * while the profiler is enabled, that Reset() and MarkInterval() start the
+ * totals over, and that the text report and JSON output carry the registered
+ * counters.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "BaseException.hpp"
+#include "MessageInterface.hpp"
+#include "StringUtil.hpp"
+#include "RunProfiler.hpp"
+
+using namespace std;
+
+
+//------------------------------------------------------------------------------
+// bool Contains(const std::string &text, const std::string &part)
+//------------------------------------------------------------------------------
+bool Contains(const std::string &text, const std::string &part)
+{
+   return text.find(part) != std::string::npos;
+}
+
+
+//------------------------------------------------------------------------------
+// std::string ReportLine(const std::string &name, long long count)
+//------------------------------------------------------------------------------
+/**
+ * Builds the line the text report writes for a counter
+ */
+//------------------------------------------------------------------------------
+std::string ReportLine(const std::string &name, long long count)
+{
+   std::stringstream line;
+   line << " " << GmatStringUtil::GetAlignmentString(name, 30)
+        << std::setw(14) << count << "\n";
+   return line.str();
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   RunProfiler *profiler = RunProfiler::Instance();
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== Counter registration");
+   //---------------------------------------------------------------------------
+   Integer first = RunProfiler::RegisterCounter("Test Widgets");
+   Integer second = RunProfiler::RegisterCounter("Test Gadgets");
+   out.Put("   Registered IDs are valid and distinct:");
+   out.Validate(first >= 0, true);
+   out.Validate(second >= 0, true);
+   out.Validate(first != second, true);
+   out.Put("   Registering a name again returns its ID:");
+   out.Validate(RunProfiler::RegisterCounter("Test Widgets"), first);
+   out.Put("   Names are kept with the IDs:");
+   out.Validate(profiler->GetCounterName(first) == "Test Widgets", true);
+   out.Validate(profiler->GetCounterName(second) == "Test Gadgets", true);
+   out.Validate(profiler->GetCounterCount() > second, true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Enabled gate");
+   //---------------------------------------------------------------------------
+   profiler->SetEnabled(false);
+   profiler->Reset();
+   RunProfiler::Count(first, 5);
+   {
+      ProfileScope timer(RunProfiler::PROPAGATION);
+   }
+   out.Put("   Nothing is counted while the profiler is off:");
+   out.Validate(RunProfiler::IsEnabled(), false);
+   out.Validate((Integer)profiler->GetCount(first), 0);
+   out.Validate(Contains(profiler->GetJson(),
+         "\"Propagation\": { \"calls\": 0,"), true);
+
+   profiler->SetEnabled(true);
+   RunProfiler::Count(first);
+   RunProfiler::Count(first, 4);
+   RunProfiler::Count(second, 2);
+   RunProfiler::Count(-1);
+   {
+      ProfileScope timer(RunProfiler::PROPAGATION);
+   }
+   out.Put("   Counts accumulate while the profiler is on:");
+   out.Validate((Integer)profiler->GetCount(first), 5);
+   out.Validate((Integer)profiler->GetCount(second), 2);
+   out.Put("   Counts are found by name:");
+   out.Validate((Integer)profiler->GetCount("Test Widgets"), 5);
+   out.Validate((Integer)profiler->GetCount("No Such Counter"), 0);
+   out.Put("   The stage sample is recorded:");
+   out.Validate(Contains(profiler->GetJson(),
+         "\"Propagation\": { \"calls\": 1,"), true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Reports");
+   //---------------------------------------------------------------------------
+   std::string report = profiler->GetReportTable("Test", false);
+   out.Put("   The text report lists each registered counter:");
+   out.Validate(Contains(report, ReportLine("Test Widgets", 5)), true);
+   out.Validate(Contains(report, ReportLine("Test Gadgets", 2)), true);
+
+   profiler->MarkInterval("First");
+   RunProfiler::Count(first, 3);
+   report = profiler->GetReportTable("Test", true);
+   out.Put("   The report since the mark holds only the new counts:");
+   out.Validate(Contains(report, ReportLine("Test Widgets", 3)), true);
+   out.Validate(Contains(report, ReportLine("Test Gadgets", 0)), true);
+   report = profiler->GetReportTable("Test", false);
+   out.Put("   The run totals are kept:");
+   out.Validate(Contains(report, ReportLine("Test Widgets", 8)), true);
+
+   std::string json = profiler->GetJson();
+   out.Put("   The JSON holds the interval and the totals:");
+   out.Validate(Contains(json, "\"label\": \"First\""), true);
+   out.Validate(Contains(json, "\"TestWidgets\": 5"), true);
+   out.Validate(Contains(json, "\"TestWidgets\": 8"), true);
+   out.Validate(Contains(json, "\"TestGadgets\": 2"), true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Reset");
+   //---------------------------------------------------------------------------
+   profiler->Reset();
+   out.Put("   Reset clears the counts but keeps the registrations:");
+   out.Validate((Integer)profiler->GetCount(first), 0);
+   out.Validate((Integer)profiler->GetCount(second), 0);
+   out.Validate(RunProfiler::RegisterCounter("Test Gadgets"), second);
+   out.Validate(Contains(profiler->GetJson(), "\"label\": \"First\""), false);
+
+   profiler->SetEnabled(false);
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestRunProfilerOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of the run profiler!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
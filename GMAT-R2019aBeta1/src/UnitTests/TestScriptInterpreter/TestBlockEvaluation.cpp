@@ -0,0 +1,303 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             TestBlockEvaluation
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Test driver for the evaluation of script blocks ahead of the build pass.
+ *
+ * Generates a script of well over PARALLEL_BLOCK_COUNT logical blocks, mixing
+ * comment-only blocks, inline comments, continued lines, object definitions,
+ * field settings and a mission sequence with nested control logic.  The
+ * script is interpreted with each block evaluated in order as it is built,
+ * then with the blocks evaluated ahead on one thread and on THREAD_COUNT
+ * threads.  The test fails unless every run builds the same objects and
+ * commands, compared through the script written back from them.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "GmatBaseException.hpp"
+#include "MessageInterface.hpp"
+#include "Moderator.hpp"
+#include "ScriptInterpreter.hpp"
+#include "GmatCommand.hpp"
+
+using namespace std;
+
+/// Number of object groups in the generated script
+static const Integer GROUP_COUNT = 40;
+/// Smallest number of logical blocks the script must hold
+static const Integer MIN_BLOCK_COUNT = 256;
+/// Number of threads used for the threaded evaluation
+static const Integer THREAD_COUNT = 4;
+
+/// Objects and commands built from a script
+struct BuildResult
+{
+   std::string script;
+   Integer     objects;
+   Integer     commands;
+};
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(Integer groups)
+//------------------------------------------------------------------------------
+/**
+ * Builds a script with a set of objects and commands for each group
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(Integer groups)
+{
+   std::stringstream resources, mission;
+
+   resources << "% Generated by TestBlockEvaluation\n\n"
+             << "Create ForceModel FM;\n"
+             << "FM.CentralBody = Earth;\n"
+             << "FM.PrimaryBodies = {Earth};\n\n"
+             << "Create Propagator Prop;\n"
+             << "Prop.FM = FM;\n"
+             << "Prop.Type = RungeKutta89;\n\n"
+             << "Create DifferentialCorrector DC;\n\n";
+
+   mission << "BeginMissionSequence;\n";
+
+   for (Integer i = 0; i < groups; ++i)
+   {
+      std::stringstream sat, burn;
+      sat << "Sat" << i;
+      burn << "Burn" << i;
+
+      resources << "%----- Group " << i << "\n\n"
+                << "Create Spacecraft " << sat.str() << ";\n"
+                << "GMAT " << sat.str() << ".DateFormat = UTCGregorian;\n"
+                << sat.str() << ".Epoch = '01 Jan 2000 11:59:28.000';\n"
+                << sat.str() << ".DisplayStateType = Keplerian;\n"
+                << sat.str() << ".SMA = " << 7000 + i << ";   % inline\n"
+                << sat.str() << ".ECC = 0.001;\n"
+                << sat.str() << ".INC = 28.5;\n"
+                << "% A comment-only block\n\n"
+                << "Create ImpulsiveBurn " << burn.str() << ";\n"
+                << burn.str() << ".Axes = VNB;\n"
+                << "Create Variable Dv" << i << " Count" << i << ";\n"
+                << "Create Array Offsets" << i << "[3,1];\n"
+                << "Create String Label" << i << ";\n"
+                << "Label" << i << " = 'Group " << i << "';\n\n";
+
+      mission << "Dv" << i << " = 0.001 * " << i << " + ...\n"
+              << "      0.0001;\n"
+              << "If Dv" << i << " > 0.002   % inline\n"
+              << "   " << burn.str() << ".Element1 = Dv" << i << ";\n"
+              << "Else\n"
+              << "   " << burn.str() << ".Element1 = 0.001;\n"
+              << "EndIf;\n"
+              << "For Count" << i << " = 1:3\n"
+              << "   Offsets" << i << "(Count" << i << ",1) = " << sat.str()
+              << ".SMA - 7000;\n"
+              << "EndFor;\n"
+              << "Target DC;\n"
+              << "   Vary DC(Dv" << i << " = 0.001, {Perturbation = 1e-5});\n"
+              << "   Maneuver " << burn.str() << "(" << sat.str() << ");\n"
+              << "   Propagate Prop(" << sat.str() << ") {" << sat.str()
+              << ".Apoapsis};\n"
+              << "   Achieve DC(" << sat.str() << ".RMAG = " << 7100 + i
+              << ", {Tolerance = 0.1});\n"
+              << "EndTarget;\n"
+              << "% Comment between commands\n\n";
+   }
+
+   return resources.str() + mission.str();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CountInstructions(const std::string &script)
+//------------------------------------------------------------------------------
+/**
+ * Counts the instructions in a script, each of which starts a logical block
+ *
+ * Blocks holding only comments are not counted, so the script has at least
+ * this many blocks.
+ */
+//------------------------------------------------------------------------------
+Integer CountInstructions(const std::string &script)
+{
+   std::istringstream lines(script);
+   std::string line;
+   Integer count = 0;
+   bool continued = false;
+   while (std::getline(lines, line))
+   {
+      std::string::size_type first = line.find_first_not_of(" \t");
+      bool instruction = (first != std::string::npos) && (line[first] != '%');
+      if (instruction && !continued)
+         ++count;
+      continued = instruction &&
+            (line.find("...") != std::string::npos);
+   }
+   return count;
+}
+
+
+//------------------------------------------------------------------------------
+// BuildResult Interpret(const std::string &script, bool ahead,
+//       Integer threads)
+//------------------------------------------------------------------------------
+/**
+ * Interprets a script and writes back the objects and commands built
+ *
+ * @param script  The script text
+ * @param ahead   true to evaluate the blocks before the build pass
+ * @param threads Number of threads evaluating the blocks ahead
+ *
+ * @return The script written back, with the object and command counts
+ */
+//------------------------------------------------------------------------------
+BuildResult Interpret(const std::string &script, bool ahead, Integer threads)
+{
+   Moderator *mod = Moderator::Instance();
+   ScriptInterpreter *interp = Moderator::GetScriptInterpreter();
+
+   interp->SetBlockEvaluation(ahead, threads);
+   std::istringstream *ss = new std::istringstream(script);
+   bool success = mod->InterpretScript(ss, true);
+   delete ss;
+   interp->SetBlockEvaluation(true);
+
+   if (!success)
+      throw GmatBaseException("The generated script did not build");
+
+   BuildResult result;
+   result.script  = mod->GetScript();
+   result.objects =
+         (Integer) mod->GetListOfObjects(Gmat::UNKNOWN_OBJECT).size();
+   result.commands = 0;
+   for (GmatCommand *cmd = mod->GetFirstCommand(); cmd != NULL;
+        cmd = cmd->GetNext())
+      ++result.commands;
+
+   return result;
+}
+
+
+//------------------------------------------------------------------------------
+// void Compare(TestOutput &out, const BuildResult &expect,
+//       const BuildResult &actual)
+//------------------------------------------------------------------------------
+/**
+ * Checks that two runs built the same objects and commands
+ */
+//------------------------------------------------------------------------------
+void Compare(TestOutput &out, const BuildResult &expect,
+      const BuildResult &actual)
+{
+   out.Put("   Objects:       ", actual.objects);
+   out.Validate(actual.objects, expect.objects);
+   out.Put("   Commands:      ", actual.commands);
+   out.Validate(actual.commands, expect.commands);
+
+   // Report the first line that differs before failing
+   std::istringstream expectLines(expect.script), actualLines(actual.script);
+   std::string expectLine, actualLine;
+   Integer lineNumber = 0;
+   while (std::getline(expectLines, expectLine))
+   {
+      ++lineNumber;
+      if (!std::getline(actualLines, actualLine) || (actualLine != expectLine))
+      {
+         out.Put("   *** Line ", lineNumber);
+         out.Put("   Expected: " + expectLine);
+         out.Put("   Found:    " + actualLine);
+         break;
+      }
+   }
+
+   out.Put("   Same script written back:");
+   out.Validate(actual.script == expect.script, true);
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize())
+      throw GmatBaseException("Moderator failed to initialize");
+
+   std::string script = BuildScript(GROUP_COUNT);
+   Integer blocks = CountInstructions(script);
+   out.Put("Logical blocks:   ", blocks);
+   out.Put("   Enough blocks for the threaded evaluation:");
+   out.Validate(blocks >= MIN_BLOCK_COUNT, true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== In order");
+   //---------------------------------------------------------------------------
+   BuildResult serial = Interpret(script, false, 1);
+   out.Put("   Objects:       ", serial.objects);
+   out.Put("   Commands:      ", serial.commands);
+   out.Put("   Script written back:");
+   out.Validate(serial.script != "", true);
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Ahead, one thread");
+   //---------------------------------------------------------------------------
+   Compare(out, serial, Interpret(script, true, 1));
+
+   //---------------------------------------------------------------------------
+   out.Put("\n======================================== Ahead, threaded");
+   //---------------------------------------------------------------------------
+   Compare(out, serial, Interpret(script, true, THREAD_COUNT));
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestBlockEvaluationOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran unit testing of script block evaluation!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
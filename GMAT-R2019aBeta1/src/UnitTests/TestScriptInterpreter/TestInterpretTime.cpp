@@ -0,0 +1,170 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              TestInterpretTime
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Benchmark for script interpretation.
+ *
+ * Generates scripts of increasing length, each made of spacecraft, burn and
+ * variable definitions, field settings and a mission sequence of assignments
+ * and maneuvers, and reports the time the ScriptInterpreter takes to build
+ * each one against its line count.  Wall clock time is reported because the
+ * logical blocks are evaluated on several threads.
+ */
+//------------------------------------------------------------------------------
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <chrono>
+#include "gmatdefs.hpp"
+#include "TestOutput.hpp"
+#include "MessageInterface.hpp"
+#include "Moderator.hpp"
+
+using namespace std;
+
+/// Number of object groups in the smallest and largest scripts
+static const Integer FIRST_GROUP_COUNT = 25;
+static const Integer LAST_GROUP_COUNT  = 3200;
+
+//------------------------------------------------------------------------------
+// std::string BuildScript(Integer groups)
+//------------------------------------------------------------------------------
+/**
+ * Builds a script with a set of objects and commands for each group
+ */
+//------------------------------------------------------------------------------
+std::string BuildScript(Integer groups)
+{
+   std::stringstream resources, mission;
+
+   resources << "% Generated by TestInterpretTime\n\n";
+   mission << "BeginMissionSequence;\n";
+
+   for (Integer i = 0; i < groups; ++i)
+   {
+      resources << "%----- Group " << i << "\n"
+                << "Create Spacecraft Sat" << i << ";\n"
+                << "Sat" << i << ".DateFormat = UTCGregorian;\n"
+                << "Sat" << i << ".Epoch = '01 Jan 2000 11:59:28.000';\n"
+                << "Sat" << i << ".CoordinateSystem = EarthMJ2000Eq;\n"
+                << "Sat" << i << ".DisplayStateType = Keplerian;\n"
+                << "Sat" << i << ".SMA = " << 7000 + i << ";\n"
+                << "Sat" << i << ".ECC = 0.001;\n"
+                << "Sat" << i << ".INC = 28.5;   % inline comment\n"
+                << "Sat" << i << ".DryMass = 850;\n\n"
+                << "Create ImpulsiveBurn Burn" << i << ";\n"
+                << "Burn" << i << ".CoordinateSystem = Local;\n"
+                << "Burn" << i << ".Origin = Earth;\n"
+                << "Burn" << i << ".Axes = VNB;\n"
+                << "Burn" << i << ".Element1 = 0.01;\n\n"
+                << "Create Variable Dv" << i << " Count" << i << ";\n"
+                << "Create Array Offsets" << i << "[3,1];\n\n";
+
+      mission << "Dv" << i << " = 0.001 * " << i << ";\n"
+              << "Burn" << i << ".Element1 = Dv" << i << ";\n"
+              << "Maneuver Burn" << i << "(Sat" << i << ");\n"
+              << "Count" << i << " = Count" << i << " + 1;\n"
+              << "Offsets" << i << "(2,1) = Sat" << i << ".SMA - 7000;\n";
+   }
+
+   return resources.str() + mission.str();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer CountLines(const std::string &script)
+//------------------------------------------------------------------------------
+Integer CountLines(const std::string &script)
+{
+   Integer lines = 0;
+   for (std::string::size_type i = 0; i < script.size(); ++i)
+      if (script[i] == '\n')
+         ++lines;
+   return lines;
+}
+
+
+//------------------------------------------------------------------------------
+// int RunTest(TestOutput &out)
+//------------------------------------------------------------------------------
+int RunTest(TestOutput &out)
+{
+   Moderator *mod = Moderator::Instance();
+   if (!mod->Initialize())
+      throw GmatBaseException("Moderator failed to initialize");
+
+   //---------------------------------------------------------------------------
+   out.Put("======================================== ScriptInterpreter");
+   //---------------------------------------------------------------------------
+   for (Integer groups = FIRST_GROUP_COUNT; groups <= LAST_GROUP_COUNT;
+        groups *= 2)
+   {
+      std::string script = BuildScript(groups);
+      Integer lines = CountLines(script);
+      std::istringstream *ss = new std::istringstream(script);
+
+      std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+      bool success = mod->InterpretScript(ss, true);
+      Real elapsed = std::chrono::duration<Real>(
+            std::chrono::steady_clock::now() - start).count();
+      delete ss;
+
+      out.Put("Script lines:            ", lines);
+      out.Put("   Interpreted:          ", success);
+      out.Put("   Time (s):             ", elapsed);
+      if (elapsed > 0.0)
+         out.Put("   Lines per second:     ", lines / elapsed);
+      if (lines > 0)
+         out.Put("   Time per line (us):   ", elapsed * 1.0e6 / lines);
+   }
+
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// int main(int argc, char *argv[])
+//------------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+   MessageInterface::SetLogFile("../../../test/TestUtil/GmatLog.txt");
+   TestOutput out("../../../test/TestUtil/TestInterpretTimeOut.txt");
+
+   try
+   {
+      RunTest(out);
+      out.Put("\nSuccessfully ran script interpreter benchmark!!");
+   }
+   catch (BaseException &e)
+   {
+      out.Put(e.GetFullMessage());
+      return 1;
+   }
+   catch (...)
+   {
+      out.Put("Unknown error occurred\n");
+      return 1;
+   }
+
+   cout << endl;
+   return 0;
+}
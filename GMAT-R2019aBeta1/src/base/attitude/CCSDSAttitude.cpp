@@ -57,7 +57,9 @@
  */
 //------------------------------------------------------------------------------
 CCSDSAttitude::CCSDSAttitude(const std::string &attName) :
-   Attitude("CCSDS-AEM",attName)
+   Attitude("CCSDS-AEM",attName),
+   hasCachedAttitude         (false),
+   cachedEpoch               (0.0)
 {
    parameterCount            = CCSDSAttitudeParamCount;
    objectTypeNames.push_back("CCSDS-AEM");
@@ -82,7 +84,9 @@ CCSDSAttitude::CCSDSAttitude(const std::string &attName) :
  */
 //------------------------------------------------------------------------------
 CCSDSAttitude::CCSDSAttitude(const CCSDSAttitude& att) :
-   Attitude(att)
+   Attitude(att),
+   hasCachedAttitude         (false),
+   cachedEpoch               (0.0)
 {
    if (att.reader)
       reader = (att.reader)->Clone();
@@ -112,6 +116,7 @@ CCSDSAttitude& CCSDSAttitude::operator=(const CCSDSAttitude& att)
       reader = (att.reader)->Clone();
    else
       reader = new CCSDSAEMReader();
+   hasCachedAttitude = false;
    return *this;
 }
 
@@ -161,6 +166,7 @@ bool CCSDSAttitude::Initialize()
    //reader->SetFile(aemFile);
    reader->SetFile(aemFileFullPath);
    reader->Initialize();
+   hasCachedAttitude = false;
    #ifdef DEBUG_CCSDS_ATTITUDE_INIT
       MessageInterface::ShowMessage("EXITing CCSDSAttitude::Initialize\n");
    #endif
@@ -193,6 +199,9 @@ GmatBase* CCSDSAttitude::Clone() const
 //------------------------------------------------------------------------------
 /**
  * This method computes the current CosineMatrix at the input time atTime.
+ * The AEM attitude depends only on time, so repeated requests for the same
+ * epoch (e.g. from SRP, drag and sensor models during one derivative
+ * evaluation) reuse the last interpolated matrix.
  *
  * @param atTime the A1Mjd time at which to compute the attitude.
  *
@@ -205,7 +214,12 @@ void CCSDSAttitude::ComputeCosineMatrixAndAngularVelocity(Real atTime)
    #endif
    if (!isInitialized || needsReinit)  Initialize();
 
+   if (hasCachedAttitude && (atTime == cachedEpoch))
+      return;
+
    dcm = reader->GetState(atTime);
+   cachedEpoch       = atTime;
+   hasCachedAttitude = true;
    // Currently, no angular velocity is computed for this attitude
    #ifdef DEBUG_CCSDS_ATTITUDE
       MessageInterface::ShowMessage("EXITing CCSDSAttitude::Compute\n");
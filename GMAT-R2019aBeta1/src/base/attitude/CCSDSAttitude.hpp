@@ -69,6 +69,10 @@ protected:
    };
 
    CCSDSAEMReader *reader;
+   /// true when dcm holds the attitude at cachedEpoch
+   bool           hasCachedAttitude;
+   /// Epoch of the attitude last read from the AEM data
+   Real           cachedEpoch;
 
    virtual void ComputeCosineMatrixAndAngularVelocity(Real atTime);
 
@@ -79,7 +79,9 @@ SpiceAttitude::SpiceAttitude(const std::string &attName) :
    Attitude("SpiceAttitude",attName),
    scName          (""),
    naifId          (UNDEFINED_NAIF_ID),
-   refFrameNaifId  (UNDEFINED_NAIF_ID_REF_FRAME)
+   refFrameNaifId  (UNDEFINED_NAIF_ID_REF_FRAME),
+   hasCachedAttitude (false),
+   cachedEpoch     (0.0)
 {
    parameterCount = SpiceAttitudeParamCount;
    objectTypeNames.push_back("SpiceAttitude");
@@ -112,7 +114,9 @@ SpiceAttitude::SpiceAttitude(const SpiceAttitude& att) :
    Attitude(att),
    scName           (att.scName),
    naifId           (att.naifId),
-   refFrameNaifId   (att.refFrameNaifId)
+   refFrameNaifId   (att.refFrameNaifId),
+   hasCachedAttitude (false),
+   cachedEpoch      (0.0)
 {
    ck.clear();
    sclk.clear();
@@ -158,6 +162,7 @@ SpiceAttitude& SpiceAttitude::operator=(const SpiceAttitude& att)
    scName         = att.scName;
    naifId         = att.naifId;
    refFrameNaifId = att.refFrameNaifId;
+   hasCachedAttitude = false;
    ck             = att.ck;
    sclk           = att.sclk;
    fk             = att.fk;
@@ -292,6 +297,7 @@ bool SpiceAttitude::Initialize()
       MessageInterface::ShowMessage("Leaving SpiceAttitude::Initialize\n");
    #endif
 
+   hasCachedAttitude = false;
    return true;
 }
 
@@ -330,6 +336,7 @@ void SpiceAttitude::SetObjectID(const std::string &objName, Integer objNaifId,
    scName         = objName;
    naifId         = objNaifId;
    refFrameNaifId = objRefFrameNaifId;
+   hasCachedAttitude = false;
 }
 
 //---------------------------------------------------------------------------
@@ -781,6 +788,8 @@ const StringArray& SpiceAttitude::GetStringArrayParameter(const Integer id) cons
 //------------------------------------------------------------------------------
 /**
  * This method computes the current CosineMatrix at the input time atTime.
+ * The kernel attitude depends only on time, so repeated requests for the
+ * same epoch reuse the last matrix and angular velocity read.
  *
  * @param atTime the A1Mjd time at which to compute the attitude.
  *
@@ -790,8 +799,13 @@ void SpiceAttitude::ComputeCosineMatrixAndAngularVelocity(Real atTime)
 {
    if (!isInitialized || needsReinit)  Initialize();
 
+   if (hasCachedAttitude && (atTime == cachedEpoch))
+      return;
+
    #ifdef __USE_SPICE__
       reader->GetTargetOrientation(scName, naifId, refFrameNaifId, atTime, dcm, angVel);
+      cachedEpoch       = atTime;
+      hasCachedAttitude = true;
    #else
       std::string errmsg = "Error - attempting to use SpiceAttitude when ";
       errmsg += "SPICE is not included in the GMAT build.\n";
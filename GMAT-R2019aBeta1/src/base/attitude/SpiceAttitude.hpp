@@ -125,6 +125,10 @@ protected:
    Integer     naifId;
    /// NAIF Id for the object's reference frame
    Integer     refFrameNaifId;
+   /// true when dcm and angVel hold the attitude at cachedEpoch
+   bool        hasCachedAttitude;
+   /// Epoch of the attitude last read from the kernels
+   Real        cachedEpoch;
    // array of CK kernel names
    StringArray ck;
    // array of SCLK kernel names
@@ -88,7 +88,8 @@ FiniteBurn::PARAMETER_TYPE[FiniteBurnParamCount - BurnParamCount] =
 FiniteBurn::FiniteBurn(const std::string &nomme) :
    Burn (Gmat::FINITE_BURN, "FiniteBurn", nomme),
    throttleLogicAlgorithm   ("MaxNumberOfThrusters"),
-   isElectricBurn           (false)       // default is Chemical
+   isElectricBurn           (false),      // default is Chemical
+   totalMassID              (-1)
 {
    objectTypes.push_back(Gmat::FINITE_BURN);
    objectTypeNames.push_back("FiniteBurn");
@@ -123,7 +124,8 @@ FiniteBurn::FiniteBurn(const FiniteBurn& fb) :
    Burn                   (fb),
    thrusterNames          (fb.thrusterNames),
    throttleLogicAlgorithm (fb.throttleLogicAlgorithm),
-   isElectricBurn         (fb.isElectricBurn)
+   isElectricBurn         (fb.isElectricBurn),
+   totalMassID            (fb.totalMassID)
 {
    parameterCount = fb.parameterCount;
 }
@@ -150,6 +152,7 @@ FiniteBurn& FiniteBurn::operator=(const FiniteBurn& fb)
    thrusterNames          = fb.thrusterNames;
    throttleLogicAlgorithm = fb.throttleLogicAlgorithm;
    isElectricBurn         = fb.isElectricBurn;
+   totalMassID            = fb.totalMassID;
    
    return *this;
 }
@@ -235,13 +238,15 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch, bool /*backwards*/)
       throw BurnException("Maneuver initial state undefined (No spacecraft?)");
    
    // Accumulate the individual accelerations from the thrusters
-   Real dm = 0.0, tMass, tOverM, *dir, norm;
+   Real dm = 0.0, tMass, tOverM, *dir, norm, thrustOverNorm;
    deltaV[0] = deltaV[1] = deltaV[2] = 0.0;
    totalAccel[0] = totalAccel[1] = totalAccel[2]  = 0.0;
    totalThrust[0] = totalThrust[1] = totalThrust[2]  = 0.0;
    Thruster *current;
    
-   tMass = spacecraft->GetRealParameter("TotalMass");
+   if (totalMassID < 0)
+      totalMassID = spacecraft->GetParameterID("TotalMass");
+   tMass = spacecraft->GetRealParameter(totalMassID);
    
    #ifdef DEBUG_BURN_ORIGIN
    Real *satState = spacecraft->GetState().GetState();
@@ -303,6 +308,7 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch, bool /*backwards*/)
       //tOverM = current->thrust / (tMass * norm * 1000.0); //old code
       tOverM = current->thrust * current->thrustScaleFactor *
                current->dutyCycle / (tMass * norm * 1000.0);
+      thrustOverNorm = current->appliedThrustMag / norm;
       
       // deltaV is really totalAcceleration (SPH)
       deltaV[0] += dir[0] * tOverM;
@@ -315,9 +321,9 @@ bool FiniteBurn::Fire(Real *burnData, Real epoch, bool /*backwards*/)
       //    current->dutyCycle;
       
       // Add in thrust from this thruster for totalThrust
-      totalThrust[0] += dir[0] / norm * current->appliedThrustMag;
-      totalThrust[1] += dir[1] / norm * current->appliedThrustMag;
-      totalThrust[2] += dir[2] / norm * current->appliedThrustMag;
+      totalThrust[0] += dir[0] * thrustOverNorm;
+      totalThrust[1] += dir[1] * thrustOverNorm;
+      totalThrust[2] += dir[2] * thrustOverNorm;
       
       #ifdef DEBUG_FINITEBURN_FIRE
          MessageInterface::ShowMessage("   Thruster %s = %s details:\n", 
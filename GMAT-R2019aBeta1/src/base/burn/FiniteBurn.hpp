@@ -117,6 +117,8 @@ protected:
    /// Are the thrusters of type Electric?  If not, then they are
    /// Chemical thrusters
    bool                    isElectricBurn;
+   /// Spacecraft parameter ID for the total mass, looked up on first use
+   Integer                 totalMassID;
    
    bool SetThrustersFromSpacecraft();
    
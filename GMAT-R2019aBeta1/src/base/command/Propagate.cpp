@@ -42,6 +42,8 @@
 #include "ColorTypes.hpp"       // for GmatColor::
 #include "MessageInterface.hpp"
 #include "RgbColor.hpp"         // for ToIntColor()
+#include "BrentDekkerZero.hpp"
+#include "RunProfiler.hpp"
 #include <sstream>
 #include <cmath>
 
@@ -68,10 +70,18 @@
 //#define DEBUG_PUBLISH_DATA
 //#define DEBUG_TRANSIENT_FORCES
 //#define DEBUG_FINAL_STEP
+//#define DEBUG_DENSE_STOP
 //#define DEBUG_EVENTLOCATORS
 //#define DEBUG_CLONES
 //#define DEBUG_CLEAN_STRING
 
+/// Profiler counters for this file.  The saved derivative calls are the ring
+/// buffer steps a stop would have needed, so they are an estimate.
+static const Integer DENSE_STOP_SEARCHES =
+      RunProfiler::RegisterCounter("Dense Output Stop Searches");
+static const Integer EST_STOP_DERIVATIVE_CALLS_SAVED =
+      RunProfiler::RegisterCounter("Stop Deriv. Calls Saved (Est.)");
+
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
 //#endif
@@ -4212,6 +4222,10 @@ void Propagate::PrepareStoppingConditions()
             stopCondEpochID, stopCondBaseEpochID, stopCondStopVarID);
    #endif
 
+   // Dense output costs derivative evaluations, so the propagators only
+   // record it when a stop will be located on it
+   bool denseStops = false;
+
    try
    {
       for (UnsignedInt i = 0; i < stopWhen.size(); ++i)
@@ -4246,7 +4260,12 @@ void Propagate::PrepareStoppingConditions()
                MessageInterface::ShowMessage("%s\n\n", msg.c_str());
             }
          }
+         else
+            denseStops = true;
       }
+
+      for (UnsignedInt i = 0; i < p.size(); ++i)
+         p[i]->EnableDenseOutput(denseStops);
    }
    catch (BaseException &ex)
    {
@@ -5161,7 +5180,10 @@ void Propagate::TakeFinalStep(Integer EpochID, Integer trigger)
       }
       else
       {
-         dt = InterpolateToStop(*i);
+         // Search the triggering step's dense output, and fall back to the
+         // ring buffer when the propagators cannot provide it
+         if (!LocateStopOnDenseOutput(*i, dt))
+            dt = InterpolateToStop(*i);
 
          #ifdef DEBUG_PROPAGATE_STEPSIZE
             MessageInterface::ShowMessage(
@@ -5641,6 +5663,169 @@ Real Propagate::InterpolateToStop(StopCondition *sc)
 }
 
 
+//------------------------------------------------------------------------------
+// bool LocateStopOnDenseOutput(StopCondition *sc, Real &secsToStop)
+//------------------------------------------------------------------------------
+/**
+ * Finds the time to a stop inside the step that triggered it, without
+ * propagating
+ *
+ * When every propagator recorded dense output for the triggering step, the
+ * stopping condition is evaluated on interpolated states and its zero is found
+ * with the Brent-Dekker method.  The ring buffer steps that InterpolateToStop()
+ * would have propagated are counted in the run profiler as an estimate of the
+ * derivative calls saved.  The spacecraft and force models are restored to
+ * the start of the step before returning.
+ *
+ * @param sc         The stopping condition that is located
+ * @param secsToStop The time from the start of the step to the stop
+ *
+ * @return true if the stop was located, false if the ring buffer is needed
+ */
+//------------------------------------------------------------------------------
+bool Propagate::LocateStopOnDenseOutput(StopCondition *sc, Real &secsToStop)
+{
+   if (sc->IsTimeCondition() || (stopInterval == 0.0))
+      return false;
+
+   // Each propagator must describe the triggering step from its current state
+   RealArray startTimes, startState;
+   for (UnsignedInt i = 0; i < fm.size(); ++i)
+   {
+      if ((fm[i] == NULL) || !p[i]->HasDenseOutput())
+         return false;
+      if (fabs(p[i]->GetDenseStepSize() - stopInterval) >
+            1.0e-9 * fabs(stopInterval))
+         return false;
+
+      Integer size = p[i]->GetDimension();
+      Real *current = p[i]->GetState();
+      if ((size <= 0) || (current == NULL))
+         return false;
+      startState.assign(size, 0.0);
+      if (!p[i]->GetDenseState(0.0, &startState[0]))
+         return false;
+      for (Integer j = 0; j < size; ++j)
+         if (fabs(startState[j] - current[j]) > 1.0e-9 * (fabs(current[j]) + 1.0))
+            return false;
+
+      startTimes.push_back(fm[i]->GetTime());
+   }
+
+   Real h = stopInterval;
+   Real g0 = EvaluateDenseStop(sc, 0.0, startTimes);
+   Real g1 = EvaluateDenseStop(sc, h, startTimes);
+   Integer evaluations = 2;
+   bool located = false;
+
+   // A zero at the start of the step is the previous stop, so it is left to
+   // the ring buffer code
+   if ((g0 != 0.0) && ((g0 < 0.0) != (g1 < 0.0)))
+   {
+      BrentDekkerZero zeroFinder;
+      zeroFinder.SetInterval(0.0, h, g0, g1, 1.0e-10);
+
+      Real best = h, bestValue = fabs(g1), g;
+      Real dt = zeroFinder.FindStep(h, g1);
+      while (zeroFinder.CheckConvergence() && (evaluations < 100))
+      {
+         if (dt * h < 0.0)
+            dt = 0.0;
+         else if (fabs(dt) > fabs(h))
+            dt = h;
+
+         g = EvaluateDenseStop(sc, dt, startTimes);
+         ++evaluations;
+         if (fabs(g) < bestValue)
+         {
+            best = dt;
+            bestValue = fabs(g);
+         }
+         dt = zeroFinder.FindStep(dt, g);
+      }
+
+      secsToStop = best;
+      stopEpoch = best;
+      located = true;
+   }
+
+   // Restore the spacecraft and force models to the start of the step
+   BufferSatelliteStates(false);
+   for (UnsignedInt i = 0; i < fm.size(); ++i)
+   {
+      fm[i]->UpdateFromSpaceObject();
+      fm[i]->SetTime(startTimes[i]);
+   }
+
+   if (located)
+   {
+      // Estimate the calls saved: the ring buffer steps a quarter of the
+      // step at a time until it passes the stop
+      Integer ringSteps = (Integer)std::ceil(4.0 * secsToStop / h);
+      if (ringSteps < 1)
+         ringSteps = 1;
+      Integer saved = 0;
+      for (UnsignedInt i = 0; i < p.size(); ++i)
+         saved += ringSteps * p[i]->GetDerivativeCallsPerStep();
+
+      RunProfiler::Count(DENSE_STOP_SEARCHES);
+      RunProfiler::Count(EST_STOP_DERIVATIVE_CALLS_SAVED, saved);
+
+      #ifdef DEBUG_DENSE_STOP
+         MessageInterface::ShowMessage("Dense output stop for \"%s\": "
+               "%.12lf of %.12lf secs, %d interpolations, %d derivative calls "
+               "saved\n", sc->GetName().c_str(), secsToStop, h, evaluations,
+               saved);
+      #endif
+   }
+
+   return located;
+}
+
+
+//------------------------------------------------------------------------------
+// Real EvaluateDenseStop(StopCondition *sc, Real dt,
+//       const RealArray &startTimes)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates a stopping condition on the dense output of the last step
+ *
+ * @param sc         The stopping condition
+ * @param dt         Time from the start of the step
+ * @param startTimes Force model elapsed times at the start of the step
+ *
+ * @return The difference between the stop parameter and its goal
+ */
+//------------------------------------------------------------------------------
+Real Propagate::EvaluateDenseStop(StopCondition *sc, Real dt,
+      const RealArray &startTimes)
+{
+   for (UnsignedInt i = 0; i < fm.size(); ++i)
+   {
+      p[i]->GetDenseState(dt, fm[i]->GetState());
+      fm[i]->SetTime(startTimes[i] + dt);
+
+      if (fm[i]->HasPrecisionTime())
+      {
+         GmatTime gt = baseEpochGT[i]; gt.AddSeconds(fm[i]->GetTime());
+         fm[i]->UpdateSpaceObjectGT(gt);
+      }
+      else
+         fm[i]->UpdateSpaceObject(
+            baseEpoch[i] + fm[i]->GetTime() / GmatTimeConstants::SECS_PER_DAY);
+   }
+
+   Parameter *targParam = sc->GetGoalParameter();
+   Real target = (targParam != NULL ? targParam->EvaluateReal() :
+         sc->GetStopGoal());
+   Real value = sc->GetStopParameter()->EvaluateReal();
+   if (sc->IsCyclicParameter())
+      value = GetRangedAngle(value, target);
+
+   return value - target;
+}
+
+
 //------------------------------------------------------------------------------
 // Real RefineFinalStep(Real secsToStep, StopCondition *stopper)
 //------------------------------------------------------------------------------
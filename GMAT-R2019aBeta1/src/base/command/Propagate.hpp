@@ -354,6 +354,10 @@ protected:
    bool                    CheckFirstStepStop(Integer i);
    
    Real                    InterpolateToStop(StopCondition *sc);
+   bool                    LocateStopOnDenseOutput(StopCondition *sc,
+                                                   Real &secsToStop);
+   Real                    EvaluateDenseStop(StopCondition *sc, Real dt,
+                                             const RealArray &startTimes);
    Real                    RefineFinalStep(Real secsToStep, 
                                            StopCondition *stopper);
    Real                    BisectToStop(StopCondition *stopper);
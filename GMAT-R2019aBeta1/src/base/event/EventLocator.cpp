@@ -82,6 +82,8 @@ EventLocator::PARAMETER_TEXT[EventLocatorParamCount - GmatBaseParamCount] =
    "WriteReport",          // WRITE_REPORT
    "RunMode",              // RUN_MODE
    "UseEntireInterval",    // USE_ENTIRE_INTERVAL
+   "UseNativeSearch",      // USE_NATIVE_SEARCH
+   "TrajectoryFile",       // TRAJECTORY_FILE
 };
 
 const Gmat::ParameterType
@@ -99,6 +101,8 @@ EventLocator::PARAMETER_TYPE[EventLocatorParamCount - GmatBaseParamCount] =
    Gmat::BOOLEAN_TYPE,     // WRITE_REPORT
    Gmat::ENUMERATION_TYPE, // RUN_MODE
    Gmat::BOOLEAN_TYPE,     // USE_ENTIRE_INTERVAL
+   Gmat::BOOLEAN_TYPE,     // USE_NATIVE_SEARCH
+   Gmat::FILENAME_TYPE,    // TRAJECTORY_FILE
 };
 
 const std::string EventLocator::RUN_MODES[3] =
@@ -143,6 +147,8 @@ EventLocator::EventLocator(const std::string &typeStr,
    locatingString          (""),
    runMode                 ("Automatic"),
    useEntireInterval       (true),
+   useNativeSearch         (false),
+   trajectoryFile          (""),
    appendReport            (false),
    epochFormat             ("TAIModJulian"),
    initialEpoch            ("21545"),        // MUST match initialEp
@@ -220,6 +226,8 @@ EventLocator::EventLocator(const EventLocator& el) :
    runMode                 (el.runMode),
    locatingString          (el.locatingString),
    useEntireInterval       (el.useEntireInterval),
+   useNativeSearch         (el.useNativeSearch),
+   trajectoryFile          (el.trajectoryFile),
    appendReport            (el.appendReport),
    epochFormat             (el.epochFormat),
    initialEpoch            (el.initialEpoch),
@@ -284,6 +292,8 @@ EventLocator& EventLocator::operator=(const EventLocator& el)
       runMode              = el.runMode;
       locatingString       = el.locatingString;
       useEntireInterval    = el.useEntireInterval;
+      useNativeSearch      = el.useNativeSearch;
+      trajectoryFile       = el.trajectoryFile;
       appendReport         = el.appendReport;
       epochFormat          = el.epochFormat;
       initialEpoch         = el.initialEpoch;
@@ -590,6 +600,8 @@ std::string EventLocator::GetStringParameter(const Integer id) const
    }
    if (id == RUN_MODE)
       return runMode;
+   if (id == TRAJECTORY_FILE)
+      return trajectoryFile;
 
    return GmatBase::GetStringParameter(id);
 }
@@ -628,6 +640,11 @@ bool EventLocator::SetStringParameter(const Integer id,
       }
       return false;
    }
+   if (id == TRAJECTORY_FILE)
+   {
+      trajectoryFile = value;
+      return true;
+   }
    if (id == INPUT_EPOCH_FORMAT)
    {
       if (theTimeConverter->IsValidTimeSystem(value))
@@ -971,6 +988,8 @@ bool EventLocator::GetBooleanParameter(const Integer id) const
       return writeReport;
    if (id == USE_ENTIRE_INTERVAL)
       return useEntireInterval;
+   if (id == USE_NATIVE_SEARCH)
+      return useNativeSearch;
 
    return GmatBase::GetBooleanParameter(id);
 }
@@ -1010,6 +1029,11 @@ bool EventLocator::SetBooleanParameter(const Integer id, const bool value)
       useEntireInterval = value;
       return true;
    }
+   if (id == USE_NATIVE_SEARCH)
+   {
+      useNativeSearch = value;
+      return true;
+   }
 
    return GmatBase::SetBooleanParameter(id, value);
 }
@@ -1784,6 +1808,8 @@ void EventLocator::LocateEvents(const std::string &reportNotice)
 
       // Stop the data recording so that the kernel will be loaded
       sat->ProvideEphemerisData();
+      em->SetUseNativeSearch(useNativeSearch);
+      em->SetTrajectoryFile(useNativeSearch ? trajectoryFile : "");
 
       Real coverageBegin;
       Real coverageEnd;
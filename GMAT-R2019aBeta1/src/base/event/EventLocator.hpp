@@ -180,6 +180,12 @@ protected:
    /// Use the entire time interval (true  - use the entire interval; false,
    /// use the input start and stop epochs)
    bool                        useEntireInterval;
+   /// Search the in-memory trajectory instead of calling the SPICE geometry
+   /// finder, when the search settings allow it
+   bool                        useNativeSearch;
+   /// Chebyshev ephemeris file searched in place of the recorded trajectory
+   /// by the native searches ("" to search the recorded trajectory)
+   std::string                 trajectoryFile;
    /// Append to the report or not (appends if true; creates new report,
    /// renaming existing report, if false)
    bool                        appendReport;
@@ -256,6 +262,8 @@ protected:
        WRITE_REPORT,
        RUN_MODE,
        USE_ENTIRE_INTERVAL,
+       USE_NATIVE_SEARCH,
+       TRAJECTORY_FILE,
        EventLocatorParamCount
     };
 
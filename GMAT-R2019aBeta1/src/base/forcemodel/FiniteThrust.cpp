@@ -670,6 +670,9 @@ bool FiniteThrust::GetDerivatives(Real * state, Real dt, Integer order,
    
    if (fillCartesian)
    {
+      // Every burn fires at the same epoch
+      Real now = epoch + dt / GmatTimeConstants::SECS_PER_DAY;
+
       // Loop through the spacecraft list, building accels for active sats
       for (ObjectArray::iterator sc = spacecraft.begin();
            sc != spacecraft.end(); ++sc) 
@@ -717,7 +720,6 @@ bool FiniteThrust::GetDerivatives(Real * state, Real dt, Integer order,
                  fb != burns.end(); ++fb)
             {
                (*fb)->SetSpacecraftToManeuver((Spacecraft*)sat);
-               Real now = epoch + dt / GmatTimeConstants::SECS_PER_DAY;
                if ((*fb)->Fire(burnData, now)) 
                {
                   #ifdef DEBUG_FINITETHRUST_EXE
@@ -71,6 +71,7 @@
 #include "GravityField.hpp"
 #include "FormationInterface.hpp"
 #include "StringUtil.hpp"
+#include "RunProfiler.hpp"
 
 #include <string.h> 
 #include <algorithm>    // for find()
@@ -106,6 +107,7 @@
 //#define DEBUG_AMATRIX
 //#define DEBUG_RANGECHECK_TOGGLES
 //#define DEBUG_TIME_ADDITION
+//#define DEBUG_MULTI_RATE
 
 
  
@@ -117,6 +119,12 @@
 #define TEMPORARILY_DISABLE_CD_RANGE_CHECK
 
 
+/// Profiler counters for this file
+static const Integer MULTI_RATE_CALLS_SAVED =
+      RunProfiler::RegisterCounter("Multi-Rate Force Calls Saved");
+static const Integer MULTI_RATE_SAMPLES =
+      RunProfiler::RegisterCounter("Multi-Rate Force Samples");
+
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
 //#endif
@@ -162,7 +170,10 @@ ODEModel::PARAMETER_TEXT[ODEModelParamCount - PhysicalModelParamCount] =
    "ShapeFileName",
    "BodyDensity",
 
-   "UserDefined"
+   "UserDefined",
+
+   "MultiRateForces",
+   "MultiRateInterval"
 };
 
 
@@ -192,6 +203,10 @@ ODEModel::PARAMETER_TYPE[ODEModelParamCount - PhysicalModelParamCount] =
 
    // plugin forces in the style of the solar sail plugin
    Gmat::OBJECTARRAY_TYPE,  // "UserDefined",
+
+   // Forces evaluated on a coarser time grid than the integrator stages
+   Gmat::STRINGARRAY_TYPE,  // "MultiRateForces",
+   Gmat::REAL_TYPE,         // "MultiRateInterval",
 };
 
 
@@ -290,7 +305,12 @@ ODEModel::ODEModel(const std::string &modelName, const std::string typeName) :
    warnedOnceForParameters (false),
    j2kBodyName       ("Earth"),
    j2kBody           (NULL),
-   transientCount    (0)
+   transientCount    (0),
+   multiRateInterval (600.0),
+   multiRateTolerance (1.0e-11),
+   multiRateEpoch    (-1.0),
+   multiRateOrder    (1),
+   multiRateScale    (0.0)
 {
 #ifdef DEBUG_ODEMODEL
 	MessageInterface::ShowMessage("ODEModel default construction <'%s',%p>\n", GetName().c_str(), this);
@@ -388,7 +408,13 @@ ODEModel::ODEModel(const ODEModel& fdf) :
    /// @note: Since the next three are global objects or reset by the Sandbox, 
    ///assignment works
    j2kBody                    (fdf.j2kBody),
-   transientCount             (fdf.transientCount)
+   transientCount             (fdf.transientCount),
+   multiRateForceNames        (fdf.multiRateForceNames),
+   multiRateInterval          (fdf.multiRateInterval),
+   multiRateTolerance         (fdf.multiRateTolerance),
+   multiRateEpoch             (-1.0),
+   multiRateOrder             (1),
+   multiRateScale             (0.0)
 {
    #ifdef DEBUG_ODEMODEL
    MessageInterface::ShowMessage("ODEModel copy constructor (from <'%s',%p> to <'%s',%p>) entered\n", fdf.GetName().c_str(), &fdf, GetName().c_str(), &(*this));
@@ -503,6 +529,14 @@ ODEModel& ODEModel::operator=(const ODEModel& fdf)
    forceMembersNotInitialized = fdf.forceMembersNotInitialized;
    transientCount      = fdf.transientCount;
 
+   // The multi-rate samples refer to the old forces, so only settings copy
+   multiRateForceNames = fdf.multiRateForceNames;
+   multiRateInterval   = fdf.multiRateInterval;
+   multiRateTolerance  = fdf.multiRateTolerance;
+   multiRateForces.clear();
+   multiRateEpoch      = -1.0;
+   multiRateScale      = 0.0;
+
    // Clear owned objects before clone
    ClearForceList();
    ClearInternalCoordinateSystems();
@@ -800,6 +834,8 @@ void ODEModel::DeleteForce(const std::string &name)
                (pm, pm->GetName(), "ODEModel::DeleteForce()",
                 "deleting non-transient force of " + pm->GetTypeName(), this);
             #endif
+            // The multi-rate list is rebuilt when the model is initialized
+            multiRateForces.clear();
             delete pm;
          }
          else
@@ -844,6 +880,8 @@ void ODEModel::DeleteForce(PhysicalModel *pPhysicalModel)
                (pm, pm->GetName(), "ODEModel::DeleteForce()",
                 "deleting non-transient force of " + pm->GetTypeName(), this);
             #endif
+            // The multi-rate list is rebuilt when the model is initialized
+            multiRateForces.clear();
             delete pm;
          }
          else
@@ -1176,6 +1214,7 @@ void ODEModel::UpdateFromSpaceObject()
    psm->MapObjectsToVector();
    GmatState *state = psm->GetState();
    memcpy(rawState, state->GetState(), state->GetSize() * sizeof(Real));
+   ResetMultiRateData();
 
     // Transform to the force model origin
     // MoveToOrigin();					   // Notice that: without epoch, it will get wrong state of center body
@@ -1207,6 +1246,7 @@ void ODEModel::RevertSpaceObject()
    elapsedTime = prevElapsedTime;
 
    memcpy(rawState, previousState.GetState(), dimension*sizeof(Real));
+   ResetMultiRateData();
 
    if (hasPrecisionTime)
       MoveToOriginGT();
@@ -1805,6 +1845,8 @@ bool ODEModel::Initialize()
       throw ODEModelException("The ODE model " + instanceName +
             " is empty, so it cannot be used for propagation.");
 
+   BuildMultiRateList();
+
    isInitialized = true;
 
    #ifdef DEBUG_MU_MAP
@@ -1861,6 +1903,8 @@ void ODEModel::ClearForceList(bool deleteTransient)
       }
    #endif
    
+   multiRateForces.clear();
+
    // Delete the owned forces
    std::vector<PhysicalModel *>::iterator ppm = forceList.begin();
    PhysicalModel *pm;
@@ -2767,6 +2811,25 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
       MessageInterface::ShowMessage("\nODE epoch, elapsed, dt: %.12lf, %lf, %lf ", epoch, elapsedTime, dt);
    #endif
 
+   // Forces on the multi-rate grid are interpolated from their stored samples
+   // when the stage epoch is close enough to them.  The STM and A-matrix rows
+   // depend on the propagated state data, so every force is evaluated when
+   // those are filled.
+   bool multiRate = !multiRateForces.empty() && !fillSTM && !fillAMatrix &&
+         (cartesianCount > 0);
+   Real multiRateTime = 0.0;
+   if (multiRate)
+   {
+      if ((order != multiRateOrder) || (multiRateEpoch < 0.0))
+      {
+         ResetMultiRateData();
+         multiRateOrder = order;
+         multiRateEpoch = this->state->GetEpoch();
+      }
+      multiRateTime = (this->state->GetEpoch() - multiRateEpoch) *
+            GmatTimeConstants::SECS_PER_DAY + dt;
+   }
+
    // Apply superposition of forces/derivatives
    for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
          i != forceList.end(); ++i)
@@ -2779,6 +2842,16 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
          debugFile << "   " << (*i)->GetTypeName();
       #endif
 
+      MultiRateForce *mrf = (multiRate ? FindMultiRateForce(*i) : NULL);
+      if ((mrf != NULL) && UseMultiRateSamples(*mrf, multiRateTime))
+      {
+         InterpolateMultiRateForce(*mrf, multiRateTime);
+         for (Integer j = 0; j < dimension; ++j)
+            deriv[j] += multiRateValues[j];
+         RunProfiler::Count(MULTI_RATE_CALLS_SAVED);
+         continue;
+      }
+
       ddt = (*i)->GetDerivativeArray();
       if (!(*i)->GetDerivatives(state, dt, order))
       {
@@ -2790,6 +2863,9 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
 
          return false;
       }
+
+      if (mrf != NULL)
+         StoreMultiRateSample(*mrf, multiRateTime, ddt);
       
       #ifdef DEBUG_ODEMODEL_EXE
       for (Integer j = 0; j < dimension; ++j)
@@ -2838,6 +2914,16 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
    #ifdef DEBUG_FOR_CINTERFACE
       debugFile << "\n";
    #endif
+
+   if (multiRate)
+   {
+      // Scale for the multi-rate error checks: the largest acceleration
+      // component, read before the position rates are filled in
+      multiRateScale = 0.0;
+      for (Integer j = cartesianStart; j < cartesianStart + cartStateSize; ++j)
+         if (GmatMathUtil::Abs(deriv[j]) > multiRateScale)
+            multiRateScale = GmatMathUtil::Abs(deriv[j]);
+   }
    
    if (fillCartesian)
    {
@@ -2950,6 +3036,278 @@ bool ODEModel::GetDerivatives(Real * state, Real dt, Integer order,
 }
 
 
+//------------------------------------------------------------------------------
+// void BuildMultiRateList()
+//------------------------------------------------------------------------------
+/**
+ * Finds the forces named in the MultiRateForces list
+ *
+ * Entries may name a force type or its script alias (e.g. PointMasses, SRP,
+ * RelativisticCorrection), a force instance, or a body whose point mass or
+ * non-central gravity field is to be sampled.  The central body gravity field
+ * and drag change too quickly along the orbit to be sampled, so they are
+ * rejected.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::BuildMultiRateList()
+{
+   multiRateForces.clear();
+
+   for (UnsignedInt n = 0; n < multiRateForceNames.size(); ++n)
+   {
+      bool found = false;
+      for (std::vector<PhysicalModel *>::iterator i = forceList.begin();
+           i != forceList.end(); ++i)
+      {
+         if ((*i)->IsTransient() ||
+             !MatchesMultiRateEntry(*i, multiRateForceNames[n]))
+            continue;
+
+         found = true;
+         if ((*i)->IsOfType("DragForce") || ((*i)->IsOfType("GravityField") &&
+             ((*i)->GetBodyName() == centralBodyName)))
+            throw ODEModelException("The force " + (*i)->GetName() +
+                  " on the ForceModel " + instanceName + " cannot be "
+                  "evaluated on the multi-rate grid; remove \"" +
+                  multiRateForceNames[n] + "\" from the MultiRateForces list");
+
+         if (FindMultiRateForce(*i) == NULL)
+         {
+            MultiRateForce mrf;
+            mrf.force   = *i;
+            mrf.spacing = multiRateInterval;
+            multiRateForces.push_back(mrf);
+         }
+      }
+
+      if (!found)
+         throw ODEModelException("The MultiRateForces entry \"" +
+               multiRateForceNames[n] + "\" does not match a force on the "
+               "ForceModel " + instanceName);
+   }
+
+   #ifdef DEBUG_MULTI_RATE
+      MessageInterface::ShowMessage("%s evaluates %d forces on the multi-rate "
+            "grid:\n", instanceName.c_str(), multiRateForces.size());
+      for (UnsignedInt n = 0; n < multiRateForces.size(); ++n)
+         MessageInterface::ShowMessage("   %s\n",
+               multiRateForces[n].force->GetName().c_str());
+   #endif
+
+   ResetMultiRateData();
+}
+
+
+//------------------------------------------------------------------------------
+// bool MatchesMultiRateEntry(PhysicalModel *pm, const std::string &entry)
+//------------------------------------------------------------------------------
+/**
+ * Checks a force against an entry in the MultiRateForces list
+ *
+ * @param pm    The force
+ * @param entry The scripted entry
+ *
+ * @return true if the entry selects the force
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::MatchesMultiRateEntry(PhysicalModel *pm,
+      const std::string &entry)
+{
+   if ((entry == pm->GetName()) || (entry == pm->GetTypeName()) ||
+       (GetScriptAlias(entry) == pm->GetTypeName()))
+      return true;
+
+   if (pm->IsOfType("PointMassForce") || pm->IsOfType("GravityField"))
+      return (entry == pm->GetBodyName());
+
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void ResetMultiRateData()
+//------------------------------------------------------------------------------
+/**
+ * Discards the multi-rate samples
+ *
+ * Called whenever the propagated state may have changed outside of the
+ * integration, so that samples from a different trajectory are never used.
+ */
+//------------------------------------------------------------------------------
+void ODEModel::ResetMultiRateData()
+{
+   for (std::vector<MultiRateForce>::iterator i = multiRateForces.begin();
+        i != multiRateForces.end(); ++i)
+   {
+      i->times.clear();
+      i->values.clear();
+      // Start fine; the error checks widen the spacing as samples accrue
+      i->spacing = multiRateInterval / 8.0;
+   }
+   multiRateEpoch = -1.0;
+}
+
+
+//------------------------------------------------------------------------------
+// MultiRateForce* FindMultiRateForce(PhysicalModel *pm)
+//------------------------------------------------------------------------------
+/**
+ * Finds the multi-rate data for a force
+ *
+ * @param pm The force
+ *
+ * @return The force's multi-rate data, or NULL if it is evaluated every call
+ */
+//------------------------------------------------------------------------------
+ODEModel::MultiRateForce* ODEModel::FindMultiRateForce(PhysicalModel *pm)
+{
+   for (UnsignedInt n = 0; n < multiRateForces.size(); ++n)
+      if (multiRateForces[n].force == pm)
+         return &multiRateForces[n];
+   return NULL;
+}
+
+
+//------------------------------------------------------------------------------
+// void InterpolateMultiRateForce(const MultiRateForce &mrf, Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Fills multiRateValues from the polynomial through a force's samples
+ *
+ * With one sample the force is held; with two or three it is interpolated, or
+ * extrapolated a short way past the newest sample.
+ *
+ * @param mrf    The force's multi-rate data
+ * @param atTime The epoch, in seconds from multiRateEpoch
+ */
+//------------------------------------------------------------------------------
+void ODEModel::InterpolateMultiRateForce(const MultiRateForce &mrf,
+      Real atTime)
+{
+   Integer count = mrf.times.size();
+   Real weight[3];
+
+   for (Integer k = 0; k < count; ++k)
+   {
+      weight[k] = 1.0;
+      for (Integer m = 0; m < count; ++m)
+         if (m != k)
+            weight[k] *= (atTime - mrf.times[m]) /
+                         (mrf.times[k] - mrf.times[m]);
+   }
+
+   multiRateValues.assign(dimension, 0.0);
+   for (Integer k = 0; k < count; ++k)
+      for (Integer j = 0; j < dimension; ++j)
+         multiRateValues[j] += weight[k] * mrf.values[k][j];
+}
+
+
+//------------------------------------------------------------------------------
+// bool UseMultiRateSamples(const MultiRateForce &mrf, Real atTime)
+//------------------------------------------------------------------------------
+/**
+ * Checks if a force can be interpolated rather than evaluated
+ *
+ * @param mrf    The force's multi-rate data
+ * @param atTime The epoch, in seconds from multiRateEpoch
+ *
+ * @return true if a sample lies within the force's current spacing
+ */
+//------------------------------------------------------------------------------
+bool ODEModel::UseMultiRateSamples(const MultiRateForce &mrf, Real atTime)
+{
+   for (UnsignedInt k = 0; k < mrf.times.size(); ++k)
+      if (GmatMathUtil::Abs(atTime - mrf.times[k]) < mrf.spacing)
+         return true;
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void StoreMultiRateSample(MultiRateForce &mrf, Real atTime,
+//       const Real *ddt)
+//------------------------------------------------------------------------------
+/**
+ * Adds an exact evaluation to a force's samples and adjusts its spacing
+ *
+ * Before the new data is stored, the value predicted by the existing samples
+ * is compared with it.  The difference, relative to the largest acceleration
+ * component of the total derivative, is held to the integrator's accuracy:
+ * the spacing is halved when the difference exceeds the tolerance, and doubled
+ * (up to MultiRateInterval) when a quadratic prediction is well inside it.
+ * The three samples nearest to the newest one are kept.
+ *
+ * @param mrf    The force's multi-rate data
+ * @param atTime The epoch of the evaluation, in seconds from multiRateEpoch
+ * @param ddt    The force's derivative array
+ */
+//------------------------------------------------------------------------------
+void ODEModel::StoreMultiRateSample(MultiRateForce &mrf, Real atTime,
+      const Real *ddt)
+{
+   Integer count = mrf.times.size();
+   Real nearest = -1.0;
+   for (Integer k = 0; k < count; ++k)
+   {
+      Real gap = GmatMathUtil::Abs(atTime - mrf.times[k]);
+      if ((nearest < 0.0) || (gap < nearest))
+         nearest = gap;
+   }
+
+   if ((count > 0) && (nearest <= 2.0 * mrf.spacing))
+   {
+      InterpolateMultiRateForce(mrf, atTime);
+      Real error = 0.0;
+      for (Integer j = 0; j < dimension; ++j)
+      {
+         Real diff = GmatMathUtil::Abs(multiRateValues[j] - ddt[j]);
+         if (diff > error)
+            error = diff;
+      }
+
+      if (multiRateScale > 0.0)
+      {
+         error /= multiRateScale;
+         if (error > multiRateTolerance)
+            mrf.spacing = GmatMathUtil::Max(0.5 * mrf.spacing,
+                  multiRateInterval / 1024.0);
+         else if ((count == 3) && (error < 0.0625 * multiRateTolerance))
+            mrf.spacing = GmatMathUtil::Min(2.0 * mrf.spacing,
+                  multiRateInterval);
+      }
+
+      #ifdef DEBUG_MULTI_RATE
+         MessageInterface::ShowMessage("%s at %.3lf s: relative error %le, "
+               "spacing now %.3lf s\n", mrf.force->GetName().c_str(), atTime,
+               error, mrf.spacing);
+      #endif
+   }
+   else
+   {
+      // Samples far from the new one say nothing about it; start over
+      mrf.times.clear();
+      mrf.values.clear();
+      count = 0;
+   }
+
+   if (count == 3)
+   {
+      Integer farthest = 0;
+      for (Integer k = 1; k < count; ++k)
+         if (GmatMathUtil::Abs(atTime - mrf.times[k]) >
+             GmatMathUtil::Abs(atTime - mrf.times[farthest]))
+            farthest = k;
+      mrf.times.erase(mrf.times.begin() + farthest);
+      mrf.values.erase(mrf.values.begin() + farthest);
+   }
+
+   mrf.times.push_back(atTime);
+   mrf.values.push_back(RealArray(ddt, ddt + dimension));
+   RunProfiler::Count(MULTI_RATE_SAMPLES);
+}
+
+
 //------------------------------------------------------------------------------
 // bool PrepareDerivativeArray()
 //------------------------------------------------------------------------------
@@ -3977,6 +4335,11 @@ bool ODEModel::IsParameterReadOnly(const Integer id) const
        id == POTENTIAL_FILE || id == POLYHEDRAL_BODY || id == SHAPE_FILE_NAME ||
        id == BODY_DENSITY)
       return true;
+
+   // The multi-rate settings are only written when the mode is in use
+   if ((id == MULTI_RATE_FORCES || id == MULTI_RATE_INTERVAL) &&
+       multiRateForceNames.empty())
+      return true;
    
    return PhysicalModel::IsParameterReadOnly(id);
 }
@@ -4017,6 +4380,9 @@ Real ODEModel::GetRealParameter(const Integer id) const
       return pm->GetRealParameter(id);
    }
 
+   if (id == MULTI_RATE_INTERVAL)
+      return multiRateInterval;
+
    // Handler for force based solve-for parameters
    if (id >= ODEModelParamCount)
    {
@@ -4069,6 +4435,22 @@ Real ODEModel::SetRealParameter(const Integer id, const Real value)
       return pm->SetRealParameter(id, value);
    }
 
+   if (id == MULTI_RATE_INTERVAL)
+   {
+      if (value <= 0.0)
+      {
+         char msg[1024];
+         std::stringstream val;
+         val.precision(16);
+         val << value;
+         sprintf(msg, errorMessageFormat.c_str(), val.str().c_str(),
+               "MultiRateInterval", "Real number > 0.0");
+         throw ODEModelException(msg);
+      }
+      multiRateInterval = value;
+      return multiRateInterval;
+   }
+
    // Handler for force based solve-for parameters
    if (id >= ODEModelParamCount)
    {
@@ -4328,6 +4710,28 @@ bool ODEModel::SetStringParameter(const Integer id, const std::string &value)
          
       case  USER_DEFINED:
          return false;
+
+      case MULTI_RATE_FORCES:
+      {
+         std::string list = GmatStringUtil::Trim(value);
+         StringArray entries;
+         if (GmatStringUtil::IsEnclosedWithBraces(list))
+            entries = GmatStringUtil::ToStringArray(list);
+         else if (list != "")
+            entries.push_back(list);
+
+         multiRateForceNames.clear();
+         for (UnsignedInt i = 0; i < entries.size(); ++i)
+         {
+            std::string entry = GmatStringUtil::RemoveEnclosingString(
+                  GmatStringUtil::Trim(entries[i]), "'");
+            if ((entry != "") && (find(multiRateForceNames.begin(),
+                  multiRateForceNames.end(), entry) ==
+                  multiRateForceNames.end()))
+               multiRateForceNames.push_back(entry);
+         }
+         return true;
+      }
          
 //       case  SRP:
 //          return false;
@@ -4529,6 +4933,8 @@ bool ODEModel::SetEpoch(const GmatEpoch newEpoch)
          if ((*i) != NULL)
             (*i)->SetRealParameter(EPOCH, newEpoch);
       }
+      // Callers that set the epoch directly supply unrelated states
+      ResetMultiRateData();
       retval = true;
    }
 
@@ -4536,6 +4942,26 @@ bool ODEModel::SetEpoch(const GmatEpoch newEpoch)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetMultiRateTolerance(const Real tolerance)
+//------------------------------------------------------------------------------
+/**
+ * Sets the relative accuracy required of multi-rate force data
+ *
+ * The PropSetup passes in the integrator's accuracy, so that the force data
+ * interpolated between exact evaluations is held to the same relative
+ * tolerance as the integration.
+ *
+ * @param tolerance The relative tolerance; nonpositive values are ignored
+ */
+//------------------------------------------------------------------------------
+void ODEModel::SetMultiRateTolerance(const Real tolerance)
+{
+   if (tolerance > 0.0)
+      multiRateTolerance = tolerance;
+}
+
+
 //------------------------------------------------------------------------------
 // void ODEModel::SetPropStateManager(PropagationStateManager *sm)
 //------------------------------------------------------------------------------
@@ -4606,6 +5032,8 @@ const StringArray& ODEModel::GetStringArrayParameter(const Integer id) const
       return BuildCoordinateList();
    case USER_DEFINED:
       return BuildUserForceList();
+   case MULTI_RATE_FORCES:
+      return multiRateForceNames;
 
    default:
       return PhysicalModel::GetStringArrayParameter(id);
@@ -265,6 +265,7 @@ public:
 
    // Interface added for the C Interface to force epoch updates
    bool                 SetEpoch(const GmatEpoch newEpoch); 
+   void                 SetMultiRateTolerance(const Real tolerance);
    virtual void         SetPropStateManager(PropagationStateManager *sm);
 
    virtual StringArray     GetSolveForList();
@@ -328,6 +329,31 @@ protected:
    /// Parameter IDs on spacecraft needed to access the parms during integration
    Integer satIds[7];
 
+   /// Samples of a force that is evaluated on the multi-rate grid
+   struct MultiRateForce
+   {
+      /// The force
+      PhysicalModel           *force;
+      /// Current spacing, in seconds, between exact evaluations
+      Real                    spacing;
+      /// Sample times, in seconds from multiRateEpoch, oldest first
+      RealArray               times;
+      /// The force's derivative array at each sample time
+      std::vector<RealArray>  values;
+   };
+
+   void                      BuildMultiRateList();
+   bool                      MatchesMultiRateEntry(PhysicalModel *pm,
+                                   const std::string &entry);
+   void                      ResetMultiRateData();
+   MultiRateForce*           FindMultiRateForce(PhysicalModel *pm);
+   void                      InterpolateMultiRateForce(
+                                   const MultiRateForce &mrf, Real atTime);
+   bool                      UseMultiRateSamples(const MultiRateForce &mrf,
+                                   Real atTime);
+   void                      StoreMultiRateSample(MultiRateForce &mrf,
+                                   Real atTime, const Real *ddt);
+
    /// Internal flag used to relax constraint for Cd
    bool constrainCd;
    /// Internal flag used to relax constraint for Cr
@@ -420,6 +446,23 @@ private:
 protected:
    Integer transientCount;
 
+   /// Forces scripted for multi-rate evaluation
+   StringArray                  multiRateForceNames;
+   /// Longest spacing, in seconds, between exact multi-rate evaluations
+   Real                         multiRateInterval;
+   /// Relative accuracy required of the interpolated force data
+   Real                         multiRateTolerance;
+   /// The forces evaluated on the multi-rate grid
+   std::vector<MultiRateForce>  multiRateForces;
+   /// Origin of the multi-rate sample times, or -1.0 if not yet set
+   GmatEpoch                    multiRateEpoch;
+   /// Derivative order of the stored samples
+   Integer                      multiRateOrder;
+   /// Largest acceleration component in the most recent derivative
+   Real                         multiRateScale;
+   /// Interpolated derivative data for the current force
+   RealArray                    multiRateValues;
+
    bool                      BuildModelElement(Gmat::StateElementId id, 
                                                Integer start, 
                                                Integer objectCount,
@@ -460,6 +503,10 @@ protected:
 
       // Plug-in forces not otherwise handled
       USER_DEFINED,
+
+      // Multi-rate evaluation of slowly varying forces
+      MULTI_RATE_FORCES,
+      MULTI_RATE_INTERVAL,
       ODEModelParamCount
    };
    
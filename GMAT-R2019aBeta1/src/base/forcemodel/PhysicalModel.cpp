@@ -1040,6 +1040,11 @@ Real PhysicalModel::EstimateError(Real * diffs, Real * answer) const
  * GetComponentMap(map, 1).  The array, map, that is returned will contain these
  * data: (3, 4, 5, -1, -1, -1).
  *
+ * When the model has registered the location of its Cartesian states, only
+ * those blocks are mapped, so that STM and other elements that follow them are
+ * not treated as positions.  Otherwise the state is treated as a sequence of
+ * 6-element Cartesian blocks.
+ *
  *  @param map          Array that will contain the mapping of the elements
  * @param order        The order for the mapping (1 maps 1st derivatives to
  *                     their base components, 2 maps 2nd derivatives, and so on)
@@ -1065,15 +1070,22 @@ bool PhysicalModel::GetComponentMap(Integer * map, Integer order,
    {
       // Calculate how many spacecraft are in the model
       int satCount = (int)(dimension / 6);
+      int start = 0;
+
+      if (cartesianCount > 0)
+      {
+         satCount = cartesianCount;
+         start = cartesianStart;
+      }
 
       // Ensure we don't overrun the buffer (this is paranoia, since integer
       // division effectively rounds down, but perhaps a healthy paranoia)
-      while (satCount * 6 > dimension)
+      while ((satCount > 0) && (start + satCount * 6 > dimension))
          --satCount;
 
       for (int i = 0; i < satCount; ++i)
       {
-         i6 = i * 6;
+         i6 = start + i * 6;
     
          map[ i6 ] = i6 + 3;
          map[i6+1] = i6 + 4;
@@ -41,6 +41,7 @@
 #include "RelativisticCorrection.hpp"
 #include "TimeSystemConverter.hpp"
 #include "MessageInterface.hpp"
+#include "DualNumber.hpp"
 
 //#define DEBUG_RELATIVISTIC_CORRECTION
 //#define DEBUG_DERIVATIVES
@@ -240,7 +241,8 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
 
    now         = epoch + dt/GmatTimeConstants::SECS_PER_DAY;
 
-   if (fillCartesian)
+   // The body terms are shared by the state derivatives and the A-matrix
+   if (fillCartesian || fillSTM || fillAMatrix)
    {
       Real      c      = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM * GmatMathConstants::M_TO_KM;
       sunMu            = theSun->GetGravitationalConstant();
@@ -253,21 +255,19 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
       #endif
 
       Rvector6  dummy(0.0, 1.0, 2.0, 3.0, 4.0, 5.0), dummyResult;
-      Real      r, v, s1, rvDotvvX4, s2_1, lt1, lt2;
       Rmatrix33 R;    // fixed to inertial rotation matrix
       Rmatrix33 Rdot; // fixed to inertial rotation Dot matrix
-      Real      ar[3], geodesic[3], s2[3], s3[3], schwarzschild[3], J1[3], J[3], rvCrossvv[3], vvCrossJ[3];
-      Real      rv[3], vv[3], omega[3], lenseThirring[3];
+      Real      ar[3], J1[3], J[3];
+      Real      rv[3], vv[3], omega[3];
       Rvector3  bodySpinVector;
+      bool      withGeodesic = (body->GetName() != GmatSolarSystemDefaults::SUN_NAME);
 
       J[0]             = J[1]             = J[2]             = 0.0;
       omega[0]         = omega[1]         = omega[2]         = 0.0;
-      geodesic[0]      = geodesic[1]      = geodesic[2]      = 0.0;
-      lenseThirring[0] = lenseThirring[1] = lenseThirring[2] = 0.0;
 
 
       // compute quantities needed for geodesic (for non-Sun only) and lense-thirring terms
-      if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
+      if (withGeodesic)
       {
          Rvector6  stateWRTSun;
          Real      posWRTSun[3], velWRTSun[3], vel[3], pos[3];
@@ -332,169 +332,103 @@ bool RelativisticCorrection::GetDerivatives(Real *state, Real dt, Integer order,
          MessageInterface::ShowMessage("bodySpinRate           = %le\n", bodySpinRate);
       #endif
 
-      Integer nOffset;
-      for (Integer n = 0; n < cartesianCount; ++n)
+      if (fillCartesian)
       {
-         nOffset = cartesianStart + n * 6;   // stateSize;
-         for (Integer i = 0; i < 3; ++i)
+         Integer nOffset;
+         for (Integer n = 0; n < cartesianCount; ++n)
          {
-            rv[i] = state[i+nOffset];
-            vv[i] = state[i+nOffset+3];
-         }
-
-         // Compute the Schwarzschild solution
-         r             = GmatMathUtil::Sqrt(rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2]);
-         v             = GmatMathUtil::Sqrt(vv[0] * vv[0] + vv[1] * vv[1] + vv[2] * vv[2]);
-         s1            = bodyMu / (c * c * r * r * r);
-         s2_1          = (4.0 * bodyMu / r) - (v * v);
-         s2[0]         = s2_1 * rv[0];
-         s2[1]         = s2_1 * rv[1];
-         s2[2]         = s2_1 * rv[2];
-         rvDotvvX4     = 4.0 * (rv[0] * vv[0] + rv[1] * vv[1] + rv[2] * vv[2]);
-         s3[0]         = rvDotvvX4 * vv[0];
-         s3[1]         = rvDotvvX4 * vv[1];
-         s3[2]         = rvDotvvX4 * vv[2];
-         schwarzschild[0] = s1 * (s2[0] + s3[0]);
-         schwarzschild[1] = s1 * (s2[1] + s3[1]);
-         schwarzschild[2] = s1 * (s2[2] + s3[2]);
-
-         // IF the body is not the Sun, compute the geodesic term
-         if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
-         {
-            // Compute the geodesic precession
-            geodesic[0]       =  2.0 * (omega[1]*vv[2] - omega[2]*vv[1]);
-            geodesic[1]       =  2.0 * (omega[2]*vv[0] - omega[0]*vv[2]);
-            geodesic[2]       =  2.0 * (omega[0]*vv[1] - omega[1]*vv[0]);
-         }
-         else // if it is the Sun, we don't compute the geodesic term
-         {
-            geodesic[0]       =  0.0;
-            geodesic[1]       =  0.0;
-            geodesic[2]       =  0.0;
-         }
-
-         // Compute the Lense-Thirring precession
-         rvCrossvv[0] = rv[1]*vv[2] - rv[2]*vv[1];
-         rvCrossvv[1] = rv[2]*vv[0] - rv[0]*vv[2];
-         rvCrossvv[2] = rv[0]*vv[1] - rv[1]*vv[0];
-         vvCrossJ[0]  = vv[1]*J[2]  - vv[2]*J[1];
-         vvCrossJ[1]  = vv[2]*J[0]  - vv[0]*J[2];
-         vvCrossJ[2]  = vv[0]*J[1]  - vv[1]*J[0];
-         lt1          = 2.0 * s1;
-         lt2          = (3.0 / (r * r)) * (rv[0] * J[0] + rv[1] * J[1] + rv[2] * J[2]);
-
-         lenseThirring[0]  =  lt1 * ((lt2 * rvCrossvv[0]) + vvCrossJ[0]);
-         lenseThirring[1]  =  lt1 * ((lt2 * rvCrossvv[1]) + vvCrossJ[1]);
-         lenseThirring[2]  =  lt1 * ((lt2 * rvCrossvv[2]) + vvCrossJ[2]);
-
-         //Add the terms together
-         ar[0]  = schwarzschild[0] + geodesic[0] + lenseThirring[0];
-         ar[1]  = schwarzschild[1] + geodesic[1] + lenseThirring[1];
-         ar[2]  = schwarzschild[2] + geodesic[2] + lenseThirring[2];
-
-         #ifdef DEBUG_RELATIVISTIC_CORRECTION
-            MessageInterface::ShowMessage("spacecraft position = %le   %le   %le\n", rv[0], rv[1], rv[2]);
-            MessageInterface::ShowMessage("spacecraft velocity = %le   %le   %le\n", vv[0], vv[1], vv[2]);
-            MessageInterface::ShowMessage("schwarzschild       = %le   %le   %le\n", schwarzschild[0], schwarzschild[1], schwarzschild[2]);
-            MessageInterface::ShowMessage("geodesic            = %le   %le   %le\n", geodesic[0], geodesic[1], geodesic[2]);
-            MessageInterface::ShowMessage("lenseThirring       = %le   %le   %le\n", lenseThirring[0], lenseThirring[1], lenseThirring[2]);
-         #endif
-
-         // Fill Derivatives
-         switch (order)
-         {
-            case 1:
-               deriv[0+nOffset] = 0.0;
-               deriv[1+nOffset] = 0.0;
-               deriv[2+nOffset] = 0.0;
-               deriv[3+nOffset] = ar[0];
-               deriv[4+nOffset] = ar[1];
-               deriv[5+nOffset] = ar[2];
-               break;
-
-            case 2:
-               deriv[0+nOffset] = ar[0];
-               deriv[1+nOffset] = ar[1];
-               deriv[2+nOffset] = ar[2];
-               deriv[3+nOffset] = 0.0;
-               deriv[4+nOffset] = 0.0;
-               deriv[5+nOffset] = 0.0;
-               break;
-         }
-
-      }
-   }   // fillCartesian
-
-
-   if (fillSTM)
-   {
-      // Setting all zeroes for now
-      Integer stmSize = stmRowCount * stmRowCount;
-      Real *aTilde;
-      aTilde = new Real[stmSize];
+            nOffset = cartesianStart + n * 6;   // stateSize;
+            for (Integer i = 0; i < 3; ++i)
+            {
+               rv[i] = state[i+nOffset];
+               vv[i] = state[i+nOffset+3];
+            }
 
-      Integer element;
-      for (Integer i = 0; i < stmCount; ++i)
-      {
-         Integer ix, i6 = stmStart + i * stmRowCount*stmRowCount;
+            ComputeAcceleration(rv, vv, omega, J, withGeodesic, ar);
 
-         // Calculate A-tilde
-         for (Integer j = 0; j < stmRowCount; ++j)
-         {
-            ix = j * stmRowCount;
-            for (Integer k = 0; k < stmRowCount; ++k)
-               aTilde[ix+k] = 0.0;
-         }
+            #ifdef DEBUG_RELATIVISTIC_CORRECTION
+               MessageInterface::ShowMessage("spacecraft position = %le   %le   %le\n", rv[0], rv[1], rv[2]);
+               MessageInterface::ShowMessage("spacecraft velocity = %le   %le   %le\n", vv[0], vv[1], vv[2]);
+               MessageInterface::ShowMessage("acceleration        = %le   %le   %le\n", ar[0], ar[1], ar[2]);
+            #endif
 
-         for (Integer j = 0; j < stmRowCount; j++)
-         {
-            for (Integer k = 0; k < stmRowCount; k++)
+            // Fill Derivatives
+            switch (order)
             {
-               element = j * stmRowCount + k;
-               #ifdef DEBUG_DERIVATIVES
-                  MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
-               #endif
-               deriv[i6+element] = aTilde[element];
+               case 1:
+                  deriv[0+nOffset] = 0.0;
+                  deriv[1+nOffset] = 0.0;
+                  deriv[2+nOffset] = 0.0;
+                  deriv[3+nOffset] = ar[0];
+                  deriv[4+nOffset] = ar[1];
+                  deriv[5+nOffset] = ar[2];
+                  break;
+
+               case 2:
+                  deriv[0+nOffset] = ar[0];
+                  deriv[1+nOffset] = ar[1];
+                  deriv[2+nOffset] = ar[2];
+                  deriv[3+nOffset] = 0.0;
+                  deriv[4+nOffset] = 0.0;
+                  deriv[5+nOffset] = 0.0;
+                  break;
             }
          }
-      }
-
-	  delete [] aTilde;
-   }
-   if (fillAMatrix)
-   {
-      // Setting all zeroes for now
-      Integer stmSize = stmRowCount * stmRowCount;
-      Real *aTilde;
-      aTilde = new Real[stmSize];
+      }   // fillCartesian
 
-      Integer element;
-      for (Integer i = 0; i < stmCount; ++i)
+      if (fillSTM || fillAMatrix)
       {
-         Integer ix, i6 = stmStart + i * stmRowCount*stmRowCount;
-
-         // Calculate A-tilde
-         for (Integer j = 0; j < stmRowCount; ++j)
+         // The correction depends on both position and velocity.  Its
+         // partials fill the lower rows of A-tilde, and come from evaluating
+         // the acceleration on dual numbers seeded with the Cartesian state.
+         Integer stmSize = stmRowCount * stmRowCount;
+         Real *aTilde;
+         aTilde = new Real[stmSize];
+         DualNumber<6> x[6], a[3];
+
+         Integer i6, a6, ix, associate, element;
+         Integer aiCount = (fillSTM ? stmCount : aMatrixCount);
+
+         for (Integer i = 0; i < aiCount; ++i)
          {
-            ix = j * stmRowCount;
-            for (Integer k = 0; k < stmRowCount; ++k)
-               aTilde[ix+k] = 0.0;
-         }
+            i6 = stmStart + i * stmSize;
+            a6 = aMatrixStart + i * stmSize;
+            if (!fillSTM)
+               i6 = a6;
+            associate = theState->GetAssociateIndex(i6);
+
+            for (Integer j = 0; j < 6; ++j)
+               x[j].SetVariable(state[associate+j], j);
+            ComputeAcceleration(x, x+3, omega, J, withGeodesic, a);
+
+            // Calculate A-tilde
+            for (Integer j = 0; j < stmSize; ++j)
+               aTilde[j] = 0.0;
+            for (Integer j = 0; j < 3; ++j)
+            {
+               ix = stmRowCount * (j + 3);
+               for (Integer k = 0; k < 6; ++k)
+                  aTilde[ix+k] = a[j].Derivative(k);
+            }
 
-         for (Integer j = 0; j < stmRowCount; j++)
-         {
-            for (Integer k = 0; k < stmRowCount; k++)
+            for (Integer j = 0; j < stmRowCount; ++j)
             {
-               element = j * stmRowCount + k;
-               #ifdef DEBUG_DERIVATIVES
-                  MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
-               #endif
-               deriv[i6+element] = aTilde[element];
+               for (Integer k = 0; k < stmRowCount; ++k)
+               {
+                  element = j * stmRowCount + k;
+                  #ifdef DEBUG_DERIVATIVES
+                     MessageInterface::ShowMessage("------ deriv[%d] = %12.10f\n", (i6+element), aTilde[element]);
+                  #endif
+                  if (fillSTM)
+                     deriv[i6+element] = aTilde[element];
+                  if (fillAMatrix)
+                     deriv[a6+element] = aTilde[element];
+               }
             }
          }
-      }
 
-      delete [] aTilde;
+         delete [] aTilde;
+      }
    }
 
    return true;
@@ -532,18 +466,14 @@ Rvector6 RelativisticCorrection::GetDerivativesForSpacecraft(Spacecraft* sc)
    bodyMu           = body->GetGravitationalConstant();  // from ODEModel
 
    Rvector6  dummy(0.0, 1.0, 2.0, 3.0, 4.0, 5.0), dummyResult;
-   Real      r, v, s1, rvDotvvX4, s2_1, lt1, lt2;
    Rmatrix33 R;    // fixed to inertial rotation matrix
    Rmatrix33 Rdot; // fixed to inertial rotation Dot matrix
-   Real      ar[3], geodesic[3], s2[3], s3[3], schwarzschild[3], J1[3], J[3],
-             rvCrossvv[3], vvCrossJ[3];
-   Real      rv[3], vv[3], omega[3], lenseThirring[3];
+   Real      ar[3], J1[3], J[3];
+   Real      rv[3], vv[3], omega[3];
    Rvector3  bodySpinVector;
 
    J[0]             = J[1]             = J[2]             = 0.0;
    omega[0]         = omega[1]         = omega[2]         = 0.0;
-   geodesic[0]      = geodesic[1]      = geodesic[2]      = 0.0;
-   lenseThirring[0] = lenseThirring[1] = lenseThirring[2] = 0.0;
 
    // needed for geodesic (for non-Sun only) and lense-thirring terms
    if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
@@ -640,55 +570,8 @@ Rvector6 RelativisticCorrection::GetDerivativesForSpacecraft(Spacecraft* sc)
       vv[i] = state[i+3];
    }
 
-   // Compute the Schwarzschild solution
-   r        = GmatMathUtil::Sqrt(rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2]);
-   v        = GmatMathUtil::Sqrt(vv[0] * vv[0] + vv[1] * vv[1] + vv[2] * vv[2]);
-   s1       = bodyMu / (c * c * r * r * r);
-   s2_1     = (4.0 * bodyMu / r) - (v * v);
-   s2[0]    = s2_1 * rv[0];
-   s2[1]    = s2_1 * rv[1];
-   s2[2]    = s2_1 * rv[2];
-   rvDotvvX4 = 4.0 * (rv[0] * vv[0] + rv[1] * vv[1] + rv[2] * vv[2]);
-   s3[0]    = rvDotvvX4 * vv[0];
-   s3[1]    = rvDotvvX4 * vv[1];
-   s3[2]    = rvDotvvX4 * vv[2];
-   schwarzschild[0] = s1 * (s2[0] + s3[0]);
-   schwarzschild[1] = s1 * (s2[1] + s3[1]);
-   schwarzschild[2] = s1 * (s2[2] + s3[2]);
-
-   // IF the body is not the Sun, compute the geodesic term
-   if (body->GetName() != GmatSolarSystemDefaults::SUN_NAME)
-   {
-      // Compute the geodesic precession
-      geodesic[0]       =  2.0 * (omega[1]*vv[2] - omega[2]*vv[1]);
-      geodesic[1]       =  2.0 * (omega[2]*vv[0] - omega[0]*vv[2]);
-      geodesic[2]       =  2.0 * (omega[0]*vv[1] - omega[1]*vv[0]);
-   }
-   else // if it is the Sun, we don't compute the geodesic term
-   {
-      geodesic[0]       =  0.0;
-      geodesic[1]       =  0.0;
-      geodesic[2]       =  0.0;
-   }
-
-   // Compute the Lense-Thirring precession
-   rvCrossvv[0] = rv[1]*vv[2] - rv[2]*vv[1];
-   rvCrossvv[1] = rv[2]*vv[0] - rv[0]*vv[2];
-   rvCrossvv[2] = rv[0]*vv[1] - rv[1]*vv[0];
-   vvCrossJ[0]  = vv[1]*J[2]  - vv[2]*J[1];
-   vvCrossJ[1]  = vv[2]*J[0]  - vv[0]*J[2];
-   vvCrossJ[2]  = vv[0]*J[1]  - vv[1]*J[0];
-   lt1          = 2.0 * s1;
-   lt2          = (3.0 / (r*r)) * (rv[0] * J[0] + rv[1] * J[1] + rv[2] * J[2]);
-
-   lenseThirring[0]  =  lt1 * ((lt2 * rvCrossvv[0]) + vvCrossJ[0]);
-   lenseThirring[1]  =  lt1 * ((lt2 * rvCrossvv[1]) + vvCrossJ[1]);
-   lenseThirring[2]  =  lt1 * ((lt2 * rvCrossvv[2]) + vvCrossJ[2]);
-
-   //Add the terms together
-   ar[0]  = schwarzschild[0] + geodesic[0] + lenseThirring[0];
-   ar[1]  = schwarzschild[1] + geodesic[1] + lenseThirring[1];
-   ar[2]  = schwarzschild[2] + geodesic[2] + lenseThirring[2];
+   ComputeAcceleration(rv, vv, omega, J,
+         body->GetName() != GmatSolarSystemDefaults::SUN_NAME, ar);
 
    dv[0] = 0.0;
    dv[1] = 0.0;
@@ -947,7 +830,61 @@ bool RelativisticCorrection::SetStart(Gmat::StateElementId id, Integer index,
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
-// N/A
+
+//------------------------------------------------------------------------------
+// void ComputeAcceleration(const T *rv, const T *vv, const Real *omega,
+//       const Real *J, bool withGeodesic, T *ar) const
+//------------------------------------------------------------------------------
+/**
+ * Computes the relativistic acceleration on a spacecraft
+ *
+ * The method is templated on its number type so that the same code gives the
+ * acceleration (T = Real) and its partials with respect to the state
+ * (T = DualNumber).
+ *
+ * @param rv           The spacecraft position w.r.t. the body
+ * @param vv           The spacecraft velocity w.r.t. the body
+ * @param omega        The geodesic precession rate of the body frame
+ * @param J            The body angular momentum per unit mass
+ * @param withGeodesic true to include the geodesic (de Sitter) term
+ * @param ar           The resulting acceleration
+ */
+//------------------------------------------------------------------------------
+template <class T>
+void RelativisticCorrection::ComputeAcceleration(const T *rv, const T *vv,
+      const Real *omega, const Real *J, bool withGeodesic, T *ar) const
+{
+   using std::sqrt;
+
+   Real c  = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM * GmatMathConstants::M_TO_KM;
+
+   // Compute the Schwarzschild solution
+   T r2        = rv[0] * rv[0] + rv[1] * rv[1] + rv[2] * rv[2];
+   T r         = sqrt(r2);
+   T v2        = vv[0] * vv[0] + vv[1] * vv[1] + vv[2] * vv[2];
+   T s1        = bodyMu / (c * c * r2 * r);
+   T s2_1      = (4.0 * bodyMu / r) - v2;
+   T rvDotvvX4 = 4.0 * (rv[0] * vv[0] + rv[1] * vv[1] + rv[2] * vv[2]);
+
+   for (Integer i = 0; i < 3; ++i)
+      ar[i] = s1 * (s2_1 * rv[i] + rvDotvvX4 * vv[i]);
+
+   // Add the geodesic precession if the body is not the Sun
+   if (withGeodesic)
+   {
+      ar[0] += 2.0 * (omega[1]*vv[2] - omega[2]*vv[1]);
+      ar[1] += 2.0 * (omega[2]*vv[0] - omega[0]*vv[2]);
+      ar[2] += 2.0 * (omega[0]*vv[1] - omega[1]*vv[0]);
+   }
+
+   // Add the Lense-Thirring precession
+   T lt1 = 2.0 * s1;
+   T lt2 = (3.0 / r2) * (rv[0] * J[0] + rv[1] * J[1] + rv[2] * J[2]);
+
+   ar[0] += lt1 * ((lt2 * (rv[1]*vv[2] - rv[2]*vv[1])) + (vv[1]*J[2] - vv[2]*J[1]));
+   ar[1] += lt1 * ((lt2 * (rv[2]*vv[0] - rv[0]*vv[2])) + (vv[2]*J[0] - vv[0]*J[2]));
+   ar[2] += lt1 * ((lt2 * (rv[0]*vv[1] - rv[1]*vv[0])) + (vv[0]*J[1] - vv[1]*J[0]));
+}
 
 //------------------------------------------------------------------------------
 // private methods
@@ -112,6 +112,10 @@ protected:
 
    CoordinateConverter cc;
 
+   /// Acceleration kernel, evaluated on DualNumbers for the A-matrix
+   template <class T>
+   void ComputeAcceleration(const T *rv, const T *vv, const Real *omega,
+                            const Real *J, bool withGeodesic, T *ar) const;
 
 private:
 
@@ -38,6 +38,8 @@
 // static data
 //------------------------------------------------------------------------------
 bool Harmonic::matrixTruncationWasPosted = false;
+std::map<Integer, Harmonic::NormalizationTables*> Harmonic::sharedTables;
+std::mutex Harmonic::tablesMutex;
 //------------------------------------------------------------------------------
 // public methods
 //------------------------------------------------------------------------------
@@ -49,16 +51,12 @@ Harmonic::Harmonic ()
      C          (NULL),
      S          (NULL),
      A          (NULL),
-     V          (NULL),
      Re         (NULL),
      Im         (NULL),
-     N1         (NULL),
-     N2         (NULL),
-     VR01       (NULL),
-     VR11       (NULL),
-     VR02       (NULL),
-     VR12       (NULL),
-     VR22       (NULL)
+     Tables     (NULL),
+     DeltaMax   (-1),
+     DeltaC     (NULL),
+     DeltaS     (NULL)
    {
       theTimeConverter = TimeSystemConverter::Instance();
    }
@@ -100,17 +98,30 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
    Real u = pos[2]/r; // sin(phi), phi = geocentric latitude
 
    // Calculate values for A -----------------------------------------
-   // generate the off-diagonal elements
-   A[1][0] = u*sqrt(Real(3.0));
-   for (Integer n=1;  n<=NN+XS && n<=nn+XS;  ++n)
-      A[n+1][n] = u*sqrt(Real(2*n+3))*A[n][n];
-
-   // apply column-fill recursion formula (Table 2, Row I, Ref.[1])
-   for (Integer m=0;  m<=MM+XS && m<=mm+XS;  ++m)
+   // Fill A one degree at a time, so each row is written in memory order
+   // and the two rows it depends on are the ones written just before it
+   Integer nmax = (NN < nn ? NN : nn) + XS;
+   Integer mmax = (MM < mm ? MM : mm) + XS;
+   const Real *offDiagonal = Tables->OffDiagonal;
+   A[AIndex(1,0)] = u*offDiagonal[1];
+   for (Integer n=2;  n<=nmax+1;  ++n)
+      {
+      Real       *An   = A + AIndex(n,0);
+      const Real *An_1 = A + AIndex(n-1,0);
+      const Real *An_2 = A + AIndex(n-2,0);
+      // off-diagonal element
+      An[n-1] = u*offDiagonal[n]*An_1[n-1];
+      if (n > nmax)
+         break;
+      // apply column-fill recursion formula (Table 2, Row I, Ref.[1])
+      const Real *N1n = Tables->N1 + Index(n,0);
+      const Real *N2n = Tables->N2 + Index(n,0);
+      for (Integer m=0;  m<=n-2 && m<=mmax;  ++m)
+         An[m] = u * N1n[m] * An_1[m] - N2n[m] * An_2[m];
+      }
+   // Ref.[3], Eq.(24)
+   for (Integer m=0;  m<=mmax;  ++m)
       {
-      for (Integer n=m+2;  n<=NN+XS && n<=nn+XS;  ++n)
-         A[n][m] = u * N1[n][m] * A[n-1][m] - N2[n][m] * A[n-2][m];
-      // Ref.[3], Eq.(24)
       Re[m] = m==0 ? 1 : s*Re[m-1] - t*Im[m-1]; // real part of (s + i*t)^m
       Im[m] = m==0 ? 0 : s*Im[m-1] + t*Re[m-1]; // imaginary part of (s + i*t)^m
       }
@@ -152,18 +163,40 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
       Real sum34 = 0;
       Real sum44 = 0;
 
+      // Rows of the packed arrays used for this degree
+      Integer     row   = Index(n,0);
+      const Real *Cn    = C + row;
+      const Real *Sn    = S + row;
+      const Real *An    = A + AIndex(n,0);
+      const Real *An1   = A + AIndex(n+1,0);
+      const Real *An2   = A + AIndex(n+2,0);
+      const Real *VR01n = Tables->VR01 + row;
+      const Real *VR11n = Tables->VR11 + row;
+      const Real *VR02n = Tables->VR02 + row;
+      const Real *VR12n = Tables->VR12 + row;
+      const Real *VR22n = Tables->VR22 + row;
+      // Increments apply to the low degrees only
+      bool        incremented = (n <= DeltaMax);
+      const Real *DeltaCn = incremented ? DeltaC + row : NULL;
+      const Real *DeltaSn = incremented ? DeltaS + row : NULL;
+
       for (Integer m=0;  m <= n && m<=MM && m<=mm;  ++m) // wcs - removed "m<=n"
          {
-         Real Cval = Cnm (jday,n,m);
-         Real Sval = Snm (jday,n,m);
+         Real Cval = Cn[m];
+         Real Sval = Sn[m];
+         if (incremented)
+            {
+            Cval += DeltaCn[m];
+            Sval += DeltaSn[m];
+            }
          // Pines Equation 27 (Part of)
          Real D =            (Cval*Re[m]   + Sval*Im[m]) * sqrt2;
          Real E = m==0 ? 0 : (Cval*Re[m-1] + Sval*Im[m-1]) * sqrt2;
          Real F = m==0 ? 0 : (Sval*Re[m-1] - Cval*Im[m-1]) * sqrt2;
          // Correct for normalization
-         Real Avv00 = A[n][m];
-         Real Avv01 = VR01[n][m] * A[n][m+1];
-         Real Avv11 = VR11[n][m] * A[n+1][m+1];
+         Real Avv00 = An[m];
+         Real Avv01 = VR01n[m] * An[m+1];
+         Real Avv11 = VR11n[m] * An1[m+1];
          // Pines Equation 30 and 30b (Part of)
          sum1 += m * Avv00 * E;
          sum2 += m * Avv00 * F;
@@ -180,9 +213,9 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
                Real G = m<=1 ? 0 : (Cval*Re[m-2] + Sval*Im[m-2]) * sqrt2;
                Real H = m<=1 ? 0 : (Sval*Re[m-2] - Cval*Im[m-2]) * sqrt2;
                // Correct for normalization
-               Real Avv02 = VR02[n][m] * A[n][m+2];
-               Real Avv12 = VR12[n][m] * A[n+1][m+2];
-               Real Avv22 = VR22[n][m] * A[n+2][m+2];
+               Real Avv02 = VR02n[m] * An[m+2];
+               Real Avv12 = VR12n[m] * An1[m+2];
+               Real Avv22 = VR22n[m] * An2[m+2];
                if (GmatMathUtil::IsNaN(Avv02) || GmatMathUtil::IsInf(Avv02))
                   Avv02 = 0.0;  // ************** wcs added ****
 
@@ -262,100 +295,134 @@ void Harmonic::CalculateField (const Real& jday, const Real pos[3],
 //------------------------------------------------------------------------------
 void Harmonic::Allocate()
    {
-   AllocateArray(C,NN,0);
-   AllocateArray(S,NN,0);
-   AllocateArray(A,NN,3);
-   AllocateArray(V,NN,3);
+   Integer count = Index(NN,NN) + 1;
+   AllocatePacked(C,count);
+   AllocatePacked(S,count);
+   AllocatePacked(A,AIndex(NN+4,0));
    AllocateArray(Re,NN,3);
    AllocateArray(Im,NN,3);
-   AllocateArray(N1,NN,3);
-   AllocateArray(N2,NN,3);
-   AllocateArray(VR01,NN,0);
-   AllocateArray(VR11,NN,0);
-   AllocateArray(VR02,NN,0);
-   AllocateArray(VR12,NN,0);
-   AllocateArray(VR22,NN,0);
+   ReleaseTables(Tables);
+   Tables = AcquireTables(NN);
 
    // initialize the diagonal elements (not a function of the input)
-   A[0][0] = 1.0;
-   for (Integer n=1;  n<=NN+2;  ++n)
-      A[n][n] = sqrt (Real(2*n+1)/Real(2*n)) * A[n-1][n-1];
+   for (Integer n=0;  n<=NN+2;  ++n)
+      A[AIndex(n,n)] = Tables->Diagonal[n];
+   }
+//------------------------------------------------------------------------------
+void Harmonic::Deallocate()
+   {
+   DeallocateArray(C,NN,0);
+   DeallocateArray(S,NN,0);
+   DeallocateArray(A,NN,3);
+   DeallocateArray(Re,NN,3);
+   DeallocateArray(Im,NN,3);
+   ReleaseTables(Tables);
+   }
+//------------------------------------------------------------------------------
+const Harmonic::NormalizationTables* Harmonic::AcquireTables (const Integer& degree)
+   {
+   std::lock_guard<std::mutex> lock(tablesMutex);
+   std::map<Integer, NormalizationTables*>::iterator found = sharedTables.find(degree);
+   if (found != sharedTables.end())
+      {
+      ++found->second->Users;
+      return found->second;
+      }
+
+   NormalizationTables* tables = new NormalizationTables;
+   tables->Degree = degree;
+   tables->Users = 1;
+   Integer rows  = degree+4;            // n = 0..degree+3
+   Integer count = Index(rows,0);
+   AllocateArray(tables->Diagonal,degree,3);
+   AllocateArray(tables->OffDiagonal,degree,3);
+   AllocatePacked(tables->V,count);
+   AllocatePacked(tables->N1,count);
+   AllocatePacked(tables->N2,count);
+   AllocatePacked(tables->VR01,count);
+   AllocatePacked(tables->VR11,count);
+   AllocatePacked(tables->VR02,count);
+   AllocatePacked(tables->VR12,count);
+   AllocatePacked(tables->VR22,count);
+
+   // diagonal elements of A, and the factors for the elements next to them
+   tables->Diagonal[0] = 1.0;
+   for (Integer n=1;  n<=degree+2;  ++n)
+      tables->Diagonal[n] = sqrt (Real(2*n+1)/Real(2*n)) * tables->Diagonal[n-1];
+   for (Integer n=1;  n<=degree+3;  ++n)
+      tables->OffDiagonal[n] = sqrt(Real(2*n+1));
 
    // Compute normalization coefficients V(n,m)     V(0..degree,0..order)
    //   V(n,0) = sqrt (2n+1)
    //   V(n,m) = sqrt (2(2n+1) * (n-m)! / (n+m)! )
    //   note that
    //       V(n,m) = V(n,m-1) / sqrt( (n+m) * (n-m+1) )
-   for (Integer n=0;  n<=NN+2;  ++n)
+   for (Integer n=0;  n<=degree+2;  ++n)
       {
-      V[n][0] = sqrt(Real(2*(2*n+1)));   // Temporary, to make following loop work
-       for (Integer m=1;  m<=n+2 && m<=MM+2;  ++m)
+      Real* Vn = tables->V + Index(n,0);
+      Vn[0] = sqrt(Real(2*(2*n+1)));   // Temporary, to make following loop work
+      for (Integer m=1;  m<=n;  ++m)
          {
-         V[n][m] = V[n][m-1] / sqrt(Real((n+m)*(n-m+1)));
+         Vn[m] = Vn[m-1] / sqrt(Real((n+m)*(n-m+1)));
          }
-      V[n][0] = sqrt(Real(2*n+1));       // Now set true value
+      Vn[0] = sqrt(Real(2*n+1));       // Now set true value
       }
-   for (Integer n=0;  n<=NN;  ++n)
-      for (Integer m=0;  m<=n && m<=MM;  ++m)
+   for (Integer n=0;  n<=degree;  ++n)
+      for (Integer m=0;  m<=n;  ++m)
          {
          Real nn = n;
-         VR01[n][m] = sqrt(Real((nn-m)*(nn+m+1)));
-         VR11[n][m] = sqrt(Real((2*nn+1)*(nn+m+2)*(nn+m+1))/Real((2*nn+3)));
-         VR02[n][m] = sqrt(Real((nn-m)*(nn-m-1)*(nn+m+1)*(nn+m+2))) ;
-         VR12[n][m] = sqrt(Real(2*nn+1)/Real(2*nn+3)*Real((nn-m)*(nn+m+1)*(nn+m+2)*(nn+m+3)));
-         VR22[n][m] = sqrt(Real(2*nn+1)/Real(2*nn+5)*Real((nn+m+1)*(nn+m+2)*(nn+m+3)*(nn+m+4)));
+         Integer k = Index(n,m);
+         tables->VR01[k] = sqrt(Real((nn-m)*(nn+m+1)));
+         tables->VR11[k] = sqrt(Real((2*nn+1)*(nn+m+2)*(nn+m+1))/Real((2*nn+3)));
+         tables->VR02[k] = sqrt(Real((nn-m)*(nn-m-1)*(nn+m+1)*(nn+m+2))) ;
+         tables->VR12[k] = sqrt(Real(2*nn+1)/Real(2*nn+3)*Real((nn-m)*(nn+m+1)*(nn+m+2)*(nn+m+3)));
+         tables->VR22[k] = sqrt(Real(2*nn+1)/Real(2*nn+5)*Real((nn+m+1)*(nn+m+2)*(nn+m+3)*(nn+m+4)));
          if (m==0) 
             {
-            VR01[n][m] /= sqrt(Real(2));
-            VR11[n][m] /= sqrt(Real(2));
-            VR02[n][m] /= sqrt(Real(2));
-            VR12[n][m] /= sqrt(Real(2));
-            VR22[n][m] /= sqrt(Real(2));
+            tables->VR01[k] /= sqrt(Real(2));
+            tables->VR11[k] /= sqrt(Real(2));
+            tables->VR02[k] /= sqrt(Real(2));
+            tables->VR12[k] /= sqrt(Real(2));
+            tables->VR22[k] /= sqrt(Real(2));
             }
          }
 
-   for (Integer m=0;  m<=MM+2;  ++m)
+   for (Integer n=2;  n<=degree+2;  ++n)
       {
-      for (Integer n=m+2;  n<=NN+2;  ++n)
+      for (Integer m=0;  m<=n-2;  ++m)
          {
-         N1[n][m] = sqrt (Real((2*n+1)*(2*n-1)) / Real((n-m)*(n+m)));
-         N2[n][m] = sqrt (Real((2*n+1)*(n-m-1)*(n+m-1)) / 
-                          Real((2*n-3)*(n+m)*(n-m)));
+         Integer k = Index(n,m);
+         tables->N1[k] = sqrt (Real((2*n+1)*(2*n-1)) / Real((n-m)*(n+m)));
+         tables->N2[k] = sqrt (Real((2*n+1)*(n-m-1)*(n+m-1)) / 
+                               Real((2*n-3)*(n+m)*(n-m)));
          }
       }
+
+   sharedTables[degree] = tables;
+   return tables;
    }
 //------------------------------------------------------------------------------
-void Harmonic::Deallocate()
-   {
-   DeallocateArray(C,NN,0);
-   DeallocateArray(S,NN,0);
-   DeallocateArray(A,NN,3);
-   DeallocateArray(V,NN,3);
-   DeallocateArray(Re,NN,3);
-   DeallocateArray(Im,NN,3);
-   DeallocateArray(N1,NN,3);
-   DeallocateArray(N2,NN,3);
-   DeallocateArray(VR01,NN,0);
-   DeallocateArray(VR11,NN,0);
-   DeallocateArray(VR02,NN,0);
-   DeallocateArray(VR12,NN,0);
-   DeallocateArray(VR22,NN,0);
-   }
-//------------------------------------------------------------------------------
-void Harmonic::AllocateArray(Real**& a, const Integer& nn, const Integer& excess)
+void Harmonic::ReleaseTables (const NormalizationTables*& tables)
    {
-   // Allocate out to full m, regardless of M_FileOrder
-   a = new Real*[nn+1+excess];
-   if (!a)
-      throw ODEModelException ("Harmonic::AllocateArray failed");
-   for (Integer n=0;  n<=nn+1+excess-1;  ++n)
-      {
-      a[n] = new Real[nn+1+excess];   // wcs 2011.06.02 n -> nn
-      if (!a[n])
-         throw ODEModelException ("Harmonic::AllocateArray failed");
-      for (Integer m=0;  m<=nn+1+excess-1;  ++m)   // wcs 2011.06.02  n -> nn
-         a[n][m] = 0.0;
-      }
+   if (tables == NULL)
+      return;
+   std::lock_guard<std::mutex> lock(tablesMutex);
+   NormalizationTables* shared = sharedTables[tables->Degree];
+   tables = NULL;
+   if (--shared->Users > 0)
+      return;
+   sharedTables.erase(shared->Degree);
+   DeallocateArray(shared->Diagonal,0,0);
+   DeallocateArray(shared->OffDiagonal,0,0);
+   DeallocateArray(shared->V,0,0);
+   DeallocateArray(shared->N1,0,0);
+   DeallocateArray(shared->N2,0,0);
+   DeallocateArray(shared->VR01,0,0);
+   DeallocateArray(shared->VR11,0,0);
+   DeallocateArray(shared->VR02,0,0);
+   DeallocateArray(shared->VR12,0,0);
+   DeallocateArray(shared->VR22,0,0);
+   delete shared;
    }
 //------------------------------------------------------------------------------
 void Harmonic::AllocateArray(Real*& a, const Integer& nn, const Integer& excess)
@@ -367,21 +434,13 @@ void Harmonic::AllocateArray(Real*& a, const Integer& nn, const Integer& excess)
       a[n] = 0.0;
    }
 //------------------------------------------------------------------------------
-void Harmonic::DeallocateArray(Real**& a, const Integer& nn, const Integer& excess)
+void Harmonic::AllocatePacked(Real*& a, const Integer& count)
    {
-   if (a != NULL)
-      {
-      for (Integer n=0;  n<=nn+1+excess-1;  ++n)
-         {
-         if (a[n] != NULL)
-            {
-            delete[] a[n];
-            a[n] = NULL;
-            }
-         }
-      delete[] a;
-      a = NULL;
-      }
+   a = new Real[count];
+   if (!a)
+      throw ODEModelException ("Harmonic::AllocatePacked failed");
+   for (Integer k=0;  k<count;  ++k)
+      a[k] = 0.0;
    }
 //------------------------------------------------------------------------------
 void Harmonic::DeallocateArray(Real*& a, const Integer& nn, const Integer& excess)
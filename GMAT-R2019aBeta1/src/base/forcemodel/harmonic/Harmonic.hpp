@@ -54,6 +54,12 @@
 // Under Contract:  P.O.  GSFC S-67521-G
 //
 // Modification History : May 2010 - John Downing, GSFC.
+//
+// The Legendre values, normalization factors and coefficients are stored
+// packed by degree, row n holding orders 0..n, so the summation and the
+// row by row recursion read them in memory order.  The normalization
+// factors depend only on the degree, so fields of the same degree share
+// one set of them.
 //====================================================================
 #ifndef Harmonic_hpp
 #define Harmonic_hpp
@@ -61,6 +67,8 @@
 #include "gmatdefs.hpp"
 #include "Rmatrix33.hpp"
 #include "TimeSystemConverter.hpp"   // for the TimeSystemConverter singleton
+#include <map>
+#include <mutex>
 
 //------------------------------------------------------------------------------
 class GMAT_API Harmonic
@@ -86,25 +94,46 @@ public:
        const Integer& gradientlimit, Real acc[3], Rmatrix33& gradient) const;
 //--------------------------------------------------------------------
 protected:
+   /// Normalization factors for the recursion and the summation.  They
+   /// depend only on n and m, so one set serves every field of a degree.
+   struct NormalizationTables
+      {
+      Integer     Degree;  // Rows 0..Degree+3 are allocated
+      Integer     Users;   // Number of fields sharing the tables
+      Real*       Diagonal;    // A[n][n]
+      Real*       OffDiagonal; // sqrt(2n+1), A[n][n-1] = u*OffDiagonal[n]*A[n-1][n-1]
+      Real*       V;       // Normalization factor, packed by degree
+      Real*       N1;      // Column recursion factors, packed by degree
+      Real*       N2;
+      Real*       VR01;    // Normalization ratios, packed by degree
+      Real*       VR11;
+      Real*       VR02;
+      Real*       VR12;
+      Real*       VR22;
+      };
+
    Integer     NN;      // Maximum value of n (Jn=J2,J3...)
    Integer     MM;      // Maximum value of m (Jnm=Jn2,Jn3...
    Real        FieldRadius;  // Radius for harmonic coefficients
    Real        Factor;  // Factor = 1 (magnetic) or -mu (gravity)
-   Real**      C;       // Normalized harmonic coefficients
-   Real**      S;       // Normalized harmonic coefficients
-   Real**      A;       // Normalized 'derived' Assoc. Legendre Poly
-   Real**      V;       // Normalization factor
+   Real*       C;       // Normalized harmonic coefficients, packed by degree
+   Real*       S;       // Normalized harmonic coefficients, packed by degree
+   Real*       A;       // Normalized 'derived' Assoc. Legendre Poly, see AIndex
    Real*       Re;      // powers of projection of pos onto x_ecf (re)
    Real*       Im;      // powers of projection of pos onto y_ecf (im)
-   Real**      N1;      // Temporary
-   Real**      N2;      // Temporary
-   Real**      VR01;    // Temporary
-   Real**      VR11;    // Temporary
-   Real**      VR02;    // Temporary
-   Real**      VR12;    // Temporary
-   Real**      VR22;    // Temporary
+   const NormalizationTables* Tables;  // Shared normalization factors
+   /// Time varying increments to C and S (tides), packed by degree.  Only
+   /// degrees 0..DeltaMax are incremented; -1 turns the increments off.
+   Integer     DeltaMax;
+   const Real* DeltaC;
+   const Real* DeltaS;
    /// Flag used to warn about truncating matrix calculations to 20x20 only once
    static bool matrixTruncationWasPosted;
+   /// Normalization tables in use, by degree
+   static std::map<Integer, NormalizationTables*> sharedTables;
+   /// Guards sharedTables and the user counts, since fields are built and
+   /// released on more than one thread
+   static std::mutex tablesMutex;
 
    /// Time converter singleton
    TimeSystemConverter *theTimeConverter;
@@ -112,12 +141,17 @@ protected:
    void Allocate();
    void Deallocate();
 protected:
-   static void AllocateArray (Real**& a,   
-      const Integer& nn, const Integer& excess);
+   /// Index of (n,m) in the arrays packed by degree (m <= n)
+   static Integer Index (const Integer& n, const Integer& m)
+      { return n*(n+1)/2 + m; }
+   /// Index of (n,m) in A, whose rows also hold the zeros at m = n+1, n+2
+   static Integer AIndex (const Integer& n, const Integer& m)
+      { return n*(n+5)/2 + m; }
+   static const NormalizationTables* AcquireTables (const Integer& degree);
+   static void ReleaseTables (const NormalizationTables*& tables);
    static void AllocateArray (Real*& a,    
       const Integer& nn, const Integer& excess);
-   static void DeallocateArray (Real**& a, 
-      const Integer& nn, const Integer& excess);
+   static void AllocatePacked (Real*& a, const Integer& count);
    static void DeallocateArray (Real*& a,  
       const Integer& nn, const Integer& excess);
 //--------------------------------------------------------------------
@@ -145,11 +145,11 @@ Real HarmonicGravity::Cnm (const Real& jday, const Integer& n, const Integer& m)
    {
    if ((n <= LoveMax) && (m <= LoveMax) && (TideLevel > 0))
       {
-      return C[n][m] + DeltaC[n][m];
+      return C[Index(n,m)] + TideC[Index(n,m)];
       }
    else
       {
-      return C[n][m];
+      return C[Index(n,m)];
       }
    }
 //------------------------------------------------------------------------------
@@ -157,11 +157,11 @@ Real HarmonicGravity::Snm (const Real& jday, const Integer& n, const Integer& m)
    {
    if ((n <= LoveMax) && (m <= LoveMax) && (TideLevel > 0))
       {
-      return S[n][m] + DeltaS[n][m];
+      return S[Index(n,m)] + TideS[Index(n,m)];
       }
    else
       {
-      return S[n][m];
+      return S[Index(n,m)];
       }
    }
 //------------------------------------------------------------------------------
@@ -212,6 +212,11 @@ void HarmonicGravity::CalculateFullField (const Real& jday, const Real pos[3],
       if (othermukm > 0)
          IncrementSolidTide (otherpos,othermukm);
       }
+   // The tides only change the first few degrees; the summation adds
+   // these increments to those rows and reads the rest of C and S as is
+   DeltaMax = TideLevel > 0 ? LoveMax : -1;
+   DeltaC   = TideC;
+   DeltaS   = TideS;
    Real      accpoint[3];
    Real      accharmonic[3];
    Rmatrix33 gradientpoint;
@@ -258,9 +263,9 @@ void HarmonicGravity::WriteCofFile (const std::string& filename)
          {
          f << "RECOEF  " << GmatStringUtil::ToString (n,3) << GmatStringUtil::ToString (m,3);
          f << "   ";
-         f << GmatStringUtil::ToString (C[n][m],false,true,true,14,21);
+         f << GmatStringUtil::ToString (C[Index(n,m)],false,true,true,14,21);
          if (m != 0)
-            f << GmatStringUtil::ToString (S[n][m],false,true,true,14,21);
+            f << GmatStringUtil::ToString (S[Index(n,m)],false,true,true,14,21);
          f << std::endl;
          }
    f.close();
@@ -416,12 +421,11 @@ static void PolarToLegendre(const Real polar[3], Real P[5][5])
 //------------------------------------------------------------------------------
 void HarmonicGravity::ClearDeltaCS ()
    {
-   for (int n=0;  n<=LoveMax;  ++n)
-      for (int m=0;  m<=LoveMax;  ++m)
-         {
-         DeltaC[n][m] = 0;
-         DeltaS[n][m] = 0;
-         }
+   for (int k=0;  k<LoveCount;  ++k)
+      {
+      TideC[k] = 0;
+      TideS[k] = 0;
+      }
    }
 //------------------------------------------------------------------------------
 void HarmonicGravity::IncrementSolidTide (const Real pos[3], const Real& mukm)
@@ -438,12 +442,12 @@ void HarmonicGravity::IncrementSolidTide (const Real pos[3], const Real& mukm)
       for (Integer m=0;  m<=n;  ++m)  // should this be m <= 2????
          {
          Real f  = massratio*Pow(FieldRadius/polar[0],n+1)*poly[n][m];
-         DeltaC[n][m] += K[n][m]/(2*n+1) * (f*Cos(m*polar[2]));
-         DeltaS[n][m] += K[n][m]/(2*n+1) * (f*Sin(m*polar[2]));
+         TideC[Index(n,m)] += K[n][m]/(2*n+1) * (f*Cos(m*polar[2]));
+         TideS[Index(n,m)] += K[n][m]/(2*n+1) * (f*Sin(m*polar[2]));
          if (n==2)
             {
-            DeltaC[4][m] += KPlus[m]/(2*n+1) * (f*Cos(m*polar[2]));
-            DeltaS[4][m] += KPlus[m]/(2*n+1) * (f*Sin(m*polar[2]));
+            TideC[Index(4,m)] += KPlus[m]/(2*n+1) * (f*Cos(m*polar[2]));
+            TideS[Index(4,m)] += KPlus[m]/(2*n+1) * (f*Sin(m*polar[2]));
             }
          }
    }
@@ -527,7 +531,7 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
       theta_f = -theta_f * GmatMathConstants::RAD_PER_DEG; // radians
       freq_dep_C20 += (Table63b[f][5]*Cos(theta_f)-Table63b[f][6]*Sin(theta_f)); // eqn 5a
       }
-   DeltaC[2][0] += freq_dep_C20 * 1e-12;
+   TideC[Index(2,0)] += freq_dep_C20 * 1e-12;
 
    // compute (2,1) freq dependent terms, IERS eqn 5b, p.60, (n=2,m=1)
    Real freq_dep_C21 = 0;
@@ -543,8 +547,8 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
       freq_dep_C21 += Table63a[f][5]*Sin(theta_f)+Table63a[f][6]*Cos(theta_f); // eqn 5b
       freq_dep_S21 += Table63a[f][5]*Cos(theta_f)-Table63a[f][6]*Sin(theta_f); // eqn 5b
       }
-   DeltaC[2][1] += freq_dep_C21 * 1e-12;
-   DeltaS[2][1] += freq_dep_S21 * 1e-12;
+   TideC[Index(2,1)] += freq_dep_C21 * 1e-12;
+   TideS[Index(2,1)] += freq_dep_S21 * 1e-12;
 
    // compute (2,2) freq dependent terms, IERS eqn 5b, p.60, (n=2,m=2)
    Real freq_dep_C22 = 0;
@@ -561,8 +565,8 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
       freq_dep_S22 += (-Table63c[f][5]*Sin(theta_f));
       }
 
-   DeltaC[2][2] += freq_dep_C22 * 1e-12;
-   DeltaS[2][2] += freq_dep_S22 * 1e-12;
+   TideC[Index(2,2)] += freq_dep_C22 * 1e-12;
+   TideS[Index(2,2)] += freq_dep_S22 * 1e-12;
 
    // solid earth pole tide, IERS p.65
    // Commented out unless we have xp and yp data
@@ -574,12 +578,12 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
    Real m1 =   xp-xp_bar;
    Real m2 = -(yp-yp_bar);
 
-   DeltaC[2][1] -= 1.333E-09*(m1+0.0115*m2);
-   DeltaS[2][1] -= 1.333E-09*(m2-0.0115*m1);
+   TideC[Index(2,1)] -= 1.333E-09*(m1+0.0115*m2);
+   TideS[Index(2,1)] -= 1.333E-09*(m2-0.0115*m1);
 
    // ocean pole tide (TechNote 32 working version, section 6.3, p.10)
-   DeltaC[2][1] -= 2.2344E-10*(m1-0.01737*m2);
-   DeltaS[2][1] -= 1.7680E-10*(m2-0.03351*m1);
+   TideC[Index(2,1)] -= 2.2344E-10*(m1-0.01737*m2);
+   TideS[Index(2,1)] -= 1.7680E-10*(m2-0.03351*m1);
 
    #ifdef DEBUG_TIDE
       MessageInterface::ShowMessage("Tide coefficients:\n");
@@ -587,7 +591,7 @@ void HarmonicGravity::IncrementEarthTide (const Real& jday,
          for (Integer m=0;  m<=n;  ++m)
             {
             MessageInterface::ShowMessage("   C[%d][%d] = %le, S[%d][%d] = %le\n", n, m,
-               CTide[n][m], n, m, STide[n][m]);
+               TideC[Index(n,m)], n, m, TideS[Index(n,m)]);
             }
    #endif      
    }
@@ -665,6 +669,7 @@ void HarmonicGravity::LM_SetCoefficients (const StringArray& sa,
    if (!good) LM_Error ("Conversion Error");
    if (n > NN) LM_Error ("n is greater than NN");
    if (m > MM) LM_Error ("m is greater than MM");
+   if (m > n) LM_Error ("m is greater than n");
    s = 0;
    if (m > 0)
       {
@@ -674,10 +679,11 @@ void HarmonicGravity::LM_SetCoefficients (const StringArray& sa,
       }
    if (!Normalized)
       {
-      if (V[n][m] != 0)
+      Real v = Tables->V[Index(n,m)];
+      if (v != 0)
          {
-         c /= V[n][m];
-         s /= V[n][m];
+         c /= v;
+         s /= v;
          }
       else
          {
@@ -689,8 +695,8 @@ void HarmonicGravity::LM_SetCoefficients (const StringArray& sa,
       AddZeroTide (n,m,c,s);
    else
       {
-      C[n][m] = c;
-      S[n][m] = s;
+      C[Index(n,m)] = c;
+      S[Index(n,m)] = s;
       }
    }
 //------------------------------------------------------------------------------
@@ -1116,7 +1122,7 @@ void HarmonicGravity::CheckEarthCoefficient()
    if (BodyName == SolarSystem::EARTH_NAME && C != NULL && NN >= 2)
    {
       // Special case for Earth
-      bool tidefreemodel = C[2][0] > -4.84167E-04;
+      bool tidefreemodel = C[Index(2,0)] > -4.84167E-04;
       HaveTideFree = tidefreemodel;
       HaveZeroTide = !tidefreemodel;
    }
@@ -36,6 +36,8 @@
 #include "Rmatrix33.hpp"
 //------------------------------------------------------------------------------
 const Integer LoveMax = 4;
+/// Number of (n,m) pairs with m <= n <= LoveMax
+const Integer LoveCount = (LoveMax+1)*(LoveMax+2)/2;
 //------------------------------------------------------------------------------
 class GMAT_API HarmonicValue {
 public:
@@ -106,9 +108,9 @@ private:
    // Love Numbers
    Real   K[LoveMax+1][LoveMax+1];   
    Real   KPlus[LoveMax+1];
-   // Variable Coefficients (Temporary)
-   Real   DeltaC[LoveMax+1][LoveMax+1];  // Temporary during full field call
-   Real   DeltaS[LoveMax+1][LoveMax+1];  // Temporary during full field call
+   // Variable Coefficients (Temporary), packed by degree like C and S
+   Real   TideC[LoveCount];  // Temporary during full field call
+   Real   TideS[LoveCount];  // Temporary during full field call
 
    // Methods useful in Tide computations
    void ClearDeltaCS ();
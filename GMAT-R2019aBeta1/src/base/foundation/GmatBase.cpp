@@ -1449,11 +1449,12 @@ std::string GmatBase::GetParameterUnit(const Integer id) const
 //---------------------------------------------------------------------------
 Integer GmatBase::GetParameterID(const std::string &str) const
 {
-   for (Integer i = 0; i < GmatBaseParamCount; ++i)
-      if (str == PARAMETER_LABEL[i])
-      {
-         return i;
-      }
+   static const ParameterIndex labelIndex =
+      MakeParameterIndex(PARAMETER_LABEL, GmatBaseParamCount, 0);
+   
+   Integer id = FindParameterIndex(labelIndex, str);
+   if (id != -1)
+      return id;
    
    throw GmatBaseException
       ("GmatBase::GetParameterID() The object named \"" + GetName() +
@@ -4994,6 +4995,80 @@ void GmatBase::WriteParameterValue(Integer id, std::stringstream &stream)
    #endif
 }
 
+
+//------------------------------------------------------------------------------
+// static ParameterIndex MakeParameterIndex(const std::string labels[],
+//                                          Integer count, Integer firstId)
+//------------------------------------------------------------------------------
+/**
+ * Builds the label lookup table for a block of parameter labels.
+ *
+ * Classes build their table once, in a function-local static inside
+ * GetParameterID(), so labels are found by a tree search instead of a
+ * comparison against every label in the class.
+ *
+ * @param labels  The parameter labels
+ * @param count   The number of labels
+ * @param firstId The ID of the first label
+ *
+ * @return The lookup table
+ */
+//------------------------------------------------------------------------------
+GmatBase::ParameterIndex GmatBase::MakeParameterIndex(
+      const std::string labels[], Integer count, Integer firstId)
+{
+   ParameterIndex index;
+   AddToParameterIndex(index, labels, count, firstId);
+   return index;
+}
+
+
+//------------------------------------------------------------------------------
+// static void AddToParameterIndex(ParameterIndex &index,
+//       const std::string labels[], Integer count, Integer firstId)
+//------------------------------------------------------------------------------
+/**
+ * Adds a block of parameter labels to a lookup table.
+ *
+ * Labels already in the table keep their ID, so blocks should be added in the
+ * order the linear search they replace would have checked them.
+ *
+ * @param index   The table receiving the labels
+ * @param labels  The parameter labels
+ * @param count   The number of labels
+ * @param firstId The ID of the first label
+ */
+//------------------------------------------------------------------------------
+void GmatBase::AddToParameterIndex(ParameterIndex &index,
+      const std::string labels[], Integer count, Integer firstId)
+{
+   for (Integer i = 0; i < count; ++i)
+      index.insert(std::make_pair(labels[i], firstId + i));
+}
+
+
+//------------------------------------------------------------------------------
+// static Integer FindParameterIndex(const ParameterIndex &index,
+//                                   const std::string &label)
+//------------------------------------------------------------------------------
+/**
+ * Looks up a parameter label.
+ *
+ * @param index The lookup table
+ * @param label The label to find
+ *
+ * @return The parameter ID, or -1 if the label is not in the table
+ */
+//------------------------------------------------------------------------------
+Integer GmatBase::FindParameterIndex(const ParameterIndex &index,
+                                     const std::string &label)
+{
+   ParameterIndex::const_iterator found = index.find(label);
+   if (found == index.end())
+      return -1;
+   return found->second;
+}
+
 //-------------------------------------
 // private methods
 //-------------------------------------
@@ -565,6 +565,9 @@ protected:
    /// GmatBase parameter labels
    static const std::string PARAMETER_LABEL[GmatBaseParamCount];
 
+   /// Sorted lookup table from parameter label to parameter ID
+   typedef std::map<std::string, Integer> ParameterIndex;
+
    /// count of the number of GmatBase objects currently instantiated
    static Integer      instanceCount;
 
@@ -677,6 +680,17 @@ protected:
    virtual void                WriteParameterValue(Integer id,
                                            std::stringstream &stream);
 
+   // Parameter label lookup
+   static ParameterIndex       MakeParameterIndex(const std::string labels[],
+                                                  Integer count,
+                                                  Integer firstId);
+   static void                 AddToParameterIndex(ParameterIndex &index,
+                                                   const std::string labels[],
+                                                   Integer count,
+                                                   Integer firstId);
+   static Integer              FindParameterIndex(const ParameterIndex &index,
+                                                  const std::string &label);
+
 private:
 
    virtual void PrepCommentTables();
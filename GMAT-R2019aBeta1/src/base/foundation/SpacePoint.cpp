@@ -1213,11 +1213,13 @@ std::string SpacePoint::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer SpacePoint::GetParameterID(const std::string &str) const
 {
-   for (Integer i = GmatBaseParamCount; i < SpacePointParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex labelIndex =
+      MakeParameterIndex(PARAMETER_TEXT, SpacePointParamCount - GmatBaseParamCount,
+                         GmatBaseParamCount);
+   
+   Integer id = FindParameterIndex(labelIndex, str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -108,7 +108,11 @@ ChemicalThruster::PARAMETER_TYPE[ChemicalThrusterParamCount - ThrusterParamCount
  */
 //------------------------------------------------------------------------------
 ChemicalThruster::ChemicalThruster(const std::string &nomme) :
-   Thruster             ("ChemicalThruster", nomme)
+   Thruster             ("ChemicalThruster", nomme),
+   kernelsCurrent       (false),
+   tankPressureID       (-1),
+   tankTemperatureID    (-1),
+   tankRefTemperatureID (-1)
 {
    objectTypes.push_back(Gmat::CHEMICAL_THRUSTER);
    objectTypeNames.push_back("ChemicalThruster");
@@ -189,7 +193,11 @@ ChemicalThruster::~ChemicalThruster()
  */
 //------------------------------------------------------------------------------
 ChemicalThruster::ChemicalThruster(const ChemicalThruster& th) :
-   Thruster             (th)
+   Thruster             (th),
+   kernelsCurrent       (false),
+   tankPressureID       (th.tankPressureID),
+   tankTemperatureID    (th.tankTemperatureID),
+   tankRefTemperatureID (th.tankRefTemperatureID)
 {
    #ifdef DEBUG_CHEMICAL_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage
@@ -236,7 +244,10 @@ ChemicalThruster& ChemicalThruster::operator=(const ChemicalThruster& th)
 
    memcpy(cCoefficients, th.cCoefficients, COEFFICIENT_COUNT * sizeof(Real));
    memcpy(kCoefficients, th.kCoefficients, COEFFICIENT_COUNT * sizeof(Real));
-
+   kernelsCurrent       = false;
+   tankPressureID       = th.tankPressureID;
+   tankTemperatureID    = th.tankTemperatureID;
+   tankRefTemperatureID = th.tankRefTemperatureID;
 
    #ifdef DEBUG_CHEMICAL_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage("ChemicalThruster::operator= exiting\n");
@@ -510,6 +521,10 @@ Real ChemicalThruster::SetRealParameter(const Integer id, const Real value)
        GetName().c_str(), id, value);
    #endif
 
+   // Any coefficient change invalidates the evaluation plans
+   if ((id >= C1) && (id <= K16))
+      kernelsCurrent = false;
+
    switch (id)
    {
       // Thrust coefficients
@@ -803,14 +818,14 @@ bool ChemicalThruster::CalculateThrustAndIsp()
          throw HardwareException("ChemicalThruster \"" + instanceName +
                                  "\" does not have a fuel tank");
 
-      // Require that the tanks all be at the same pressure and temperature
-      Integer pressID = tanks[0]->GetParameterID("Pressure");
-      Integer tempID = tanks[0]->GetParameterID("Temperature");
-      Integer refTempID = tanks[0]->GetParameterID("RefTemperature");
-
-//      pressure = tanks[0]->GetRealParameter(pressID);
-//      temperatureRatio = tanks[0]->GetRealParameter(tempID) /
-//                         tanks[0]->GetRealParameter(refTempID);
+      // Require that the tanks all be at the same pressure and temperature.
+      // The IDs are the same for every ChemicalTank, so look them up once.
+      if (tankPressureID < 0)
+      {
+         tankPressureID = tanks[0]->GetParameterID("Pressure");
+         tankTemperatureID = tanks[0]->GetParameterID("Temperature");
+         tankRefTemperatureID = tanks[0]->GetParameterID("RefTemperature");
+      }
 
       // Build the weighted temperature and pressure
       Real mixTotal = 0.0;
@@ -820,51 +835,25 @@ bool ChemicalThruster::CalculateThrustAndIsp()
       for (UnsignedInt i = 0; i < mixRatio.GetSize(); ++i)
       {
          mixTotal += mixRatio[i];
-         pressureSum += tanks[i]->GetRealParameter(pressID) * mixRatio[i];
-         tempSum += tanks[i]->GetRealParameter(tempID) * mixRatio[i];
-         refTempSum += tanks[i]->GetRealParameter(refTempID) * mixRatio[i];
+         pressureSum += tanks[i]->GetRealParameter(tankPressureID) * mixRatio[i];
+         tempSum += tanks[i]->GetRealParameter(tankTemperatureID) * mixRatio[i];
+         refTempSum += tanks[i]->GetRealParameter(tankRefTemperatureID) *
+                       mixRatio[i];
       }
       pressure = pressureSum / mixTotal;
 
       // Note: numerator and denominator both divide by mixTotal, so dividends cancel
       temperatureRatio = tempSum / refTempSum;
 
-      thrust = cCoefficients[2];
-      impulse = kCoefficients[2];
-
-      if (!constantExpressions)
+      if (!kernelsCurrent)
       {
-
-         thrust  += pressure*(cCoefficients[3] + pressure*cCoefficients[4]);
-         impulse += pressure*(kCoefficients[3] + pressure*kCoefficients[4]);
-
-         // For efficiency, if thrust and Isp are simple, don't bother evaluating
-         // higher order terms
-         if (!simpleExpressions) {
-            thrust  += cCoefficients[5] * pow(pressure, cCoefficients[6]) +
-                       cCoefficients[7] * pow(pressure, cCoefficients[8]) +
-                       cCoefficients[9] * pow(pressure, cCoefficients[10]) +
-                       cCoefficients[11] * pow(cCoefficients[12],
-                                              pressure * cCoefficients[13]);
-
-            impulse += kCoefficients[5] * pow(pressure, kCoefficients[6]) +
-                       kCoefficients[7] * pow(pressure, kCoefficients[8]) +
-                       kCoefficients[9] * pow(pressure, kCoefficients[10]) +
-                       kCoefficients[11] * pow(kCoefficients[12],
-                                              pressure * kCoefficients[13]);
-         }
+         PrepareKernel(cCoefficients, thrustKernel);
+         PrepareKernel(kCoefficients, ispKernel);
+         kernelsCurrent = true;
       }
 
-//       thrust  *= pow(temperatureRatio, (1.0 + cCoefficients[14] +
-//                      pressure*cCoefficients[15])) * thrustScaleFactor * dutyCycle;
-      thrust  *= pow(temperatureRatio, (1.0 + cCoefficients[14] +
-                     pressure*cCoefficients[15]));
-      impulse *= pow(temperatureRatio, (1.0 + kCoefficients[14] +
-                     pressure*kCoefficients[15]));
-
-      // Now add the temperature independent pieces
-      thrust  += cCoefficients[0] + cCoefficients[1] * pressure;
-      impulse += kCoefficients[0] + kCoefficients[1] * pressure;
+      thrust  = EvaluateKernel(cCoefficients, thrustKernel);
+      impulse = EvaluateKernel(kCoefficients, ispKernel);
    }
    
    // Calculate applied thrust magnitude
@@ -882,6 +871,84 @@ bool ChemicalThruster::CalculateThrustAndIsp()
 }
 
 
+//---------------------------------------------------------------------------
+//  void PrepareKernel(const Real *coeff, ExpressionKernel &kernel)
+//---------------------------------------------------------------------------
+/**
+ * Builds the evaluation plan for a thrust or Isp expression.
+ *
+ * The plan records which of the pressure power terms and the exponential term
+ * have nonzero scale coefficients, and whether the temperature exponent
+ * 1 + X15 + X16 P reduces to 1, so that EvaluateKernel only makes the pow()
+ * calls the coefficients actually need.
+ *
+ * @param coeff  The 16 coefficients of the expression
+ * @param kernel The plan that is built
+ */
+//---------------------------------------------------------------------------
+void ChemicalThruster::PrepareKernel(const Real *coeff,
+                                     ExpressionKernel &kernel)
+{
+   kernel.powerTermCount = 0;
+   for (Integer i = 5; i <= 9; i += 2)
+      if (coeff[i] != 0.0)
+         kernel.powerTerms[kernel.powerTermCount++] = i;
+
+   kernel.exponentialTerm = (coeff[11] != 0.0);
+   kernel.linearInTemperature = ((coeff[14] == 0.0) && (coeff[15] == 0.0));
+
+   #ifdef DEBUG_THRUST_ISP
+   MessageInterface::ShowMessage
+      ("ChemicalThruster::PrepareKernel() '%s': %d power terms, exponential "
+       "term %d, linear in temperature %d\n", instanceName.c_str(),
+       kernel.powerTermCount, kernel.exponentialTerm,
+       kernel.linearInTemperature);
+   #endif
+}
+
+
+//---------------------------------------------------------------------------
+//  Real EvaluateKernel(const Real *coeff, const ExpressionKernel &kernel) const
+//---------------------------------------------------------------------------
+/**
+ * Evaluates a thrust or Isp expression at the current pressure and
+ * temperature ratio, with the polynomial part in Horner form.
+ *
+ * @param coeff  The 16 coefficients of the expression
+ * @param kernel The plan built for those coefficients
+ *
+ * @return The thrust (N) or Isp (s)
+ */
+//---------------------------------------------------------------------------
+Real ChemicalThruster::EvaluateKernel(const Real *coeff,
+                                      const ExpressionKernel &kernel) const
+{
+   Real value = coeff[2];
+
+   if (!constantExpressions)
+   {
+      value += pressure * (coeff[3] + pressure * coeff[4]);
+
+      for (Integer i = 0; i < kernel.powerTermCount; ++i)
+      {
+         Integer term = kernel.powerTerms[i];
+         value += coeff[term] * pow(pressure, coeff[term+1]);
+      }
+
+      if (kernel.exponentialTerm)
+         value += coeff[11] * pow(coeff[12], pressure * coeff[13]);
+   }
+
+   if (kernel.linearInTemperature)
+      value *= temperatureRatio;
+   else
+      value *= pow(temperatureRatio, 1.0 + coeff[14] + pressure * coeff[15]);
+
+   // Now add the temperature independent pieces
+   return value + coeff[0] + coeff[1] * pressure;
+}
+
+
 //---------------------------------------------------------------------------
 //  Real CalculateMassFlow()
 //---------------------------------------------------------------------------
@@ -79,6 +79,33 @@ protected:
    /// Array of specific impulse coefficients
    Real                       kCoefficients[COEFFICIENT_COUNT];
 
+   /**
+    * Evaluation plan for one of the thrust or Isp expressions, built from the
+    * coefficients so that terms with zero scale are never evaluated
+    */
+   struct ExpressionKernel
+   {
+      /// Indices of the scale coefficients of the nonzero pressure power terms
+      Integer                 powerTerms[3];
+      /// Number of nonzero pressure power terms
+      Integer                 powerTermCount;
+      /// Flag indicating that the exponential pressure term is nonzero
+      bool                    exponentialTerm;
+      /// Flag indicating that the temperature exponent is identically 1
+      bool                    linearInTemperature;
+   };
+
+   /// Evaluation plan for the thrust expression
+   ExpressionKernel           thrustKernel;
+   /// Evaluation plan for the Isp expression
+   ExpressionKernel           ispKernel;
+   /// Flag indicating that the kernels match the current coefficients
+   bool                       kernelsCurrent;
+   /// Tank parameter IDs for pressure, temperature and reference temperature
+   Integer                    tankPressureID;
+   Integer                    tankTemperatureID;
+   Integer                    tankRefTemperatureID;
+
    /// C-coefficient units
    static  StringArray        cCoefUnits;
    /// K-coefficient units
@@ -105,6 +132,10 @@ protected:
                         PARAMETER_TYPE[ChemicalThrusterParamCount - ThrusterParamCount];
 
    bool                 CalculateThrustAndIsp();
+   void                 PrepareKernel(const Real *coeff,
+                                      ExpressionKernel &kernel);
+   Real                 EvaluateKernel(const Real *coeff,
+                                       const ExpressionKernel &kernel) const;
 };
 
 #endif // ChemicalThruster_hpp
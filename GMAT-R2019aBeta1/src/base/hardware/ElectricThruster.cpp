@@ -126,15 +126,13 @@ ElectricThruster::PARAMETER_TYPE[ElectricThrusterParamCount - ThrusterParamCount
 ElectricThruster::ElectricThruster(const std::string &nomme) :
    Thruster("ElectricThruster",nomme),
    thrustModel     ("ThrustMassPolynomial"),
+   thrustModelType (THRUST_MASS_POLYNOMIAL_MODEL),
    maxUsablePower  (7.266),
    minUsablePower  (0.638),
    efficiency      (0.7),
    isp             (4200),
    constantThrust  (0.237),
-   powerToUse      (0.0),
-   powerToUse2     (0.0),
-   powerToUse3     (0.0),
-   powerToUse4     (0.0)
+   powerToUse      (0.0)
 {
    objectTypes.push_back(Gmat::ELECTRIC_THRUSTER);
    objectTypeNames.push_back("ElectricThruster");
@@ -206,15 +204,13 @@ ElectricThruster::~ElectricThruster()
 ElectricThruster::ElectricThruster(const ElectricThruster& th) :
    Thruster             (th),
    thrustModel          (th.thrustModel),
+   thrustModelType      (th.thrustModelType),
    maxUsablePower       (th.maxUsablePower),
    minUsablePower       (th.minUsablePower),
    efficiency           (th.efficiency),
    isp                  (th.isp),
    constantThrust       (th.constantThrust),
-   powerToUse           (th.powerToUse),
-   powerToUse2          (th.powerToUse2),
-   powerToUse3          (th.powerToUse3),
-   powerToUse4          (th.powerToUse4)
+   powerToUse           (th.powerToUse)
 {
    #ifdef DEBUG_ELECTRIC_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage
@@ -266,15 +262,13 @@ ElectricThruster& ElectricThruster::operator=(const ElectricThruster& th)
    Thruster::operator=(th);
 
    thrustModel         = th.thrustModel;
+   thrustModelType     = th.thrustModelType;
    maxUsablePower      = th.maxUsablePower;
    minUsablePower      = th.minUsablePower;
    efficiency          = th.efficiency;
    isp                 = th.isp;
    constantThrust      = th.constantThrust;
    powerToUse          = th.powerToUse;
-   powerToUse2         = th.powerToUse2;
-   powerToUse3         = th.powerToUse3;
-   powerToUse4         = th.powerToUse4;
 
    thrustModelLabels   = th.thrustModelLabels;
    thrustCoeffUnits    = th.thrustCoeffUnits;
@@ -639,6 +633,12 @@ bool ElectricThruster::SetStringParameter(const Integer id, const std::string &v
          throw HardwareException(msg);
       }
       thrustModel = value;
+      if (thrustModel == "ConstantThrustAndIsp")
+         thrustModelType = CONSTANT_THRUST_AND_ISP_MODEL;
+      else if (thrustModel == "FixedEfficiency")
+         thrustModelType = FIXED_EFFICIENCY_MODEL;
+      else
+         thrustModelType = THRUST_MASS_POLYNOMIAL_MODEL;
       return true;
    default:
       return Thruster::SetStringParameter(id, value);
@@ -797,9 +797,6 @@ bool ElectricThruster::CalculateThrustAndIsp()
             "Entering ElectricThruster::CalculateThrustAndIsp, power = %12.10f, minUsablePower = %12.10f\n",
             power, minUsablePower);
       MessageInterface::ShowMessage("    powerToUse  = %12.10f\n", powerToUse);
-      MessageInterface::ShowMessage("    powerToUse2 = %12.10f\n", powerToUse2);
-      MessageInterface::ShowMessage("    powerToUse3 = %12.10f\n", powerToUse3);
-      MessageInterface::ShowMessage("    powerToUse4 = %12.10f\n", powerToUse4);
    #endif
    if (!thrusterFiring)
    {
@@ -818,15 +815,16 @@ bool ElectricThruster::CalculateThrustAndIsp()
                                  "\" does not have a fuel tank");
 
       impulse = isp;   // CORRECT?
-      if (thrustModel == "ThrustMassPolynomial")
+      if (thrustModelType == THRUST_MASS_POLYNOMIAL_MODEL)
       {
-         thrust = ((thrustCoeff[4] * powerToUse4) +
-                   (thrustCoeff[3] * powerToUse3) +
-                   (thrustCoeff[2] * powerToUse2) +
-                   (thrustCoeff[1] * powerToUse)  +
-                   thrustCoeff[0]) / 1.0e3; // 1.0e6;
+         // Horner form of the quartic in power
+         thrust = ((((thrustCoeff[4]  * powerToUse +
+                      thrustCoeff[3]) * powerToUse +
+                      thrustCoeff[2]) * powerToUse +
+                      thrustCoeff[1]) * powerToUse +
+                      thrustCoeff[0]) / 1.0e3; // 1.0e6;
       }
-      else if (thrustModel == "ConstantThrustAndIsp")
+      else if (thrustModelType == CONSTANT_THRUST_AND_ISP_MODEL)
       {
          thrust = constantThrust; //  / 1.0e-3;
       }
@@ -893,10 +891,6 @@ Real ElectricThruster::CalculateMassFlow()
       if (powerToUse > maxUsablePower)
          powerToUse = maxUsablePower;
 
-      powerToUse2 = powerToUse  * powerToUse;
-      powerToUse3 = powerToUse2 * powerToUse;
-      powerToUse4 = powerToUse3 * powerToUse;
-
       #ifdef DEBUG_MASS_FLOW_THRUST_VECTOR
          MessageInterface::ShowMessage("power = %12.10f, powerToUse = %12.10f\n",
                power, powerToUse);
@@ -907,15 +901,15 @@ Real ElectricThruster::CalculateMassFlow()
          throw HardwareException("ElectricThruster \"" + instanceName +
                                  "\" could not calculate dm/dt");
 
-      if (thrustModel == "ThrustMassPolynomial")
+      if (thrustModelType == THRUST_MASS_POLYNOMIAL_MODEL)
       {
-         mDot = ((massFlowCoeff[4] * powerToUse4) +
-                 (massFlowCoeff[3] * powerToUse3) +
-                 (massFlowCoeff[2] * powerToUse2) +
-                 (massFlowCoeff[1] * powerToUse) +
-                  massFlowCoeff[0]) / 1.0e6;
+         mDot = ((((massFlowCoeff[4]  * powerToUse +
+                    massFlowCoeff[3]) * powerToUse +
+                    massFlowCoeff[2]) * powerToUse +
+                    massFlowCoeff[1]) * powerToUse +
+                    massFlowCoeff[0]) / 1.0e6;
       }
-      else if (thrustModel == "ConstantThrustAndIsp")
+      else if (thrustModelType == CONSTANT_THRUST_AND_ISP_MODEL)
       {
          mDot = constantThrust  / (isp * gravityAccel); // do I need to divide by 1.0e-3 here?  or put the 0.001 * in there?
       }
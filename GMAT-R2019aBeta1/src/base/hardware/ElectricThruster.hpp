@@ -116,7 +116,16 @@ protected:
       ElectricThrusterParamCount
    };
 
+   /// Thrust models, so the evaluation does not compare strings
+   enum ThrustModelType
+   {
+      THRUST_MASS_POLYNOMIAL_MODEL,
+      CONSTANT_THRUST_AND_ISP_MODEL,
+      FIXED_EFFICIENCY_MODEL
+   };
+
    std::string   thrustModel;
+   Integer       thrustModelType;
    Real          maxUsablePower;  // kW
    Real          minUsablePower;  // kW
    Real          thrustCoeff[5];
@@ -125,9 +134,6 @@ protected:
    Real          isp;
    Real          constantThrust;
    Real          powerToUse;
-   Real          powerToUse2;
-   Real          powerToUse3;
-   Real          powerToUse4;
 
    /// Thruster parameter labels
    static const std::string
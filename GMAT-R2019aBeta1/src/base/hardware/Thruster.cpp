@@ -142,6 +142,9 @@ Thruster::Thruster(const std::string &typeStr, const std::string &nomme) :
    appliedThrustMag     (0.0),
    impulse              (2150.0),
    mDot                 (0.0),
+   cachedDirectionEpoch (-1.0),
+   cachedDirectionCS    (NULL),
+   hasCachedDirection   (false),
    decrementMass        (false),
    thrusterFiring       (false),
    constantExpressions  (true),
@@ -265,6 +268,7 @@ Thruster::Thruster(const Thruster& th) :
    inertialDirection[0] = th.inertialDirection[0];
    inertialDirection[1] = th.inertialDirection[1];
    inertialDirection[2] = th.inertialDirection[2];
+   hasCachedDirection   = false;
    
    #ifdef DEBUG_THRUSTER_CONSTRUCTOR
    MessageInterface::ShowMessage
@@ -349,6 +353,7 @@ Thruster& Thruster::operator=(const Thruster& th)
    inertialDirection[0]  = th.inertialDirection[0];
    inertialDirection[1]  = th.inertialDirection[1];
    inertialDirection[2]  = th.inertialDirection[2];
+   hasCachedDirection    = false;
    
    thrusterFiring      = th.thrusterFiring;
    decrementMass       = th.decrementMass;
@@ -1638,6 +1643,8 @@ bool Thruster::Initialize()
    if (!retval)
       return false;
    
+   hasCachedDirection = false;
+
    if (mixRatio.GetSize() == 0)
    {
       mixRatio.SetSize(tankNames.size());
@@ -1990,16 +1997,14 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
       }
       else if (isSpacecraftBodyAxes)
       {
-         Rvector3 inDir(dir[0], dir[1], dir[2]);
-         Rvector3 outDir;
-         // Get attitude matrix from Spacecraft and transpose since
+         // Get attitude matrix from Spacecraft and apply its transpose since
          // attitude matrix from spacecraft gives rotation matrix from
          // inertial to body
          Rmatrix33 inertialToBody = spacecraft->GetAttitude(epoch);
-         Rmatrix33 rotMat = inertialToBody.Transpose();
-         outDir = inDir * rotMat;
          for (Integer i=0; i<3; i++)
-            dirInertial[i] = outDir[i];
+            dirInertial[i] = inertialToBody(0,i) * dir[0] +
+                             inertialToBody(1,i) * dir[1] +
+                             inertialToBody(2,i) * dir[2];
       }
       else
       {         
@@ -2035,9 +2040,41 @@ void Thruster::ConvertDirectionToInertial(Real *dir, Real *dirInertial, Real epo
 //---------------------------------------------------------------------------
 // void ComputeInertialDirection(Real epoch)
 //---------------------------------------------------------------------------
+/**
+ * Sets inertialDirection for the input epoch.
+ *
+ * When the thruster frame is a coordinate system whose axes do not depend on a
+ * spacecraft, the rotation is a function of epoch alone, so the result is
+ * cached and reused for repeated requests at the same epoch (FSAL stages,
+ * burn parameter evaluation, the spacecraft derivative call).  Local and
+ * spacecraft referenced axes move with the state and are always recomputed.
+ *
+ * @param epoch The epoch of the direction
+ */
+//---------------------------------------------------------------------------
 void Thruster::ComputeInertialDirection(Real epoch)
 {
+   bool cacheable = !usingLocalCoordSys && (coordSystem != NULL) &&
+                    !coordSystem->UsesSpacecraft();
+
+   if (cacheable && hasCachedDirection && (epoch == cachedDirectionEpoch) &&
+       (coordSystem == cachedDirectionCS) &&
+       (direction[0] == cachedDirection[0]) &&
+       (direction[1] == cachedDirection[1]) &&
+       (direction[2] == cachedDirection[2]))
+      return;
+
    ConvertDirectionToInertial(direction, inertialDirection, epoch);
+
+   hasCachedDirection = cacheable;
+   if (cacheable)
+   {
+      cachedDirectionEpoch = epoch;
+      cachedDirectionCS    = coordSystem;
+      cachedDirection[0]   = direction[0];
+      cachedDirection[1]   = direction[1];
+      cachedDirection[2]   = direction[2];
+   }
 }
 
 
@@ -187,6 +187,14 @@ protected:
    Real                       mDot;
    /// Thrust direction projected into the inertial coordinate system
    Real                       inertialDirection[3];
+   /// Epoch of the cached inertial direction
+   Real                       cachedDirectionEpoch;
+   /// Thruster frame direction used for the cached inertial direction
+   Real                       cachedDirection[3];
+   /// Coordinate system used for the cached inertial direction
+   CoordinateSystem           *cachedDirectionCS;
+   /// Flag indicating that the cached inertial direction is valid
+   bool                       hasCachedDirection;
    /// Decrement mass flag
    bool                       decrementMass;
    /// Flag used to turn thruster on or off
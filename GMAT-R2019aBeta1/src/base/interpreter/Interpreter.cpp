@@ -264,6 +264,8 @@ void Interpreter::BuildCreatableObjectMaps(bool finalBuild)
    commandList.clear();
    StringArray cmds = theModerator->GetListOfFactoryItems(Gmat::COMMAND);
    copy(cmds.begin(), cmds.end(), back_inserter(commandList));
+   commandSet.clear();
+   commandSet.insert(cmds.begin(), cmds.end());
    
    #ifdef DEBUG_INIT
    if (finalBuild)
@@ -789,8 +791,8 @@ GmatBase* Interpreter::CreateObject(const std::string &type,
    
    
    
-   if (find(allObjectTypeList.begin(), allObjectTypeList.end(), type) != 
-       allObjectTypeList.end())
+   // objectTypeMap holds the same names as allObjectTypeList
+   if (objectTypeMap.find(type) != objectTypeMap.end())
    {
       UnsignedInt objType = GetObjectType(type);
       
@@ -9693,8 +9695,7 @@ bool Interpreter::IsObjectType(const std::string &type)
    if (theSolarSystem->IsBodyInUse(type))
       return true;
 
-   if (find(allObjectTypeList.begin(), allObjectTypeList.end(), type) !=
-       allObjectTypeList.end())
+   if (objectTypeMap.find(type) != objectTypeMap.end())
       return true;
    
    return false;
@@ -9721,10 +9722,7 @@ bool Interpreter::IsCommandType(const char *type)
 //------------------------------------------------------------------------------
 bool Interpreter::IsCommandType(const std::string &type)
 {
-   if (find(commandList.begin(), commandList.end(), type) == commandList.end())
-      return false;
-   
-   return true;
+   return (commandSet.find(type) != commandSet.end());
 }
 
 
@@ -9738,8 +9736,9 @@ bool Interpreter::IsCommandType(const std::string &type)
 //------------------------------------------------------------------------------
 UnsignedInt Interpreter::GetObjectType(const std::string &type)
 {
-   if (objectTypeMap.find(type) != objectTypeMap.end())
-      return objectTypeMap[type];
+   ObjectTypeMap::iterator pos = objectTypeMap.find(type);
+   if (pos != objectTypeMap.end())
+      return pos->second;
    else
       return Gmat::UNKNOWN_OBJECT;
 }
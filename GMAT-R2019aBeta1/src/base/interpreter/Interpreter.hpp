@@ -40,6 +40,7 @@
 #include "TextParser.hpp"
 #include "ScriptReadWriter.hpp"
 #include "ElementWrapper.hpp"
+#include <unordered_set>
 
 // Forward references for GMAT core objects
 class Spacecraft;
@@ -391,6 +392,8 @@ protected:
 private:
 
    StringArray   commandList;
+   /// Hashed copy of commandList used for name lookups
+   std::unordered_set<std::string> commandSet;
    StringArray   celestialBodyList;
    StringArray   functionList;   
    StringArray   matlabFunctionNames;
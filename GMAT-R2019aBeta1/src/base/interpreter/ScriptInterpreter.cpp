@@ -41,6 +41,8 @@
 #include "UserDefinedFunction.hpp" // for AddFunctionObject()
 #include <sstream>             // For stringstream, used to check for non-ASCII chars
 #include <algorithm>           // for find()
+#include <atomic>              // for the block evaluation queue
+#include <thread>              // for parallel block evaluation
 
 // to allow object creation in command mode, such as inside ScriptEvent
 //#define __ALLOW_OBJECT_CREATION_IN_COMMAND_MODE__
@@ -62,6 +64,7 @@
 //#define DEBUG_COMMAND_MODE_TOGGLE
 //#define DEBUG_ENCODING_CHAR
 //#define DEBUG_INCLUDE
+//#define DEBUG_BLOCK_EVALUATION
 
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
@@ -73,6 +76,26 @@
 
 ScriptInterpreter *ScriptInterpreter::instance = NULL;
 
+// Smaller scripts are evaluated on the calling thread; starting threads costs
+// more than evaluating a few hundred blocks
+const UnsignedInt ScriptInterpreter::PARALLEL_BLOCK_COUNT = 256;
+
+
+//------------------------------------------------------------------------------
+// struct BlockQueue
+//------------------------------------------------------------------------------
+/**
+ * Work queue for the block evaluation threads.  Threads take the next block
+ * index from the counter until the blocks run out; each thread writes only
+ * the blocks it takes, so no other locking is needed.
+ */
+//------------------------------------------------------------------------------
+struct ScriptInterpreter::BlockQueue
+{
+   std::vector<ParsedBlock>  *blocks;
+   std::atomic<UnsignedInt>  next;
+};
+
 
 //------------------------------------------------------------------------------
 // ScriptInterpreter* Instance()
@@ -99,7 +122,10 @@ ScriptInterpreter* ScriptInterpreter::Instance()
  */
 //------------------------------------------------------------------------------
 ScriptInterpreter::ScriptInterpreter() :
-   Interpreter()
+   Interpreter(),
+   currentBlockChunked  (false),
+   evaluateBlocksAhead  (true),
+   blockThreads         (0)
 {
    #ifdef DEBUG_INSTANCE
    MessageInterface::ShowMessage("ScriptInterpreter::ScriptInterpreter() <%p> entered\n", this);
@@ -914,6 +940,8 @@ void ScriptInterpreter::InitializeScriptData()
    mainScriptFilename  = "";
    savedIncludeComment = "";
    currentBlock        = "";
+   currentBlockChunked = false;
+   currentBlockChunks.clear();
    headerComment       = "";
    footerComment       = "";
    
@@ -1204,19 +1232,43 @@ bool ScriptInterpreter::ReadScript(GmatCommand *inCmd, bool skipHeader,bool rein
       ("===> headerComment:\n<<<%s>>>\n", headerComment.c_str());
    #endif
    
+   // Read the rest of the logical blocks and find their types and chunks
+   // before building anything.  Objects and commands are then built from the
+   // blocks in script order, on this thread.
+   std::vector<ParsedBlock> blocks;
+   std::string readError;
+   ReadLogicalBlocks(currentBlock, blocks, readError);
+   if (evaluateBlocksAhead)
+      EvaluateBlocks(blocks);
+   
    // Saved include comment to add to next object comment to preserve
    // #include position when saving to script
    std::string savedIncComment;
    
-   while (currentBlock != "")
+   for (UnsignedInt blockIndex = 0; blockIndex < blocks.size(); ++blockIndex)
    {
+      ParsedBlock &block = blocks[blockIndex];
+      currentBlock = block.text;
+      theReadWriter->SetLinePosition(block.lineNumber, block.line);
+      currentBlockChunked = block.chunked;
+      currentBlockChunks.swap(block.lineChunks);
+      
       try
       {
-         #if DBGLVL_SCRIPT_READING
-         MessageInterface::ShowMessage("==========> Calling EvaluateBlock()\n");
-         #endif
-         
-         currentBlockType = theTextParser.EvaluateBlock(currentBlock);
+         if (block.evaluated)
+         {
+            theTextParser.RestoreEvaluation(block.blockType, block.chunks,
+                                            block.isFunctionCall);
+            currentBlockType = block.blockType;
+         }
+         else
+         {
+            #if DBGLVL_SCRIPT_READING
+            MessageInterface::ShowMessage("==========> Calling EvaluateBlock()\n");
+            #endif
+            
+            currentBlockType = theTextParser.EvaluateBlock(currentBlock);
+         }
          
          #if DBGLVL_SCRIPT_READING > 1
          MessageInterface::ShowMessage
@@ -1248,7 +1300,7 @@ bool ScriptInterpreter::ReadScript(GmatCommand *inCmd, bool skipHeader,bool rein
                GmatGlobal::Instance()->SetIncludeFoundInScriptResource(true);
             }
             
-            StringArray chunks = theTextParser.ChunkLine();
+            StringArray chunks = ChunkCurrentBlock();
             #ifdef DBGLVL_SCRIPT_READING
             MessageInterface::ShowMessage("   Calling ParseIncludeBlock() for syntax check\n");
             #endif
@@ -1314,6 +1366,7 @@ bool ScriptInterpreter::ReadScript(GmatCommand *inCmd, bool skipHeader,bool rein
          MessageInterface::ShowMessage
             ("**** ERROR **** Unknown error occurred during parsing the line:\n%s\n",
              currentBlock.c_str());
+         currentBlockChunked = false;
          throw;
       }
       
@@ -1330,24 +1383,21 @@ bool ScriptInterpreter::ReadScript(GmatCommand *inCmd, bool skipHeader,bool rein
              "continueOnError=%d\n", retval1, continueOnError);
          #endif
          
+         currentBlockChunked = false;
          return false;
       }
       
       if (ignoreRest)
          break;
-      
-      #if DBGLVL_SCRIPT_READING
-      MessageInterface::ShowMessage("===> Read next logical block\n");
-      #endif
-      
-      currentBlock = theReadWriter->ReadLogicalBlock();
-      
-      #if DBGLVL_SCRIPT_READING
-      MessageInterface::ShowMessage
-         ("===> currentBlock:\n<<<%s>>>\n", currentBlock.c_str());
-      #endif
    }
    
+   currentBlockChunked = false;
+   currentBlockChunks.clear();
+   
+   // Report a read failure once the blocks read before it have been built
+   if ((readError != "") && !ignoreRest)
+      throw InterpreterException(readError);
+   
    // Parse delayed blocks here
    Integer delayedCount = delayedBlocks.size();
    bool retval2 = true;
@@ -1414,6 +1464,184 @@ bool ScriptInterpreter::ReadScript(GmatCommand *inCmd, bool skipHeader,bool rein
 }
 
 
+//------------------------------------------------------------------------------
+// void ReadLogicalBlocks(const std::string &firstBlock,
+//                        std::vector<ParsedBlock> &blocks,
+//                        std::string &readError)
+//------------------------------------------------------------------------------
+/**
+ * Reads the logical blocks remaining in the input stream.
+ *
+ * The line number and line the reader reports after each block are saved
+ * with the block, so error messages issued while the block is built match
+ * the ones issued when blocks were read one at a time.
+ *
+ * @param firstBlock The first logical block, already read from the stream
+ * @param blocks     The blocks read, starting with firstBlock (output)
+ * @param readError  Message for an error that stopped the reading, or an
+ *                   empty string (output)
+ */
+//------------------------------------------------------------------------------
+void ScriptInterpreter::ReadLogicalBlocks(const std::string &firstBlock,
+                                          std::vector<ParsedBlock> &blocks,
+                                          std::string &readError)
+{
+   readError = "";
+   std::string block = firstBlock;
+   
+   while (block != "")
+   {
+      ParsedBlock parsed;
+      parsed.text           = block;
+      parsed.lineNumber     = theReadWriter->GetLineNumber();
+      parsed.line           = theReadWriter->GetCurrentLine();
+      parsed.evaluated      = false;
+      parsed.blockType      = Gmat::COMMENT_BLOCK;
+      parsed.isFunctionCall = false;
+      parsed.chunked        = false;
+      blocks.push_back(parsed);
+      
+      try
+      {
+         block = theReadWriter->ReadLogicalBlock();
+      }
+      catch (BaseException &e)
+      {
+         readError = e.GetFullMessage();
+         block = "";
+      }
+   }
+   
+   #ifdef DEBUG_BLOCK_EVALUATION
+   MessageInterface::ShowMessage
+      ("ScriptInterpreter::ReadLogicalBlocks() read %d block(s)%s\n",
+       (Integer) blocks.size(), readError == "" ? "" : " before an error");
+   #endif
+}
+
+
+//------------------------------------------------------------------------------
+// void EvaluateBlocks(std::vector<ParsedBlock> &blocks)
+//------------------------------------------------------------------------------
+/**
+ * Finds the block type, comments, instruction and chunks of each block.
+ *
+ * This work depends only on the text of the block and the command list, so
+ * large scripts split it across threads, each with its own copy of the text
+ * parser.  Blocks that cannot be evaluated here (because they raise an error,
+ * or because they hold no instruction and so take their type from the block
+ * before them) are left for ReadScript() to evaluate in script order.
+ *
+ * @param blocks The blocks read from the script (input/output)
+ */
+//------------------------------------------------------------------------------
+void ScriptInterpreter::EvaluateBlocks(std::vector<ParsedBlock> &blocks)
+{
+   if (blocks.empty())
+      return;
+   
+   Integer numThreads = 1;
+   if (blocks.size() >= PARALLEL_BLOCK_COUNT)
+   {
+      numThreads = blockThreads;
+      if (numThreads == 0)
+         numThreads = (Integer) std::thread::hardware_concurrency();
+   }
+   if (numThreads < 1)
+      numThreads = 1;
+   
+   BlockQueue queue;
+   queue.blocks = &blocks;
+   queue.next   = 0;
+   
+   #ifdef DEBUG_BLOCK_EVALUATION
+   MessageInterface::ShowMessage
+      ("ScriptInterpreter::EvaluateBlocks() evaluating %d block(s) on %d "
+       "thread(s)\n", (Integer) blocks.size(), numThreads);
+   #endif
+   
+   // The calling thread takes a share of the work
+   std::vector<std::thread> workers;
+   for (Integer ii = 1; ii < numThreads; ii++)
+      workers.push_back(std::thread(&ScriptInterpreter::EvaluateBlockWorker,
+                                    this, &queue));
+   EvaluateBlockWorker(&queue);
+   for (UnsignedInt ii = 0; ii < workers.size(); ii++)
+      workers[ii].join();
+}
+
+
+//------------------------------------------------------------------------------
+// void EvaluateBlockWorker(BlockQueue *queue)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates blocks from the queue until none are left.
+ *
+ * @param queue The shared work queue
+ */
+//------------------------------------------------------------------------------
+void ScriptInterpreter::EvaluateBlockWorker(BlockQueue *queue)
+{
+   // Each thread needs its own parser; the copy shares the command list
+   TextParser parser(theTextParser);
+   std::vector<ParsedBlock> &blocks = *(queue->blocks);
+   
+   for (UnsignedInt ii = queue->next++; ii < blocks.size();
+        ii = queue->next++)
+   {
+      ParsedBlock &block = blocks[ii];
+      try
+      {
+         Gmat::BlockType blockType = parser.EvaluateBlock(block.text);
+         
+         // Comment-only blocks keep the type of the block evaluated before
+         // them, so they are evaluated in order when the script is built
+         if (parser.GetInstruction() == "")
+            continue;
+         
+         block.blockType      = blockType;
+         block.chunks         = parser.GetChunks();
+         block.isFunctionCall = parser.IsFunctionCall();
+         block.evaluated      = true;
+      }
+      catch (BaseException &)
+      {
+         continue;
+      }
+      
+      // Errors are raised again when the block is built, where they are
+      // reported with the right context
+      try
+      {
+         block.lineChunks = parser.ChunkLine();
+         block.chunked    = true;
+      }
+      catch (BaseException &)
+      {
+         block.lineChunks.clear();
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// StringArray ChunkCurrentBlock()
+//------------------------------------------------------------------------------
+/**
+ * Returns the chunks of the current block, using the chunks found when the
+ * block was evaluated if there are any.
+ *
+ * @return The chunks of the instruction in the current block
+ */
+//------------------------------------------------------------------------------
+StringArray ScriptInterpreter::ChunkCurrentBlock()
+{
+   if (currentBlockChunked)
+      return currentBlockChunks;
+   return theTextParser.ChunkLine();
+}
+
+
 //------------------------------------------------------------------------------
 // bool Parse(GmatCommand *inCmd)
 //------------------------------------------------------------------------------
@@ -1515,7 +1743,7 @@ bool ScriptInterpreter::Parse(GmatCommand *inCmd)
    StringArray chunks;
    try
    {
-      chunks = theTextParser.ChunkLine();
+      chunks = ChunkCurrentBlock();
       #ifdef DEBUG_PARSE
       WriteStringArray("Parse()", "", chunks);
       #endif
@@ -1730,6 +1958,26 @@ bool ScriptInterpreter::IncludeFoundInResource()
    return includeFoundInResource;
 }
 
+//------------------------------------------------------------------------------
+// void SetBlockEvaluation(bool ahead, Integer threads)
+//------------------------------------------------------------------------------
+/**
+ * Sets how the logical blocks of a script are evaluated.
+ *
+ * @param ahead   true to evaluate the blocks before the build pass (the
+ *                default), false to evaluate each block in order as it is
+ *                built
+ * @param threads Number of threads that evaluate scripts of
+ *                PARALLEL_BLOCK_COUNT blocks or more; 0 uses one thread per
+ *                hardware thread
+ */
+//------------------------------------------------------------------------------
+void ScriptInterpreter::SetBlockEvaluation(bool ahead, Integer threads)
+{
+   evaluateBlocksAhead = ahead;
+   blockThreads = (threads < 0 ? 0 : threads);
+}
+
 //------------------------------------------------------------------------------
 // bool WriteScript()
 //------------------------------------------------------------------------------
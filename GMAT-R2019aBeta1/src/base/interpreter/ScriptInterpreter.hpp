@@ -66,6 +66,8 @@ public:
    std::string GetMainScriptFileName();
    bool IncludeFoundInResource();
    
+   void SetBlockEvaluation(bool ahead, Integer threads = 0);
+   
 protected:
    
    /// The script interpreter singleton
@@ -124,6 +126,48 @@ private:
    std::vector<std::string>  scriptStack;
    std::stack<std::istream*> inStreamStack;
    
+   /// A logical block read from the script, evaluated before objects are built
+   struct ParsedBlock
+   {
+      /// Text of the logical block
+      std::string          text;
+      /// Line number and line reported for the block in error messages
+      Integer              lineNumber;
+      std::string          line;
+      /// Flag indicating the block type and chunks were found ahead of time
+      bool                 evaluated;
+      /// Results of TextParser::EvaluateBlock() for the block
+      Gmat::BlockType      blockType;
+      StringArray          chunks;
+      bool                 isFunctionCall;
+      /// Flag indicating the instruction was chunked ahead of time
+      bool                 chunked;
+      /// Results of TextParser::ChunkLine() for the block
+      StringArray          lineChunks;
+   };
+   
+   /// Work queue shared by the block evaluation threads
+   struct BlockQueue;
+   
+   /// Chunks of the current block, found before the block was built
+   StringArray currentBlockChunks;
+   /// Flag indicating currentBlockChunks is set for the current block
+   bool currentBlockChunked;
+   /// Flag indicating the blocks are evaluated before the build pass
+   bool evaluateBlocksAhead;
+   /// Threads evaluating large scripts, or 0 for one per hardware thread
+   Integer blockThreads;
+   
+   /// Smallest number of blocks evaluated on more than one thread
+   static const UnsignedInt PARALLEL_BLOCK_COUNT;
+   
+   void ReadLogicalBlocks(const std::string &firstBlock,
+                          std::vector<ParsedBlock> &blocks,
+                          std::string &readError);
+   void EvaluateBlocks(std::vector<ParsedBlock> &blocks);
+   void EvaluateBlockWorker(BlockQueue *queue);
+   StringArray ChunkCurrentBlock();
+   
    bool CheckEncoding();
    bool ParseDefinitionBlock(const StringArray &chunks, GmatCommand *inCmd,
                              GmatBase *obj);
@@ -129,6 +129,27 @@ Integer ScriptReadWriter::GetLineNumber()
    return currentLineNumber;
 }
 
+//------------------------------------------------------------------------------
+// void SetLinePosition(Integer lineNumber, const std::string &line)
+//------------------------------------------------------------------------------
+/**
+ * Sets the line number and line reported for the block being interpreted.
+ *
+ * The ScriptInterpreter reads all of the logical blocks before it builds any
+ * objects, so it uses this method to restore the position recorded when each
+ * block was read before error messages refer to it.
+ *
+ * @param lineNumber The line number recorded when the block was read
+ * @param line       The last line read for the block
+ */
+//------------------------------------------------------------------------------
+void ScriptReadWriter::SetLinePosition(Integer lineNumber,
+                                       const std::string &line)
+{
+   currentLineNumber = lineNumber;
+   currentLine = line;
+}
+
 
 //------------------------------------------------------------------------------
 // void ReadFirstBlock(std::string &header, std::string &firstBlock,
@@ -52,6 +52,7 @@ public:
    
    Integer GetLineNumber();
    std::string GetCurrentLine() { return currentLine; }
+   void SetLinePosition(Integer lineNumber, const std::string &line);
    
    void ReadFirstBlock(std::string &header, std::string &firstBlock,
                        bool skipHeader = false);
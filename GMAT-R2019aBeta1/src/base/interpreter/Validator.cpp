@@ -2122,14 +2122,15 @@ GmatBase* Validator::FindObject(const std::string &name, const std::string &ofTy
    #endif
    
    // Find object from the object map
-   if (theObjectMap->find(newName) != theObjectMap->end())
+   ObjectMap::iterator mapPos = theObjectMap->find(newName);
+   if (mapPos != theObjectMap->end())
    {
       #ifdef DEBUG_FIND_OBJECT
       MessageInterface::ShowMessage
-         ("   name of map obj=<%s>\n", (*theObjectMap)[newName]->GetName().c_str());
+         ("   name of map obj=<%s>\n", mapPos->second->GetName().c_str());
       #endif
-      if ((*theObjectMap)[newName]->GetName() == newName)
-         obj = (*theObjectMap)[newName];
+      if (mapPos->second->GetName() == newName)
+         obj = mapPos->second;
    }
    
    // try SolarSystem if obj is still NULL
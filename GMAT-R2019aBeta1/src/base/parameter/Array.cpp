@@ -335,11 +335,12 @@ std::string Array::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Array::GetParameterID(const std::string &str) const
 {
-   for (int i=ParameterParamCount; i<ArrayParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - ParameterParamCount])
-         return i;
-   }
+   static const ParameterIndex labelIndex =
+      MakeParameterIndex(PARAMETER_TEXT, ArrayParamCount - ParameterParamCount, ParameterParamCount);
+   
+   Integer id = FindParameterIndex(labelIndex, str);
+   if (id != -1)
+      return id;
    
    return Parameter::GetParameterID(str);
 }
@@ -71,6 +71,7 @@
 ArrayElementWrapper::ArrayElementWrapper() :
    ElementWrapper(),
    array         (NULL),
+   valueId       (-1),
    row           (NULL),
    column        (NULL),
    arrayName     (""),
@@ -94,6 +95,7 @@ ArrayElementWrapper::ArrayElementWrapper() :
 ArrayElementWrapper::ArrayElementWrapper(const ArrayElementWrapper &aew) :
    ElementWrapper(aew),
    array         (NULL),
+   valueId       (-1),
    arrayName     (aew.arrayName),
    rowName       (aew.rowName),
    columnName    (aew.columnName)
@@ -130,6 +132,7 @@ const ArrayElementWrapper& ArrayElementWrapper::operator=(
 
    ElementWrapper::operator=(aew);
    array        = NULL;  //
+   valueId      = -1;
 
    if (aew.row != NULL)
       row = aew.row->Clone();
@@ -299,6 +302,8 @@ bool ArrayElementWrapper::SetRefObject(GmatBase *obj)
    if ( (obj->IsOfType("Array")) && (obj->GetName() == arrayName) )
    {
       array = (Array*) obj;
+      // Resolve the ID here so evaluation does not look up the label
+      valueId = array->GetParameterID("SingleValue");
       #ifdef DEBUG_AE_WRAPPER
          MessageInterface::ShowMessage("AEWrapper:: Setting array object %s\n",
             arrayName.c_str());
@@ -410,7 +415,7 @@ Real ArrayElementWrapper::EvaluateReal() const
       }
       columnInt = (Integer) colNearestInt - 1;
       
-      itsValue = array->GetRealParameter("SingleValue", rowInt, columnInt);
+      itsValue = array->GetRealParameter(valueId, rowInt, columnInt);
       #ifdef DEBUG_AE_WRAPPER
          MessageInterface::ShowMessage(
             "AEWrapper::EvalReal(%s) - itsValue evaluates to %.12f\n", 
@@ -510,7 +515,7 @@ bool ArrayElementWrapper::SetReal(const Real toValue)
    try
    {
 
-      array->SetRealParameter("SingleValue", toValue, rowInt, columnInt);
+      array->SetRealParameter(valueId, toValue, rowInt, columnInt);
    }
    catch (BaseException &be)
    {
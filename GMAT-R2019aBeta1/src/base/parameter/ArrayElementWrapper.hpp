@@ -80,6 +80,8 @@ protected:
 
    /// pointer to the Array object
    Array          *array;
+   /// ID of the array's element value, resolved when the array is set
+   Integer         valueId;
    /// pointers to the wrappers for the row and column
    ElementWrapper *row;
    ElementWrapper *column;   
@@ -58,6 +58,7 @@
 //#define DEBUG_ORBITDATA_OBJNAME
 //#define DEBUG_BROUWER_LONG
 //#define DEBUG_FULL_STM
+//#define DEBUG_STATE_CACHE
 
 using namespace GmatMathUtil;
 
@@ -67,6 +68,10 @@ using namespace GmatMathUtil;
 
 CoordinateConverter OrbitData::mCoordConverter = CoordinateConverter();
 
+std::map<OrbitData::StateCacheKey, OrbitData::StateCacheEntry>
+   OrbitData::stateCache;
+std::mutex OrbitData::stateCacheMutex;
+
 const std::string
 OrbitData::VALID_OBJECT_TYPE_LIST[OrbitDataObjectCount] =
 {
@@ -131,6 +136,7 @@ OrbitData::OrbitData(const std::string &name, const std::string &typeName,
    
    mIsParamOriginDep     = false;
    firstTimeEpochWarning = false;
+   mUseStateCache        = false;
 }
 
 
@@ -165,6 +171,7 @@ OrbitData::OrbitData(const OrbitData &data)
    mParameterCS = data.mParameterCS;
 
    firstTimeEpochWarning = data.firstTimeEpochWarning;
+   mUseStateCache = false;
 }
 
 
@@ -201,6 +208,7 @@ OrbitData& OrbitData::operator= (const OrbitData &right)
    stateTypeId = right.stateTypeId;
    
    firstTimeEpochWarning = right.firstTimeEpochWarning;
+   mUseStateCache = false;
 
    return *this;
 }
@@ -515,6 +523,8 @@ Rvector6 OrbitData::GetCartState()
       ("   state from spacepoint is %s\n", lastCartState.ToString().c_str());
    #endif
    
+   mUseStateCache = FindStateCacheEntry(lastCartState);
+   
    #ifdef DEBUG_ORBITDATA_RUN
    MessageInterface::ShowMessage
       ("   GetCartState() '%s' lastCartState=\n   %s\n",
@@ -618,6 +628,17 @@ Rvector6 OrbitData::GetCartState()
          }
       }
       
+      // Another parameter may have converted this state already
+      if (GetCachedCartState(lastCartState))
+      {
+         #ifdef DEBUG_STATE_CACHE
+         MessageInterface::ShowMessage
+            ("OrbitData::GetCartState() '%s' using the cached state\n",
+             mActualParamName.c_str());
+         #endif
+         return lastCartState;
+      }
+      
       try
       {
          #ifdef DEBUG_ORBITDATA_CONVERT
@@ -647,6 +668,8 @@ Rvector6 OrbitData::GetCartState()
          pe.SetFatal(true);
          throw pe;
       }
+      
+      SetCachedCartState(lastCartState);
    }
    
    #ifdef DEBUG_ORBITDATA_RUN
@@ -674,7 +697,7 @@ Rvector6 OrbitData::GetKepState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 kepState = StateConversionUtil::CartesianToKeplerian(mGravConst, state);
+   Rvector6 kepState = ConvertCartState(state, "Keplerian");
    
    #ifdef DEBUG_ORBITDATA_KEP_STATE
    MessageInterface::ShowMessage
@@ -696,9 +719,7 @@ Rvector6 OrbitData::GetModEquinState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 modEquinState =
-      StateConversionUtil::Convert(state, "Cartesian", "ModifiedEquinoctial",
-                                   mGravConst, mFlattening, mEqRadius);
+   Rvector6 modEquinState = ConvertCartState(state, "ModifiedEquinoctial");
    
    return modEquinState;
 }
@@ -714,9 +735,7 @@ Rvector6 OrbitData::GetAltEquinState()
       
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 altEquinState =
-      StateConversionUtil::Convert(state, "Cartesian", "AlternateEquinoctial",
-                                   mGravConst, mFlattening, mEqRadius);
+   Rvector6 altEquinState = ConvertCartState(state, "AlternateEquinoctial");
    
    return altEquinState;
 }
@@ -737,9 +756,7 @@ Rvector6 OrbitData::GetDelaState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 delaState =
-      StateConversionUtil::Convert(state, "Cartesian", "Delaunay",
-                                   mGravConst, mFlattening, mEqRadius);
+   Rvector6 delaState = ConvertCartState(state, "Delaunay");
    
    #ifdef DEBUG_DELAUNAY_STATE
    MessageInterface::ShowMessage
@@ -761,9 +778,7 @@ Rvector6 OrbitData::GetPlanetodeticState()
    
    // Call GetPlanetodeticState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 planetodeticState =
-      StateConversionUtil::Convert(state, "Cartesian", "Planetodetic",
-                                   mGravConst, mFlattening, mEqRadius );
+   Rvector6 planetodeticState = ConvertCartState(state, "Planetodetic");
    
    return planetodeticState;
 }
@@ -779,8 +794,7 @@ Rvector6 OrbitData::GetModKepState()
       
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 kepState = StateConversionUtil::CartesianToKeplerian(mGravConst, state, "TA");
-   Rvector6 modKepState = StateConversionUtil::KeplerianToModKeplerian(kepState);
+   Rvector6 modKepState = ConvertCartState(state, "ModifiedKeplerian");
    
    return modKepState;
 }
@@ -801,8 +815,7 @@ Rvector6 OrbitData::GetSphRaDecState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 sphRaDecState = StateConversionUtil::Convert(state, "Cartesian", "SphericalRADEC",
-                                                         mGravConst, mFlattening, mEqRadius);
+   Rvector6 sphRaDecState = ConvertCartState(state, "SphericalRADEC");
    
    #ifdef DEBUG_ORBITDATA_STATE
    MessageInterface::ShowMessage
@@ -824,8 +837,7 @@ Rvector6 OrbitData::GetSphAzFpaState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 sphAzFpaState = StateConversionUtil::Convert(state, "Cartesian", "SphericalAZFPA",
-                                                         mGravConst, mFlattening, mEqRadius);
+   Rvector6 sphAzFpaState = ConvertCartState(state, "SphericalAZFPA");
    
    return sphAzFpaState;
 }
@@ -841,8 +853,7 @@ Rvector6 OrbitData::GetEquinState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 mEquinState = StateConversionUtil::Convert(state, "Cartesian", "Equinoctial",
-                          mGravConst, mFlattening, mEqRadius);
+   Rvector6 mEquinState = ConvertCartState(state, "Equinoctial");
    
    return mEquinState;
 }
@@ -858,8 +869,7 @@ Rvector6 OrbitData::GetIncAsymState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 incAsymState = StateConversionUtil::Convert(state, "Cartesian", "IncomingAsymptote",
-                                                        mGravConst, mFlattening, mEqRadius);
+   Rvector6 incAsymState = ConvertCartState(state, "IncomingAsymptote");
    
    return incAsymState;
 }
@@ -875,8 +885,7 @@ Rvector6 OrbitData::GetOutAsymState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 outAsymState = StateConversionUtil::Convert(state, "Cartesian", "OutgoingAsymptote",
-                                                        mGravConst, mFlattening, mEqRadius);
+   Rvector6 outAsymState = ConvertCartState(state, "OutgoingAsymptote");
    
    return outAsymState;
 }
@@ -904,8 +913,7 @@ Rvector6 OrbitData::GetBLshortState()
        "mFlattening=%f, mEqRadius=%f\n", mGravConst, mFlattening, mEqRadius);
    #endif
    
-   Rvector6 blShortState = StateConversionUtil::Convert(state, "Cartesian", "BrouwerMeanShort",
-                                                        mGravConst, mFlattening, mEqRadius);
+   Rvector6 blShortState = ConvertCartState(state, "BrouwerMeanShort");
    
    #ifdef DEBUG_BROUWER_SHORT
    MessageInterface::ShowMessage
@@ -930,8 +938,7 @@ Rvector6 OrbitData::GetBLlongState()
    
    // Call GetCartState() to convert to parameter coord system first
    Rvector6 state = GetCartState();
-   Rvector6 blLongState = StateConversionUtil::Convert(state, "Cartesian", "BrouwerMeanLong",
-                                                       mGravConst, mFlattening, mEqRadius);
+   Rvector6 blLongState = ConvertCartState(state, "BrouwerMeanLong");
    
    #ifdef DEBUG_BROUWER_LONG
    MessageInterface::ShowMessage
@@ -942,6 +949,20 @@ Rvector6 OrbitData::GetBLlongState()
 }
 
 
+//------------------------------------------------------------------------------
+// static void ClearStateCache()
+//------------------------------------------------------------------------------
+/**
+ * Empties the state conversion cache shared by the orbit parameters.
+ */
+//------------------------------------------------------------------------------
+void OrbitData::ClearStateCache()
+{
+   std::lock_guard<std::mutex> lock(stateCacheMutex);
+   stateCache.clear();
+}
+
+
 //------------------------------------------------------------------------------
 // Real GetCartReal(Integer item)
 //------------------------------------------------------------------------------
@@ -2088,6 +2109,10 @@ void OrbitData::InitializeRefObjects()
        mParamTypeName.c_str());
    #endif
    
+   // Objects may have been replaced, so drop conversions keyed on old pointers
+   ClearStateCache();
+   mUseStateCache = false;
+   
    mSpacePoint = (SpacePoint*)FindObject(mParamOwnerType, mParamOwnerName);
    
    #ifdef DEBUG_ORBITDATA_INIT
@@ -3182,3 +3207,218 @@ void OrbitData::DebugWriteRefObjInfo()
        mSolarSystem ? mSolarSystem->GetName().c_str() : "NULL");
    #endif
 }
+
+
+//------------------------------------------------------------------------------
+// bool CanCacheStates()
+//------------------------------------------------------------------------------
+/**
+ * Checks whether the conversions for this parameter depend only on the state
+ * of its own object, so they can be shared through the state cache.
+ *
+ * Frames built on spacecraft (as origin, primary or secondary) change with
+ * the states of those spacecraft, which are not part of the cache key.
+ *
+ * @return true if the conversions can be cached
+ */
+//------------------------------------------------------------------------------
+bool OrbitData::CanCacheStates()
+{
+   if (mSpacePoint == NULL || mInternalCS == NULL)
+      return false;
+   
+   if (mIsParamOriginDep)
+      return (mOrigin != NULL);
+   
+   if (mParameterCS == NULL)
+      return false;
+   
+   SpacePoint *csOrigin = mParameterCS->GetOrigin();
+   if (csOrigin == NULL || csOrigin->IsOfType(Gmat::SPACECRAFT) ||
+       mParameterCS->UsesSpacecraft())
+      return false;
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool FindStateCacheEntry(const Rvector6 &rawState)
+//------------------------------------------------------------------------------
+/**
+ * Finds or adds the cache entry for this parameter's object and frame,
+ * resetting it if the object has moved to a new epoch or state since it was
+ * filled, and records the key for the calls that follow.
+ *
+ * @param rawState The current state of the object in the internal frame
+ *
+ * @return true if this parameter uses the cache
+ */
+//------------------------------------------------------------------------------
+bool OrbitData::FindStateCacheEntry(const Rvector6 &rawState)
+{
+   if (!CanCacheStates())
+      return false;
+   
+   mStateCacheKey.spacePoint = mSpacePoint;
+   mStateCacheKey.frame      = (mIsParamOriginDep ? (GmatBase*)mOrigin :
+                                                    (GmatBase*)mParameterCS);
+   mStateCacheKey.internalCS = mInternalCS;
+   mStateCacheRaw            = rawState;
+   
+   std::lock_guard<std::mutex> lock(stateCacheMutex);
+   std::map<StateCacheKey, StateCacheEntry>::iterator found =
+      stateCache.find(mStateCacheKey);
+   if (found == stateCache.end())
+      found = stateCache.insert(std::make_pair(mStateCacheKey,
+                                               StateCacheEntry())).first;
+   else if ((found->second.epoch == mCartEpoch) &&
+            (found->second.rawState == rawState))
+      return true;
+   
+   #ifdef DEBUG_STATE_CACHE
+   MessageInterface::ShowMessage
+      ("OrbitData::FindStateCacheEntry() '%s' resetting the entry at epoch "
+       "%.12lf\n", mActualParamName.c_str(), mCartEpoch);
+   #endif
+   StateCacheEntry &entry = found->second;
+   entry.epoch        = mCartEpoch;
+   entry.rawState     = rawState;
+   entry.hasCartState = false;
+   entry.elements.clear();
+   
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetCachedCartState(Rvector6 &cartState)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the converted Cartesian state for the last GetCartState() call
+ * if another parameter has already computed it.
+ *
+ * The entry is found again by key and checked against the raw state, so an
+ * entry that was cleared or refilled in the meantime is not used.
+ *
+ * @param cartState The cached state (output)
+ *
+ * @return true if a cached state was found
+ */
+//------------------------------------------------------------------------------
+bool OrbitData::GetCachedCartState(Rvector6 &cartState)
+{
+   if (!mUseStateCache)
+      return false;
+   
+   std::lock_guard<std::mutex> lock(stateCacheMutex);
+   std::map<StateCacheKey, StateCacheEntry>::iterator found =
+      stateCache.find(mStateCacheKey);
+   if ((found == stateCache.end()) || !found->second.hasCartState ||
+       (found->second.epoch != mCartEpoch) ||
+       !(found->second.rawState == mStateCacheRaw))
+      return false;
+   
+   cartState = found->second.cartState;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetCachedCartState(const Rvector6 &cartState)
+//------------------------------------------------------------------------------
+/**
+ * Saves the converted Cartesian state for the last GetCartState() call.
+ *
+ * @param cartState The state in the parameter coordinate system
+ */
+//------------------------------------------------------------------------------
+void OrbitData::SetCachedCartState(const Rvector6 &cartState)
+{
+   if (!mUseStateCache)
+      return;
+   
+   std::lock_guard<std::mutex> lock(stateCacheMutex);
+   std::map<StateCacheKey, StateCacheEntry>::iterator found =
+      stateCache.find(mStateCacheKey);
+   if ((found == stateCache.end()) || (found->second.epoch != mCartEpoch) ||
+       !(found->second.rawState == mStateCacheRaw))
+      return;
+   
+   found->second.cartState    = cartState;
+   found->second.hasCartState = true;
+}
+
+
+//------------------------------------------------------------------------------
+// Rvector6 ConvertCartState(const Rvector6 &cartState,
+//                           const std::string &toType)
+//------------------------------------------------------------------------------
+/**
+ * Converts the state returned by the preceding GetCartState() call to another
+ * representation, reusing the result of an earlier conversion of the same
+ * state when one is cached.
+ *
+ * @param cartState The Cartesian state in the parameter frame
+ * @param toType    The state type to convert to
+ *
+ * @return The converted state
+ */
+//------------------------------------------------------------------------------
+Rvector6 OrbitData::ConvertCartState(const Rvector6 &cartState,
+                                     const std::string &toType)
+{
+   if (mUseStateCache)
+   {
+      std::lock_guard<std::mutex> lock(stateCacheMutex);
+      std::map<StateCacheKey, StateCacheEntry>::iterator found =
+         stateCache.find(mStateCacheKey);
+      if ((found != stateCache.end()) && (found->second.epoch == mCartEpoch) &&
+          (found->second.rawState == mStateCacheRaw))
+      {
+         std::map<std::string, Rvector6>::iterator element =
+            found->second.elements.find(toType);
+         if (element != found->second.elements.end())
+            return element->second;
+      }
+   }
+   
+   Rvector6 converted;
+   if (toType == "Keplerian")
+      converted = StateConversionUtil::CartesianToKeplerian(mGravConst, cartState);
+   else if (toType == "ModifiedKeplerian")
+      converted = StateConversionUtil::KeplerianToModKeplerian
+         (StateConversionUtil::CartesianToKeplerian(mGravConst, cartState, "TA"));
+   else
+      converted = StateConversionUtil::Convert(cartState, "Cartesian", toType,
+                                               mGravConst, mFlattening, mEqRadius);
+   
+   if (mUseStateCache)
+   {
+      std::lock_guard<std::mutex> lock(stateCacheMutex);
+      std::map<StateCacheKey, StateCacheEntry>::iterator found =
+         stateCache.find(mStateCacheKey);
+      if ((found != stateCache.end()) && (found->second.epoch == mCartEpoch) &&
+          (found->second.rawState == mStateCacheRaw))
+         found->second.elements[toType] = converted;
+   }
+   
+   return converted;
+}
+
+
+//------------------------------------------------------------------------------
+// bool StateCacheKey::operator<(const StateCacheKey &key) const
+//------------------------------------------------------------------------------
+/**
+ * Orders the cache keys by object, frame and internal coordinate system.
+ */
+//------------------------------------------------------------------------------
+bool OrbitData::StateCacheKey::operator<(const StateCacheKey &key) const
+{
+   if (spacePoint != key.spacePoint)
+      return spacePoint < key.spacePoint;
+   if (frame != key.frame)
+      return frame < key.frame;
+   return internalCS < key.internalCS;
+}
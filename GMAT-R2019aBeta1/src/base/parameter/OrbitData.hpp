@@ -41,6 +41,7 @@
 #include "SolarSystem.hpp"
 #include "CoordinateSystem.hpp"
 #include "CoordinateConverter.hpp"
+#include <mutex>
 
 class GMAT_API OrbitData : public RefData
 {
@@ -69,6 +70,8 @@ public:
    Rvector6 GetBLshortState();
    Rvector6 GetBLlongState();
    
+   static void ClearStateCache();
+   
    void SetReal(Integer item, Real rval);
    void SetRvector6(const Rvector6 &val);
    
@@ -166,6 +169,13 @@ protected:
    void DebugWriteData(CoordinateSystem *paramOwnerCS);
    void DebugWriteRefObjInfo();
    
+   // State conversion cache
+   bool CanCacheStates();
+   bool FindStateCacheEntry(const Rvector6 &rawState);
+   bool GetCachedCartState(Rvector6 &cartState);
+   void SetCachedCartState(const Rvector6 &cartState);
+   Rvector6 ConvertCartState(const Rvector6 &cartState, const std::string &toType);
+   
    Rmatrix66 mSTM;
    Rmatrix33 mSTMSubset;
    
@@ -189,6 +199,47 @@ protected:
    // only one CoordinateConverter needed
    static CoordinateConverter mCoordConverter;
    
+   /// Identifies the conversions of one object's state into one frame
+   struct StateCacheKey
+   {
+      /// The object whose state is converted
+      SpacePoint                       *spacePoint;
+      /// The parameter coordinate system, or the origin for origin
+      /// dependent parameters
+      GmatBase                         *frame;
+      /// The internal coordinate system the raw state is given in
+      CoordinateSystem                 *internalCS;
+      
+      bool operator<(const StateCacheKey &key) const;
+   };
+   
+   /// Conversions of one object's state into one frame at one epoch
+   struct StateCacheEntry
+   {
+      /// Epoch of the raw state
+      Real                             epoch;
+      /// The raw state the conversions were computed from
+      Rvector6                         rawState;
+      /// Flag indicating that cartState holds the converted state
+      bool                             hasCartState;
+      /// The Cartesian state in the parameter coordinate system
+      Rvector6                         cartState;
+      /// Element sets computed from cartState, keyed by state type
+      std::map<std::string, Rvector6>  elements;
+   };
+   
+   /// Flag indicating that the last GetCartState() call used the cache
+   bool mUseStateCache;
+   /// Cache key of the last GetCartState() call
+   StateCacheKey mStateCacheKey;
+   /// Raw state read by the last GetCartState() call
+   Rvector6 mStateCacheRaw;
+   
+   // shared by all orbit parameters so each conversion is done once per step;
+   // entries are always found by key, under the mutex
+   static std::map<StateCacheKey, StateCacheEntry> stateCache;
+   static std::mutex stateCacheMutex;
+   
    // Other orbit items
    // @note - Do not add or remove items from this list without updating OrbitData.
    //         These enums are also used in OrbitData for passing parameter names to
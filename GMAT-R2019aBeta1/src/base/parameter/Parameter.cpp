@@ -1237,11 +1237,12 @@ std::string Parameter::GetParameterText(const Integer id) const
 //------------------------------------------------------------------------------
 Integer Parameter::GetParameterID(const std::string &str) const
 {
-   for (int i=GmatBaseParamCount; i<ParameterParamCount; i++)
-   {
-      if (str == PARAMETER_TEXT[i - GmatBaseParamCount])
-         return i;
-   }
+   static const ParameterIndex labelIndex =
+      MakeParameterIndex(PARAMETER_TEXT, ParameterParamCount - GmatBaseParamCount, GmatBaseParamCount);
+   
+   Integer id = FindParameterIndex(labelIndex, str);
+   if (id != -1)
+      return id;
    
    return GmatBase::GetParameterID(str);
 }
@@ -56,11 +56,16 @@
 
 #include "PredictorCorrector.hpp"
 #include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
 #include <fstream>
 
 #include "MessageInterface.hpp"
 
 
+/// Profiler counter for this file
+static const Integer INTEGRATOR_STEPS =
+      RunProfiler::RegisterCounter("Integrator Steps");
+
 //---------------------------------
 // static data
 //---------------------------------
@@ -596,6 +601,7 @@ bool PredictorCorrector::Step()
       stepAttempts = 0;
    }
 
+   RunProfiler::Count(INTEGRATOR_STEPS);
    return true;
 }
 
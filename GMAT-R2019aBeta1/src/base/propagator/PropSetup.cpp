@@ -1415,6 +1415,12 @@ bool PropSetup::Initialize()
    if (mInitialized == true)
    {
       mPropagator->SetPhysicalModel(mODEModel);
+
+      // Forces on the multi-rate grid are held to the integrator's accuracy
+      if (mPropagator->IsOfType("Integrator"))
+         mODEModel->SetMultiRateTolerance(
+               mPropagator->GetRealParameter("Accuracy"));
+
       #ifdef DEBUG_INITIALIZATION
          MessageInterface::ShowMessage(
             "PropSetup::Initialize() after SetPhysicalModel(%s) \n",
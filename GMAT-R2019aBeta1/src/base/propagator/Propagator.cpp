@@ -80,6 +80,7 @@
 // **************************************************************************
 
 #include <sstream>
+#include <cstring>              // for memcpy
 #include "Propagator.hpp"
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
@@ -98,13 +99,15 @@ const std::string
 Propagator::PARAMETER_TEXT[PropagatorParamCount - GmatBaseParamCount] =
 {
     "InitialStepSize",
-    "AlwaysUpdateStepsize"
+    "AlwaysUpdateStepsize",
+    "UseDenseOutput"
 };
 
 const Gmat::ParameterType
 Propagator::PARAMETER_TYPE[PropagatorParamCount - GmatBaseParamCount] =
 {
     Gmat::REAL_TYPE,
+    Gmat::BOOLEAN_TYPE,
     Gmat::BOOLEAN_TYPE
 };
 
@@ -143,7 +146,11 @@ Propagator::Propagator(const std::string &typeStr,
       j2kBodyName         ("Earth"),
       j2kBody             (NULL),
       centralBody         ("Earth"),
-      propOrigin          (NULL)
+      propOrigin          (NULL),
+      denseAllowed        (true),
+      denseRequested      (false),
+      denseReady          (false),
+      denseStep           (0.0)
 {
     // GmatBase data
    objectTypes.push_back(Gmat::PROPAGATOR);
@@ -189,7 +196,11 @@ Propagator::Propagator(const Propagator& p)
       j2kBodyName         (p.j2kBodyName),
       j2kBody             (NULL),
       centralBody         (p.centralBody),
-      propOrigin          (NULL)
+      propOrigin          (NULL),
+      denseAllowed        (p.denseAllowed),
+      denseRequested      (p.denseRequested),
+      denseReady          (false),
+      denseStep           (0.0)
 {
    isInitialized = false;
    debug = p.debug;
@@ -230,6 +241,12 @@ Propagator& Propagator::operator=(const Propagator& p)
     centralBody = p.centralBody;
     propOrigin  = NULL;
 
+    denseAllowed   = p.denseAllowed;
+    denseRequested = p.denseRequested;
+    denseReady = false;
+    denseStep  = 0.0;
+    denseComponentMap.clear();
+
     debug = p.debug;
 
     return *this;
@@ -333,7 +350,7 @@ std::string Propagator::GetParameterTypeString(const Integer id) const
 //------------------------------------------------------------------------------
 bool Propagator::IsParameterReadOnly(const Integer id) const
 {
-   if (id == AlwaysUpdateStepsize)
+   if ((id == AlwaysUpdateStepsize) || (id == USE_DENSE_OUTPUT))
       return true;
 
    return GmatBase::IsParameterReadOnly(id);
@@ -514,6 +531,8 @@ bool Propagator::GetBooleanParameter(const Integer id) const
 {
    if (id == AlwaysUpdateStepsize)
       return alwaysUpdateStepsize;
+   if (id == USE_DENSE_OUTPUT)
+      return denseAllowed;
 
    return GmatBase::GetBooleanParameter(id);
 }
@@ -541,6 +560,13 @@ bool Propagator::SetBooleanParameter(const Integer id, const bool value)
       alwaysUpdateStepsize = value;
       return alwaysUpdateStepsize;
    }
+   if (id == USE_DENSE_OUTPUT)
+   {
+      denseAllowed = value;
+      if (!denseAllowed)
+         EnableDenseOutput(false);
+      return denseAllowed;
+   }
 
    return GmatBase::SetBooleanParameter(id, value);
 }
@@ -705,6 +731,9 @@ bool Propagator::Initialize()
    else
       isInitialized = true;
 
+   // The state layout may have changed, so the component map is rebuilt
+   denseReady = false;
+   denseComponentMap.clear();
     
     if (!isInitialized)
        throw PropagatorException("Propagator failed to initialize");
@@ -1197,4 +1226,234 @@ void Propagator::TurnDebug(bool debugFlag)
 bool Propagator::UsesErrorControl()
 {
    return false;
+}
+
+
+//------------------------------------------------------------------------------
+// void EnableDenseOutput(bool enable)
+//------------------------------------------------------------------------------
+/**
+ * Turns the recording of steps for dense output on or off
+ *
+ * Recording can cost derivative evaluations, so it is off until a consumer of
+ * GetDenseState() asks for it.  Propagators without dense output ignore the
+ * setting, and none is recorded while UseDenseOutput is false.
+ *
+ * @param enable true to record each accepted step, false to stop recording
+ */
+//------------------------------------------------------------------------------
+void Propagator::EnableDenseOutput(bool enable)
+{
+   denseRequested = enable && denseAllowed;
+   if (!denseRequested)
+      denseReady = false;
+}
+
+
+//------------------------------------------------------------------------------
+// bool HasDenseOutput() const
+//------------------------------------------------------------------------------
+/**
+ * Reports if the propagator can evaluate states inside its last step
+ *
+ * Integrators that record their steps for dense output override this method.
+ *
+ * @return true if GetDenseState() is supported, false if not
+ */
+//------------------------------------------------------------------------------
+bool Propagator::HasDenseOutput() const
+{
+   return false;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetDenseStepSize() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the size of the step covered by the dense output data
+ *
+ * @return The signed size of the most recent accepted step, or 0.0 if no step
+ *         has been recorded
+ */
+//------------------------------------------------------------------------------
+Real Propagator::GetDenseStepSize() const
+{
+   return (denseReady ? denseStep : 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetDenseState(const Real dt, Real *state) const
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the propagation state inside the most recent accepted step
+ *
+ * The state is interpolated from the data recorded at the ends of the step, so
+ * no derivative evaluations are made.  Position elements that the physical
+ * model maps to velocity elements, and those velocities, use a quintic Hermite
+ * polynomial built from the positions, velocities and accelerations at the two
+ * ends of the step.  All other elements use a cubic Hermite polynomial built
+ * from their values and time derivatives.
+ *
+ * The data describe the step that ended at the current propagation state, and
+ * remain valid until the next step is taken or the propagator is reinitialized.
+ *
+ * @param dt    Time from the start of the step, in seconds, with the same sign
+ *              as the step and no larger than it
+ * @param state Array, sized to the propagation dimension, that receives the
+ *              state
+ *
+ * @return true if the state was evaluated, false if no step is recorded or dt
+ *         falls outside of the step
+ */
+//------------------------------------------------------------------------------
+bool Propagator::GetDenseState(const Real dt, Real *state) const
+{
+   if (!denseReady || (state == NULL))
+      return false;
+
+   Real h = denseStep;
+   Real theta = dt / h;
+   if ((theta < -1.0e-9) || (theta > 1.0 + 1.0e-9))
+      return false;
+
+   Real t2 = theta * theta, t3 = t2 * theta;
+
+   // Cubic Hermite basis
+   Real h00 = 2.0 * t3 - 3.0 * t2 + 1.0;
+   Real h10 = (t3 - 2.0 * t2 + theta) * h;
+   Real h01 = 3.0 * t2 - 2.0 * t3;
+   Real h11 = (t3 - t2) * h;
+
+   for (Integer i = 0; i < dimension; ++i)
+      state[i] = h00 * denseStart[i] + h10 * denseStartRate[i] +
+                 h01 * denseEnd[i]   + h11 * denseEndRate[i];
+
+   // Quintic Hermite basis and its derivative for position/velocity pairs
+   Real t4 = t3 * theta, t5 = t4 * theta, hh = h * h;
+
+   Real q0 = 1.0 - 10.0 * t3 + 15.0 * t4 - 6.0 * t5;
+   Real q1 = (theta - 6.0 * t3 + 8.0 * t4 - 3.0 * t5) * h;
+   Real q2 = 0.5 * (t2 - 3.0 * t3 + 3.0 * t4 - t5) * hh;
+   Real q3 = 0.5 * (t3 - 2.0 * t4 + t5) * hh;
+   Real q4 = (-4.0 * t3 + 7.0 * t4 - 3.0 * t5) * h;
+   Real q5 = 10.0 * t3 - 15.0 * t4 + 6.0 * t5;
+
+   Real d0 = (-30.0 * t2 + 60.0 * t3 - 30.0 * t4) / h;
+   Real d1 = 1.0 - 18.0 * t2 + 32.0 * t3 - 15.0 * t4;
+   Real d2 = 0.5 * (2.0 * theta - 9.0 * t2 + 12.0 * t3 - 5.0 * t4) * h;
+   Real d3 = 0.5 * (3.0 * t2 - 8.0 * t3 + 5.0 * t4) * h;
+   Real d4 = -12.0 * t2 + 28.0 * t3 - 15.0 * t4;
+   Real d5 = -d0;
+
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      Integer j = densePartner[i];
+      if (j < 0)
+         continue;
+
+      state[i] = q0 * denseStart[i] + q1 * denseStart[j] +
+                 q2 * denseStartRate[j] + q3 * denseEndRate[j] +
+                 q4 * denseEnd[j] + q5 * denseEnd[i];
+      state[j] = d0 * denseStart[i] + d1 * denseStart[j] +
+                 d2 * denseStartRate[j] + d3 * denseEndRate[j] +
+                 d4 * denseEnd[j] + d5 * denseEnd[i];
+   }
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetDerivativeCallsPerStep() const
+//------------------------------------------------------------------------------
+/**
+ * Reports the derivative evaluations made in one attempt at a step
+ *
+ * Callers use this value to estimate the cost of propagation they avoid, for
+ * example when a stop is located on dense output.
+ *
+ * @return The number of derivative calls per step attempt, or 0 if unknown
+ */
+//------------------------------------------------------------------------------
+Integer Propagator::GetDerivativeCallsPerStep() const
+{
+   return 0;
+}
+
+
+//------------------------------------------------------------------------------
+// void PrepareDenseStep()
+//------------------------------------------------------------------------------
+/**
+ * Buffers the state at the start of a step for dense output
+ *
+ * Integrators call this method before attempting a step.  The first call after
+ * initialization sizes the buffers and retrieves the component map that pairs
+ * position elements with their velocities.
+ */
+//------------------------------------------------------------------------------
+void Propagator::PrepareDenseStep()
+{
+   denseReady = false;
+
+   if ((physicalModel == NULL) || (dimension <= 0))
+      return;
+
+   if ((Integer)denseComponentMap.size() != dimension)
+   {
+      denseStart.assign(dimension, 0.0);
+      denseEnd.assign(dimension, 0.0);
+      denseStartRate.assign(dimension, 0.0);
+      denseEndRate.assign(dimension, 0.0);
+      densePartner.assign(dimension, -1);
+      denseComponentMap.assign(dimension, -1);
+
+      if (!physicalModel->GetComponentMap(&denseComponentMap[0]))
+         denseComponentMap.assign(dimension, -1);
+      for (Integer i = 0; i < dimension; ++i)
+         if ((denseComponentMap[i] >= dimension) || (denseComponentMap[i] == i))
+            denseComponentMap[i] = -1;
+   }
+
+   memcpy(&denseStart[0], physicalModel->GetState(), dimension * sizeof(Real));
+}
+
+
+//------------------------------------------------------------------------------
+// void CompleteDenseStep(const Real h)
+//------------------------------------------------------------------------------
+/**
+ * Finishes the dense output record for an accepted step
+ *
+ * Integrators fill denseStartRate and denseEndRate, and then call this method
+ * with the step that was taken.  The end state is read from outState.  A
+ * component map pair is used for quintic interpolation only when the rate of
+ * the position element at the start of the step matches its velocity element,
+ * so elements that are not true position/velocity pairs fall back to cubic
+ * interpolation.
+ *
+ * @param h The size of the accepted step
+ */
+//------------------------------------------------------------------------------
+void Propagator::CompleteDenseStep(const Real h)
+{
+   if ((h == 0.0) || ((Integer)denseComponentMap.size() != dimension) ||
+       (dimension <= 0))
+      return;
+
+   memcpy(&denseEnd[0], outState, dimension * sizeof(Real));
+
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      Integer j = denseComponentMap[i];
+      densePartner[i] = -1;
+      if ((j >= 0) && (GmatMathUtil::Abs(denseStartRate[i] - denseStart[j]) <=
+            1.0e-12 * GmatMathUtil::Abs(denseStart[j])))
+         densePartner[i] = j;
+   }
+
+   denseStep  = h;
+   denseReady = true;
 }
\ No newline at end of file
@@ -168,6 +168,13 @@ public:
 
    virtual bool UsesErrorControl();
 
+   // Dense output: states inside the most recent step
+   virtual void EnableDenseOutput(bool enable);
+   virtual bool HasDenseOutput() const;
+   virtual Real GetDenseStepSize() const;
+   virtual bool GetDenseState(const Real dt, Real *state) const;
+   virtual Integer GetDerivativeCallsPerStep() const;
+
    // Abstract methods
 
    //---------------------------------------------------------------------------
@@ -207,6 +214,7 @@ public:
    {
       INITIAL_STEP_SIZE = GmatBaseParamCount, /// Stepsize for the propagation
       AlwaysUpdateStepsize,
+      USE_DENSE_OUTPUT,
       PropagatorParamCount                    /// Count of the parameters for this class
    };
 
@@ -256,6 +264,30 @@ protected:
    virtual void MoveToOriginGT(GmatTime newEpoch = -1.0);
    virtual void ReturnFromOriginGT(GmatTime newEpoch = -1.0);
 
+   // Dense output data, recorded by the integrators for each accepted step
+   /// Flag letting consumers turn dense output on; when off, stops are
+   /// located by propagating to them
+   bool                      denseAllowed;
+   /// Flag set by the consumer of dense output to have the steps recorded
+   bool                      denseRequested;
+   /// Flag indicating that the dense output buffers describe the last step
+   bool                      denseReady;
+   /// Signed size of the step described by the dense output buffers
+   Real                      denseStep;
+   /// State at the start and end of the step
+   RealArray                 denseStart;
+   RealArray                 denseEnd;
+   /// Time derivatives of the state at the start and end of the step
+   RealArray                 denseStartRate;
+   RealArray                 denseEndRate;
+   /// First derivative element of each state element, or -1, from the model
+   IntegerArray              denseComponentMap;
+   /// Component map entries whose rates were confirmed for the last step
+   IntegerArray              densePartner;
+
+   void                      PrepareDenseStep();
+   void                      CompleteDenseStep(const Real h);
+
    bool debug;
 };
 
@@ -64,11 +64,16 @@
 #include "gmatdefs.hpp"
 #include "RungeKutta.hpp"
 #include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
 
 //#define DEBUG_PROPAGATOR_FLOW
 //#define DEBUG_RAW_STEP_STATE
 //#define DEBUG_STEPSIZE
 
+/// Profiler counter for this file
+static const Integer INTEGRATOR_STEPS =
+      RunProfiler::RegisterCounter("Integrator Steps");
+
 //---------------------------------
 // public
 //---------------------------------
@@ -96,7 +101,9 @@ RungeKutta::RungeKutta(Integer st, Integer order, const std::string &typeStr,
     incPower        (1.0/order),
     decPower        (1.0/(order-1)),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    denseOutput     (false),
+    denseEndStage   (-1)
 {
 }
 
@@ -131,7 +138,9 @@ RungeKutta::RungeKutta(const RungeKutta& rk) :
     incPower        (rk.incPower),
     decPower        (rk.decPower),
     stageState      (NULL),
-    candidateState  (NULL)
+    candidateState  (NULL),
+    denseOutput     (false),
+    denseEndStage   (-1)
 {
 }
 
@@ -162,6 +171,8 @@ RungeKutta& RungeKutta::operator=(const RungeKutta& rk)
     ee = NULL;
     stageState = NULL;
     candidateState = NULL;
+    denseOutput = false;
+    denseEndStage = -1;
 
     isInitialized = false;
 
@@ -281,6 +292,7 @@ bool RungeKutta::Initialize()
     {
        SetCoefficients();
        SetupAccumulator();
+       FindDenseEndStage();
     }
 
     isInitialized = true;
@@ -324,6 +336,10 @@ bool RungeKutta::Step()
     bool goodStepTaken = false;
     Real maxerror;
 
+    // The step overwrites the input state, so buffer it for dense output
+    if (HasDenseOutput())
+       PrepareDenseStep();
+
     do
     {
         if (!RawStep())
@@ -359,7 +375,11 @@ bool RungeKutta::Step()
        MessageInterface::ShowMessage("\n");
     }
 
+    if (HasDenseOutput())
+       RecordDenseStep();
+
     physicalModel->IncrementTime(stepTaken);
+    RunProfiler::Count(INTEGRATOR_STEPS);
     return true;
 }
 
@@ -510,6 +530,43 @@ bool RungeKutta::Step(Real dt)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// bool RungeKutta::HasDenseOutput() const
+//------------------------------------------------------------------------------
+/**
+ * Reports if the integrator records its steps for dense output
+ *
+ * Accepted steps are recorded once the coefficients are set and a consumer
+ * has called EnableDenseOutput().  The derivative at the start of the step is
+ * the first stage.  The derivative at the end comes from the last stage when
+ * the tableau is FSAL, and from one extra derivative evaluation at the
+ * accepted state otherwise, so steps are not recorded unless requested.
+ *
+ * @return true if the integrator supports GetDenseState()
+ */
+//------------------------------------------------------------------------------
+bool RungeKutta::HasDenseOutput() const
+{
+   return (denseOutput && denseRequested);
+}
+
+//------------------------------------------------------------------------------
+// Integer RungeKutta::GetDerivativeCallsPerStep() const
+//------------------------------------------------------------------------------
+/**
+ * Reports the derivative evaluations made in one attempt at a step
+ *
+ * @return The number of stages, plus the end point evaluation made when dense
+ *         output is enabled and the tableau is not FSAL
+ */
+//------------------------------------------------------------------------------
+Integer RungeKutta::GetDerivativeCallsPerStep() const
+{
+   if (HasDenseOutput() && (denseEndStage < 0))
+      return stages + 1;
+   return stages;
+}
+
 //---------------------------------
 // protected
 //---------------------------------
@@ -679,6 +736,87 @@ void RungeKutta::ClearArrays()
     //    ai = cj = ee = stageState = candidateState = errorEstimates = NULL;
 }
 
+//------------------------------------------------------------------------------
+// void RungeKutta::FindDenseEndStage()
+//------------------------------------------------------------------------------
+/**
+ * Marks dense output as supported and locates a stage evaluated at the end
+ * state, if any
+ *
+ * A stage gives the derivative at the end of the step only when it is taken
+ * at the full step (ai = 1) from the propagated state, that is, when its bij
+ * row matches the cj weights and the later stages carry no weight (First Same
+ * As Last).  Tableaus without such a stage pay one more derivative evaluation
+ * per accepted step in RecordDenseStep() while dense output is enabled.  Call
+ * this method after SetCoefficients().
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::FindDenseEndStage()
+{
+    denseEndStage = -1;
+    denseOutput = (ai != NULL);
+    if (!denseOutput)
+        return;
+
+    for (Integer i = stages - 1; i > 0; --i)
+    {
+        if (ai[i] != 1.0)
+            continue;
+
+        bool fsal = true;
+        for (Integer j = 0; j < stages; ++j)
+        {
+            if (((j < i) && (bij[i][j] != cj[j])) ||
+                ((j >= i) && (cj[j] != 0.0)))
+            {
+                fsal = false;
+                break;
+            }
+        }
+
+        if (fsal)
+        {
+            denseEndStage = i;
+            break;
+        }
+    }
+}
+
+//------------------------------------------------------------------------------
+// void RungeKutta::RecordDenseStep()
+//------------------------------------------------------------------------------
+/**
+ * Records the rates at the ends of an accepted step for dense output
+ *
+ * The first stage holds the step size times the derivative at the start of the
+ * step.  The FSAL stage, when there is one, holds the step size times the
+ * derivative at the end; otherwise the derivative is evaluated at the accepted
+ * state.  The step is left unrecorded if that evaluation fails.
+ */
+//------------------------------------------------------------------------------
+void RungeKutta::RecordDenseStep()
+{
+    if ((stepTaken == 0.0) || ((Integer)denseStartRate.size() != dimension))
+        return;
+
+    for (Integer i = 0; i < dimension; ++i)
+        denseStartRate[i] = ki[0][i] / stepTaken;
+
+    if (denseEndStage >= 0)
+    {
+        for (Integer i = 0; i < dimension; ++i)
+            denseEndRate[i] = ki[denseEndStage][i] / stepTaken;
+    }
+    else
+    {
+        if (!physicalModel->GetDerivatives(outState, stepTaken))
+            return;
+        for (Integer i = 0; i < dimension; ++i)
+            denseEndRate[i] = ddt[i];
+    }
+    CompleteDenseStep(stepTaken);
+}
+
 //------------------------------------------------------------------------------
 // bool RungeKutta::SetupAccumulator()
 //------------------------------------------------------------------------------
@@ -163,6 +163,9 @@ public:
     virtual bool Step(Real dt);
     virtual bool RawStep();
 
+    virtual bool HasDenseOutput() const;
+    virtual Integer GetDerivativeCallsPerStep() const;
+
 protected:
     /// The number of stages used to take an integration step
     Integer stages;
@@ -187,10 +190,16 @@ protected:
     Real * stageState;
     /// Candidate state for the step (used if the error is acceptable)
     Real * candidateState;
+    /// Flag indicating that the tableau supports dense output
+    bool denseOutput;
+    /// Stage evaluated at the end state of the step (FSAL), or -1 if none
+    Integer denseEndStage;
 
 
     bool SetupAccumulator();
     void ClearArrays();
+    void FindDenseEndStage();
+    virtual void RecordDenseStep();
     virtual Real EstimateError();
     virtual bool AdaptStep(Real maxerror);
 
@@ -47,9 +47,14 @@
 #include "gmatdefs.hpp"
 #include "RungeKuttaNystrom.hpp"
 #include "MessageInterface.hpp"
+#include "RunProfiler.hpp"
 
 //#define DEBUG_INITIALIZATION
 
+/// Profiler counter for this file
+static const Integer INTEGRATOR_STEPS =
+      RunProfiler::RegisterCounter("Integrator Steps");
+
 //---------------------------------
 // public
 //---------------------------------
@@ -276,6 +281,11 @@ bool RungeKuttaNystrom::Initialize()
       isInitialized = true;      // Flag that allows coefficient filling
       SetCoefficients();
       isInitialized = SetupAccumulator();  // Final init check and setup
+
+      // No Nystrom stage advances the velocities, so none is evaluated at the
+      // end state; RecordDenseStep() evaluates the end point instead
+      denseOutput = true;
+      denseEndStage = -1;
    }
    else
       throw PropagatorException("RungeKutta base did not initialize for the "
@@ -315,6 +325,9 @@ bool RungeKuttaNystrom::Step()
         
    bool goodStepTaken = false;
    double maxerror;
+
+   if (HasDenseOutput())
+      PrepareDenseStep();
     
    do {
       if (!RawStep()) {
@@ -333,7 +346,11 @@ bool RungeKuttaNystrom::Step()
       }
    } while (!goodStepTaken);
 
+   if (HasDenseOutput())
+      RecordDenseStep();
+
    physicalModel->IncrementTime(stepTaken);
+   RunProfiler::Count(INTEGRATOR_STEPS);
    return true;
 }
 
@@ -497,3 +514,46 @@ Real RungeKuttaNystrom::EstimateError()
     // Find the maximum error
     return physicalModel->EstimateError(errorEstimates, candidateState);
 }
+
+
+//------------------------------------------------------------------------------
+// void RecordDenseStep()
+//------------------------------------------------------------------------------
+/**
+ * Records the rates at the ends of an accepted step for dense output
+ *
+ * The Nystrom stages hold accelerations in the position elements, so the rates
+ * of the positions are their velocities and the rates of the velocities are the
+ * accelerations from the first stage and from an evaluation at the accepted
+ * state.  Elements outside of the component map are not propagated by the
+ * stages, and are interpolated linearly.
+ */
+//------------------------------------------------------------------------------
+void RungeKuttaNystrom::RecordDenseStep()
+{
+   if ((stepTaken == 0.0) || ((Integer)denseStartRate.size() != dimension))
+      return;
+
+   if (!physicalModel->GetDerivatives(outState, stepTaken, 2))
+      return;
+
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      if (derivativeMap[i] >= 0)
+      {
+         denseStartRate[i] = denseStart[derivativeMap[i]];
+         denseEndRate[i]   = outState[derivativeMap[i]];
+      }
+      else if (inverseMap[i] >= 0)
+      {
+         denseStartRate[i] = ki[0][inverseMap[i]];
+         denseEndRate[i]   = ddt[inverseMap[i]];
+      }
+      else
+      {
+         denseStartRate[i] = (outState[i] - denseStart[i]) / stepTaken;
+         denseEndRate[i]   = denseStartRate[i];
+      }
+   }
+   CompleteDenseStep(stepTaken);
+}
@@ -122,6 +122,7 @@ protected:
     Real                * eeDeriv;
 
     virtual Real          EstimateError(void);
+    virtual void          RecordDenseStep();
 };
 
 #endif // RungeKutta89_hpp
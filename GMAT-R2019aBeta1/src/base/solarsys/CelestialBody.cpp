@@ -62,6 +62,7 @@
 #include "TimeTypes.hpp"
 #include "StateConversionUtil.hpp"
 #include "StringUtil.hpp"               // for ToString()
+#include "RunProfiler.hpp"
 
 //#define DEBUG_CELESTIAL_BODY 1
 //#define DEBUG_GET_STATE
@@ -89,6 +90,10 @@
 //#define DEBUG_VALIDATION
 //#define DEBUG_CB_GET_STRING_ARRAY
 
+/// Profiler counter for this file
+static const Integer EPHEMERIS_CALLS =
+      RunProfiler::RegisterCounter("Ephemeris Evaluations");
+
 //#ifndef DEBUG_MEMORY
 //#define DEBUG_MEMORY
 //#endif
@@ -1043,6 +1048,7 @@ const Rvector6&  CelestialBody::GetState(A1Mjd atTime)
    }
    
    Real*     posVel = NULL;
+   RunProfiler::Count(EPHEMERIS_CALLS);
    switch (posVelSrc)
    {
 //      case Gmat::TWO_BODY_PROPAGATION :   // 2012.01.24 - wcs - disallow for now
@@ -1153,6 +1159,7 @@ const Rvector6&  CelestialBody::GetState(GmatTime atTime)
    }
 
    Real*     posVel = NULL;
+   RunProfiler::Count(EPHEMERIS_CALLS);
    switch (posVelSrc)
    {
       //      case Gmat::TWO_BODY_PROPAGATION :   // 2012.01.24 - wcs - disallow for now
@@ -1264,6 +1271,7 @@ const Rvector3  CelestialBody::GetPositionDelta(const GmatTime &atTime1, const G
 #endif
 
    Real*     posVel = NULL;
+   RunProfiler::Count(EPHEMERIS_CALLS, 2);
    switch (posVelSrc)
    {
       //      case Gmat::TWO_BODY_PROPAGATION :   // 2012.01.24 - wcs - disallow for now
@@ -1357,6 +1365,7 @@ const Rvector3  CelestialBody::GetPositionDeltaSSB(const GmatTime &atTime1, cons
 #endif
 
    Real*     posVel = NULL;
+   RunProfiler::Count(EPHEMERIS_CALLS, 2);
    switch (posVelSrc)
    {
       //      case Gmat::TWO_BODY_PROPAGATION :   // 2012.01.24 - wcs - disallow for now
@@ -1476,6 +1485,7 @@ void CelestialBody::GetState(const A1Mjd &atTime, Real *outState)
    }
    
 //   Rvector6 state;
+   RunProfiler::Count(EPHEMERIS_CALLS);
    switch (posVelSrc)
    {
 //      case Gmat::TWO_BODY_PROPAGATION :  // 2012.01.24 - wcs - disallow for now
@@ -1613,6 +1623,7 @@ void CelestialBody::GetState(const GmatTime &atTime, Real *outState)
    }
 
    //   Rvector6 state;
+   RunProfiler::Count(EPHEMERIS_CALLS);
    switch (posVelSrc)
    {
       //      case Gmat::TWO_BODY_PROPAGATION :  // 2012.01.24 - wcs - disallow for now
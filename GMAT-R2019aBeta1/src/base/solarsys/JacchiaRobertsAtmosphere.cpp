@@ -251,13 +251,6 @@ JacchiaRobertsAtmosphere::~JacchiaRobertsAtmosphere()
 //------------------------------------------------------------------------------
 JacchiaRobertsAtmosphere::JacchiaRobertsAtmosphere(const JacchiaRobertsAtmosphere& jr) :
     AtmosphereModel     (jr),
-    root1               (jr.root1),
-    root2               (jr.root2),
-    x_root              (jr.x_root),
-    y_root              (jr.y_root),
-    t_infinity          (jr.t_infinity),
-    tx                  (jr.tx),
-    sum                 (jr.sum),
     cbPolarRadius       (jr.cbPolarRadius),
     cbPolarSquared      (jr.cbPolarSquared)
 {
@@ -282,13 +275,6 @@ JacchiaRobertsAtmosphere& JacchiaRobertsAtmosphere::operator=
         
     AtmosphereModel::operator=(jr);   
     
-    root1            = jr.root1;
-    root2            = jr.root2;
-    x_root           = jr.x_root;
-    y_root           = jr.y_root;
-    t_infinity       = jr.t_infinity;
-    tx               = jr.tx;
-    sum              = jr.sum;
     cbPolarRadius    = jr.cbPolarRadius;
     cbPolarSquared   = jr.cbPolarSquared;
 
@@ -339,6 +325,7 @@ bool JacchiaRobertsAtmosphere::Density(Real *pos, Real *density, Real epoch,
    Real height;
    Real utc_time;
    A1Mjd a1mjd_time(epoch);
+   EpochTerms ep;
 
    // Don't offset by half a day here:
    utc_time = (Real)a1mjd_time.ToUtcMjd();// - 0.5;
@@ -348,6 +335,15 @@ bool JacchiaRobertsAtmosphere::Density(Real *pos, Real *density, Real epoch,
          ("   UTC time = %lf\n", utc_time);
    #endif
 
+   // The flux, Kp, Sun and semiannual terms are shared by all of the states
+   if (count > 0)
+   {
+      if (sunVector == NULL)
+         throw AtmosphereException(
+            "Sun vector not set in Jacchia-Roberts model.");
+      PrepareEpochTerms(utc_time, sunVector, ep);
+   }
+
    for (Integer i = 0; i < count; ++i)
    {
       height = CalculateGeodetics(&pos[i*6], epoch, true);
@@ -372,8 +368,7 @@ bool JacchiaRobertsAtmosphere::Density(Real *pos, Real *density, Real epoch,
       if (height > 0.0)
       {         
          // Output density in units of kg/m3
-         density[i] = 1.0e3 * JacchiaRoberts(height, &pos[i*6], sunVector,
-               utc_time);
+         density[i] = 1.0e3 * JacchiaRoberts(height, &pos[i*6], ep);
       }
       else
       {
@@ -391,7 +386,7 @@ bool JacchiaRobertsAtmosphere::Density(Real *pos, Real *density, Real epoch,
             MessageInterface::ShowMessage("   Density:     %.12le\n", density[0]);
             MessageInterface::ShowMessage("   F10.7:       %.12lf\n", nominalF107);
             MessageInterface::ShowMessage("   F10.7a:      %.12lf\n", nominalF107a);
-            MessageInterface::ShowMessage("   Kp:          %lf\n", geo.tkp);
+            MessageInterface::ShowMessage("   Kp:          %lf\n", ep.geo.tkp);
             MessageInterface::ShowMessage("==================================\n");
 
             firstcall = false;
@@ -443,42 +438,24 @@ void JacchiaRobertsAtmosphere::SetCentralBody(CelestialBody *cb)
 
 
 //------------------------------------------------------------------------------
-// Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3], 
-//                     Real a1_time, bool new_file)
+// void PrepareEpochTerms(Real a1_time, Real sun[3], EpochTerms &ep)
 //------------------------------------------------------------------------------
 /**
- * Obtain atmospheric density using the Jacchia-Roberts model
- *  
- *  
- * Modifications:
- * Name                Date      Description
- * ------------------  --------  ------------------------------------------
- * D. Ginn             01/26/94  DSPSE OPS:  Added new_file argument, logic
- * W. Waktola          06/08/04  Code 583: Renamed to JacchiaRoberts()
- * W. Waktola          12/28/04  Code 583: Removed FILE* tkptr
- *
- * @param height       Spacecraft height (km)
- * @param space_craft  Spacecraft position (km, TOD GCI)
- * @param sun          Sun unit vector (TOD GCI)
- * @param a1_time      Reduced julian date (days)
- * @param new_file     If true, flush static data for file
+ * Sets the parts of the model that do not depend on the spacecraft position:
+ * the flux based exospheric temperature, Kp, the Sun direction and the
+ * semiannual and seasonal correction factors.
  *
- * @return The density
- */  
+ * @param a1_time  Reduced julian date (days)
+ * @param sun      Sun unit vector (TOD GCI)
+ * @param ep       The terms for the epoch
+ */
 //------------------------------------------------------------------------------
-Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3], 
-                                              Real sun[3], Real a1_time)
+void JacchiaRobertsAtmosphere::PrepareEpochTerms(Real a1_time, Real sun[3],
+                                                 EpochTerms &ep)
 {
-   #ifdef DEBUG_JR_DRAG
-      MessageInterface::ShowMessage
-         ("JacchiaRobertsAtmosphere::JacchiaRoberts(%15lf, [%15lf %15lf %15lf],"
-          "\n   [%15lf %15lf %15lf], %15lf\n",
-          height, space_craft[0], space_craft[1], space_craft[2],
-          sun[0], sun[1], sun[2], a1_time);
-   #endif
+   GEOPARMS &geo = ep.geo;
+   Real day_58, tausa, alpha;
 
-   Real density, temperature, t_500, sun_dec, geo_lat;
-   
    // Read F10.7 and F10.7a to calculate the geo.xtemp
    if (!fluxReaderLoaded)
    {
@@ -565,8 +542,62 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
             nominalF107, nominalF107a, geo.tkp, geo.xtemp);
    #endif
 
+   ep.expkp = exp(geo.tkp);
+
    // Compute declination of the sun
-   sun_dec = atan2(sun[2], sqrt(sun[0]*sun[0] + sun[1]*sun[1]));
+   ep.sun[0] = sun[0];
+   ep.sun[1] = sun[1];
+   ep.sun[2] = sun[2];
+   ep.sun_dec = atan2(sun[2], sqrt(sun[0]*sun[0] + sun[1]*sun[1]));
+   ep.sun_denom = sqrt(sun[0]*sun[0] + sun[1]*sun[1]);
+
+   // Semiannual variation, and the seasonal part of the latitudinal variation
+   day_58 = (a1_time - 6204.5)/365.2422; // @todo - should this use GmatConstants value?
+   tausa = day_58 + 0.09544 * (
+         pow( 0.5*(1.0 + sin(2*GmatMathConstants::PI*day_58 +6.035)), 1.65 )  - 0.5);
+   alpha = sin(4.0*GmatMathConstants::PI*tausa + 4.259);
+   ep.semian_g = 0.02835 + (0.3817 + 0.17829 *
+         sin(2*GmatMathConstants::PI*tausa + 4.137)) * alpha;
+   ep.slat_season = sin(2.0*GmatMathConstants::PI*day_58 + 1.72);
+}
+
+
+//------------------------------------------------------------------------------
+// Real JacchiaRoberts(Real height, Real space_craft[3], const EpochTerms &ep)
+//------------------------------------------------------------------------------
+/**
+ * Obtain atmospheric density using the Jacchia-Roberts model
+ *  
+ *  
+ * Modifications:
+ * Name                Date      Description
+ * ------------------  --------  ------------------------------------------
+ * D. Ginn             01/26/94  DSPSE OPS:  Added new_file argument, logic
+ * W. Waktola          06/08/04  Code 583: Renamed to JacchiaRoberts()
+ * W. Waktola          12/28/04  Code 583: Removed FILE* tkptr
+ *
+ * @param height       Spacecraft height (km)
+ * @param space_craft  Spacecraft position (km, TOD GCI)
+ * @param ep           The epoch dependent terms, from PrepareEpochTerms()
+ *
+ * @return The density
+ */  
+//------------------------------------------------------------------------------
+Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3], 
+                                              const EpochTerms &ep) const
+{
+   #ifdef DEBUG_JR_DRAG
+      MessageInterface::ShowMessage
+         ("JacchiaRobertsAtmosphere::JacchiaRoberts(%15lf, [%15lf %15lf %15lf],"
+          "\n   [%15lf %15lf %15lf]\n",
+          height, space_craft[0], space_craft[1], space_craft[2],
+          ep.sun[0], ep.sun[1], ep.sun[2]);
+   #endif
+
+   Real density, temperature, t_500, t1, geo_lat;
+   TemperatureTerms tt;
+   const Real sun_dec = ep.sun_dec;
+
    // Geodetic latitude of spacecraft, in radians
    geo_lat = geoLat * GmatMathConstants::RAD_PER_DEG;
 
@@ -574,6 +605,7 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
       // March through the altitude regimes
       Real altitude = 80.0;
       Real rawdensity;
+      t1 = local_temperature(space_craft, ep, geo_lat);
       MessageInterface::ShowMessage("-----------------------------------\n");
       MessageInterface::ShowMessage("Altitude vs Density at temp\n");
       MessageInterface::ShowMessage("-----------------------------------\n");
@@ -585,15 +617,13 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
          }
          else if (altitude < (Real) 100.0)
          {
-            temperature = exotherm(space_craft, sun, &geo, altitude,
-                  sun_dec, geo_lat);
-            rawdensity = rho_100(altitude, temperature);
+            temperature = exotherm(t1, ep, altitude, tt);
+            rawdensity = rho_100(altitude, temperature, tt);
          }
          else if (height <= (Real) 125.0)
          {
-            temperature = exotherm(space_craft, sun, &geo, altitude,
-                  sun_dec, geo_lat);
-            rawdensity = rho_125(altitude, temperature);
+            temperature = exotherm(t1, ep, altitude, tt);
+            rawdensity = rho_125(altitude, temperature, tt);
          }
 
          MessageInterface::ShowMessage("%lf    %.10le\n", altitude, rawdensity);
@@ -608,9 +638,8 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
       altitude = 89.9995;
       for (Integer i = 0; i < 100; ++i)
       {
-         temperature = exotherm(space_craft, sun, &geo, altitude,
-               sun_dec, geo_lat);
-         rawdensity = rho_100(altitude, temperature);
+         temperature = exotherm(t1, ep, altitude, tt);
+         rawdensity = rho_100(altitude, temperature, tt);
          MessageInterface::ShowMessage("%lf    %.10le, (%.10le at 90 km)\n",
                altitude, rawdensity, density90);
          altitude += 0.00001;
@@ -618,16 +647,14 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
 
       // Check for the 100 km boundary
       MessageInterface::ShowMessage("-----------------------------------\n");
-      temperature = exotherm(space_craft, sun, &geo, altitude,
-            sun_dec, geo_lat);
-      Real density100 = rho_125(altitude, temperature);
+      temperature = exotherm(t1, ep, altitude, tt);
+      Real density100 = rho_125(altitude, temperature, tt);
 
       altitude = 99.9995;
       for (Integer i = 0; i < 100; ++i)
       {
-         temperature = exotherm(space_craft, sun, &geo, altitude,
-               sun_dec, geo_lat);
-         rawdensity = rho_100(altitude, temperature);
+         temperature = exotherm(t1, ep, altitude, tt);
+         rawdensity = rho_100(altitude, temperature, tt);
          MessageInterface::ShowMessage("%lf    %.10le  (%.10le at 100 km)\n",
                altitude, rawdensity, density100);
          altitude += 0.00001;
@@ -643,8 +670,9 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
    }
    else if (height < (Real) 100.0)
    {
-      temperature = exotherm(space_craft, sun, &geo, height, sun_dec, geo_lat);
-      density = rho_100(height, temperature);
+      t1 = local_temperature(space_craft, ep, geo_lat);
+      temperature = exotherm(t1, ep, height, tt);
+      density = rho_100(height, temperature, tt);
       #ifdef DEBUG_JR_DRAG
          MessageInterface::ShowMessage
             ("   Evaluating for height < 100;"
@@ -654,8 +682,9 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
    }
    else if (height <= (Real) 125.0)
    {
-      temperature = exotherm(space_craft, sun, &geo, height, sun_dec, geo_lat);
-      density = rho_125(height, temperature);
+      t1 = local_temperature(space_craft, ep, geo_lat);
+      temperature = exotherm(t1, ep, height, tt);
+      density = rho_125(height, temperature, tt);
       #ifdef DEBUG_JR_DRAG
          MessageInterface::ShowMessage
             ("   Evaluating for 100 < height < 125;"
@@ -665,10 +694,12 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
    }
    else if (height <= (Real) 2500.0)
    {
-      t_500 = exotherm(space_craft, sun, &geo, 500.0, sun_dec, geo_lat);
-      temperature = exotherm(space_craft, sun, &geo, height, sun_dec, geo_lat);
+      // The position dependent part of the temperature serves both heights
+      t1 = local_temperature(space_craft, ep, geo_lat);
+      t_500 = exotherm(t1, ep, 500.0, tt);
+      temperature = exotherm(t1, ep, height, tt);
  
-      density = rho_high(height, temperature, t_500, sun_dec, geo_lat);
+      density = rho_high(height, temperature, t_500, tt, sun_dec, geo_lat);
       #ifdef DEBUG_JR_DRAG
          MessageInterface::ShowMessage
             ("   Evaluating for 125 < height < 2500\n"
@@ -689,58 +720,38 @@ Real JacchiaRobertsAtmosphere::JacchiaRoberts(Real height, Real space_craft[3],
    #ifdef DEBUG_JR_DRAG
       MessageInterface::ShowMessage
          ("   Corrected density = %15.10le\n",
-          density * rho_cor(height, a1_time, geo_lat, &geo));
+          density * rho_cor(height, geo_lat, ep));
    #endif
-   return density * rho_cor(height, a1_time, geo_lat, &geo);
+   return density * rho_cor(height, geo_lat, ep);
 }
 
 
 //------------------------------------------------------------------------------
-//  Real exotherm(Real space_craft[2], Real sun[3], GEOPARMS *geo, Real height, 
-//                Real sun_dec, Real geo_lat)
+//  Real local_temperature(Real space_craft[3], const EpochTerms &ep,
+//                         Real geo_lat)
 //------------------------------------------------------------------------------
 /**
- *  Compute the temperature of earth's atmosphere and auxiliary temperature 
- *  related quantities at a given altitude.
+ *  Compute the part of the exospheric temperature that depends on the Sun and
+ *  spacecraft positions but not on the altitude.
  *
- *   constant variables -
- *      CON_C                Series expansion coefficients for height < 125 km
- *                           (in jr_drag header file)
- *      CON_L                Series expansion coefficients for height > 125 km
- *                           (in jr_drag header file)
- *
- *  @param space_craft[2]  Spacecraft position (km)
- *  @param sun             Sun unit vector
- *  @param geo             Geomagnetic index and minimum global exospheric
- *                         temperature (from tables)
- *  @param height          Spacecraft height (km)
- *  @param sun_dec         Sun declination
+ *  @param space_craft     Spacecraft position (km)
+ *  @param ep              The epoch dependent terms, including the Sun vector,
+ *                         its declination and the minimum global exospheric
+ *                         temperature
  *  @param geo_lat         Geodetic latitude of spacecraft (radians)
  *
- *  @return exotemp, the local exospheric temperature used in the model
+ *  @return t1, the temperature before the geomagnetic terms are added
  */ 
 //------------------------------------------------------------------------------
-Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3], 
-                                        GEOPARMS *geo,       Real height,
-                                        Real sun_dec,        Real geo_lat)
+Real JacchiaRobertsAtmosphere::local_temperature(Real space_craft[3],
+                                                 const EpochTerms &ep,
+                                                 Real geo_lat) const
 {
-   #ifdef DEBUG_JR_DRAG
-      MessageInterface::ShowMessage
-         ("   JacchiaRobertsAtmosphere::exotherm([%15lf, %15lf],\n"
-          "      [%15lf, %15lf, %15lf], geo = {%15lf, %15lf},\n"
-          "      %15lf, %15lf, %15lf)\n",
-          space_craft[0], space_craft[1], sun[0], sun[1], sun[2],
-          geo->tkp, geo->xtemp, height, sun_dec, geo_lat);
-   #endif
-   
-   Real exotemp, expkp, hour_angle, cross_denom;
-   Real theta, eta, tau, th22, t1, sun_denom, cos_denom;
-   Real c_star[5], aux[4][2];
-   Integer i;
-   const Integer na=5;
+   Real hour_angle, cross_denom;
+   Real theta, eta, tau, th22, t1, cos_denom;
+   const Real *sun = ep.sun;
 
    // Compute hour angle of the sun
-   sun_denom = sqrt(sun[0]*sun[0] + sun[1]*sun[1]);
    cross_denom = fabs(sun[0]*space_craft[1]-sun[1]*space_craft[0]);
    cos_denom = sqrt(space_craft[0]*space_craft[0] + 
          space_craft[1]*space_craft[1]);
@@ -750,11 +761,11 @@ Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3],
 
    hour_angle = ( (sun[0]*space_craft[1]-sun[1]*space_craft[0])/cross_denom)
                 *acos((sun[0]*space_craft[0]+sun[1]*space_craft[1])/
-                (sun_denom * cos_denom));
+                (ep.sun_denom * cos_denom));
 
    // Compute sun and spacecraft position dependent part of temperature
-   theta = 0.5 * fabs(geo_lat + sun_dec);
-   eta = 0.5 * fabs(geo_lat - sun_dec);
+   theta = 0.5 * fabs(geo_lat + ep.sun_dec);
+   eta = 0.5 * fabs(geo_lat - ep.sun_dec);
    tau = hour_angle - 0.64577182325 + 0.10471975512 *
       sin(hour_angle + 0.75049157836);
    if (tau < - GmatMathConstants::PI)
@@ -762,9 +773,8 @@ Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3],
    else if (tau > GmatMathConstants::PI)
       tau -= 2 * GmatMathConstants::PI;
    th22 = pow(sin(theta), 2.2);
-   t1 = (Real)geo->xtemp * (1.0 + 0.3*(th22 +pow(cos(0.5*tau),3.0) *
+   t1 = (Real)ep.geo.xtemp * (1.0 + 0.3*(th22 +pow(cos(0.5*tau),3.0) *
                                          (pow(cos(eta),2.2) - th22)));
-   expkp = exp(geo->tkp);
 
    #ifdef DEBUG_JR_DRAG
       MessageInterface::ShowMessage
@@ -773,9 +783,57 @@ Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3],
           "         eta = %15lf\n"
           "         tau = %15lf\n         th22 = %15lf\n"
           "         t1 = %15lf\n         expkp = %15lf\n",
-          sun_denom, hour_angle, theta, eta, tau, th22, t1, expkp);
+          ep.sun_denom, hour_angle, theta, eta, tau, th22, t1, ep.expkp);
    #endif
 
+   return t1;
+}
+
+
+//------------------------------------------------------------------------------
+//  Real exotherm(Real t1, const EpochTerms &ep, Real height,
+//                TemperatureTerms &tt)
+//------------------------------------------------------------------------------
+/**
+ *  Compute the temperature of earth's atmosphere and auxiliary temperature 
+ *  related quantities at a given altitude.
+ *
+ *   constant variables -
+ *      CON_C                Series expansion coefficients for height < 125 km
+ *                           (in jr_drag header file)
+ *      CON_L                Series expansion coefficients for height > 125 km
+ *                           (in jr_drag header file)
+ *
+ *  @param t1              Position dependent temperature, from
+ *                         local_temperature()
+ *  @param ep              The epoch dependent terms, including Kp
+ *  @param height          Spacecraft height (km)
+ *  @param tt              The auxiliary temperature quantities, set here for
+ *                         the density computations
+ *
+ *  @return exotemp, the local exospheric temperature used in the model
+ */ 
+//------------------------------------------------------------------------------
+Real JacchiaRobertsAtmosphere::exotherm(Real t1, const EpochTerms &ep,
+                                        Real height,
+                                        TemperatureTerms &tt) const
+{
+   #ifdef DEBUG_JR_DRAG
+      MessageInterface::ShowMessage
+         ("   JacchiaRobertsAtmosphere::exotherm(%15lf, geo = {%15lf, %15lf},"
+          "\n      %15lf)\n", t1, ep.geo.tkp, ep.geo.xtemp, height);
+   #endif
+   
+   Real exotemp;
+   Real c_star[5], aux[4][2];
+   Integer i;
+   const Integer na=5;
+   const GEOPARMS *geo = &ep.geo;
+   const Real expkp = ep.expkp;
+   Real &t_infinity = tt.t_infinity;
+   Real &tx = tt.tx;
+   Real &sum = tt.sum;
+
    // Compute the infinity based on altitude
    if (height < 200.0)
    {
@@ -829,22 +887,22 @@ Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3],
       aux[0][0] = 125.0;            // get 1st real root
       aux[0][1] = 0.0;
       roots(c_star, na, aux, 1);    
-      root1 = aux[0][0];
+      tt.root1 = aux[0][0];
 
-      deflate_polynomial(c_star, na, root1, c_star);
+      deflate_polynomial(c_star, na, tt.root1, c_star);
 
       aux[0][0] = 200.0;            // get 2nd real root
       aux[0][1] = 0.0;
       roots(c_star, na-1, aux, 1);    
-      root2 = aux[0][0];
+      tt.root2 = aux[0][0];
 
-      deflate_polynomial(c_star, na-1, root2, c_star);
+      deflate_polynomial(c_star, na-1, tt.root2, c_star);
 
       aux[0][0] = 10.0;            // get remaining roots
       aux[0][1] = 125.0;
       roots(c_star, na-2, aux, 1);    
-      x_root = aux[0][0];
-      y_root = fabs(aux[0][1]);
+      tt.x_root = aux[0][0];
+      tt.y_root = fabs(aux[0][1]);
    }
 
    return exotemp;
@@ -852,7 +910,7 @@ Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3],
 
 
 //------------------------------------------------------------------------------
-//  Real rho_100(Real height, Real temperature)
+//  Real rho_100(Real height, Real temperature, const TemperatureTerms &tt)
 //------------------------------------------------------------------------------
 /**
  *  Compute density of the atmosphere between 90 and 100 km using the 
@@ -860,12 +918,18 @@ Real JacchiaRobertsAtmosphere::exotherm(Real space_craft[2], Real sun[3],
  *  
  *  @param height      Spacecraft altitude (km)
  *  @param temperature Exospheric temperature at spacecraft altitude(degrees K)
+ *  @param tt          Auxiliary temperature quantities from exotherm()
  *
  *  @return The density
  */
 //------------------------------------------------------------------------------
-Real JacchiaRobertsAtmosphere::rho_100(Real height, Real temperature)
+Real JacchiaRobertsAtmosphere::rho_100(Real height, Real temperature,
+                                       const TemperatureTerms &tt) const
 {
+   const Real root1 = tt.root1, root2 = tt.root2;
+   const Real x_root = tt.x_root, y_root = tt.y_root;
+   const Real tx = tt.tx;
+
    Real m_poly, s_poly, f2, p1, p2, p3, p4, p5, p6, b[6];
    Real x_star, u[2], w[2], v, factor_k, roots_2, log_f1;
    Integer i;
@@ -979,7 +1043,7 @@ Real JacchiaRobertsAtmosphere::rho_100(Real height, Real temperature)
 
 
 //------------------------------------------------------------------------------
-//  Real rho_125(Real height, Real temperature)
+//  Real rho_125(Real height, Real temperature, const TemperatureTerms &tt)
 //------------------------------------------------------------------------------
 /**
  *  Compute density of the atmosphere between 100 and 125 km
@@ -987,12 +1051,18 @@ Real JacchiaRobertsAtmosphere::rho_100(Real height, Real temperature)
  *  
  *  @param height       Spacecraft altitude (km)
  *  @param temperature  Exospheric temperature at spacecraft (degrees K)
+ *  @param tt           Auxiliary temperature quantities from exotherm()
  *
  *  @return The density
  */
 //------------------------------------------------------------------------------
-Real JacchiaRobertsAtmosphere::rho_125(Real height, Real temperature)
+Real JacchiaRobertsAtmosphere::rho_125(Real height, Real temperature,
+                                       const TemperatureTerms &tt) const
 {
+   const Real root1 = tt.root1, root2 = tt.root2;
+   const Real x_root = tt.x_root, y_root = tt.y_root;
+   const Real t_infinity = tt.t_infinity, tx = tt.tx;
+
    Real f4, q1, q2, q3, q4, q5, q6;
    Real rho_prime, x_star, u[2], w[2], v, factor_k, t_100;
    Real rho_sum, rhoi, roots_2, log_f3;
@@ -1076,28 +1146,28 @@ Real JacchiaRobertsAtmosphere::rho_125(Real height, Real temperature)
 
 
 //------------------------------------------------------------------------------
-//  Real rho_cor(Real height, Real a1_time, Real geo_lat, GEOPARMS *geo)
+//  Real rho_cor(Real height, Real geo_lat, const EpochTerms &ep)
 //------------------------------------------------------------------------------
 /**
  * Calculates the density correction factor
  *
  * @param height       Spacecraft altitude (km)                 I
- * @param a1_time      The A.1 epoch
  * @param geo_lat      Geodetic latitude of spacecraft (radians)
- * @param geo          The geomagnetic parameters used in the model
+ * @param ep           The epoch dependent terms: Kp and the semiannual and
+ *                     seasonal factors
  *
  * @return The atmospheric density at the spacecraft's location */
 //------------------------------------------------------------------------------
-Real JacchiaRobertsAtmosphere::rho_cor(Real height, Real a1_time, Real geo_lat, 
-                                       GEOPARMS *geo)
+Real JacchiaRobertsAtmosphere::rho_cor(Real height, Real geo_lat,
+                                       const EpochTerms &ep) const
 {
-   Real geo_cor, semian_cor, slat_cor, f, g, day_58, tausa, alpha;
+   Real geo_cor, semian_cor, slat_cor, f, g;
    Real sin_lat, eta_lat;
 
    // Compute geomagnetic activity correction
    if (height < 200.0)
    {
-      geo_cor = 0.012 * geo->tkp + 0.000012 * exp(geo->tkp);
+      geo_cor = 0.012 * ep.geo.tkp + 0.000012 * ep.expkp;
    }
    else
    {
@@ -1107,17 +1177,12 @@ Real JacchiaRobertsAtmosphere::rho_cor(Real height, Real a1_time, Real geo_lat,
    // Compute semiannual variation correction
    f = (5.876e-7 * pow(height, 2.331) + 0.06328) *
       exp(-0.002868 * height);
-   day_58 = (a1_time - 6204.5)/365.2422; // @todo - should this use GmatConstants value?
-   tausa = day_58 + 0.09544 * (
-         pow( 0.5*(1.0 + sin(2*GmatMathConstants::PI*day_58 +6.035)), 1.65 )  - 0.5);
-   alpha = sin(4.0*GmatMathConstants::PI*tausa + 4.259);
-   g = 0.02835 + (0.3817 + 0.17829 * sin(2*GmatMathConstants::PI*tausa + 4.137)) *
-         alpha;
+   g = ep.semian_g;
    semian_cor = f * g;
 
    // Compute seasonal latitudinal variation
    sin_lat = sin(geo_lat);
-   eta_lat = sin(2.0*GmatMathConstants::PI*day_58 + 1.72) * sin_lat * fabs(sin_lat);
+   eta_lat = ep.slat_season * sin_lat * fabs(sin_lat);
    slat_cor = 0.014 * (height - 90.0) * eta_lat *
       exp(-0.0013 * (height - 90.0) * (height - 90.0));
 
@@ -1131,8 +1196,8 @@ Real JacchiaRobertsAtmosphere::rho_cor(Real height, Real a1_time, Real geo_lat,
 
 
 //------------------------------------------------------------------------------
-//  Real rho_high(Real height, Real temperature, Real t_500, Real sun_dec, 
-//                Real geo_lat)
+//  Real rho_high(Real height, Real temperature, Real t_500,
+//                const TemperatureTerms &tt, Real sun_dec, Real geo_lat)
 //------------------------------------------------------------------------------
 /**
  * Compute density of the atmosphere between 125 and 2500 km using the 
@@ -1141,6 +1206,8 @@ Real JacchiaRobertsAtmosphere::rho_cor(Real height, Real a1_time, Real geo_lat,
  * @param height       Spacecraft altitude (km)                 I
  * @param temperature  Exospheric temperature at spacecraft altitude(degrees K)
  * @param t_500        Exospheric temperature at altitude of 500 km (degrees K)
+ * @param tt           Auxiliary temperature quantities from exotherm() at the
+ *                     spacecraft altitude
  * @param sun_dec      Declination of the sun in TOD coordinates (radians)
  * @param geo_lat      Geodetic latitude of spacecraft (radians)
  *
@@ -1148,8 +1215,10 @@ Real JacchiaRobertsAtmosphere::rho_cor(Real height, Real a1_time, Real geo_lat,
  */
 //------------------------------------------------------------------------------
 Real JacchiaRobertsAtmosphere::rho_high(Real height, Real temperature, 
-                                        Real t_500, Real sun_dec, Real geo_lat)
+                                        Real t_500, const TemperatureTerms &tt,
+                                        Real sun_dec, Real geo_lat) const
 {
+   const Real t_infinity = tt.t_infinity, tx = tt.tx, sum = tt.sum;
    Real f, log_di, gamma, exp1, rho_out, r;
    Real di = 0;
    Integer i, j;
@@ -1264,7 +1333,7 @@ Real JacchiaRobertsAtmosphere::rho_high(Real height, Real temperature,
  */
 //------------------------------------------------------------------------------
 void JacchiaRobertsAtmosphere::roots(Real a[], Integer na, Real croots[][2], 
-                                     Integer irl)
+                                     Integer irl) const
 {
    Integer i, ir, n1, n2, j;
    Real z[2], zs[2], cb[2], cc[2], dif, denom, temp;
@@ -1368,7 +1437,7 @@ void JacchiaRobertsAtmosphere::roots(Real a[], Integer na, Real croots[][2],
  */                                                                                     
 //------------------------------------------------------------------------------
 void JacchiaRobertsAtmosphere::deflate_polynomial(Real c[], Integer n, 
-                                                  Real root, Real c_new[])
+                                                  Real root, Real c_new[]) const
 {
     short i;
     Real sum, save;
@@ -55,16 +55,40 @@ public:
    virtual void SetCentralBody(CelestialBody *cb);
 
 private:
-   ///  Auxiliary temperature related quantities
-   Real root1;
-   Real root2;
-   Real x_root;
-   Real y_root;
+   /// Terms of the model that depend only on the epoch and the Sun direction
+   struct EpochTerms
+   {
+      /// Minimum global exospheric temperature and Kp
+      GEOPARMS geo;
+      /// exp(Kp)
+      Real expkp;
+      /// Sun unit vector
+      Real sun[3];
+      /// Declination of the Sun
+      Real sun_dec;
+      /// Length of the equatorial projection of the Sun vector
+      Real sun_denom;
+      /// Semiannual variation factor, g(t) in the density correction
+      Real semian_g;
+      /// Seasonal factor of the latitudinal density variation
+      Real slat_season;
+   };
+
+   /// Temperature results for one position, used by the density computations
+   struct TemperatureTerms
+   {
+      ///  Auxiliary temperature related quantities
+      Real root1;
+      Real root2;
+      Real x_root;
+      Real y_root;
+
+      ///  Intermediate temperature results
+      Real t_infinity;
+      Real tx;
+      Real sum;
+   };
 
-   ///  Some intermediate temperature results used by density computations
-   Real t_infinity;
-   Real tx;
-   Real sum;
    Real cbPolarRadius;
    Real cbPolarSquared;
 
@@ -103,23 +127,26 @@ private:
    // Constants required for altitude greater than 125 km
    /// Polynomial coefficients for constituent densities of each atmospheric gas
    static const Real CON_DEN[5][7];
-   /// Struct used to hold F107, Kp, temp
-   GEOPARMS geo;
-
 
 
-   Real JacchiaRoberts(Real height, Real space_craft[3], Real sun[3],
-                      Real a1_time);
-   Real exotherm(Real space_craft[3], Real sun[3], GEOPARMS *geo,
-                       Real height, Real sun_dec, Real geo_lat);
-   Real rho_100(Real height, Real temperature);
-   Real rho_125(Real height, Real temperature);
-   Real rho_cor(Real height, Real a1_time, Real geo_lat,
-                      GEOPARMS *geo);
+   void PrepareEpochTerms(Real a1_time, Real sun[3], EpochTerms &ep);
+   Real JacchiaRoberts(Real height, Real space_craft[3],
+                      const EpochTerms &ep) const;
+   Real local_temperature(Real space_craft[3], const EpochTerms &ep,
+                          Real geo_lat) const;
+   Real exotherm(Real t1, const EpochTerms &ep, Real height,
+                 TemperatureTerms &tt) const;
+   Real rho_100(Real height, Real temperature,
+                const TemperatureTerms &tt) const;
+   Real rho_125(Real height, Real temperature,
+                const TemperatureTerms &tt) const;
+   Real rho_cor(Real height, Real geo_lat, const EpochTerms &ep) const;
    Real rho_high(Real height, Real temperature, Real t_500,
-                       Real sun_dec, Real geo_lat);
-   void roots(Real a[], Integer na, Real croots[][2], Integer irl);
-   void deflate_polynomial(Real c[], Integer n, Real root, Real c_new[]);
+                 const TemperatureTerms &tt, Real sun_dec,
+                 Real geo_lat) const;
+   void roots(Real a[], Integer na, Real croots[][2], Integer irl) const;
+   void deflate_polynomial(Real c[], Integer n, Real root,
+                           Real c_new[]) const;
    Real length_of(Real v[3]);
    Real dot_product(Real a[3] , Real b[3]);
 };
@@ -43,17 +43,6 @@
 
 //#define DUMP_FLUX_DATA
 
-#ifndef __SKIP_MSISE90__
-extern "C" 
-{ 
-   #ifdef USE_64_BIT_LONGS
-      void gtd6_(long int*,float*,float*,float*,float*,float*,float*,float*,float*,long int*,float*,float*);
-   #else
-      void gtd6_(int*,float*,float*,float*,float*,float*,float*,float*,float*,int*,float*,float*);
-   #endif
-}
-#endif
-
 //#define DEBUG_MSISE90_ATMOSPHERE
 
 #ifdef DEBUG_MSISE90_ATMOSPHERE
@@ -79,6 +68,7 @@ Msise90Atmosphere::Msise90Atmosphere(const std::string &name) :
     for (Integer i = 0; i < 7; i++)
        ap[i] = 0.0;
 
+    msise90_init(&msisState);
 }
 
 //------------------------------------------------------------------------------
@@ -107,6 +97,8 @@ Msise90Atmosphere::Msise90Atmosphere(const Msise90Atmosphere& msise) :
 {
    for (Integer i = 0; i < 7; i++)
       ap[i] = msise.ap[i];
+
+   msise90_init(&msisState);
 }
 
 //------------------------------------------------------------------------------
@@ -132,6 +124,9 @@ Msise90Atmosphere& Msise90Atmosphere::operator=(const Msise90Atmosphere& msise)
    
    for (Integer i = 0; i < 7; i++)
       ap[i] = msise.ap[i];
+
+   // The model caches are rebuilt from the next call's inputs
+   msise90_init(&msisState);
       
    return *this;
 }
@@ -210,6 +205,12 @@ bool Msise90Atmosphere::Density(Real *pos, Real *density, Real epoch,
       temp[j]  = 0.0;
       xtemp[j] = (float)temp[j];
    }
+
+   // The time, flux and Ap terms are shared by all of the states
+   #ifndef __SKIP_MSISE90__
+      msise90_set_epoch(&msisState, xyd, xsod, xf107a, xf107, xap);
+   #endif
+
    for (i = 0; i < count; ++i) 
    {
       i6 = i*6;
@@ -287,19 +288,12 @@ bool Msise90Atmosphere::Density(Real *pos, Real *density, Real epoch,
       
       #ifndef __SKIP_MSISE90__
          #ifdef DEBUG_MSISE90_ATMOSPHERE
-            MessageInterface::ShowMessage("About to call gtd6_ ...\n");
-         #endif
-         #ifdef USE_64_BIT_LONGS
-            long int xydLong = (long int) xyd;
-            long int xmassLong = (long int) xmass;
-            gtd6_(&xydLong,&xsod,&xalt,&xlat,&xlon,&xlst,&xf107a,&xf107,&xap[0],&xmassLong,
-                  &xden[0],&xtemp[0]);
-         #else
-            gtd6_(&xyd,&xsod,&xalt,&xlat,&xlon,&xlst,&xf107a,&xf107,&xap[0],&xmass,
-                  &xden[0],&xtemp[0]);
+            MessageInterface::ShowMessage("About to call msise90_density ...\n");
          #endif
+         msise90_density(&msisState, xalt, xlat, xlon, xlst, xmass, &xden[0],
+               &xtemp[0]);
          #ifdef DEBUG_MSISE90_ATMOSPHERE
-            MessageInterface::ShowMessage("DONE calling gtd6_ ...\n");
+            MessageInterface::ShowMessage("DONE calling msise90_density ...\n");
          #endif
       #endif
       
@@ -37,6 +37,7 @@
 
 #include "AtmosphereModel.hpp"
 #include "TimeTypes.hpp"
+#include "msise90_sub.hpp"
  
 class GMAT_API Msise90Atmosphere : public AtmosphereModel
 {
@@ -54,6 +55,8 @@ public:
 
 protected:
    Integer                 mass;
+   /// Model state and per epoch terms owned by this instance
+   msise90_context         msisState;
 };
 
 #endif // Msise90Atmosphere_hpp
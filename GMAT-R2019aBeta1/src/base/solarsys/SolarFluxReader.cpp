@@ -53,6 +53,10 @@
 #endif
 
 
+/// Three days of padding covers the 57 hours of Ap history MSISE needs
+const Integer SolarFluxReader::AP_HISTORY_PAD = 24;
+
+
 //------------------------------------------------------------------------------
 // SolarFluxReader::FluxData struct used for holding the records
 //------------------------------------------------------------------------------
@@ -182,7 +186,9 @@ SolarFluxReader::SolarFluxReader():
    warnEpochAfter    (true),
    f107RefEpoch      (18408.0),  // 5/31/91, epoch when the station moved (Vallado)
    interpolateFlux   (true),
-   interpolateGeo    (false)
+   interpolateGeo    (false),
+   apCacheEpoch      (-1.0),
+   kpCacheEpoch      (-1.0)
 {
    if (!obsFluxData.empty())
       obsFluxData.clear();
@@ -230,17 +236,23 @@ SolarFluxReader::SolarFluxReader(const SolarFluxReader &sfr) :
    warnEpochAfter    (true),
    f107RefEpoch      (sfr.f107RefEpoch),
    interpolateFlux   (sfr.interpolateFlux),
-   interpolateGeo    (sfr.interpolateGeo)
+   interpolateGeo    (sfr.interpolateGeo),
+   apCacheEpoch      (-1.0),
+   kpCacheEpoch      (-1.0)
 {
    obsFileName = sfr.obsFileName;
    predictFileName = sfr.predictFileName;
    obsFluxData = sfr.obsFluxData;
    predictFluxData = sfr.predictFluxData;
+   apHistory = sfr.apHistory;
+   predictDayIndex = sfr.predictDayIndex;
    beg_ObsTag = sfr.beg_ObsTag;
    end_ObsTag = sfr.end_ObsTag;
    begObs = sfr.begObs;
    endObs = sfr.endObs;
    begData = sfr.begData;
+
+   BuildSchattenTables();
 }
 
 
@@ -279,6 +291,11 @@ SolarFluxReader& SolarFluxReader::operator=(const SolarFluxReader &sfr)
    interpolateFlux = sfr.interpolateFlux;
    interpolateGeo = sfr.interpolateGeo;
 
+   apHistory = sfr.apHistory;
+   predictDayIndex = sfr.predictDayIndex;
+   BuildSchattenTables();
+   ClearCache();
+
    return *this;
 }
 
@@ -340,6 +357,12 @@ bool SolarFluxReader::LoadFluxData(const std::string &obsFile, const std::string
 
    obsFluxData.clear();
    predictFluxData.clear();
+   apHistory.clear();
+   predictDayIndex.clear();
+   predictF107.clear();
+   predictAp.clear();
+   predictKp.clear();
+   ClearCache();
 
    FileManager *fm = FileManager::Instance();
 
@@ -583,6 +606,8 @@ bool SolarFluxReader::LoadObsData()
 
       for (Integer i = 0; i < obsFluxData.size(); ++i)
          obsFluxData[i].id = i;
+
+      BuildObsTables();
    }
 
    return true;
@@ -734,11 +759,101 @@ bool SolarFluxReader::LoadPredictData()
          predictFluxData[i].index = (Integer)(predictFluxData[i].epoch - predictStart);
          predictFluxData[i].id = i;
       }
+
+      BuildPredictTables();
+      BuildSchattenTables();
    }
 
    return true;
 }
 
+
+//------------------------------------------------------------------------------
+// void BuildObsTables()
+//------------------------------------------------------------------------------
+/**
+ * Builds the lookup table for the observed data.
+ *
+ * The 3-hourly Ap values of all records are laid end to end.  PrepareApData
+ * reads the Ap history for an epoch from a single position in this array
+ * rather than from the records of the preceding days.  Padding ahead of the
+ * first value stands in for the days before the file starts.
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::BuildObsTables()
+{
+   apHistory.assign(AP_HISTORY_PAD + 8 * obsFluxData.size(),
+         obsFluxData[0].ap[0]);
+
+   for (UnsignedInt i = 0; i < obsFluxData.size(); ++i)
+      for (Integer j = 0; j < 8; ++j)
+         apHistory[AP_HISTORY_PAD + 8 * i + j] = obsFluxData[i].ap[j];
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildPredictTables()
+//------------------------------------------------------------------------------
+/**
+ * Builds the day by day index into the predict records.
+ *
+ * Entry d is the last record starting at or before predictStart + d, so that
+ * GetInputs finds the record for an epoch by indexing, then stepping forward
+ * at most once when a record starts during that day.
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::BuildPredictTables()
+{
+   Integer dayCount = (Integer)(predictEnd - predictStart) + 1;
+   predictDayIndex.assign(dayCount, 0);
+
+   Integer record = 0, last = predictFluxData.size() - 1;
+   for (Integer d = 0; d < dayCount; ++d)
+   {
+      while ((record < last) &&
+             (predictFluxData[record+1].epoch <= predictStart + d))
+         ++record;
+      predictDayIndex[d] = record;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void BuildSchattenTables()
+//------------------------------------------------------------------------------
+/**
+ * Pulls the F10.7 and Ap for the selected Schatten timing and magnitude out of
+ * the predict records, and converts the Ap values to Kp.
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::BuildSchattenTables()
+{
+   predictF107.resize(predictFluxData.size());
+   predictAp.resize(predictFluxData.size());
+   predictKp.resize(predictFluxData.size());
+
+   for (UnsignedInt i = 0; i < predictFluxData.size(); ++i)
+   {
+      predictF107[i] = predictFluxData[i].F107a[schattenFluxIndex];
+      predictAp[i]   = predictFluxData[i].apSchatten[schattenApIndex];
+      predictKp[i]   = ConvertApToKp(predictAp[i]);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void ClearCache()
+//------------------------------------------------------------------------------
+/**
+ * Discards the buffered PrepareApData and PrepareKpData results.
+ */
+//------------------------------------------------------------------------------
+void SolarFluxReader::ClearCache()
+{
+   apCacheEpoch = -1.0;
+   kpCacheEpoch = -1.0;
+}
+
 //------------------------------------------------------------------------------
 // FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
 //------------------------------------------------------------------------------
@@ -811,15 +926,15 @@ SolarFluxReader::FluxData SolarFluxReader::GetInputs(GmatEpoch epoch)
          else
          {
             // Look up the data for epoch
-            for (UnsignedInt i = 1; i < predictFluxData.size(); ++i)
-            {
-               if (predictFluxData[i].epoch > epoch)
-               {
-                  fD = predictFluxData[i-1];
-                  fD.index = -1;
-                  break;
-               }
-            }
+            Integer day = (Integer)(epoch - predictStart);
+            if (day >= (Integer)predictDayIndex.size())
+               day = predictDayIndex.size() - 1;
+            Integer i = predictDayIndex[day];
+            while ((i < (Integer)predictFluxData.size() - 1) &&
+                   (predictFluxData[i+1].epoch <= epoch))
+               ++i;
+            fD = predictFluxData[i];
+            fD.index = -1;
          }
       }
       else // Off the CSSI file and there is no predict data read
@@ -919,7 +1034,14 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       MessageInterface::ShowMessage("Reading flux data; epoch = %12lf, "
          "fD.Epoch = %.12lf, index = %d\n", epoch, fD.epoch, fD.index);
    #endif
-   
+
+   // Repeated calls at an epoch, e.g. for each spacecraft, reuse the result
+   if (epoch == apCacheEpoch)
+   {
+      fD = apCache;
+      return;
+   }
+
    Integer f107index = fD.index;
 
    if (fD.isObsData)
@@ -939,48 +1061,21 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       if (subIndex >= 8) // Off the end of the array
          subIndex = 7;
 
-      Real apValues[32];
+      // Epochs (slightly) ahead of the record start use the previous day
+      if (subIndex < 0)
+         subIndex = -1;
+
+      // Ap history, newest first, from the current 3 hour slot back through
+      // the 3 preceding days
+      Real apValues[20];
       Integer i = 0,j = 0;
 
       #ifdef DEBUG_FILE_INDEXING
          MessageInterface::ShowMessage("   subindex = %d\n", subIndex);
       #endif
-      for (i = subIndex, j = 0; i >= 0; --i, ++j)
-         apValues[j] = fD.ap[i];
-      if (fD.index > 0)
-      {
-         FluxData fD_OneBefore = obsFluxData[fD.index - 1];
-         for (i = 7; i >= 0; j++,i--)
-            apValues[j] = fD_OneBefore.ap[i];
-      }
-      else
-      {
-         for (i = 7; i >= 0; j++,i--)
-            apValues[j] = obsFluxData[0].ap[0];
-      }
-      if (fD.index > 1)
-      {
-         FluxData fD_TwoBefore = obsFluxData[fD.index - 2];
-         for (i = 7; i >= 0; j++,i--)
-            apValues[j] = fD_TwoBefore.ap[i];
-      }
-      else
-      {
-         for (i = 7; i >= 0; j++,i--)
-            apValues[j] = obsFluxData[0].ap[0];
-      }
-
-      if ( fD.index > 2)
-      {
-         FluxData fD_ThreeBefore = obsFluxData[fD.index - 3];
-         for (i = 7; i >= 0; j++,i--)
-            apValues[j] = fD_ThreeBefore.ap[i];
-      }
-      else
-      {
-         for (i = 7; i >= 0; j++,i--)
-            apValues[j] = obsFluxData[0].ap[0];
-      }
+      const Real *apNow = &apHistory[AP_HISTORY_PAD + 8 * fD.index + subIndex];
+      for (j = 0; j < 20; ++j)
+         apValues[j] = apNow[-j];
 
 
       for (i = 0; i < 7; i++)
@@ -1064,11 +1159,11 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
          Real vals[2];
          Real eps[2];
 
-         vals[0] = fD.F107a[schattenFluxIndex];
+         vals[0] = predictF107[fD.id];
          eps[0]  = fD.epoch;
          if (fD.id < predictFluxData.size()-1)
          {
-            vals[1] = predictFluxData[fD.id+1].F107a[schattenFluxIndex];
+            vals[1] = predictF107[fD.id+1];
             eps[1]  = predictFluxData[fD.id+1].epoch;
          }
          else
@@ -1093,22 +1188,22 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       }
       else
       {
-         fD.obsF107     = fD.F107a[schattenFluxIndex];
-         fD.obsCtrF107a = fD.F107a[schattenFluxIndex];
+         fD.obsF107     = predictF107[fD.id];
+         fD.obsCtrF107a = predictF107[fD.id];
       }
 
       if (interpolateGeo)
       {
-         Real apInterp = fD.apSchatten[schattenApIndex];
+         Real apInterp = predictAp[fD.id];
 
          Real vals[2];
          Real eps[2];
 
-         vals[0] = fD.apSchatten[schattenApIndex];
+         vals[0] = predictAp[fD.id];
          eps[0]  = fD.epoch;
          if (fD.id < predictFluxData.size()-1)
          {
-            vals[1] = predictFluxData[fD.id+1].apSchatten[schattenApIndex];
+            vals[1] = predictAp[fD.id+1];
             eps[1]  = predictFluxData[fD.id+1].epoch;
          }
          else
@@ -1136,10 +1231,13 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       else
       {
          for (Integer i = 0; i < 8; i++)
-            fD.ap[i] = fD.apSchatten[schattenApIndex];
+            fD.ap[i] = predictAp[fD.id];
       }
    }
 
+   apCache = fD;
+   apCacheEpoch = epoch;
+
 #ifdef DUMP_FLUX_DATA
    MessageInterface::ShowMessage("%.12lf ==> %lf  %lf  [%lf %lf %lf %lf %lf %lf %lf %lf]\n",
          epoch, fD.obsF107, fD.obsCtrF107a, fD.ap[0], fD.ap[1], fD.ap[2],
@@ -1180,11 +1278,17 @@ void SolarFluxReader::PrepareApData(SolarFluxReader::FluxData &fD, GmatEpoch epo
 //------------------------------------------------------------------------------
 void SolarFluxReader::PrepareKpData(SolarFluxReader::FluxData &fD, GmatEpoch epoch )
 {
+   // Repeated calls at an epoch reuse the result
+   if (epoch == kpCacheEpoch)
+   {
+      fD = kpCache;
+      return;
+   }
+
    Integer f107index = fD.index;
    if (fD.isObsData)
    {
       f107index = fD.id;
-      FluxData fD_OneBefore = obsFluxData[fD.id - 1];
 
       // Fill in fD.kp[0] so it contains the reading at epoch - 6.7 Hrs, per
       // Vallado and Finkleman
@@ -1208,8 +1312,8 @@ void SolarFluxReader::PrepareKpData(SolarFluxReader::FluxData &fD, GmatEpoch epo
       if (subIndex > 0)
          fD.kp[0] = fD.kp[subIndex];
 
-      if (subIndex < 0)
-         fD.kp[0] = fD_OneBefore.kp[8+subIndex];
+      if ((subIndex < 0) && (fD.id > 0))
+         fD.kp[0] = obsFluxData[fD.id - 1].kp[8+subIndex];
 
 //      if (interpolateFlux && (epoch >= historicStart))
 //      {
@@ -1279,13 +1383,15 @@ void SolarFluxReader::PrepareKpData(SolarFluxReader::FluxData &fD, GmatEpoch epo
    }
    else if (fD.index == -1) // predict data
    {
-      fD.obsF107     = fD.F107a[schattenFluxIndex];
-      fD.obsCtrF107a = fD.F107a[schattenFluxIndex];
-      Real kp = ConvertApToKp(fD.apSchatten[schattenApIndex]);
+      fD.obsF107     = predictF107[fD.id];
+      fD.obsCtrF107a = predictF107[fD.id];
       for (Integer i = 0; i < 8; i++)
-         fD.kp[i] = kp;
+         fD.kp[i] = predictKp[fD.id];
    }
 
+   kpCache = fD;
+   kpCacheEpoch = epoch;
+
 #ifdef DUMP_FLUX_DATA
    MessageInterface::ShowMessage("%.12lf ==> %lf  %lf  [%lf %lf %lf %lf %lf %lf %lf %lf]\n",
          epoch, fD.obsF107, fD.obsCtrF107a, fD.kp[0], fD.kp[1], fD.kp[2],
@@ -1549,6 +1655,9 @@ void SolarFluxReader::SetSchattenFlags(Integer timingSet, Integer magnitudeSet)
       schattenApIndex = 2;
    }
 
+   BuildSchattenTables();
+   ClearCache();
+
    #ifdef DEBUG_FIRSTFEW_READS
       numberReadIndex = 0;
    #endif
@@ -129,8 +129,35 @@ private:
    /// Flag used to toggle interpolation for the geomagnetic index (predict only)
    bool interpolateGeo;
 
+   /// Number of padding values ahead of the first observed Ap
+   static const Integer AP_HISTORY_PAD;
+   /// Observed 3-hourly Ap values, oldest first, after AP_HISTORY_PAD copies
+   /// of the first value
+   std::vector<Real> apHistory;
+   /// Index of the predict record in effect at the start of each day
+   std::vector<Integer> predictDayIndex;
+   /// Predicted F10.7 for the selected Schatten timing and magnitude
+   std::vector<Real> predictF107;
+   /// Predicted Ap for the selected Schatten timing
+   std::vector<Real> predictAp;
+   /// Kp matching predictAp
+   std::vector<Real> predictKp;
+
+   /// Epoch of the buffered PrepareApData result
+   GmatEpoch apCacheEpoch;
+   /// The buffered PrepareApData result
+   FluxData apCache;
+   /// Epoch of the buffered PrepareKpData result
+   GmatEpoch kpCacheEpoch;
+   /// The buffered PrepareKpData result
+   FluxData kpCache;
+
    bool LoadObsData();
    bool LoadPredictData();
+   void BuildObsTables();
+   void BuildPredictTables();
+   void BuildSchattenTables();
+   void ClearCache();
    Real ConvertApToKp(Real ap);
 
 public:
@@ -10,145 +10,51 @@
 		http://www.netlib.org/f2c/libf2c.zip
 */
 
+/* GMAT Change: Made reentrant.  The COMMON blocks and SAVEd locals of the
+   FORTRAN code are members of an msise90_context (see msise90_sub.hpp), and
+   the routines that used them take the context as their first argument.
+   The altitude independent terms of GLOBE6 and GLOB6S are evaluated once
+   per epoch by msise90_set_epoch.  GTD6, GHP6 and METER6 keep their FORTRAN
+   interfaces on a context of their own. */
+
+#include <string.h>
 #include "f2c.h"
+#include "msise90_sub.hpp"
 
 /* Common Block Declarations */
 
-struct {
-    real tlb, s, db04, db16, db28, db32, db40, db48, db01, za, t0, z0, g0, rl,
-	     dd, db14, tr12;
-} gts3c_;
-
-#define gts3c_1 gts3c_
-
-struct {
-    real tn1[5], tn2[4], tn3[5], tgn1[2], tgn2[2], tgn3[2];
-} meso6_;
-
-#define meso6_1 meso6_
+#define gts3c_1 (ctx->gts3c)
+#define meso6_1 (ctx->meso6)
+#define csw_1 (ctx->csw)
+#define dmix_1 (ctx->dmix)
+#define parmb_1 (ctx->parmb)
+#define metsel_1 (*ctx)
+#define ttest_2 (ctx->ttest)
+#define lpoly_1 (ctx->lpoly)
 
 struct lower6_1_ {
     real ptm[10], pdm[80]	/* was [10][8] */;
 };
 
-#define lower6_1 (*(struct lower6_1_ *) &lower6_)
+#define lower6_1 (*(const struct lower6_1_ *) &lower6_)
 
 struct parm6_1_ {
     real pt[150], pd[1350]	/* was [150][9] */, ps[150], pdl[50]	/* 
 	    was [25][2] */, ptl[400]	/* was [100][4] */, pma[1000]	/* 
 	    was [100][10] */;
 };
-struct parm6_2_ {
-    real pt1[50], pt2[50], pt3[50], pa1[50], pa2[50], pa3[50], pb1[50], pb2[
-	    50], pb3[50], pc1[50], pc2[50], pc3[50], pd1[50], pd2[50], pd3[50]
-	    , pe1[50], pe2[50], pe3[50], pf1[50], pf2[50], pf3[50], pg1[50], 
-	    pg2[50], pg3[50], ph1[50], ph2[50], ph3[50], pi1[50], pi2[50], 
-	    pi3[50], pj1[50], pj2[50], pj3[50], pk1[50], pl1[50], pl2[50], 
-	    pm1[50], pm2[50], pn1[50], pn2[50], po1[50], po2[50], pp1[50], 
-	    pp2[50], pq1[50], pq2[50], pr1[50], pr2[50], ps1[50], ps2[50], 
-	    pu1[50], pu2[50], pv1[50], pv2[50], pw1[50], pw2[50], px1[50], 
-	    px2[50], py1[50], py2[50], pz1[50], pz2[50];
-};
-
-#define parm6_1 (*(struct parm6_1_ *) &parm6_)
-#define parm6_2 (*(struct parm6_2_ *) &parm6_)
-
-struct {
-    integer isd[3], ist[2], nam[2];
-} datim6_;
-
-#define datim6_1 datim6_
-
-struct {
-    integer isdate[3], istime[2], name__[2];
-} datime_;
-
-#define datime_1 datime_
 
-struct {
-    real sw[25];
-    integer isw;
-    real swc[25];
-} csw_;
-
-#define csw_1 csw_
+#define parm6_1 (*(const struct parm6_1_ *) &parm6_)
 
 struct mavg6_1_ {
     real pavgm[10];
 };
 
-#define mavg6_1 (*(struct mavg6_1_ *) &mavg6_)
-
-struct {
-    real dm04, dm16, dm28, dm32, dm40, dm01, dm14;
-} dmix_;
-
-#define dmix_1 dmix_
-
-struct {
-    real gsurf, re;
-} parmb_;
-
-#define parmb_1 parmb_
-
-struct metsel_1_ {
-    integer imr;
-};
-
-#define metsel_1 (*(struct metsel_1_ *) &metsel_)
-
-union {
-    struct {
-	real tinfg, gb, rout, tt[15];
-    } _1;
-    struct {
-	real tinf, gb, rout, t[15];
-    } _2;
-} ttest_;
-
-#define ttest_1 (ttest_._1)
-#define ttest_2 (ttest_._2)
-
-union {
-    struct {
-	real plg[36]	/* was [9][4] */, ctloc, stloc, c2tloc, s2tloc, 
-		c3tloc, s3tloc;
-	integer iyr;
-	real day, df, dfa, apd, apdf, apt[4], xlong, clong, slong;
-    } _1;
-    struct {
-	real plg[36]	/* was [9][4] */, ctloc, stloc, c2tloc, s2tloc, 
-		c3tloc, s3tloc;
-	integer iyr;
-	real day, df, dfa, apd, apdf, apt[4], long__, clong, slong;
-    } _2;
-} lpoly_;
-
-#define lpoly_1 (lpoly_._1)
-#define lpoly_2 (lpoly_._2)
-
-struct {
-    integer mp, ii, jg, lt;
-    real qpb[50];
-    integer ierr, ifun, n, j;
-    real dv[60];
-} lsqv_;
-
-#define lsqv_1 lsqv_
-
-struct {
-    real taf;
-} fit_;
-
-#define fit_1 fit_
+#define mavg6_1 (*(const struct mavg6_1_ *) &mavg6_)
 
 /* Initialized data */
 
-struct {
-    integer e_1;
-    } metsel_ = { 0 };
-
-struct {
+static const struct {
     real e_1[90];
     } lower6_ = { 1041.3f, 386.f, 195.f, 16.6728f, 213.f, 120.f, 240.f, 187.f,
 	     -2.f, 0.f, 2.456e7f, 6.71072e-6f, 100.f, 0.f, 110.f, 10.f, 0.f, 
@@ -160,7 +66,7 @@ struct {
 	    0.f, 1e7f, 1.f, 105.f, -8.f, 110.f, 10.f, 90.f, 2.f, 0.f, 0.f, 
 	    1e7f, 1.f, 105.f, -8.f, 110.f, 10.f, 90.f, 2.f, 0.f, 0.f };
 
-struct {
+static const struct {
     real e_1[3100];
     } parm6_ = { .99604f, .0385528f, .00303445f, -.105531f, -.00607134f, 
 	    -5.16278e-4f, -.115622f, .0020224f, .00990156f, -.127371f, 
@@ -525,7 +431,7 @@ struct {
 	    -51.3114f, 0.f, 0.f, 0.f, 0.f, 0.f, .0511923f, .0361225f, 0.f, 
 	    0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
 
-struct {
+static const struct {
     real e_1[10];
     } mavg6_ = { 261.f, 264.f, 229.f, 217.f, 217.f, 223.f, 286.76f, -2.9394f, 
 	    2.5f, 0.f };
@@ -553,11 +459,223 @@ static real c_b114 = 2.f;
 static integer c__9 = 9;
 static integer c__4 = 4;
 
-/* ontents:  MSIS FORTRAN SUBROUTINE GTD6 */
+/* Routines local to this file */
+
+static int gtd6_0_(msise90_context *, real *, real *, real *, real *,
+	integer *, real *, real *);
+static int glatf_(real *, real *, real *);
+static doublereal vtst_(msise90_context *, real *, real *, real *, integer *);
+static int gts6_(msise90_context *, real *, real *, real *, real *, 
+	integer *, real *, real *);
+static doublereal globe6_(msise90_context *, real *, real *, real *, 
+	const real *, const msise90_globe_terms *);
+static void globe6t_(msise90_context *, const real *, msise90_globe_terms *);
+static int tselec_(msise90_context *, real *);
+static doublereal glob6s_(msise90_context *, const real *, 
+	const msise90_globs_terms *);
+static void glob6st_(msise90_context *, const real *, msise90_globs_terms *);
+static doublereal densu_(msise90_context *, real *, real *, real *, real *, 
+	real *, real *, real *, real *, real *, integer *, real *, real *, 
+	real *);
+static doublereal densm_(msise90_context *, real *, real *, real *, real *, 
+	integer *, real *, real *, real *, integer *, real *, real *, real *);
+static int spline_(real *, real *, integer *, real *, real *, real *);
+static int splint_(real *, real *, real *, integer *, real *, real *);
+static int splini_(real *, real *, real *, integer *, real *, real *);
+static doublereal dnet_(real *, real *, real *, real *, real *);
+static doublereal ccor_(real *, real *, real *, real *);
+
+/* Context used by the FORTRAN style entry points */
+
+static msise90_context legacy_;
+static integer legacy_set = 0;
+
+static msise90_context *legacy_context(void)
+{
+    if (! legacy_set) {
+	msise90_init(&legacy_);
+	legacy_set = 1;
+    }
+    return &legacy_;
+}
+
+/* ----------------------------------------------------------------------- */
+void msise90_init(msise90_context *ctx)
+{
+    integer i__, j;
+
+/*       Start values of the FORTRAN DATA statements and SAVEd locals */
+    memset(ctx, 0, sizeof(msise90_context));
+    ctx->gtd6Alast = 99999.f;
+    ctx->gts6Alast = -999.f;
+    ctx->mssl = -999;
+    for (i__ = 1; i__ <= 25; ++i__) {
+	ctx->sv[i__ - 1] = 1.f;
+    }
+    ctx->sw9 = 1.f;
+    ctx->xl = 1e3f;
+    ctx->tll = 1e3f;
+    ctx->longl = -999.f;
+    for (i__ = 1; i__ <= 2; ++i__) {
+	ctx->last[i__ - 1].iyd = -999;
+	ctx->last[i__ - 1].sec = -999.f;
+	ctx->last[i__ - 1].glat = -999.f;
+	ctx->last[i__ - 1].glong = -999.f;
+	ctx->last[i__ - 1].stl = -999.f;
+	ctx->last[i__ - 1].f107a = -999.f;
+	ctx->last[i__ - 1].f107 = -999.f;
+	for (j = 1; j <= 7; ++j) {
+	    ctx->last[i__ - 1].ap[j - 1] = -999.f;
+	}
+	for (j = 1; j <= 25; ++j) {
+	    ctx->last[i__ - 1].sw[j - 1] = -999.f;
+	    ctx->last[i__ - 1].swc[j - 1] = -999.f;
+	}
+    }
+} /* msise90_init */
+
+/* ----------------------------------------------------------------------- */
+void msise90_meter(msise90_context *ctx, int meter)
+{
+/*      TO GET OUTPUT IN M-3 and KG/M3 PASS A NONZERO METER */
+    metsel_1.imr = 0;
+    if (meter) {
+	metsel_1.imr = 1;
+    }
+} /* msise90_meter */
+
+/* ----------------------------------------------------------------------- */
+void msise90_set_epoch(msise90_context *ctx, int iyd, float sec, 
+	float f107a, float f107, const float *ap)
+{
+    /* Initialized data */
+
+    static real dr = .0172142f;
+
+    /* Builtin functions */
+    double r_mod(real *, real *), cos(doublereal);
+
+    /* Local variables */
+    integer i__, k;
+    real yrd, day;
+
+/*       Set the time, solar flux and magnetic index shared by all */
+/*       positions, and the terms of the model that depend only on them. */
+/*       Inputs are as for GTD6. */
+    if (ctx->epochSet && iyd == ctx->iyd && sec == ctx->sec && f107a == 
+	    ctx->f107a && f107 == ctx->f107) {
+	for (i__ = 0; i__ < 7; ++i__) {
+	    if (ap[i__] != ctx->ap[i__]) {
+		break;
+	    }
+	}
+	if (i__ == 7) {
+	    return;
+	}
+    }
+    ctx->iyd = iyd;
+    ctx->sec = sec;
+    ctx->f107a = f107a;
+    ctx->f107 = f107;
+    for (i__ = 0; i__ < 7; ++i__) {
+	ctx->ap[i__] = ap[i__];
+    }
+
+    // Adjust the sv flag for hourly Ap is variation is seen
+    for (i__ = 1; i__ < 7; ++i__)
+    {
+       if (ap[i__] != ap[0])
+       {
+          // If we are using daily/3hr observations, flag 9 should be -1.0
+          ctx->sv[8] = -1.0;
+          break;
+       }
+    }
+    tselec_(ctx, ctx->sv);
+    if (csw_1.sw[8] > 0.f) {
+	ctx->sw9 = 1.f;
+    }
+    if (csw_1.sw[8] < 0.f) {
+	ctx->sw9 = -1.f;
+    }
+
+    yrd = (real) iyd;
+    lpoly_1.iyr = yrd / 1e3f;
+    lpoly_1.day = yrd - lpoly_1.iyr * 1e3f;
+/*         F10.7 EFFECT */
+    lpoly_1.df = f107 - f107a;
+    lpoly_1.dfa = f107a - 150.f;
+/*        Seasonal part of the turbopause height variation */
+    day = r_mod(&yrd, &c_b36);
+    ctx->czhf = cos(dr * (day - parm6_1.pt[13]));
+
+    globe6t_(ctx, parm6_1.pt, &ctx->globe[0]);
+    globe6t_(ctx, parm6_1.ps, &ctx->globe[1]);
+    for (k = 1; k <= 8; ++k) {
+	globe6t_(ctx, &parm6_1.pd[(k - 1) * 150], &ctx->globe[k + 1]);
+    }
+    for (k = 1; k <= 4; ++k) {
+	glob6st_(ctx, &parm6_1.ptl[(k - 1) * 100], &ctx->globs[k - 1]);
+    }
+    for (k = 1; k <= 10; ++k) {
+	glob6st_(ctx, &parm6_1.pma[(k - 1) * 100], &ctx->globs[k + 3]);
+    }
+    ctx->epochSet = 1;
+} /* msise90_set_epoch */
+
+/* ----------------------------------------------------------------------- */
+void msise90_density(msise90_context *ctx, float alt, float glat, 
+	float glong, float stl, int mass, float *d, float *t)
+{
+    integer mss;
+
+/*       Evaluate the model at one position at the current epoch. */
+/*       Inputs and outputs are as for GTD6. */
+    mss = mass;
+    gtd6_0_(ctx, &alt, &glat, &glong, &stl, &mss, d, t);
+} /* msise90_density */
+
+/* ----------------------------------------------------------------------- */
+void msise90_density_batch(msise90_context *ctx, int count, 
+	const float *alt, const float *glat, const float *glong, 
+	const float *stl, float *rho)
+{
+    integer i__, mass;
+    real z__, xlat, xlong, xstl, d__[8], t[2];
+
+/*       Total mass density at COUNT positions at the current epoch */
+    mass = 48;
+    for (i__ = 0; i__ < count; ++i__) {
+	z__ = alt[i__];
+	xlat = glat[i__];
+	xlong = glong[i__];
+	xstl = stl[i__];
+	gtd6_0_(ctx, &z__, &xlat, &xlong, &xstl, &mass, d__, t);
+	rho[i__] = d__[5];
+    }
+} /* msise90_density_batch */
+
 /* ----------------------------------------------------------------------- */
 /* Subroutine */ int gtd6_(integer *iyd, real *sec, real *alt, real *glat, 
 	real *glong, real *stl, real *f107a, real *f107, real *ap, integer *
 	mass, real *d__, real *t)
+{
+    msise90_context *ctx = legacy_context();
+
+    msise90_set_epoch(ctx, *iyd, *sec, *f107a, *f107, ap);
+    return gtd6_0_(ctx, alt, glat, glong, stl, mass, d__, t);
+} /* gtd6_ */
+
+/* Subroutine */ int meter6_(logical *meter)
+{
+    msise90_meter(legacy_context(), *meter);
+    return 0;
+} /* meter6_ */
+
+/* ontents:  MSIS FORTRAN SUBROUTINE GTD6 */
+/* ----------------------------------------------------------------------- */
+static int gtd6_0_(msise90_context *ctx, real *alt, real *glat, real *glong,
+	 real *stl, integer *mass, real *d__, real *t)
 {
     /* Initialized data */
 
@@ -566,28 +684,15 @@ static integer c__4 = 4;
     static integer mn2 = 4;
     static real zn2[4] = { 72.5f,55.f,45.f,32.5f };
     static real zmix = 62.5f;
-    static real alast = 99999.f;
-    static integer mssl = -999;
-    static real sv[25] = { 1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,
-	    1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f };
 
     /* System generated locals */
     real r__1;
 
     /* Local variables */
-    static integer i__, j;
-    static real d6[8], v1, t6[2], tz, dmc, dmr, dz28, xmm;
-    static integer mss;
-    extern /* Subroutine */ int gts6_(integer *, real *, real *, real *, real 
-	    *, real *, real *, real *, real *, integer *, real *, real *);
-    static real dm28m, altt, xlat;
-    extern doublereal vtst_(integer *, real *, real *, real *, real *, real *,
-	     real *, real *, integer *);
-    extern /* Subroutine */ int glatf_(real *, real *, real *);
-    extern doublereal densm_(real *, real *, real *, real *, integer *, real *
-	    , real *, real *, integer *, real *, real *, real *), glob6s_(
-	    real *);
-    extern /* Subroutine */ int tselec_(real *);
+    integer j;
+    real v1, tz, dmc, dmr, dz28, xmm;
+    integer mss;
+    real altt, xlat;
 
 /*        Neutral Atmosphere Empirical Model from the surface to lower */
 /*          exosphere  MSISE90 (JGR, 96, 1159-1172, 1991) */
@@ -661,40 +766,16 @@ static integer c__4 = 4;
 
 /*              To get current values of SW: CALL TRETRV(SW) */
 
-    /* Parameter adjustments */
-    // Adjust the sv flag for hourly Ap is variation is seen
-    integer i;
-    for (i = 1; i < 7; ++i)
-    {
-       if (ap[i] != ap[0])
-       {
-          // If we are using daily/3hr observations, flag 9 should be -1.0
-          sv[8] = -1.0;
-          break;
-       }
-    }
+/*     GMAT Change: IYD, SEC, F107A, F107 and AP are set for all positions */
+/*     by msise90_set_epoch, which also applies the switches. */
 
+    /* Parameter adjustments */
     --t;
     --d__;
-    --ap;
 
     /* Function Body */
-/*      SV(1) = 0.0 */
-/*      IF(ISW.NE.64999) CALL TSELEC(SV) */
-    tselec_(sv);
-/*      Put identification data into common/datime/ */
-    for (i__ = 1; i__ <= 3; ++i__) {
-	datime_1.isdate[i__ - 1] = datim6_1.isd[i__ - 1];
-/* L1: */
-    }
-    for (i__ = 1; i__ <= 2; ++i__) {
-	datime_1.istime[i__ - 1] = datim6_1.ist[i__ - 1];
-	datime_1.name__[i__ - 1] = datim6_1.nam[i__ - 1];
-/* L2: */
-    }
-
 /* e        Test for changed input */
-    v1 = vtst_(iyd, sec, glat, glong, stl, f107a, f107, &ap[1], &c__1);
+    v1 = vtst_(ctx, glat, glong, stl, &c__1);
 /*       Latitude variation of gravity (none for SW(2)=0) */
     xlat = *glat;
     if (csw_1.sw[1] == 0.f) {
@@ -713,21 +794,21 @@ static integer c__4 = 4;
     }
 /* e       Only calculate thermosphere if input parameters changed */
 /* e         or altitude above ZN2(1) in mesosphere */
-    if (v1 == 1.f || *alt > zn2[0] || alast > zn2[0] || mss != mssl) {
-	gts6_(iyd, sec, &altt, glat, glong, stl, f107a, f107, &ap[1], &mss, 
-		d6, t6);
-	dm28m = dmix_1.dm28;
+    if (v1 == 1.f || *alt > zn2[0] || ctx->gtd6Alast > zn2[0] || mss != 
+	    ctx->mssl) {
+	gts6_(ctx, &altt, glat, glong, stl, &mss, ctx->d6, ctx->t6);
+	ctx->dm28m = dmix_1.dm28;
 /*         metric adjustment */
 	if (metsel_1.imr == 1) {
-	    dm28m = dmix_1.dm28 * 1e6f;
+	    ctx->dm28m = dmix_1.dm28 * 1e6f;
 	}
-	mssl = mss;
+	ctx->mssl = mss;
     }
-    t[1] = t6[0];
-    t[2] = t6[1];
+    t[1] = ctx->t6[0];
+    t[2] = ctx->t6[1];
     if (*alt >= zn2[0]) {
 	for (j = 1; j <= 8; ++j) {
-	    d__[j] = d6[j - 1];
+	    d__[j] = ctx->d6[j - 1];
 /* L5: */
 	}
 	goto L10;
@@ -737,19 +818,21 @@ static integer c__4 = 4;
 /*         Temperature at nodes and gradients at end nodes */
 /*         Inverse temperature a linear function of spherical harmonics */
 /* e        Only calculate nodes if input changed */
-    if (v1 == 1.f || alast >= zn2[0]) {
+    if (v1 == 1.f || ctx->gtd6Alast >= zn2[0]) {
 	meso6_1.tgn2[0] = meso6_1.tgn1[1];
 	meso6_1.tn2[0] = meso6_1.tn1[4];
 	meso6_1.tn2[1] = parm6_1.pma[0] * mavg6_1.pavgm[0] / (1.f - csw_1.sw[
-		19] * glob6s_(parm6_1.pma));
+		19] * glob6s_(ctx, parm6_1.pma, &ctx->globs[4]));
 	meso6_1.tn2[2] = parm6_1.pma[100] * mavg6_1.pavgm[1] / (1.f - 
-		csw_1.sw[19] * glob6s_(&parm6_1.pma[100]));
+		csw_1.sw[19] * glob6s_(ctx, &parm6_1.pma[100], &ctx->globs[5]));
 	meso6_1.tn2[3] = parm6_1.pma[200] * mavg6_1.pavgm[2] / (1.f - 
-		csw_1.sw[19] * csw_1.sw[21] * glob6s_(&parm6_1.pma[200]));
+		csw_1.sw[19] * csw_1.sw[21] * glob6s_(ctx, &parm6_1.pma[200], 
+		&ctx->globs[6]));
 /* Computing 2nd power */
 	r__1 = parm6_1.pma[200] * mavg6_1.pavgm[2];
 	meso6_1.tgn2[1] = mavg6_1.pavgm[8] * parm6_1.pma[900] * (csw_1.sw[19] 
-		* csw_1.sw[21] * glob6s_(&parm6_1.pma[900]) + 1.f) * 
+		* csw_1.sw[21] * glob6s_(ctx, &parm6_1.pma[900], 
+		&ctx->globs[13]) + 1.f) * 
 		meso6_1.tn2[3] * meso6_1.tn2[3] / (r__1 * r__1);
 	meso6_1.tn3[0] = meso6_1.tn2[3];
     }
@@ -761,20 +844,22 @@ static integer c__4 = 4;
 /*         Temperature at nodes and gradients at end nodes */
 /*         Inverse temperature a linear function of spherical harmonics */
 /* e        Only calculate nodes if input changed */
-    if (v1 == 1.f || alast >= zn3[0]) {
+    if (v1 == 1.f || ctx->gtd6Alast >= zn3[0]) {
 	meso6_1.tgn3[0] = meso6_1.tgn2[1];
 	meso6_1.tn3[1] = parm6_1.pma[300] * mavg6_1.pavgm[3] / (1.f - 
-		csw_1.sw[21] * glob6s_(&parm6_1.pma[300]));
+		csw_1.sw[21] * glob6s_(ctx, &parm6_1.pma[300], &ctx->globs[7]));
 	meso6_1.tn3[2] = parm6_1.pma[400] * mavg6_1.pavgm[4] / (1.f - 
-		csw_1.sw[21] * glob6s_(&parm6_1.pma[400]));
+		csw_1.sw[21] * glob6s_(ctx, &parm6_1.pma[400], &ctx->globs[8]));
 	meso6_1.tn3[3] = parm6_1.pma[500] * mavg6_1.pavgm[5] / (1.f - 
-		csw_1.sw[21] * glob6s_(&parm6_1.pma[500]));
+		csw_1.sw[21] * glob6s_(ctx, &parm6_1.pma[500], &ctx->globs[9]));
 	meso6_1.tn3[4] = parm6_1.pma[600] * mavg6_1.pavgm[6] / (1.f - 
-		csw_1.sw[21] * glob6s_(&parm6_1.pma[600]));
+		csw_1.sw[21] * glob6s_(ctx, &parm6_1.pma[600], 
+		&ctx->globs[10]));
 /* Computing 2nd power */
 	r__1 = parm6_1.pma[600] * mavg6_1.pavgm[6];
 	meso6_1.tgn3[1] = parm6_1.pma[700] * mavg6_1.pavgm[7] * (csw_1.sw[21] 
-		* glob6s_(&parm6_1.pma[700]) + 1.f) * meso6_1.tn3[4] * 
+		* glob6s_(ctx, &parm6_1.pma[700], &ctx->globs[11]) + 1.f) * 
+		meso6_1.tn3[4] * 
 		meso6_1.tn3[4] / (r__1 * r__1);
     }
 L6:
@@ -787,10 +872,10 @@ L6:
     if (*alt > zmix) {
 	dmc = 1.f - (zn2[0] - *alt) / (zn2[0] - zmix);
     }
-    dz28 = d6[2];
+    dz28 = ctx->d6[2];
 /*      ***** N2 DENSITY **** */
-    dmr = d6[2] / dm28m - 1.f;
-    d__[3] = densm_(alt, &dm28m, &xmm, &tz, &mn3, zn3, meso6_1.tn3, 
+    dmr = ctx->d6[2] / ctx->dm28m - 1.f;
+    d__[3] = densm_(ctx, alt, &ctx->dm28m, &xmm, &tz, &mn3, zn3, meso6_1.tn3, 
 	    meso6_1.tgn3, &mn2, zn2, meso6_1.tn2, meso6_1.tgn2);
     d__[3] *= dmr * dmc + 1.f;
 /*      ***** HE DENSITY **** */
@@ -798,7 +883,7 @@ L6:
     if (*mass != 4 && *mass != 48) {
 	goto L204;
     }
-    dmr = d6[0] / (dz28 * lower6_1.pdm[1]) - 1.f;
+    dmr = ctx->d6[0] / (dz28 * lower6_1.pdm[1]) - 1.f;
     d__[1] = d__[3] * lower6_1.pdm[1] * (dmr * dmc + 1.f);
 L204:
 /*      **** O DENSITY **** */
@@ -809,7 +894,7 @@ L204:
     if (*mass != 32 && *mass != 48) {
 	goto L232;
     }
-    dmr = d6[3] / (dz28 * lower6_1.pdm[31]) - 1.f;
+    dmr = ctx->d6[3] / (dz28 * lower6_1.pdm[31]) - 1.f;
     d__[4] = d__[3] * lower6_1.pdm[31] * (dmr * dmc + 1.f);
 L232:
 /*      ***** AR DENSITY **** */
@@ -817,7 +902,7 @@ L232:
     if (*mass != 40 && *mass != 48) {
 	goto L240;
     }
-    dmr = d6[4] / (dz28 * lower6_1.pdm[41]) - 1.f;
+    dmr = ctx->d6[4] / (dz28 * lower6_1.pdm[41]) - 1.f;
     d__[5] = d__[3] * lower6_1.pdm[41] * (dmr * dmc + 1.f);
 L240:
 /*      ***** HYDROGEN DENSITY **** */
@@ -838,13 +923,13 @@ L240:
 L10:
     goto L90;
 L50:
-    gts3c_1.dd = densm_(alt, &c_b14, &c_b15, &tz, &mn3, zn3, meso6_1.tn3, 
+    gts3c_1.dd = densm_(ctx, alt, &c_b14, &c_b15, &tz, &mn3, zn3, meso6_1.tn3, 
 	    meso6_1.tgn3, &mn2, zn2, meso6_1.tn2, meso6_1.tgn2);
     t[2] = tz;
 L90:
-    alast = *alt;
+    ctx->gtd6Alast = *alt;
     return 0;
-} /* gtd6_ */
+} /* gtd6_0_ */
 
 /* ----------------------------------------------------------------------- */
 /* Subroutine */ int ghp6_(integer *iyd, real *sec, real *alt, real *glat, 
@@ -869,13 +954,12 @@ L90:
     integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
 
     /* Local variables */
-    static real g;
-    static integer l;
-    static real p, z__, ca, cd, cl, sh, pl, zi, xm, xn, cl2;
-    extern /* Subroutine */ int gtd6_(integer *, real *, real *, real *, real 
-	    *, real *, real *, real *, real *, integer *, real *, real *);
-    static real diff;
-    static integer iday;
+    real g;
+    integer l;
+    real p, z__, ca, cd, cl, sh, pl, zi = 0.f, xm, xn, cl2;
+    real diff;
+    integer iday;
+    msise90_context *ctx = legacy_context();
 
     /* Fortran I/O blocks */
     static cilist io___41 = { 0, 6, 0, fmt_100, 0 };
@@ -1007,106 +1091,74 @@ L20:
 } /* ghp6_ */
 
 /* ----------------------------------------------------------------------- */
-/* Subroutine */ int glatf_(real *lat, real *gv, real *reff)
+static int glatf_(real *lat, real *gv, real *reff)
 {
     /* Initialized data */
 
     static real dgtr = .0174533f;
-    static real latl = -999.f;
 
     /* Builtin functions */
     double cos(doublereal);
 
     /* Local variables */
-    static real c2;
+    real c2;
 
 /*      CALCULATE LATITUDE VARIABLE GRAVITY (GV) AND EFFECTIVE */
 /*      RADIUS (REFF) */
-    if (*lat != latl) {
-	c2 = cos(2.f * dgtr * *lat);
-    }
-    latl = *lat;
+    c2 = cos(2.f * dgtr * *lat);
     *gv = (1.f - c2 * .0026373f) * 980.616f;
     *reff = *gv * 2.f / (c2 * 2.27e-9f + 3.085462e-6f) * 1e-5f;
     return 0;
 } /* glatf_ */
 
 /* ----------------------------------------------------------------------- */
-doublereal vtst_(integer *iyd, real *sec, real *glat, real *glong, real *stl, 
-	real *f107a, real *f107, real *ap, integer *ic)
+static doublereal vtst_(msise90_context *ctx, real *glat, real *glong, 
+	real *stl, integer *ic)
 {
-    /* Initialized data */
-
-    static integer iydl[2] = { -999,-999 };
-    static real secl[2] = { -999.f,-999.f };
-    static real glatl[2] = { -999.f,-999.f };
-    static real gll[2] = { -999.f,-999.f };
-    static real stll[2] = { -999.f,-999.f };
-    static real fal[2] = { -999.f,-999.f };
-    static real fl[2] = { -999.f,-999.f };
-    static real apl[14]	/* was [7][2] */ = { -999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f };
-    static real swl[50]	/* was [25][2] */ = { -999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f };
-    static real swcl[50]	/* was [25][2] */ = { -999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,-999.f,
-	    -999.f,-999.f };
-
     /* System generated locals */
     real ret_val;
 
     /* Local variables */
-    static integer i__;
+    integer i__;
+    msise90_inputs *l;
 
 /*       Test if geophysical variables or switches changed and save */
 /*       Return 0 if unchanged and 1 if changed */
-    /* Parameter adjustments */
-    --ap;
-
     /* Function Body */
+    l = &ctx->last[*ic - 1];
     ret_val = 0.f;
-    if (*iyd != iydl[*ic - 1]) {
+    if (ctx->iyd != l->iyd) {
 	goto L10;
     }
-    if (*sec != secl[*ic - 1]) {
+    if (ctx->sec != l->sec) {
 	goto L10;
     }
-    if (*glat != glatl[*ic - 1]) {
+    if (*glat != l->glat) {
 	goto L10;
     }
-    if (*glong != gll[*ic - 1]) {
+    if (*glong != l->glong) {
 	goto L10;
     }
-    if (*stl != stll[*ic - 1]) {
+    if (*stl != l->stl) {
 	goto L10;
     }
-    if (*f107a != fal[*ic - 1]) {
+    if (ctx->f107a != l->f107a) {
 	goto L10;
     }
-    if (*f107 != fl[*ic - 1]) {
+    if (ctx->f107 != l->f107) {
 	goto L10;
     }
     for (i__ = 1; i__ <= 7; ++i__) {
-	if (ap[i__] != apl[i__ + *ic * 7 - 8]) {
+	if (ctx->ap[i__ - 1] != l->ap[i__ - 1]) {
 	    goto L10;
 	}
 /* L5: */
     }
     for (i__ = 1; i__ <= 25; ++i__) {
-	if (csw_1.sw[i__ - 1] != swl[i__ + *ic * 25 - 26]) {
+	if (csw_1.sw[i__ - 1] != l->sw[i__ - 1]) {
 	    goto L10;
 	}
-	if (csw_1.swc[i__ - 1] != swcl[i__ + *ic * 25 - 26]) {
+	if (csw_1.swc[i__ - 1] != l->swc[i__ - 1]) {
 	    goto L10;
 	}
 /* L7: */
@@ -1114,20 +1166,20 @@ doublereal vtst_(integer *iyd, real *sec, real *glat, real *glong, real *stl,
     goto L20;
 L10:
     ret_val = 1.f;
-    iydl[*ic - 1] = *iyd;
-    secl[*ic - 1] = *sec;
-    glatl[*ic - 1] = *glat;
-    gll[*ic - 1] = *glong;
-    stll[*ic - 1] = *stl;
-    fal[*ic - 1] = *f107a;
-    fl[*ic - 1] = *f107;
+    l->iyd = ctx->iyd;
+    l->sec = ctx->sec;
+    l->glat = *glat;
+    l->glong = *glong;
+    l->stl = *stl;
+    l->f107a = ctx->f107a;
+    l->f107 = ctx->f107;
     for (i__ = 1; i__ <= 7; ++i__) {
-	apl[i__ + *ic * 7 - 8] = ap[i__];
+	l->ap[i__ - 1] = ctx->ap[i__ - 1];
 /* L15: */
     }
     for (i__ = 1; i__ <= 25; ++i__) {
-	swl[i__ + *ic * 25 - 26] = csw_1.sw[i__ - 1];
-	swcl[i__ + *ic * 25 - 26] = csw_1.swc[i__ - 1];
+	l->sw[i__ - 1] = csw_1.sw[i__ - 1];
+	l->swc[i__ - 1] = csw_1.swc[i__ - 1];
 /* L16: */
     }
 L20:
@@ -1135,19 +1187,15 @@ L20:
 } /* vtst_ */
 
 /* ----------------------------------------------------------------------- */
-/* Subroutine */ int gts6_0_(int n__, integer *iyd, real *sec, real *alt, 
-	real *glat, real *glong, real *stl, real *f107a, real *f107, real *ap,
-	 integer *mass, real *d__, real *t, logical *meter)
+static int gts6_(msise90_context *ctx, real *alt, real *glat, real *glong,
+	 real *stl, integer *mass, real *d__, real *t)
 {
     /* Initialized data */
 
     static integer mt[10] = { 48,0,4,16,28,32,40,1,49,14 };
     static real altl[8] = { 200.f,400.f,160.f,200.f,240.f,450.f,320.f,450.f };
     static integer mn1 = 5;
-    static real zn1[5] = { 120.f,110.f,100.f,90.f,72.5f };
     static real dgtr = .0174533f;
-    static real dr = .0172142f;
-    static real alast = -999.f;
 
     /* Format strings */
     static char fmt_100[] = "(1x,\002MASS\002,i5,\002  NOT VALID\002)";
@@ -1156,26 +1204,20 @@ L20:
     real r__1;
 
     /* Builtin functions */
-    double r_mod(real *, real *), sin(doublereal), cos(doublereal);
+    double sin(doublereal);
     integer s_wsfe(cilist *), do_fio(integer *, char *, ftnlen), e_wsfe(void);
     double exp(doublereal), log(doublereal);
 
     /* Local variables */
-    static integer i__, j;
-    static real g1, g4, v2, b01, b04, b32, b16, g40, b28, g32, g16, b40, g14, 
-	    g28, b14, tz, hc04, hc32, hc16, rc16, day, zc04, zh04, zlb, zhf, 
-	    yrd, xmm, zh28, xmd, zh16, zc16, zh32, zc32, zh40, hc40, zc40, 
+    integer i__, j;
+    real g1, g4, v2, b01, b04, b32, b16, g40, b28, g32, g16, b40, g14, 
+	    g28, b14, tz, hc04, hc32, hc16, rc16, zc04, zh04, zlb, zhf, 
+	    xmm, zh28, xmd, zh16, zc16, zh32, zc32, zh40, hc40, zc40, 
 	    zh01, hc01, zc01, rc01, zh14, hc14, zc14, rc14, hcc01, hcc14, 
 	    hcc16, zcc01, zcc14;
-    extern doublereal ccor_(real *, real *, real *, real *);
-    static real zcc16, ddum;
-    extern doublereal dnet_(real *, real *, real *, real *, real *);
-    static real zhm01, tinf, zhm04, zhm32, zhm16, zhm40, zhm14, zhm28;
-    extern doublereal vtst_(integer *, real *, real *, real *, real *, real *,
-	     real *, real *, integer *), densu_(real *, real *, real *, real *
-	    , real *, real *, real *, real *, real *, integer *, real *, real 
-	    *, real *), globe6_(real *, real *, real *, real *, real *, real *
-	    , real *, real *, real *), glob6s_(real *);
+    real zcc16, ddum;
+    real zhm01, zhm04, zhm32, zhm16, zhm40, zhm14, zhm28;
+    real zn1[5];
 
     /* Fortran I/O blocks */
     static cilist io___72 = { 0, 6, 0, fmt_100, 0 };
@@ -1250,76 +1292,75 @@ L20:
 
 /*              To get current values of SW: CALL TRETRV(SW) */
 
+/*     GMAT Change: IYD, SEC, F107A, F107 and AP are set for all positions */
+/*     by msise90_set_epoch. */
+
     /* Parameter adjustments */
-    if (ap) {
-	--ap;
-	}
-    if (d__) {
-	--d__;
-	}
-    if (t) {
-	--t;
-	}
+    --d__;
+    --t;
 
     /* Function Body */
-    switch(n__) {
-	case 1: goto L_meter6;
-	}
-
 /* e        Test for changed input */
-    v2 = vtst_(iyd, sec, glat, glong, stl, f107a, f107, &ap[1], &c__2);
+    v2 = vtst_(ctx, glat, glong, stl, &c__2);
 
-    yrd = (real) (*iyd);
     gts3c_1.za = parm6_1.pdl[40];
     zn1[0] = gts3c_1.za;
+    zn1[1] = 110.f;
+    zn1[2] = 100.f;
+    zn1[3] = 90.f;
+    zn1[4] = 72.5f;
     for (j = 1; j <= 8; ++j) {
 	d__[j] = 0.f;
 /* L2: */
     }
 /* e       TINF VARIATIONS NOT IMPORTANT BELOW ZA OR ZN1(1) */
     if (*alt > zn1[0]) {
-	if (v2 == 1.f || alast <= zn1[0]) {
-	    tinf = lower6_1.ptm[0] * parm6_1.pt[0] * (csw_1.sw[15] * globe6_(&
-		    yrd, sec, glat, glong, stl, f107a, f107, &ap[1], 
-		    parm6_1.pt) + 1.f);
+	if (v2 == 1.f || ctx->gts6Alast <= zn1[0]) {
+	    ctx->tinf = lower6_1.ptm[0] * parm6_1.pt[0] * (csw_1.sw[15] * 
+		    globe6_(ctx, glat, glong, stl, parm6_1.pt, 
+		    &ctx->globe[0]) + 1.f);
 	}
     } else {
-	tinf = lower6_1.ptm[0] * parm6_1.pt[0];
+	ctx->tinf = lower6_1.ptm[0] * parm6_1.pt[0];
     }
-    t[1] = tinf;
+    t[1] = ctx->tinf;
 /* e         GRADIENT VARIATIONS NOT IMPORTANT BELOW ZN1(5) */
     if (*alt > zn1[4]) {
-	if (v2 == 1.f || alast <= zn1[4]) {
+	if (v2 == 1.f || ctx->gts6Alast <= zn1[4]) {
 	    gts3c_1.g0 = lower6_1.ptm[3] * parm6_1.ps[0] * (csw_1.sw[18] * 
-		    globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &ap[1], 
-		    parm6_1.ps) + 1.f);
+		    globe6_(ctx, glat, glong, stl, parm6_1.ps, 
+		    &ctx->globe[1]) + 1.f);
 	}
     } else {
 	gts3c_1.g0 = lower6_1.ptm[3] * parm6_1.ps[0];
     }
 /* e      Calculate these temperatures only if input changed */
     if (v2 == 1.f) {
-	gts3c_1.tlb = lower6_1.ptm[1] * (csw_1.sw[16] * globe6_(&yrd, sec, 
-		glat, glong, stl, f107a, f107, &ap[1], &parm6_1.pd[450]) + 
+	gts3c_1.tlb = lower6_1.ptm[1] * (csw_1.sw[16] * globe6_(ctx, glat, 
+		glong, stl, &parm6_1.pd[450], &ctx->globe[5]) + 
 		1.f) * parm6_1.pd[450];
     }
-    gts3c_1.s = gts3c_1.g0 / (tinf - gts3c_1.tlb);
+    gts3c_1.s = gts3c_1.g0 / (ctx->tinf - gts3c_1.tlb);
 /* e       Lower thermosphere temp variations not significant for */
 /* e        density above 300 km */
     if (*alt < 300.f) {
-	if (v2 == 1.f || alast >= 300.f) {
+	if (v2 == 1.f || ctx->gts6Alast >= 300.f) {
 	    meso6_1.tn1[1] = lower6_1.ptm[6] * parm6_1.ptl[0] / (1.f - 
-		    csw_1.sw[17] * glob6s_(parm6_1.ptl));
+		    csw_1.sw[17] * glob6s_(ctx, parm6_1.ptl, &ctx->globs[0]));
 	    meso6_1.tn1[2] = lower6_1.ptm[2] * parm6_1.ptl[100] / (1.f - 
-		    csw_1.sw[17] * glob6s_(&parm6_1.ptl[100]));
+		    csw_1.sw[17] * glob6s_(ctx, &parm6_1.ptl[100], 
+		    &ctx->globs[1]));
 	    meso6_1.tn1[3] = lower6_1.ptm[7] * parm6_1.ptl[200] / (1.f - 
-		    csw_1.sw[17] * glob6s_(&parm6_1.ptl[200]));
+		    csw_1.sw[17] * glob6s_(ctx, &parm6_1.ptl[200], 
+		    &ctx->globs[2]));
 	    meso6_1.tn1[4] = lower6_1.ptm[4] * parm6_1.ptl[300] / (1.f - 
-		    csw_1.sw[17] * csw_1.sw[19] * glob6s_(&parm6_1.ptl[300]));
+		    csw_1.sw[17] * csw_1.sw[19] * glob6s_(ctx, 
+		    &parm6_1.ptl[300], &ctx->globs[3]));
 /* Computing 2nd power */
 	    r__1 = lower6_1.ptm[4] * parm6_1.ptl[300];
 	    meso6_1.tgn1[1] = lower6_1.ptm[8] * parm6_1.pma[800] * (csw_1.sw[
-		    17] * csw_1.sw[19] * glob6s_(&parm6_1.pma[800]) + 1.f) * 
+		    17] * csw_1.sw[19] * glob6s_(ctx, &parm6_1.pma[800], 
+		    &ctx->globs[12]) + 1.f) * 
 		    meso6_1.tn1[4] * meso6_1.tn1[4] / (r__1 * r__1);
 	}
     } else {
@@ -1342,15 +1383,13 @@ L20:
 	goto L50;
     }
 /*       N2 variation factor at Zlb */
-    g28 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &
-	    ap[1], &parm6_1.pd[300]);
+    g28 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, &parm6_1.pd[300], 
+	    &ctx->globe[4]);
 /*        Variation of turbopause height */
-    day = r_mod(&yrd, &c_b36);
     zhf = parm6_1.pdl[49] * (csw_1.sw[4] * parm6_1.pdl[24] * sin(dgtr * *glat)
-	     * cos(dr * (day - parm6_1.pt[13])) + 1.f);
+	     * ctx->czhf + 1.f);
 
-    yrd = (real) (*iyd);
-    t[1] = tinf;
+    t[1] = ctx->tinf;
     xmm = lower6_1.pdm[24];
 
     for (j = 1; j <= 10; ++j) {
@@ -1373,7 +1412,8 @@ L15:
 /*      Diffusive density at Zlb */
     gts3c_1.db28 = lower6_1.pdm[20] * exp(g28) * parm6_1.pd[300];
 /*      Diffusive density at Alt */
-    d__[3] = densu_(alt, &gts3c_1.db28, &tinf, &gts3c_1.tlb, &c_b44, &c_b15, &
+    d__[3] = densu_(ctx, alt, &gts3c_1.db28, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b44, &c_b15, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     gts3c_1.dd = d__[3];
 /*      Turbopause */
@@ -1381,13 +1421,15 @@ L15:
     zhm28 = lower6_1.pdm[23] * parm6_1.pdl[30];
     xmd = 28.f - xmm;
 /*      Mixed density at Zlb */
-    b28 = densu_(&zh28, &gts3c_1.db28, &tinf, &gts3c_1.tlb, &xmd, &c_b46, &tz,
+    b28 = densu_(ctx, &zh28, &gts3c_1.db28, &ctx->tinf, &gts3c_1.tlb, &xmd, 
+	    &c_b46, &tz,
 	     &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     if (*alt > altl[2] || csw_1.sw[14] == 0.f) {
 	goto L17;
     }
 /*      Mixed density at Alt */
-    dmix_1.dm28 = densu_(alt, &b28, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &tz, &
+    dmix_1.dm28 = densu_(ctx, alt, &b28, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &tz, &
 	    zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[3] = dnet_(&d__[3], &dmix_1.dm28, &zhm28, &xmm, &c_b44);
@@ -1409,12 +1451,13 @@ L20:
 /*       **** HE DENSITY **** */
 
 /*       Density variation factor at Zlb */
-    g4 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &ap[
-	    1], parm6_1.pd);
+    g4 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, parm6_1.pd, 
+	    &ctx->globe[2]);
 /*      Diffusive density at Zlb */
     gts3c_1.db04 = lower6_1.pdm[0] * exp(g4) * parm6_1.pd[0];
 /*      Diffusive density at Alt */
-    d__[1] = densu_(alt, &gts3c_1.db04, &tinf, &gts3c_1.tlb, &c_b55, &c_b56, &
+    d__[1] = densu_(ctx, alt, &gts3c_1.db04, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b55, &c_b56, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     gts3c_1.dd = d__[1];
     if (*alt > altl[0] || csw_1.sw[14] == 0.f) {
@@ -1425,10 +1468,12 @@ L20:
     zhm04 = zhm28;
 /*      Mixed density at Zlb */
     r__1 = 4.f - xmm;
-    b04 = densu_(&zh04, &gts3c_1.db04, &tinf, &gts3c_1.tlb, &r__1, &c_b58, &t[
+    b04 = densu_(ctx, &zh04, &gts3c_1.db04, &ctx->tinf, &gts3c_1.tlb, &r__1, 
+	    &c_b58, &t[
 	    2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Mixed density at Alt */
-    dmix_1.dm04 = densu_(alt, &b04, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &t[2], 
+    dmix_1.dm04 = densu_(ctx, alt, &b04, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &t[2], 
 	    &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[1] = dnet_(&d__[1], &dmix_1.dm04, &zhm04, &xmm, &c_b55);
@@ -1447,12 +1492,13 @@ L25:
 /*      **** O DENSITY **** */
 
 /*       Density variation factor at Zlb */
-    g16 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &
-	    ap[1], &parm6_1.pd[150]);
+    g16 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, &parm6_1.pd[150], 
+	    &ctx->globe[3]);
 /*      Diffusive density at Zlb */
     gts3c_1.db16 = lower6_1.pdm[10] * exp(g16) * parm6_1.pd[150];
 /*       Diffusive density at Alt */
-    d__[2] = densu_(alt, &gts3c_1.db16, &tinf, &gts3c_1.tlb, &c_b61, &c_b15, &
+    d__[2] = densu_(ctx, alt, &gts3c_1.db16, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b61, &c_b15, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     gts3c_1.dd = d__[2];
     if (*alt > altl[1] || csw_1.sw[14] == 0.f) {
@@ -1464,10 +1510,12 @@ L25:
     zhm16 = zhm28;
 /*      Mixed density at Zlb */
     r__1 = 16 - xmm;
-    b16 = densu_(&zh16, &gts3c_1.db16, &tinf, &gts3c_1.tlb, &r__1, &c_b46, &t[
+    b16 = densu_(ctx, &zh16, &gts3c_1.db16, &ctx->tinf, &gts3c_1.tlb, &r__1, 
+	    &c_b46, &t[
 	    2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Mixed density at Alt */
-    dmix_1.dm16 = densu_(alt, &b16, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &t[2], 
+    dmix_1.dm16 = densu_(ctx, alt, &b16, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &t[2], 
 	    &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[2] = dnet_(&d__[2], &dmix_1.dm16, &zhm16, &xmm, &c_b61);
@@ -1491,12 +1539,13 @@ L35:
 /*       **** O2 DENSITY **** */
 
 /*       Density variation factor at Zlb */
-    g32 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &
-	    ap[1], &parm6_1.pd[600]);
+    g32 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, &parm6_1.pd[600], 
+	    &ctx->globe[6]);
 /*      Diffusive density at Zlb */
     gts3c_1.db32 = lower6_1.pdm[30] * exp(g32) * parm6_1.pd[600];
 /*       Diffusive density at Alt */
-    d__[4] = densu_(alt, &gts3c_1.db32, &tinf, &gts3c_1.tlb, &c_b67, &c_b15, &
+    d__[4] = densu_(ctx, alt, &gts3c_1.db32, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b67, &c_b15, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     if (*mass == 49) {
 	gts3c_1.dd += d__[4] * 2.f;
@@ -1511,10 +1560,12 @@ L35:
     zhm32 = zhm28;
 /*      Mixed density at Zlb */
     r__1 = 32.f - xmm;
-    b32 = densu_(&zh32, &gts3c_1.db32, &tinf, &gts3c_1.tlb, &r__1, &c_b46, &t[
+    b32 = densu_(ctx, &zh32, &gts3c_1.db32, &ctx->tinf, &gts3c_1.tlb, &r__1, 
+	    &c_b46, &t[
 	    2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Mixed density at Alt */
-    dmix_1.dm32 = densu_(alt, &b32, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &t[2], 
+    dmix_1.dm32 = densu_(ctx, alt, &b32, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &t[2], 
 	    &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[4] = dnet_(&d__[4], &dmix_1.dm32, &zhm32, &xmm, &c_b67);
@@ -1533,12 +1584,13 @@ L40:
 /*       **** AR DENSITY **** */
 
 /*       Density variation factor at Zlb */
-    g40 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &
-	    ap[1], &parm6_1.pd[750]);
+    g40 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, &parm6_1.pd[750], 
+	    &ctx->globe[7]);
 /*      Diffusive density at Zlb */
     gts3c_1.db40 = lower6_1.pdm[40] * exp(g40) * parm6_1.pd[750];
 /*       Diffusive density at Alt */
-    d__[5] = densu_(alt, &gts3c_1.db40, &tinf, &gts3c_1.tlb, &c_b73, &c_b15, &
+    d__[5] = densu_(ctx, alt, &gts3c_1.db40, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b73, &c_b15, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     gts3c_1.dd = d__[5];
     if (*alt > altl[4] || csw_1.sw[14] == 0.f) {
@@ -1549,10 +1601,12 @@ L40:
     zhm40 = zhm28;
 /*      Mixed density at Zlb */
     r__1 = 40.f - xmm;
-    b40 = densu_(&zh40, &gts3c_1.db40, &tinf, &gts3c_1.tlb, &r__1, &c_b46, &t[
+    b40 = densu_(ctx, &zh40, &gts3c_1.db40, &ctx->tinf, &gts3c_1.tlb, &r__1, 
+	    &c_b46, &t[
 	    2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Mixed density at Alt */
-    dmix_1.dm40 = densu_(alt, &b40, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &t[2], 
+    dmix_1.dm40 = densu_(ctx, alt, &b40, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &t[2], 
 	    &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[5] = dnet_(&d__[5], &dmix_1.dm40, &zhm40, &xmm, &c_b73);
@@ -1571,12 +1625,13 @@ L45:
 /*        **** HYDROGEN DENSITY **** */
 
 /*       Density variation factor at Zlb */
-    g1 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &ap[
-	    1], &parm6_1.pd[900]);
+    g1 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, &parm6_1.pd[900], 
+	    &ctx->globe[8]);
 /*      Diffusive density at Zlb */
     gts3c_1.db01 = lower6_1.pdm[50] * exp(g1) * parm6_1.pd[900];
 /*       Diffusive density at Alt */
-    d__[7] = densu_(alt, &gts3c_1.db01, &tinf, &gts3c_1.tlb, &c_b14, &c_b56, &
+    d__[7] = densu_(ctx, alt, &gts3c_1.db01, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b14, &c_b56, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     gts3c_1.dd = d__[7];
     if (*alt > altl[6] || csw_1.sw[14] == 0.f) {
@@ -1587,10 +1642,12 @@ L45:
     zhm01 = zhm28;
 /*      Mixed density at Zlb */
     r__1 = 1.f - xmm;
-    b01 = densu_(&zh01, &gts3c_1.db01, &tinf, &gts3c_1.tlb, &r__1, &c_b58, &t[
+    b01 = densu_(ctx, &zh01, &gts3c_1.db01, &ctx->tinf, &gts3c_1.tlb, &r__1, 
+	    &c_b58, &t[
 	    2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Mixed density at Alt */
-    dmix_1.dm01 = densu_(alt, &b01, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &t[2], 
+    dmix_1.dm01 = densu_(ctx, alt, &b01, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &t[2], 
 	    &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[7] = dnet_(&d__[7], &dmix_1.dm01, &zhm01, &xmm, &c_b14);
@@ -1611,12 +1668,13 @@ L48:
 /*        **** ATOMIC NITROGEN DENSITY **** */
 
 /*       Density variation factor at Zlb */
-    g14 = csw_1.sw[20] * globe6_(&yrd, sec, glat, glong, stl, f107a, f107, &
-	    ap[1], &parm6_1.pd[1050]);
+    g14 = csw_1.sw[20] * globe6_(ctx, glat, glong, stl, &parm6_1.pd[1050], 
+	    &ctx->globe[9]);
 /*      Diffusive density at Zlb */
     gts3c_1.db14 = lower6_1.pdm[60] * exp(g14) * parm6_1.pd[1050];
 /*       Diffusive density at Alt */
-    d__[8] = densu_(alt, &gts3c_1.db14, &tinf, &gts3c_1.tlb, &c_b85, &c_b15, &
+    d__[8] = densu_(ctx, alt, &gts3c_1.db14, &ctx->tinf, &gts3c_1.tlb, 
+	    &c_b85, &c_b15, &
 	    t[2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     gts3c_1.dd = d__[8];
     if (*alt > altl[7] || csw_1.sw[14] == 0.f) {
@@ -1627,10 +1685,12 @@ L48:
     zhm14 = zhm28;
 /*      Mixed density at Zlb */
     r__1 = 14.f - xmm;
-    b14 = densu_(&zh14, &gts3c_1.db14, &tinf, &gts3c_1.tlb, &r__1, &c_b46, &t[
+    b14 = densu_(ctx, &zh14, &gts3c_1.db14, &ctx->tinf, &gts3c_1.tlb, &r__1, 
+	    &c_b46, &t[
 	    2], &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Mixed density at Alt */
-    dmix_1.dm14 = densu_(alt, &b14, &tinf, &gts3c_1.tlb, &xmm, &c_b15, &t[2], 
+    dmix_1.dm14 = densu_(ctx, alt, &b14, &ctx->tinf, &gts3c_1.tlb, &xmm, 
+	    &c_b15, &t[2], 
 	    &zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
 /*      Net density at Alt */
     d__[8] = dnet_(&d__[8], &dmix_1.dm14, &zhm14, &xmm, &c_b85);
@@ -1660,7 +1720,8 @@ L49:
     goto L90;
 /*       TEMPERATURE AT ALTITUDE */
 L50:
-    ddum = densu_(alt, &c_b14, &tinf, &gts3c_1.tlb, &c_b15, &c_b15, &t[2], &
+    ddum = densu_(ctx, alt, &c_b14, &ctx->tinf, &gts3c_1.tlb, &c_b15, &c_b15, 
+	    &t[2], &
 	    zlb, &gts3c_1.s, &mn1, zn1, meso6_1.tn1, meso6_1.tgn1);
     goto L90;
 L90:
@@ -1672,54 +1733,20 @@ L90:
 	}
 	d__[6] /= 1e3f;
     }
-    alast = *alt;
-    return 0;
-
-L_meter6:
-    metsel_1.imr = 0;
-    if (*meter) {
-	metsel_1.imr = 1;
-    }
+    ctx->gts6Alast = *alt;
     return 0;
 } /* gts6_ */
 
-/* Subroutine */ int gts6_(integer *iyd, real *sec, real *alt, real *glat, 
-	real *glong, real *stl, real *f107a, real *f107, real *ap, integer *
-	mass, real *d__, real *t)
-{
-    return gts6_0_(0, iyd, sec, alt, glat, glong, stl, f107a, f107, ap, mass, 
-	    d__, t, (logical *)0);
-    }
-
-/* Subroutine */ int meter6_(logical *meter)
-{
-    return gts6_0_(1, (integer *)0, (real *)0, (real *)0, (real *)0, (real *)
-	    0, (real *)0, (real *)0, (real *)0, (real *)0, (integer *)0, (
-	    real *)0, (real *)0, meter);
-    }
-
 /* ----------------------------------------------------------------------- */
-doublereal globe6_(real *yrd, real *sec, real *lat, real *long__, real *tloc, 
-	real *f107a, real *f107, real *ap, real *p)
+static doublereal globe6_(msise90_context *ctx, real *lat, real *long__, 
+	real *tloc, const real *p, const msise90_globe_terms *e)
 {
     /* Initialized data */
 
     static real dgtr = .0174533f;
-    static real dr = .0172142f;
-    static real xl = 1e3f;
-    static real tll = 1e3f;
-    static real sw9 = 1.f;
-    static real dayl = -1.f;
-    static real p14 = -1e3f;
-    static real p18 = -1e3f;
-    static real p32 = -1e3f;
     static real hr = .2618f;
     static real sr = 7.2722e-5f;
-    static real sv[25] = { 1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,
-	    1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f,1.f };
     static integer nsw = 14;
-    static real p39 = -1e3f;
-    static real longl = -999.f;
 
     /* System generated locals */
     integer i__1;
@@ -1731,50 +1758,28 @@ doublereal globe6_(real *yrd, real *sec, real *lat, real *long__, real *tloc,
 	    doublereal *, doublereal *);
 
     /* Local variables */
-    static real c__;
-    static integer i__, j;
-    static real s, c2, c4, f1, f2, s2, p44, p45, t71, t72, t81, t82, cd14, 
-	    cd32, cd18, cd39, exp1, exp2;
-    extern /* Subroutine */ int tselec_(real *);
+    real c__;
+    integer i__, j;
+    real s, c2, c4, f1, f2, s2, t71, t72, t81, t82, cd14, cd32, cd18, 
+	    cd39, exp1;
 
 /*       CALCULATE G(L) FUNCTION */
 /*       Upper Thermosphere Parameters */
+/*       GMAT Change: The switches, day of year, F10.7 differences and */
+/*       the terms that depend only on them are set up by */
+/*       msise90_set_epoch; E holds the terms for coefficient set P. */
     /* Parameter adjustments */
-    // Adjust the sv flag for hourly Ap is variation is seen
-    integer i;
-    for (i = 1; i < 7; ++i)
-    {
-       if (ap[i] != ap[0])
-       {
-          // If we are using daily/3hr observations, flag 9 should be -1.0
-          sv[8] = -1.0;
-          break;
-       }
-    }
-
     --p;
-    --ap;
 
     /* Function Body */
 /*       3hr Magnetica activity functions */
 
-    if (csw_1.isw != 64999) {
-	tselec_(sv);
-    }
     for (j = 1; j <= 14; ++j) {
 	ttest_2.t[j - 1] = 0.f;
 /* L10: */
     }
-    if (csw_1.sw[8] > 0.f) {
-	sw9 = 1.f;
-    }
-    if (csw_1.sw[8] < 0.f) {
-	sw9 = -1.f;
-    }
-    lpoly_1.iyr = *yrd / 1e3f;
-    lpoly_1.day = *yrd - lpoly_1.iyr * 1e3f;
     lpoly_1.xlong = *long__;
-    if (xl == *lat) {
+    if (ctx->xl == *lat) {
 	goto L15;
     }
 /*          CALCULATE LEGENDRE POLYNOMIALS */
@@ -1815,9 +1820,9 @@ doublereal globe6_(real *yrd, real *sec, real *lat, real *long__, real *tloc,
 	    2.f;
     lpoly_1.plg[33] = (c__ * 11.f * lpoly_1.plg[32] - lpoly_1.plg[31] * 8.f) /
 	     3.f;
-    xl = *lat;
+    ctx->xl = *lat;
 L15:
-    if (tll == *tloc) {
+    if (ctx->tll == *tloc) {
 	goto L16;
     }
     if (csw_1.sw[6] == 0.f && csw_1.sw[7] == 0.f && csw_1.sw[13] == 0.f) {
@@ -1829,41 +1834,21 @@ L15:
     lpoly_1.c2tloc = cos(hr * 2.f * *tloc);
     lpoly_1.s3tloc = sin(hr * 3.f * *tloc);
     lpoly_1.c3tloc = cos(hr * 3.f * *tloc);
-    tll = *tloc;
+    ctx->tll = *tloc;
 L16:
-    if (*long__ != longl) {
+    if (*long__ != ctx->longl) {
 	lpoly_1.clong = cos(dgtr * *long__);
 	lpoly_1.slong = sin(dgtr * *long__);
     }
-    longl = *long__;
-    if (lpoly_1.day != dayl || p[14] != p14) {
-	cd14 = cos(dr * (lpoly_1.day - p[14]));
-    }
-    if (lpoly_1.day != dayl || p[18] != p18) {
-	cd18 = cos(dr * 2.f * (lpoly_1.day - p[18]));
-    }
-    if (lpoly_1.day != dayl || p[32] != p32) {
-	cd32 = cos(dr * (lpoly_1.day - p[32]));
-    }
-    if (lpoly_1.day != dayl || p[39] != p39) {
-	cd39 = cos(dr * 2.f * (lpoly_1.day - p[39]));
-    }
-    dayl = lpoly_1.day;
-    p14 = p[14];
-    p18 = p[18];
-    p32 = p[32];
-    p39 = p[39];
+    ctx->longl = *long__;
+    cd14 = e->cd14;
+    cd18 = e->cd18;
+    cd32 = e->cd32;
+    cd39 = e->cd39;
 /*         F10.7 EFFECT */
-    lpoly_1.df = *f107 - *f107a;
-    lpoly_1.dfa = *f107a - 150.f;
-/* Computing 2nd power */
-    r__1 = lpoly_1.dfa;
-    ttest_2.t[0] = p[20] * lpoly_1.df + p[21] * lpoly_1.df * lpoly_1.df + p[
-	    22] * lpoly_1.dfa + p[30] * (r__1 * r__1);
-    f1 = (p[48] * lpoly_1.dfa + p[20] * lpoly_1.df + p[21] * lpoly_1.df * 
-	    lpoly_1.df) * csw_1.swc[0] + 1.f;
-    f2 = (p[50] * lpoly_1.dfa + p[20] * lpoly_1.df + p[21] * lpoly_1.df * 
-	    lpoly_1.df) * csw_1.swc[0] + 1.f;
+    ttest_2.t[0] = e->t0;
+    f1 = e->f1;
+    f2 = e->f2;
 /*        TIME INDEPENDENT */
     ttest_2.t[1] = p[2] * lpoly_1.plg[2] + p[3] * lpoly_1.plg[4] + p[23] * 
 	    lpoly_1.plg[6] + p[15] * lpoly_1.plg[2] * lpoly_1.dfa * csw_1.swc[
@@ -1911,17 +1896,11 @@ L210:
 	    lpoly_1.c3tloc);
 L220:
 /*          MAGNETIC ACTIVITY BASED ON DAILY AP */
-    if (sw9 == -1.f) {
+    if (ctx->sw9 == -1.f) {
 	goto L30;
     }
-    lpoly_1.apd = ap[1] - 4.f;
-    p44 = p[44];
-    p45 = p[45];
-    if (p44 < 0.f) {
-	p44 = 1e-5f;
-    }
-    lpoly_1.apdf = lpoly_1.apd + (p45 - 1.f) * (lpoly_1.apd + (exp(-p44 * 
-	    lpoly_1.apd) - 1.f) / p44);
+    lpoly_1.apd = ctx->ap[0] - 4.f;
+    lpoly_1.apdf = e->apdf;
     if (csw_1.sw[8] == 0.f) {
 	goto L40;
     }
@@ -1939,13 +1918,6 @@ L30:
     if (exp1 > .99999f) {
 	exp1 = .99999f;
     }
-    exp2 = exp(dabs(p[54]) * -10800.f);
-    if (exp2 > .99999f) {
-	exp2 = .99999f;
-    }
-    if (p[25] < 1e-4f) {
-	p[25] = 1e-4f;
-    }
 /* Computing 3rd power */
     r__1 = exp1;
 /* Computing 4th power */
@@ -1958,46 +1930,12 @@ L30:
     r__5 = exp1, r__6 = r__5, r__5 *= r__5, r__6 *= r__5, r__5 *= r__5, r__5 
 	    *= r__5;
     d__1 = (doublereal) exp1;
-    lpoly_1.apt[0] = (ap[2] - 4.f + (p[26] - 1.f) * (ap[2] - 4.f + (exp(-dabs(
-	    p[25]) * (ap[2] - 4.f)) - 1.f) / dabs(p[25])) + ((ap[3] - 4.f + (
-	    p[26] - 1.f) * (ap[3] - 4.f + (exp(-dabs(p[25]) * (ap[3] - 4.f)) 
-	    - 1.f) / dabs(p[25]))) * exp1 + (ap[4] - 4.f + (p[26] - 1.f) * (
-	    ap[4] - 4.f + (exp(-dabs(p[25]) * (ap[4] - 4.f)) - 1.f) / dabs(p[
-	    25]))) * exp1 * exp1 + (ap[5] - 4.f + (p[26] - 1.f) * (ap[5] - 
-	    4.f + (exp(-dabs(p[25]) * (ap[5] - 4.f)) - 1.f) / dabs(p[25]))) * 
-	    (r__1 * (r__1 * r__1)) + ((ap[6] - 4.f + (p[26] - 1.f) * (ap[6] - 
-	    4.f + (exp(-dabs(p[25]) * (ap[6] - 4.f)) - 1.f) / dabs(p[25]))) * 
-	    (r__2 * r__2) + (ap[7] - 4.f + (p[26] - 1.f) * (ap[7] - 4.f + (
-	    exp(-dabs(p[25]) * (ap[7] - 4.f)) - 1.f) / dabs(p[25]))) * (r__3 *
-	     (r__3 * r__3))) * (1.f - r__4 * r__4) / (1.f - exp1))) / (1.f + (
-	    1.f - r__6 * (r__5 * r__5)) / (1.f - exp1) * pow_dd(&d__1, &
-	    c_b104));
-/* Computing 3rd power */
-    r__1 = exp2;
-/* Computing 4th power */
-    r__2 = exp2, r__2 *= r__2;
-/* Computing 12th power */
-    r__3 = exp2, r__3 *= r__3, r__3 *= r__3;
-/* Computing 8th power */
-    r__4 = exp2, r__4 *= r__4, r__4 *= r__4;
-/* Computing 19th power */
-    r__5 = exp2, r__6 = r__5, r__5 *= r__5, r__6 *= r__5, r__5 *= r__5, r__5 
-	    *= r__5;
-    d__1 = (doublereal) exp2;
-    lpoly_1.apt[2] = (ap[2] - 4.f + (p[26] - 1.f) * (ap[2] - 4.f + (exp(-dabs(
-	    p[25]) * (ap[2] - 4.f)) - 1.f) / dabs(p[25])) + ((ap[3] - 4.f + (
-	    p[26] - 1.f) * (ap[3] - 4.f + (exp(-dabs(p[25]) * (ap[3] - 4.f)) 
-	    - 1.f) / dabs(p[25]))) * exp2 + (ap[4] - 4.f + (p[26] - 1.f) * (
-	    ap[4] - 4.f + (exp(-dabs(p[25]) * (ap[4] - 4.f)) - 1.f) / dabs(p[
-	    25]))) * exp2 * exp2 + (ap[5] - 4.f + (p[26] - 1.f) * (ap[5] - 
-	    4.f + (exp(-dabs(p[25]) * (ap[5] - 4.f)) - 1.f) / dabs(p[25]))) * 
-	    (r__1 * (r__1 * r__1)) + ((ap[6] - 4.f + (p[26] - 1.f) * (ap[6] - 
-	    4.f + (exp(-dabs(p[25]) * (ap[6] - 4.f)) - 1.f) / dabs(p[25]))) * 
-	    (r__2 * r__2) + (ap[7] - 4.f + (p[26] - 1.f) * (ap[7] - 4.f + (
-	    exp(-dabs(p[25]) * (ap[7] - 4.f)) - 1.f) / dabs(p[25]))) * (r__3 *
-	     (r__3 * r__3))) * (1.f - r__4 * r__4) / (1.f - exp2))) / (1.f + (
-	    1.f - r__6 * (r__5 * r__5)) / (1.f - exp2) * pow_dd(&d__1, &
-	    c_b104));
+    lpoly_1.apt[0] = (e->apg[0] + (e->apg[1] * exp1 + e->apg[2] * exp1 * 
+	    exp1 + e->apg[3] * (r__1 * (r__1 * r__1)) + (e->apg[4] * (r__2 * 
+	    r__2) + e->apg[5] * (r__3 * (r__3 * r__3))) * (1.f - r__4 * r__4) 
+	    / (1.f - exp1))) / (1.f + (1.f - r__6 * (r__5 * r__5)) / (1.f - 
+	    exp1) * pow_dd(&d__1, &c_b104));
+    lpoly_1.apt[2] = e->apt2;
     if (csw_1.sw[8] == 0.f) {
 	goto L40;
     }
@@ -2032,9 +1970,9 @@ L230:
     ttest_2.t[11] = (p[96] * lpoly_1.plg[1] + 1.f) * (p[82] * lpoly_1.dfa * 
 	    csw_1.swc[0] + 1.f) * (p[120] * lpoly_1.plg[1] * csw_1.swc[4] * 
 	    cd14 + 1.f) * ((p[69] * lpoly_1.plg[1] + p[70] * lpoly_1.plg[3] + 
-	    p[71] * lpoly_1.plg[5]) * cos(sr * (*sec - p[72])));
+	    p[71] * lpoly_1.plg[5]) * e->cut72);
     ttest_2.t[11] += csw_1.swc[10] * (p[77] * lpoly_1.plg[21] + p[78] * 
-	    lpoly_1.plg[23] + p[79] * lpoly_1.plg[25]) * cos(sr * (*sec - p[
+	    lpoly_1.plg[23] + p[79] * lpoly_1.plg[25]) * cos(sr * (ctx->sec - p[
 	    80]) + dgtr * 2.f * *long__) * (p[138] * lpoly_1.dfa * csw_1.swc[
 	    0] + 1.f);
 L240:
@@ -2042,7 +1980,7 @@ L240:
     if (csw_1.sw[12] == 0.f) {
 	goto L48;
     }
-    if (sw9 == -1.f) {
+    if (ctx->sw9 == -1.f) {
 	goto L45;
     }
     ttest_2.t[12] = lpoly_1.apdf * csw_1.swc[10] * (p[121] * lpoly_1.plg[1] + 
@@ -2052,7 +1990,7 @@ L240:
 	    lpoly_1.plg[10] + p[117] * lpoly_1.plg[12] + p[118] * lpoly_1.plg[
 	    14]) * cd14 * cos(dgtr * (*long__ - p[119])) + lpoly_1.apdf * 
 	    csw_1.swc[11] * (p[84] * lpoly_1.plg[1] + p[85] * lpoly_1.plg[3] 
-	    + p[86] * lpoly_1.plg[5]) * cos(sr * (*sec - p[76]));
+	    + p[86] * lpoly_1.plg[5]) * e->cut76;
     goto L48;
 L45:
     if (p[52] == 0.f) {
@@ -2065,7 +2003,7 @@ L45:
 	    lpoly_1.plg[10] + p[135] * lpoly_1.plg[12] + p[136] * lpoly_1.plg[
 	    14]) * cd14 * cos(dgtr * (*long__ - p[137])) + lpoly_1.apt[0] * 
 	    csw_1.swc[11] * (p[56] * lpoly_1.plg[1] + p[57] * lpoly_1.plg[3] 
-	    + p[58] * lpoly_1.plg[5]) * cos(sr * (*sec - p[59]));
+	    + p[58] * lpoly_1.plg[5]) * e->cut59;
 L48:
 L49:
     ttest_2.tinf = p[31];
@@ -2080,7 +2018,103 @@ L49:
 } /* globe6_ */
 
 /* ----------------------------------------------------------------------- */
-/* Subroutine */ int tselec_0_(int n__, real *sv, real *svv)
+static void globe6t_(msise90_context *ctx, const real *p, 
+	msise90_globe_terms *e)
+{
+    /* Initialized data */
+
+    static real dr = .0172142f;
+    static real sr = 7.2722e-5f;
+
+    /* System generated locals */
+    real r__1, r__2, r__3, r__4, r__5, r__6;
+    doublereal d__1;
+
+    /* Builtin functions */
+    double cos(doublereal), exp(doublereal), pow_dd(doublereal *, 
+	    doublereal *);
+
+    /* Local variables */
+    integer k;
+    real p25, p44, p45, apd, exp2;
+    const real *ap;
+
+/*       Terms of GLOBE6 for coefficient set P that depend only on the */
+/*       day of year, UT, solar flux and magnetic index.  Called by */
+/*       msise90_set_epoch; the expressions are those of GLOBE6. */
+    /* Parameter adjustments */
+    --p;
+    ap = ctx->ap;
+    --ap;
+
+    /* Function Body */
+    e->cd14 = cos(dr * (lpoly_1.day - p[14]));
+    e->cd18 = cos(dr * 2.f * (lpoly_1.day - p[18]));
+    e->cd32 = cos(dr * (lpoly_1.day - p[32]));
+    e->cd39 = cos(dr * 2.f * (lpoly_1.day - p[39]));
+/*         F10.7 EFFECT */
+/* Computing 2nd power */
+    r__1 = lpoly_1.dfa;
+    e->t0 = p[20] * lpoly_1.df + p[21] * lpoly_1.df * lpoly_1.df + p[22] * 
+	    lpoly_1.dfa + p[30] * (r__1 * r__1);
+    e->f1 = (p[48] * lpoly_1.dfa + p[20] * lpoly_1.df + p[21] * lpoly_1.df * 
+	    lpoly_1.df) * csw_1.swc[0] + 1.f;
+    e->f2 = (p[50] * lpoly_1.dfa + p[20] * lpoly_1.df + p[21] * lpoly_1.df * 
+	    lpoly_1.df) * csw_1.swc[0] + 1.f;
+/*        UT */
+    e->cut59 = cos(sr * (ctx->sec - p[59]));
+    e->cut72 = cos(sr * (ctx->sec - p[72]));
+    e->cut76 = cos(sr * (ctx->sec - p[76]));
+/*          MAGNETIC ACTIVITY BASED ON DAILY AP */
+    apd = ap[1] - 4.f;
+    p44 = p[44];
+    p45 = p[45];
+    if (p44 < 0.f) {
+	p44 = 1e-5f;
+    }
+    e->apdf = apd + (p45 - 1.f) * (apd + (exp(-p44 * apd) - 1.f) / p44);
+/*          MAGNETIC ACTIVITY BASED ON 3HR AP */
+/*          The latitude dependent decay rate is applied in GLOBE6 */
+    for (k = 0; k < 6; ++k) {
+	e->apg[k] = 0.;
+    }
+    e->apt2 = 0.f;
+    if (p[52] == 0.f) {
+	return;
+    }
+    exp2 = exp(dabs(p[54]) * -10800.f);
+    if (exp2 > .99999f) {
+	exp2 = .99999f;
+    }
+    p25 = p[25];
+    if (p25 < 1e-4f) {
+	p25 = 1e-4f;
+    }
+    for (k = 0; k < 6; ++k) {
+	e->apg[k] = ap[k + 2] - 4.f + (p[26] - 1.f) * (ap[k + 2] - 4.f + (exp(
+		-dabs(p25) * (ap[k + 2] - 4.f)) - 1.f) / dabs(p25));
+    }
+/* Computing 3rd power */
+    r__1 = exp2;
+/* Computing 4th power */
+    r__2 = exp2, r__2 *= r__2;
+/* Computing 12th power */
+    r__3 = exp2, r__3 *= r__3, r__3 *= r__3;
+/* Computing 8th power */
+    r__4 = exp2, r__4 *= r__4, r__4 *= r__4;
+/* Computing 19th power */
+    r__5 = exp2, r__6 = r__5, r__5 *= r__5, r__6 *= r__5, r__5 *= r__5, r__5 
+	    *= r__5;
+    d__1 = (doublereal) exp2;
+    e->apt2 = (e->apg[0] + (e->apg[1] * exp2 + e->apg[2] * exp2 * exp2 + 
+	    e->apg[3] * (r__1 * (r__1 * r__1)) + (e->apg[4] * (r__2 * r__2) + 
+	    e->apg[5] * (r__3 * (r__3 * r__3))) * (1.f - r__4 * r__4) / (1.f - 
+	    exp2))) / (1.f + (1.f - r__6 * (r__5 * r__5)) / (1.f - exp2) * 
+	    pow_dd(&d__1, &c_b104));
+} /* globe6t_ */
+
+/* ----------------------------------------------------------------------- */
+static int tselec_(msise90_context *ctx, real *sv)
 {
     /* System generated locals */
     real r__1, r__2;
@@ -2089,26 +2123,15 @@ L49:
     double r_mod(real *, real *);
 
     /* Local variables */
-    static integer i__;
-    static real sav[25];
+    integer i__;
 
 /*        SET SWITCHES */
 /*        SW FOR MAIN TERMS, SWC FOR CROSS TERMS */
     /* Parameter adjustments */
-    if (sv) {
-	--sv;
-	}
-    if (svv) {
-	--svv;
-	}
+    --sv;
 
     /* Function Body */
-    switch(n__) {
-	case 1: goto L_tretrv;
-	}
-
     for (i__ = 1; i__ <= 25; ++i__) {
-	sav[i__ - 1] = sv[i__];
 	csw_1.sw[i__ - 1] = r_mod(&sv[i__], &c_b114);
 	if ((r__1 = sv[i__], dabs(r__1)) == 1.f || (r__2 = sv[i__], dabs(r__2)
 		) == 2.f) {
@@ -2120,51 +2143,26 @@ L49:
     }
     csw_1.isw = 64999;
     return 0;
-
-L_tretrv:
-    for (i__ = 1; i__ <= 25; ++i__) {
-	svv[i__] = sav[i__ - 1];
-/* L200: */
-    }
-    return 0;
 } /* tselec_ */
 
-/* Subroutine */ int tselec_(real *sv)
-{
-    return tselec_0_(0, sv, (real *)0);
-    }
-
-/* Subroutine */ int tretrv_(real *svv)
-{
-    return tselec_0_(1, (real *)0, svv);
-    }
-
 /* ----------------------------------------------------------------------- */
-doublereal glob6s_(real *p)
+static doublereal glob6s_(msise90_context *ctx, const real *p, 
+	const msise90_globs_terms *e)
 {
     /* Initialized data */
 
-    static real dr = .0172142f;
-    static real dayl = -1.f;
-    static real p32 = -1e3f;
-    static real p18 = -1e3f;
-    static real p14 = -1e3f;
-    static real p39 = -1e3f;
-
     /* System generated locals */
     real ret_val, r__1;
 
-    /* Builtin functions */
-    double cos(doublereal);
-
     /* Local variables */
-    static integer i__, j;
-    static real t[14], t71, t72, t81, t82, tt, cd32, cd14, cd18, cd39;
+    integer i__, j;
+    real t[14], t71, t72, t81, t82, tt, cd32, cd14, cd18, cd39;
 
 /*      VERSION OF GLOBE FOR LOWER ATMOSPHERE 1/17/90 */
 /*     GMAT Change: Removed DGTR due to warning messages */
 /*     waw 07/12/05 */
 /*      DATA DR/1.72142E-2/,DGTR/1.74533E-2/ */
+/*     GMAT Change: The seasonal terms are set up by msise90_set_epoch */
     /* Parameter adjustments */
     --p;
 
@@ -2173,95 +2171,79 @@ doublereal glob6s_(real *p)
 	t[j - 1] = 0.f;
 /* L10: */
     }
-    if (lpoly_2.day != dayl || p32 != p[32]) {
-	cd32 = cos(dr * (lpoly_2.day - p[32]));
-    }
-    if (lpoly_2.day != dayl || p18 != p[18]) {
-	cd18 = cos(dr * 2.f * (lpoly_2.day - p[18]));
-    }
-    if (lpoly_2.day != dayl || p14 != p[14]) {
-	cd14 = cos(dr * (lpoly_2.day - p[14]));
-    }
-    if (lpoly_2.day != dayl || p39 != p[39]) {
-	cd39 = cos(dr * 2.f * (lpoly_2.day - p[39]));
-    }
-    dayl = lpoly_2.day;
-    p32 = p[32];
-    p18 = p[18];
-    p14 = p[14];
-    p39 = p[39];
+    cd32 = e->cd32;
+    cd18 = e->cd18;
+    cd14 = e->cd14;
+    cd39 = e->cd39;
 
 /*       F10.7 */
-    t[0] = p[22] * lpoly_2.dfa;
+    t[0] = p[22] * lpoly_1.dfa;
 /*       TIME INDEPENDENT */
-    t[1] = p[2] * lpoly_2.plg[2] + p[3] * lpoly_2.plg[4] + p[23] * 
-	    lpoly_2.plg[6] + p[27] * lpoly_2.plg[1] + p[28] * lpoly_2.plg[3] 
-	    + p[29] * lpoly_2.plg[5];
+    t[1] = p[2] * lpoly_1.plg[2] + p[3] * lpoly_1.plg[4] + p[23] * 
+	    lpoly_1.plg[6] + p[27] * lpoly_1.plg[1] + p[28] * lpoly_1.plg[3] 
+	    + p[29] * lpoly_1.plg[5];
 /*       SYMMETRICAL ANNUAL */
-    t[2] = (p[19] + p[48] * lpoly_2.plg[2] + p[30] * lpoly_2.plg[4]) * cd32;
+    t[2] = (p[19] + p[48] * lpoly_1.plg[2] + p[30] * lpoly_1.plg[4]) * cd32;
 /*       SYMMETRICAL SEMIANNUAL */
-    t[3] = (p[16] + p[17] * lpoly_2.plg[2] + p[31] * lpoly_2.plg[4]) * cd18;
+    t[3] = (p[16] + p[17] * lpoly_1.plg[2] + p[31] * lpoly_1.plg[4]) * cd18;
 /*       ASYMMETRICAL ANNUAL */
-    t[4] = (p[10] * lpoly_2.plg[1] + p[11] * lpoly_2.plg[3] + p[36] * 
-	    lpoly_2.plg[5]) * cd14;
+    t[4] = (p[10] * lpoly_1.plg[1] + p[11] * lpoly_1.plg[3] + p[36] * 
+	    lpoly_1.plg[5]) * cd14;
 /*       ASYMMETRICAL SEMIANNUAL */
-    t[5] = p[38] * lpoly_2.plg[1] * cd39;
+    t[5] = p[38] * lpoly_1.plg[1] * cd39;
 /*        DIURNAL */
     if (csw_1.sw[6] == 0.f) {
 	goto L200;
     }
-    t71 = p[12] * lpoly_2.plg[11] * cd14 * csw_1.swc[4];
-    t72 = p[13] * lpoly_2.plg[11] * cd14 * csw_1.swc[4];
-    t[6] = (p[4] * lpoly_2.plg[10] + p[5] * lpoly_2.plg[12] + t71) * 
-	    lpoly_2.ctloc + (p[7] * lpoly_2.plg[10] + p[8] * lpoly_2.plg[12] 
-	    + t72) * lpoly_2.stloc;
+    t71 = p[12] * lpoly_1.plg[11] * cd14 * csw_1.swc[4];
+    t72 = p[13] * lpoly_1.plg[11] * cd14 * csw_1.swc[4];
+    t[6] = (p[4] * lpoly_1.plg[10] + p[5] * lpoly_1.plg[12] + t71) * 
+	    lpoly_1.ctloc + (p[7] * lpoly_1.plg[10] + p[8] * lpoly_1.plg[12] 
+	    + t72) * lpoly_1.stloc;
 L200:
 /*        SEMIDIURNAL */
     if (csw_1.sw[7] == 0.f) {
 	goto L210;
     }
-    t81 = (p[24] * lpoly_2.plg[21] + p[47] * lpoly_2.plg[23]) * cd14 * 
+    t81 = (p[24] * lpoly_1.plg[21] + p[47] * lpoly_1.plg[23]) * cd14 * 
 	    csw_1.swc[4];
-    t82 = (p[34] * lpoly_2.plg[21] + p[49] * lpoly_2.plg[23]) * cd14 * 
+    t82 = (p[34] * lpoly_1.plg[21] + p[49] * lpoly_1.plg[23]) * cd14 * 
 	    csw_1.swc[4];
-    t[7] = (p[6] * lpoly_2.plg[20] + p[42] * lpoly_2.plg[22] + t81) * 
-	    lpoly_2.c2tloc + (p[9] * lpoly_2.plg[20] + p[43] * lpoly_2.plg[22]
-	     + t82) * lpoly_2.s2tloc;
+    t[7] = (p[6] * lpoly_1.plg[20] + p[42] * lpoly_1.plg[22] + t81) * 
+	    lpoly_1.c2tloc + (p[9] * lpoly_1.plg[20] + p[43] * lpoly_1.plg[22]
+	     + t82) * lpoly_1.s2tloc;
 L210:
 /*        TERDIURNAL */
     if (csw_1.sw[13] == 0.f) {
 	goto L220;
     }
-    t[13] = p[40] * lpoly_2.plg[30] * lpoly_2.s3tloc + p[41] * lpoly_2.plg[30]
-	     * lpoly_2.c3tloc;
+    t[13] = p[40] * lpoly_1.plg[30] * lpoly_1.s3tloc + p[41] * lpoly_1.plg[30]
+	     * lpoly_1.c3tloc;
 L220:
 /*       MAGNETIC ACTIVITY */
     if (csw_1.sw[8] == 0.f) {
 	goto L40;
     }
     if (csw_1.sw[8] == 1.f) {
-	t[8] = lpoly_2.apdf * (p[33] + p[46] * lpoly_2.plg[2] * csw_1.swc[1]);
+	t[8] = lpoly_1.apdf * (p[33] + p[46] * lpoly_1.plg[2] * csw_1.swc[1]);
     }
     if (csw_1.sw[8] == -1.f) {
-	t[8] = p[51] * lpoly_2.apt[2] + p[97] * lpoly_2.plg[2] * lpoly_2.apt[
+	t[8] = p[51] * lpoly_1.apt[2] + p[97] * lpoly_1.plg[2] * lpoly_1.apt[
 		2] * csw_1.swc[1];
     }
 L40:
-    if (csw_1.sw[9] == 0.f || csw_1.sw[10] == 0.f || lpoly_2.long__ <= -1e3f) 
+    if (csw_1.sw[9] == 0.f || csw_1.sw[10] == 0.f || lpoly_1.xlong <= -1e3f) 
 	    {
 	goto L49;
     }
 /*        LONGITUDINAL */
-    t[10] = (lpoly_2.plg[1] * (p[81] * csw_1.swc[4] * cos(dr * (lpoly_2.day - 
-	    p[82])) + p[86] * csw_1.swc[5] * cos(dr * 2.f * (lpoly_2.day - p[
-	    87]))) + 1.f + p[84] * csw_1.swc[2] * cos(dr * (lpoly_2.day - p[
-	    85])) + p[88] * csw_1.swc[3] * cos(dr * 2.f * (lpoly_2.day - p[89]
-	    ))) * ((p[65] * lpoly_2.plg[11] + p[66] * lpoly_2.plg[13] + p[67] 
-	    * lpoly_2.plg[15] + p[75] * lpoly_2.plg[10] + p[76] * lpoly_2.plg[
-	    12] + p[77] * lpoly_2.plg[14]) * lpoly_2.clong + (p[91] * 
-	    lpoly_2.plg[11] + p[92] * lpoly_2.plg[13] + p[93] * lpoly_2.plg[
-	    15] + p[78] * lpoly_2.plg[10] + p[79] * lpoly_2.plg[12] + p[80] * 
-	    lpoly_2.plg[14]) * lpoly_2.slong);
+    t[10] = (lpoly_1.plg[1] * e->lon1 + 1.f + e->lon2 + e->lon3) * ((p[65] * 
+	    lpoly_1.plg[11] + p[66] * lpoly_1.plg[13] + p[67] 
+	    * lpoly_1.plg[15] + p[75] * lpoly_1.plg[10] + p[76] * lpoly_1.plg[
+	    12] + p[77] * lpoly_1.plg[14]) * lpoly_1.clong + (p[91] * 
+	    lpoly_1.plg[11] + p[92] * lpoly_1.plg[13] + p[93] * lpoly_1.plg[
+	    15] + p[78] * lpoly_1.plg[10] + p[79] * lpoly_1.plg[12] + p[80] * 
+	    lpoly_1.plg[14]) * lpoly_1.slong);
 L49:
     tt = 0.f;
     for (i__ = 1; i__ <= 14; ++i__) {
@@ -2272,8 +2254,37 @@ L49:
     return ret_val;
 } /* glob6s_ */
 
+/* ----------------------------------------------------------------------- */
+static void glob6st_(msise90_context *ctx, const real *p, 
+	msise90_globs_terms *e)
+{
+    /* Initialized data */
+
+    static real dr = .0172142f;
+
+    /* Builtin functions */
+    double cos(doublereal);
+
+/*       Terms of GLOB6S for coefficient set P that depend only on the */
+/*       day of year.  Called by msise90_set_epoch. */
+    /* Parameter adjustments */
+    --p;
+
+    /* Function Body */
+    e->cd32 = cos(dr * (lpoly_1.day - p[32]));
+    e->cd18 = cos(dr * 2.f * (lpoly_1.day - p[18]));
+    e->cd14 = cos(dr * (lpoly_1.day - p[14]));
+    e->cd39 = cos(dr * 2.f * (lpoly_1.day - p[39]));
+/*        Seasonal factors of the longitudinal term */
+    e->lon1 = p[81] * csw_1.swc[4] * cos(dr * (lpoly_1.day - p[82])) + p[86]
+	     * csw_1.swc[5] * cos(dr * 2.f * (lpoly_1.day - p[87]));
+    e->lon2 = p[84] * csw_1.swc[2] * cos(dr * (lpoly_1.day - p[85]));
+    e->lon3 = p[88] * csw_1.swc[3] * cos(dr * 2.f * (lpoly_1.day - p[89]));
+} /* glob6st_ */
+
 /* -------------------------------------------------------------------- */
-doublereal densu_(real *alt, real *dlb, real *tinf, real *tlb, real *xm, real 
+static doublereal densu_(msise90_context *ctx, real *alt, real *dlb, real 
+	*tinf, real *tlb, real *xm, real 
 	*alpha, real *tz, real *zlb, real *s2, integer *mn1, real *zn1, real *
 	tn1, real *tgn1)
 {
@@ -2290,15 +2301,11 @@ doublereal densu_(real *alt, real *dlb, real *tinf, real *tlb, real *xm, real
     double exp(doublereal), pow_dd(doublereal *, doublereal *);
 
     /* Local variables */
-    static integer k;
-    static real x, y, z__, t1, t2, z1, z2, ta, za;
-    static integer mn;
-    static real zg, yi, tt, xs[5], ys[5], yd1, yd2, zg2, glb, dta, gamm, expl,
-	     y2out[5], gamma, densa, zgdif;
-    extern /* Subroutine */ int spline_(real *, real *, integer *, real *, 
-	    real *, real *), splini_(real *, real *, real *, integer *, real *
-	    , real *), splint_(real *, real *, real *, integer *, real *, 
-	    real *);
+    integer k;
+    real x, y, z__, t1 = 0.f, t2, z1 = 0.f, z2, ta, za;
+    integer mn;
+    real zg, yi, tt, xs[5], ys[5], yd1, yd2, zg2, glb, dta, gamm, expl,
+	     y2out[5], gamma, densa, zgdif = 0.f;
 
 /*       Calculate Temperature and Density Profiles for MSIS models */
 /*       New lower thermo polynomial 10/30/89 */
@@ -2405,7 +2412,8 @@ L50:
 } /* densu_ */
 
 /* -------------------------------------------------------------------- */
-doublereal densm_(real *alt, real *d0, real *xm, real *tz, integer *mn3, real 
+static doublereal densm_(msise90_context *ctx, real *alt, real *d0, real *xm, 
+	real *tz, integer *mn3, real 
 	*zn3, real *tn3, real *tgn3, integer *mn2, real *zn2, real *tn2, real 
 	*tgn2)
 {
@@ -2421,37 +2429,33 @@ doublereal densm_(real *alt, real *d0, real *xm, real *tz, integer *mn3, real
     double exp(doublereal);
 
     /* Local variables */
-    static integer k;
-    static real x, y, z__, t1, t2, z1, z2;
-    static integer mn;
-    static real zg, yi, xs[10], ys[10], yd1, yd2, glb, gamm, expl, y2out[10], 
+    integer k;
+    real x, y, z__, t1, t2, z1, z2;
+    integer mn;
+    real zg, yi, xs[10], ys[10], yd1, yd2, glb, gamm, expl, y2out[10], 
 	    zgdif;
-    extern /* Subroutine */ int spline_(real *, real *, integer *, real *, 
-	    real *, real *), splini_(real *, real *, real *, integer *, real *
-	    , real *), splint_(real *, real *, real *, integer *, real *, 
-	    real *);
 
 /*       Calculate Temperature and Density Profiles for lower atmos. */
     /* Parameter adjustments */
+/*       ZN3 and ZN2 are the static node arrays of GTD6, so they are */
+/*       indexed from 0 rather than moved ahead of their storage */
     --tn3;
-    --zn3;
     --tgn3;
     --tn2;
-    --zn2;
     --tgn2;
 
     /* Function Body */
     ret_val = *d0;
-    if (*alt > zn2[1]) {
+    if (*alt > zn2[0]) {
 	goto L50;
     }
 /*      STRATOSPHERE/MESOSPHERE TEMPERATURE */
 /* Computing MAX */
-    r__1 = *alt, r__2 = zn2[*mn2];
+    r__1 = *alt, r__2 = zn2[*mn2 - 1];
     z__ = dmax(r__1,r__2);
     mn = *mn2;
-    z1 = zn2[1];
-    z2 = zn2[mn];
+    z1 = zn2[0];
+    z2 = zn2[mn - 1];
     t1 = tn2[1];
     t2 = tn2[mn];
     zg = (z__ - z1) * (parmb_1.re + z1) / (parmb_1.re + z__);
@@ -2459,8 +2463,8 @@ doublereal densm_(real *alt, real *d0, real *xm, real *tz, integer *mn3, real
 /*       Set up spline nodes */
     i__1 = mn;
     for (k = 1; k <= i__1; ++k) {
-	xs[k - 1] = (zn2[k] - z1) * (parmb_1.re + z1) / (parmb_1.re + zn2[k]) 
-		/ zgdif;
+	xs[k - 1] = (zn2[k - 1] - z1) * (parmb_1.re + z1) / 
+		(parmb_1.re + zn2[k - 1]) / zgdif;
 	ys[k - 1] = 1.f / tn2[k];
 /* L210: */
     }
@@ -2492,15 +2496,15 @@ doublereal densm_(real *alt, real *d0, real *xm, real *tz, integer *mn3, real
 /*       Density at altitude */
     ret_val = ret_val * (t1 / *tz) * exp(-expl);
 L20:
-    if (*alt > zn3[1]) {
+    if (*alt > zn3[0]) {
 	goto L50;
     }
 
 /*      TROPOSPHERE/STRATOSPHERE TEMPERATURE */
     z__ = *alt;
     mn = *mn3;
-    z1 = zn3[1];
-    z2 = zn3[mn];
+    z1 = zn3[0];
+    z2 = zn3[mn - 1];
     t1 = tn3[1];
     t2 = tn3[mn];
     zg = (z__ - z1) * (parmb_1.re + z1) / (parmb_1.re + z__);
@@ -2508,8 +2512,8 @@ L20:
 /*       Set up spline nodes */
     i__1 = mn;
     for (k = 1; k <= i__1; ++k) {
-	xs[k - 1] = (zn3[k] - z1) * (parmb_1.re + z1) / (parmb_1.re + zn3[k]) 
-		/ zgdif;
+	xs[k - 1] = (zn3[k - 1] - z1) * (parmb_1.re + z1) / 
+		(parmb_1.re + zn3[k - 1]) / zgdif;
 	ys[k - 1] = 1.f / tn3[k];
 /* L220: */
     }
@@ -2550,15 +2554,15 @@ L50:
 } /* densm_ */
 
 /* ----------------------------------------------------------------------- */
-/* Subroutine */ int spline_(real *x, real *y, integer *n, real *yp1, real *
+static int spline_(real *x, real *y, integer *n, real *yp1, real *
 	ypn, real *y2)
 {
     /* System generated locals */
     integer i__1;
 
     /* Local variables */
-    static integer i__, k;
-    static real p, u[100], qn, un, sig;
+    integer i__, k;
+    real p, u[100], qn, un, sig;
 
 /*        CALCULATE 2ND DERIVATIVES OF CUBIC SPLINE INTERP FUNCTION */
 /*        ADAPTED FROM NUMERICAL RECIPES BY PRESS ET AL */
@@ -2607,7 +2611,7 @@ L50:
 } /* spline_ */
 
 /* ----------------------------------------------------------------------- */
-/* Subroutine */ int splint_(real *xa, real *ya, real *y2a, integer *n, real *
+static int splint_(real *xa, real *ya, real *y2a, integer *n, real *
 	x, real *y)
 {
     /* Builtin functions */
@@ -2615,8 +2619,8 @@ L50:
 	    e_wsle(void);
 
     /* Local variables */
-    static real a, b, h__;
-    static integer k, khi, klo;
+    real a, b, h__;
+    integer k, khi, klo;
 
     /* Fortran I/O blocks */
     static cilist io___241 = { 0, 6, 0, 0, 0 };
@@ -2661,15 +2665,15 @@ L1:
 } /* splint_ */
 
 /* ----------------------------------------------------------------------- */
-/* Subroutine */ int splini_(real *xa, real *ya, real *y2a, integer *n, real *
+static int splini_(real *xa, real *ya, real *y2a, integer *n, real *
 	x, real *yi)
 {
     /* System generated locals */
     real r__1, r__2;
 
     /* Local variables */
-    static real a, b, h__, a2, b2, xx;
-    static integer khi, klo;
+    real a, b, h__, a2, b2, xx;
+    integer khi, klo;
 
 /*       INTEGRATE CUBIC SPLINE FUNCTION FROM XA(1) TO X */
 /*        XA,YA: ARRAYS OF TABULATED FUNCTION IN ASCENDING ORDER BY X */
@@ -2710,7 +2714,7 @@ L1:
 } /* splini_ */
 
 /* ----------------------------------------------------------------------- */
-doublereal dnet_(real *dd, real *dm, real *zhm, real *xmm, real *xm)
+static doublereal dnet_(real *dd, real *dm, real *zhm, real *xmm, real *xm)
 {
     /* System generated locals */
     real ret_val;
@@ -2723,7 +2727,7 @@ doublereal dnet_(real *dd, real *dm, real *zhm, real *xmm, real *xm)
 	    );
 
     /* Local variables */
-    static real a, ylog;
+    real a, ylog;
 
     /* Fortran I/O blocks */
     static cilist io___253 = { 0, 6, 0, 0, 0 };
@@ -2780,7 +2784,7 @@ L50:
 } /* dnet_ */
 
 /* ----------------------------------------------------------------------- */
-doublereal ccor_(real *alt, real *r__, real *h1, real *zh)
+static doublereal ccor_(real *alt, real *r__, real *h1, real *zh)
 {
     /* System generated locals */
     real ret_val;
@@ -2789,7 +2793,7 @@ doublereal ccor_(real *alt, real *r__, real *h1, real *zh)
     double exp(doublereal);
 
     /* Local variables */
-    static real e, ex;
+    real e, ex;
 
 /*        CHEMISTRY/DISSOCIATION CORRECTION FOR MSIS MODELS */
 /*        ALT - altitude */
@@ -0,0 +1,142 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                                msise90_sub
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Reentrant interface to the f2c translation of the MSISE-90 model in
+ * msise90_sub.c.
+ *
+ * Everything the FORTRAN code kept in COMMON blocks and SAVEd locals lives in
+ * an msise90_context, so each caller owns its model state.  The altitude
+ * independent solar, seasonal and geomagnetic terms of every coefficient set
+ * are evaluated once per epoch by msise90_set_epoch(); msise90_density() and
+ * msise90_density_batch() then evaluate positions at that epoch.
+ *
+ * This header is included from both C and C++, so it uses the plain C types
+ * that the f2c "real" and "integer" types map to.
+ */
+//------------------------------------------------------------------------------
+#ifndef msise90_sub_hpp
+#define msise90_sub_hpp
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/// Number of GLOBE6 coefficient sets: PT, PS and the eight PD sets in use
+#define MSISE90_GLOBE_SETS 10
+/// Number of GLOB6S coefficient sets: the four PTL and ten PMA sets
+#define MSISE90_GLOBS_SETS 14
+
+/// Per epoch terms of one GLOBE6 coefficient set
+typedef struct
+{
+   float  cd14, cd18, cd32, cd39;   // Annual and semiannual cosines
+   float  t0, f1, f2;               // F10.7 terms
+   float  apdf;                     // Daily Ap function
+   double apg[6];                   // Ap function of the 3 hour Ap values
+   float  apt2;                     // 3 hour Ap history at the UT decay rate
+   double cut59, cut72, cut76;      // UT cosines
+} msise90_globe_terms;
+
+/// Per epoch terms of one GLOB6S coefficient set
+typedef struct
+{
+   float  cd14, cd18, cd32, cd39;   // Annual and semiannual cosines
+   double lon1, lon2, lon3;         // Seasonal factors of the longitude term
+} msise90_globs_terms;
+
+/// Past inputs used to detect unchanged calls (FORTRAN function VTST)
+typedef struct
+{
+   int   iyd;
+   float sec, glat, glong, stl, f107a, f107, ap[7], sw[25], swc[25];
+} msise90_inputs;
+
+/// Complete state of one MSISE-90 evaluator
+typedef struct
+{
+   // Former COMMON blocks
+   struct
+   {
+      float tlb, s, db04, db16, db28, db32, db40, db48, db01, za, t0, z0, g0,
+            rl, dd, db14, tr12;
+   } gts3c;
+   struct
+   {
+      float tn1[5], tn2[4], tn3[5], tgn1[2], tgn2[2], tgn3[2];
+   } meso6;
+   struct
+   {
+      float sw[25];
+      int   isw;
+      float swc[25];
+   } csw;
+   struct
+   {
+      float dm04, dm16, dm28, dm32, dm40, dm01, dm14;
+   } dmix;
+   struct
+   {
+      float gsurf, re;
+   } parmb;
+   struct
+   {
+      float tinf, gb, rout, t[15];
+   } ttest;
+   struct
+   {
+      float plg[36], ctloc, stloc, c2tloc, s2tloc, c3tloc, s3tloc;
+      int   iyr;
+      float day, df, dfa, apd, apdf, apt[4], xlong, clong, slong;
+   } lpoly;
+   int   imr;
+
+   // Former SAVEd locals
+   float gtd6Alast, gts6Alast, tinf, dm28m, d6[8], t6[2];
+   int   mssl;
+   float sv[25];
+   float sw9, xl, tll, longl;
+   msise90_inputs last[2];
+
+   // Epoch inputs and the terms built from them
+   int   epochSet;
+   int   iyd;
+   float sec, f107a, f107, ap[7];
+   double czhf;
+   msise90_globe_terms globe[MSISE90_GLOBE_SETS];
+   msise90_globs_terms globs[MSISE90_GLOBS_SETS];
+} msise90_context;
+
+void msise90_init(msise90_context *ctx);
+void msise90_meter(msise90_context *ctx, int meter);
+void msise90_set_epoch(msise90_context *ctx, int iyd, float sec, float f107a,
+                       float f107, const float *ap);
+void msise90_density(msise90_context *ctx, float alt, float glat, float glong,
+                     float stl, int mass, float *d, float *t);
+void msise90_density_batch(msise90_context *ctx, int count, const float *alt,
+                           const float *glat, const float *glong,
+                           const float *stl, float *rho);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // msise90_sub_hpp
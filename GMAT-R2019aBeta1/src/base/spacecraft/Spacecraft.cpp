@@ -2809,60 +2809,21 @@ Integer Spacecraft::GetParameterID(const std::string &str) const
    MessageInterface::ShowMessage("In SC::GetParameterID, str = %s\n", str.c_str());
    #endif
 
+   static const ParameterIndex labelIndex = BuildParameterIndex();
+
    try
    {
-      // handle AddHardware parameter:
-      if (str == "AddHardware")
-         return ADD_HARDWARE;
-
-      // first check the multiple reps
-      Integer sz = EndMultipleReps - CART_X;
-      for (Integer ii = 0; ii < sz; ii++)
-      {
-         if (str == MULT_REP_STRINGS[ii])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            "In SC::GetParameterID, multiple reps found!! - str = %s and id = %d\n ",
-            str.c_str(), (ii + CART_X));
-            #endif
-            return ii + CART_X;
-         }
-      }
-
-      // Check for element label
-      for (Integer i = SpaceObjectParamCount; i < SpacecraftParamCount; ++i)
+      // Fixed labels: multiple reps, element labels and their aliases
+      Integer id = FindParameterIndex(labelIndex, str);
+      if (id != -1)
       {
-         if (str == PARAMETER_LABEL[i - SpaceObjectParamCount])
-         {
-            #ifdef DEBUG_GET_REAL
-            MessageInterface::ShowMessage(
-            "In SC::GetParameterID, getting id %d for str = %s\n ",
-            i, str.c_str());
-            #endif
-            return i;
-         }
+         #ifdef DEBUG_GET_REAL
+         MessageInterface::ShowMessage(
+         "In SC::GetParameterID, getting id %d for str = %s\n ",
+         id, str.c_str());
+         #endif
+         return id;
       }
-      if ((str == "STM") || (str == "OrbitSTM"))
-         return FULL_STM;
-
-      if ((str == "AMatrix") || (str == "OrbitAMatrix"))
-         return FULL_A_MATRIX;
-
-//      if (str == "STM")
-//         return ORBIT_STM;
-//
-//      if (str == "AMatrix")
-//         return ORBIT_A_MATRIX;
-
-      if ((str == "CartesianState") || (str == "CartesianX")) return CARTESIAN_X;
-      if (str == "CartesianY" )  return CARTESIAN_Y;
-      if (str == "CartesianZ" )  return CARTESIAN_Z;
-      if (str == "CartesianVX")  return CARTESIAN_VX;
-      if (str == "CartesianVY")  return CARTESIAN_VY;
-      if (str == "CartesianVZ")  return CARTESIAN_VZ;
-
-      if (str == "KeplerianState") return CARTESIAN_X;
 
       // Could be an external solve-for parameter
       for (UnsignedInt i = 0; i < externalStmEntries.size(); ++i)
@@ -8651,6 +8612,47 @@ bool Spacecraft::SetElement(const std::string &label, const Real &value)
 }
 
 
+//------------------------------------------------------------------------------
+// static ParameterIndex BuildParameterIndex()
+//------------------------------------------------------------------------------
+/**
+ * Builds the lookup table for the fixed Spacecraft parameter labels.
+ *
+ * Entries are added in the order GetParameterID() used to test them, so a
+ * label that appears more than once keeps the ID it had before.  Labels that
+ * depend on the configuration (hardware names, external STM entries) are
+ * still checked in GetParameterID().
+ *
+ * @return The lookup table
+ */
+//------------------------------------------------------------------------------
+GmatBase::ParameterIndex Spacecraft::BuildParameterIndex()
+{
+   ParameterIndex index;
+
+   index.insert(std::make_pair(std::string("AddHardware"), (Integer)ADD_HARDWARE));
+   AddToParameterIndex(index, MULT_REP_STRINGS, EndMultipleReps - CART_X, CART_X);
+   AddToParameterIndex(index, PARAMETER_LABEL,
+         SpacecraftParamCount - SpaceObjectParamCount, SpaceObjectParamCount);
+
+   index.insert(std::make_pair(std::string("STM"), (Integer)FULL_STM));
+   index.insert(std::make_pair(std::string("OrbitSTM"), (Integer)FULL_STM));
+   index.insert(std::make_pair(std::string("AMatrix"), (Integer)FULL_A_MATRIX));
+   index.insert(std::make_pair(std::string("OrbitAMatrix"), (Integer)FULL_A_MATRIX));
+
+   index.insert(std::make_pair(std::string("CartesianState"), (Integer)CARTESIAN_X));
+   index.insert(std::make_pair(std::string("CartesianX"), (Integer)CARTESIAN_X));
+   index.insert(std::make_pair(std::string("CartesianY"), (Integer)CARTESIAN_Y));
+   index.insert(std::make_pair(std::string("CartesianZ"), (Integer)CARTESIAN_Z));
+   index.insert(std::make_pair(std::string("CartesianVX"), (Integer)CARTESIAN_VX));
+   index.insert(std::make_pair(std::string("CartesianVY"), (Integer)CARTESIAN_VY));
+   index.insert(std::make_pair(std::string("CartesianVZ"), (Integer)CARTESIAN_VZ));
+   index.insert(std::make_pair(std::string("KeplerianState"), (Integer)CARTESIAN_X));
+
+   return index;
+}
+
+
 //------------------------------------------------------------------------------
 // void LookUpLabel(std::string rep, Rvector6 &st)
 //------------------------------------------------------------------------------
@@ -8707,7 +8709,7 @@ Integer Spacecraft::LookUpLabel(const std::string &label, std::string &rep)
    bool done = false;
    for (iter = stateElementLabelsMap.begin(); iter != stateElementLabelsMap.end(); ++iter)
    {
-      StringArray labels = (*iter).second;
+      const StringArray &labels = (*iter).second;
       for (UnsignedInt i = 0; i < labels.size(); i++)
       {
          #ifdef DEBUG_LOOK_UP_LABEL_MORE
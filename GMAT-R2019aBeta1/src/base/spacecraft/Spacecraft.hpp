@@ -773,6 +773,8 @@ protected:
    void              RecomputeStateAtEpochGT(const GmatTime &toEpoch);
 
 private:
+   static ParameterIndex BuildParameterIndex();
+
    bool              VerifyAddHardware();
    Integer           NumStateElementsSet();
    void              SetPossibleInputTypes(const std::string& label, const std::string &rep);
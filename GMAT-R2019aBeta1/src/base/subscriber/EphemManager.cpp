@@ -46,6 +46,14 @@
 #include "StringUtil.hpp"
 #include "TimeTypes.hpp"
 #include "GmatConstants.hpp"
+#include "TrajectoryStore.hpp"
+#include "ChebyshevEphemerisFile.hpp"
+#include "BodyFixedPoint.hpp"
+#include "RealUtilities.hpp"
+#include "RunProfiler.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
 #ifdef __USE_SPICE__
    #include "SpiceInterface.hpp"
 #endif
@@ -59,11 +67,47 @@
 //#define DEBUG_EM_TIME_SPENT
 //#define DEBUG_EM_TIME_ADJUST
 //#define DEBUG_EM_FILENAME
+//#define DEBUG_NATIVE_SEARCH
+
+/// Profiler counter for this file
+static const Integer EVENT_FUNCTION_CALLS =
+      RunProfiler::RegisterCounter("Event Function Evaluations");
 
 #ifdef DEBUG_EM_TIME_SPENT
 #include <time.h>
 #endif
 
+//------------------------------------------------------------------------------
+// static data
+//------------------------------------------------------------------------------
+
+/// Node spacing (s) for the body and station tables of the parallel searches
+const Real EphemManager::SEARCH_TABLE_STEP = 300.0;
+/// Factor applied to the station speed and zenith rate, which change only
+/// through precession, nutation and polar motion
+const Real EphemManager::SPEED_BOUND_MARGIN = 1.2;
+/// Spacing (s) of the body speed samples used for the speed bounds
+const Real EphemManager::SPEED_SAMPLE_STEP = 3600.0;
+/// Shortest span (s) checked for events between samples of the search
+const Real EphemManager::MIN_SEARCH_SPAN = 1.0;
+
+
+//------------------------------------------------------------------------------
+// struct SearchQueue
+//------------------------------------------------------------------------------
+/**
+ * Work queue for the parallel contact searches.  Threads take the next task
+ * index from the counter until the tasks run out; each task writes only its
+ * own entry, so no other locking is needed.
+ */
+//------------------------------------------------------------------------------
+struct EphemManager::SearchQueue
+{
+   std::vector<SearchTask>   *tasks;
+   Real                      stepSize;
+   std::atomic<UnsignedInt>  next;
+};
+
 
 /**
  * Manager for ephemeris recording for the specified object
@@ -90,7 +134,11 @@ EphemManager::EphemManager(bool deleteFiles) :
    intStart               (0.0),
    intStop                (0.0),
    coverStart             (0.0),
-   coverStop              (0.0)
+   coverStop              (0.0),
+   trajectory             (new TrajectoryStore()),
+   fileTrajectory         (NULL),
+   trajectoryFile         (""),
+   useNativeSearch        (false)
 {
 #ifdef __USE_SPICE__
    spice = NULL;
@@ -153,6 +201,8 @@ EphemManager::~EphemManager()
    #endif
    // delete the current EphemerisFile
    if (ephemFile) delete ephemFile;
+   delete trajectory;
+   if (fileTrajectory) delete fileTrajectory;
    #ifdef DEBUG_EPHEM_MANAGER
       MessageInterface::ShowMessage("Destructing EphemManager ... deleting spice\n");
    #endif
@@ -187,8 +237,15 @@ EphemManager::EphemManager(const EphemManager& copy) :
    intStart               (copy.intStart),
    intStop                (copy.intStop),
    coverStart             (copy.coverStart),
-   coverStop              (copy.coverStop)
+   coverStop              (copy.coverStop),
+   trajectory             (new TrajectoryStore(*copy.trajectory)),
+   fileTrajectory         (NULL),
+   trajectoryFile         (copy.trajectoryFile),
+   useNativeSearch        (copy.useNativeSearch)
 {
+   if (copy.fileTrajectory)
+      fileTrajectory = new TrajectoryStore(*copy.fileTrajectory);
+
    #ifdef __USE_SPICE__
       spice = NULL;
       cover = NULL;
@@ -222,6 +279,13 @@ EphemManager& EphemManager::operator=(const EphemManager& copy)
    intStop                  = copy.intStop;
    coverStart               = copy.coverStart;
    coverStop                = copy.coverStop;
+   *trajectory              = *copy.trajectory;
+   if (fileTrajectory) delete fileTrajectory;
+   fileTrajectory           = NULL;
+   if (copy.fileTrajectory)
+      fileTrajectory        = new TrajectoryStore(*copy.fileTrajectory);
+   trajectoryFile           = copy.trajectoryFile;
+   useNativeSearch          = copy.useNativeSearch;
 
    #ifdef __USE_SPICE__
       if (spice) delete spice;
@@ -341,6 +405,8 @@ bool EphemManager::RecordEphemerisData()
          ephemFile->Initialize();
          ephemFile->TakeAction("ToggleOn");
          ephemFile->SetBackgroundGeneration(true);
+         // Keep a copy of the states in memory for the event searches
+         ephemFile->SetTrajectoryStore(trajectory);
 
          // Subscribe to the data
          Publisher *pub = Publisher::Instance();
@@ -550,6 +616,36 @@ bool EphemManager::GetOccultationIntervals(const std::string &occType,
 {
    Spacecraft  *theSc       = (Spacecraft*) theObj;
 
+   // Search the in-memory trajectory if we can
+   if (CanSearchNatively(abCorrection))
+   {
+      EventFunction ef;
+      ef.type         = OCCULTATION_EVENT;
+      ef.occType      = occType;
+      ef.front        = FindBody(frontBody);
+      ef.back         = FindBody(backBody);
+      ef.station      = NULL;
+      ef.stationFrame = NULL;
+      ef.minElevation = 0.0;
+      ef.useLightTime = (GmatStringUtil::ToUpper(abCorrection) != "NONE");
+      ef.transmit     = (GmatStringUtil::ToUpper(abCorrection)[0] == 'X');
+
+      if ((ef.front != NULL) && (ef.back != NULL))
+      {
+         GetBodyShape(ef.front, ef.frontShape);
+         GetBodyShape(ef.back, ef.backShape);
+
+         RealArray winStarts, winEnds, found, foundEnds;
+         GetNativeSearchWindow(s, e, useEntireIntvl, winStarts, winEnds);
+         FindNativeIntervals(ef, winStarts, winEnds, stepSize, found,
+                             foundEnds);
+         starts.insert(starts.end(), found.begin(), found.end());
+         ends.insert(ends.end(), foundEnds.begin(), foundEnds.end());
+         numIntervals = (Integer) found.size();
+         return true;
+      }
+   }
+
    #ifndef __USE_SPICE__
       std::string errmsg = "ERROR - cannot compute occultation intervals for spacecraft ";
       errmsg += theSc->GetName() + " without SPICE included in build!\n";
@@ -682,7 +778,8 @@ bool EphemManager::GetOccultationIntervals(const std::string &occType,
 //                                Real              stepSize,
 //                                Integer           &numIntervals,
 //                                RealArray         &starts,
-//                                RealArray         &ends)
+//                                RealArray         &ends,
+//                                GmatBase          *observer = NULL)
 //------------------------------------------------------------------------------
 /**
  * This method determines the contact intervals given the input observer,
@@ -702,6 +799,8 @@ bool EphemManager::GetOccultationIntervals(const std::string &occType,
  * @param numIntervals       number of intervals returned (output)
  * @param starts             array of start times for the intervals (output)
  * @param ends               array of end times for the intervals (output)
+ * @param observer           the observing station; when it is set, the
+ *                           search may use the in-memory trajectory
  *
  * Note: initial implementation by Yeerang Lim/KAIST
  *
@@ -720,10 +819,54 @@ bool EphemManager::GetContactIntervals(const std::string &observerID,
                                        Real              stepSize,
                                        Integer           &numIntervals,
                                        RealArray         &starts,
-                                       RealArray         &ends)
+                                       RealArray         &ends,
+                                       GmatBase          *observer)
 {
    Spacecraft  *theSc       = (Spacecraft*) theObj;
 
+   // Search the in-memory trajectory if we can
+   if ((observer != NULL) && CanSearchNatively(abCorrection))
+   {
+      EventFunction ef;
+      ef.type         = ELEVATION_EVENT;
+      ef.front        = NULL;
+      ef.back         = NULL;
+      ef.minElevation = minElevation * GmatMathConstants::RAD_PER_DEG;
+      ef.useLightTime = (GmatStringUtil::ToUpper(abCorrection) != "NONE");
+      ef.transmit     = (GmatStringUtil::ToUpper(abCorrection)[0] == 'X');
+
+      RealArray winStarts, winEnds;
+      GetNativeSearchWindow(s, e, useEntireIntvl, winStarts, winEnds);
+      if (SetUpStation(ef, observer))
+      {
+         RealArray visStarts, visEnds;
+         TrimForLightTime(ef, winStarts, winEnds);
+         FindNativeIntervals(ef, winStarts, winEnds, stepSize, visStarts,
+                             visEnds);
+
+         // Remove the times when a body blocks the line of sight
+         ef.type = BLOCKED_EVENT;
+         for (unsigned int ii = 0; ii < occultingBodyNames.size(); ii++)
+         {
+            if (visStarts.empty())
+               break;
+            ef.front = solarSys->GetBody(occultingBodyNames.at(ii));
+            if (ef.front == NULL)
+               continue;
+            GetBodyShape(ef.front, ef.frontShape);
+            RealArray blockStarts, blockEnds;
+            FindNativeIntervals(ef, visStarts, visEnds, stepSize, blockStarts,
+                                blockEnds);
+            SubtractIntervals(visStarts, visEnds, blockStarts, blockEnds);
+         }
+
+         starts.insert(starts.end(), visStarts.begin(), visStarts.end());
+         ends.insert(ends.end(), visEnds.begin(), visEnds.end());
+         numIntervals = (Integer) visStarts.size();
+         return true;
+      }
+   }
+
 #ifndef __USE_SPICE__
    std::string errmsg = "ERROR - cannot compute contact intervals for spacecraft ";
    errmsg += theSc->GetName() + " without SPICE included in build!\n";
@@ -966,6 +1109,178 @@ bool EphemManager::GetContactIntervals(const std::string &observerID,
 
 
 
+//------------------------------------------------------------------------------
+// bool GetContactIntervals(const ObjectArray &observers,
+//         const RealArray &minElevations,
+//         const std::vector<StringArray> &occultingBodyNames,
+//         const std::string &abCorrection, Real s, Real e,
+//         bool useEntireIntvl, Real stepSize, Integer numThreads,
+//         std::vector<RealArray> &starts, std::vector<RealArray> &ends)
+//------------------------------------------------------------------------------
+/**
+ * This method determines the contact intervals for a set of stations using
+ * the in-memory trajectory, running the searches on several threads.
+ *
+ * The body and station states are tabulated once, on the calling thread, and
+ * the searches read only those tables and the recorded trajectory.  The
+ * elevation search for each station is one task; the line of sight search
+ * for each station and occulting body is another, run once the elevation
+ * results are in.  The results do not depend on the number of threads.
+ *
+ * @param observers          the observing stations
+ * @param minElevations      minimum elevation of each station (deg)
+ * @param occultingBodyNames occulting bodies for each station
+ * @param abCorrection       aberration correction
+ * @param s                  start time
+ * @param e                  end time
+ * @param useEntireIntvl     the flag to use entire available interval
+ * @param stepSize           stepsize
+ * @param numThreads         number of search threads; 0 or less uses one
+ *                           per processor
+ * @param starts             start times of each station's intervals (output)
+ * @param ends               end times of each station's intervals (output)
+ *
+ * @return true if the searches were run; false if a station or the
+ *         correction needs the SPICE searches instead
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::GetContactIntervals(const ObjectArray &observers,
+                                       const RealArray &minElevations,
+                                       const std::vector<StringArray>
+                                               &occultingBodyNames,
+                                       const std::string &abCorrection,
+                                       Real              s,
+                                       Real              e,
+                                       bool              useEntireIntvl,
+                                       Real              stepSize,
+                                       Integer           numThreads,
+                                       std::vector<RealArray> &starts,
+                                       std::vector<RealArray> &ends)
+{
+   if (!CanSearchNatively(abCorrection))
+      return false;
+
+   UnsignedInt numStations = observers.size();
+   std::vector<EventFunction> stationEvents(numStations);
+   for (UnsignedInt jj = 0; jj < numStations; jj++)
+   {
+      EventFunction &ef = stationEvents[jj];
+      ef.type         = ELEVATION_EVENT;
+      ef.minElevation = minElevations.at(jj) * GmatMathConstants::RAD_PER_DEG;
+      ef.useLightTime = (GmatStringUtil::ToUpper(abCorrection) != "NONE");
+      ef.transmit     = (GmatStringUtil::ToUpper(abCorrection)[0] == 'X');
+      if (!SetUpStation(ef, observers[jj]))
+         return false;
+   }
+
+   starts.assign(numStations, RealArray());
+   ends.assign(numStations, RealArray());
+
+   RealArray winStarts, winEnds;
+   if (!GetNativeSearchWindow(s, e, useEntireIntvl, winStarts, winEnds))
+      return true;
+
+   // Tabulate the stations across the window
+   std::vector<TrajectoryStore> stationTables(numStations);
+   std::vector<TrajectoryStore> zenithTables(numStations);
+   Real farthestStation = 0.0;
+   for (UnsignedInt jj = 0; jj < numStations; jj++)
+   {
+      EventFunction &ef = stationEvents[jj];
+      TabulateStation(ef, intStart, intStop, stationTables[jj],
+                      zenithTables[jj]);
+      ef.stationTable = &stationTables[jj];
+      ef.zenithTable  = &zenithTables[jj];
+
+      Rvector3 zenith;
+      Real distance = GetStationPosition(ef, intStart, zenith).GetMagnitude();
+      if (distance > farthestStation)
+         farthestStation = distance;
+   }
+
+   // Tabulate the occulting bodies, padded for the light time to the stations
+   std::map<std::string, CelestialBody*> bodies;
+   for (UnsignedInt jj = 0; jj < occultingBodyNames.size(); jj++)
+      for (UnsignedInt kk = 0; kk < occultingBodyNames[jj].size(); kk++)
+         bodies[occultingBodyNames[jj][kk]] =
+               solarSys->GetBody(occultingBodyNames[jj][kk]);
+
+   std::map<std::string, TrajectoryStore> bodyTables;
+   std::map<std::string, BodyShape> bodyShapes;
+   Real c = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / 1000.0;
+   for (std::map<std::string, CelestialBody*>::iterator i = bodies.begin();
+        i != bodies.end(); ++i)
+   {
+      if (i->second == NULL)
+         continue;
+      Real pad = SEARCH_TABLE_STEP;
+      if (stationEvents.front().useLightTime)
+      {
+         Real distance = GmatMathUtil::Max(
+               GetBodyPosition(i->second, intStart).GetMagnitude(),
+               GetBodyPosition(i->second, intStop).GetMagnitude());
+         pad += 1.1 * (distance + farthestStation) / c;
+      }
+      pad /= GmatTimeConstants::SECS_PER_DAY;
+      TabulateBody(i->second, intStart - pad, intStop + pad,
+                   bodyTables[i->first]);
+      GetBodyShape(i->second, bodyShapes[i->first]);
+   }
+
+   // Elevation searches, one task per station
+   std::vector<SearchTask> tasks(numStations);
+   for (UnsignedInt jj = 0; jj < numStations; jj++)
+   {
+      tasks[jj].function  = stationEvents[jj];
+      tasks[jj].winStarts = winStarts;
+      tasks[jj].winEnds   = winEnds;
+      TrimForLightTime(tasks[jj].function, tasks[jj].winStarts,
+                       tasks[jj].winEnds);
+   }
+   RunSearchTasks(tasks, stepSize, numThreads);
+
+   for (UnsignedInt jj = 0; jj < numStations; jj++)
+   {
+      starts[jj] = tasks[jj].starts;
+      ends[jj]   = tasks[jj].ends;
+   }
+
+   // Line of sight searches, one task per station and occulting body
+   std::vector<SearchTask> blockTasks;
+   std::vector<UnsignedInt> blockStation;
+   for (UnsignedInt jj = 0; jj < numStations; jj++)
+   {
+      if (starts[jj].empty() || (jj >= occultingBodyNames.size()))
+         continue;
+      for (UnsignedInt kk = 0; kk < occultingBodyNames[jj].size(); kk++)
+      {
+         const std::string &name = occultingBodyNames[jj][kk];
+         if (bodies[name] == NULL)
+            continue;
+
+         SearchTask task;
+         task.function            = stationEvents[jj];
+         task.function.type       = BLOCKED_EVENT;
+         task.function.front      = bodies[name];
+         task.function.frontShape = bodyShapes[name];
+         task.function.frontTable = &bodyTables[name];
+         task.winStarts           = starts[jj];
+         task.winEnds             = ends[jj];
+         blockTasks.push_back(task);
+         blockStation.push_back(jj);
+      }
+   }
+   RunSearchTasks(blockTasks, stepSize, numThreads);
+
+   // Remove the blocked times in station and body order
+   for (UnsignedInt ii = 0; ii < blockTasks.size(); ii++)
+      SubtractIntervals(starts[blockStation[ii]], ends[blockStation[ii]],
+                        blockTasks[ii].starts, blockTasks[ii].ends);
+
+   return true;
+}
+
+
 bool EphemManager::GetCoverage(Real s, Real e,
                                bool useEntireIntvl,
                                bool includeAll,
@@ -974,6 +1289,17 @@ bool EphemManager::GetCoverage(Real s, Real e,
                                Real &cvrStart,
                                Real &cvrStop)
 {
+   if (CanSearchNatively("NONE"))
+   {
+      RealArray winStarts, winEnds;
+      GetNativeSearchWindow(s, e, useEntireIntvl, winStarts, winEnds);
+      intvlStart = intStart;
+      intvlStop  = intStop;
+      cvrStart   = coverStart;
+      cvrStop    = coverStop;
+      return true;
+   }
+
    #ifndef __USE_SPICE__
       Spacecraft *theSc = (Spacecraft*) theObj;
       std::string errmsg = "ERROR - cannot compute occultation intervals for spacecraft ";
@@ -1517,9 +1843,1384 @@ void EphemManager::SetSolarSystem(SolarSystem *ss)
    solarSys = ss;
 }
 
+//------------------------------------------------------------------------------
+// void SetUseNativeSearch(bool useNative)
+//------------------------------------------------------------------------------
+/**
+ * Selects the in-memory event searches.  When this is off (the default), or
+ * when a search needs data the in-memory searches do not support, the CSPICE
+ * geometry finder is used on the temporary SPK files.  The locators set this
+ * from their UseNativeSearch field before each search.
+ *
+ * @param useNative true to use the in-memory trajectory when possible
+ */
+//------------------------------------------------------------------------------
+void EphemManager::SetUseNativeSearch(bool useNative)
+{
+   useNativeSearch = useNative;
+}
+
+//------------------------------------------------------------------------------
+// bool CanSearchNatively(const std::string &abCorrection)
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the in-memory trajectory can be used for a search.
+ *
+ * The native searches handle geometric positions and converged light time in
+ * either direction.  Stellar aberration corrections, and spacecraft whose
+ * ephemeris also comes from user supplied SPK kernels, are left to SPICE.
+ *
+ * @param abCorrection the aberration correction for the search
+ *
+ * @return true if the native search can be used
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::CanSearchNatively(const std::string &abCorrection)
+{
+   if (!useNativeSearch || GetSearchTrajectory()->IsEmpty())
+      return false;
+   if (GmatStringUtil::ToUpper(abCorrection).find("+S") != std::string::npos)
+      return false;
+
+   Spacecraft *theSc = (Spacecraft*) theObj;
+   if (!theSc->GetStringArrayParameter("OrbitSpiceKernelName").empty())
+      return false;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void SetTrajectoryFile(const std::string &fileName)
+//------------------------------------------------------------------------------
+/**
+ * Selects a Chebyshev ephemeris file whose trajectory the native event
+ * searches use in place of the recorded one, so events can be found on an
+ * archived trajectory without repropagating it.  The locators set this from
+ * their TrajectoryFile field before each search.
+ *
+ * The file is read when it is first selected.  The recorded trajectory is
+ * kept, and is searched again when the file name is cleared.
+ *
+ * @param fileName The Chebyshev ephemeris file, or "" to use the recorded
+ *                 trajectory
+ */
+//------------------------------------------------------------------------------
+void EphemManager::SetTrajectoryFile(const std::string &fileName)
+{
+   if (fileName == trajectoryFile)
+      return;
+
+   if (fileTrajectory) delete fileTrajectory;
+   fileTrajectory = NULL;
+   trajectoryFile = "";
+
+   if (fileName == "")
+      return;
+
+   TrajectoryStore *table = new TrajectoryStore();
+   if (!LoadTrajectory(fileName, *table))
+   {
+      delete table;
+      throw SubscriberException("Unable to load a trajectory for " +
+            theObjName + " from the Chebyshev ephemeris file " + fileName);
+   }
+
+   fileTrajectory = table;
+   trajectoryFile = fileName;
+}
+
 
 //------------------------------------------------------------------------------
 // protected methods
 //------------------------------------------------------------------------------
-// none
+
+//------------------------------------------------------------------------------
+// bool LoadTrajectory(const std::string &fileName, TrajectoryStore &table)
+//------------------------------------------------------------------------------
+/**
+ * Fills a trajectory table with the contents of a Chebyshev ephemeris file.
+ *
+ * Each record is sampled at the spacing of the states it was fitted from, so
+ * the table interpolates the file to within its fit tolerance.
+ *
+ * @param fileName The Chebyshev ephemeris file
+ * @param table    The table that receives the states
+ *
+ * @return true if states were loaded, false if the file could not be read
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::LoadTrajectory(const std::string &fileName,
+                                  TrajectoryStore &table)
+{
+   ChebyshevEphemerisFile ephem;
+   if (!ephem.OpenForRead(fileName))
+      return false;
+
+   std::string fileCS = ephem.GetCoordinateSystem();
+   if ((coordSysName != "") && (fileCS != "") && (fileCS != coordSysName))
+   {
+      ephem.CloseForRead();
+      throw SubscriberException("The trajectory in " + fileName +
+            " is in the " + fileCS + " coordinate system, but the " +
+            "EphemManager for " + theObjName + " uses " + coordSysName);
+   }
+
+   table.Clear();
+
+   Rvector6  state, lastState;
+   GmatEpoch recStart, recStop;
+   Integer   sampleCount;
+   Integer   recordCount = ephem.GetRecordCount();
+   Real      lastEpoch   = -1.0;
+   // Fits on either side of a record boundary may differ by the tolerance;
+   // a larger jump is a real discontinuity, such as an impulsive maneuver
+   Real      jumpLimit   = 10.0 * ephem.GetTolerance();
+
+   for (Integer i = 0; i < recordCount; ++i)
+   {
+      if (!ephem.GetRecordSpan(i, recStart, recStop, sampleCount))
+         continue;
+      if (sampleCount < 2)
+         sampleCount = 2;
+
+      Real step = (recStop - recStart) / (sampleCount - 1);
+      for (Integer j = 0; j < sampleCount; ++j)
+      {
+         // Pin the last sample to the end of the record
+         Real epoch = (j == sampleCount - 1) ? recStop : recStart + j * step;
+         if (!ephem.GetRecordState(i, epoch, state))
+            continue;
+
+         if ((j == 0) && (epoch == lastEpoch))
+         {
+            Real jump = 0.0;
+            for (Integer k = 0; k < 3; ++k)
+               jump += (state[k] - lastState[k]) * (state[k] - lastState[k]);
+            if (GmatMathUtil::Sqrt(jump) <= jumpLimit)
+               continue;
+         }
+
+         // A state at the previous epoch that differs starts a new arc
+         table.AddState(epoch, state.GetDataVector());
+         lastEpoch = epoch;
+         lastState = state;
+      }
+   }
+   ephem.CloseForRead();
+
+   #ifdef DEBUG_EPHEM_MANAGER_FILES
+      MessageInterface::ShowMessage("EphemManager::LoadTrajectory loaded %d "
+            "nodes from %d records of %s\n", table.GetNodeCount(),
+            recordCount, fileName.c_str());
+   #endif
+
+   return !table.IsEmpty();
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore* GetSearchTrajectory() const
+//------------------------------------------------------------------------------
+/**
+ * Returns the trajectory the native searches use: the one loaded from the
+ * selected trajectory file, or the recorded one if no file is selected.
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore* EphemManager::GetSearchTrajectory() const
+{
+   if (fileTrajectory)
+      return fileTrajectory;
+   return trajectory;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetNativeSearchWindow(Real s, Real e, bool useEntireIntvl,
+//                            RealArray &winStarts, RealArray &winEnds)
+//------------------------------------------------------------------------------
+/**
+ * Builds the search window from the in-memory trajectory.  This is the
+ * counterpart of GetRequiredCoverageWindow, and sets the same interval and
+ * coverage data members.
+ *
+ * @param s              requested start time
+ * @param e              requested end time
+ * @param useEntireIntvl use the entire covered span instead of [s, e]
+ * @param winStarts      start times of the window intervals (output)
+ * @param winEnds        end times of the window intervals (output)
+ *
+ * @return true if the window is not empty
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::GetNativeSearchWindow(Real s, Real e, bool useEntireIntvl,
+                                         RealArray &winStarts,
+                                         RealArray &winEnds)
+{
+   RealArray arcStarts, arcEnds;
+   GetSearchTrajectory()->GetArcIntervals(arcStarts, arcEnds);
+
+   // Sort the arcs and merge the ones that touch or overlap
+   std::vector<std::pair<Real,Real> > arcs;
+   for (UnsignedInt ii = 0; ii < arcStarts.size(); ii++)
+      arcs.push_back(std::make_pair(arcStarts[ii], arcEnds[ii]));
+   std::sort(arcs.begin(), arcs.end());
+
+   winStarts.clear();
+   winEnds.clear();
+   for (UnsignedInt ii = 0; ii < arcs.size(); ii++)
+   {
+      if (!winEnds.empty() && (arcs[ii].first <= winEnds.back()))
+      {
+         if (arcs[ii].second > winEnds.back())
+            winEnds.back() = arcs[ii].second;
+      }
+      else
+      {
+         winStarts.push_back(arcs[ii].first);
+         winEnds.push_back(arcs[ii].second);
+      }
+   }
+
+   if (winStarts.empty())
+   {
+      coverStart = 0.0;
+      coverStop  = 0.0;
+   }
+   else
+   {
+      coverStart = winStarts.front();
+      coverStop  = winEnds.back();
+   }
+   intStart = coverStart;
+   intStop  = coverStop;
+
+   if (!useEntireIntvl)
+   {
+      RealArray cutStarts, cutEnds;
+      for (UnsignedInt ii = 0; ii < winStarts.size(); ii++)
+      {
+         Real a = (winStarts[ii] > s ? winStarts[ii] : s);
+         Real b = (winEnds[ii]   < e ? winEnds[ii]   : e);
+         if (a <= b)
+         {
+            cutStarts.push_back(a);
+            cutEnds.push_back(b);
+         }
+      }
+      winStarts = cutStarts;
+      winEnds   = cutEnds;
+   }
+
+   if (!winStarts.empty())
+   {
+      intStart = winStarts.front();
+      intStop  = winEnds.back();
+   }
+
+   #ifdef DEBUG_NATIVE_SEARCH
+      MessageInterface::ShowMessage("Native search window has %d interval(s) "
+            "from %12.10f to %12.10f\n", (Integer) winStarts.size(), intStart,
+            intStop);
+   #endif
+
+   return !winStarts.empty();
+}
+
+//------------------------------------------------------------------------------
+// void TrimForLightTime(EventFunction &ef, RealArray &winStarts,
+//                       RealArray &winEnds)
+//------------------------------------------------------------------------------
+/**
+ * Shortens the window intervals so that the light time corrected spacecraft
+ * epochs stay inside the recorded trajectory.  The start of each interval is
+ * moved for received signals, and the end for transmitted signals.
+ *
+ * @param ef        the station event settings
+ * @param winStarts start times of the window intervals (input/output)
+ * @param winEnds   end times of the window intervals (input/output)
+ */
+//------------------------------------------------------------------------------
+void EphemManager::TrimForLightTime(EventFunction &ef, RealArray &winStarts,
+                                    RealArray &winEnds)
+{
+   if (!ef.useLightTime || (ef.station == NULL))
+      return;
+
+   Real c   = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / 1000.0;
+   Real pad = 1.0e-3;   // seconds
+
+   RealArray newStarts, newEnds;
+   for (UnsignedInt ii = 0; ii < winStarts.size(); ii++)
+   {
+      Real a = winStarts[ii];
+      Real b = winEnds[ii];
+      Rvector3 zenith;
+      if (ef.transmit)
+      {
+         Rvector3 rho = GetSpacecraftPosition(b) -
+                        GetStationPosition(ef, b, zenith);
+         b -= (rho.GetMagnitude() / c + pad) / GmatTimeConstants::SECS_PER_DAY;
+      }
+      else
+      {
+         Rvector3 rho = GetSpacecraftPosition(a) -
+                        GetStationPosition(ef, a, zenith);
+         a += (rho.GetMagnitude() / c + pad) / GmatTimeConstants::SECS_PER_DAY;
+      }
+      if (a < b)
+      {
+         newStarts.push_back(a);
+         newEnds.push_back(b);
+      }
+   }
+   winStarts = newStarts;
+   winEnds   = newEnds;
+}
+
+//------------------------------------------------------------------------------
+// void FindNativeIntervals(EventFunction &ef, const RealArray &winStarts,
+//                          const RealArray &winEnds, Real stepSize,
+//                          RealArray &starts, RealArray &ends)
+//------------------------------------------------------------------------------
+/**
+ * Finds the intervals where an event function is positive.
+ *
+ * The function is sampled across each window interval, and each sign change
+ * is refined to a root.  Samples are at most the step size apart, except
+ * where the speed bounds show that the function cannot change sign: there
+ * the search jumps to the first epoch at which it could, so the number of
+ * samples follows the number of events rather than the span length.  When
+ * the bounds do not rule out an event between two samples of the same sign,
+ * the gap is searched by FindHiddenSample, so events shorter than the step
+ * size are found down to MIN_SEARCH_SPAN.  Where no bounds are available,
+ * events shorter than the step size may be missed, as with the SPICE
+ * geometry finder.  Intervals are clipped to the window.
+ *
+ * @param ef        the event function settings
+ * @param winStarts start times of the window intervals
+ * @param winEnds   end times of the window intervals
+ * @param stepSize  sampling step (s)
+ * @param starts    start times of the located intervals (output)
+ * @param ends      end times of the located intervals (output)
+ */
+//------------------------------------------------------------------------------
+void EphemManager::FindNativeIntervals(EventFunction &ef,
+                                       const RealArray &winStarts,
+                                       const RealArray &winEnds,
+                                       Real stepSize,
+                                       RealArray &starts,
+                                       RealArray &ends)
+{
+   starts.clear();
+   ends.clear();
+   #ifdef DEBUG_NATIVE_SEARCH
+      Integer sampleCount = 0;
+   #endif
+
+   if (stepSize <= 0.0)
+      stepSize = 60.0;
+   Real step = stepSize / GmatTimeConstants::SECS_PER_DAY;
+
+   for (UnsignedInt ii = 0; ii < winStarts.size(); ii++)
+   {
+      Real a = winStarts[ii];
+      Real b = winEnds[ii];
+      if (b <= a)
+         continue;
+
+      SetRateBounds(ef, a, b);
+
+      Real t1 = a;
+      Real safe1;
+      Real g1 = EvaluateEventFunction(ef, t1, &safe1);
+      Real eventStart = a;
+
+      while (t1 < b)
+      {
+         // Jump over the span where the bounds rule out a sign change
+         Real t2 = t1 + GmatMathUtil::Max(step,
+                        safe1 / GmatTimeConstants::SECS_PER_DAY);
+         if (t2 > b)
+            t2 = b;
+         Real safe2;
+         Real g2 = EvaluateEventFunction(ef, t2, &safe2);
+         #ifdef DEBUG_NATIVE_SEARCH
+            ++sampleCount;
+         #endif
+
+         // Look for a short event between samples of the same sign; the
+         // scan resumes from the sample found inside it
+         Real tm, gm, safem;
+         if (((g1 > 0.0) == (g2 > 0.0)) &&
+             FindHiddenSample(ef, t1, g1, safe1, t2, g2, safe2, tm, gm, safem))
+         {
+            t2    = tm;
+            g2    = gm;
+            safe2 = safem;
+         }
+
+         if ((g1 > 0.0) != (g2 > 0.0))
+         {
+            Real root = RefineEventEpoch(ef, t1, g1, t2, g2);
+            if (g2 > 0.0)
+               eventStart = root;
+            else if (root > eventStart)
+            {
+               starts.push_back(eventStart);
+               ends.push_back(root);
+            }
+         }
+         t1    = t2;
+         g1    = g2;
+         safe1 = safe2;
+      }
+
+      if ((g1 > 0.0) && (b > eventStart))
+      {
+         starts.push_back(eventStart);
+         ends.push_back(b);
+      }
+   }
+
+   #ifdef DEBUG_NATIVE_SEARCH
+      MessageInterface::ShowMessage("Native search (type %d) found %d "
+            "interval(s) using %d samples\n", (Integer) ef.type,
+            (Integer) starts.size(), sampleCount);
+      for (UnsignedInt ii = 0; ii < starts.size(); ii++)
+         MessageInterface::ShowMessage("   %12.10f  to  %12.10f\n",
+               starts[ii], ends[ii]);
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// bool FindHiddenSample(EventFunction &ef, Real t1, Real g1, Real safe1,
+//                       Real t2, Real g2, Real safe2, Real &tm, Real &gm,
+//                       Real &safem)
+//------------------------------------------------------------------------------
+/**
+ * Searches between two samples of the same sign for an epoch where the event
+ * function has the other sign.
+ *
+ * The spans over which the bounds rule out a sign change are taken from
+ * both samples; if they cover the gap, there is no event in it.  Otherwise
+ * the gap is bisected and each half is checked the same way, earlier half
+ * first, until the spans cover it or it is shorter than MIN_SEARCH_SPAN.
+ * The search stops where a sample has no bound.
+ *
+ * @param ef    the event function settings
+ * @param t1    the earlier sample epoch
+ * @param g1    function value at t1
+ * @param safe1 span (s) after t1 with no sign change
+ * @param t2    the later sample epoch
+ * @param g2    function value at t2
+ * @param safe2 span (s) before t2 with no sign change
+ * @param tm    the epoch found (output)
+ * @param gm    function value at tm (output)
+ * @param safem span (s) around tm with no further sign change (output)
+ *
+ * @return true if an epoch with the other sign was found
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::FindHiddenSample(EventFunction &ef, Real t1, Real g1,
+                                    Real safe1, Real t2, Real g2, Real safe2,
+                                    Real &tm, Real &gm, Real &safem)
+{
+   if ((safe1 <= 0.0) || (safe2 <= 0.0))
+      return false;
+   Real gap = (t2 - t1) * GmatTimeConstants::SECS_PER_DAY;
+   if ((safe1 + safe2 >= gap) || (gap <= MIN_SEARCH_SPAN))
+      return false;
+
+   Real t = 0.5 * (t1 + t2);
+   Real safe;
+   Real g = EvaluateEventFunction(ef, t, &safe);
+   if ((g > 0.0) != (g1 > 0.0))
+   {
+      tm    = t;
+      gm    = g;
+      safem = safe;
+      return true;
+   }
+
+   return FindHiddenSample(ef, t1, g1, safe1, t, g, safe, tm, gm, safem) ||
+          FindHiddenSample(ef, t, g, safe, t2, g2, safe2, tm, gm, safem);
+}
+
+//------------------------------------------------------------------------------
+// Real RefineEventEpoch(EventFunction &ef, Real t1, Real g1, Real t2,
+//                       Real g2)
+//------------------------------------------------------------------------------
+/**
+ * Locates the root of an event function inside a bracket, using the Illinois
+ * variant of regula falsi with a bisection step every fourth iteration.
+ *
+ * @param ef the event function settings
+ * @param t1 start of the bracket
+ * @param g1 function value at t1
+ * @param t2 end of the bracket
+ * @param g2 function value at t2
+ *
+ * @return the root, to within one microsecond
+ */
+//------------------------------------------------------------------------------
+Real EphemManager::RefineEventEpoch(EventFunction &ef, Real t1, Real g1,
+                                    Real t2, Real g2)
+{
+   Real tolerance = 1.0e-6 / GmatTimeConstants::SECS_PER_DAY;
+   Integer side   = 0;
+
+   for (Integer iter = 0; iter < 100; iter++)
+   {
+      if (t2 - t1 <= tolerance)
+         break;
+
+      Real t = 0.5 * (t1 + t2);
+      if ((iter % 4 != 3) && (g2 != g1))
+      {
+         Real tFalsi = (t1 * g2 - t2 * g1) / (g2 - g1);
+         if ((tFalsi > t1) && (tFalsi < t2))
+            t = tFalsi;
+      }
+      Real g = EvaluateEventFunction(ef, t);
+
+      if ((g > 0.0) == (g2 > 0.0))
+      {
+         t2 = t;
+         g2 = g;
+         if (side == -1)
+            g1 *= 0.5;
+         side = -1;
+      }
+      else
+      {
+         t1 = t;
+         g1 = g;
+         if (side == 1)
+            g2 *= 0.5;
+         side = 1;
+      }
+   }
+
+   return 0.5 * (t1 + t2);
+}
+
+//------------------------------------------------------------------------------
+// Real EvaluateEventFunction(EventFunction &ef, Real epoch, Real *safeStep)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates an event function.  The functions are angles (in radians) that
+ * are positive inside the event, so they are continuous across the event
+ * boundaries.
+ *
+ * When requested, the method also returns a time span over which the
+ * function cannot change sign.  Each angle in the function moves no faster
+ * than the relative speed over the distance of the body it is measured to,
+ * with a further term for the change in a body's apparent radius, so the
+ * bound on the rate is a sum of these terms.  The span is kept short enough
+ * that no distance can fall below half of its current value, which keeps the
+ * rate bound valid across it.
+ *
+ * @param ef       the event function settings
+ * @param epoch    the A.1 epoch
+ * @param safeStep span (s) over which the sign is unchanged (output); 0.0
+ *                 when the bounds are not in use
+ *
+ * @return the function value
+ */
+//------------------------------------------------------------------------------
+Real EphemManager::EvaluateEventFunction(EventFunction &ef, Real epoch,
+                                         Real *safeStep)
+{
+   RunProfiler::Count(EVENT_FUNCTION_CALLS);
+
+   Real c = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / 1000.0;
+   bool bound = (safeStep != NULL) && ef.useBounds;
+   Real maxStep = GmatRealConstants::REAL_MAX;
+   if (safeStep)
+      *safeStep = 0.0;
+
+   if (ef.type == OCCULTATION_EVENT)
+   {
+      Rvector3 sc      = GetSpacecraftPosition(epoch);
+      Rvector3 toFront = GetLightTimePosition(ef.front, sc, epoch,
+                               ef.useLightTime, ef.transmit, ef.frontTable) - sc;
+      Rvector3 toBack  = GetLightTimePosition(ef.back, sc, epoch,
+                               ef.useLightTime, ef.transmit) - sc;
+      Real dFront = toFront.GetMagnitude();
+      Real dBack  = toBack.GetMagnitude();
+      Real vFront = ef.scSpeed + ef.frontSpeed;
+      Real vBack  = ef.scSpeed + ef.backSpeed;
+
+      // The bodies must pass each other in range to change the ordering
+      if (bound && (vFront + vBack > 0.0))
+         maxStep = GmatMathUtil::Abs(dBack - dFront) / (vFront + vBack);
+      if (dFront >= dBack)
+      {
+         if (bound)
+            *safeStep = maxStep;
+         return -1.0;
+      }
+
+      Rvector3 uFront = toFront / dFront;
+      Rvector3 uBack  = toBack / dBack;
+      Real cosSep     = uFront * uBack;
+      Real separation = GmatMathUtil::ATan2(Cross(uFront, uBack).GetMagnitude(),
+                                            cosSep);
+
+      // Each body's radius is taken at the limb facing the other body
+      Real rFront = GetApparentRadius(ef.frontShape, uBack - uFront * cosSep,
+                                      epoch);
+      Real rBack  = GetApparentRadius(ef.backShape, uFront - uBack * cosSep,
+                                      epoch);
+      Real aFront = GmatMathUtil::ASin(GmatMathUtil::Min(rFront / dFront, 1.0));
+      Real aBack  = GmatMathUtil::ASin(GmatMathUtil::Min(rBack / dBack, 1.0));
+
+      Real g;
+      if (ef.occType == "Umbra")
+         g = aFront - aBack - separation;
+      else if (ef.occType == "Antumbra")
+         g = aBack - aFront - separation;
+      else if (ef.occType == "Penumbra")
+         g = GmatMathUtil::Min(aFront + aBack - separation,
+               separation - GmatMathUtil::Abs(aFront - aBack));
+      else
+         g = aFront + aBack - separation;
+
+      if (bound)
+      {
+         Real rate =
+               GetAngularRateBound(dFront, ef.frontShape.equatorialRadius,
+                                   vFront, maxStep) +
+               GetAngularRateBound(dBack, ef.backShape.equatorialRadius,
+                                   vBack, maxStep);
+         *safeStep = (rate > 0.0 ?
+               GmatMathUtil::Min(GmatMathUtil::Abs(g) / rate, maxStep) :
+               maxStep);
+      }
+      return g;
+   }
+
+   // Station events: locate the spacecraft as seen from the station
+   Rvector3 zenith;
+   Rvector3 station = GetStationPosition(ef, epoch, zenith);
+   Rvector3 rho     = GetSpacecraftPosition(epoch) - station;
+   if (ef.useLightTime)
+   {
+      Real direction = (ef.transmit ? 1.0 : -1.0);
+      for (Integer ii = 0; ii < 3; ii++)
+      {
+         Real lt = rho.GetMagnitude() / c;
+         rho = GetSpacecraftPosition(epoch + direction * lt /
+               GmatTimeConstants::SECS_PER_DAY) - station;
+      }
+   }
+   Real range = rho.GetMagnitude();
+   Real vSc   = ef.scSpeed + ef.observerSpeed;
+
+   if (ef.type == ELEVATION_EVENT)
+   {
+      Real g = GmatMathUtil::ASin((rho * zenith) / range) - ef.minElevation;
+      if (bound)
+      {
+         Real rate = GetAngularRateBound(range, 0.0, vSc, maxStep) +
+                     ef.zenithRate;
+         *safeStep = (rate > 0.0 ?
+               GmatMathUtil::Min(GmatMathUtil::Abs(g) / rate, maxStep) :
+               maxStep);
+      }
+      return g;
+   }
+
+   // BLOCKED_EVENT
+   Rvector3 toBody = GetLightTimePosition(ef.front, station, epoch,
+                           ef.useLightTime, ef.transmit, ef.frontTable) - station;
+   Real dBody = toBody.GetMagnitude();
+   Real vBody = ef.frontSpeed + ef.observerSpeed;
+   if (bound && (vSc + vBody > 0.0))
+      maxStep = GmatMathUtil::Abs(range - dBody) / (vSc + vBody);
+   if (dBody >= range)
+   {
+      if (bound)
+         *safeStep = maxStep;
+      return -1.0;
+   }
+
+   Rvector3 uBody  = toBody / dBody;
+   Rvector3 uSc    = rho / range;
+   Real cosSep     = uBody * uSc;
+   Real separation = GmatMathUtil::ATan2(Cross(uBody, uSc).GetMagnitude(),
+                                         cosSep);
+   Real rBody = GetApparentRadius(ef.frontShape, uSc - uBody * cosSep, epoch);
+   Real g = GmatMathUtil::ASin(GmatMathUtil::Min(rBody / dBody, 1.0)) -
+            separation;
+   if (bound)
+   {
+      Real rate =
+            GetAngularRateBound(dBody, ef.frontShape.equatorialRadius, vBody,
+                                maxStep) +
+            GetAngularRateBound(range, 0.0, vSc, maxStep);
+      *safeStep = (rate > 0.0 ?
+            GmatMathUtil::Min(GmatMathUtil::Abs(g) / rate, maxStep) :
+            maxStep);
+   }
+   return g;
+}
+
+//------------------------------------------------------------------------------
+// void SetRateBounds(EventFunction &ef, Real start, Real stop)
+//------------------------------------------------------------------------------
+/**
+ * Sets the speed bounds used to step over event-free spans in a window
+ * interval.
+ *
+ * The spacecraft bound comes from the recorded nodes across the interval,
+ * widened to allow for light time, and the body bounds from the body tables
+ * or from body speed samples.  In each case the bound is the largest sampled
+ * speed plus the largest change in velocity between neighboring samples.
+ * Station bounds are set by SetUpStation.
+ *
+ * @param ef    the event function settings (input/output)
+ * @param start start of the window interval
+ * @param stop  end of the window interval
+ */
+//------------------------------------------------------------------------------
+void EphemManager::SetRateBounds(EventFunction &ef, Real start, Real stop)
+{
+   Real pad = 0.01;     // days, more than the light time to 0.1 AU
+   ef.scSpeed = GetSearchTrajectory()->GetSpeedBound(start - pad,
+                                                      stop + pad);
+
+   ef.frontSpeed = 0.0;
+   ef.backSpeed  = 0.0;
+   if (ef.front)
+      ef.frontSpeed = (ef.frontTable ?
+            ef.frontTable->GetSpeedBound(start - pad, stop + pad) :
+            GetBodySpeedBound(ef.front, start - pad, stop + pad));
+   if (ef.back)
+      ef.backSpeed = GetBodySpeedBound(ef.back, start - pad, stop + pad);
+
+   ef.useBounds = (ef.scSpeed > 0.0);
+}
+
+//------------------------------------------------------------------------------
+// Real GetBodySpeedBound(CelestialBody *body, Real start, Real stop)
+//------------------------------------------------------------------------------
+/**
+ * Bounds the speed of a body across a span from samples SPEED_SAMPLE_STEP
+ * apart: the largest sampled speed plus the largest change in velocity
+ * between neighboring samples.
+ *
+ * @param body  the body
+ * @param start start of the span
+ * @param stop  end of the span
+ *
+ * @return the speed bound (km/s)
+ */
+//------------------------------------------------------------------------------
+Real EphemManager::GetBodySpeedBound(CelestialBody *body, Real start,
+                                     Real stop)
+{
+   Real step = SPEED_SAMPLE_STEP / GmatTimeConstants::SECS_PER_DAY;
+   Integer count = (Integer) GmatMathUtil::Ceiling((stop - start) / step);
+   SpacePoint *origin = coordSys->GetOrigin();
+   bool offset = ((origin != NULL) && (origin != origin->GetJ2000Body()));
+
+   Real maxSpeed = 0.0, maxChange = 0.0;
+   Rvector3 previous;
+   for (Integer ii = 0; ii <= count; ii++)
+   {
+      A1Mjd    when(GmatMathUtil::Min(start + ii * step, stop));
+      Rvector6 state = body->GetMJ2000State(when);
+      if (offset)
+         state = state - origin->GetMJ2000State(when);
+      Rvector3 velocity = state.GetV();
+
+      maxSpeed = GmatMathUtil::Max(maxSpeed, velocity.GetMagnitude());
+      if (ii > 0)
+         maxChange = GmatMathUtil::Max(maxChange,
+                                       (velocity - previous).GetMagnitude());
+      previous = velocity;
+   }
+   return maxSpeed + maxChange;
+}
+
+//------------------------------------------------------------------------------
+// Rvector3 GetSpacecraftPosition(Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the spacecraft position from the in-memory trajectory.
+ *
+ * @param epoch the A.1 epoch
+ *
+ * @return the position in the EphemManager coordinate system
+ */
+//------------------------------------------------------------------------------
+Rvector3 EphemManager::GetSpacecraftPosition(Real epoch)
+{
+   Rvector6 state;
+   if (!GetSearchTrajectory()->GetState(epoch, state))
+   {
+      std::stringstream errmsg("");
+      errmsg.precision(12);
+      errmsg << "No ephemeris data is available for spacecraft " << theObjName
+             << " at A1ModJulian epoch " << epoch << ".\n";
+      throw SubscriberException(errmsg.str());
+   }
+   return Rvector3(state[0], state[1], state[2]);
+}
+
+//------------------------------------------------------------------------------
+// Rvector3 GetBodyPosition(CelestialBody *body, Real epoch,
+//                          const TrajectoryStore *table)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the position of a body relative to the origin of the EphemManager
+ * coordinate system, whose axes are MJ2000Eq.
+ *
+ * @param body  the body
+ * @param epoch the A.1 epoch
+ * @param table tabulated states of the body, used instead of the body's
+ *              ephemeris when set
+ *
+ * @return the body position
+ */
+//------------------------------------------------------------------------------
+Rvector3 EphemManager::GetBodyPosition(CelestialBody *body, Real epoch,
+                                       const TrajectoryStore *table)
+{
+   if (table)
+   {
+      Rvector6 state;
+      if (!table->GetState(epoch, state))
+      {
+         std::stringstream errmsg("");
+         errmsg.precision(12);
+         errmsg << "The tabulated ephemeris for " << body->GetName()
+                << " does not cover A1ModJulian epoch " << epoch << ".\n";
+         throw SubscriberException(errmsg.str());
+      }
+      return Rvector3(state[0], state[1], state[2]);
+   }
+
+   A1Mjd       when(epoch);
+   Rvector3    position = body->GetMJ2000Position(when);
+   SpacePoint *origin   = coordSys->GetOrigin();
+   if ((origin != NULL) && (origin != origin->GetJ2000Body()))
+      position = position - origin->GetMJ2000Position(when);
+   return position;
+}
+
+//------------------------------------------------------------------------------
+// Rvector3 GetStationPosition(EventFunction &ef, Real epoch,
+//                             Rvector3 &zenith)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the station location and zenith direction in the EphemManager
+ * coordinate system, from the station tables when they are set.
+ *
+ * @param ef     the event function settings, including the station
+ * @param epoch  the A.1 epoch
+ * @param zenith the station zenith direction (output)
+ *
+ * @return the station position
+ */
+//------------------------------------------------------------------------------
+Rvector3 EphemManager::GetStationPosition(EventFunction &ef, Real epoch,
+                                          Rvector3 &zenith)
+{
+   if (ef.stationTable && ef.zenithTable)
+   {
+      Rvector6 position, direction;
+      if (!ef.stationTable->GetState(epoch, position) ||
+          !ef.zenithTable->GetState(epoch, direction))
+      {
+         std::stringstream errmsg("");
+         errmsg.precision(12);
+         errmsg << "The tabulated location of " << ef.station->GetName()
+                << " does not cover A1ModJulian epoch " << epoch << ".\n";
+         throw SubscriberException(errmsg.str());
+      }
+      zenith.Set(direction[0], direction[1], direction[2]);
+      zenith = zenith.GetUnitVector();
+      return Rvector3(position[0], position[1], position[2]);
+   }
+
+   Rvector6 bfState(ef.stationLocation[0], ef.stationLocation[1],
+                    ef.stationLocation[2], 0.0, 0.0, 0.0);
+   Rvector6 outState;
+   ef.converter.Convert(A1Mjd(epoch), bfState, ef.stationFrame, outState,
+                        coordSys);
+   zenith = ef.converter.GetLastRotationMatrix() * ef.stationZenith;
+   return Rvector3(outState[0], outState[1], outState[2]);
+}
+
+//------------------------------------------------------------------------------
+// Rvector3 GetLightTimePosition(CelestialBody *body,
+//                               const Rvector3 &observer, Real epoch,
+//                               bool useLightTime, bool transmit,
+//                               const TrajectoryStore *table)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves a body position, corrected for the light time to an observer
+ * when requested.
+ *
+ * @param body         the body
+ * @param observer     the observer position at epoch
+ * @param epoch        the A.1 epoch at the observer
+ * @param useLightTime apply converged light time
+ * @param transmit     signal is transmitted (rather than received) by the
+ *                     observer
+ * @param table        tabulated states of the body, if any
+ *
+ * @return the body position
+ */
+//------------------------------------------------------------------------------
+Rvector3 EphemManager::GetLightTimePosition(CelestialBody *body,
+                                            const Rvector3 &observer,
+                                            Real epoch, bool useLightTime,
+                                            bool transmit,
+                                            const TrajectoryStore *table)
+{
+   Rvector3 position = GetBodyPosition(body, epoch, table);
+   if (useLightTime)
+   {
+      Real c         = GmatPhysicalConstants::SPEED_OF_LIGHT_VACUUM / 1000.0;
+      Real direction = (transmit ? 1.0 : -1.0);
+      for (Integer ii = 0; ii < 3; ii++)
+      {
+         Real lt  = (position - observer).GetMagnitude() / c;
+         position = GetBodyPosition(body, epoch + direction * lt /
+                                    GmatTimeConstants::SECS_PER_DAY, table);
+      }
+   }
+   return position;
+}
+
+//------------------------------------------------------------------------------
+// CelestialBody* FindBody(const std::string &id)
+//------------------------------------------------------------------------------
+/**
+ * Finds a body in the solar system from its name or its NAIF ID.
+ *
+ * @param id the name or NAIF ID (as used in the SPICE calls)
+ *
+ * @return the body, or NULL if it is not in use
+ */
+//------------------------------------------------------------------------------
+CelestialBody* EphemManager::FindBody(const std::string &id)
+{
+   CelestialBody *body = solarSys->GetBody(id);
+   if (body)
+      return body;
+
+   Integer naifId;
+   bool    isId = GmatStringUtil::ToInteger(id, naifId);
+   std::string upperId = GmatStringUtil::ToUpper(id);
+
+   const StringArray &bodies = solarSys->GetBodiesInUse();
+   for (UnsignedInt ii = 0; ii < bodies.size(); ii++)
+   {
+      body = solarSys->GetBody(bodies[ii]);
+      if (body == NULL)
+         continue;
+      if (isId &&
+          (body->GetIntegerParameter(body->GetParameterID("NAIFId")) == naifId))
+         return body;
+      if (GmatStringUtil::ToUpper(bodies[ii]) == upperId)
+         return body;
+   }
+   return NULL;
+}
+
+//------------------------------------------------------------------------------
+// bool SetUpStation(EventFunction &ef, GmatBase *observer)
+//------------------------------------------------------------------------------
+/**
+ * Fills in the station data for the contact searches.  The zenith is the
+ * geodetic normal, which is the z axis of the topocentric frame written to
+ * the station's FK kernel.
+ *
+ * @param ef       the event function settings (output)
+ * @param observer the observing station
+ *
+ * @return true if the observer is a body-fixed point the native search
+ *         can use
+ */
+//------------------------------------------------------------------------------
+bool EphemManager::SetUpStation(EventFunction &ef, GmatBase *observer)
+{
+   if ((observer == NULL) || !observer->IsOfType("BodyFixedPoint"))
+      return false;
+
+   BodyFixedPoint *station = (BodyFixedPoint*) observer;
+   CoordinateSystem *bfcs  = station->GetBodyFixedCoordinateSystem();
+   CelestialBody *body     = solarSys->GetBody(
+                                  station->GetStringParameter("CentralBody"));
+   if ((bfcs == NULL) || (body == NULL))
+      return false;
+
+   Rvector3 location = station->GetBodyFixedLocation(A1Mjd(intStart));
+
+   // Geodetic latitude, by the iteration used for the topocentric FK frame
+   Real R      = body->GetEquatorialRadius();
+   Real f      = body->GetFlattening();
+   Real e2     = 2.0 * f - f * f;
+   Real lambda = GmatMathUtil::ATan2(location[1], location[0]);
+   Real rxy    = GmatMathUtil::Sqrt(location[0] * location[0] +
+                                    location[1] * location[1]);
+   Real phi    = GmatMathUtil::ATan2(location[2], rxy);
+   Real delta  = 1.0;
+   for (Integer ii = 0; (ii < 50) && (delta > 1.0e-11); ii++)
+   {
+      Real sinPhi = GmatMathUtil::Sin(phi);
+      Real C      = R / GmatMathUtil::Sqrt(1.0 - e2 * sinPhi * sinPhi);
+      Real newPhi = GmatMathUtil::ATan2(location[2] + C * e2 * sinPhi, rxy);
+      delta       = GmatMathUtil::Abs(newPhi - phi);
+      phi         = newPhi;
+   }
+
+   ef.station         = station;
+   ef.stationFrame    = bfcs;
+   ef.stationLocation = location;
+   ef.stationZenith.Set(GmatMathUtil::Cos(phi) * GmatMathUtil::Cos(lambda),
+                        GmatMathUtil::Cos(phi) * GmatMathUtil::Sin(lambda),
+                        GmatMathUtil::Sin(phi));
+
+   // Bounds on the station motion, for stepping over event-free spans
+   Rvector6 bfState(location[0], location[1], location[2], 0.0, 0.0, 0.0);
+   Rvector6 outState;
+   ef.converter.Convert(A1Mjd(intStart), bfState, bfcs, outState, coordSys);
+   ef.observerSpeed = SPEED_BOUND_MARGIN * GmatMathUtil::Sqrt(
+         outState[3] * outState[3] + outState[4] * outState[4] +
+         outState[5] * outState[5]);
+   ef.zenithRate    = SPEED_BOUND_MARGIN *
+         (ef.converter.GetLastRotationDotMatrix() * ef.stationZenith).
+         GetMagnitude();
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void TabulateBody(CelestialBody *body, Real start, Real stop,
+//                   TrajectoryStore &table)
+//------------------------------------------------------------------------------
+/**
+ * Records the states of a body across a span, relative to the origin of the
+ * EphemManager coordinate system, so that searches on other threads can look
+ * them up without calling into the body.
+ *
+ * @param body  the body
+ * @param start start of the span
+ * @param stop  end of the span
+ * @param table the tabulated states (output)
+ */
+//------------------------------------------------------------------------------
+void EphemManager::TabulateBody(CelestialBody *body, Real start, Real stop,
+                                TrajectoryStore &table)
+{
+   Real step = SEARCH_TABLE_STEP / GmatTimeConstants::SECS_PER_DAY;
+   SpacePoint *origin = coordSys->GetOrigin();
+   bool offset = ((origin != NULL) && (origin != origin->GetJ2000Body()));
+
+   table.Clear();
+   Integer count = (Integer) GmatMathUtil::Ceiling((stop - start) / step);
+   for (Integer ii = 0; ii <= count + 1; ii++)
+   {
+      Real     epoch = start + ii * step;
+      A1Mjd    when(epoch);
+      Rvector6 state = body->GetMJ2000State(when);
+      if (offset)
+         state = state - origin->GetMJ2000State(when);
+      table.AddState(epoch, state.GetDataVector());
+   }
+}
+
+//------------------------------------------------------------------------------
+// void TabulateStation(EventFunction &ef, Real start, Real stop,
+//                      TrajectoryStore &positions, TrajectoryStore &zeniths)
+//------------------------------------------------------------------------------
+/**
+ * Records the station location and zenith direction across a span.  The
+ * zenith table stores the direction and its rate in place of the position
+ * and velocity.
+ *
+ * @param ef        the station event settings
+ * @param start     start of the span
+ * @param stop      end of the span
+ * @param positions the tabulated station states (output)
+ * @param zeniths   the tabulated zenith directions (output)
+ */
+//------------------------------------------------------------------------------
+void EphemManager::TabulateStation(EventFunction &ef, Real start, Real stop,
+                                   TrajectoryStore &positions,
+                                   TrajectoryStore &zeniths)
+{
+   Real step = SEARCH_TABLE_STEP / GmatTimeConstants::SECS_PER_DAY;
+   Rvector6 bfState(ef.stationLocation[0], ef.stationLocation[1],
+                    ef.stationLocation[2], 0.0, 0.0, 0.0);
+
+   positions.Clear();
+   zeniths.Clear();
+   Integer count = (Integer) GmatMathUtil::Ceiling((stop - start) / step);
+   for (Integer ii = 0; ii <= count + 1; ii++)
+   {
+      Real     epoch = start + ii * step;
+      Rvector6 outState;
+      ef.converter.Convert(A1Mjd(epoch), bfState, ef.stationFrame, outState,
+                           coordSys);
+      Rvector3 zenith    = ef.converter.GetLastRotationMatrix() *
+                           ef.stationZenith;
+      Rvector3 zenithDot = ef.converter.GetLastRotationDotMatrix() *
+                           ef.stationZenith;
+      Real direction[6] = {zenith[0], zenith[1], zenith[2],
+                           zenithDot[0], zenithDot[1], zenithDot[2]};
+
+      positions.AddState(epoch, outState.GetDataVector());
+      zeniths.AddState(epoch, direction);
+   }
+}
+
+//------------------------------------------------------------------------------
+// void RunSearchTasks(std::vector<SearchTask> &tasks, Real stepSize,
+//                     Integer numThreads)
+//------------------------------------------------------------------------------
+/**
+ * Runs a set of interval searches, on several threads when there is more
+ * than one task.  The event functions in the tasks must use tabulated body
+ * and station data.  Errors are rethrown on the calling thread, for the
+ * first failed task in the list.
+ *
+ * @param tasks      the searches (input/output)
+ * @param stepSize   sampling step (s)
+ * @param numThreads number of threads; 0 or less uses one per processor
+ */
+//------------------------------------------------------------------------------
+void EphemManager::RunSearchTasks(std::vector<SearchTask> &tasks,
+                                  Real stepSize, Integer numThreads)
+{
+   if (tasks.empty())
+      return;
+
+   if (numThreads <= 0)
+      numThreads = (Integer) std::thread::hardware_concurrency();
+   if (numThreads > (Integer) tasks.size())
+      numThreads = (Integer) tasks.size();
+   if (numThreads < 1)
+      numThreads = 1;
+
+   SearchQueue queue;
+   queue.tasks    = &tasks;
+   queue.stepSize = stepSize;
+   queue.next     = 0;
+
+   #ifdef DEBUG_NATIVE_SEARCH
+      MessageInterface::ShowMessage("Running %d search task(s) on %d "
+            "thread(s)\n", (Integer) tasks.size(), numThreads);
+   #endif
+
+   // The calling thread takes a share of the work
+   std::vector<std::thread> workers;
+   for (Integer ii = 1; ii < numThreads; ii++)
+      workers.push_back(std::thread(&EphemManager::RunSearchWorker, this,
+                                    &queue));
+   RunSearchWorker(&queue);
+   for (UnsignedInt ii = 0; ii < workers.size(); ii++)
+      workers[ii].join();
+
+   for (UnsignedInt ii = 0; ii < tasks.size(); ii++)
+      if (tasks[ii].error != "")
+         throw SubscriberException(tasks[ii].error);
+}
+
+//------------------------------------------------------------------------------
+// void RunSearchWorker(SearchQueue *queue)
+//------------------------------------------------------------------------------
+/**
+ * Runs searches from the queue until none are left.
+ *
+ * @param queue the shared work queue
+ */
+//------------------------------------------------------------------------------
+void EphemManager::RunSearchWorker(SearchQueue *queue)
+{
+   std::vector<SearchTask> &tasks = *(queue->tasks);
+   for (UnsignedInt ii = queue->next++; ii < tasks.size();
+        ii = queue->next++)
+   {
+      SearchTask &task = tasks[ii];
+      try
+      {
+         FindNativeIntervals(task.function, task.winStarts, task.winEnds,
+                             queue->stepSize, task.starts, task.ends);
+      }
+      catch (BaseException &be)
+      {
+         task.error = be.GetFullMessage();
+      }
+      catch (std::exception &ex)
+      {
+         task.error = ex.what();
+      }
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GetBodyShape(CelestialBody *body, BodyShape &shape)
+//------------------------------------------------------------------------------
+/**
+ * Collects the ellipsoid and pole data of a body.  The searches read the
+ * copy, so they never call into the body (which may update its own data).
+ *
+ * @param body  the body
+ * @param shape the shape data (output)
+ */
+//------------------------------------------------------------------------------
+void EphemManager::GetBodyShape(CelestialBody *body, BodyShape &shape)
+{
+   shape.equatorialRadius = body->GetEquatorialRadius();
+   shape.flattening       = body->GetFlattening();
+   shape.orientation      = body->GetOrientationParameters();
+}
+
+//------------------------------------------------------------------------------
+// Real GetAngularRateBound(Real distance, Real radius, Real speed,
+//                          Real &maxStep)
+//------------------------------------------------------------------------------
+/**
+ * Bounds the rate of the angles measured to a body: its direction and, for a
+ * body with a radius, its apparent angular radius.  The bound holds while the
+ * distance stays above half its current value, so the usable span is limited
+ * to the time needed to close half the distance at the given speed.
+ *
+ * @param distance distance to the body (km)
+ * @param radius   body radius (km); 0.0 for a point
+ * @param speed    bound on the relative speed (km/s)
+ * @param maxStep  longest span (s) for the bounds (input/output)
+ *
+ * @return the rate bound (rad/s)
+ */
+//------------------------------------------------------------------------------
+Real EphemManager::GetAngularRateBound(Real distance, Real radius, Real speed,
+                                       Real &maxStep)
+{
+   if ((speed <= 0.0) || (distance <= 0.0))
+      return 0.0;
+
+   Real nearest = 0.5 * distance;
+   Real span    = nearest / speed;
+   if (span < maxStep)
+      maxStep = span;
+
+   Real rate = speed / nearest;
+   if (radius > 0.0)
+   {
+      // The body could fill the sky; no useful bound
+      if (nearest <= radius)
+      {
+         maxStep = 0.0;
+         return rate;
+      }
+      rate += radius * speed /
+              (nearest * GmatMathUtil::Sqrt(nearest * nearest - radius * radius));
+   }
+   return rate;
+}
+
+//------------------------------------------------------------------------------
+// Real GetApparentRadius(const BodyShape &shape, const Rvector3 &toLimb,
+//                        Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Returns the radius of a body's reference ellipsoid in a given direction,
+ * used as the radius of the body's disk at that part of the limb.  The spin
+ * axis comes from the body's orientation parameters.
+ *
+ * @param shape  the body's shape data
+ * @param toLimb direction from the body center toward the limb point
+ * @param epoch  the A.1 epoch
+ *
+ * @return the radius (km)
+ */
+//------------------------------------------------------------------------------
+Real EphemManager::GetApparentRadius(const BodyShape &shape,
+                                     const Rvector3 &toLimb, Real epoch)
+{
+   Real equatorial = shape.equatorialRadius;
+   Real flattening = shape.flattening;
+   Real size       = toLimb.GetMagnitude();
+   if ((flattening == 0.0) || (size == 0.0))
+      return equatorial;
+
+   const Rvector6 &orientation = shape.orientation;
+   Real T = (epoch - GmatTimeConstants::A1MJD_OF_J2000) /
+            GmatTimeConstants::DAYS_PER_JULIAN_CENTURY;
+   Real ra  = (orientation[0] + orientation[1] * T) *
+              GmatMathConstants::RAD_PER_DEG;
+   Real dec = (orientation[2] + orientation[3] * T) *
+              GmatMathConstants::RAD_PER_DEG;
+   Rvector3 pole(GmatMathUtil::Cos(dec) * GmatMathUtil::Cos(ra),
+                 GmatMathUtil::Cos(dec) * GmatMathUtil::Sin(ra),
+                 GmatMathUtil::Sin(dec));
+
+   Real sinLat = (toLimb * pole) / size;
+   Real cos2   = 1.0 - sinLat * sinLat;
+   Real polar  = equatorial * (1.0 - flattening);
+   return equatorial * polar /
+          GmatMathUtil::Sqrt(polar * polar * cos2 +
+                             equatorial * equatorial * sinLat * sinLat);
+}
+
+//------------------------------------------------------------------------------
+// void SubtractIntervals(RealArray &starts, RealArray &ends,
+//                        const RealArray &subStarts,
+//                        const RealArray &subEnds)
+//------------------------------------------------------------------------------
+/**
+ * Removes one set of sorted, disjoint intervals from another, like the SPICE
+ * window difference.
+ *
+ * @param starts    start times of the intervals (input/output)
+ * @param ends      end times of the intervals (input/output)
+ * @param subStarts start times of the intervals to remove
+ * @param subEnds   end times of the intervals to remove
+ */
+//------------------------------------------------------------------------------
+void EphemManager::SubtractIntervals(RealArray &starts, RealArray &ends,
+                                     const RealArray &subStarts,
+                                     const RealArray &subEnds)
+{
+   RealArray newStarts, newEnds;
+   UnsignedInt first = 0;
+
+   for (UnsignedInt ii = 0; ii < starts.size(); ii++)
+   {
+      Real current = starts[ii];
+      Real end     = ends[ii];
+
+      while ((first < subStarts.size()) && (subEnds[first] <= current))
+         first++;
+
+      for (UnsignedInt jj = first;
+           (jj < subStarts.size()) && (subStarts[jj] < end); jj++)
+      {
+         if (subStarts[jj] > current)
+         {
+            newStarts.push_back(current);
+            newEnds.push_back(subStarts[jj]);
+         }
+         if (subEnds[jj] > current)
+            current = subEnds[jj];
+         if (current >= end)
+            break;
+      }
+
+      if (current < end)
+      {
+         newStarts.push_back(current);
+         newEnds.push_back(end);
+      }
+   }
+
+   starts = newStarts;
+   ends   = newEnds;
+}
 
@@ -36,6 +36,7 @@
 #include "gmatdefs.hpp"
 #include "GmatBase.hpp"
 #include "CoordinateSystem.hpp"
+#include "CoordinateConverter.hpp"
 #include "SolarSystem.hpp"
 
 #ifdef __USE_SPICE__
@@ -46,6 +47,8 @@
 
 // Declare forward reference
 class EphemerisFile;
+class TrajectoryStore;
+class BodyFixedPoint;
 
 /**
  * Manager for ephemeris recording for the specified object
@@ -109,7 +112,22 @@ public:
                                             Real              stepSize,
                                             Integer           &numIntervals,
                                             RealArray         &starts,
-                                            RealArray         &ends);
+                                            RealArray         &ends,
+                                            GmatBase          *observer = NULL);
+
+   /// Contact intervals for several stations, searched in parallel
+   bool                 GetContactIntervals(const ObjectArray &observers,
+                                            const RealArray &minElevations,
+                                            const std::vector<StringArray>
+                                                    &occultingBodyNames,
+                                            const std::string &abCorrection,
+                                            Real              s,
+                                            Real              e,
+                                            bool              useEntireIntvl,
+                                            Real              stepSize,
+                                            Integer           numThreads,
+                                            std::vector<RealArray> &starts,
+                                            std::vector<RealArray> &ends);
 
    bool                 GetCoverage(Real s, Real e,
                                     bool useEntireIntvl,
@@ -119,6 +137,12 @@ public:
                                     Real &cvrStart,
                                     Real &cvrStop);
 
+   /// Select the in-memory event searches when they can be used
+   void                 SetUseNativeSearch(bool useNative);
+   bool                 CanSearchNatively(const std::string &abCorrection);
+   /// Search an archived trajectory instead of the recorded one
+   void                 SetTrajectoryFile(const std::string &fileName);
+
    /// Set reference objects
    virtual void         SetObject(GmatBase *obj);
    virtual void         SetEphemType(ManagedEphemType eType);
@@ -166,6 +190,185 @@ protected:
    Real                 coverStart;
    /// stop time of the actual coverage window (coverage of loaded SPKs)
    Real                 coverStop;
+   /// In-memory copy of the recorded trajectory
+   TrajectoryStore      *trajectory;
+   /// Trajectory loaded from a Chebyshev ephemeris file, or NULL
+   TrajectoryStore      *fileTrajectory;
+   /// Name of the file loaded into fileTrajectory
+   std::string          trajectoryFile;
+   /// Use the in-memory trajectory for event searches when possible
+   bool                 useNativeSearch;
+
+   static const Real    SEARCH_TABLE_STEP;
+   static const Real    SPEED_BOUND_MARGIN;
+   static const Real    SPEED_SAMPLE_STEP;
+   static const Real    MIN_SEARCH_SPAN;
+
+   /// The quantities located by the native event searches
+   enum EventFunctionType
+   {
+      OCCULTATION_EVENT,       // Body occults another, seen from the spacecraft
+      ELEVATION_EVENT,         // Spacecraft above a station's minimum elevation
+      BLOCKED_EVENT            // Body blocks the station-spacecraft line of sight
+   };
+
+   /// Reference ellipsoid and pole data for a body
+   struct BodyShape
+   {
+      /// Equatorial radius (km)
+      Real                 equatorialRadius;
+      /// Flattening
+      Real                 flattening;
+      /// Pole right ascension and declination terms
+      Rvector6             orientation;
+   };
+
+   /// Settings for one native event search; positive values are in the event
+   struct EventFunction
+   {
+      EventFunction() :
+         type           (ELEVATION_EVENT),
+         front          (NULL),
+         back           (NULL),
+         station        (NULL),
+         stationFrame   (NULL),
+         minElevation   (0.0),
+         useLightTime   (false),
+         transmit       (false),
+         useBounds      (false),
+         scSpeed        (0.0),
+         frontSpeed     (0.0),
+         backSpeed      (0.0),
+         observerSpeed  (0.0),
+         zenithRate     (0.0),
+         frontTable     (NULL),
+         stationTable   (NULL),
+         zenithTable    (NULL)
+      {
+      }
+
+      EventFunctionType    type;
+      /// For OCCULTATION_EVENT: ALL, Umbra, Penumbra or Antumbra
+      std::string          occType;
+      /// The occulting (front) body
+      CelestialBody        *front;
+      /// The occulted (back) body
+      CelestialBody        *back;
+      /// The observing station for ELEVATION_EVENT and BLOCKED_EVENT
+      BodyFixedPoint       *station;
+      /// The station's body-fixed coordinate system
+      CoordinateSystem     *stationFrame;
+      /// Station location in its body-fixed frame
+      Rvector3             stationLocation;
+      /// Station zenith (geodetic normal) in its body-fixed frame
+      Rvector3             stationZenith;
+      /// Minimum elevation, in radians
+      Real                 minElevation;
+      /// Apply light time corrections
+      bool                 useLightTime;
+      /// Light time direction is transmit rather than receive
+      bool                 transmit;
+      /// Use the speed bounds to step over spans that cannot hold an event
+      bool                 useBounds;
+      /// Speed bounds (km/s) relative to the coordinate system origin
+      Real                 scSpeed;
+      Real                 frontSpeed;
+      Real                 backSpeed;
+      Real                 observerSpeed;
+      /// Rotation rate bound for the station zenith (rad/s)
+      Real                 zenithRate;
+      /// Converter used for the station location
+      CoordinateConverter  converter;
+      /// Shapes of the front and back bodies
+      BodyShape            frontShape;
+      BodyShape            backShape;
+      /// Tabulated front body states, used in place of the body when set
+      const TrajectoryStore
+                           *frontTable;
+      /// Tabulated station positions and zenith directions, used in place
+      /// of the coordinate conversions when set
+      const TrajectoryStore
+                           *stationTable;
+      const TrajectoryStore
+                           *zenithTable;
+   };
+
+   /// One interval search in a parallel contact search
+   struct SearchTask
+   {
+      /// The event function searched
+      EventFunction        function;
+      /// The intervals searched
+      RealArray            winStarts;
+      RealArray            winEnds;
+      /// The located intervals
+      RealArray            starts;
+      RealArray            ends;
+      /// Error message if the search failed
+      std::string          error;
+   };
+
+   /// Work queue shared by the search threads
+   struct SearchQueue;
+
+   bool                 LoadTrajectory(const std::string &fileName,
+                                       TrajectoryStore &table);
+   TrajectoryStore*     GetSearchTrajectory() const;
+   bool                 GetNativeSearchWindow(Real s, Real e,
+                                              bool useEntireIntvl,
+                                              RealArray &winStarts,
+                                              RealArray &winEnds);
+   void                 TrimForLightTime(EventFunction &ef,
+                                         RealArray &winStarts,
+                                         RealArray &winEnds);
+   void                 FindNativeIntervals(EventFunction &ef,
+                                            const RealArray &winStarts,
+                                            const RealArray &winEnds,
+                                            Real stepSize,
+                                            RealArray &starts,
+                                            RealArray &ends);
+   Real                 EvaluateEventFunction(EventFunction &ef, Real epoch,
+                                              Real *safeStep = NULL);
+   bool                 FindHiddenSample(EventFunction &ef, Real t1,
+                                         Real g1, Real safe1, Real t2,
+                                         Real g2, Real safe2, Real &tm,
+                                         Real &gm, Real &safem);
+   void                 SetRateBounds(EventFunction &ef, Real start,
+                                      Real stop);
+   Real                 GetBodySpeedBound(CelestialBody *body, Real start,
+                                          Real stop);
+   Real                 RefineEventEpoch(EventFunction &ef, Real t1, Real g1,
+                                         Real t2, Real g2);
+   Rvector3             GetSpacecraftPosition(Real epoch);
+   Rvector3             GetBodyPosition(CelestialBody *body, Real epoch,
+                                        const TrajectoryStore *table = NULL);
+   Rvector3             GetStationPosition(EventFunction &ef, Real epoch,
+                                           Rvector3 &zenith);
+   Rvector3             GetLightTimePosition(CelestialBody *body,
+                                             const Rvector3 &observer,
+                                             Real epoch, bool useLightTime,
+                                             bool transmit,
+                                             const TrajectoryStore *table = NULL);
+   CelestialBody*       FindBody(const std::string &id);
+   bool                 SetUpStation(EventFunction &ef, GmatBase *observer);
+   void                 TabulateBody(CelestialBody *body, Real start,
+                                     Real stop, TrajectoryStore &table);
+   void                 TabulateStation(EventFunction &ef, Real start,
+                                        Real stop, TrajectoryStore &positions,
+                                        TrajectoryStore &zeniths);
+   void                 RunSearchTasks(std::vector<SearchTask> &tasks,
+                                       Real stepSize, Integer numThreads);
+   void                 RunSearchWorker(SearchQueue *queue);
+
+   static void          GetBodyShape(CelestialBody *body, BodyShape &shape);
+   static Real          GetAngularRateBound(Real distance, Real radius,
+                                            Real speed, Real &maxStep);
+   static Real          GetApparentRadius(const BodyShape &shape,
+                                          const Rvector3 &toLimb,
+                                          Real epoch);
+   static void          SubtractIntervals(RealArray &starts, RealArray &ends,
+                                          const RealArray &subStarts,
+                                          const RealArray &subEnds);
    #ifdef __USE_SPICE__
       /// need a SpiceInterface to load and unload kernels
       SpiceInterface       *spice;
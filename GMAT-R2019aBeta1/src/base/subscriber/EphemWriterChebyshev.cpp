@@ -0,0 +1,530 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EphemWriterChebyshev
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Writes spacecraft orbit states to a Chebyshev ephemeris file.
+ *
+ * States are buffered as they arrive and handed to the ChebyshevEphemerisFile
+ * in blocks, which fits them with polynomial records.  A block that is written
+ * because the buffer is full keeps its last state as the first state of the
+ * next block, so the records of a continuous arc join without a gap.  Blocks
+ * written at a segment break (a maneuver, for instance) do not, so no record
+ * spans the discontinuity.
+ */
+//------------------------------------------------------------------------------
+
+#include "EphemWriterChebyshev.hpp"
+#include "SubscriberException.hpp"   // for exception
+#include "MessageInterface.hpp"
+
+
+//#define DEBUG_EPHEMFILE_INSTANCE
+//#define DEBUG_EPHEMFILE_INIT
+//#define DEBUG_EPHEMFILE_CREATE
+//#define DEBUG_EPHEMFILE_BUFFER
+//#define DEBUG_EPHEMFILE_WRITE
+//#define DEBUG_EPHEMFILE_FINISH
+//#define DEBUG_EPHEMFILE_RESTART
+
+//---------------------------------
+// static data
+//---------------------------------
+
+
+//------------------------------------------------------------------------------
+// EphemWriterChebyshev(const std::string &name,
+//                      const std::string &type = "EphemWriterChebyshev")
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+EphemWriterChebyshev::EphemWriterChebyshev(const std::string &name,
+                                           const std::string &type) :
+   EphemWriterWithInterpolator(name, type),
+   chebyshevFile          (NULL),
+   chebyshevWriteFailed   (true),
+   fitTolerance           (1.0e-6)
+{
+   fileType = CHEBYSHEV_EPHEM;
+}
+
+
+//------------------------------------------------------------------------------
+// ~EphemWriterChebyshev()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EphemWriterChebyshev::~EphemWriterChebyshev()
+{
+   #ifdef DEBUG_EPHEMFILE_INSTANCE
+   MessageInterface::ShowMessage
+      ("EphemWriterChebyshev::~EphemWriterChebyshev() <%p>'%s' entered\n",
+       this, GetName().c_str());
+   #endif
+
+   // Deleting the file writes its index if that has not been done
+   if (chebyshevFile)
+      delete chebyshevFile;
+}
+
+
+//------------------------------------------------------------------------------
+// EphemWriterChebyshev(const EphemWriterChebyshev &ef)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ */
+//------------------------------------------------------------------------------
+EphemWriterChebyshev::EphemWriterChebyshev(const EphemWriterChebyshev &ef) :
+   EphemWriterWithInterpolator(ef),
+   chebyshevFile          (NULL),
+   chebyshevWriteFailed   (ef.chebyshevWriteFailed),
+   fitTolerance           (ef.fitTolerance)
+{
+   coordConverter = ef.coordConverter;
+}
+
+
+//------------------------------------------------------------------------------
+// EphemWriterChebyshev& operator=(const EphemWriterChebyshev& ef)
+//------------------------------------------------------------------------------
+/**
+ * The assignment operator
+ */
+//------------------------------------------------------------------------------
+EphemWriterChebyshev& EphemWriterChebyshev::operator=(
+      const EphemWriterChebyshev& ef)
+{
+   if (this == &ef)
+      return *this;
+
+   EphemWriterWithInterpolator::operator=(ef);
+
+   chebyshevFile        = NULL;
+   chebyshevWriteFailed = ef.chebyshevWriteFailed;
+   fitTolerance         = ef.fitTolerance;
+
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// virtual bool Initialize()
+//------------------------------------------------------------------------------
+bool EphemWriterChebyshev::Initialize()
+{
+   #ifdef DEBUG_EPHEMFILE_INIT
+   MessageInterface::ShowMessage
+      ("EphemWriterChebyshev::Initialize() <%p>'%s' entered, isInitialized=%d\n",
+       this, ephemName.c_str(), isInitialized);
+   #endif
+
+   if (isInitialized)
+      return true;
+
+   EphemWriterWithInterpolator::Initialize();
+
+   // Set maximum segment size; long blocks let the fitter grow its records
+   maxSegmentSize = 5000;
+
+   // Check if interpolator needs to be created
+   if (useFixedStepSize || interpolateInitialState || interpolateFinalState)
+      createInterpolator = true;
+   else
+      createInterpolator = false;
+
+   // Create interpolator if needed
+   if (createInterpolator)
+      CreateInterpolator();
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+//  EphemerisWriter* Clone(void) const
+//------------------------------------------------------------------------------
+/**
+ * This method returns a clone of the EphemWriterChebyshev.
+ *
+ * @return clone of the EphemWriterChebyshev.
+ */
+//------------------------------------------------------------------------------
+EphemerisWriter* EphemWriterChebyshev::Clone(void) const
+{
+   return (new EphemWriterChebyshev(*this));
+}
+
+
+//---------------------------------------------------------------------------
+// void Copy(const EphemerisWriter* orig)
+//---------------------------------------------------------------------------
+/**
+ * Sets this object to match another one.
+ *
+ * @param orig The original that is being copied.
+ */
+//---------------------------------------------------------------------------
+void EphemWriterChebyshev::Copy(const EphemerisWriter* orig)
+{
+   operator=(*((EphemWriterChebyshev *)(orig)));
+}
+
+
+//------------------------------------------------------------------------------
+// void SetFitTolerance(Real tol)
+//------------------------------------------------------------------------------
+/**
+ * Sets the position tolerance of the fitted records, in km
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::SetFitTolerance(Real tol)
+{
+   fitTolerance = tol;
+}
+
+
+//--------------------------------------
+// protected methods
+//--------------------------------------
+
+//------------------------------------------------------------------------------
+// void BufferOrbitData(Real epochInDays, const Real state[6])
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::BufferOrbitData(Real epochInDays, const Real state[6])
+{
+   #ifdef DEBUG_EPHEMFILE_BUFFER
+   MessageInterface::ShowMessage
+      ("BufferOrbitData() <%p>'%s' entered, epochInDays=%.15f, state[0]=%.15f\n",
+       this, ephemName.c_str(), epochInDays, state[0]);
+   #endif
+
+   // if buffer is full, dump the data
+   if (a1MjdArray.size() >= maxSegmentSize)
+   {
+      // Save last data to become first data of next block
+      A1Mjd *a1mjd  = new A1Mjd(*a1MjdArray.back());
+      Rvector6 *rv6 = new Rvector6(*stateArray.back());
+
+      WriteChebyshevOrbitDataSegment();
+
+      a1MjdArray.push_back(a1mjd);
+      stateArray.push_back(rv6);
+   }
+
+   // Add new data point
+   A1Mjd *a1mjd = new A1Mjd(epochInDays);
+   Rvector6 *rv6 = new Rvector6(state);
+   a1MjdArray.push_back(a1mjd);
+   stateArray.push_back(rv6);
+} // BufferOrbitData()
+
+
+//------------------------------------------------------------------------------
+// void CreateEphemerisFile(bool useDefaultFileName, const std::string &stType,
+//                          const std::string &outFormat))
+//------------------------------------------------------------------------------
+/**
+ * Creates ephemeris file writer.
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::CreateEphemerisFile(bool useDefaultFileName,
+                                               const std::string &stType,
+                                               const std::string &outFormat)
+{
+   EphemerisWriter::CreateEphemerisFile(useDefaultFileName, stType, outFormat);
+   CreateChebyshevFile();
+   isEphemFileOpened = true;
+}
+
+
+//------------------------------------------------------------------------------
+// void CreateChebyshevFile()
+//------------------------------------------------------------------------------
+/**
+ * Opens the Chebyshev file and sets its header values.
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::CreateChebyshevFile()
+{
+   #ifdef DEBUG_EPHEMFILE_CREATE
+   MessageInterface::ShowMessage
+      ("EphemWriterChebyshev::CreateChebyshevFile() <%p>'%s' entered, "
+       "chebyshevFile=<%p>\n", this, ephemName.c_str(), chebyshevFile);
+   #endif
+
+   // If chebyshevFile is not NULL, delete it first
+   if (chebyshevFile != NULL)
+   {
+      delete chebyshevFile;
+      chebyshevFile = NULL;
+   }
+
+   chebyshevFile = new ChebyshevEphemerisFile;
+   if (!chebyshevFile->OpenForWrite(fullPathFileName))
+   {
+      delete chebyshevFile;
+      chebyshevFile = NULL;
+
+      SubscriberException se;
+      se.SetDetails("Unable to open Chebyshev ephemeris file: '%s'\n",
+                    fullPathFileName.c_str());
+      throw se;
+   }
+
+   chebyshevFile->SetTolerance(fitTolerance);
+   chebyshevFile->SetCentralBody(outCoordSystem->GetOriginName());
+   chebyshevFile->SetCoordinateSystem(outCoordSystem->GetName());
+   chebyshevWriteFailed = false;
+}
+
+
+//------------------------------------------------------------------------------
+// void HandleOrbitData()
+//------------------------------------------------------------------------------
+/** Handles writing orbit data includes checking epoch to write if writing at
+ * fixed step size.
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::HandleOrbitData()
+{
+   // Check user defined initial and final epoch
+   bool processData = CheckInitialAndFinalEpoch();
+
+   // Check if it is time to write
+   bool timeToWrite = IsTimeToWrite(currEpochInSecs, currState);
+
+   HandleChebyshevOrbitData(processData, timeToWrite);
+}
+
+
+//------------------------------------------------------------------------------
+// void StartNewSegment(const std::string &comments, bool saveEpochInfo,
+//                      bool writeAfterData, bool ignoreBlankComments)
+//------------------------------------------------------------------------------
+/**
+ * Finishes writing remaining data and resets flags to start new segment.
+ * Comments are not stored in Chebyshev files.
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::StartNewSegment(const std::string &comments,
+                                           bool saveEpochInfo,
+                                           bool writeAfterData,
+                                           bool ignoreBlankComments)
+{
+   #ifdef DEBUG_EPHEMFILE_RESTART
+   MessageInterface::ShowMessage
+      ("===== EphemWriterChebyshev::StartNewSegment() entered, canFinalize=%d, "
+       "firstTimeWriting=%d\n", canFinalize, firstTimeWriting);
+   #endif
+
+   // If no first data has written out yet, just return
+   if (firstTimeWriting)
+      return;
+
+   // Write data for the rest of times on waiting
+   FinishUpWriting();
+
+   if (chebyshevFile != NULL)
+      WriteChebyshevOrbitDataSegment();
+
+   // Initialize data
+   InitializeData(saveEpochInfo);
+}
+
+
+//------------------------------------------------------------------------------
+// void FinishUpWriting()
+//------------------------------------------------------------------------------
+/*
+ * Finishes up writing data at epochs on waiting.
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::FinishUpWriting()
+{
+   #ifdef DEBUG_EPHEMFILE_FINISH
+   MessageInterface::ShowMessage
+      ("EphemWriterChebyshev::FinishUpWriting() '%s' entered, canFinalize=%d, "
+       "isFinalized=%d, isEndOfRun=%d, %d point(s) in the buffer\n",
+       ephemName.c_str(), canFinalize, isFinalized, isEndOfRun, a1MjdArray.size());
+   #endif
+
+   if (!isFinalized)
+   {
+      FinishUpWritingChebyshev();
+
+      if (canFinalize)
+      {
+         if (isEndOfRun)
+         {
+            CloseEphemerisFile();
+
+            // Check for user defined final epoch (GMT-4108 fix)
+            if (finalEpochA1Mjd != -999.999)
+            {
+               if (currEpochInDays < finalEpochA1Mjd)
+               {
+                  MessageInterface::ShowMessage
+                     ("*** WARNING *** Run ended at %f before the user defined "
+                      "final epoch of %f\n", currEpochInDays, finalEpochA1Mjd);
+               }
+            }
+         }
+
+         isFinalized = true;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void CloseEphemerisFile(bool done = true, writeMetaData = true)
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::CloseEphemerisFile(bool done, bool writeMetaData)
+{
+   FinalizeChebyshevFile();
+}
+
+
+//------------------------------------------------------------------------------
+// void HandleChebyshevOrbitData(bool writeData, bool timeToWrite)
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::HandleChebyshevOrbitData(bool writeData,
+                                                    bool timeToWrite)
+{
+   // The interpolator buffer is limited, so check at least every 10 minutes
+   // when the steps are large (see EphemWriterSTK)
+   if (!timeToWrite)
+   {
+      if ((currEpochInSecs - prevProcTime) > 600.0)
+         timeToWrite = true;
+   }
+
+   if (timeToWrite)
+      prevProcTime = currEpochInSecs;
+
+   if (writeData && timeToWrite)
+   {
+      if (writingNewSegment)
+         WriteChebyshevOrbitDataSegment();
+
+      if (writeOrbit)
+         HandleWriteOrbit();
+
+      if (firstTimeWriting)
+         firstTimeWriting = false;
+
+      if (writingNewSegment)
+         writingNewSegment = false;
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FinishUpWritingChebyshev()
+//------------------------------------------------------------------------------
+/**
+ * Writes final data segment.
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::FinishUpWritingChebyshev()
+{
+   if (interpolator != NULL && useFixedStepSize)
+   {
+      // First check for not enough data points for interpolation
+      if (canFinalize && interpolatorStatus == -1)
+      {
+         isFinalized = true;
+         std::string ephemMsg, errMsg;
+         FormatErrorMessage(ephemMsg, errMsg);
+         throw SubscriberException(errMsg);
+      }
+
+      // Process final data on waiting to be output
+      ProcessFinalDataOnWaiting();
+   }
+
+   if (chebyshevFile != NULL)
+      WriteChebyshevOrbitDataSegment();
+   else if (a1MjdArray.size() > 0)
+      throw SubscriberException
+         ("*** INTERNAL ERROR *** Chebyshev file is NULL in "
+          "EphemWriterChebyshev::FinishUpWritingChebyshev()\n");
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteChebyshevOrbitDataSegment()
+//------------------------------------------------------------------------------
+/**
+ * Fits and writes the buffered states and deletes the data arrays
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::WriteChebyshevOrbitDataSegment()
+{
+   #ifdef DEBUG_EPHEMFILE_WRITE
+   MessageInterface::ShowMessage
+      ("=====> WriteChebyshevOrbitDataSegment() <%p>'%s' entered, "
+       "a1MjdArray.size()=%d\n", this, ephemName.c_str(), a1MjdArray.size());
+   #endif
+
+   if (a1MjdArray.size() > 0)
+   {
+      if (chebyshevFile == NULL)
+         throw SubscriberException
+            ("*** INTERNAL ERROR *** Chebyshev file is NULL in "
+             "EphemWriterChebyshev::WriteChebyshevOrbitDataSegment()\n");
+
+      try
+      {
+         // A lone state cannot be fitted; it is dropped, as for the SPK
+         // writer's minimum segment size
+         chebyshevFile->WriteDataSegment(a1MjdArray, stateArray);
+         ClearOrbitData();
+      }
+      catch (BaseException &e)
+      {
+         ClearOrbitData();
+         chebyshevWriteFailed = true;
+         e.SetFatal(true);
+         throw;
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// void FinalizeChebyshevFile()
+//------------------------------------------------------------------------------
+/**
+ * Writes the record index and closes the file
+ */
+//------------------------------------------------------------------------------
+void EphemWriterChebyshev::FinalizeChebyshevFile()
+{
+   if (chebyshevFile == NULL)
+      return;
+
+   if (!chebyshevWriteFailed)
+      chebyshevFile->CloseForWrite();
+}
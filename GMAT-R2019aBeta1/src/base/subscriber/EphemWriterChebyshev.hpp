@@ -0,0 +1,79 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EphemWriterChebyshev
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Writes spacecraft orbit states to a Chebyshev ephemeris file.
+ */
+//------------------------------------------------------------------------------
+#ifndef EphemWriterChebyshev_hpp
+#define EphemWriterChebyshev_hpp
+
+#include "EphemWriterWithInterpolator.hpp"
+#include "ChebyshevEphemerisFile.hpp"
+
+class GMAT_API EphemWriterChebyshev : public EphemWriterWithInterpolator
+{
+public:
+   EphemWriterChebyshev(const std::string &name,
+                        const std::string &type = "EphemWriterChebyshev");
+   virtual ~EphemWriterChebyshev();
+   EphemWriterChebyshev(const EphemWriterChebyshev &);
+   EphemWriterChebyshev& operator=(const EphemWriterChebyshev&);
+
+   virtual bool             Initialize();
+   virtual EphemerisWriter* Clone(void) const;
+   virtual void             Copy(const EphemerisWriter* orig);
+
+   void         SetFitTolerance(Real tol);
+
+protected:
+
+   ChebyshevEphemerisFile *chebyshevFile; // owned object
+   bool                   chebyshevWriteFailed;
+   /// Position tolerance of the fitted records, in km
+   Real                   fitTolerance;
+
+   // Abstract methods required by all subclasses
+   virtual void BufferOrbitData(Real epochInDays, const Real state[6]);
+
+   // Initialization
+   virtual void CreateEphemerisFile(bool useDefaultFileName,
+                                    const std::string &stType,
+                                    const std::string &outFormat);
+   void         CreateChebyshevFile();
+
+   // Data
+   virtual void HandleOrbitData();
+   virtual void StartNewSegment(const std::string &comments,
+                                bool saveEpochInfo,
+                                bool writeAfterData,
+                                bool ignoreBlankComments);
+   virtual void FinishUpWriting();
+   virtual void CloseEphemerisFile(bool done = true, bool writeMetaData = true);
+
+   void         HandleChebyshevOrbitData(bool writeData, bool timeToWrite);
+   void         FinishUpWritingChebyshev();
+
+   // Chebyshev file writing
+   void         WriteChebyshevOrbitDataSegment();
+   void         FinalizeChebyshevFile();
+};
+
+#endif // EphemWriterChebyshev_hpp
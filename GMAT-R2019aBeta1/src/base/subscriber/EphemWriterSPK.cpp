@@ -32,6 +32,7 @@
 #include "SubscriberException.hpp"   // for exception
 #include "RealUtilities.hpp"         // for IsEven()
 #include "MessageInterface.hpp"
+#include "TrajectoryStore.hpp"
 #include <sstream>                   // for <<, std::endl
 
 #ifdef __USE_SPICE__
@@ -263,6 +264,9 @@ void EphemWriterSPK::BufferOrbitData(Real epochInDays, const Real state[6])
    a1MjdArray.push_back(a1mjd);
    stateArray.push_back(rv6);
    
+   if (trajectoryStore)
+      trajectoryStore->AddState(epochInDays, state);
+   
    #ifdef DEBUG_EPHEMFILE_BUFFER
    MessageInterface::ShowMessage
       ("BufferOrbitData() leaving, there is(are) %d data point(s)\n", a1MjdArray.size());
@@ -699,9 +699,9 @@ void EphemWriterWithInterpolator::ProcessFinalDataOnWaiting(bool canFinish)
                if (currEpochInSecs > (lastEpochWrote + timeTolerance))
                   writeFinalData = true;
             }
-            else if (fileType == STK_TIMEPOSVEL)
+            else if (fileType == STK_TIMEPOSVEL || fileType == CHEBYSHEV_EPHEM)
             {
-                // For STK_TIMEPOSVEL, write out final data if current epoch is after last epoch
+                // For STK_TIMEPOSVEL and Chebyshev, write out final data if current epoch is after last epoch
                 if (currEpochInSecs > (lastEpochWrote + timeTolerance))
                     writeFinalData = true;
             }
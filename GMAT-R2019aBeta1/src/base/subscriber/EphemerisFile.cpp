@@ -44,6 +44,7 @@
 #include "EphemWriterSPK.hpp"
 #include "EphemWriterCode500.hpp"
 #include "EphemWriterSTK.hpp"
+#include "EphemWriterChebyshev.hpp"
 #include <sstream>                   // for <<, std::endl
 
 
@@ -109,7 +110,8 @@ EphemerisFile::PARAMETER_TEXT[EphemerisFileParamCount - SubscriberParamCount] =
    "WriteEphemeris",        // WRITE_EPHEMERIS
    "FileName",              // FILE_NAME - deprecated
    "DistanceUnit",          // DISTANCE_UNIT
-   "IncludeEventBoundaries" // INCLUDE_EVENT_BOUNDARIES
+   "IncludeEventBoundaries",// INCLUDE_EVENT_BOUNDARIES
+   "FitTolerance"           // FIT_TOLERANCE
 };
 
 const Gmat::ParameterType
@@ -132,6 +134,7 @@ EphemerisFile::PARAMETER_TYPE[EphemerisFileParamCount - SubscriberParamCount] =
    Gmat::STRING_TYPE,       // FILE_NAME - deprecated
    Gmat::ENUMERATION_TYPE,  // DISTANCE_UNIT
    Gmat::BOOLEAN_TYPE,      // INCLUDE_EVENT_BOUNDARIES
+   Gmat::REAL_TYPE,         // FIT_TOLERANCE
 };
 
 
@@ -147,6 +150,7 @@ EphemerisFile::EphemerisFile(const std::string &name, const std::string &type) :
    spacecraft              (NULL),
    outCoordSystem          (NULL),
    ephemWriter             (NULL),
+   trajectoryStore         (NULL),
    fullPathFileName        (""),
    spacecraftName          (""),
    spacecraftId            (""),
@@ -165,6 +169,7 @@ EphemerisFile::EphemerisFile(const std::string &name, const std::string &type) :
    usingDefaultFileName    (true),
    generateInBackground    (false),
    allowMultipleSegments   (true),
+   includeEventBoundaries  (true),
    prevPropName            (""),
    currPropName            (""),
    interpolationOrder      (7),
@@ -188,7 +193,7 @@ EphemerisFile::EphemerisFile(const std::string &name, const std::string &type) :
    canFinalize             (false),
    fileType                (UNKNOWN_FILE_TYPE),
    distanceUnit            ("Kilometers"),
-   includeEventBoundaries  (true)
+   fitTolerance            (1.0e-6)
 {
    #ifdef DEBUG_EPHEMFILE_INSTANCE
    MessageInterface::ShowMessage
@@ -221,6 +226,7 @@ EphemerisFile::EphemerisFile(const std::string &name, const std::string &type) :
    fileFormatList.push_back("SPK");
    fileFormatList.push_back("Code-500");
    fileFormatList.push_back("STK-TimePosVel");
+   fileFormatList.push_back("Chebyshev");
    
    epochFormatList.clear();
    epochFormatList.push_back("UTCGregorian");
@@ -311,6 +317,7 @@ EphemerisFile::EphemerisFile(const EphemerisFile &ef) :
    spacecraft              (ef.spacecraft),
    outCoordSystem          (ef.outCoordSystem),
    ephemWriter             (NULL),
+   trajectoryStore         (NULL),
    fullPathFileName        (ef.fullPathFileName),
    spacecraftName          (ef.spacecraftName),
    spacecraftId            (ef.spacecraftId),
@@ -329,6 +336,7 @@ EphemerisFile::EphemerisFile(const EphemerisFile &ef) :
    usingDefaultFileName    (ef.usingDefaultFileName),
    generateInBackground    (ef.generateInBackground),
    allowMultipleSegments   (ef.allowMultipleSegments),
+   includeEventBoundaries  (ef.includeEventBoundaries),
    prevPropName            (ef.prevPropName),
    currPropName            (ef.currPropName),
    interpolationOrder      (ef.interpolationOrder),
@@ -351,7 +359,7 @@ EphemerisFile::EphemerisFile(const EphemerisFile &ef) :
    isEphemFileOpened       (ef.isEphemFileOpened),
    canFinalize             (ef.canFinalize),
    distanceUnit            (ef.distanceUnit),
-   includeEventBoundaries  (ef.includeEventBoundaries)
+   fitTolerance            (ef.fitTolerance)
 {
    #ifdef DEBUG_EPHEMFILE_INSTANCE
    MessageInterface::ShowMessage
@@ -383,6 +391,7 @@ EphemerisFile& EphemerisFile::operator=(const EphemerisFile& ef)
    spacecraft           = ef.spacecraft;
    outCoordSystem       = ef.outCoordSystem;
    ephemWriter          = NULL;
+   trajectoryStore      = NULL;
    fullPathFileName     = ef.fullPathFileName;
    spacecraftName       = ef.spacecraftName;
    spacecraftId         = ef.spacecraftId;
@@ -423,6 +432,7 @@ EphemerisFile& EphemerisFile::operator=(const EphemerisFile& ef)
    isEphemFileOpened    = ef.isEphemFileOpened;
    canFinalize          = ef.canFinalize;
    distanceUnit         = ef.distanceUnit;
+   fitTolerance         = ef.fitTolerance;
    includeEventBoundaries = ef.includeEventBoundaries;
    return *this;
 }
@@ -454,6 +464,8 @@ std::string EphemerisFile::GetProperFileName(const std::string &fName,
       defaultExt = ".aem";
    else if (fType == "STK-TimePosVel")
       defaultExt = ".e";
+   else if (fType == "Chebyshev")
+      defaultExt = ".ceph";
    
    std::string parsedExt = GmatFileUtil::ParseFileExtension(fName, true);
    if (parsedExt != "" && parsedExt != defaultExt)
@@ -526,6 +538,22 @@ void EphemerisFile::SetBackgroundGeneration(bool inBackground)
 }
 
 
+//------------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *store)
+//------------------------------------------------------------------------------
+/**
+ * Passes an in-memory trajectory store to the writer, which then adds each
+ * buffered orbit state to it.  Used by the EphemManager for event location.
+ */
+//------------------------------------------------------------------------------
+void EphemerisFile::SetTrajectoryStore(TrajectoryStore *store)
+{
+   trajectoryStore = store;
+   if (ephemWriter)
+      ephemWriter->SetTrajectoryStore(store);
+}
+
+
 //----------------------------------
 // methods inherited from Subscriber
 //----------------------------------
@@ -607,6 +635,8 @@ bool EphemerisFile::Initialize()
       fileType = CODE500_EPHEM;
    else if (fileFormat == "STK-TimePosVel")
       fileType = STK_TIMEPOSVEL;
+   else if (fileFormat == "Chebyshev")
+      fileType = CHEBYSHEV_EPHEM;
    else
       throw SubscriberException
          ("FileFormat \"" + fileFormat + "\" is not valid");
@@ -890,6 +920,9 @@ bool EphemerisFile::IsParameterReadOnly(const Integer id) const
    if (id == INCLUDE_EVENT_BOUNDARIES)
       if (fileFormat != "STK-TimePosVel")
          return true;
+   if (id == FIT_TOLERANCE)
+      if (fileFormat != "Chebyshev")
+         return true;
    
    return Subscriber::IsParameterReadOnly(id);
 }
@@ -1082,6 +1115,67 @@ Integer EphemerisFile::SetIntegerParameter(const Integer id, const Integer value
 }
 
 
+//------------------------------------------------------------------------------
+// Real GetRealParameter(const Integer id) const
+//------------------------------------------------------------------------------
+Real EphemerisFile::GetRealParameter(const Integer id) const
+{
+   switch (id)
+   {
+   case FIT_TOLERANCE:
+      return fitTolerance;
+   default:
+      return Subscriber::GetRealParameter(id);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real SetRealParameter(const Integer id, const Real value)
+//------------------------------------------------------------------------------
+Real EphemerisFile::SetRealParameter(const Integer id, const Real value)
+{
+   switch (id)
+   {
+   case FIT_TOLERANCE:
+      if (value > 0.0)
+      {
+         fitTolerance = value;
+         return fitTolerance;
+      }
+      else
+      {
+         SubscriberException se;
+         se.SetDetails(errorMessageFormat.c_str(),
+                       GmatStringUtil::ToString(value, 16).c_str(),
+                       GetParameterText(FIT_TOLERANCE).c_str(),
+                       "Real Number > 0.0");
+         throw se;
+      }
+   default:
+      return Subscriber::SetRealParameter(id, value);
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetRealParameter(const std::string &label) const
+//------------------------------------------------------------------------------
+Real EphemerisFile::GetRealParameter(const std::string &label) const
+{
+   return GetRealParameter(GetParameterID(label));
+}
+
+
+//------------------------------------------------------------------------------
+// Real SetRealParameter(const std::string &label, const Real value)
+//------------------------------------------------------------------------------
+Real EphemerisFile::SetRealParameter(const std::string &label, const Real value)
+{
+   return SetRealParameter(GetParameterID(label), value);
+}
+
+
 //------------------------------------------------------------------------------
 // std::string GetStringParameter(const Integer id) const
 //------------------------------------------------------------------------------
@@ -1250,7 +1344,8 @@ bool EphemerisFile::SetStringParameter(const Integer id, const std::string &valu
          fileFormat = value;
          
          // Code to link interpolator selection to file type
-         if (fileFormat == "CCSDS-OEM" || fileFormat == "STK-TimePosVel")
+         if (fileFormat == "CCSDS-OEM" || fileFormat == "STK-TimePosVel" ||
+             fileFormat == "Chebyshev")
             interpolatorName = "Lagrange";
          else if (fileFormat == "SPK")
             interpolatorName = "Hermite";
@@ -1316,7 +1411,7 @@ bool EphemerisFile::SetStringParameter(const Integer id, const std::string &valu
    // passed in, just ensure compatibility
    case INTERPOLATOR:
       if (fileFormat == "CCSDS-OEM" || fileFormat == "Code-500" ||
-          fileFormat == "STK-TimePosVel")
+          fileFormat == "STK-TimePosVel" || fileFormat == "Chebyshev")
       {
          if (value != "Lagrange")
             throw SubscriberException("Cannot set interpolator \"" + value +
@@ -1604,7 +1699,8 @@ void EphemerisFile::ValidateParameters(bool forInitialization)
       // check for FileFormat and StateType
       if ((fileFormat == "CCSDS-OEM" && stateType == "Quaternion") ||
           (fileFormat == "CCSDS-AEM" && stateType == "Cartesian") ||
-          (fileFormat == "Code-500" && stateType == "Quaternion"))
+          (fileFormat == "Code-500" && stateType == "Quaternion") ||
+          (fileFormat == "Chebyshev" && stateType == "Quaternion"))
          throw SubscriberException
             ("FileFormat \"" + fileFormat + "\" and StateType " + "\"" + stateType +
              "\" does not match for the EphemerisFile \"" + GetName() + "\"");
@@ -1824,6 +1920,11 @@ void EphemerisFile::CreateEphemerisWriter()
       ((EphemWriterSTK*)ephemWriter)->SetDistanceUnit(distanceUnit);
       ((EphemWriterSTK*)ephemWriter)->SetIncludeEventBoundaries(includeEventBoundaries);
    }
+   else if (fileFormat == "Chebyshev")
+   {
+      ephemWriter = new EphemWriterChebyshev(GetName(), fileFormat);
+      ((EphemWriterChebyshev*)ephemWriter)->SetFitTolerance(fitTolerance);
+   }
    else
    {
       SubscriberException se;
@@ -1846,6 +1947,7 @@ void EphemerisFile::CreateEphemerisWriter()
                                useFixedStepSize, interpolatorName, interpolationOrder);
    ephemWriter->SetInitialTime(initialEpochA1Mjd, finalEpochA1Mjd);
    ephemWriter->SetIsEphemGlobal(IsGlobal());
+   ephemWriter->SetTrajectoryStore(trajectoryStore);
    ephemWriter->Initialize();
    CreateEphemerisFile();
    
@@ -51,6 +51,7 @@ public:
                                           bool saveFileName);
    
    virtual void         SetBackgroundGeneration(bool inBackground);
+   virtual void         SetTrajectoryStore(TrajectoryStore *store);
    
    // Need to be able to close background SPKs and leave ready for appending
    // Finalization
@@ -94,6 +95,13 @@ public:
    virtual Integer      SetIntegerParameter(const Integer id,
                                             const Integer value);
    
+   virtual Real         GetRealParameter(const Integer id) const;
+   virtual Real         SetRealParameter(const Integer id,
+                                         const Real value);
+   virtual Real         GetRealParameter(const std::string &label) const;
+   virtual Real         SetRealParameter(const std::string &label,
+                                         const Real value);
+   
    virtual std::string  GetStringParameter(const Integer id) const;
    virtual std::string  GetStringParameter(const std::string &label) const;
    virtual bool         SetStringParameter(const Integer id,
@@ -114,12 +122,14 @@ protected:
    enum FileType
    {
       CCSDS_OEM, CCSDS_AEM, SPK_ORBIT, SPK_ATTITUDE, CODE500_EPHEM,
-      STK_TIMEPOSVEL, UNKNOWN_FILE_TYPE
+      STK_TIMEPOSVEL, CHEBYSHEV_EPHEM, UNKNOWN_FILE_TYPE
    };
    
    Spacecraft        *spacecraft;
    CoordinateSystem  *outCoordSystem;
    EphemerisWriter   *ephemWriter;
+   /// In-memory store fed by the writer (not owned)
+   TrajectoryStore   *trajectoryStore;
    
    /// ephemeris full file name including the path
    std::string fullPathFileName;
@@ -170,6 +180,8 @@ protected:
    FileType    fileType;
    
    std::string distanceUnit;
+   /// Position tolerance of Chebyshev records, in km
+   Real        fitTolerance;
 
    /// for maneuver handling
    ObjectArray maneuversHandled;
@@ -279,6 +291,7 @@ protected:
       FILE_NAME,                // deprecated
       DISTANCE_UNIT,            // Meters or kilometers
       INCLUDE_EVENT_BOUNDARIES,
+      FIT_TOLERANCE,            // Chebyshev fit tolerance in km
       EphemerisFileParamCount   // Count of the parameters for this class
    };
    
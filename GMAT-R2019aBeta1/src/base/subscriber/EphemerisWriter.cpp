@@ -83,6 +83,7 @@ EphemerisWriter::EphemerisWriter(const std::string &name, const std::string &typ
    spacecraft           (NULL),
    dataCoordSystem      (NULL),
    outCoordSystem       (NULL),
+   trajectoryStore      (NULL),
    fullPathFileName     (""),
    spacecraftName       (""),
    spacecraftId         (""),
@@ -189,6 +190,7 @@ EphemerisWriter::EphemerisWriter(const EphemerisWriter &ef) :
    spacecraft           (ef.spacecraft),
    outCoordSystem       (ef.outCoordSystem),
    dataCoordSystem      (ef.outCoordSystem),
+   trajectoryStore      (NULL),
    fullPathFileName     (ef.fullPathFileName),
    spacecraftName       (ef.spacecraftName),
    spacecraftId         (ef.spacecraftId),
@@ -275,6 +277,7 @@ EphemerisWriter& EphemerisWriter::operator=(const EphemerisWriter& ef)
    spacecraft           = ef.spacecraft;
    outCoordSystem       = ef.outCoordSystem;
    dataCoordSystem      = ef.dataCoordSystem;
+   trajectoryStore      = NULL;
    fullPathFileName     = ef.fullPathFileName;
    spacecraftName       = ef.spacecraftName;
    spacecraftId         = ef.spacecraftId;
@@ -470,6 +473,19 @@ void EphemerisWriter::SetBackgroundGeneration(bool inBackground)
    generateInBackground = inBackground;
 }
 
+//------------------------------------------------------------------------------
+// void SetTrajectoryStore(TrajectoryStore *store)
+//------------------------------------------------------------------------------
+/**
+ * Sets a store that receives a copy of each orbit state as it is buffered.
+ * The store is not owned by the writer and is not passed to copies.
+ */
+//------------------------------------------------------------------------------
+void EphemerisWriter::SetTrajectoryStore(TrajectoryStore *store)
+{
+   trajectoryStore = store;
+}
+
 //------------------------------------------------------------------------------
 // void SetRunFlags(bool finalize, bool endOfRun, bool finalized)
 //------------------------------------------------------------------------------
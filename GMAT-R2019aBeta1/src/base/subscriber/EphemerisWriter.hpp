@@ -34,6 +34,8 @@
 #include <iostream>
 #include <fstream>
 
+class TrajectoryStore;
+
 class GMAT_API EphemerisWriter
 {
 public:
@@ -57,6 +59,7 @@ public:
    void  SetIsEphemGlobal(bool isGlobal);
    void  SetIsEphemLocal(bool isLocal);
    void  SetBackgroundGeneration(bool inBackground);
+   void  SetTrajectoryStore(TrajectoryStore *store);
    void  SetRunFlags(bool finalize, bool endOfRun, bool isFinalized);
    void  SetOrbitData(Real epochInDays, Real state[6]);
    void  SetEpochAndDirection(Real prvEpochInSecs, Real curEpochInSecs,
@@ -131,7 +134,7 @@ protected:
    enum FileType
    {
       CCSDS_OEM, CCSDS_AEM, SPK_ORBIT, SPK_ATTITUDE, CODE500_EPHEM,
-      STK_TIMEPOSVEL, UNKNOWN_FILE_TYPE
+      STK_TIMEPOSVEL, CHEBYSHEV_EPHEM, UNKNOWN_FILE_TYPE
    };
    
    std::string ephemName;
@@ -146,6 +149,9 @@ protected:
    CoordinateSystem *dataCoordSystem;
    CoordinateSystem *outCoordSystem;
    
+   // Optional in-memory copy of the buffered orbit data (not owned)
+   TrajectoryStore  *trajectoryStore;
+   
    // for buffering ephemeris data
    EpochArray  a1MjdArray;
    StateArray  stateArray;
@@ -0,0 +1,495 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TrajectoryStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implementation of the TrajectoryStore, an in-memory record of the states
+ * written for a spacecraft by the EphemManager.
+ */
+//------------------------------------------------------------------------------
+
+#include "TrajectoryStore.hpp"
+#include "GmatConstants.hpp"
+#include "MessageInterface.hpp"
+#include "RealUtilities.hpp"
+#include <algorithm>
+
+//#define DEBUG_TRAJECTORY_STORE
+
+namespace
+{
+   /// Largest supported interpolation window (nodes)
+   const Integer MAX_WINDOW_SIZE = 8;
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore(Integer nodesPerWindow)
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ *
+ * @param nodesPerWindow Number of nodes used for each interpolation; the
+ *                       interpolating polynomial has degree
+ *                       2*nodesPerWindow - 1.  The default of 4 nodes matches
+ *                       the order 7 Hermite interpolation the EphemManager
+ *                       requests for its SPK files.
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::TrajectoryStore(Integer nodesPerWindow) :
+   windowSize        (nodesPerWindow)
+{
+   if (windowSize < 2)
+      windowSize = 2;
+   if (windowSize > MAX_WINDOW_SIZE)
+      windowSize = MAX_WINDOW_SIZE;
+}
+
+
+//------------------------------------------------------------------------------
+// ~TrajectoryStore()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::~TrajectoryStore()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore(const TrajectoryStore& ts)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * @param ts The store copied into this one
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore::TrajectoryStore(const TrajectoryStore& ts) :
+   arcs              (ts.arcs),
+   windowSize        (ts.windowSize)
+{
+}
+
+
+//------------------------------------------------------------------------------
+// TrajectoryStore& operator=(const TrajectoryStore& ts)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ *
+ * @param ts The store copied into this one
+ *
+ * @return This store, set to match ts
+ */
+//------------------------------------------------------------------------------
+TrajectoryStore& TrajectoryStore::operator=(const TrajectoryStore& ts)
+{
+   if (&ts != this)
+   {
+      arcs       = ts.arcs;
+      windowSize = ts.windowSize;
+   }
+   return *this;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddState(Real epoch, const Real state[6])
+//------------------------------------------------------------------------------
+/**
+ * Appends a node to the trajectory
+ *
+ * A node at the epoch of the previous node starts a new arc when its state
+ * differs (an impulsive maneuver or a reset of the spacecraft) and is dropped
+ * when it repeats the previous node.  A node earlier than the previous node
+ * also starts a new arc, so interpolation never crosses a discontinuity.
+ *
+ * @param epoch The A.1 epoch of the node
+ * @param state The Cartesian state at the node
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::AddState(Real epoch, const Real state[6])
+{
+   bool newArc = arcs.empty();
+
+   if (!newArc)
+   {
+      Arc &current = arcs.back();
+      Real lastEpoch = current.epochs.back();
+      if (epoch == lastEpoch)
+      {
+         const Rvector6 &lastState = current.states.back();
+         bool same = true;
+         for (Integer i = 0; i < 6; ++i)
+            if (lastState[i] != state[i])
+               same = false;
+         if (same)
+            return;
+         newArc = true;
+      }
+      else if (epoch < lastEpoch)
+         newArc = true;
+   }
+
+   if (newArc)
+   {
+      // A single node arc does not cover any time, so replace it
+      if (!arcs.empty() && arcs.back().epochs.size() < 2)
+         arcs.pop_back();
+      arcs.push_back(Arc());
+
+      #ifdef DEBUG_TRAJECTORY_STORE
+         MessageInterface::ShowMessage("TrajectoryStore: arc %d starts at "
+               "%.12lf\n", (Integer)arcs.size() - 1, epoch);
+      #endif
+   }
+
+   arcs.back().epochs.push_back(epoch);
+   arcs.back().states.push_back(Rvector6(state));
+}
+
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all of the recorded nodes
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::Clear()
+{
+   arcs.clear();
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsEmpty() const
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if the store covers any time span
+ *
+ * @return true if there is no arc with at least two nodes
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::IsEmpty() const
+{
+   for (UnsignedInt i = 0; i < arcs.size(); ++i)
+      if (arcs[i].epochs.size() > 1)
+         return false;
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetArcCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of continuous arcs in the store
+ *
+ * @return The arc count
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::GetArcCount() const
+{
+   return (Integer)arcs.size();
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetNodeCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the total number of nodes in the store
+ *
+ * @return The node count
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::GetNodeCount() const
+{
+   Integer count = 0;
+   for (UnsignedInt i = 0; i < arcs.size(); ++i)
+      count += (Integer)arcs[i].epochs.size();
+   return count;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetCoverage(Real &start, Real &stop) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the span from the first to the last recorded epoch
+ *
+ * @param start The earliest covered epoch (output)
+ * @param stop  The latest covered epoch (output)
+ *
+ * @return true if the store covers any time, false if it is empty
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::GetCoverage(Real &start, Real &stop) const
+{
+   RealArray starts, stops;
+   GetArcIntervals(starts, stops);
+   if (starts.empty())
+      return false;
+
+   start = *std::min_element(starts.begin(), starts.end());
+   stop  = *std::max_element(stops.begin(), stops.end());
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// void GetArcIntervals(RealArray &starts, RealArray &stops) const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the time span of each arc that covers time
+ *
+ * @param starts The arc start epochs (output)
+ * @param stops  The arc end epochs (output)
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::GetArcIntervals(RealArray &starts,
+      RealArray &stops) const
+{
+   starts.clear();
+   stops.clear();
+   for (UnsignedInt i = 0; i < arcs.size(); ++i)
+   {
+      if (arcs[i].epochs.size() > 1)
+      {
+         starts.push_back(arcs[i].epochs.front());
+         stops.push_back(arcs[i].epochs.back());
+      }
+   }
+}
+
+
+//------------------------------------------------------------------------------
+// bool IsCovered(Real epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Checks to see if a state is available at an epoch
+ *
+ * @param epoch The A.1 epoch to check
+ *
+ * @return true if an arc spans the epoch
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::IsCovered(Real epoch) const
+{
+   return FindArc(epoch) >= 0;
+}
+
+
+//------------------------------------------------------------------------------
+// bool GetState(Real epoch, Rvector6 &state) const
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the state at an epoch
+ *
+ * @param epoch The A.1 epoch of the requested state
+ * @param state The interpolated Cartesian state (output)
+ *
+ * @return true if the epoch is covered, false if it is not
+ */
+//------------------------------------------------------------------------------
+bool TrajectoryStore::GetState(Real epoch, Rvector6 &state) const
+{
+   Integer arcIndex = FindArc(epoch);
+   if (arcIndex < 0)
+      return false;
+
+   const Arc &arc = arcs[arcIndex];
+   Integer nodeCount = (Integer)arc.epochs.size();
+
+   // Index of the node at or before the epoch
+   Integer index = (Integer)(std::upper_bound(arc.epochs.begin(),
+         arc.epochs.end(), epoch) - arc.epochs.begin()) - 1;
+   if (index >= nodeCount - 1)
+      index = nodeCount - 2;
+
+   if (epoch == arc.epochs[index])
+   {
+      state = arc.states[index];
+      return true;
+   }
+
+   // Center the window on the bracketing pair, staying inside the arc
+   Integer nodes = (windowSize < nodeCount ? windowSize : nodeCount);
+   Integer first = index - (nodes / 2 - 1);
+   if (first > nodeCount - nodes)
+      first = nodeCount - nodes;
+   if (first < 0)
+      first = 0;
+
+   Interpolate(arc, first, epoch, state);
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetSpeedBound(Real start, Real stop) const
+//------------------------------------------------------------------------------
+/**
+ * Bounds the speed across a span.  The bound is the largest node speed plus
+ * the largest change in velocity between neighboring nodes, which covers the
+ * interpolated motion between the nodes as long as the acceleration changes
+ * little from one node to the next.  The nodes just outside the span are
+ * included, so the nodes bracketing every epoch in the span are checked.
+ *
+ * @param start Start of the span (A.1 Mod Julian days)
+ * @param stop  End of the span
+ *
+ * @return The speed bound, or 0.0 if no arc touches the span
+ */
+//------------------------------------------------------------------------------
+Real TrajectoryStore::GetSpeedBound(Real start, Real stop) const
+{
+   Real maxSpeed = 0.0, maxChange = 0.0;
+   for (UnsignedInt i = 0; i < arcs.size(); ++i)
+   {
+      const RealArray &epochs = arcs[i].epochs;
+      if (epochs.empty() || (epochs.back() < start) || (epochs.front() > stop))
+         continue;
+
+      Integer first = (Integer)(std::upper_bound(epochs.begin(), epochs.end(),
+            start) - epochs.begin()) - 1;
+      Integer last  = (Integer)(std::lower_bound(epochs.begin(), epochs.end(),
+            stop) - epochs.begin());
+      if (first < 0)
+         first = 0;
+      if (last >= (Integer)epochs.size())
+         last = (Integer)epochs.size() - 1;
+
+      for (Integer k = first; k <= last; ++k)
+      {
+         const Rvector6 &node = arcs[i].states[k];
+         Real speed = GmatMathUtil::Sqrt(node[3] * node[3] +
+               node[4] * node[4] + node[5] * node[5]);
+         if (speed > maxSpeed)
+            maxSpeed = speed;
+
+         if (k > first)
+         {
+            const Rvector6 &prev = arcs[i].states[k-1];
+            Real dv[3] = {node[3] - prev[3], node[4] - prev[4],
+                          node[5] - prev[5]};
+            Real change = GmatMathUtil::Sqrt(dv[0] * dv[0] + dv[1] * dv[1] +
+                  dv[2] * dv[2]);
+            if (change > maxChange)
+               maxChange = change;
+         }
+      }
+   }
+   return (maxSpeed > 0.0 ? maxSpeed + maxChange : 0.0);
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindArc(Real epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the arc that covers an epoch
+ *
+ * When arcs touch at a discontinuity, the later arc is used for the shared
+ * epoch.
+ *
+ * @param epoch The A.1 epoch
+ *
+ * @return The index of the arc, or -1 if no arc covers the epoch
+ */
+//------------------------------------------------------------------------------
+Integer TrajectoryStore::FindArc(Real epoch) const
+{
+   for (Integer i = (Integer)arcs.size() - 1; i >= 0; --i)
+   {
+      const RealArray &epochs = arcs[i].epochs;
+      if ((epochs.size() > 1) && (epoch >= epochs.front()) &&
+          (epoch <= epochs.back()))
+         return i;
+   }
+   return -1;
+}
+
+
+//------------------------------------------------------------------------------
+// void Interpolate(const Arc &arc, Integer first, Real epoch,
+//                  Rvector6 &state) const
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the Hermite polynomial through a window of nodes
+ *
+ * Each node is used twice, once with its position and once with its velocity,
+ * in a Newton divided difference table.  The velocity is the derivative of
+ * the interpolated position.
+ *
+ * @param arc   The arc holding the nodes
+ * @param first Index of the first node in the window
+ * @param epoch The A.1 epoch of the requested state
+ * @param state The interpolated state (output)
+ */
+//------------------------------------------------------------------------------
+void TrajectoryStore::Interpolate(const Arc &arc, Integer first, Real epoch,
+      Rvector6 &state) const
+{
+   Integer nodes = windowSize;
+   if (first + nodes > (Integer)arc.epochs.size())
+      nodes = (Integer)arc.epochs.size() - first;
+   Integer order = 2 * nodes;
+
+   // Work in seconds from the first node to keep the table well conditioned
+   Real t0 = arc.epochs[first];
+   Real t  = (epoch - t0) * GmatTimeConstants::SECS_PER_DAY;
+   Real z[2 * MAX_WINDOW_SIZE];
+   for (Integer k = 0; k < nodes; ++k)
+      z[2*k] = z[2*k+1] =
+            (arc.epochs[first + k] - t0) * GmatTimeConstants::SECS_PER_DAY;
+
+   Real q[2 * MAX_WINDOW_SIZE][2 * MAX_WINDOW_SIZE];
+   for (Integer axis = 0; axis < 3; ++axis)
+   {
+      for (Integer k = 0; k < nodes; ++k)
+      {
+         const Rvector6 &node = arc.states[first + k];
+         q[2*k][0]   = node[axis];
+         q[2*k+1][0] = node[axis];
+         q[2*k+1][1] = node[axis + 3];
+         if (k > 0)
+            q[2*k][1] = (q[2*k][0] - q[2*k-1][0]) / (z[2*k] - z[2*k-1]);
+      }
+      for (Integer i = 2; i < order; ++i)
+         for (Integer j = 2; j <= i; ++j)
+            q[i][j] = (q[i][j-1] - q[i-1][j-1]) / (z[i] - z[i-j]);
+
+      // Horner evaluation of the Newton form and its derivative
+      Real value      = q[order-1][order-1];
+      Real derivative = 0.0;
+      for (Integer i = order - 2; i >= 0; --i)
+      {
+         derivative = derivative * (t - z[i]) + value;
+         value      = value * (t - z[i]) + q[i][i];
+      }
+
+      state[axis]     = value;
+      state[axis + 3] = derivative;
+   }
+}
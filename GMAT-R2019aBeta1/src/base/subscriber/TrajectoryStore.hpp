@@ -0,0 +1,83 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                               TrajectoryStore
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool.
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Definition of the TrajectoryStore, an in-memory record of the states
+ * written for a spacecraft by the EphemManager.
+ *
+ * The store holds the same Cartesian nodes that are written to the temporary
+ * SPK file, grouped into continuous arcs.  States between the nodes are
+ * obtained by Hermite interpolation on the positions and velocities of the
+ * nearest nodes, which is the scheme used by the SPK (type 13) segments, so
+ * the event searches can query the trajectory without going through SPICE.
+ * Lookups do not modify the store, so it may be read from several threads
+ * once recording has stopped.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef TrajectoryStore_hpp
+#define TrajectoryStore_hpp
+
+#include "gmatdefs.hpp"
+#include "Rvector6.hpp"
+
+
+class GMAT_API TrajectoryStore
+{
+public:
+   TrajectoryStore(Integer nodesPerWindow = 4);
+   virtual ~TrajectoryStore();
+   TrajectoryStore(const TrajectoryStore& ts);
+   TrajectoryStore& operator=(const TrajectoryStore& ts);
+
+   void                 AddState(Real epoch, const Real state[6]);
+   void                 Clear();
+
+   bool                 IsEmpty() const;
+   Integer              GetArcCount() const;
+   Integer              GetNodeCount() const;
+   bool                 GetCoverage(Real &start, Real &stop) const;
+   void                 GetArcIntervals(RealArray &starts,
+                                        RealArray &stops) const;
+   bool                 IsCovered(Real epoch) const;
+   bool                 GetState(Real epoch, Rvector6 &state) const;
+   Real                 GetSpeedBound(Real start, Real stop) const;
+
+protected:
+   /// A continuous piece of the trajectory
+   struct Arc
+   {
+      /// Node epochs (A.1 Mod Julian days), strictly increasing
+      RealArray               epochs;
+      /// Cartesian states at the nodes
+      std::vector<Rvector6>   states;
+   };
+
+   /// The arcs, in the order they were recorded
+   std::vector<Arc>        arcs;
+   /// Number of nodes used for each interpolation
+   Integer                 windowSize;
+
+   Integer              FindArc(Real epoch) const;
+   void                 Interpolate(const Arc &arc, Integer first, Real epoch,
+                                    Rvector6 &state) const;
+};
+
+#endif // TrajectoryStore_hpp
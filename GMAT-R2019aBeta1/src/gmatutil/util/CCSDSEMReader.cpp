@@ -72,7 +72,8 @@ CCSDSEMReader::CCSDSEMReader() :
    metaDataTypeField     ("ANY"),
    dataType              (""),
    currentSegment        (NULL),
-   numSegments           (0)
+   numSegments           (0),
+   lastSegment           (0)
 {
    comments.clear();
    segments.clear();
@@ -96,7 +97,8 @@ CCSDSEMReader::CCSDSEMReader(const CCSDSEMReader &copy) :
    metaDataTypeField     (copy.metaDataTypeField),
    dataType              (copy.dataType),
    currentSegment        (NULL),
-   numSegments           (copy.numSegments)
+   numSegments           (copy.numSegments),
+   lastSegment           (0)
 
 {
    segments.clear();
@@ -133,6 +135,7 @@ CCSDSEMReader& CCSDSEMReader::operator=(const CCSDSEMReader &copy)
    dataType                = copy.dataType;
    currentSegment          = NULL;   // not sure if this is right
    numSegments             = copy.numSegments;
+   lastSegment             = 0;
 
    for (unsigned int ii = 0; ii < segments.size(); ii++)
    {
@@ -344,13 +347,25 @@ CCSDSEMSegment* CCSDSEMReader::GetSegment(Integer num)
 // Integer GetSegmentNumber(Real epoch)
 // Returns the segment number for the segment containing the
 // requested time (using usable start/stop time if they exist,
-// otherwise using start and stop time)
+// otherwise using start and stop time).  Where segments overlap, the
+// earliest one covering the time is used.  Successive lookups usually fall
+// in the same segment, so the last one found is checked first.
 // -----------------------------------------------------------------------------
 Integer CCSDSEMReader::GetSegmentNumber(Real epoch)
 {
+   if ((lastSegment < numSegments) &&
+       (segments.at(lastSegment))->CoversEpoch(epoch) &&
+       ((lastSegment == 0) ||
+        !(segments.at(lastSegment-1))->CoversEpoch(epoch)))
+      return lastSegment;
+
    for (Integer ii = 0; ii < numSegments; ii++)
    {
-      if ((segments.at(ii))->CoversEpoch(epoch))  return ii;
+      if ((segments.at(ii))->CoversEpoch(epoch))
+      {
+         lastSegment = ii;
+         return ii;
+      }
    }
    return -1;
 }
@@ -363,11 +378,10 @@ Integer CCSDSEMReader::GetSegmentNumber(Real epoch)
 // -----------------------------------------------------------------------------
 CCSDSEMSegment* CCSDSEMReader::GetSegment(Real epoch)
 {
-   for (Integer ii = 0; ii < numSegments; ii++)
-   {
-      if ((segments.at(ii))->CoversEpoch(epoch)) return segments.at(ii);
-   }
-   return NULL;
+   Integer segNum = GetSegmentNumber(epoch);
+   if (segNum < 0)
+      return NULL;
+   return segments.at(segNum);
 }
 
 // -----------------------------------------------------------------------------
@@ -106,6 +106,8 @@ protected:
 
    /// the number of segments
    Integer        numSegments;
+   /// Segment found by the last epoch lookup, checked first by the next one
+   Integer        lastSegment;
    /// in stream
    std::ifstream ephFile;
 
@@ -218,7 +218,8 @@ CCSDSEMSegment::CCSDSEMSegment(Integer segNum) :
    usesUsableTimes     (false),
    checkLagrangeOrder  (false),
    firstUsable         (-999),
-   lastUsable          (-999)
+   lastUsable          (-999),
+   searchIndex         (0)
 {
    dataStore.clear();
    dataComments.clear();
@@ -252,7 +253,8 @@ CCSDSEMSegment::CCSDSEMSegment(const CCSDSEMSegment &copy) :
    usesUsableTimes     (copy.usesUsableTimes),
    checkLagrangeOrder  (copy.checkLagrangeOrder),
    firstUsable         (copy.firstUsable),
-   lastUsable          (copy.lastUsable)
+   lastUsable          (copy.lastUsable),
+   searchIndex         (0)
 {
    for (Integer ii = 0; ii < (Integer) dataStore.size(); ii++)
    {
@@ -303,6 +305,7 @@ CCSDSEMSegment& CCSDSEMSegment::operator=(const CCSDSEMSegment &copy)
    checkLagrangeOrder  = copy.checkLagrangeOrder;
    firstUsable         = copy.firstUsable;
    lastUsable          = copy.lastUsable;
+   searchIndex         = 0;
 
    for (Integer ii = 0; ii < (Integer) dataStore.size(); ii++)
    {
@@ -711,6 +714,7 @@ void CCSDSEMSegment::ClearDataStore()
    for (Integer ii = 0; ii < (Integer) dataStore.size(); ii++)
       delete dataStore.at(ii);
    dataStore.clear();
+   searchIndex = 0;
 }
 
 //------------------------------------------------------------------------------
@@ -858,29 +862,32 @@ Rvector CCSDSEMSegment::DetermineState(Real atEpoch)
       throw UtilityException(errmsg.str());
    }
    bool      exactMatchFound = false;
-   Integer   matchPos        = -1;
-   for (unsigned int ii= 0; ii < dataStore.size(); ii++)
+   Integer   numPoints       = (Integer) dataStore.size();
+   Integer   nextPos         = FindFirstAfter(atEpoch, 0, numPoints - 1);
+   Integer   matchPos        = nextPos - 1;
+
+   // The exact match is the first point within tolerance: one at or before
+   // the input epoch, or else the first one after it
+   Integer   firstPos        = nextPos;
+   while ((firstPos > 0) && GmatMathUtil::IsEqual(
+          dataStore[firstPos-1]->epoch, atEpoch, EPOCH_MATCH_TOLERANCE))
+      --firstPos;
+   if (firstPos < nextPos)
    {
-      Real theTime = (dataStore.at(ii))->epoch;
-
-      #ifdef DEBUG_EM_FIND_EXACT_MATCH
-         MessageInterface::ShowMessage("----  data epoch(%d) = %12.10f \n",
-               ii, theTime);
-      #endif
-      if (GmatMathUtil::IsEqual(theTime, atEpoch, EPOCH_MATCH_TOLERANCE))
-      {
-         exactMatchFound = true;
-         matchPos        = ii;
-         #ifdef DEBUG_EM_FIND_EXACT_MATCH
-            MessageInterface::ShowMessage("---- EXACT MATCH to epoch = %12.10f\n",
-                  (dataStore.at(ii))->epoch);
-          #endif
-         break;
-      }
-      if (theTime < atEpoch)  matchPos = ii;
-      // if the time is bigger, we've gone past and won't find an exact match
-      else if (theTime > atEpoch) break;
+      exactMatchFound = true;
+      matchPos        = firstPos;
    }
+   else if ((nextPos < numPoints) && GmatMathUtil::IsEqual(
+            dataStore[nextPos]->epoch, atEpoch, EPOCH_MATCH_TOLERANCE))
+   {
+      exactMatchFound = true;
+      matchPos        = nextPos;
+   }
+   #ifdef DEBUG_EM_FIND_EXACT_MATCH
+      if (exactMatchFound)
+         MessageInterface::ShowMessage("---- EXACT MATCH to epoch = %12.10f\n",
+               (dataStore.at(matchPos))->epoch);
+   #endif
    // if we didn't find an exact match OR an epoch less than the input
    // epoch, that is an error
    if (matchPos < 0)
@@ -957,6 +964,39 @@ bool CCSDSEMSegment::GetUsableIndexRange(Integer &first, Integer &last)
    return true;
 }
 
+//------------------------------------------------------------------------------
+// Returns the index of the first data point in [first, last] with an epoch
+// later than atEpoch, or last + 1 if there is none.  Data epochs increase, so
+// the search tries the previous result and the point after it before
+// bisecting; queries that move forward in time take constant time.
+//------------------------------------------------------------------------------
+Integer CCSDSEMSegment::FindFirstAfter(Real atEpoch, Integer first,
+                                       Integer last)
+{
+   for (Integer guess = searchIndex; guess <= searchIndex + 1; guess++)
+   {
+      if ((guess >= first) && (guess <= last + 1) &&
+          ((guess == first) || (dataStore[guess-1]->epoch <= atEpoch)) &&
+          ((guess > last)   || (dataStore[guess]->epoch > atEpoch)))
+      {
+         searchIndex = guess;
+         return guess;
+      }
+   }
+
+   Integer lo = first, hi = last + 1, mid;
+   while (lo < hi)
+   {
+      mid = (lo + hi) / 2;
+      if (dataStore[mid]->epoch > atEpoch)
+         hi = mid;
+      else
+         lo = mid + 1;
+   }
+   searchIndex = lo;
+   return lo;
+}
+
 //------------------------------------------------------------------------------
 // Rvector InterpolateLagrange(Real atEpoch)
 // Interpolates the segment data using Lagrange interpolation.
@@ -1008,17 +1048,9 @@ Rvector CCSDSEMSegment::InterpolateLagrange(Real atEpoch)
 
    // find intended position of epoch in ephemeris data
    // find correct (first largest) epoch in ephemeris data
-   Real    anEpoch  = 0.0;
-   Integer epochPos = 0;
-   for (Integer ii = firstUsable; ii <= lastUsable; ii++)
-   {
-      anEpoch = (dataStore.at(ii))->epoch;
-      if ( anEpoch > atEpoch)
-      {
-         epochPos = ii;
-         break;
-      }
-   }
+   Integer epochPos = FindFirstAfter(atEpoch, firstUsable, lastUsable);
+   if (epochPos > lastUsable)
+      epochPos = 0;
    Integer initIndex = -1;
    // pick starting point for interpolation data
    // (region ending just before epoch's position in the ephemeris)
@@ -1057,9 +1089,7 @@ Rvector CCSDSEMSegment::InterpolateLagrange(Real atEpoch)
       pDiff = diff;
    }
 
-   Rvector d1(dataSize);
-
-   Real    t1, t2;
+   Real    t1, t2, coeff;
 
    #ifdef DEBUG_INTERP_DATA
       MessageInterface::ShowMessage("\n Interpolating over %d (q) to %d (q+n)\n", q, (q+n));
@@ -1076,10 +1106,11 @@ Rvector CCSDSEMSegment::InterpolateLagrange(Real atEpoch)
                theAngles[2] * GmatMathConstants::DEG_PER_RAD);
       }
    #endif
+   // Accumulate each point's data scaled by its Lagrange basis coefficient
    for (Integer ii = q; ii <= q+n; ii++)
    {
       t1      = dataStore.at(ii)->epoch;
-      d1      = dataStore.at(ii)->data;
+      const Rvector &d1 = dataStore.at(ii)->data;
       #ifdef DEBUG_INTERP_DATA_DETAIL
       if (atEpoch > 21545.070626)
       {
@@ -1090,13 +1121,15 @@ Rvector CCSDSEMSegment::InterpolateLagrange(Real atEpoch)
          MessageInterface::ShowMessage("\n");
       }
       #endif
+      coeff   = 1.0;
       for (Integer jj = q; jj <= q+n; jj++)
       {
-         t2  = dataStore.at(jj)->epoch;
+         t2  = dataStore[jj]->epoch;
          if (ii != jj)
-            d1    = d1 * ( (atEpoch - t2) / (t1 - t2) );
+            coeff *= (atEpoch - t2) / (t1 - t2);
       }
-      state = state + d1;
+      for (Integer kk = 0; kk < dataSize; kk++)
+         state[kk] += coeff * d1[kk];
    }
    return state;
 }
@@ -1137,17 +1170,9 @@ Rvector CCSDSEMSegment::InterpolateSLERP(Real atEpoch)
 
    // Interpolation Algorithm (SLERP)
    // find correct (first largest) epoch in ephemeris data
-   Real    anEpoch  = 0.0;
-   Integer epochPos = 0;
-   for (Integer ii = firstUsable; ii <= lastUsable; ii++)
-   {
-      anEpoch = (dataStore.at(ii))->epoch;
-      if ( anEpoch > atEpoch)
-      {
-         epochPos = ii;
-         break;
-      }
-   }
+   Integer epochPos = FindFirstAfter(atEpoch, firstUsable, lastUsable);
+   if (epochPos > lastUsable)
+      epochPos = 0;
    #ifdef DEBUG_SLERP
       MessageInterface::ShowMessage("In SLERP, minEpoch = %12.10f\n", minEpoch);
       MessageInterface::ShowMessage("In SLERP, maxEpoch = %12.10f\n", maxEpoch);
@@ -1156,9 +1181,9 @@ Rvector CCSDSEMSegment::InterpolateSLERP(Real atEpoch)
 
    // Get times and data for points before and after requested time
    Real t1    = (dataStore.at(epochPos-1))->epoch;
-   Real t2    = anEpoch;
-   Rvector d1 = (dataStore.at(epochPos-1))->data;
-   Rvector d2 = (dataStore.at(epochPos))->data;
+   Real t2    = (dataStore.at(epochPos))->epoch;
+   const Rvector &d1 = (dataStore.at(epochPos-1))->data;
+   const Rvector &d2 = (dataStore.at(epochPos))->data;
 
    #ifdef DEBUG_SLERP
       MessageInterface::ShowMessage("In SLERP, t1 = %12.10f\n", t1);
@@ -1184,12 +1209,19 @@ Rvector CCSDSEMSegment::InterpolateSLERP(Real atEpoch)
       MessageInterface::ShowMessage("In SLERP, omega    = %12.10f\n", omega);
    #endif
 
-   for (Integer jj = 0; jj < dataSize; jj++)
+   // The weights are the same for every component
+   Real w1, w2;
+   if (sinOmega == 0)
    {
-      if (sinOmega == 0)
-         dSlerp[jj] = (1-t)*d1[jj] + t*d2[jj] ;
-      else
-         dSlerp[jj] = (GmatMathUtil::Sin((1-t)*omega) * d1[jj] + GmatMathUtil::Sin(t*omega) * d2[jj]) / sinOmega;
+      w1 = 1 - t;
+      w2 = t;
    }
+   else
+   {
+      w1 = GmatMathUtil::Sin((1-t)*omega) / sinOmega;
+      w2 = GmatMathUtil::Sin(t*omega) / sinOmega;
+   }
+   for (Integer jj = 0; jj < dataSize; jj++)
+      dSlerp[jj] = w1 * d1[jj] + w2 * d2[jj];
    return dSlerp;
 }
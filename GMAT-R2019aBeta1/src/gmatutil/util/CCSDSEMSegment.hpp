@@ -165,6 +165,8 @@ protected:
 
    Integer     firstUsable;
    Integer     lastUsable;
+   /// Result of the last epoch search, where the next search starts
+   Integer     searchIndex;
 
    // static data
 
@@ -185,6 +187,9 @@ protected:
    // Look for an exact epoch match
    virtual Rvector      DetermineState(Real atEpoch);
    virtual bool         GetUsableIndexRange(Integer &first, Integer &last);
+   /// Find the first data point later than an epoch
+   Integer              FindFirstAfter(Real atEpoch, Integer first,
+                                       Integer last);
    /// Interpolate the data if necessary
    virtual Rvector      Interpolate(Real atEpoch) = 0;
    virtual Rvector      InterpolateLagrange(Real atEpoch);
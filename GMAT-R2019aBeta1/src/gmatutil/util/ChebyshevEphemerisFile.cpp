@@ -0,0 +1,1175 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ChebyshevEphemerisFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Reads and writes spacecraft orbit ephemerides stored as Chebyshev
+ * polynomial records in a binary file.
+ */
+//------------------------------------------------------------------------------
+
+#include "ChebyshevEphemerisFile.hpp"
+#include "UtilityException.hpp"
+#include "MessageInterface.hpp"
+#include "GmatConstants.hpp"         // for SECS_PER_DAY
+#include "A1Mjd.hpp"
+#include <cmath>
+#include <cstring>                   // for memcpy, strncpy
+#include <sstream>
+
+//#define DEBUG_CHEBYSHEV_FILE
+//#define DEBUG_CHEBYSHEV_FIT
+//#define DEBUG_CHEBYSHEV_READ
+
+//----------------------------
+// static data
+//----------------------------
+namespace
+{
+   /// File identifier, the first 8 bytes of the file
+   const char    FILE_MAGIC[8]        = {'G','M','A','T','C','H','B','1'};
+   /// Format version
+   const Integer FILE_VERSION         = 1;
+   /// Written in native order; reads back differently on a foreign machine
+   const Integer BYTE_ORDER_MARK      = 0x01020304;
+   /// Size of the name fields in the header
+   const Integer NAME_SIZE            = 32;
+   /// Size of the fixed header, in bytes
+   const Integer HEADER_SIZE          = 128;
+   /// Size of the record fields that precede the coefficients
+   const Integer RECORD_PREFIX_SIZE   = 24;
+   /// Largest number of samples fitted by a single record
+   const Integer MAX_RECORD_SAMPLES   = 500;
+   /// Lowest degree tried; a cubic matches position and velocity at 2 samples
+   const Integer MIN_DEGREE           = 3;
+   /// Slop allowed at the ends of the data, in days
+   const Real    EPOCH_TOLERANCE      = 1.0e-10;
+
+   //---------------------------------------------------------------------------
+   // void WriteBytes(std::ofstream &out, const void *data, size_t size)
+   //---------------------------------------------------------------------------
+   void WriteBytes(std::ofstream &out, const void *data, size_t size)
+   {
+      out.write((const char*)data, size);
+   }
+
+   //---------------------------------------------------------------------------
+   // void ReadBytes(std::ifstream &in, void *data, size_t size)
+   //---------------------------------------------------------------------------
+   void ReadBytes(std::ifstream &in, void *data, size_t size)
+   {
+      in.read((char*)data, size);
+   }
+
+   //---------------------------------------------------------------------------
+   // void WriteName(std::ofstream &out, const std::string &name)
+   //---------------------------------------------------------------------------
+   void WriteName(std::ofstream &out, const std::string &name)
+   {
+      char field[NAME_SIZE];
+      std::memset(field, 0, NAME_SIZE);
+      std::strncpy(field, name.c_str(), NAME_SIZE - 1);
+      out.write(field, NAME_SIZE);
+   }
+
+   //---------------------------------------------------------------------------
+   // std::string ReadName(std::ifstream &in)
+   //---------------------------------------------------------------------------
+   std::string ReadName(std::ifstream &in)
+   {
+      char field[NAME_SIZE];
+      in.read(field, NAME_SIZE);
+      field[NAME_SIZE - 1] = '\0';
+      return std::string(field);
+   }
+}
+
+//----------------------------
+// public methods
+//----------------------------
+
+//------------------------------------------------------------------------------
+// ChebyshevEphemerisFile()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemerisFile::ChebyshevEphemerisFile() :
+   Ephemeris         (),
+   tolerance         (1.0e-6),
+   maxDegree         (16),
+   centralBody       ("Earth"),
+   coordinateSystem  ("EarthMJ2000Eq"),
+   bucketWidth       (0.0),
+   loadedRecord      (-1),
+   fileNameForRead   (""),
+   fileNameForWrite  (""),
+   writeFinalized    (false)
+{
+   InitializeData();
+}
+
+//------------------------------------------------------------------------------
+// ChebyshevEphemerisFile(const ChebyshevEphemerisFile &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ *
+ * The file streams are not copied.  A copy made from a reader shares the index
+ * and reopens the file when it first needs coefficients.
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemerisFile::ChebyshevEphemerisFile(const ChebyshevEphemerisFile &copy) :
+   Ephemeris         (copy),
+   tolerance         (copy.tolerance),
+   maxDegree         (copy.maxDegree),
+   centralBody       (copy.centralBody),
+   coordinateSystem  (copy.coordinateSystem),
+   records           (copy.records),
+   buckets           (copy.buckets),
+   bucketWidth       (copy.bucketWidth),
+   loadedRecord      (-1),
+   fileNameForRead   (copy.fileNameForRead),
+   fileNameForWrite  (""),
+   writeFinalized    (false)
+{
+   a1StartEpoch = copy.a1StartEpoch;
+   a1EndEpoch   = copy.a1EndEpoch;
+}
+
+//------------------------------------------------------------------------------
+// ChebyshevEphemerisFile& operator=(const ChebyshevEphemerisFile &copy)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemerisFile& ChebyshevEphemerisFile::operator=(
+      const ChebyshevEphemerisFile &copy)
+{
+   if (&copy == this)
+      return *this;
+
+   Ephemeris::operator=(copy);
+
+   CloseForRead();
+   CloseForWrite();
+
+   tolerance        = copy.tolerance;
+   maxDegree        = copy.maxDegree;
+   centralBody      = copy.centralBody;
+   coordinateSystem = copy.coordinateSystem;
+   records          = copy.records;
+   buckets          = copy.buckets;
+   bucketWidth      = copy.bucketWidth;
+   loadedRecord     = -1;
+   loadedCoefs.clear();
+   fileNameForRead  = copy.fileNameForRead;
+   fileNameForWrite = "";
+   writeFinalized   = false;
+   a1StartEpoch     = copy.a1StartEpoch;
+   a1EndEpoch       = copy.a1EndEpoch;
+
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~ChebyshevEphemerisFile()
+//------------------------------------------------------------------------------
+/**
+ * Destructor; finalizes a file that is still open for writing
+ */
+//------------------------------------------------------------------------------
+ChebyshevEphemerisFile::~ChebyshevEphemerisFile()
+{
+   CloseForWrite();
+   CloseForRead();
+}
+
+//------------------------------------------------------------------------------
+// bool OpenForRead(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Opens a Chebyshev ephemeris file and loads its header and index.
+ *
+ * @param filename File name to open
+ *
+ * @return true if the file was opened, false if it could not be opened
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::OpenForRead(const std::string &filename)
+{
+   #ifdef DEBUG_CHEBYSHEV_FILE
+   MessageInterface::ShowMessage
+      ("ChebyshevEphemerisFile::OpenForRead() entered, filename='%s'\n",
+       filename.c_str());
+   #endif
+
+   CloseForRead();
+   InitializeData();
+
+   fileNameForRead = filename;
+   ephemerisFileName = filename;
+   inStream.open(fileNameForRead.c_str(), std::ios::in | std::ios::binary);
+   if (!inStream.is_open())
+      return false;
+
+   char magic[8];
+   Integer version, byteOrder, recordCount, bucketCount;
+   long long indexOffset;
+
+   ReadBytes(inStream, magic, 8);
+   ReadBytes(inStream, &version, sizeof(Integer));
+   ReadBytes(inStream, &byteOrder, sizeof(Integer));
+   ReadBytes(inStream, &recordCount, sizeof(Integer));
+   ReadBytes(inStream, &bucketCount, sizeof(Integer));
+   ReadBytes(inStream, &a1StartEpoch, sizeof(Real));
+   ReadBytes(inStream, &a1EndEpoch, sizeof(Real));
+   ReadBytes(inStream, &bucketWidth, sizeof(Real));
+   ReadBytes(inStream, &tolerance, sizeof(Real));
+   ReadBytes(inStream, &indexOffset, sizeof(long long));
+   centralBody = ReadName(inStream);
+   coordinateSystem = ReadName(inStream);
+
+   if (!inStream || std::memcmp(magic, FILE_MAGIC, 8) != 0)
+   {
+      CloseForRead();
+      throw UtilityException("The file \"" + filename + "\" is not a Chebyshev "
+            "ephemeris file");
+   }
+   if (byteOrder != BYTE_ORDER_MARK)
+   {
+      CloseForRead();
+      throw UtilityException("The Chebyshev ephemeris file \"" + filename +
+            "\" was written on a machine with a different byte order");
+   }
+   if (version != FILE_VERSION)
+   {
+      CloseForRead();
+      UtilityException ue;
+      ue.SetDetails("The Chebyshev ephemeris file \"%s\" has format version "
+            "%d; version %d is expected", filename.c_str(), version,
+            FILE_VERSION);
+      throw ue;
+   }
+   if (indexOffset == 0)
+   {
+      CloseForRead();
+      throw UtilityException("The Chebyshev ephemeris file \"" + filename +
+            "\" was not finalized and has no index");
+   }
+
+   // Load the directory and the bucket table
+   inStream.seekg(indexOffset);
+   records.resize(recordCount);
+   for (Integer i = 0; i < recordCount; ++i)
+   {
+      ReadBytes(inStream, &records[i].recStart, sizeof(Real));
+      ReadBytes(inStream, &records[i].recStop, sizeof(Real));
+      ReadBytes(inStream, &records[i].degree, sizeof(Integer));
+      ReadBytes(inStream, &records[i].sampleCount, sizeof(Integer));
+      ReadBytes(inStream, &records[i].offset, sizeof(long long));
+   }
+   buckets.resize(bucketCount);
+   if (bucketCount > 0)
+      ReadBytes(inStream, &buckets[0], bucketCount * sizeof(Integer));
+
+   if (!inStream)
+   {
+      CloseForRead();
+      throw UtilityException("The index of the Chebyshev ephemeris file \"" +
+            filename + "\" could not be read");
+   }
+
+   #ifdef DEBUG_CHEBYSHEV_FILE
+   MessageInterface::ShowMessage
+      ("   Read %d records, %d buckets spanning %.12lf to %.12lf\n",
+       recordCount, bucketCount, a1StartEpoch, a1EndEpoch);
+   #endif
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool OpenForWrite(const std::string &filename)
+//------------------------------------------------------------------------------
+/**
+ * Creates a Chebyshev ephemeris file and writes a placeholder header.
+ *
+ * @param filename File name to open
+ *
+ * @return true if the file was opened, false if it could not be opened
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::OpenForWrite(const std::string &filename)
+{
+   #ifdef DEBUG_CHEBYSHEV_FILE
+   MessageInterface::ShowMessage
+      ("ChebyshevEphemerisFile::OpenForWrite() entered, filename='%s'\n",
+       filename.c_str());
+   #endif
+
+   if (outStream.is_open())
+      outStream.close();
+
+   InitializeData();
+
+   fileNameForWrite = filename;
+   ephemerisFileName = filename;
+   outStream.open(fileNameForWrite.c_str(),
+         std::ios::out | std::ios::binary | std::ios::trunc);
+
+   if (!outStream.is_open())
+      return false;
+
+   WriteHeader(0);
+   writeFinalized = false;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void CloseForRead()
+//------------------------------------------------------------------------------
+/**
+ * Closes the input stream.  The index stays loaded; the file is reopened if
+ * more coefficients are needed.
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::CloseForRead()
+{
+   if (inStream.is_open())
+      inStream.close();
+}
+
+//------------------------------------------------------------------------------
+// void CloseForWrite()
+//------------------------------------------------------------------------------
+/**
+ * Writes the index, if that has not been done, and closes the output stream.
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::CloseForWrite()
+{
+   if (outStream.is_open())
+   {
+      FinalizeEphemeris();
+      outStream.close();
+   }
+}
+
+//------------------------------------------------------------------------------
+// void GetStartAndEndEpochs(GmatEpoch &startEpoch, GmatEpoch &endEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the span of the ephemeris
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::GetStartAndEndEpochs(GmatEpoch &startEpoch,
+                                                  GmatEpoch &endEpoch)
+{
+   startEpoch = a1StartEpoch;
+   endEpoch   = a1EndEpoch;
+}
+
+//------------------------------------------------------------------------------
+// bool GetState(const GmatEpoch forEpoch, Rvector6 &state)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the ephemeris
+ *
+ * @param forEpoch The A.1 epoch of the requested state
+ * @param state    The Cartesian state at forEpoch
+ *
+ * @return true if the epoch is covered by a record, false if not
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::GetState(const GmatEpoch forEpoch, Rvector6 &state)
+{
+   Integer index = FindSegment(forEpoch);
+   if (index < 0)
+      return false;
+
+   return GetRecordState(index, forEpoch, state);
+}
+
+//------------------------------------------------------------------------------
+// bool GetRecordState(Integer index, const GmatEpoch forEpoch,
+//                     Rvector6 &state)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates a specific record.  This is used where records meet, since the
+ * records on either side of a boundary are separate fits.  Epochs outside of
+ * the record are clamped to its span.
+ *
+ * @param index    The index of the record
+ * @param forEpoch The A.1 epoch of the requested state
+ * @param state    The Cartesian state at forEpoch
+ *
+ * @return false if the index is out of range
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::GetRecordState(Integer index,
+      const GmatEpoch forEpoch, Rvector6 &state)
+{
+   if ((index < 0) || (index >= (Integer)records.size()))
+      return false;
+
+   LoadRecord(index);
+
+   const RecordInfo &rec = records[index];
+   Real span = rec.recStop - rec.recStart;
+   Real tau = (2.0 * forEpoch - (rec.recStart + rec.recStop)) / span;
+   if (tau < -1.0)
+      tau = -1.0;
+   if (tau > 1.0)
+      tau = 1.0;
+
+   Real posvel[6];
+   Evaluate(&loadedCoefs[0], rec.degree, tau,
+         2.0 / (span * GmatTimeConstants::SECS_PER_DAY), posvel);
+   state.Set(posvel);
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// Real GetTolerance()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the position tolerance the records were fitted to, in km
+ */
+//------------------------------------------------------------------------------
+Real ChebyshevEphemerisFile::GetTolerance()
+{
+   return tolerance;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetRecordCount()
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of records in the file
+ */
+//------------------------------------------------------------------------------
+Integer ChebyshevEphemerisFile::GetRecordCount()
+{
+   return (Integer)records.size();
+}
+
+//------------------------------------------------------------------------------
+// bool GetRecordSpan(Integer index, GmatEpoch &recStart, GmatEpoch &recStop,
+//                    Integer &sampleCount)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the span of a record and the number of samples it was fitted to.
+ *
+ * @return false if the index is out of range
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::GetRecordSpan(Integer index, GmatEpoch &recStart,
+                                           GmatEpoch &recStop,
+                                           Integer &sampleCount)
+{
+   if ((index < 0) || (index >= (Integer)records.size()))
+      return false;
+
+   recStart    = records[index].recStart;
+   recStop     = records[index].recStop;
+   sampleCount = records[index].sampleCount;
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// std::string GetCentralBody()
+//------------------------------------------------------------------------------
+std::string ChebyshevEphemerisFile::GetCentralBody()
+{
+   return centralBody;
+}
+
+//------------------------------------------------------------------------------
+// std::string GetCoordinateSystem()
+//------------------------------------------------------------------------------
+std::string ChebyshevEphemerisFile::GetCoordinateSystem()
+{
+   return coordinateSystem;
+}
+
+//------------------------------------------------------------------------------
+// Integer FindSegment(const GmatEpoch forEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Finds the record covering an epoch.
+ *
+ * The bucket holding the epoch gives the first record that can cover it.
+ * There is one bucket per record on average, so only a step or two along the
+ * directory is needed from there.
+ *
+ * @param forEpoch The A.1 epoch
+ *
+ * @return The record index, or -1 if the epoch is not covered
+ */
+//------------------------------------------------------------------------------
+Integer ChebyshevEphemerisFile::FindSegment(const GmatEpoch forEpoch)
+{
+   Integer recordCount = (Integer)records.size();
+   if ((recordCount == 0) || buckets.empty())
+      return -1;
+   if ((forEpoch < a1StartEpoch - EPOCH_TOLERANCE) ||
+       (forEpoch > a1EndEpoch + EPOCH_TOLERANCE))
+      return -1;
+
+   Integer bucket = (Integer)((forEpoch - a1StartEpoch) / bucketWidth);
+   if (bucket < 0)
+      bucket = 0;
+   if (bucket >= (Integer)buckets.size())
+      bucket = (Integer)buckets.size() - 1;
+
+   Integer index = buckets[bucket];
+   while ((index < recordCount - 1) && (records[index].recStop < forEpoch))
+      ++index;
+
+   // Epochs in a gap between arcs are not covered
+   if ((forEpoch < records[index].recStart - EPOCH_TOLERANCE) ||
+       (forEpoch > records[index].recStop + EPOCH_TOLERANCE))
+      return -1;
+
+   return index;
+}
+
+//------------------------------------------------------------------------------
+// Integer PointsInSegment(const Integer forSegment)
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of samples a record was fitted to
+ */
+//------------------------------------------------------------------------------
+Integer ChebyshevEphemerisFile::PointsInSegment(const Integer forSegment)
+{
+   if ((forSegment < 0) || (forSegment >= (Integer)records.size()))
+      return 0;
+   return records[forSegment].sampleCount;
+}
+
+//------------------------------------------------------------------------------
+// Rvector6 InterpolatePoint(const GmatEpoch forEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates the ephemeris, throwing if the epoch is not covered
+ *
+ * @param forEpoch The A.1 epoch of the requested state
+ *
+ * @return The Cartesian state
+ */
+//------------------------------------------------------------------------------
+Rvector6 ChebyshevEphemerisFile::InterpolatePoint(const GmatEpoch forEpoch)
+{
+   Rvector6 state;
+   if (!GetState(forEpoch, state))
+   {
+      std::stringstream msg;
+      msg.precision(16);
+      msg << "The epoch " << forEpoch << " is not covered by the Chebyshev "
+          << "ephemeris file \"" << ephemerisFileName << "\", which spans "
+          << a1StartEpoch << " to " << a1EndEpoch;
+      throw UtilityException(msg.str());
+   }
+   return state;
+}
+
+//------------------------------------------------------------------------------
+// void SetTolerance(Real tol)
+//------------------------------------------------------------------------------
+/**
+ * Sets the largest position error allowed at the fitted samples, in km.  The
+ * velocity error allowed is the tolerance divided by the sample spacing.
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::SetTolerance(Real tol)
+{
+   if (tol <= 0.0)
+      throw UtilityException("The Chebyshev ephemeris fit tolerance must be "
+            "greater than zero");
+   tolerance = tol;
+}
+
+//------------------------------------------------------------------------------
+// void SetMaxDegree(Integer degree)
+//------------------------------------------------------------------------------
+/**
+ * Sets the highest polynomial degree the fitter may use
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::SetMaxDegree(Integer degree)
+{
+   if ((degree < MIN_DEGREE) || (degree > MAX_DEGREE))
+   {
+      UtilityException ue;
+      ue.SetDetails("The Chebyshev ephemeris degree must be between %d and %d",
+            MIN_DEGREE, MAX_DEGREE);
+      throw ue;
+   }
+   maxDegree = degree;
+}
+
+//------------------------------------------------------------------------------
+// void SetCentralBody(const std::string &body)
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::SetCentralBody(const std::string &body)
+{
+   centralBody = body;
+}
+
+//------------------------------------------------------------------------------
+// void SetCoordinateSystem(const std::string &csName)
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::SetCoordinateSystem(const std::string &csName)
+{
+   coordinateSystem = csName;
+}
+
+//------------------------------------------------------------------------------
+// bool WriteDataSegment(const EpochArray &epochArray,
+//                       const StateArray &stateArray)
+//------------------------------------------------------------------------------
+/**
+ * Fits records to a continuous block of samples and writes them.
+ *
+ * Each record starts at the last sample of the previous one.  Its length is
+ * found by doubling the number of samples until the fit fails and then
+ * bisecting, so a block of N samples takes O(log N) fits per record.
+ *
+ * @param epochArray The A.1 epochs of the samples
+ * @param stateArray The Cartesian states of the samples
+ *
+ * @return true if records were written, false if there were too few samples
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::WriteDataSegment(const EpochArray &epochArray,
+                                              const StateArray &stateArray)
+{
+   if (!outStream.is_open())
+      throw UtilityException("The Chebyshev ephemeris file \"" +
+            fileNameForWrite + "\" is not open for writing");
+
+   // Drop samples that do not advance the epoch
+   EpochArray epochs;
+   StateArray states;
+   for (UnsignedInt i = 0; i < epochArray.size(); ++i)
+   {
+      if (!epochs.empty() && (epochArray[i]->GetReal() <= epochs.back()->GetReal()))
+         continue;
+      epochs.push_back(epochArray[i]);
+      states.push_back(stateArray[i]);
+   }
+
+   Integer sampleCount = (Integer)epochs.size();
+   if (sampleCount < 2)
+      return false;
+
+   Integer first = 0;
+   Integer degree, trialDegree;
+   RealArray coefs, trialCoefs;
+
+   while (first < sampleCount - 1)
+   {
+      Integer remaining = sampleCount - first;
+      if (remaining > MAX_RECORD_SAMPLES)
+         remaining = MAX_RECORD_SAMPLES;
+
+      // Two samples are always matched exactly by a cubic
+      Integer good = 2, bad = -1;
+      FitWindow(epochs, states, first, good, true, degree, coefs);
+
+      while (good < remaining)
+      {
+         Integer trial;
+         if (bad < 0)
+            trial = (2 * good < remaining ? 2 * good : remaining);
+         else
+            trial = (good + bad) / 2;
+
+         if (trial <= good)
+            break;
+
+         if (FitWindow(epochs, states, first, trial, false, trialDegree,
+               trialCoefs))
+         {
+            good   = trial;
+            degree = trialDegree;
+            coefs.swap(trialCoefs);
+         }
+         else
+            bad = trial;
+
+         if ((bad >= 0) && (bad - good <= 1))
+            break;
+      }
+
+      #ifdef DEBUG_CHEBYSHEV_FIT
+      MessageInterface::ShowMessage("   Record %d: samples %d to %d, "
+            "degree %d\n", (Integer)records.size(), first, first + good - 1,
+            degree);
+      #endif
+
+      WriteRecord(epochs[first]->GetReal(), epochs[first + good - 1]->GetReal(),
+            degree, good, coefs);
+      first += good - 1;
+   }
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void FinalizeEphemeris()
+//------------------------------------------------------------------------------
+/**
+ * Writes the record directory and bucket table and completes the header
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::FinalizeEphemeris()
+{
+   if (writeFinalized || !outStream.is_open())
+      return;
+
+   BuildBuckets();
+
+   outStream.seekp(0, std::ios::end);
+   long long indexOffset = (long long)outStream.tellp();
+
+   for (UnsignedInt i = 0; i < records.size(); ++i)
+   {
+      WriteBytes(outStream, &records[i].recStart, sizeof(Real));
+      WriteBytes(outStream, &records[i].recStop, sizeof(Real));
+      WriteBytes(outStream, &records[i].degree, sizeof(Integer));
+      WriteBytes(outStream, &records[i].sampleCount, sizeof(Integer));
+      WriteBytes(outStream, &records[i].offset, sizeof(long long));
+   }
+   if (!buckets.empty())
+      WriteBytes(outStream, &buckets[0], buckets.size() * sizeof(Integer));
+
+   WriteHeader(indexOffset);
+   outStream.seekp(0, std::ios::end);
+   outStream.flush();
+
+   if (!outStream)
+      throw UtilityException("Error writing the index of the Chebyshev "
+            "ephemeris file \"" + fileNameForWrite + "\"");
+
+   #ifdef DEBUG_CHEBYSHEV_FILE
+   MessageInterface::ShowMessage("ChebyshevEphemerisFile::FinalizeEphemeris() "
+         "wrote %d records to '%s'\n", (Integer)records.size(),
+         fileNameForWrite.c_str());
+   #endif
+
+   writeFinalized = true;
+}
+
+//----------------------------
+// protected methods
+//----------------------------
+
+//------------------------------------------------------------------------------
+// bool FitWindow(const EpochArray &epochArray, const StateArray &stateArray,
+//                Integer first, Integer count, bool force, Integer &degree,
+//                RealArray &coefs)
+//------------------------------------------------------------------------------
+/**
+ * Fits Chebyshev polynomials to a window of samples.
+ *
+ * The positions and the velocities are fitted together in the least squares
+ * sense; the velocity equations are multiplied by the mean sample spacing so
+ * both kinds of equation are in km and carry the same weight relative to the
+ * tolerance.  The design matrix is built for the highest degree allowed and
+ * reduced once with Householder reflections.  The leading columns of that
+ * factorization solve every lower degree as well, so the degrees are tried
+ * from the lowest up at the cost of a back substitution each.
+ *
+ * @param epochArray The sample epochs
+ * @param stateArray The sample states
+ * @param first      Index of the first sample in the window
+ * @param count      Number of samples in the window
+ * @param force      Accept the highest degree even if it misses the tolerance
+ * @param degree     The degree of the accepted fit
+ * @param coefs      The coefficients of the accepted fit
+ *
+ * @return true if a fit within tolerance (or a forced fit) was found
+ */
+//------------------------------------------------------------------------------
+bool ChebyshevEphemerisFile::FitWindow(const EpochArray &epochArray,
+                                       const StateArray &stateArray,
+                                       Integer first, Integer count,
+                                       bool force, Integer &degree,
+                                       RealArray &coefs)
+{
+   Real t0 = epochArray[first]->GetReal();
+   Real t1 = epochArray[first + count - 1]->GetReal();
+   Real span = t1 - t0;
+   if (span <= 0.0)
+      return false;
+
+   // Leave at least one redundant equation per component beyond 2 samples
+   Integer highest = (count == 2 ? MIN_DEGREE :
+                      (2 * count - 2 < maxDegree ? 2 * count - 2 : maxDegree));
+   Integer lowest  = (MIN_DEGREE < highest ? MIN_DEGREE : highest);
+   Integer cols = highest + 1;
+   Integer rows = 2 * count;
+
+   Real spacing = span * GmatTimeConstants::SECS_PER_DAY / (count - 1);
+   Real scale   = 2.0 / (span * GmatTimeConstants::SECS_PER_DAY);
+
+   // Design matrix (row major) and the three right hand sides
+   RealArray a(rows * cols), b(rows * 3);
+   Real tk[MAX_DEGREE + 1], dk[MAX_DEGREE + 1];
+   for (Integer i = 0; i < count; ++i)
+   {
+      Real tau = (2.0 * epochArray[first + i]->GetReal() - (t0 + t1)) / span;
+      tk[0] = 1.0;
+      dk[0] = 0.0;
+      if (cols > 1)
+      {
+         tk[1] = tau;
+         dk[1] = 1.0;
+      }
+      for (Integer k = 2; k < cols; ++k)
+      {
+         tk[k] = 2.0 * tau * tk[k-1] - tk[k-2];
+         dk[k] = 2.0 * tk[k-1] + 2.0 * tau * dk[k-1] - dk[k-2];
+      }
+
+      const Rvector6 &sample = *stateArray[first + i];
+      Integer posRow = 2 * i, velRow = 2 * i + 1;
+      for (Integer k = 0; k < cols; ++k)
+      {
+         a[posRow * cols + k] = tk[k];
+         a[velRow * cols + k] = dk[k] * scale * spacing;
+      }
+      for (Integer j = 0; j < 3; ++j)
+      {
+         b[posRow * 3 + j] = sample[j];
+         b[velRow * 3 + j] = sample[j+3] * spacing;
+      }
+   }
+
+   // Householder reduction of the matrix, applied to the right hand sides
+   Integer rank = cols;
+   RealArray v(rows);
+   for (Integer k = 0; k < cols; ++k)
+   {
+      Real norm = 0.0;
+      for (Integer i = k; i < rows; ++i)
+         norm += a[i * cols + k] * a[i * cols + k];
+      norm = std::sqrt(norm);
+
+      if (norm <= 1.0e-13 * std::sqrt((Real)rows))
+      {
+         rank = k;
+         break;
+      }
+
+      Real alpha = (a[k * cols + k] > 0.0 ? -norm : norm);
+      Real vNorm2 = 0.0;
+      for (Integer i = k; i < rows; ++i)
+      {
+         v[i] = a[i * cols + k];
+         if (i == k)
+            v[i] -= alpha;
+         vNorm2 += v[i] * v[i];
+      }
+
+      for (Integer c = k; c < cols; ++c)
+      {
+         Real dot = 0.0;
+         for (Integer i = k; i < rows; ++i)
+            dot += v[i] * a[i * cols + c];
+         Real factor = 2.0 * dot / vNorm2;
+         for (Integer i = k; i < rows; ++i)
+            a[i * cols + c] -= factor * v[i];
+      }
+      for (Integer j = 0; j < 3; ++j)
+      {
+         Real dot = 0.0;
+         for (Integer i = k; i < rows; ++i)
+            dot += v[i] * b[i * 3 + j];
+         Real factor = 2.0 * dot / vNorm2;
+         for (Integer i = k; i < rows; ++i)
+            b[i * 3 + j] -= factor * v[i];
+      }
+   }
+
+   if (rank - 1 < highest)
+      highest = rank - 1;
+   if (highest < lowest)
+      return false;
+
+   Real velTolerance = tolerance / spacing;
+   Real state[6];
+
+   for (Integer d = lowest; d <= highest; ++d)
+   {
+      Integer n = d + 1;
+      coefs.assign(3 * n, 0.0);
+
+      // Back substitution on the leading n x n block
+      for (Integer j = 0; j < 3; ++j)
+      {
+         Real *c = &coefs[j * n];
+         for (Integer r = n - 1; r >= 0; --r)
+         {
+            Real sum = b[r * 3 + j];
+            for (Integer k = r + 1; k < n; ++k)
+               sum -= a[r * cols + k] * c[k];
+            c[r] = sum / a[r * cols + r];
+         }
+      }
+
+      // Check the fit at every sample
+      bool fits = true;
+      for (Integer i = 0; (i < count) && fits; ++i)
+      {
+         Real tau = (2.0 * epochArray[first + i]->GetReal() - (t0 + t1)) / span;
+         Evaluate(&coefs[0], d, tau, scale, state);
+
+         const Rvector6 &sample = *stateArray[first + i];
+         Real posErr = 0.0, velErr = 0.0;
+         for (Integer j = 0; j < 3; ++j)
+         {
+            posErr += (state[j] - sample[j]) * (state[j] - sample[j]);
+            velErr += (state[j+3] - sample[j+3]) * (state[j+3] - sample[j+3]);
+         }
+         if ((std::sqrt(posErr) > tolerance) ||
+             (std::sqrt(velErr) > velTolerance))
+            fits = false;
+      }
+
+      if (fits || (force && (d == highest)))
+      {
+         degree = d;
+         return true;
+      }
+   }
+
+   return false;
+}
+
+//------------------------------------------------------------------------------
+// void WriteRecord(GmatEpoch recStart, GmatEpoch recStop, Integer degree,
+//                  Integer sampleCount, const RealArray &coefs)
+//------------------------------------------------------------------------------
+/**
+ * Appends a record to the file and to the directory
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::WriteRecord(GmatEpoch recStart, GmatEpoch recStop,
+                                         Integer degree, Integer sampleCount,
+                                         const RealArray &coefs)
+{
+   RecordInfo rec;
+   rec.recStart    = recStart;
+   rec.recStop     = recStop;
+   rec.degree      = degree;
+   rec.sampleCount = sampleCount;
+   rec.offset      = (long long)outStream.tellp();
+
+   WriteBytes(outStream, &rec.recStart, sizeof(Real));
+   WriteBytes(outStream, &rec.recStop, sizeof(Real));
+   WriteBytes(outStream, &rec.degree, sizeof(Integer));
+   WriteBytes(outStream, &rec.sampleCount, sizeof(Integer));
+   WriteBytes(outStream, &coefs[0], 3 * (degree + 1) * sizeof(Real));
+
+   if (!outStream)
+      throw UtilityException("Error writing to the Chebyshev ephemeris file \"" +
+            fileNameForWrite + "\"");
+
+   if (records.empty())
+      a1StartEpoch = recStart;
+   a1EndEpoch = recStop;
+   records.push_back(rec);
+}
+
+//------------------------------------------------------------------------------
+// void LoadRecord(Integer index)
+//------------------------------------------------------------------------------
+/**
+ * Reads the coefficients of a record unless they are already loaded
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::LoadRecord(Integer index)
+{
+   if (index == loadedRecord)
+      return;
+
+   if (!inStream.is_open())
+   {
+      inStream.open(fileNameForRead.c_str(), std::ios::in | std::ios::binary);
+      if (!inStream.is_open())
+         throw UtilityException("The Chebyshev ephemeris file \"" +
+               fileNameForRead + "\" could not be reopened");
+   }
+
+   const RecordInfo &rec = records[index];
+   loadedCoefs.resize(3 * (rec.degree + 1));
+
+   inStream.clear();
+   inStream.seekg(rec.offset + RECORD_PREFIX_SIZE);
+   ReadBytes(inStream, &loadedCoefs[0], loadedCoefs.size() * sizeof(Real));
+
+   if (!inStream)
+   {
+      loadedRecord = -1;
+      UtilityException ue;
+      ue.SetDetails("Error reading record %d of the Chebyshev ephemeris file "
+            "\"%s\"", index, fileNameForRead.c_str());
+      throw ue;
+   }
+
+   #ifdef DEBUG_CHEBYSHEV_READ
+   MessageInterface::ShowMessage("ChebyshevEphemerisFile: loaded record %d, "
+         "degree %d\n", index, rec.degree);
+   #endif
+
+   loadedRecord = index;
+}
+
+//------------------------------------------------------------------------------
+// void Evaluate(const Real *coefs, Integer degree, Real tau, Real scale,
+//               Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Evaluates a record's series and its derivative
+ *
+ * @param coefs  The x, y and z coefficients, (degree + 1) each
+ * @param degree The degree of the series
+ * @param tau    The normalized time, in [-1, 1]
+ * @param scale  d(tau)/dt, in 1/sec
+ * @param state  The position and velocity
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::Evaluate(const Real *coefs, Integer degree,
+                                      Real tau, Real scale, Real *state)
+{
+   Real tk[MAX_DEGREE + 1], dk[MAX_DEGREE + 1];
+   tk[0] = 1.0;
+   dk[0] = 0.0;
+   if (degree > 0)
+   {
+      tk[1] = tau;
+      dk[1] = 1.0;
+   }
+   for (Integer k = 2; k <= degree; ++k)
+   {
+      tk[k] = 2.0 * tau * tk[k-1] - tk[k-2];
+      dk[k] = 2.0 * tk[k-1] + 2.0 * tau * dk[k-1] - dk[k-2];
+   }
+
+   Integer n = degree + 1;
+   for (Integer j = 0; j < 3; ++j)
+   {
+      const Real *c = coefs + j * n;
+      Real pos = 0.0, vel = 0.0;
+      for (Integer k = 0; k < n; ++k)
+      {
+         pos += c[k] * tk[k];
+         vel += c[k] * dk[k];
+      }
+      state[j]   = pos;
+      state[j+3] = vel * scale;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void WriteHeader(long long indexOffset)
+//------------------------------------------------------------------------------
+/**
+ * Writes the fixed size header at the start of the file
+ *
+ * @param indexOffset Location of the index, or 0 while the file is open
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::WriteHeader(long long indexOffset)
+{
+   Integer recordCount = (Integer)records.size();
+   Integer bucketCount = (Integer)buckets.size();
+   Real    startEpoch  = (recordCount > 0 ? a1StartEpoch : 0.0);
+   Real    endEpoch    = (recordCount > 0 ? a1EndEpoch : 0.0);
+
+   outStream.seekp(0, std::ios::beg);
+   WriteBytes(outStream, FILE_MAGIC, 8);
+   WriteBytes(outStream, &FILE_VERSION, sizeof(Integer));
+   WriteBytes(outStream, &BYTE_ORDER_MARK, sizeof(Integer));
+   WriteBytes(outStream, &recordCount, sizeof(Integer));
+   WriteBytes(outStream, &bucketCount, sizeof(Integer));
+   WriteBytes(outStream, &startEpoch, sizeof(Real));
+   WriteBytes(outStream, &endEpoch, sizeof(Real));
+   WriteBytes(outStream, &bucketWidth, sizeof(Real));
+   WriteBytes(outStream, &tolerance, sizeof(Real));
+   WriteBytes(outStream, &indexOffset, sizeof(long long));
+   WriteName(outStream, centralBody);
+   WriteName(outStream, coordinateSystem);
+}
+
+//------------------------------------------------------------------------------
+// void BuildBuckets()
+//------------------------------------------------------------------------------
+/**
+ * Builds the bucket table, one bucket per record over the span of the file
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::BuildBuckets()
+{
+   buckets.clear();
+   Integer recordCount = (Integer)records.size();
+   if (recordCount == 0)
+   {
+      bucketWidth = 0.0;
+      return;
+   }
+
+   Real span = a1EndEpoch - a1StartEpoch;
+   bucketWidth = (span > 0.0 ? span / recordCount : 1.0);
+
+   buckets.resize(recordCount);
+   Integer index = 0;
+   for (Integer i = 0; i < recordCount; ++i)
+   {
+      Real bucketStart = a1StartEpoch + i * bucketWidth;
+      while ((index < recordCount - 1) && (records[index].recStop < bucketStart))
+         ++index;
+      buckets[i] = index;
+   }
+}
+
+//------------------------------------------------------------------------------
+// void InitializeData()
+//------------------------------------------------------------------------------
+/**
+ * Clears the record directory
+ */
+//------------------------------------------------------------------------------
+void ChebyshevEphemerisFile::InitializeData()
+{
+   records.clear();
+   buckets.clear();
+   bucketWidth  = 0.0;
+   loadedRecord = -1;
+   loadedCoefs.clear();
+   a1StartEpoch = 0.0;
+   a1EndEpoch   = 0.0;
+}
@@ -0,0 +1,162 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             ChebyshevEphemerisFile
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Reads and writes spacecraft orbit ephemerides stored as Chebyshev
+ * polynomial records in a binary file.
+ *
+ * Each record holds the Chebyshev coefficients of the three position
+ * components over a time span; velocities are obtained by differentiating the
+ * series.  The writer fits the records to the position and velocity samples it
+ * is given, growing each record and choosing the lowest degree that reproduces
+ * the samples to a user tolerance, so smooth arcs are stored in a few long
+ * records.
+ *
+ * The file layout is:
+ *
+ *    header     fixed size; record count, span, frame and index location
+ *    records    start, stop, degree, sample count and coefficients
+ *    index      record directory followed by a table of equal time buckets
+ *
+ * The index is written when the file is finalized.  A reader loads the index
+ * only, maps an epoch to its bucket and from there to the record in constant
+ * time, and reads the coefficients of a record when it is first needed.
+ */
+//------------------------------------------------------------------------------
+#ifndef ChebyshevEphemerisFile_hpp
+#define ChebyshevEphemerisFile_hpp
+
+#include "utildefs.hpp"
+#include "Ephemeris.hpp"
+#include "Rvector6.hpp"
+#include <fstream>
+
+class GMATUTIL_API ChebyshevEphemerisFile : public Ephemeris
+{
+public:
+   ChebyshevEphemerisFile();
+   ChebyshevEphemerisFile(const ChebyshevEphemerisFile &copy);
+   ChebyshevEphemerisFile& operator=(const ChebyshevEphemerisFile &copy);
+   virtual ~ChebyshevEphemerisFile();
+
+   /// Open the ephemeris file for reading/writing
+   bool           OpenForRead(const std::string &filename);
+   bool           OpenForWrite(const std::string &filename);
+   void           CloseForRead();
+   void           CloseForWrite();
+
+   // For ephemeris file reading
+   void           GetStartAndEndEpochs(GmatEpoch &startEpoch,
+                                       GmatEpoch &endEpoch);
+   bool           GetState(const GmatEpoch forEpoch, Rvector6 &state);
+   bool           GetRecordState(Integer index, const GmatEpoch forEpoch,
+                                 Rvector6 &state);
+   Integer        GetRecordCount();
+   bool           GetRecordSpan(Integer index, GmatEpoch &recStart,
+                                GmatEpoch &recStop, Integer &sampleCount);
+   Real           GetTolerance();
+   std::string    GetCentralBody();
+   std::string    GetCoordinateSystem();
+
+   // Ephemeris interfaces
+   virtual Integer  FindSegment(const GmatEpoch forEpoch);
+   virtual Integer  PointsInSegment(const Integer forSegment);
+   virtual Rvector6 InterpolatePoint(const GmatEpoch forEpoch);
+
+   // For ephemeris file writing
+   void           SetTolerance(Real tol);
+   void           SetMaxDegree(Integer degree);
+   void           SetCentralBody(const std::string &body);
+   void           SetCoordinateSystem(const std::string &csName);
+   bool           WriteDataSegment(const EpochArray &epochArray,
+                                   const StateArray &stateArray);
+   void           FinalizeEphemeris();
+
+   /// Largest degree a record may use
+   static const Integer MAX_DEGREE = 32;
+
+protected:
+   /// Directory entry for one record
+   struct RecordInfo
+   {
+      /// A.1 Mod Julian start of the record
+      GmatEpoch      recStart;
+      /// A.1 Mod Julian end of the record
+      GmatEpoch      recStop;
+      /// Degree of the polynomials
+      Integer        degree;
+      /// Number of samples the record was fitted to
+      Integer        sampleCount;
+      /// Location of the record in the file
+      long long      offset;
+   };
+
+   /// Fitting tolerance on the position, in km
+   Real                    tolerance;
+   /// Highest degree tried by the fitter
+   Integer                 maxDegree;
+   /// Name of the central body
+   std::string             centralBody;
+   /// Name of the coordinate system
+   std::string             coordinateSystem;
+
+   /// Record directory
+   std::vector<RecordInfo> records;
+   /// First record overlapping each time bucket
+   IntegerArray            buckets;
+   /// Width of a time bucket, in days
+   Real                    bucketWidth;
+
+   /// Index of the record whose coefficients are loaded
+   Integer                 loadedRecord;
+   /// Coefficients of the loaded record: x, then y, then z
+   RealArray               loadedCoefs;
+
+   /// The file names for read/write
+   std::string             fileNameForRead;
+   std::string             fileNameForWrite;
+   /// Set once the index has been written
+   bool                    writeFinalized;
+
+   /// File input/output streams
+   std::ifstream           inStream;
+   std::ofstream           outStream;
+
+   // Fitting
+   bool           FitWindow(const EpochArray &epochArray,
+                            const StateArray &stateArray, Integer first,
+                            Integer count, bool force, Integer &degree,
+                            RealArray &coefs);
+   void           WriteRecord(GmatEpoch recStart, GmatEpoch recStop,
+                              Integer degree, Integer sampleCount,
+                              const RealArray &coefs);
+
+   // Evaluation
+   void           LoadRecord(Integer index);
+   static void    Evaluate(const Real *coefs, Integer degree, Real tau,
+                           Real scale, Real *state);
+
+   // Header and index
+   void           WriteHeader(long long indexOffset);
+   void           BuildBuckets();
+   void           InitializeData();
+};
+
+#endif // ChebyshevEphemerisFile_hpp
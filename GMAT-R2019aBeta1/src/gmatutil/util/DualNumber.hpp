@@ -0,0 +1,368 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              DualNumber
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares and defines the DualNumber template, a forward mode automatic
+ * differentiation number carrying a value and its gradient with respect to N
+ * independent variables.
+ *
+ * Code written as a template on its number type, using the arithmetic
+ * operators and the unqualified math functions sqrt, sin, cos, exp, log and
+ * pow, computes a value when instantiated on Real and the value plus its exact
+ * partial derivatives when instantiated on DualNumber<N>.  The cost of the
+ * DualNumber evaluation is a fixed multiple, roughly N + 1, of the Real one.
+ *
+ * A typical use fills an A-matrix row block from an acceleration kernel:
+ *
+ *    DualNumber<6> x[6], a[3];
+ *    for (Integer i = 0; i < 6; ++i)
+ *       x[i].SetVariable(state[i], i);
+ *    Acceleration(x, a);
+ *    // da_j/dx_k is a[j].Derivative(k)
+ */
+//------------------------------------------------------------------------------
+#ifndef DualNumber_hpp
+#define DualNumber_hpp
+
+#include "utildefs.hpp"
+#include <cmath>
+
+template <Integer N>
+class DualNumber
+{
+public:
+   //---------------------------------------------------------------------------
+   // DualNumber(const Real value = 0.0)
+   //---------------------------------------------------------------------------
+   /**
+    * Constructs a constant, with all partial derivatives zero
+    *
+    * @param value The value of the constant
+    */
+   //---------------------------------------------------------------------------
+   DualNumber(const Real value = 0.0) :
+      val      (value)
+   {
+      for (Integer i = 0; i < N; ++i)
+         grad[i] = 0.0;
+   }
+
+   //---------------------------------------------------------------------------
+   // DualNumber(const Real value, const Integer index)
+   //---------------------------------------------------------------------------
+   /**
+    * Constructs the independent variable with the given index
+    *
+    * @param value The value of the variable
+    * @param index The index, 0 to N - 1, of the variable
+    */
+   //---------------------------------------------------------------------------
+   DualNumber(const Real value, const Integer index)
+   {
+      SetVariable(value, index);
+   }
+
+   //---------------------------------------------------------------------------
+   // void SetVariable(const Real value, const Integer index)
+   //---------------------------------------------------------------------------
+   /**
+    * Makes this number the independent variable with the given index
+    *
+    * @param value The value of the variable
+    * @param index The index, 0 to N - 1, of the variable
+    */
+   //---------------------------------------------------------------------------
+   void SetVariable(const Real value, const Integer index)
+   {
+      val = value;
+      for (Integer i = 0; i < N; ++i)
+         grad[i] = (i == index ? 1.0 : 0.0);
+   }
+
+   /// Value of the number
+   Real Value() const
+   {
+      return val;
+   }
+
+   /// Partial derivative with respect to the variable with the given index
+   Real Derivative(const Integer index) const
+   {
+      return grad[index];
+   }
+
+   /// Read/write access to a partial derivative, used by the math functions
+   Real& Derivative(const Integer index)
+   {
+      return grad[index];
+   }
+
+   DualNumber operator-() const
+   {
+      DualNumber result;
+      result.val = -val;
+      for (Integer i = 0; i < N; ++i)
+         result.grad[i] = -grad[i];
+      return result;
+   }
+
+   DualNumber& operator+=(const DualNumber &x)
+   {
+      val += x.val;
+      for (Integer i = 0; i < N; ++i)
+         grad[i] += x.grad[i];
+      return *this;
+   }
+
+   DualNumber& operator-=(const DualNumber &x)
+   {
+      val -= x.val;
+      for (Integer i = 0; i < N; ++i)
+         grad[i] -= x.grad[i];
+      return *this;
+   }
+
+   DualNumber& operator*=(const DualNumber &x)
+   {
+      for (Integer i = 0; i < N; ++i)
+         grad[i] = grad[i] * x.val + val * x.grad[i];
+      val *= x.val;
+      return *this;
+   }
+
+   DualNumber& operator/=(const DualNumber &x)
+   {
+      Real inv = 1.0 / x.val;
+      val *= inv;
+      for (Integer i = 0; i < N; ++i)
+         grad[i] = (grad[i] - val * x.grad[i]) * inv;
+      return *this;
+   }
+
+   DualNumber& operator+=(const Real x)
+   {
+      val += x;
+      return *this;
+   }
+
+   DualNumber& operator-=(const Real x)
+   {
+      val -= x;
+      return *this;
+   }
+
+   DualNumber& operator*=(const Real x)
+   {
+      val *= x;
+      for (Integer i = 0; i < N; ++i)
+         grad[i] *= x;
+      return *this;
+   }
+
+   DualNumber& operator/=(const Real x)
+   {
+      return (*this) *= 1.0 / x;
+   }
+
+   //---------------------------------------------------------------------------
+   // DualNumber Chain(const Real value, const Real slope) const
+   //---------------------------------------------------------------------------
+   /**
+    * Applies a scalar function to this number by the chain rule
+    *
+    * @param value The function value at Value()
+    * @param slope The function derivative at Value()
+    *
+    * @return The function of this number
+    */
+   //---------------------------------------------------------------------------
+   DualNumber Chain(const Real value, const Real slope) const
+   {
+      DualNumber result;
+      result.val = value;
+      for (Integer i = 0; i < N; ++i)
+         result.grad[i] = slope * grad[i];
+      return result;
+   }
+
+protected:
+   /// The value
+   Real val;
+   /// The partial derivatives with respect to the N variables
+   Real grad[N];
+};
+
+
+//------------------------------------------------------------------------------
+// Arithmetic operators
+//------------------------------------------------------------------------------
+template <Integer N>
+inline DualNumber<N> operator+(DualNumber<N> x, const DualNumber<N> &y)
+{
+   return x += y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator+(DualNumber<N> x, const Real y)
+{
+   return x += y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator+(const Real x, DualNumber<N> y)
+{
+   return y += x;
+}
+
+template <Integer N>
+inline DualNumber<N> operator-(DualNumber<N> x, const DualNumber<N> &y)
+{
+   return x -= y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator-(DualNumber<N> x, const Real y)
+{
+   return x -= y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator-(const Real x, const DualNumber<N> &y)
+{
+   DualNumber<N> result = -y;
+   return result += x;
+}
+
+template <Integer N>
+inline DualNumber<N> operator*(DualNumber<N> x, const DualNumber<N> &y)
+{
+   return x *= y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator*(DualNumber<N> x, const Real y)
+{
+   return x *= y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator*(const Real x, DualNumber<N> y)
+{
+   return y *= x;
+}
+
+template <Integer N>
+inline DualNumber<N> operator/(DualNumber<N> x, const DualNumber<N> &y)
+{
+   return x /= y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator/(DualNumber<N> x, const Real y)
+{
+   return x /= y;
+}
+
+template <Integer N>
+inline DualNumber<N> operator/(const Real x, const DualNumber<N> &y)
+{
+   Real value = x / y.Value();
+   return y.Chain(value, -value / y.Value());
+}
+
+
+//------------------------------------------------------------------------------
+// Comparisons, on the value only, for use in branches
+//------------------------------------------------------------------------------
+template <Integer N>
+inline bool operator<(const DualNumber<N> &x, const DualNumber<N> &y)
+{
+   return x.Value() < y.Value();
+}
+
+template <Integer N>
+inline bool operator>(const DualNumber<N> &x, const DualNumber<N> &y)
+{
+   return x.Value() > y.Value();
+}
+
+template <Integer N>
+inline bool operator<(const DualNumber<N> &x, const Real y)
+{
+   return x.Value() < y;
+}
+
+template <Integer N>
+inline bool operator>(const DualNumber<N> &x, const Real y)
+{
+   return x.Value() > y;
+}
+
+
+//------------------------------------------------------------------------------
+// Math functions, found by argument dependent lookup from templated code that
+// calls them unqualified
+//------------------------------------------------------------------------------
+template <Integer N>
+inline DualNumber<N> sqrt(const DualNumber<N> &x)
+{
+   Real value = std::sqrt(x.Value());
+   return x.Chain(value, 0.5 / value);
+}
+
+template <Integer N>
+inline DualNumber<N> sin(const DualNumber<N> &x)
+{
+   return x.Chain(std::sin(x.Value()), std::cos(x.Value()));
+}
+
+template <Integer N>
+inline DualNumber<N> cos(const DualNumber<N> &x)
+{
+   return x.Chain(std::cos(x.Value()), -std::sin(x.Value()));
+}
+
+template <Integer N>
+inline DualNumber<N> exp(const DualNumber<N> &x)
+{
+   Real value = std::exp(x.Value());
+   return x.Chain(value, value);
+}
+
+template <Integer N>
+inline DualNumber<N> log(const DualNumber<N> &x)
+{
+   return x.Chain(std::log(x.Value()), 1.0 / x.Value());
+}
+
+template <Integer N>
+inline DualNumber<N> pow(const DualNumber<N> &x, const Real p)
+{
+   Real value = std::pow(x.Value(), p - 1.0);
+   return x.Chain(value * x.Value(), p * value);
+}
+
+template <Integer N>
+inline DualNumber<N> fabs(const DualNumber<N> &x)
+{
+   return (x.Value() < 0.0 ? -x : x);
+}
+
+#endif // DualNumber_hpp
@@ -56,7 +56,10 @@ Ephemeris::Ephemeris() :
    order                         (7),
    currentOrder                  (-1),
    warnInterpolationDegradation  (true),
-   useHermite                    (true)
+   useHermite                    (true),
+   segmentsOrdered               (false),
+   hermiteSegment                (-1),
+   hermiteStart                  (-1)
 {
    #ifdef TEST_HERMITE_INTERP
       // Temporary code to test the Hermite interpolator
@@ -126,7 +129,10 @@ Ephemeris::Ephemeris(const Ephemeris& ephem) :
    order                         (ephem.order),
    currentOrder                  (-1),
    warnInterpolationDegradation  (true),
-   useHermite                    (ephem.useHermite)
+   useHermite                    (ephem.useHermite),
+   segmentsOrdered               (false),
+   hermiteSegment                (-1),
+   hermiteStart                  (-1)
 {
 }
 
@@ -157,6 +163,7 @@ Ephemeris& Ephemeris::operator=(const Ephemeris& ephem)
       warnInterpolationDegradation = true;
       useHermite                   = ephem.useHermite;
       segmentStartTimes.clear();
+      ResetIndexes();
    }
 
    return *this;
@@ -195,22 +202,43 @@ Integer Ephemeris::FindSegment(const GmatEpoch forEpoch)
 {
    Integer retval = -1;
 
-   for (UnsignedInt i = 0; i < theEphem.size(); ++i)
-   {
-      #ifdef DEBUG_INTERPOLATION
-         MessageInterface::ShowMessage("Checking if %.12lf is between %.12lf and %.12lf\n",
-               forEpoch, theEphem[i].segStart, theEphem[i].segEnd);
-      #endif
+   UpdateIndexes();
 
-      if ((theEphem[i].segStart <= forEpoch) && (forEpoch < theEphem[i].segEnd))
+   if (segmentsOrdered)
+   {
+      // With ordered bounds, the segments ending after the epoch follow the
+      // ones that do not, so the first segment containing the epoch is the
+      // first one ending after it
+      Integer lastStarted = segmentStarts.FindNode(forEpoch);
+      Integer firstOpen   = segmentEnds.FindNode(forEpoch) + 1;
+
+      if ((lastStarted >= 0) && (firstOpen <= lastStarted))
+         retval = firstOpen;
+      // Special case: Only one point in the segment
+      else if ((firstOpen > 0) &&
+               (theEphem[firstOpen-1].segStart == forEpoch) &&
+               (theEphem[firstOpen-1].segEnd == forEpoch))
+         retval = firstOpen - 1;
+   }
+   else
+   {
+      for (UnsignedInt i = 0; i < theEphem.size(); ++i)
       {
-         retval = i;
-         break;
-      }
+         #ifdef DEBUG_INTERPOLATION
+            MessageInterface::ShowMessage("Checking if %.12lf is between %.12lf and %.12lf\n",
+                  forEpoch, theEphem[i].segStart, theEphem[i].segEnd);
+         #endif
 
-      // Special case: Only one point in the segment
-      if ((theEphem[i].segStart == forEpoch) && (forEpoch == theEphem[i].segEnd))
-         retval = i;
+         if ((theEphem[i].segStart <= forEpoch) && (forEpoch < theEphem[i].segEnd))
+         {
+            retval = i;
+            break;
+         }
+
+         // Special case: Only one point in the segment
+         if ((theEphem[i].segStart == forEpoch) && (forEpoch == theEphem[i].segEnd))
+            retval = i;
+      }
    }
 
    // Handle the last point on the ephemeris
@@ -255,20 +283,12 @@ Integer Ephemeris::PointsInSegment(const Integer forSegment)
 //------------------------------------------------------------------------------
 Integer Ephemeris::IndexInSegment(const Integer segNum, const GmatEpoch forEpoch)
 {
-   Integer retval = -1;
+   UpdateIndexes();
 
-   Real diff = 9e99, temp;
-   for (UnsignedInt i = 0; i < theEphem[segNum].points.size(); ++i)
-   {
-      temp = GmatMathUtil::Abs(theEphem[segNum].points[i].theEpoch - forEpoch);
-      if (temp < diff)
-      {
-         diff = temp;
-         retval = i;
-      }
-   }
+   if ((segNum < 0) || (segNum >= (Integer)pointIndexes.size()))
+      return -1;
 
-   return retval;
+   return pointIndexes[segNum].FindNearestNode(forEpoch);
 }
 
 
@@ -347,6 +367,8 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
       else
          interp = new LagrangeInterpolator("", 6, maxOrder);
       currentOrder = maxOrder;
+      hermiteSegment = -1;
+      hermiteStart = -1;
    }
 
    if ((currentOrder < order) && warnInterpolationDegradation)
@@ -361,36 +383,41 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
    Integer startIndex = index - Integer(currentOrder / 2);
    if (startIndex < 0)
       startIndex = 0;
-   if (startIndex + currentOrder + 1 > theEphem[segNo].points.size())
-      startIndex = theEphem[segNo].points.size() - currentOrder - 1;
+   Integer pointCount = (Integer)theEphem[segNo].points.size();
+   if (startIndex + currentOrder + 1 > pointCount)
+      startIndex = pointCount - currentOrder - 1;
 
-   interp->Clear();
-   for (UnsignedInt i = 0; i <= currentOrder; ++i)
-      interp->AddPoint(theEphem[segNo].points[startIndex+i].theEpoch,
-            theEphem[segNo].points[startIndex+i].posvel.GetDataVector());
+   Real interpolents[6];
 
    // Use derivative data for problems with lower than 7th order polynomials
    if ((useHermite) && (currentOrder < 7))
    {
-      Real vel[6];
-      for (UnsignedInt i = 0; i <= currentOrder; ++i)
+      // Reload only when the window moves, so the interpolator can reuse its
+      // divided differences
+      if ((segNo != hermiteSegment) || (startIndex != hermiteStart))
       {
-         const Real *v = theEphem[segNo].points[startIndex+i].posvel.GetDataVector();
-         for (Integer j = 0; j < 3; ++j)
+         interp->Clear();
+         for (Integer i = 0; i <= currentOrder; ++i)
+            interp->AddPoint(theEphem[segNo].points[startIndex+i].theEpoch,
+                  theEphem[segNo].points[startIndex+i].posvel.GetDataVector());
+
+         Real vel[6];
+         for (Integer i = 0; i <= currentOrder; ++i)
          {
-            // Since independent variable is in days, scale velocity the same
-            vel[j] = v[j+3] * GmatTimeConstants::SECS_PER_DAY;
-            vel[j+3] = -9.999999999e99;
+            const Real *v = theEphem[segNo].points[startIndex+i].posvel.GetDataVector();
+            for (Integer j = 0; j < 3; ++j)
+            {
+               // Since independent variable is in days, scale velocity the same
+               vel[j] = v[j+3] * GmatTimeConstants::SECS_PER_DAY;
+               vel[j+3] = -9.999999999e99;
+            }
+            ((HermiteInterpolator*)interp)->AddDerivative(
+                  theEphem[segNo].points[startIndex+i].theEpoch, vel);
          }
-         ((HermiteInterpolator*)interp)->AddDerivative(
-               theEphem[segNo].points[startIndex+i].theEpoch, vel);
+         hermiteSegment = segNo;
+         hermiteStart = startIndex;
       }
-   }
-
-   Real interpolents[6];
 
-   if (useHermite)
-   {
       if (((HermiteInterpolator*)interp)->InterpolateCartesianState(forEpoch, interpolents))
       {
          for (Integer i = 3; i < 6; ++i)
@@ -400,8 +427,87 @@ Rvector6 Ephemeris::InterpolatePoint(const GmatEpoch forEpoch)
    }
    else
    {
-      if (interp->Interpolate(forEpoch, interpolents))
+      // Without derivative data both interpolators produce the Lagrange
+      // polynomial through the points, so use the barycentric form, which
+      // keeps its weights while queries stay in the same window
+      if (!window.IsLoaded(segNo, startIndex, currentOrder + 1))
+      {
+         window.Start(segNo, startIndex,
+               theEphem[segNo].points[startIndex].theEpoch);
+         for (Integer i = 0; i <= currentOrder; ++i)
+            window.AddNode(theEphem[segNo].points[startIndex+i].theEpoch,
+                  theEphem[segNo].points[startIndex+i].posvel.GetDataVector());
+      }
+
+      bool interpolated;
+      if (useHermite)
+         // Velocity is the derivative of the position polynomial
+         interpolated = window.InterpolateCartesianState(forEpoch,
+               interpolents);
+      else
+         interpolated = window.Interpolate(forEpoch, interpolents);
+
+      if (interpolated)
          retval.Set(interpolents);
    }
    return retval;
 }
+
+
+//------------------------------------------------------------------------------
+// void ResetIndexes()
+//------------------------------------------------------------------------------
+/**
+ * Discards the lookup tables.  Readers call this after replacing theEphem.
+ */
+//------------------------------------------------------------------------------
+void Ephemeris::ResetIndexes()
+{
+   segmentStarts.Clear();
+   segmentEnds.Clear();
+   pointIndexes.clear();
+   segmentsOrdered = false;
+   window.Clear();
+   hermiteSegment = -1;
+   hermiteStart = -1;
+}
+
+//------------------------------------------------------------------------------
+// void UpdateIndexes()
+//------------------------------------------------------------------------------
+/**
+ * Builds the lookup tables for the segments and their points if they are
+ * missing or no longer match the ephemeris data
+ */
+//------------------------------------------------------------------------------
+void Ephemeris::UpdateIndexes()
+{
+   bool current = (pointIndexes.size() == theEphem.size());
+   for (UnsignedInt i = 0; current && (i < theEphem.size()); ++i)
+      if (pointIndexes[i].GetNodeCount() != (Integer)theEphem[i].points.size())
+         current = false;
+   if (current)
+      return;
+
+   ResetIndexes();
+
+   segmentsOrdered = true;
+   pointIndexes.resize(theEphem.size());
+   for (UnsignedInt i = 0; i < theEphem.size(); ++i)
+   {
+      segmentStarts.AddNode(theEphem[i].segStart);
+      segmentEnds.AddNode(theEphem[i].segEnd);
+      if ((i > 0) && ((theEphem[i].segStart < theEphem[i-1].segStart) ||
+                      (theEphem[i].segEnd < theEphem[i-1].segEnd)))
+         segmentsOrdered = false;
+
+      for (UnsignedInt j = 0; j < theEphem[i].points.size(); ++j)
+         pointIndexes[i].AddNode(theEphem[i].points[j].theEpoch);
+   }
+
+   #ifdef DEBUG_INTERPOLATION
+      MessageInterface::ShowMessage("Indexed %d ephemeris segments; segment "
+            "bounds are %sordered\n", theEphem.size(),
+            (segmentsOrdered ? "" : "not "));
+   #endif
+}
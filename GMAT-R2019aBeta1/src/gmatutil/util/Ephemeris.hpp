@@ -34,6 +34,8 @@
 #include "utildefs.hpp"       // Change to gmatutil for R2018a
 #include "Rvector6.hpp"
 #include "Interpolator.hpp"
+#include "EphemerisIndex.hpp"
+#include "EphemerisWindow.hpp"
 
 /**
  * Base class for the ephemeris file components.
@@ -97,6 +99,22 @@ protected:
    bool warnInterpolationDegradation;
    /// Flag to toggle between Lagrange and Hermite interpolation
    bool useHermite;
+
+   /// Lookup tables for the segment start and end epochs
+   EphemerisIndex              segmentStarts;
+   EphemerisIndex              segmentEnds;
+   /// Lookup tables for the points in each segment
+   std::vector<EphemerisIndex> pointIndexes;
+   /// Flag indicating the segment bounds can be searched with the tables
+   bool                        segmentsOrdered;
+   /// Points used in the most recent Lagrange interpolation
+   EphemerisWindow             window;
+   /// Segment and first point loaded in the Hermite interpolator, or -1
+   Integer                     hermiteSegment;
+   Integer                     hermiteStart;
+
+   void           ResetIndexes();
+   void           UpdateIndexes();
 };
 
 #endif /* Ephemeris_hpp */
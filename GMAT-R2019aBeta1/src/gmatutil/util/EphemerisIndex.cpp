@@ -0,0 +1,278 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EphemerisIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the EphemerisIndex.
+ */
+//------------------------------------------------------------------------------
+
+#include "EphemerisIndex.hpp"
+#include "RealUtilities.hpp"
+#include <algorithm>
+
+//#define DEBUG_EPHEMERIS_INDEX
+
+#ifdef DEBUG_EPHEMERIS_INDEX
+   #include "MessageInterface.hpp"
+#endif
+
+/// Largest offset of a node from its evenly spaced position, in steps, for
+/// which the spacing guess in FindNode is off by at most one node
+static const Real UNIFORM_SPACING_TOLERANCE = 0.25;
+
+
+//------------------------------------------------------------------------------
+// EphemerisIndex()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+EphemerisIndex::EphemerisIndex() :
+   spacing              (0.0),
+   spacingChecked       (false),
+   uniform              (false)
+{
+}
+
+//------------------------------------------------------------------------------
+// EphemerisIndex(const EphemerisIndex &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ */
+//------------------------------------------------------------------------------
+EphemerisIndex::EphemerisIndex(const EphemerisIndex &copy) :
+   nodes                (copy.nodes),
+   spacing              (copy.spacing),
+   spacingChecked       (copy.spacingChecked),
+   uniform              (copy.uniform)
+{
+}
+
+//------------------------------------------------------------------------------
+// EphemerisIndex& operator=(const EphemerisIndex &copy)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ */
+//------------------------------------------------------------------------------
+EphemerisIndex& EphemerisIndex::operator=(const EphemerisIndex &copy)
+{
+   if (this != &copy)
+   {
+      nodes          = copy.nodes;
+      spacing        = copy.spacing;
+      spacingChecked = copy.spacingChecked;
+      uniform        = copy.uniform;
+   }
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~EphemerisIndex()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EphemerisIndex::~EphemerisIndex()
+{
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Removes all of the nodes
+ */
+//------------------------------------------------------------------------------
+void EphemerisIndex::Clear()
+{
+   nodes.clear();
+   spacing        = 0.0;
+   spacingChecked = false;
+   uniform        = false;
+}
+
+//------------------------------------------------------------------------------
+// void AddNode(Real epoch)
+//------------------------------------------------------------------------------
+/**
+ * Appends a node.  Nodes must be added in nondecreasing epoch order.
+ *
+ * @param epoch The epoch of the node
+ */
+//------------------------------------------------------------------------------
+void EphemerisIndex::AddNode(Real epoch)
+{
+   nodes.push_back(epoch);
+   spacingChecked = false;
+}
+
+//------------------------------------------------------------------------------
+// void SetNodes(const RealArray &epochs)
+//------------------------------------------------------------------------------
+/**
+ * Replaces the nodes
+ *
+ * @param epochs The node epochs, in nondecreasing order
+ */
+//------------------------------------------------------------------------------
+void EphemerisIndex::SetNodes(const RealArray &epochs)
+{
+   nodes = epochs;
+   spacingChecked = false;
+}
+
+//------------------------------------------------------------------------------
+// Integer GetNodeCount() const
+//------------------------------------------------------------------------------
+Integer EphemerisIndex::GetNodeCount() const
+{
+   return (Integer)nodes.size();
+}
+
+//------------------------------------------------------------------------------
+// bool IsUniform() const
+//------------------------------------------------------------------------------
+/**
+ * Reports if the nodes are evenly spaced, so lookups take constant time
+ */
+//------------------------------------------------------------------------------
+bool EphemerisIndex::IsUniform() const
+{
+   if (!spacingChecked)
+      CheckSpacing();
+   return uniform;
+}
+
+//------------------------------------------------------------------------------
+// Integer FindNode(Real epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the last node at or before an epoch
+ *
+ * When several nodes share an epoch, the last of them is returned, so an epoch
+ * on a segment boundary maps to the segment that starts there.
+ *
+ * @param epoch The epoch
+ *
+ * @return The index of the node, or -1 if the epoch precedes the first node
+ */
+//------------------------------------------------------------------------------
+Integer EphemerisIndex::FindNode(Real epoch) const
+{
+   Integer count = (Integer)nodes.size();
+   if ((count == 0) || (epoch < nodes[0]))
+      return -1;
+   if (epoch >= nodes[count-1])
+      return count - 1;
+
+   if (!spacingChecked)
+      CheckSpacing();
+
+   if (uniform)
+   {
+      // Guess from the spacing, then correct for rounding in the guess
+      Integer index = (Integer)((epoch - nodes[0]) / spacing);
+      if (index > count - 2)
+         index = count - 2;
+      if (index < 0)
+         index = 0;
+      while ((index > 0) && (nodes[index] > epoch))
+         --index;
+      while ((index < count - 1) && (nodes[index+1] <= epoch))
+         ++index;
+      return index;
+   }
+
+   RealArray::const_iterator pos =
+         std::upper_bound(nodes.begin(), nodes.end(), epoch);
+   return (Integer)(pos - nodes.begin()) - 1;
+}
+
+//------------------------------------------------------------------------------
+// Integer FindNearestNode(Real epoch) const
+//------------------------------------------------------------------------------
+/**
+ * Finds the node closest to an epoch.  Ties go to the earlier node.
+ *
+ * @param epoch The epoch
+ *
+ * @return The index of the node, or -1 if there are no nodes
+ */
+//------------------------------------------------------------------------------
+Integer EphemerisIndex::FindNearestNode(Real epoch) const
+{
+   Integer count = (Integer)nodes.size();
+   if (count == 0)
+      return -1;
+
+   Integer index = FindNode(epoch);
+   if (index < 0)
+      return 0;
+
+   // Back up over repeated epochs so ties resolve to the first of them
+   while ((index > 0) && (nodes[index-1] == nodes[index]))
+      --index;
+
+   if ((index < count - 1) &&
+       (GmatMathUtil::Abs(nodes[index+1] - epoch) <
+        GmatMathUtil::Abs(nodes[index] - epoch)))
+      ++index;
+
+   return index;
+}
+
+//------------------------------------------------------------------------------
+// void CheckSpacing() const
+//------------------------------------------------------------------------------
+/**
+ * Determines if the nodes are evenly spaced
+ */
+//------------------------------------------------------------------------------
+void EphemerisIndex::CheckSpacing() const
+{
+   Integer count = (Integer)nodes.size();
+   spacingChecked = true;
+   uniform = false;
+
+   if (count < 3)
+      return;
+
+   Real step = (nodes[count-1] - nodes[0]) / (count - 1);
+   if (step <= 0.0)
+      return;
+
+   Real limit = UNIFORM_SPACING_TOLERANCE * step;
+   for (Integer i = 1; i < count; ++i)
+      if (GmatMathUtil::Abs(nodes[i] - (nodes[0] + i * step)) > limit ||
+          nodes[i] <= nodes[i-1])
+         return;
+
+   spacing = step;
+   uniform = true;
+
+   #ifdef DEBUG_EPHEMERIS_INDEX
+      MessageInterface::ShowMessage("EphemerisIndex: %d nodes spaced %.12le\n",
+            count, spacing);
+   #endif
+}
@@ -0,0 +1,64 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EphemerisIndex
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Maps epochs to the nodes of an ephemeris.
+ *
+ * The index holds a sorted list of node epochs.  When the nodes are close to
+ * evenly spaced the node preceding an epoch is computed from the spacing and
+ * corrected by at most a step; otherwise it is found by binary search.
+ */
+//------------------------------------------------------------------------------
+#ifndef EphemerisIndex_hpp
+#define EphemerisIndex_hpp
+
+#include "utildefs.hpp"
+
+class GMATUTIL_API EphemerisIndex
+{
+public:
+   EphemerisIndex();
+   EphemerisIndex(const EphemerisIndex &copy);
+   EphemerisIndex& operator=(const EphemerisIndex &copy);
+   virtual ~EphemerisIndex();
+
+   void           Clear();
+   void           AddNode(Real epoch);
+   void           SetNodes(const RealArray &epochs);
+
+   Integer        GetNodeCount() const;
+   bool           IsUniform() const;
+   Integer        FindNode(Real epoch) const;
+   Integer        FindNearestNode(Real epoch) const;
+
+protected:
+   /// Node epochs, in nondecreasing order
+   RealArray      nodes;
+   /// Node spacing when the nodes are evenly spaced
+   mutable Real   spacing;
+   /// Flag indicating that the spacing has been checked
+   mutable bool   spacingChecked;
+   /// Flag indicating the nodes are evenly spaced
+   mutable bool   uniform;
+
+   void           CheckSpacing() const;
+};
+
+#endif // EphemerisIndex_hpp
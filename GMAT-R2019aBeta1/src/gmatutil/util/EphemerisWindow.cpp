@@ -0,0 +1,357 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EphemerisWindow
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the EphemerisWindow.
+ */
+//------------------------------------------------------------------------------
+
+#include "EphemerisWindow.hpp"
+#include "GmatConstants.hpp"
+
+//#define DEBUG_EPHEMERIS_WINDOW
+
+#ifdef DEBUG_EPHEMERIS_WINDOW
+   #include "MessageInterface.hpp"
+#endif
+
+
+//------------------------------------------------------------------------------
+// EphemerisWindow()
+//------------------------------------------------------------------------------
+/**
+ * Default constructor
+ */
+//------------------------------------------------------------------------------
+EphemerisWindow::EphemerisWindow() :
+   windowSegment        (-1),
+   windowFirst          (-1),
+   referenceEpoch       (0.0),
+   weightsReady         (false)
+{
+}
+
+//------------------------------------------------------------------------------
+// EphemerisWindow(const EphemerisWindow &copy)
+//------------------------------------------------------------------------------
+/**
+ * Copy constructor
+ */
+//------------------------------------------------------------------------------
+EphemerisWindow::EphemerisWindow(const EphemerisWindow &copy) :
+   windowSegment        (copy.windowSegment),
+   windowFirst          (copy.windowFirst),
+   referenceEpoch       (copy.referenceEpoch),
+   offsets              (copy.offsets),
+   values               (copy.values),
+   weights              (copy.weights),
+   weightsReady         (copy.weightsReady),
+   terms                (copy.terms)
+{
+}
+
+//------------------------------------------------------------------------------
+// EphemerisWindow& operator=(const EphemerisWindow &copy)
+//------------------------------------------------------------------------------
+/**
+ * Assignment operator
+ */
+//------------------------------------------------------------------------------
+EphemerisWindow& EphemerisWindow::operator=(const EphemerisWindow &copy)
+{
+   if (this != &copy)
+   {
+      windowSegment  = copy.windowSegment;
+      windowFirst    = copy.windowFirst;
+      referenceEpoch = copy.referenceEpoch;
+      offsets        = copy.offsets;
+      values         = copy.values;
+      weights        = copy.weights;
+      weightsReady   = copy.weightsReady;
+      terms          = copy.terms;
+   }
+   return *this;
+}
+
+//------------------------------------------------------------------------------
+// ~EphemerisWindow()
+//------------------------------------------------------------------------------
+/**
+ * Destructor
+ */
+//------------------------------------------------------------------------------
+EphemerisWindow::~EphemerisWindow()
+{
+}
+
+//------------------------------------------------------------------------------
+// void Clear()
+//------------------------------------------------------------------------------
+/**
+ * Empties the window
+ */
+//------------------------------------------------------------------------------
+void EphemerisWindow::Clear()
+{
+   windowSegment = -1;
+   windowFirst   = -1;
+   offsets.clear();
+   values.clear();
+   weights.clear();
+   weightsReady  = false;
+}
+
+//------------------------------------------------------------------------------
+// bool IsLoaded(Integer segment, Integer first, Integer count) const
+//------------------------------------------------------------------------------
+/**
+ * Checks if the window already holds a set of nodes
+ *
+ * @param segment The segment containing the nodes
+ * @param first   The index of the first node in the segment
+ * @param count   The number of nodes
+ *
+ * @return true if the window holds those nodes
+ */
+//------------------------------------------------------------------------------
+bool EphemerisWindow::IsLoaded(Integer segment, Integer first,
+      Integer count) const
+{
+   return ((count > 0) && (segment == windowSegment) &&
+           (first == windowFirst) && ((Integer)offsets.size() == count));
+}
+
+//------------------------------------------------------------------------------
+// void Start(Integer segment, Integer first, Real refEpoch)
+//------------------------------------------------------------------------------
+/**
+ * Empties the window and labels the nodes that will be added to it
+ *
+ * @param segment  The segment containing the nodes
+ * @param first    The index of the first node in the segment
+ * @param refEpoch An epoch near the nodes, used to keep the offsets small
+ */
+//------------------------------------------------------------------------------
+void EphemerisWindow::Start(Integer segment, Integer first, Real refEpoch)
+{
+   Clear();
+   windowSegment  = segment;
+   windowFirst    = first;
+   referenceEpoch = refEpoch;
+}
+
+//------------------------------------------------------------------------------
+// void AddNode(Real epoch, const Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Adds a node to the window
+ *
+ * @param epoch The A.1 epoch of the node
+ * @param state The 6 element state at the node
+ */
+//------------------------------------------------------------------------------
+void EphemerisWindow::AddNode(Real epoch, const Real *state)
+{
+   offsets.push_back((epoch - referenceEpoch) *
+         GmatTimeConstants::SECS_PER_DAY);
+   for (Integer i = 0; i < 6; ++i)
+      values.push_back(state[i]);
+   weightsReady = false;
+}
+
+//------------------------------------------------------------------------------
+// bool Interpolate(Real epoch, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates each of the 6 state elements independently
+ *
+ * @param epoch The A.1 epoch of the requested state
+ * @param state The interpolated state
+ *
+ * @return true on success, false if the window is empty
+ */
+//------------------------------------------------------------------------------
+bool EphemerisWindow::Interpolate(Real epoch, Real *state)
+{
+   Integer count = (Integer)offsets.size();
+   if (count == 0)
+      return false;
+
+   Real offset = (epoch - referenceEpoch) * GmatTimeConstants::SECS_PER_DAY;
+   Integer node = PrepareTerms(offset);
+   if (node >= 0)
+   {
+      for (Integer i = 0; i < 6; ++i)
+         state[i] = values[node*6 + i];
+      return true;
+   }
+
+   Real denominator = 0.0;
+   for (Integer i = 0; i < 6; ++i)
+      state[i] = 0.0;
+   for (Integer j = 0; j < count; ++j)
+   {
+      denominator += terms[j];
+      for (Integer i = 0; i < 6; ++i)
+         state[i] += terms[j] * values[j*6 + i];
+   }
+   for (Integer i = 0; i < 6; ++i)
+      state[i] /= denominator;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// bool InterpolateCartesianState(Real epoch, Real *state)
+//------------------------------------------------------------------------------
+/**
+ * Interpolates the position, and takes the velocity from the derivative of
+ * the position polynomial
+ *
+ * This matches the Cartesian state interpolation of the HermiteInterpolator
+ * when no derivative data is supplied.
+ *
+ * @param epoch The A.1 epoch of the requested state
+ * @param state The interpolated state; velocities are in km/s
+ *
+ * @return true on success, false if the window is empty
+ */
+//------------------------------------------------------------------------------
+bool EphemerisWindow::InterpolateCartesianState(Real epoch, Real *state)
+{
+   Integer count = (Integer)offsets.size();
+   if (count == 0)
+      return false;
+
+   if (count == 1)
+   {
+      for (Integer i = 0; i < 6; ++i)
+         state[i] = values[i];
+      return true;
+   }
+
+   Real offset = (epoch - referenceEpoch) * GmatTimeConstants::SECS_PER_DAY;
+   Integer node = PrepareTerms(offset);
+
+   if (node >= 0)
+   {
+      // Derivative of the polynomial at one of its nodes
+      for (Integer i = 0; i < 3; ++i)
+      {
+         state[i] = values[node*6 + i];
+         state[i+3] = 0.0;
+      }
+      for (Integer j = 0; j < count; ++j)
+      {
+         if (j == node)
+            continue;
+         Real factor = weights[j] / (weights[node] *
+               (offsets[node] - offsets[j]));
+         for (Integer i = 0; i < 3; ++i)
+            state[i+3] += factor * (values[j*6 + i] - values[node*6 + i]);
+      }
+      return true;
+   }
+
+   Real denominator = 0.0;
+   for (Integer i = 0; i < 3; ++i)
+      state[i] = 0.0;
+   for (Integer j = 0; j < count; ++j)
+   {
+      denominator += terms[j];
+      for (Integer i = 0; i < 3; ++i)
+         state[i] += terms[j] * values[j*6 + i];
+   }
+   for (Integer i = 0; i < 3; ++i)
+   {
+      state[i] /= denominator;
+      state[i+3] = 0.0;
+   }
+
+   // p'(x) = sum(t_j (p(x) - f_j) / (x - x_j)) / sum(t_j)
+   for (Integer j = 0; j < count; ++j)
+   {
+      Real factor = terms[j] / (offset - offsets[j]);
+      for (Integer i = 0; i < 3; ++i)
+         state[i+3] += factor * (state[i] - values[j*6 + i]);
+   }
+   for (Integer i = 3; i < 6; ++i)
+      state[i] /= denominator;
+
+   return true;
+}
+
+//------------------------------------------------------------------------------
+// void ComputeWeights()
+//------------------------------------------------------------------------------
+/**
+ * Computes the barycentric weights, w_j = 1 / prod_{k != j} (x_j - x_k)
+ */
+//------------------------------------------------------------------------------
+void EphemerisWindow::ComputeWeights()
+{
+   Integer count = (Integer)offsets.size();
+   weights.assign(count, 1.0);
+   terms.resize(count);
+
+   for (Integer j = 0; j < count; ++j)
+   {
+      Real product = 1.0;
+      for (Integer k = 0; k < count; ++k)
+         if (k != j)
+            product *= offsets[j] - offsets[k];
+      weights[j] = 1.0 / product;
+   }
+   weightsReady = true;
+
+   #ifdef DEBUG_EPHEMERIS_WINDOW
+      MessageInterface::ShowMessage("EphemerisWindow: weights set for %d "
+            "nodes starting at node %d of segment %d\n", count, windowFirst,
+            windowSegment);
+   #endif
+}
+
+//------------------------------------------------------------------------------
+// Integer PrepareTerms(Real offset)
+//------------------------------------------------------------------------------
+/**
+ * Fills the per-node terms w_j / (x - x_j) for an interpolation
+ *
+ * @param offset The interpolation point, in seconds from the reference epoch
+ *
+ * @return The index of the node at the interpolation point, or -1 if the
+ *         point is not a node
+ */
+//------------------------------------------------------------------------------
+Integer EphemerisWindow::PrepareTerms(Real offset)
+{
+   if (!weightsReady)
+      ComputeWeights();
+
+   Integer count = (Integer)offsets.size();
+   for (Integer j = 0; j < count; ++j)
+   {
+      Real diff = offset - offsets[j];
+      if (diff == 0.0)
+         return j;
+      terms[j] = weights[j] / diff;
+   }
+   return -1;
+}
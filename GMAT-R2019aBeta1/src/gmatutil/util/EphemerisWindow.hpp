@@ -0,0 +1,75 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                             EphemerisWindow
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * A window of ephemeris states interpolated with the barycentric form of the
+ * Lagrange polynomial.
+ *
+ * The barycentric weights depend only on the node epochs, so they are computed
+ * once when the window is loaded.  Each interpolation in the window then costs
+ * one pass over the nodes.  The window remembers the segment and first node it
+ * was loaded from so callers can skip reloading it on repeated queries.
+ */
+//------------------------------------------------------------------------------
+#ifndef EphemerisWindow_hpp
+#define EphemerisWindow_hpp
+
+#include "utildefs.hpp"
+
+class GMATUTIL_API EphemerisWindow
+{
+public:
+   EphemerisWindow();
+   EphemerisWindow(const EphemerisWindow &copy);
+   EphemerisWindow& operator=(const EphemerisWindow &copy);
+   virtual ~EphemerisWindow();
+
+   void           Clear();
+   bool           IsLoaded(Integer segment, Integer first,
+                           Integer count) const;
+   void           Start(Integer segment, Integer first, Real refEpoch);
+   void           AddNode(Real epoch, const Real *state);
+
+   bool           Interpolate(Real epoch, Real *state);
+   bool           InterpolateCartesianState(Real epoch, Real *state);
+
+protected:
+   /// Segment the window was loaded from
+   Integer        windowSegment;
+   /// Index of the first node of the window in its segment
+   Integer        windowFirst;
+   /// Epoch the node offsets are measured from, in days
+   Real           referenceEpoch;
+   /// Node offsets from the reference epoch, in seconds
+   RealArray      offsets;
+   /// Node states, 6 per node
+   RealArray      values;
+   /// Barycentric weights
+   RealArray      weights;
+   /// Flag indicating the weights match the nodes
+   bool           weightsReady;
+   /// Scratch space for the per-node terms of an interpolation
+   RealArray      terms;
+
+   void           ComputeWeights();
+   Integer        PrepareTerms(Real offset);
+};
+
+#endif // EphemerisWindow_hpp
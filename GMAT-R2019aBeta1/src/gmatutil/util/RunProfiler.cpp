@@ -0,0 +1,542 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              RunProfiler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Implements the RunProfiler singleton.
+ */
+//------------------------------------------------------------------------------
+
+#include "RunProfiler.hpp"
+#include "StringUtil.hpp"
+#include "MessageInterface.hpp"
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+
+//#define DEBUG_PROFILER
+
+//---------------------------------
+// static members
+//---------------------------------
+
+RunProfiler*      RunProfiler::theInstance = NULL;
+std::atomic<bool> RunProfiler::enabled(false);
+
+//---------------------------------
+// public methods
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// RunProfiler* Instance()
+//------------------------------------------------------------------------------
+RunProfiler* RunProfiler::Instance()
+{
+   if (theInstance == NULL)
+      theInstance = new RunProfiler;
+   return theInstance;
+}
+
+
+//------------------------------------------------------------------------------
+// Integer RegisterCounter(const std::string &name)
+//------------------------------------------------------------------------------
+/**
+ * Registers an event counter, or finds one that is already registered.
+ *
+ * Subsystems call this once, usually to initialize a file scope constant, and
+ * pass the returned ID to Count().  Counters are reported in the order they
+ * are registered.
+ *
+ * @param name The name shown for the counter in the reports
+ *
+ * @return The counter ID, or -1 if MAX_COUNTERS counters are already
+ *         registered; Count() ignores an ID of -1
+ */
+//------------------------------------------------------------------------------
+Integer RunProfiler::RegisterCounter(const std::string &name)
+{
+   RunProfiler *profiler = Instance();
+   std::lock_guard<std::mutex> lock(profiler->registryMutex);
+
+   for (UnsignedInt i = 0; i < profiler->counterNames.size(); ++i)
+      if (profiler->counterNames[i] == name)
+         return (Integer)i;
+
+   if ((Integer)profiler->counterNames.size() >= MAX_COUNTERS)
+      return -1;
+
+   profiler->counterNames.push_back(name);
+   return (Integer)profiler->counterNames.size() - 1;
+}
+
+
+//------------------------------------------------------------------------------
+// void SetEnabled(bool onOff)
+//------------------------------------------------------------------------------
+/**
+ * Turns data collection on or off.  Collected data is kept until Reset() is
+ * called.
+ *
+ * @param onOff true to collect data, false to stop collecting
+ */
+//------------------------------------------------------------------------------
+void RunProfiler::SetEnabled(bool onOff)
+{
+   enabled.store(onOff);
+}
+
+
+//------------------------------------------------------------------------------
+// void Reset()
+//------------------------------------------------------------------------------
+/**
+ * Clears all of the accumulated data and restarts the run clock.
+ */
+//------------------------------------------------------------------------------
+void RunProfiler::Reset()
+{
+   for (Integer i = 0; i < StageCount; ++i)
+   {
+      calls[i].store(0);
+      wallNs[i].store(0);
+      cpuNs[i].store(0);
+   }
+   for (Integer i = 0; i < MAX_COUNTERS; ++i)
+      counts[i].store(0);
+
+   runStart = GetWallTime();
+   intervals.clear();
+   TakeSnapshot(lastMark);
+}
+
+
+//------------------------------------------------------------------------------
+// void MarkInterval(const std::string &label)
+//------------------------------------------------------------------------------
+/**
+ * Closes the current interval (for example an estimator iteration).
+ *
+ * The values accumulated since the previous mark are saved under the label for
+ * the JSON output, and the next call to GetReportTable() with sinceMark set
+ * starts from here.
+ *
+ * @param label The name of the interval that is being closed
+ */
+//------------------------------------------------------------------------------
+void RunProfiler::MarkInterval(const std::string &label)
+{
+   Snapshot now;
+   TakeSnapshot(now);
+
+   Snapshot delta = now;
+   delta.label   = label;
+   delta.elapsed = now.elapsed - lastMark.elapsed;
+   for (Integer i = 0; i < StageCount; ++i)
+   {
+      delta.calls[i]  -= lastMark.calls[i];
+      delta.wallNs[i] -= lastMark.wallNs[i];
+      delta.cpuNs[i]  -= lastMark.cpuNs[i];
+   }
+   for (Integer i = 0; i < MAX_COUNTERS; ++i)
+      delta.counts[i] -= lastMark.counts[i];
+
+   intervals.push_back(delta);
+   lastMark = now;
+}
+
+
+//------------------------------------------------------------------------------
+// void AddSample(Stage which, Real wallSeconds, Real cpuSeconds)
+//------------------------------------------------------------------------------
+/**
+ * Adds one timed call to a stage.  Safe to call from several threads.
+ *
+ * @param which       The stage that was timed
+ * @param wallSeconds Elapsed wall clock time for the call
+ * @param cpuSeconds  Elapsed process CPU time for the call
+ */
+//------------------------------------------------------------------------------
+void RunProfiler::AddSample(Stage which, Real wallSeconds, Real cpuSeconds)
+{
+   calls[which].fetch_add(1, std::memory_order_relaxed);
+   wallNs[which].fetch_add((long long)(wallSeconds * 1.0e9),
+         std::memory_order_relaxed);
+   cpuNs[which].fetch_add((long long)(cpuSeconds * 1.0e9),
+         std::memory_order_relaxed);
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetReportTable(const std::string &title, bool sinceMark) const
+//------------------------------------------------------------------------------
+/**
+ * Builds a text table of the profile data, formatted for the report files.
+ *
+ * @param title     Title written in the table banner
+ * @param sinceMark true to report the data since the last MarkInterval()
+ *                  call, false to report the totals since Reset()
+ *
+ * @return The table
+ */
+//------------------------------------------------------------------------------
+std::string RunProfiler::GetReportTable(const std::string &title,
+      bool sinceMark) const
+{
+   Snapshot now;
+   TakeSnapshot(now);
+   if (sinceMark)
+   {
+      now.elapsed -= lastMark.elapsed;
+      for (Integer i = 0; i < StageCount; ++i)
+      {
+         now.calls[i]  -= lastMark.calls[i];
+         now.wallNs[i] -= lastMark.wallNs[i];
+         now.cpuNs[i]  -= lastMark.cpuNs[i];
+      }
+      for (Integer i = 0; i < MAX_COUNTERS; ++i)
+         now.counts[i] -= lastMark.counts[i];
+   }
+
+   std::stringstream table;
+   table.setf(std::ios::fixed, std::ios::floatfield);
+
+   // Center the title in a banner as wide as the other report sections
+   std::string banner = "  " + title + "  ";
+   UnsignedInt stars = (banner.size() < 158 ? 158 - banner.size() : 0);
+   table << std::string(stars / 2, '*') << banner
+         << std::string(stars - stars / 2, '*') << "\n\n";
+
+   table << " " << GmatStringUtil::GetAlignmentString("Stage", 30)
+         << GmatStringUtil::GetAlignmentString("Calls", 14, GmatStringUtil::RIGHT)
+         << GmatStringUtil::GetAlignmentString("Wall Time (s)", 18, GmatStringUtil::RIGHT)
+         << GmatStringUtil::GetAlignmentString("CPU Time (s)", 18, GmatStringUtil::RIGHT)
+         << GmatStringUtil::GetAlignmentString("Wall/Call (ms)", 18, GmatStringUtil::RIGHT)
+         << GmatStringUtil::GetAlignmentString("% of Elapsed", 16, GmatStringUtil::RIGHT)
+         << "\n\n";
+
+   for (Integer i = 0; i < StageCount; ++i)
+   {
+      Real wall = now.wallNs[i] * 1.0e-9;
+      Real cpu  = now.cpuNs[i] * 1.0e-9;
+      Real perCall = (now.calls[i] > 0 ? 1000.0 * wall / now.calls[i] : 0.0);
+      Real percent = (now.elapsed > 0.0 ? 100.0 * wall / now.elapsed : 0.0);
+
+      table << " " << GmatStringUtil::GetAlignmentString(GetStageName((Stage)i), 30)
+            << std::setw(14) << now.calls[i]
+            << std::setw(18) << std::setprecision(3) << wall
+            << std::setw(18) << std::setprecision(3) << cpu
+            << std::setw(18) << std::setprecision(4) << perCall
+            << std::setw(16) << std::setprecision(1) << percent
+            << "\n";
+   }
+
+   table << "\n " << GmatStringUtil::GetAlignmentString("Counter", 30)
+         << GmatStringUtil::GetAlignmentString("Count", 14, GmatStringUtil::RIGHT)
+         << "\n\n";
+   Integer counters = GetCounterCount();
+   for (Integer i = 0; i < counters; ++i)
+      table << " " << GmatStringUtil::GetAlignmentString(GetCounterName(i), 30)
+            << std::setw(14) << now.counts[i] << "\n";
+
+   table << "\n " << GmatStringUtil::GetAlignmentString("Elapsed Wall Time (s)", 30)
+         << std::setw(14) << std::setprecision(3) << now.elapsed << "\n"
+         << "\n Stage times are inclusive; nested stages are counted in each "
+            "enclosing stage.\n\n";
+
+   return table.str();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetJson() const
+//------------------------------------------------------------------------------
+/**
+ * Builds a JSON document containing each completed interval and the run
+ * totals.  Times are in seconds.
+ *
+ * @return The JSON text
+ */
+//------------------------------------------------------------------------------
+std::string RunProfiler::GetJson() const
+{
+   std::stringstream json;
+   json.setf(std::ios::fixed, std::ios::floatfield);
+   json.precision(6);
+
+   json << "{\n  \"intervals\": [";
+   for (UnsignedInt i = 0; i < intervals.size(); ++i)
+   {
+      json << (i == 0 ? "\n" : ",\n") << "    {\n";
+      WriteSnapshotJson(json, intervals[i], "      ");
+      json << "    }";
+   }
+   json << "\n  ],\n  \"total\": {\n";
+
+   Snapshot total;
+   TakeSnapshot(total);
+   total.label = "Total";
+   WriteSnapshotJson(json, total, "    ");
+   json << "  }\n}\n";
+
+   return json.str();
+}
+
+
+//------------------------------------------------------------------------------
+// bool WriteJson(const std::string &fileName) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the JSON document from GetJson() to a file.
+ *
+ * @param fileName The full path to the file
+ *
+ * @return true if the file was written, false if it could not be opened
+ */
+//------------------------------------------------------------------------------
+bool RunProfiler::WriteJson(const std::string &fileName) const
+{
+   std::ofstream out(fileName.c_str());
+   if (!out.is_open())
+      return false;
+
+   out << GetJson();
+   out.close();
+
+   #ifdef DEBUG_PROFILER
+      MessageInterface::ShowMessage("RunProfiler wrote %s\n", fileName.c_str());
+   #endif
+
+   return true;
+}
+
+
+//------------------------------------------------------------------------------
+// long long GetCount(Integer which) const
+//------------------------------------------------------------------------------
+/**
+ * Reads an event counter.
+ *
+ * @param which The counter ID
+ *
+ * @return The count since Reset(), or 0 for an invalid ID
+ */
+//------------------------------------------------------------------------------
+long long RunProfiler::GetCount(Integer which) const
+{
+   if ((which < 0) || (which >= MAX_COUNTERS))
+      return 0;
+   return counts[which].load(std::memory_order_relaxed);
+}
+
+
+//------------------------------------------------------------------------------
+// long long GetCount(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Reads an event counter by name.
+ *
+ * @param name The name the counter was registered with
+ *
+ * @return The count since Reset(), or 0 if no such counter is registered
+ */
+//------------------------------------------------------------------------------
+long long RunProfiler::GetCount(const std::string &name) const
+{
+   return GetCount(FindCounter(name));
+}
+
+
+//------------------------------------------------------------------------------
+// Integer GetCounterCount() const
+//------------------------------------------------------------------------------
+/**
+ * Retrieves the number of registered event counters.
+ *
+ * @return The number of counters; their IDs run from 0 to this value - 1
+ */
+//------------------------------------------------------------------------------
+Integer RunProfiler::GetCounterCount() const
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+   return (Integer)counterNames.size();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetCounterName(Integer which) const
+//------------------------------------------------------------------------------
+std::string RunProfiler::GetCounterName(Integer which) const
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+   if ((which < 0) || (which >= (Integer)counterNames.size()))
+      return "Unknown";
+   return counterNames[which];
+}
+
+
+//------------------------------------------------------------------------------
+// Real GetWallTime()
+//------------------------------------------------------------------------------
+/**
+ * Reads the monotonic wall clock.
+ *
+ * @return The clock time in seconds, measured from an arbitrary origin
+ */
+//------------------------------------------------------------------------------
+Real RunProfiler::GetWallTime()
+{
+   std::chrono::duration<Real> now =
+         std::chrono::steady_clock::now().time_since_epoch();
+   return now.count();
+}
+
+
+//------------------------------------------------------------------------------
+// std::string GetStageName(Stage which)
+//------------------------------------------------------------------------------
+std::string RunProfiler::GetStageName(Stage which)
+{
+   switch (which)
+   {
+   case PROPAGATION:
+      return "Propagation";
+   case LIGHT_TIME:
+      return "Light Time Solution";
+   case MEDIA_CORRECTION:
+      return "Media Corrections";
+   case DERIVATIVES:
+      return "Measurement Derivatives";
+   case ACCUMULATION:
+      return "Accumulation";
+   case INVERSION:
+      return "Normal Equation Inversion";
+   default:
+      break;
+   }
+   return "Unknown";
+}
+
+
+//---------------------------------
+// private methods
+//---------------------------------
+
+//------------------------------------------------------------------------------
+// RunProfiler()
+//------------------------------------------------------------------------------
+RunProfiler::RunProfiler() :
+   runStart       (0.0)
+{
+   Reset();
+}
+
+
+//------------------------------------------------------------------------------
+// ~RunProfiler()
+//------------------------------------------------------------------------------
+RunProfiler::~RunProfiler()
+{
+}
+
+
+//------------------------------------------------------------------------------
+// Integer FindCounter(const std::string &name) const
+//------------------------------------------------------------------------------
+/**
+ * Looks up a registered counter.
+ *
+ * @param name The name the counter was registered with
+ *
+ * @return The counter ID, or -1 if no such counter is registered
+ */
+//------------------------------------------------------------------------------
+Integer RunProfiler::FindCounter(const std::string &name) const
+{
+   std::lock_guard<std::mutex> lock(registryMutex);
+   for (UnsignedInt i = 0; i < counterNames.size(); ++i)
+      if (counterNames[i] == name)
+         return (Integer)i;
+   return -1;
+}
+
+
+//------------------------------------------------------------------------------
+// void TakeSnapshot(Snapshot &snap) const
+//------------------------------------------------------------------------------
+/**
+ * Copies the current totals into a Snapshot.
+ *
+ * @param snap The structure receiving the data
+ */
+//------------------------------------------------------------------------------
+void RunProfiler::TakeSnapshot(Snapshot &snap) const
+{
+   snap.label   = "";
+   snap.elapsed = GetWallTime() - runStart;
+   for (Integer i = 0; i < StageCount; ++i)
+   {
+      snap.calls[i]  = calls[i].load();
+      snap.wallNs[i] = wallNs[i].load();
+      snap.cpuNs[i]  = cpuNs[i].load();
+   }
+   for (Integer i = 0; i < MAX_COUNTERS; ++i)
+      snap.counts[i] = counts[i].load();
+}
+
+
+//------------------------------------------------------------------------------
+// void WriteSnapshotJson(std::stringstream &out, const Snapshot &snap,
+//                        const std::string &indent) const
+//------------------------------------------------------------------------------
+/**
+ * Writes the members of a JSON object describing a Snapshot.
+ *
+ * Stage and counter names are written without spaces so that the keys are
+ * convenient to use from scripts.
+ *
+ * @param out    The stream receiving the JSON
+ * @param snap   The data to write
+ * @param indent Indentation for the object members
+ */
+//------------------------------------------------------------------------------
+void RunProfiler::WriteSnapshotJson(std::stringstream &out,
+      const Snapshot &snap, const std::string &indent) const
+{
+   out << indent << "\"label\": \"" << snap.label << "\",\n"
+       << indent << "\"elapsedWallTime\": " << snap.elapsed << ",\n"
+       << indent << "\"stages\": {";
+   for (Integer i = 0; i < StageCount; ++i)
+   {
+      out << (i == 0 ? "\n" : ",\n") << indent << "  \""
+          << GmatStringUtil::RemoveAll(GetStageName((Stage)i), ' ')
+          << "\": { \"calls\": " << snap.calls[i]
+          << ", \"wallTime\": " << snap.wallNs[i] * 1.0e-9
+          << ", \"cpuTime\": " << snap.cpuNs[i] * 1.0e-9 << " }";
+   }
+   out << "\n" << indent << "},\n" << indent << "\"counters\": {";
+   Integer counters = GetCounterCount();
+   for (Integer i = 0; i < counters; ++i)
+   {
+      out << (i == 0 ? "\n" : ",\n") << indent << "  \""
+          << GmatStringUtil::RemoveAll(GetCounterName(i), ' ')
+          << "\": " << snap.counts[i];
+   }
+   out << "\n" << indent << "}\n";
+}
@@ -0,0 +1,216 @@
+//$Id$
+//------------------------------------------------------------------------------
+//                              RunProfiler
+//------------------------------------------------------------------------------
+// GMAT: General Mission Analysis Tool
+//
+// Copyright (c) 2002 - 2018 United States Government as represented by the
+// Administrator of the National Aeronautics and Space Administration.
+// All Other Rights Reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// You may not use this file except in compliance with the License.
+// You may obtain a copy of the License at:
+// http://www.apache.org/licenses/LICENSE-2.0.
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+// express or implied.   See the License for the specific language
+// governing permissions and limitations under the License.
+//
+/**
+ * Declares the RunProfiler class, a singleton that accumulates wall clock
+ * time, CPU time and call counts for the expensive stages of a run, along with
+ * a set of event counters.
+ *
+ * Event counters are registered by name, so a subsystem adds a counter without
+ * editing this class:
+ *
+ *    static const Integer STEP_COUNTER =
+ *          RunProfiler::RegisterCounter("Integrator Steps");
+ *    ...
+ *    RunProfiler::Count(STEP_COUNTER);
+ *
+ * Registering a name again returns the same counter, so several classes can
+ * share one.
+ *
+ * The profiler is off by default.  Instrumented code uses the ProfileScope
+ * helper and RunProfiler::Count(); both test a single flag before doing any
+ * work, so leaving the instrumentation in production code costs one branch
+ * per call site when profiling is disabled.
+ *
+ * Stage times are inclusive: a stage that runs inside another (for example a
+ * media correction computed during a light time solution) is charged to both.
+ */
+//------------------------------------------------------------------------------
+
+#ifndef RunProfiler_hpp
+#define RunProfiler_hpp
+
+#include "utildefs.hpp"
+#include <atomic>
+#include <ctime>
+#include <mutex>
+#include <sstream>
+
+
+class GMATUTIL_API RunProfiler
+{
+public:
+   /// The timed stages
+   enum Stage
+   {
+      PROPAGATION = 0,
+      LIGHT_TIME,
+      MEDIA_CORRECTION,
+      DERIVATIVES,
+      ACCUMULATION,
+      INVERSION,
+      StageCount
+   };
+
+   /// Largest number of event counters that can be registered
+   static const Integer MAX_COUNTERS = 64;
+
+   static RunProfiler*  Instance();
+   static Integer       RegisterCounter(const std::string &name);
+
+   //---------------------------------------------------------------------------
+   // bool IsEnabled()
+   //---------------------------------------------------------------------------
+   /**
+    * Checks the profiling flag; this is the only work done when profiling is
+    * off.
+    */
+   //---------------------------------------------------------------------------
+   static bool IsEnabled()
+   {
+      return enabled.load(std::memory_order_relaxed);
+   }
+
+   //---------------------------------------------------------------------------
+   // void Count(Integer which, Integer increment = 1)
+   //---------------------------------------------------------------------------
+   /**
+    * Increments an event counter if profiling is enabled.
+    *
+    * @param which     The counter ID returned by RegisterCounter()
+    * @param increment The amount added to the counter
+    */
+   //---------------------------------------------------------------------------
+   static void Count(Integer which, Integer increment = 1)
+   {
+      if (enabled.load(std::memory_order_relaxed) && (which >= 0))
+         theInstance->counts[which].fetch_add(increment,
+               std::memory_order_relaxed);
+   }
+
+   void                 SetEnabled(bool onOff);
+   void                 Reset();
+   void                 MarkInterval(const std::string &label);
+   void                 AddSample(Stage which, Real wallSeconds,
+                                  Real cpuSeconds);
+
+   std::string          GetReportTable(const std::string &title,
+                                       bool sinceMark) const;
+   std::string          GetJson() const;
+   bool                 WriteJson(const std::string &fileName) const;
+   long long            GetCount(Integer which) const;
+   long long            GetCount(const std::string &name) const;
+   Integer              GetCounterCount() const;
+   std::string          GetCounterName(Integer which) const;
+
+   static Real          GetWallTime();
+   static std::string   GetStageName(Stage which);
+
+private:
+   /// Totals for the stages and counters at one point in the run
+   struct Snapshot
+   {
+      std::string    label;
+      Real           elapsed;
+      long long      calls[StageCount];
+      long long      wallNs[StageCount];
+      long long      cpuNs[StageCount];
+      long long      counts[MAX_COUNTERS];
+   };
+
+   static RunProfiler                     *theInstance;
+   static std::atomic<bool>               enabled;
+
+   /// Number of completed samples for each stage
+   std::atomic<long long>                 calls[StageCount];
+   /// Accumulated wall clock time for each stage, in nanoseconds
+   std::atomic<long long>                 wallNs[StageCount];
+   /// Accumulated CPU time for each stage, in nanoseconds
+   std::atomic<long long>                 cpuNs[StageCount];
+   /// Event counters, indexed by the IDs given out by RegisterCounter()
+   std::atomic<long long>                 counts[MAX_COUNTERS];
+   /// Names of the registered counters
+   StringArray                            counterNames;
+   /// Guards counterNames while counters register
+   mutable std::mutex                     registryMutex;
+
+   /// Wall clock time when the profiler was reset
+   Real                                   runStart;
+   /// Totals at the most recent interval mark
+   Snapshot                               lastMark;
+   /// Per-interval values for each completed interval
+   std::vector<Snapshot>                  intervals;
+
+   RunProfiler();
+   ~RunProfiler();
+
+   Integer              FindCounter(const std::string &name) const;
+   void                 TakeSnapshot(Snapshot &snap) const;
+   void                 WriteSnapshotJson(std::stringstream &out,
+                                          const Snapshot &snap,
+                                          const std::string &indent) const;
+};
+
+
+//------------------------------------------------------------------------------
+// class ProfileScope
+//------------------------------------------------------------------------------
+/**
+ * Times a block of code for the RunProfiler.  The timer starts when the object
+ * is constructed and the sample is recorded when it goes out of scope.  The
+ * enabled state is latched at construction, so a scope that starts while
+ * profiling is off records nothing.
+ */
+//------------------------------------------------------------------------------
+class ProfileScope
+{
+public:
+   ProfileScope(RunProfiler::Stage which) :
+      stage    (which),
+      active   (RunProfiler::IsEnabled())
+   {
+      if (active)
+      {
+         wallStart = RunProfiler::GetWallTime();
+         cpuStart  = std::clock();
+      }
+   }
+
+   ~ProfileScope()
+   {
+      if (active)
+      {
+         RunProfiler::Instance()->AddSample(stage,
+               RunProfiler::GetWallTime() - wallStart,
+               (Real)(std::clock() - cpuStart) / CLOCKS_PER_SEC);
+      }
+   }
+
+private:
+   RunProfiler::Stage                     stage;
+   bool                                   active;
+   Real                                   wallStart;
+   std::clock_t                           cpuStart;
+
+   ProfileScope(const ProfileScope&);
+   ProfileScope& operator=(const ProfileScope&);
+};
+
+#endif // RunProfiler_hpp
@@ -1401,6 +1401,7 @@ bool STKEphemerisFile::ReadDataRecords(int logOption)
       }
    }
    a1EndEpoch = currentEpoch;
+   ResetIndexes();
 
    #ifdef DEBUG_SEGMENTING
       MessageInterface::ShowMessage("Segment Start Times:\n");
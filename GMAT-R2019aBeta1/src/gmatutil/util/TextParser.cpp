@@ -56,7 +56,9 @@ using namespace GmatStringUtil;
 //-------------------------------------------------------------------------------
 // TextParser()
 //-------------------------------------------------------------------------------
-TextParser::TextParser()
+TextParser::TextParser() :
+   theBlockType   (Gmat::COMMENT_BLOCK),
+   isFunctionCall (false)
 {
    whiteSpace = " \t";
 }
@@ -76,6 +78,8 @@ TextParser::~TextParser()
 void TextParser::Initialize(const StringArray &commandList)
 {
    theCommandList = commandList;
+   commandSet.clear();
+   commandSet.insert(commandList.begin(), commandList.end());
    Reset();
 }
 
@@ -554,6 +558,39 @@ Gmat::BlockType TextParser::EvaluateBlock(const std::string &logicalBlock)
 }
 
 
+//-------------------------------------------------------------------------------
+// void RestoreEvaluation(Gmat::BlockType blockType, const StringArray &chunks,
+//                        bool functionCall)
+//-------------------------------------------------------------------------------
+/**
+ * Sets the parser state to the result of an earlier EvaluateBlock() call.
+ *
+ * Blocks can be evaluated ahead of time by other parsers; this sets this
+ * parser up as if it had evaluated the block itself, so ChunkLine() and the
+ * comment accessors work as usual.
+ *
+ * @param blockType    The block type returned by EvaluateBlock()
+ * @param chunks       The preface comment, inline comment and instruction,
+ *                     as returned by GetChunks()
+ * @param functionCall The IsFunctionCall() flag after the evaluation
+ */
+//-------------------------------------------------------------------------------
+void TextParser::RestoreEvaluation(Gmat::BlockType blockType,
+                                   const StringArray &chunks, bool functionCall)
+{
+   if (chunks.size() != 3)
+      throw UtilityException("TextParser::RestoreEvaluation() requires the "
+                             "preface comment, inline comment and instruction");
+   
+   prefaceComment = chunks[0];
+   inlineComment  = chunks[1];
+   theInstruction = chunks[2];
+   theChunks      = chunks;
+   theBlockType   = blockType;
+   isFunctionCall = functionCall;
+}
+
+
 //-------------------------------------------------------------------------------
 // StringArray ChunkLine()
 //-------------------------------------------------------------------------------
@@ -1339,13 +1376,7 @@ StringArray TextParser::SeparateBy(const std::string &chunk, const std::string &
 //-------------------------------------------------------------------------------
 bool TextParser::IsCommand(const std::string &str)
 {
-   bool found = false;
-
-   if (find(theCommandList.begin(), theCommandList.end(), str)
-       != theCommandList.end())
-      found = true;
-
-   return found;
+   return (commandSet.find(str) != commandSet.end());
 }
 
 
@@ -32,6 +32,7 @@
 #define TextParser_hpp
 
 #include "utildefs.hpp"
+#include <unordered_set>
 
 namespace Gmat
 {
@@ -62,6 +63,7 @@ public:
    void Initialize(const StringArray &commandList);
    StringArray& GetChunks() { return theChunks; }
    bool IsFunctionCall() { return isFunctionCall; }
+   Gmat::BlockType GetBlockType() { return theBlockType; }
    
    void Reset();
    
@@ -70,6 +72,8 @@ public:
    
    // for parsing
    Gmat::BlockType EvaluateBlock(const std::string &logicalBlock);
+   void RestoreEvaluation(Gmat::BlockType blockType, const StringArray &chunks,
+                          bool functionCall);
    StringArray DecomposeBlock(const std::string &logicalBlock);
    StringArray ChunkLine();
    
@@ -102,6 +106,8 @@ private:
    std::string whiteSpace;
    StringArray theChunks;
    StringArray theCommandList;
+   /// Hashed copy of theCommandList used for keyword lookups
+   std::unordered_set<std::string> commandSet;
    Gmat::BlockType theBlockType;
    bool isFunctionCall;
    char errorMsg[1024];
@@ -46,7 +46,9 @@ HermiteInterpolator::HermiteInterpolator(const std::string &name, Integer dim,
       Integer points) :
    Interpolator            (name, "HermiteInterpolator", dim),
    pointsWanted            (points),
-   interpolateNewtonian    (true)
+   interpolateNewtonian    (true),
+   builtPoints             (0),
+   coefficientsStale       (true)
 {
    bufferSize = pointsWanted+1;
 }
@@ -76,7 +78,9 @@ HermiteInterpolator::~HermiteInterpolator()
 HermiteInterpolator::HermiteInterpolator(const HermiteInterpolator &hi) :
    Interpolator            (hi),
    pointsWanted            (hi.pointsWanted),
-   interpolateNewtonian    (hi.interpolateNewtonian)
+   interpolateNewtonian    (hi.interpolateNewtonian),
+   builtPoints             (0),
+   coefficientsStale       (true)
 {
 }
 
@@ -102,6 +106,8 @@ HermiteInterpolator& HermiteInterpolator::operator=(const HermiteInterpolator &h
       interpolateNewtonian = hi.interpolateNewtonian;
 
       CleanupArrays();
+      derivatives.clear();
+      ResetQCoefficients();
    }
 
    return *this;
@@ -131,12 +137,51 @@ Interpolator* HermiteInterpolator::Clone() const
 void HermiteInterpolator::Clear()
 {
    derivatives.clear();
-   qCoeffs.clear();
-   tValues.clear();
+   ResetQCoefficients();
    Interpolator::Clear();
 }
 
 
+//------------------------------------------------------------------------------
+// bool AddPoint(const Real ind, const Real *data)
+//------------------------------------------------------------------------------
+/**
+ * Adds a point to the interpolator's ring buffer
+ *
+ * Points that extend the buffer are appended to the divided differences on the
+ * next interpolation.  A point that replaces one in the buffer forces a
+ * rebuild of the coefficients.
+ *
+ * @param ind   The value of the independent parameter
+ * @param data  The dependent data values
+ *
+ * @return true on success
+ */
+//------------------------------------------------------------------------------
+bool HermiteInterpolator::AddPoint(const Real ind, const Real *data)
+{
+   bool wraps = (pointCount >= bufferSize);
+   if (wraps)
+      coefficientsStale = true;
+
+   bool retval = Interpolator::AddPoint(ind, data);
+
+   // Keep the derivative containers aligned with the point buffer
+   if (derivatives.size() > 0)
+   {
+      for (Integer i = 0; i < dimension; ++i)
+      {
+         if (wraps)
+            derivatives[i][latestPoint].clear();
+         else
+            derivatives[i].push_back(RealArray());
+      }
+   }
+
+   return retval;
+}
+
+
 //------------------------------------------------------------------------------
 // bool AddDerivative(const Real ind, const Real *data, const Integer order)
 //------------------------------------------------------------------------------
@@ -165,13 +210,15 @@ bool HermiteInterpolator::AddDerivative(const Real ind, const Real *data,
       throw InterpolatorException("The Hermite interpolator is only configured "
             "through first order derivatives.");
 
+   Integer count = (pointCount < bufferSize ? pointCount : bufferSize);
+
    // Setup the data structure if needed: derivatives[element][point][deriv]
    if (derivatives.size() == 0)
    {
       for (Integer i = 0; i < dimension; ++i)
       {
          std::vector<RealArray> dvi;
-         for (Integer j = 0; j < pointCount; ++j)
+         for (Integer j = 0; j < count; ++j)
          {
             RealArray dv;
             dvi.push_back(dv);
@@ -182,13 +229,21 @@ bool HermiteInterpolator::AddDerivative(const Real ind, const Real *data,
 
    // Find the index of the point receiving derivative data
    Integer index = -1;
-   for (Integer j = 0; j < pointCount; ++j)
+   for (Integer j = 0; j < count; ++j)
       if (independent[j] == ind)
       {
          index = j;
          break;
       }
 
+   if (index == -1)
+      throw InterpolatorException("Derivative data was supplied to the "
+            "Hermite interpolator for a point that has not been added.");
+
+   // Changing the data of a point already in the coefficients needs a rebuild
+   if (index < builtPoints)
+      coefficientsStale = true;
+
    for (Integer i = 0; i < dimension; ++i)
    {
       // Derivative values must be larger than -9.99999e99: that value
@@ -331,127 +386,145 @@ bool HermiteInterpolator::InterpolateCartesianState(const Real ind, Real *result
 //------------------------------------------------------------------------------
 
 //------------------------------------------------------------------------------
-// bool BuildprevCol()
+// bool BuildQCoefficients()
 //------------------------------------------------------------------------------
 /**
  * Hermite method used to construct divided difference coefficients
  *
- * Constructs the coefficients of the Hermite polynomial by walking through the
- * prevCol creation mechanism
+ * Constructs the coefficients of the Hermite polynomial, the top row of the
+ * divided difference tableau.  The tableau is extended one diagonal at a time,
+ * so points added since the last call only add their own terms.  The
+ * coefficients are rebuilt from the first point when points already used have
+ * changed.
  *
- * @return The top row of the divided difference prevCol -- i.e. the Hermite
- *         polynomial coefficients
+ * @return true if coefficients are available, false if there are no points
  */
 //------------------------------------------------------------------------------
 bool HermiteInterpolator::BuildQCoefficients()
 {
-   bool retval = false;
-
-   // Start from nothing
-   qCoeffs.clear();
-   RealArray qs, x;
-
+   Integer count = (pointCount < bufferSize ? pointCount : bufferSize);
+   if (count == 0)
+      return false;
 
-   // We only need the prevCol one column at a time
-   RealArray prevCol, tableau;
-   tValues.clear();
-
-   // Walk through element by element
-   for (UnsignedInt i = 0; i < dimension; ++i)
+   // Requirement: The same derivative order for every point for this element
+   IntegerArray dvSize(dimension, 0);
+   for (Integer i = 0; i < dimension; ++i)
    {
-      // Setup the array for this element
-      qCoeffs.push_back(qs);
+      if ((derivatives.size() > 0) && (derivatives[i].size() > 0))
+         dvSize[i] = derivatives[i][0].size();
+      if ((builtPoints > 0) && (dvSize[i] != builtDvSize[i]))
+         coefficientsStale = true;
+   }
 
-      // Load the variable data: qCoeffs[i][0] = f(x_i)
-      qCoeffs[i].push_back(dependent[0][i]);
+   if (coefficientsStale || (builtPoints > count))
+      ResetQCoefficients();
 
-      // Build the divided difference queue
-      prevCol.clear();
-      tableau.clear();
-      x.clear();
+   for (Integer m = builtPoints; m < count; ++m)
+      for (Integer i = 0; i < dimension; ++i)
+         AppendNode(i, m, dvSize[i]);
 
-      // Requirement: The same derivative order for every point for this element
-      Integer dvSize = (derivatives.size() == 0 ? 0 :
-            (derivatives[i].size() == 0 ? 0 : derivatives[i][0].size()));
+   builtPoints = count;
+   builtDvSize = dvSize;
 
-      // Initial prep
-      for (Integer m = 0; m < pointCount; ++m)
+   #ifdef DUMP_INTERPOLATOR_DATA
+      MessageInterface::ShowMessage("Q matrix:\n");
+      for (UnsignedInt i = 0; i < qCoeffs.size(); ++i)
       {
-         for (Integer n = 0; n < dvSize+1; ++n)
-         {
-            // If we allow for absent derivative data, adjust things here
-            if ((n > 0) && (derivatives[i][m].size() == 0))
-               throw InterpolatorException("The derivative data provided is "
-                     "inconsistent: some elements of a component of the "
-                     "interpolation vector have derivatives while other "
-                     "elements do not.");
-            x.push_back(independent[m]);
-            prevCol.push_back(dependent[m][i]);
-         }
+         MessageInterface::ShowMessage("   %d:  ", i);
+         for (UnsignedInt j = 0; j < qCoeffs[i].size(); ++j)
+            MessageInterface::ShowMessage("   %.10le", qCoeffs[i][j]);
+         MessageInterface::ShowMessage("\n");
       }
+      MessageInterface::ShowMessage("\n");
+   #endif
 
-      Integer order = pointCount * (dvSize + 1) - 1;
-
-      #ifdef DUMP_INTERPOLATOR_DATA
-         MessageInterface::ShowMessage("Element %d initial column Data:\n", i);
-
-         MessageInterface::ShowMessage("   Initial data: Ind, Dep\n");
-         for (UnsignedInt j = 0; j < x.size(); ++j)
-         {
-            MessageInterface::ShowMessage("      %d:  %.10lf   %.10le\n", j,
-                  x[j], prevCol[j]);
-         }
-      #endif
+   return true;
+}
 
-      // Initialize the tableau with derivative data, if available
-      Integer point = 0, tindex = 1;
 
-      for (UnsignedInt t = 0; t < order; ++t)
-      {
-         for (UnsignedInt j = 0; j < prevCol.size()-1; ++j)
-         {
-            Real deriv;
-            if (x[j+tindex] != x[j])
-            {
-               deriv = (prevCol[j+1] - prevCol[j]) / (x[j+tindex] - x[j]);
-               ++point;
-            }
-            else
-               deriv = derivatives[i][point][0];
-            tableau.push_back(deriv);
-         }
+//------------------------------------------------------------------------------
+// void ResetQCoefficients()
+//------------------------------------------------------------------------------
+/**
+ * Empties the divided difference data so the next build starts from the first
+ * point
+ */
+//------------------------------------------------------------------------------
+void HermiteInterpolator::ResetQCoefficients()
+{
+   qCoeffs.assign(dimension, RealArray());
+   tValues.assign(dimension, RealArray());
+   lastRow.assign(dimension, RealArray());
+   builtPoints = 0;
+   builtDvSize.clear();
+   coefficientsStale = false;
+}
 
-         #ifdef DUMP_INTERPOLATOR_DATA
-            MessageInterface::ShowMessage("   Tableau:");
-            for (UnsignedInt j = 0; j < tableau.size(); ++j)
-               MessageInterface::ShowMessage("   %.10le", tableau[j]);
-            MessageInterface::ShowMessage("\n");
-         #endif
 
-         qCoeffs[i].push_back(tableau[0]);
+//------------------------------------------------------------------------------
+// void AppendNode(Integer element, Integer point, Integer dvSize)
+//------------------------------------------------------------------------------
+/**
+ * Extends the divided difference tableau of an element with a point
+ *
+ * A point with derivative data enters the tableau once per available order:
+ * the repeated entry takes the derivative in place of the divided difference
+ * of coincident values.  Each entry adds the diagonal
+ *
+ *    next[0] = f(z_k)
+ *    next[m] = (next[m-1] - last[m-1]) / (z_k - z_{k-m})
+ *
+ * where last is the previous diagonal, and its final term is the new
+ * coefficient.  The terms match those of the full tableau.
+ *
+ * @param element The index of the element receiving the point
+ * @param point   The index of the point in the buffer
+ * @param dvSize  The number of derivatives used for the element
+ */
+//------------------------------------------------------------------------------
+void HermiteInterpolator::AppendNode(Integer element, Integer point,
+      Integer dvSize)
+{
+   RealArray &t    = tValues[element];
+   RealArray &last = lastRow[element];
+   RealArray next;
 
-         prevCol = tableau;
-         tableau.clear();
-         ++tindex;
+   for (Integer n = 0; n < dvSize+1; ++n)
+   {
+      // If we allow for absent derivative data, adjust things here
+      if ((n > 0) && (derivatives[element][point].size() == 0))
+         throw InterpolatorException("The derivative data provided is "
+               "inconsistent: some elements of a component of the "
+               "interpolation vector have derivatives while other "
+               "elements do not.");
+
+      Integer k = t.size();
+      Real z = independent[point];
+
+      next.resize(k+1);
+      next[0] = dependent[point][element];
+      for (Integer m = 1; m <= k; ++m)
+      {
+         if (z != t[k-m])
+            next[m] = (next[m-1] - last[m-1]) / (z - t[k-m]);
+         else if ((m == 1) && (n > 0))
+            next[m] = derivatives[element][point][0];
+         else
+            throw InterpolatorException("The Hermite interpolator received "
+                  "repeated values of the independent variable.");
       }
 
-      tValues.push_back(x);
-      retval = true;
+      t.push_back(z);
+      qCoeffs[element].push_back(next[k]);
+      last.swap(next);
    }
 
    #ifdef DUMP_INTERPOLATOR_DATA
-      MessageInterface::ShowMessage("Q matrix:\n");
-      for (UnsignedInt i = 0; i < qCoeffs.size(); ++i)
-      {
-         MessageInterface::ShowMessage("   %d:  ", i);
-         for (UnsignedInt j = 0; j < qCoeffs[i].size(); ++j)
-            MessageInterface::ShowMessage("   %.10le", qCoeffs[i][j]);
-         MessageInterface::ShowMessage("\n");
-      }
+      MessageInterface::ShowMessage("   Element %d diagonal:", element);
+      for (UnsignedInt j = 0; j < last.size(); ++j)
+         MessageInterface::ShowMessage("   %.10le", last[j]);
       MessageInterface::ShowMessage("\n");
    #endif
-
-   return retval;
 }
 
 
@@ -505,6 +578,10 @@ bool HermiteInterpolator::EvaluatePolynomial(const Real ind, Real *results)
 /**
  * Generates derivative data for the interpolating polynomial
  *
+ * The Newton basis products P_j = prod_{l<j} (ind - t_l) and their derivatives
+ * are accumulated together, P_{j+1}' = P_j' (ind - t_j) + P_j, so each element
+ * takes one pass over its coefficients.
+ *
  * @param ind The independent parameter value at which the derivative is needed
  * @param results The container for the derivative data
  *
@@ -518,56 +595,20 @@ bool HermiteInterpolator::EvaluatePolynomialDerivative(const Real ind, Real *res
    // Walk through element by element
    for (UnsignedInt i = 0; i < dimension; ++i)
    {
-      Real tProduct;
+      Real tProduct = 1.0, dProduct = 0.0;
       results[i] = 0.0;
       for (UnsignedInt j = 1; j < qCoeffs[i].size(); ++j)
       {
-         tProduct = EvaluateDerivativeIndependentTerm(ind, j, i);
-         results[i] += qCoeffs[i][j] * tProduct;
+         Real diff = ind - tValues[i][j-1];
+         dProduct = dProduct * diff + tProduct;
+         tProduct *= diff;
+         results[i] += qCoeffs[i][j] * dProduct;
       }
    }
 
    return retval;
 }
 
-
-//------------------------------------------------------------------------------
-// Real EvaluateDerivativeIndependentTerm(Integer ind, Integer order)
-//------------------------------------------------------------------------------
-/**
- * Evaluate independent variable part of the derivative polynomial
- *
- * @param ind The independent parameter value at which the derivative is needed
- * @param order The order of the Q coefficient that needs the computed value
- * @param forElement The interpolent element that is currently being evaluated
- *
- * @return The coefficient of teh polynomial term used in teh evaluation
- */
-//------------------------------------------------------------------------------
-Real HermiteInterpolator::EvaluateDerivativeIndependentTerm(const Real ind,
-      Integer order, Integer forElement)
-{
-   Real tt = 0.0, prod;
-
-   if (order > 1)
-   {
-      for (Integer i = 0; i < order; ++i)
-      {
-         prod = 1.0;
-         for (Integer j = 0; j < order; ++j)
-         {
-            if (j != i)
-               prod *= (ind - tValues[forElement][j]);
-         }
-         tt += prod;
-      }
-   }
-   else
-      tt = 1.0;
-
-   return tt;
-}
-
 ////------------------------------------------------------------------------------
 //// Methods used for Lagrange polynomials
 ////------------------------------------------------------------------------------
@@ -43,6 +43,10 @@
  *
  * The current code implements Hermite-Newton interpolation, using divided
  * differences to build a tableau of terms that are then used for interpolation.
+ * The coefficients are kept between interpolations.  Points added after the
+ * coefficients are built extend the tableau by one diagonal each, so only the
+ * new terms are computed; the tableau is rebuilt when points already used are
+ * replaced or receive new derivative data.
  * The current implementation follows the derivation presented at
  *
  *   http://www.personal.psu.edu/jjb23/web/htmls/sl455SP12/ch3/CH03_4B.pdf
@@ -75,6 +79,7 @@ public:
    virtual Interpolator*   Clone() const;
    virtual void            Clear();
 
+   virtual bool            AddPoint(const Real ind, const Real *data);
    virtual bool            AddDerivative(const Real ind, const Real *data,
                                  const Integer order = 1);
    virtual bool            Interpolate(const Real ind, Real *results);
@@ -94,6 +99,14 @@ protected:
    std::vector<RealArray> qCoeffs;
    /// Independent data used with the polynomials
    std::vector<RealArray> tValues;
+   /// Last diagonal of the divided difference tableau (dimension x order)
+   std::vector<RealArray> lastRow;
+   /// Number of points included in the coefficients
+   Integer builtPoints;
+   /// Number of derivatives per point used for each element's coefficients
+   IntegerArray builtDvSize;
+   /// Flag indicating the coefficients must be rebuilt from the first point
+   bool coefficientsStale;
 
 //   // Inherited methods that need some revision for HermiteInterpolator
 //   virtual void AllocateArrays();
@@ -104,9 +117,11 @@ protected:
 
 
    bool                    BuildQCoefficients();
+   void                    ResetQCoefficients();
+   void                    AppendNode(Integer element, Integer point,
+                                 Integer dvSize);
    bool                    EvaluatePolynomial(const Real ind, Real *results);
    bool                    EvaluatePolynomialDerivative(const Real ind, Real *results);
-   Real                    EvaluateDerivativeIndependentTerm(const Real ind, Integer order, Integer forElement);
 
 
 //   // Lagrange polynomial structures and methods
@@ -33,6 +33,7 @@
 #include "InterpolatorException.hpp"
 #include "RealUtilities.hpp"         // for GmatMathUtil::Abs()
 #include "MessageInterface.hpp"
+#include <algorithm>                 // for std::lower_bound()
 
 //#define DEBUG_LAGRANGE_FEASIBLE
 //#define DEBUG_LAGRANGE_BUILD
@@ -66,7 +67,12 @@ LagrangeInterpolator::LagrangeInterpolator(const std::string &name, Integer dim,
    startPoint    (0),
    lastX         (-9.9999e75),
    x             (NULL),
-   y             (NULL)
+   y             (NULL),
+   pointsChanged (true),
+   pointsSorted  (false),
+   weights       (NULL),
+   weightStart   (-1),
+   weightEnd     (-1)
 {
    // Made bufferSize 10 times bigger than order, so that we can collect more
    // data to place requested ind parameter in the near to the center of the
@@ -118,7 +124,12 @@ LagrangeInterpolator::LagrangeInterpolator(const LagrangeInterpolator &li) :
    startPoint     (li.startPoint),
    lastX          (li.lastX),
    x              (NULL),
-   y              (NULL)
+   y              (NULL),
+   pointsChanged  (true),
+   pointsSorted   (false),
+   weights        (NULL),
+   weightStart    (-1),
+   weightEnd      (-1)
 {
    bufferSize = li.bufferSize;
    AllocateArrays();
@@ -153,6 +164,13 @@ LagrangeInterpolator::operator=(const LagrangeInterpolator &li)
    startPoint = li.startPoint;
    lastX      = li.lastX;
    
+   // The ordered arrays are rebuilt and the weights recomputed on the next
+   // interpolation
+   pointsChanged = true;
+   pointsSorted  = false;
+   weightStart   = -1;
+   weightEnd     = -1;
+   
    return *this;
 }
 
@@ -276,6 +294,10 @@ void LagrangeInterpolator::Clear()
    actualSize = 0;
    beginIndex = 0;
    startPoint = 0;
+   pointsChanged = true;
+   pointsSorted  = false;
+   weightStart   = -1;
+   weightEnd     = -1;
    
    for (Integer i = 0; i <= bufferSize; ++i)
       x[i] = -9.9999e75;
@@ -314,6 +336,7 @@ bool LagrangeInterpolator::AddPoint(const Real ind, const Real *data)
    MessageInterface::ShowMessage
       ("Lagrange::AddPoint() returning Interpolator::AddPoint(ind, data)\n");
    #endif
+   pointsChanged = true;
    return Interpolator::AddPoint(ind, data);
 }
 
@@ -325,7 +348,13 @@ bool LagrangeInterpolator::AddPoint(const Real ind, const Real *data)
  * Perform the interpolation.
  * 
  * This method is the core interface for the lagrange interpolation.
- * See the GMAT math spec for the algorithm.
+ * See the GMAT math spec for the algorithm.  The polynomial is evaluated in
+ * the barycentric form
+ *
+ *    p(ind) = sum(w_i y_i / (ind - x_i)) / sum(w_i / (ind - x_i))
+ *
+ * where the weights w_i depend only on the x values, so they are computed
+ * once for each set of points and reused by later calls on the same points.
  * 
  * @param ind       The value of the independent parameter.
  * @param results   Data structure for the estimates.
@@ -357,8 +386,9 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
       return false;
    }
    
-   // Build data points
-   BuildDataPoints(ind);
+   // Build data points; the ordered arrays only change when points are added
+   if (pointsChanged)
+      BuildDataPoints(ind);
    
    // Update index and check if it is inside a range
    if (!UpdateBeginAndEndIndex(ind))
@@ -392,10 +422,6 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
    // Find starting point that will put ind in the center
    FindStartingPoint(ind);
    
-   // Now interpolate using the algorithm in the Math Spec.
-   Real *products = new Real[dimension];
-   Real *estimates = new Real[dimension];
-   
    #ifdef DUMP_DATA_POINT_20
       if (!dataDumped)
       {
@@ -417,9 +443,6 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
       }
    #endif
    
-   for (Integer dim = 0; dim < dimension; ++dim)
-      estimates[dim] = 0.0;
-   
    Integer endPoint = startPoint + order;
    #ifdef DEBUG_LAGRANGE_INTERPOLATE
    MessageInterface::ShowMessage
@@ -445,68 +468,47 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
    #ifdef DEBUG_LAGRANGE_INTERPOLATE
    MessageInterface::ShowMessage("   new startPoint=%d, endPoint=%d\n", startPoint, endPoint);
    #endif
+   
+   // The weights only depend on the points, so reuse them while the
+   // interpolation window is unchanged
+   if ((startPoint != weightStart) || (endPoint != weightEnd))
+      ComputeWeights(startPoint, endPoint);
+   
+   // A request at a data point returns the data
    for (Integer i = startPoint; i <= endPoint; i++)
    {
-      #ifdef DEBUG_LAGRANGE_INTERPOLATE
-      MessageInterface::ShowMessage
-         ("***** x[%d] = %.15f, y[%d] = %.15f, %.15f, %.15f\n", i, x[i], i, y[i][0], y[i][1], y[i][2]);
-      #endif
-      for (Integer dim = 0; dim < dimension; dim++)
+      if (ind == x[i])
       {
-         products[dim] = y[i][dim];
+         for (Integer dim = 0; dim < dimension; ++dim)
+            results[dim] = y[i][dim];
          
-         #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
+         #ifdef DEBUG_LAGRANGE_INTERPOLATE
          MessageInterface::ShowMessage
-            ("  i=%d, products[%d]=%f\n", i, dim, products[dim]);
+            ("Lagrange::Interpolate() returning true, %f is data point %d\n",
+             ind, i);
          #endif
+         return true;
       }
-      
-      for (Integer j = startPoint; j <= endPoint; j++)
-      {
-         if (i != j)
-         {
-            for (Integer dim = 0; dim < dimension; ++dim)
-            {
-               // Should I check for divide by zero?
-               if ((x[i] - x[j] == 0.0))
-               {
-                  MessageInterface::ShowMessage("WARNING: Lagrange interpolation zero denominator\n");
-                  #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
-                  MessageInterface::ShowMessage("   x[%d]- x[%d]=%f\n", i, j, (x[i]- x[j]));
-                  #endif
-               }
-               products[dim] = products[dim] * (ind - x[j]) / (x[i]- x[j]);
-            }
-         }
-      }
-
-      #ifdef DUMP_DATA_POINT_20
-         if (!dataDumped)
-         {
-            // Report from the 20th interpolation
-            if (calls == 20)
-            {
-               MessageInterface::ShowMessage("Products for %d:  ", i-startPoint); 
-               for (Integer dim = 0; dim < dimension; dim++)
-                  MessageInterface::ShowMessage("   %.12lf", products[dim]);
-               MessageInterface::ShowMessage("\n");
-            }
-         }
-      #endif
-
+   }
+   
+   Real denominator = 0.0;
+   for (Integer dim = 0; dim < dimension; ++dim)
+      results[dim] = 0.0;
+   
+   for (Integer i = startPoint; i <= endPoint; i++)
+   {
       #ifdef DEBUG_LAGRANGE_INTERPOLATE
       MessageInterface::ShowMessage
-         ("***** products[%d] = %.15f, %.15f, %.15f\n", i, products[0], products[1], products[2]);
+         ("***** x[%d] = %.15f, y[%d] = %.15f, %.15f, %.15f\n", i, x[i], i, y[i][0], y[i][1], y[i][2]);
       #endif
+      Real term = weights[i - startPoint] / (ind - x[i]);
+      denominator += term;
       for (Integer dim = 0; dim < dimension; ++dim)
-      {
-         #ifdef DEBUG_LAGRANGE_INTERPOLATE_MORE
-         MessageInterface::ShowMessage
-            ("  i=%d, products[%d]=%f\n", i, dim, products[dim]);
-         #endif
-         estimates[dim] = estimates[dim] + products[dim];
-      }
+         results[dim] += term * y[i][dim];
    }
+   
+   for (Integer dim = 0; dim < dimension; ++dim)
+      results[dim] /= denominator;
 
    #ifdef DUMP_DATA_POINT_20
       if (!dataDumped)
@@ -516,21 +518,12 @@ bool LagrangeInterpolator::Interpolate(const Real ind, Real *results)
          {
             MessageInterface::ShowMessage("\nFinal estimate:  "); 
             for (Integer dim = 0; dim < dimension; dim++)
-               MessageInterface::ShowMessage("   %.12lf", estimates[dim]);
+               MessageInterface::ShowMessage("   %.12lf", results[dim]);
             MessageInterface::ShowMessage("\n==================================================\n");
          }
       }
    #endif
    
-   // copy results
-   for (Integer dim = 0; dim < dimension; ++dim)
-   {
-      results[dim] = estimates[dim];
-   }
-   
-   delete [] products;
-   delete [] estimates;
-   
    #ifdef DEBUG_LAGRANGE_INTERPOLATE
    MessageInterface::ShowMessage
       ("Lagrange::Interpolate() returning true, results[0:2] = %f, %f, %f\n",
@@ -584,6 +577,7 @@ void LagrangeInterpolator::AllocateArrays()
    
    x = new Real[bufferSize+1];
    y = new Real*[bufferSize+1];
+   weights = new Real[bufferSize+1];
 
    for (Integer i = 0; i <= bufferSize; ++i)
    {
@@ -592,6 +586,9 @@ void LagrangeInterpolator::AllocateArrays()
    }
    
    latestPoint = -1;
+   pointsChanged = true;
+   weightStart = -1;
+   weightEnd = -1;
 }
 
 
@@ -611,9 +608,11 @@ void LagrangeInterpolator::CleanupArrays()
          delete [] y[i];
       delete [] x;
       delete [] y;
+      delete [] weights;
 
       x = NULL;
       y = NULL;
+      weights = NULL;
    }
 
    Interpolator::CleanupArrays();
@@ -674,6 +673,11 @@ void LagrangeInterpolator::BuildDataPoints(Real ind)
        indData, bufferSize, pointCount, actualSize);
    #endif
    
+   pointsSorted = true;
+   pointsChanged = false;
+   weightStart = -1;
+   weightEnd = -1;
+   
    for (i = 1; i < actualSize; ++i)
    {
       if (sign*independent[i] < indData)
@@ -692,6 +696,9 @@ void LagrangeInterpolator::BuildDataPoints(Real ind)
       for (j = 0; j < dimension; j++)
          y[i][j] = dependent[start][j];
       
+      if ((i > 0) && (x[i] < x[i-1]))
+         pointsSorted = false;
+      
       #ifdef DEBUG_LAGRANGE_BUILD
       MessageInterface::ShowMessage
          ("   start = %2d, x[%2d] = %.7f, y[%2d][0] = %f, y[%2d][2] = %f\n",
@@ -726,12 +733,22 @@ bool LagrangeInterpolator::UpdateBeginAndEndIndex(Real ind)
    Integer nearestDataIndex = 0;
    bool isIndexValid = true;
    
-   for (Integer i = 0; i < actualSize; i++)
+   if (pointsSorted)
+   {
+      // Binary search for the first point at or after ind
+      Real *pos = std::lower_bound(x, x + actualSize, ind);
+      if (pos != x + actualSize)
+         nearestDataIndex = (Integer)(pos - x);
+   }
+   else
    {
-      if (x[i] >= ind)
+      for (Integer i = 0; i < actualSize; i++)
       {
-         nearestDataIndex = i;
-         break;
+         if (x[i] >= ind)
+         {
+            nearestDataIndex = i;
+            break;
+         }
       }
    }
    
@@ -896,3 +913,49 @@ Integer LagrangeInterpolator::FindStartingPoint(Real ind)
 }
 
 
+//------------------------------------------------------------------------------
+// void ComputeWeights(Integer first, Integer last)
+//------------------------------------------------------------------------------
+/**
+ * Computes the barycentric weights for the points from first to last,
+ *
+ *    w_i = 1 / prod_{j != i} ((x_i - x_j) / h)
+ *
+ * The differences are scaled by the mean point spacing h to keep the products
+ * near unity; the scale cancels in the barycentric formula.
+ *
+ * @param first The index of the first point
+ * @param last  The index of the last point
+ */
+//------------------------------------------------------------------------------
+void LagrangeInterpolator::ComputeWeights(Integer first, Integer last)
+{
+   Real scale = 1.0;
+   if ((last > first) && (x[last] != x[first]))
+      scale = (last - first) / (x[last] - x[first]);
+   
+   for (Integer i = first; i <= last; ++i)
+   {
+      Real product = 1.0;
+      for (Integer j = first; j <= last; ++j)
+      {
+         if (i != j)
+         {
+            if ((x[i] - x[j] == 0.0))
+               MessageInterface::ShowMessage("WARNING: Lagrange interpolation zero denominator\n");
+            product *= (x[i] - x[j]) * scale;
+         }
+      }
+      weights[i - first] = 1.0 / product;
+   }
+   
+   weightStart = first;
+   weightEnd = last;
+   
+   #ifdef DEBUG_LAGRANGE_BUILD
+   MessageInterface::ShowMessage
+      ("Lagrange::ComputeWeights() weights set for points %d to %d\n",
+       first, last);
+   #endif
+}
+
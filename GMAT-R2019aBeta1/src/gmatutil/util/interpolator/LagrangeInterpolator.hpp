@@ -73,6 +73,16 @@ protected:
    Real  *x;
    /// Array of ordered dependent variables used
    Real  **y;
+   /// Flag indicating points were added since x and y were built
+   bool  pointsChanged;
+   /// Flag indicating x is in nondecreasing order
+   bool  pointsSorted;
+   /// Barycentric weights for the points from weightStart to weightEnd
+   Real  *weights;
+   /// First point covered by the weights, or -1 if they are not set
+   Integer weightStart;
+   /// Last point covered by the weights
+   Integer weightEnd;
    
    // Inherited methods that need some revision for LagrangeInterpolator
    virtual void AllocateArrays();
@@ -83,6 +93,7 @@ protected:
    bool    UpdateBeginAndEndIndex(Real ind);
    bool    IsDataNearCenter(Real ind);
    Integer FindStartingPoint(Real ind);
+   void    ComputeWeights(Integer first, Integer last);
 };
 
 
@@ -226,6 +226,52 @@ bool NotAKnotInterpolator::Interpolate(const Real ind, Real *results)
 }
 
 
+//------------------------------------------------------------------------------
+//  bool GetCoefficients(const Integer piece, Real *coefficients)
+//------------------------------------------------------------------------------
+/**
+ * Builds the splines and returns the polynomial coefficients of one of them.
+ *
+ * Callers that evaluate the same splines many times can cache these values
+ * rather than rebuilding the splines for each estimate.  For each dimension i
+ * the piece evaluates as
+ *
+ *    y = coefficients[4*i] dx^3 + coefficients[4*i+1] dx^2 +
+ *        coefficients[4*i+2] dx + coefficients[4*i+3]
+ *
+ * where dx is measured from the first knot of the piece.
+ *
+ * @param piece         Index of the spline, 0 through 3, counted from the
+ *                      first of the ordered points.
+ * @param coefficients  Array, 4 * dimension long, receiving the coefficients.
+ *
+ * @return true on success, false on failure.
+ */
+//------------------------------------------------------------------------------
+bool NotAKnotInterpolator::GetCoefficients(const Integer piece,
+      Real *coefficients)
+{
+   if ((piece < 0) || (piece > 3))
+      return false;
+
+   if (pointCount < requiredPoints)
+      return false;
+
+   if (!BuildSplines())
+      return false;
+
+   for (Integer i = 0; i < dimension; ++i)
+   {
+      coefficients[4*i]   = a[piece][i];
+      coefficients[4*i+1] = b[piece][i];
+      coefficients[4*i+2] = c[piece][i];
+      coefficients[4*i+3] = d[piece][i];
+   }
+
+   return true;
+}
+
+
 //---------------------------------
 //  protected methods
 //---------------------------------
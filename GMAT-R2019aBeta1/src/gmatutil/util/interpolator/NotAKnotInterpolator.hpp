@@ -46,6 +46,8 @@ public:
    NotAKnotInterpolator&      operator=(const NotAKnotInterpolator &csi);
 
    virtual bool               Interpolate(const Real ind, Real *results);
+   bool                       GetCoefficients(const Integer piece,
+                                              Real *coefficients);
 
    // inherited from GmatBase
    virtual Interpolator*      Clone() const;